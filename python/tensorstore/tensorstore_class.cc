@@ -21,6 +21,8 @@
 #include "python/tensorstore/tensorstore_class.h"
 
 // Other headers
+#include <stddef.h>
+
 #include <optional>
 #include <string>
 #include <utility>
@@ -35,6 +37,7 @@
 #include "python/tensorstore/data_type.h"
 #include "python/tensorstore/define_heap_type.h"
 #include "python/tensorstore/future.h"
+#include "python/tensorstore/garbage_collection.h"
 #include "python/tensorstore/homogeneous_tuple.h"
 #include "python/tensorstore/index.h"
 #include "python/tensorstore/index_space.h"
@@ -80,6 +83,8 @@
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/std_vector.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/unit.h"
 
 // specializations
@@ -117,6 +122,7 @@ WriteFutures IssueCopyOrWrite(
   if (auto* store = std::get_if<PythonTensorStoreObject*>(&source)) {
     CopyOptions options;
     ApplyKeywordArguments<ParamDef...>(options, arg...);
+    GilScopedRelease gil_release;
     return tensorstore::Copy((**store).value, self, std::move(options));
   } else {
     WriteOptionsWithBatch options;
@@ -125,6 +131,10 @@ WriteFutures IssueCopyOrWrite(
     SharedArray<const void> source_array;
     ConvertToArray<const void, dynamic_rank, /*nothrow=*/false>(
         source_obj, &source_array, self.dtype(), 0, self.rank());
+    // `source_array` refers to the NumPy buffer (or a copy if conversion was
+    // required) and keeps it alive; issuing the write does not require the
+    // GIL.
+    GilScopedRelease gil_release;
     return tensorstore::Write(std::move(source_array), self,
                               std::move(options));
   }
@@ -484,11 +494,16 @@ Group:
       "read",
       [](Self& self, ContiguousLayoutOrder order,
          std::optional<Batch> batch) -> PythonFutureWrapper<SharedArray<void>> {
+        auto validated_batch =
+            internal_python::ValidateOptionalBatch(std::move(batch));
+        Future<SharedArray<void>> future;
+        {
+          GilScopedRelease gil_release;
+          future = tensorstore::Read<zero_origin>(self.value, order,
+                                                  std::move(validated_batch));
+        }
         return PythonFutureWrapper<SharedArray<void>>(
-            tensorstore::Read<zero_origin>(
-                self.value, order,
-                internal_python::ValidateOptionalBatch(std::move(batch))),
-            self.reference_manager());
+            std::move(future), self.reference_manager());
       },
       R"(
 Reads the data within the current domain.
@@ -563,9 +578,85 @@ See also:
 Group:
   I/O
 
+Overload:
+  order
 )",
       py::kw_only(), py::arg("order") = "C", py::arg("batch") = std::nullopt);
 
+  cls.def(
+      "read",
+      [](Self& self, ArrayArgumentPlaceholder target,
+         std::optional<Batch> batch) -> PythonFutureWrapper<void> {
+        SharedArray<void> target_array;
+        ConvertToArray<void, dynamic_rank, /*nothrow=*/false>(
+            target.value, &target_array, self.value.dtype());
+        auto validated_batch =
+            internal_python::ValidateOptionalBatch(std::move(batch));
+        Future<void> future;
+        {
+          GilScopedRelease gil_release;
+          future = tensorstore::Read(self.value, std::move(target_array),
+                                     std::move(validated_batch));
+        }
+        return PythonFutureWrapper<void>(std::move(future),
+                                         self.reference_manager());
+      },
+      R"(
+Reads the data within the current domain into an existing array.
+
+This is a zero-copy alternative to :py:obj:`.read`: the data is written
+directly into the caller-provided NumPy array, rather than into a newly
+allocated array.  The target must be a writable NumPy array with a data type
+equal to :python:`self.dtype` and a shape
+:ref:`broadcast-compatible<index-domain-alignment>` with
+:python:`self.domain`.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[70, 80],
+    ...     create=True)
+    >>> target = np.ones([5, 4], dtype=np.uint32)
+    >>> await dataset[5:10, 8:12].read(target)
+    >>> target
+    array([[0, 0, 0, 0],
+           [0, 0, 0, 0],
+           [0, 0, 0, 0],
+           [0, 0, 0, 0],
+           [0, 0, 0, 0]], dtype=uint32)
+
+Args:
+  target: Target array, must be a writable NumPy array with a data type equal
+    to :python:`self.dtype`.  The array must remain valid until the returned
+    future becomes ready.  If an error occurs, the array may be left in a
+    partially-written state.
+
+  batch: Batch to use for the read operation.
+
+    .. warning::
+
+       If specified, the returned :py:obj:`Future` will not, in general, become
+       ready until the batch is submitted.  Therefore, immediately awaiting the
+       returned future will lead to deadlock.
+
+Returns:
+  A future that becomes ready when the read has completed.
+
+Group:
+  I/O
+
+Overload:
+  target
+)",
+      py::arg("target"), py::kw_only(), py::arg("batch") = std::nullopt);
+
   ForwardWriteSetters([&](auto... param_def) {
     std::string doc = R"(
 Writes to the current domain.
@@ -2334,6 +2425,85 @@ Group:
       py::arg("context") = nullptr, py::arg("copy") = std::nullopt,
       py::arg("write") = std::nullopt);
 
+  m.def(
+      "read_batch",
+      [](std::vector<std::pair<PythonTensorStoreObject*,
+                               ArrayArgumentPlaceholder>>
+             operations) -> PythonFutureWrapper<void> {
+        std::vector<TensorStore<>> stores;
+        std::vector<SharedArray<void>> targets;
+        stores.reserve(operations.size());
+        targets.reserve(operations.size());
+        for (auto& [store, target] : operations) {
+          SharedArray<void> target_array;
+          ConvertToArray<void, dynamic_rank, /*nothrow=*/false>(
+              target.value, &target_array, store->value.dtype());
+          stores.push_back(store->value);
+          targets.push_back(std::move(target_array));
+        }
+        PythonObjectReferenceManager manager;
+        manager.Update(stores);
+        Future<void> future;
+        {
+          GilScopedRelease gil_release;
+          auto batch = Batch::New();
+          std::vector<AnyFuture> futures;
+          futures.reserve(stores.size());
+          for (size_t i = 0; i < stores.size(); ++i) {
+            futures.push_back(tensorstore::Read(
+                std::move(stores[i]), std::move(targets[i]), batch));
+          }
+          batch.Release();
+          future = WaitAllFuture(tensorstore::span<const AnyFuture>(futures));
+        }
+        return PythonFutureWrapper<void>(std::move(future),
+                                         std::move(manager));
+      },
+      R"(
+Reads from multiple TensorStores into existing arrays as a single batch.
+
+Logically equivalent to issuing :python:`store.read(target)` separately for
+each pair and waiting on all of the returned futures, but all of the reads
+share a single :py:obj:`Batch`, which coalesces the underlying kvstore
+requests, and only a single future is created, which amortizes the per-read
+binding overhead when issuing many small reads.
+
+Example:
+
+    >>> dataset = await ts.open(
+    ...     {
+    ...         'driver': 'zarr',
+    ...         'kvstore': {
+    ...             'driver': 'memory'
+    ...         }
+    ...     },
+    ...     dtype=ts.uint32,
+    ...     shape=[3, 4],
+    ...     create=True)
+    >>> targets = [np.ones([1, 4], dtype=np.uint32) for _ in range(3)]
+    >>> await ts.read_batch([
+    ...     (dataset[i:i + 1], targets[i]) for i in range(3)
+    ... ])
+    >>> targets[0]
+    array([[0, 0, 0, 0]], dtype=uint32)
+
+Args:
+  operations: Sequence of pairs of a :py:obj:`TensorStore` and a target array.
+    Each target must be a writable NumPy array with a data type equal to the
+    corresponding store's :py:obj:`~TensorStore.dtype` and a shape
+    :ref:`broadcast-compatible<index-domain-alignment>` with the store's
+    domain.  The arrays must remain valid until the returned future becomes
+    ready, and may be left in a partially-written state if an error occurs.
+
+Returns:
+  A future that becomes ready when all of the reads have completed.  The first
+  error encountered is propagated.
+
+Group:
+  I/O
+)",
+      py::arg("operations"));
+
   ForwardOpenSetters([&](auto... param_def) {
     std::string doc = R"(
 Opens or creates a :py:class:`TensorStore` from a :py:class:`Spec`.
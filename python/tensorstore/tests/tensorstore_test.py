@@ -61,6 +61,52 @@ async def test_open_array_driver():
     await t.read(order="X")
 
 
+async def test_read_into_target():
+  t = await ts.open({
+      "driver": "array",
+      "array": [[1, 2, 3], [4, 5, 6]],
+      "dtype": "int32",
+  })
+
+  target = np.zeros([2, 3], dtype=np.int32)
+  assert (await t.read(target)) is None
+  np.testing.assert_equal(target, [[1, 2, 3], [4, 5, 6]])
+
+  # Fortran-order targets are filled in place as well.
+  target_f = np.zeros([2, 3], dtype=np.int32, order="F")
+  await t.read(target_f)
+  np.testing.assert_equal(target_f, [[1, 2, 3], [4, 5, 6]])
+
+  # A target requiring conversion cannot be filled without copying.
+  with pytest.raises(ValueError):
+    await t.read(np.zeros([2, 3], dtype=np.int64))
+
+  # A read-only target cannot be filled.
+  readonly_target = np.zeros([2, 3], dtype=np.int32)
+  readonly_target.setflags(write=False)
+  with pytest.raises(ValueError):
+    await t.read(readonly_target)
+
+
+async def test_read_batch():
+  t = await ts.open({
+      "driver": "array",
+      "array": [[1, 2, 3], [4, 5, 6]],
+      "dtype": "int32",
+  })
+
+  targets = [np.zeros([3], dtype=np.int32) for _ in range(2)]
+  assert (await ts.read_batch([(t[i], targets[i]) for i in range(2)])) is None
+  np.testing.assert_equal(targets[0], [1, 2, 3])
+  np.testing.assert_equal(targets[1], [4, 5, 6])
+
+  # An empty batch completes immediately.
+  await ts.read_batch([])
+
+  with pytest.raises(ValueError):
+    await ts.read_batch([(t[0], np.zeros([3], dtype=np.int64))])
+
+
 async def test_resize():
   arr = np.asarray([[1, 2, 3], [4, 5, 6], [7, 8, 9]])
   t = await ts.open(
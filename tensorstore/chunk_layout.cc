@@ -2134,6 +2134,74 @@ absl::Status ChunkLayout::GetChunkTemplate(Usage usage,
   return absl::OkStatus();
 }
 
+Result<ChunkLayout::AlignedBoxInfo> ChunkLayout::GetChunkAlignedBox(
+    Usage usage, BoxView<> box) const {
+  assert(usage == kRead || usage == kWrite);
+  if (!IsFinite(box)) {
+    return absl::InvalidArgumentError(
+        tensorstore::StrCat("Expected finite box, but received: ", box));
+  }
+  AlignedBoxInfo info;
+  info.aligned_box = Box<>(box);
+  const DimensionIndex rank = this->rank();
+  if (rank == dynamic_rank) return info;
+  if (rank != box.rank()) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Rank of chunk layout (", rank, ") does not match expected rank (",
+        box.rank(), ")"));
+  }
+  auto grid_origin = this->grid_origin();
+  auto shape = (*this)[usage].shape();
+  Index num_full_chunks = 1;
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    if (grid_origin[i] == kImplicit || !grid_origin.hard_constraint[i] ||
+        shape[i] <= 0 || !shape.hard_constraint[i]) {
+      // Alignment is unknown for this dimension; leave the bounds unchanged
+      // and assume a single chunk.
+      continue;
+    }
+    const Index origin = grid_origin[i];
+    const Index size = shape[i];
+    if (box[i].empty()) {
+      info.num_chunks = 0;
+      num_full_chunks = 0;
+      info.aligned_box[i] =
+          IndexInterval::UncheckedSized(box[i].inclusive_min(), 0);
+      continue;
+    }
+    const Index first_cell =
+        FloorOfRatio(box[i].inclusive_min() - origin, size);
+    const Index last_cell = FloorOfRatio(box[i].inclusive_max() - origin, size);
+    const Index num_cells = last_cell - first_cell + 1;
+    Index aligned_origin, aligned_size, offset;
+    if (internal::MulOverflow(first_cell, size, &offset) ||
+        internal::AddOverflow(origin, offset, &aligned_origin) ||
+        internal::MulOverflow(num_cells, size, &aligned_size)) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Integer overflow computing chunk-aligned bounds for dimension ",
+          i));
+    }
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        info.aligned_box[i], IndexInterval::Sized(aligned_origin, aligned_size),
+        tensorstore::MaybeAnnotateStatus(
+            _, tensorstore::StrCat(
+                   "Incompatible grid origin/chunk shape for dimension ", i)));
+    // Chunks entirely contained in `box[i]` along this dimension.
+    const Index num_full_cells =
+        std::max(Index(0),
+                 FloorOfRatio(box[i].exclusive_max() - origin, size) -
+                     CeilOfRatio(box[i].inclusive_min() - origin, size));
+    if (internal::MulOverflow(info.num_chunks, num_cells, &info.num_chunks) ||
+        internal::MulOverflow(num_full_chunks, num_full_cells,
+                              &num_full_chunks)) {
+      return absl::InvalidArgumentError(
+          "Integer overflow computing chunk count");
+    }
+  }
+  info.num_partial_chunks = info.num_chunks - num_full_chunks;
+  return info;
+}
+
 }  // namespace tensorstore
 
 TENSORSTORE_DEFINE_SERIALIZER_SPECIALIZATION(
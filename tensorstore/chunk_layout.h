@@ -733,6 +733,48 @@ class ChunkLayout {
     return GetChunkTemplate(kRead, box);
   }
 
+  /// Chunk alignment information for a requested box, as computed by
+  /// `GetChunkAlignedBox`.
+  struct AlignedBoxInfo {
+    /// Smallest box containing the requested box whose bounds coincide with
+    /// chunk boundaries in every dimension with hard `grid_origin` and chunk
+    /// shape constraints; other dimensions are left unchanged.
+    Box<> aligned_box;
+
+    /// Total number of chunks intersected by the requested box (equal to the
+    /// number intersected by `aligned_box`).
+    Index num_chunks = 1;
+
+    /// Number of those chunks that the requested box covers only partially.
+    /// Accessing `aligned_box` instead of the requested box converts these
+    /// partial accesses to full-chunk accesses.
+    Index num_partial_chunks = 0;
+  };
+
+  /// Computes the smallest chunk-aligned box containing `box`, along with
+  /// estimates of the number of chunks accessed.
+  ///
+  /// This is advisory: as for `GetChunkTemplate`, only hard constraints on
+  /// `grid_origin()` and `(*this)[usage].shape()` are considered.  Dimensions
+  /// without both constraints are left unaligned and assumed to intersect a
+  /// single chunk.
+  ///
+  /// \param usage Must be either `kWrite` or `kRead`.
+  /// \param box Requested box; must be finite.
+  /// \error `absl::StatusCode::kInvalidArgument` if `box` is not finite, or
+  ///     `box.rank()` does not match `rank()`.
+  /// \error `absl::StatusCode::kInvalidArgument` if the aligned bounds or
+  ///     chunk counts would overflow.
+  Result<AlignedBoxInfo> GetChunkAlignedBox(Usage usage, BoxView<> box) const;
+
+  Result<AlignedBoxInfo> GetWriteChunkAlignedBox(BoxView<> box) const {
+    return GetChunkAlignedBox(kWrite, box);
+  }
+
+  Result<AlignedBoxInfo> GetReadChunkAlignedBox(BoxView<> box) const {
+    return GetChunkAlignedBox(kRead, box);
+  }
+
   /// Returns the inner order constraint.
   ///
   /// If the rank is unspecified, returns a rank-0 vector.
@@ -1864,4 +1864,64 @@ TEST(HasHardConstraints, Basic) {
   }
 }
 
+TEST(GetChunkAlignedBoxTest, Rank2) {
+  ChunkLayout layout;
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::GridOrigin({0, 1})));
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::ReadChunkShape({10, 10})));
+  // Misaligned on both sides of dimension 0; aligned in dimension 1.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto info, layout.GetReadChunkAlignedBox(BoxView({5, 1}, {20, 10})));
+  EXPECT_EQ(Box({0, 1}, {30, 10}), info.aligned_box);
+  EXPECT_EQ(3, info.num_chunks);
+  EXPECT_EQ(2, info.num_partial_chunks);
+
+  // Already aligned.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      info, layout.GetReadChunkAlignedBox(BoxView({0, 11}, {20, 10})));
+  EXPECT_EQ(Box({0, 11}, {20, 10}), info.aligned_box);
+  EXPECT_EQ(2, info.num_chunks);
+  EXPECT_EQ(0, info.num_partial_chunks);
+
+  // Negative origins.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      info, layout.GetReadChunkAlignedBox(BoxView({-5, 1}, {10, 5})));
+  EXPECT_EQ(Box({-10, 1}, {20, 10}), info.aligned_box);
+  EXPECT_EQ(2, info.num_chunks);
+  EXPECT_EQ(2, info.num_partial_chunks);
+}
+
+TEST(GetChunkAlignedBoxTest, UnconstrainedDimension) {
+  // Only dimension 0 has a hard chunk shape constraint; dimension 1 is left
+  // unchanged and assumed to intersect a single chunk.
+  ChunkLayout layout;
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::GridOrigin({0, 0})));
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::ReadChunkShape({10, 0})));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto info, layout.GetReadChunkAlignedBox(BoxView({5, 7}, {10, 10})));
+  EXPECT_EQ(Box({0, 7}, {20, 10}), info.aligned_box);
+  EXPECT_EQ(2, info.num_chunks);
+  EXPECT_EQ(2, info.num_partial_chunks);
+}
+
+TEST(GetChunkAlignedBoxTest, Unconstrained) {
+  ChunkLayout layout;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto info, layout.GetReadChunkAlignedBox(BoxView({5}, {10})));
+  EXPECT_EQ(Box({5}, {10}), info.aligned_box);
+  EXPECT_EQ(1, info.num_chunks);
+  EXPECT_EQ(0, info.num_partial_chunks);
+}
+
+TEST(GetChunkAlignedBoxTest, Invalid) {
+  ChunkLayout layout;
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::GridOrigin({0})));
+  TENSORSTORE_ASSERT_OK(layout.Set(ChunkLayout::ReadChunkShape({10})));
+  EXPECT_THAT(layout.GetReadChunkAlignedBox(Box<>(1)),
+              MatchesStatus(absl::StatusCode::kInvalidArgument,
+                            "Expected finite box.*"));
+  EXPECT_THAT(layout.GetReadChunkAlignedBox(BoxView({0, 0}, {5, 5})),
+              MatchesStatus(absl::StatusCode::kInvalidArgument,
+                            "Rank of chunk layout .* does not match .*"));
+}
+
 }  // namespace
@@ -545,6 +545,17 @@ Context Context::parent() const {
   return parent_context;
 }
 
+absl::Status Context::Prewarm() const {
+  if (!impl_ || !impl_->spec_) return absl::OkStatus();
+  for (const auto& resource_spec : impl_->spec_->resources_) {
+    TENSORSTORE_RETURN_IF_ERROR(
+        internal_context::GetOrCreateResource(*impl_, *resource_spec,
+                                              /*trigger=*/nullptr)
+            .status());
+  }
+  return absl::OkStatus();
+}
+
 namespace jb = tensorstore::internal_json_binding;
 
 TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
@@ -329,6 +329,18 @@ class Context {
   /// Returns the parent `Context`, if any.
   Context parent() const;
 
+  /// Eagerly creates all resources defined by this context's `spec()`.
+  ///
+  /// Resources are normally created lazily, when first required by an
+  /// operation.  This method instead constructs them immediately, so that the
+  /// setup cost of resources such as thread pools and HTTP transports is paid
+  /// up front (e.g. at server startup) rather than by the first operation that
+  /// uses them.  Resources that have already been created are unaffected, as
+  /// are resources defined by parent contexts.
+  ///
+  /// \returns The first error encountered creating a resource, if any.
+  absl::Status Prewarm() const;
+
  private:
   friend class internal_context::Access;
   internal_context::ContextImplPtr impl_;
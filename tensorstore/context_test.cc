@@ -671,6 +671,29 @@ TEST(ContextTest, WeakCreator) {
       GetCreator(static_cast<ResourceImplBase&>(*Access::impl(resource2))));
 }
 
+TEST(ContextTest, Prewarm) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto spec,
+                                   Context::Spec::FromJson({
+                                       {"int_resource", {{"value", 7}}},
+                                       {"int_resource#a", {{"value", 9}}},
+                                   }));
+  auto context = Context(spec);
+  // Resources are not created until first use.
+  EXPECT_EQ(0, Access::impl(context)->resources_.size());
+  TENSORSTORE_EXPECT_OK(context.Prewarm());
+  EXPECT_EQ(2, Access::impl(context)->resources_.size());
+  // Resources obtained after `Prewarm` are the already-created instances.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto resource,
+                                   context.GetResource<IntResource>());
+  EXPECT_EQ(7, *resource);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_a, context.GetResource<IntResource>("int_resource#a"));
+  EXPECT_EQ(9, *resource_a);
+  EXPECT_EQ(2, Access::impl(context)->resources_.size());
+  // `Prewarm` on a null context is a no-op.
+  TENSORSTORE_EXPECT_OK(Context().Prewarm());
+}
+
 /// Resource provider used for testing context resources that depend on other
 /// context resources.
 ///
@@ -39,6 +39,7 @@
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/index_transform_builder.h"
 #include "tensorstore/index_space/transform_array_constraints.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -207,10 +208,12 @@ class ArrayDriver
  public:
   explicit ArrayDriver(
       Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency,
-      SharedArray<void> data, DimensionUnitsVector dimension_units)
+      SharedArray<void> data, DimensionUnitsVector dimension_units,
+      bool copy_on_write)
       : data_copy_concurrency_(std::move(data_copy_concurrency)),
         data_(std::move(data)),
-        dimension_units_(std::move(dimension_units)) {
+        dimension_units_(std::move(dimension_units)),
+        copy_on_write_(copy_on_write) {
     assert(dimension_units_.size() == data_.rank());
     assert(data_copy_concurrency_.has_resource());
   }
@@ -241,14 +244,39 @@ class ArrayDriver
       GetStorageStatisticsRequest request) override;
 
  private:
+  /// Replaces `data_` with a copy if outstanding read snapshots still
+  /// reference the current buffer, so that those snapshots continue to
+  /// observe the pre-write contents.
+  ///
+  /// Must be called with `mutex_` held exclusively, and only if
+  /// `copy_on_write_` is `true`.
+  void CopyDataForWrite() {
+    assert(copy_on_write_);
+    if (data_.element_pointer().pointer().use_count() > 1) {
+      data_ = tensorstore::MakeCopy(data_);
+    }
+  }
+
   Context::Resource<DataCopyConcurrencyResource> data_copy_concurrency_;
   SharedArray<void> data_;
   DimensionUnitsVector dimension_units_;
 
+  /// If `true`, this driver exclusively owns the buffer referenced by
+  /// `data_`: `Read` captures an immutable snapshot reference, long-running
+  /// reads do not block writes, and a write replaces `data_` with a copy
+  /// while snapshots remain outstanding.  If `false`, the buffer is shared
+  /// with the caller of `FromArray` and writes must remain visible through
+  /// the caller's array reference, so reads and writes instead synchronize
+  /// via `mutex_`.
+  bool copy_on_write_;
+
   /// Controls access to the data referred to by `data_`.
   ///
-  /// A shared lock must be held while reading from `data_`, and an exclusive
-  /// lock must be held while writing to `data_`.
+  /// If `copy_on_write_` is `false`, a shared lock must be held while
+  /// reading from `data_`, and an exclusive lock must be held while writing
+  /// to `data_`.  If `copy_on_write_` is `true`, a shared lock need only be
+  /// held while copying the `data_` reference, and an exclusive lock must be
+  /// held while writing to or replacing `data_`.
   absl::Mutex mutex_;
 };
 
@@ -269,16 +297,41 @@ void ArrayDriver::Read(ReadRequest request, ReadChunkReceiver receiver) {
   struct ChunkImpl {
     IntrusivePtr<ArrayDriver> self;
 
+    /// Immutable snapshot of `self->data_` captured when the chunk was
+    /// created.  Only valid if `self->copy_on_write_` is `true`.
+    SharedArray<const void> snapshot;
+
     absl::Status operator()(internal::LockCollection& lock_collection) {
-      lock_collection.RegisterShared(self->mutex_);
+      // When a snapshot was captured, no locks are required: subsequent
+      // writes copy the array rather than modifying it in place.
+      if (!snapshot.valid()) {
+        lock_collection.RegisterShared(self->mutex_);
+      }
       return absl::OkStatus();
     }
 
     Result<NDIterable::Ptr> operator()(ReadChunk::BeginRead,
                                        IndexTransform<> chunk_transform,
                                        Arena* arena) {
+      if (snapshot.valid()) {
+        return GetTransformedArrayNDIterable(snapshot, chunk_transform, arena);
+      }
       return GetTransformedArrayNDIterable(self->data_, chunk_transform, arena);
     }
+
+    bool operator()(ReadChunk::ReadArray,
+                    IndexTransformView<> chunk_transform,
+                    TransformedSharedArray<const void>& read_result) {
+      // Note: Without a snapshot, the backing array may be modified by
+      // subsequent writes, so an immutable zero-copy view cannot be handed
+      // out.
+      if (!snapshot.valid()) return false;
+      auto transformed_array =
+          MakeTransformedArray(snapshot, IndexTransform<>(chunk_transform));
+      if (!transformed_array.ok()) return false;
+      read_result = std::move(transformed_array).value();
+      return true;
+    }
   };
   // Cancellation does not make sense since there is only a single call to
   // `set_value` which occurs immediately after `set_starting`.
@@ -286,11 +339,16 @@ void ArrayDriver::Read(ReadRequest request, ReadChunkReceiver receiver) {
   if (request.transaction) {
     execution::set_error(receiver, TransactionError());
   } else {
+    ChunkImpl chunk_impl{IntrusivePtr<ArrayDriver>(this)};
+    if (copy_on_write_) {
+      absl::ReaderMutexLock lock(&mutex_);
+      chunk_impl.snapshot = data_;
+    }
     auto cell_transform = IdentityTransform(request.transform.input_domain());
-    execution::set_value(receiver,
-                         ReadChunk{ChunkImpl{IntrusivePtr<ArrayDriver>(this)},
-                                   std::move(request.transform)},
-                         std::move(cell_transform));
+    execution::set_value(
+        receiver,
+        ReadChunk{std::move(chunk_impl), std::move(request.transform)},
+        std::move(cell_transform));
     execution::set_done(receiver);
   }
   execution::set_stopping(receiver);
@@ -309,6 +367,8 @@ void ArrayDriver::Write(WriteRequest request, WriteChunkReceiver receiver) {
     Result<NDIterable::Ptr> operator()(WriteChunk::BeginWrite,
                                        IndexTransform<> chunk_transform,
                                        Arena* arena) {
+      // `mutex_` is held exclusively via the lock collection.
+      if (self->copy_on_write_) self->CopyDataForWrite();
       return GetTransformedArrayNDIterable(self->data_, chunk_transform, arena);
     }
 
@@ -457,7 +517,8 @@ Future<internal::Driver::Handle> ArrayDriverSpec::Open(
   return internal::Driver::Handle{
       internal::MakeReadWritePtr<ArrayDriver>(
           request.read_write_mode, data_copy_concurrency,
-          tensorstore::MakeCopy(array), std::move(dimension_units)),
+          tensorstore::MakeCopy(array), std::move(dimension_units),
+          /*copy_on_write=*/true),
       tensorstore::IdentityTransform(array.shape())};
 }
 
@@ -495,11 +556,15 @@ Result<internal::Driver::Handle> MakeArrayDriver(
     return absl::InvalidArgumentError("Array is not valid");
   }
   if (!options.context) options.context = Context::Default();
+  // The buffer remains shared with the caller's array, and writes must
+  // remain visible through the caller's reference, so copy-on-write
+  // snapshots cannot be used.
   return internal::Driver::Handle{
       internal::MakeReadWritePtr<internal_array_driver::ArrayDriver>(
           ReadWriteMode::read_write,
           options.context.GetResource<DataCopyConcurrencyResource>().value(),
-          std::move(zero_origin_array), std::move(options.dimension_units)),
+          std::move(zero_origin_array), std::move(options.dimension_units),
+          /*copy_on_write=*/false),
       std::move(transform)};
 }
 
@@ -33,6 +33,7 @@
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_testutil.h"
+#include "tensorstore/driver/read.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/dim_expression.h"
 #include "tensorstore/index_space/dimension_units.h"
@@ -43,6 +44,7 @@
 #include "tensorstore/open_mode.h"
 #include "tensorstore/open_options.h"
 #include "tensorstore/progress.h"
+#include "tensorstore/read_write_options.h"
 #include "tensorstore/serialization/test_util.h"
 #include "tensorstore/spec.h"
 #include "tensorstore/tensorstore.h"
@@ -160,6 +162,53 @@ TEST(FromArrayTest, ReadIntoNewArray) {
   EXPECT_THAT(read_progress, ::testing::ElementsAre(ReadProgress{6, 6}));
 }
 
+/// Tests that Read uses a caller-provided allocate function, such that the
+/// result can be placed directly in an externally-managed buffer.
+TEST(FromArrayTest, ReadIntoNewArrayWithAllocateFunction) {
+  auto array =
+      tensorstore::MakeOffsetArray<int>({1, 2}, {{1, 2, 3}, {4, 5, 6}});
+  auto store = tensorstore::FromArray(array);
+  auto external_buffer = std::shared_ptr<int>(new int[6],
+                                              std::default_delete<int[]>());
+  auto future = tensorstore::Read(
+      store,
+      tensorstore::ReadAllocateFunction{
+          [&](tensorstore::BoxView<> domain, tensorstore::DataType dtype,
+              tensorstore::ContiguousLayoutOrder layout_order)
+              -> tensorstore::Result<
+                  tensorstore::SharedOffsetArray<void>> {
+            return tensorstore::SharedOffsetArray<void>(
+                tensorstore::SharedElementPointer<void>(
+                    std::static_pointer_cast<void>(external_buffer), dtype),
+                tensorstore::StridedLayout<tensorstore::dynamic_rank,
+                                           tensorstore::offset_origin>(
+                    layout_order, dtype.size(), domain));
+          }});
+  TENSORSTORE_EXPECT_OK(future);
+  auto read_array = future.value();
+  EXPECT_EQ(external_buffer.get(), read_array.data());
+  EXPECT_EQ(array, read_array);
+}
+
+/// Tests that Read fails if the allocate function returns an array with the
+/// wrong domain.
+TEST(FromArrayTest, ReadIntoNewArrayAllocateFunctionMismatch) {
+  auto array =
+      tensorstore::MakeOffsetArray<int>({1, 2}, {{1, 2, 3}, {4, 5, 6}});
+  auto store = tensorstore::FromArray(array);
+  auto future = tensorstore::Read(
+      store, tensorstore::ReadAllocateFunction{
+                 [](tensorstore::BoxView<> domain, tensorstore::DataType dtype,
+                    tensorstore::ContiguousLayoutOrder layout_order)
+                     -> tensorstore::Result<
+                         tensorstore::SharedOffsetArray<void>> {
+                   return tensorstore::AllocateArray<int>({2, 3});
+                 }});
+  EXPECT_THAT(future.result(),
+              MatchesStatus(absl::StatusCode::kInvalidArgument,
+                            "Allocate function returned array .*"));
+}
+
 /// Tests calling Read with a source domain that does not match the destination
 /// domain.
 TEST(FromArrayTest, ReadDomainMismatch) {
@@ -484,6 +533,32 @@ TEST(OpenTest, RoundtripDimensionUnits) {
               ::testing::Optional(MatchesJson(json_spec)));
 }
 
+// Tests that for a store opened from a spec (which exclusively owns its
+// buffer), a read chunk captures an immutable snapshot that is unaffected by
+// subsequent writes.
+TEST(OpenTest, ReadSnapshotUnaffectedByWrite) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   tensorstore::Open<int32_t>({
+                                                         {"driver", "array"},
+                                                         {"array", {1, 2, 3}},
+                                                         {"dtype", "int32"},
+                                                     })
+                                       .result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto chunks, tensorstore::internal::CollectReadChunks(store).result());
+  ASSERT_EQ(1, chunks.size());
+  TENSORSTORE_ASSERT_OK(
+      tensorstore::Write(tensorstore::MakeArray<int32_t>({4, 5, 6}), store));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(tensorstore::MakeArray<int32_t>({4, 5, 6})));
+  // The chunk obtained before the write still observes the original contents.
+  auto target_array = tensorstore::AllocateArray<int32_t>({3});
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::CopyReadChunk(
+      chunks[0].first.impl, chunks[0].second,
+      tensorstore::TransformedArray(target_array)));
+  EXPECT_EQ(tensorstore::MakeArray<int32_t>({1, 2, 3}), target_array);
+}
+
 TEST(OpenTest, InvalidConversion) {
   EXPECT_THAT(tensorstore::Open({
                                     {"driver", "array"},
@@ -34,6 +34,7 @@
 #include "tensorstore/index_space/dimension_units.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
@@ -49,6 +50,7 @@
 #include "tensorstore/schema.h"
 #include "tensorstore/spec.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
@@ -310,6 +312,21 @@ struct ReadChunkImpl {
     return GetConvertedInputNDIterable(std::move(iterable), self->target_dtype_,
                                        self->input_conversion_);
   }
+
+  bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) {
+    if (!(self->input_conversion_.flags &
+          DataTypeConversionFlags::kCanReinterpretCast)) {
+      return false;
+    }
+    if (!base(ReadChunk::ReadArray{}, chunk_transform, read_result)) {
+      return false;
+    }
+    read_result.element_pointer() = SharedElementPointer<const void>(
+        std::move(read_result.element_pointer()).pointer(),
+        self->target_dtype_);
+    return true;
+  }
 };
 
 // Implementation of `tensorstore::internal::WriteChunk::Impl` Poly
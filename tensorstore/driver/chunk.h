@@ -44,6 +44,7 @@ namespace internal {
 
 struct ReadChunk {
   struct BeginRead {};
+  struct ReadArray {};
   using Impl = poly::Poly<
       sizeof(void*) * 2,
       /*Copyable=*/true,  //
@@ -69,7 +70,26 @@ struct ReadChunk {
       /// \returns An NDIterable with a shape of
       ///     `chunk_transform.input_shape()`.
       Result<NDIterable::Ptr>(BeginRead, IndexTransform<> chunk_transform,
-                              Arena* arena)>;
+                              Arena* arena),
+
+      /// Returns a zero-copy immutable view of the chunk data, if supported.
+      ///
+      /// On success, `read_result` shares ownership of the underlying chunk
+      /// data (e.g. the decoded chunk stored in a cache entry); the data
+      /// remains valid and immutable for as long as `read_result` holds a
+      /// reference, even after any locks registered by the `LockCollection`
+      /// overload above are released and the chunk itself is destroyed.
+      ///
+      /// \param chunk_transform Transform with a range that is a subset of
+      ///     `transform`.
+      /// \param read_result[out] Set on success to an immutable transformed
+      ///     array with a domain of `chunk_transform.domain()`.
+      /// \returns `true` if a zero-copy view is available and `read_result`
+      ///     has been set, `false` if the data must instead be accessed via
+      ///     the `BeginRead` code path (e.g. because a data type conversion
+      ///     or uncommitted transactional modifications apply).
+      bool(ReadArray, IndexTransformView<> chunk_transform,
+           TransformedSharedArray<const void>& read_result)>;
 
   /// Type-erased chunk implementation.  In the case of the chunks produced by
   /// `ChunkCache::Read`, for example, the contained object holds a
@@ -15,7 +15,15 @@
 #ifndef TENSORSTORE_INTERNAL_CHUNK_RECEIVER_UTILS_H_
 #define TENSORSTORE_INTERNAL_CHUNK_RECEIVER_UTILS_H_
 
+#include <stddef.h>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/driver/chunk.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -64,6 +72,72 @@ struct ForwardingChunkOperationReceiver {
   }
 };
 
+/// Coalesces per-chunk executor dispatches.
+///
+/// Chunks are frequently delivered to a flow receiver in synchronous bursts
+/// (one `set_value` call per cell of a chunk grid).  Dispatching each chunk
+/// operation to the executor individually makes scheduling a significant
+/// fraction of the cost when chunks are small; instead, operations added
+/// while drain tasks are pending are processed by those tasks, so a burst of
+/// up to `kMaxOpsPerDrain` operations costs a single dispatch.
+///
+/// Each drain task processes at most `kMaxOpsPerDrain` operations, and `Add`
+/// requests an additional task whenever the queued operations exceed what the
+/// pending tasks will process, so a large burst fans out across concurrently
+/// running tasks rather than being serialized into one.
+///
+/// \tparam Op Nullary function object that performs the per-chunk work.
+template <typename Op>
+class ChunkOpBatchQueue {
+ public:
+  /// Maximum number of operations processed by a single `Drain` call.  Small
+  /// enough that a burst of expensive operations (e.g. large chunk copies)
+  /// regains pool-width parallelism, while still amortizing dispatch overhead
+  /// for bursts of cheap ones.
+  constexpr static size_t kMaxOpsPerDrain = 16;
+
+  /// Adds `op` to the queue.
+  ///
+  /// Returns `true` if the caller must schedule a task that invokes `Drain`;
+  /// returns `false` if the already-pending drain tasks will process `op`.
+  bool Add(Op op) {
+    absl::MutexLock lock(&mutex_);
+    queue_.push_back(std::move(op));
+    // Maintains `pending_drains_ >= ceil(queue_.size() / kMaxOpsPerDrain)`,
+    // so that every queued operation is covered by a pending drain task.
+    const size_t required_drains =
+        (queue_.size() + kMaxOpsPerDrain - 1) / kMaxOpsPerDrain;
+    if (pending_drains_ >= required_drains) return false;
+    ++pending_drains_;
+    return true;
+  }
+
+  /// Runs up to `kMaxOpsPerDrain` queued operations.
+  void Drain() {
+    std::vector<Op> batch;
+    {
+      absl::MutexLock lock(&mutex_);
+      if (queue_.size() <= kMaxOpsPerDrain) {
+        batch.swap(queue_);
+      } else {
+        const auto batch_end = queue_.begin() + kMaxOpsPerDrain;
+        batch.assign(std::make_move_iterator(queue_.begin()),
+                     std::make_move_iterator(batch_end));
+        queue_.erase(queue_.begin(), batch_end);
+      }
+      if (pending_drains_ > 0) --pending_drains_;
+    }
+    for (auto& op : batch) {
+      std::move(op)();
+    }
+  }
+
+ private:
+  absl::Mutex mutex_;
+  std::vector<Op> queue_ ABSL_GUARDED_BY(mutex_);
+  size_t pending_drains_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
 }  // namespace internal
 }  // namespace tensorstore
 
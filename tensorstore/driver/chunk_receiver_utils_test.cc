@@ -0,0 +1,125 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/chunk_receiver_utils.h"
+
+#include <stddef.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/notification.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+
+namespace {
+
+using ::tensorstore::internal::ChunkOpBatchQueue;
+
+struct RecordOp {
+  std::vector<int>* log;
+  int value;
+  void operator()() { log->push_back(value); }
+};
+
+TEST(ChunkOpBatchQueueTest, SingleDrainProcessesBurst) {
+  ChunkOpBatchQueue<RecordOp> queue;
+  std::vector<int> log;
+
+  // Only the first `Add` of a burst requires scheduling a drain task.
+  EXPECT_TRUE(queue.Add(RecordOp{&log, 1}));
+  EXPECT_FALSE(queue.Add(RecordOp{&log, 2}));
+  EXPECT_FALSE(queue.Add(RecordOp{&log, 3}));
+  EXPECT_THAT(log, ::testing::ElementsAre());
+
+  queue.Drain();
+  EXPECT_THAT(log, ::testing::ElementsAre(1, 2, 3));
+
+  // A burst after draining requires a new drain task.
+  EXPECT_TRUE(queue.Add(RecordOp{&log, 4}));
+  queue.Drain();
+  EXPECT_THAT(log, ::testing::ElementsAre(1, 2, 3, 4));
+}
+
+TEST(ChunkOpBatchQueueTest, BoundedDrain) {
+  constexpr size_t kBound = ChunkOpBatchQueue<RecordOp>::kMaxOpsPerDrain;
+  ChunkOpBatchQueue<RecordOp> queue;
+  std::vector<int> log;
+
+  // A burst larger than the per-drain bound requires additional drain tasks.
+  size_t num_drains = 0;
+  for (size_t i = 0; i < 2 * kBound + 1; ++i) {
+    if (queue.Add(RecordOp{&log, static_cast<int>(i)})) ++num_drains;
+  }
+  EXPECT_EQ(3, num_drains);
+
+  // Each drain processes at most `kMaxOpsPerDrain` operations.
+  queue.Drain();
+  EXPECT_EQ(kBound, log.size());
+  queue.Drain();
+  EXPECT_EQ(2 * kBound, log.size());
+  queue.Drain();
+  EXPECT_EQ(2 * kBound + 1, log.size());
+  for (size_t i = 0; i < log.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i), log[i]);
+  }
+}
+
+// Tests that a burst larger than the per-drain bound is processed by
+// concurrently-running drain tasks: the first operation blocks until an
+// operation from the second batch runs, which would deadlock if the burst
+// were serialized into a single task.
+TEST(ChunkOpBatchQueueTest, LargeBurstRunsConcurrently) {
+  using Op = std::function<void()>;
+  constexpr size_t kBound = ChunkOpBatchQueue<Op>::kMaxOpsPerDrain;
+  auto executor = tensorstore::internal::DetachedThreadPool(2);
+  ChunkOpBatchQueue<Op> queue;
+  absl::Notification second_batch_started;
+  absl::BlockingCounter done(static_cast<int>(2 * kBound));
+  for (size_t i = 0; i < 2 * kBound; ++i) {
+    Op op;
+    if (i == 0) {
+      op = [&] {
+        second_batch_started.WaitForNotification();
+        done.DecrementCount();
+      };
+    } else if (i == kBound) {
+      op = [&] {
+        second_batch_started.Notify();
+        done.DecrementCount();
+      };
+    } else {
+      op = [&] { done.DecrementCount(); };
+    }
+    if (queue.Add(std::move(op))) {
+      executor([&queue] { queue.Drain(); });
+    }
+  }
+  done.Wait();
+}
+
+TEST(ChunkOpBatchQueueTest, EmptyDrain) {
+  ChunkOpBatchQueue<RecordOp> queue;
+  queue.Drain();
+
+  std::vector<int> log;
+  EXPECT_TRUE(queue.Add(RecordOp{&log, 1}));
+  queue.Drain();
+  EXPECT_THAT(log, ::testing::ElementsAre(1));
+}
+
+}  // namespace
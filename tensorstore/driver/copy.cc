@@ -14,15 +14,21 @@
 
 #include "tensorstore/driver/copy.h"
 
+#include <stddef.h>
+
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/data_type_conversion.h"
 #include "tensorstore/driver/chunk.h"
+#include "tensorstore/driver/chunk_receiver_utils.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/index.h"
@@ -76,7 +82,10 @@ namespace {
 ///
 /// 5. For each `WriteChunk` received, `CopyWriteChunkReceiver` invokes
 ///    `CopyChunkOp` using executor to copy the data from the appropriate
-///    portion of the `ReadChunk` to the `WriteChunk`.
+///    portion of the `ReadChunk` to the `WriteChunk`.  If a `CopyChunkBudget`
+///    is specified, `CopyChunkOp` invocations that would exceed the in-flight
+///    budget are instead deferred until previously dispatched invocations
+///    complete.
 ///
 /// 6. `CopyChunkOp` links the writeback `Future` returned from the write
 ///    operation on `WriteChunk` to `copy_promise` with a `CommitCallback` that
@@ -95,6 +104,25 @@ namespace {
 /// 8. Once `CopyState` is destroyed and all `CommitCallback` links are
 ///    completed, the `commit_promise` is marked ready, indicating to the caller
 ///    that all data has been written back (or an error has occurred).
+struct CopyState;
+struct CopyInitiateWriteOp;
+
+/// Callback invoked by `CopyWriteChunkReceiver` (using the executor) to copy
+/// data from the relevant portion of a single `ReadChunk` to a `WriteChunk`.
+struct CopyChunkOp {
+  IntrusivePtr<CopyState> state;
+  ReadChunk adjusted_read_chunk;
+  WriteChunk write_chunk;
+
+  /// Number of bytes of the in-flight chunk budget charged to this operation.
+  size_t budget_bytes;
+
+  void operator()();
+
+ private:
+  void CopyChunk();
+};
+
 struct CopyState : public internal::AtomicReferenceCount<CopyState> {
   /// CommitState is a separate reference-counted struct (rather than simply
   /// using `CopyState`) in order to ensure the reference to `copy_promise` and
@@ -103,12 +131,17 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
   /// referenced, to be freed).
   struct CommitState : public internal::AtomicReferenceCount<CommitState> {
     CopyProgressFunction progress_function;
+    std::shared_ptr<AtomicCopyProgress> progress_counters;
     Index total_elements;
     std::atomic<Index> copied_elements{0};
     std::atomic<Index> committed_elements{0};
     std::atomic<Index> read_elements{0};
 
     void UpdateReadProgress(Index num_elements) {
+      if (progress_counters) {
+        progress_counters->read_elements.fetch_add(num_elements,
+                                                   std::memory_order_relaxed);
+      }
       if (!progress_function.value) return;
       progress_function.value(
           CopyProgress{total_elements, read_elements += num_elements,
@@ -116,6 +149,10 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
     }
 
     void UpdateCopyProgress(Index num_elements) {
+      if (progress_counters) {
+        progress_counters->copied_elements.fetch_add(num_elements,
+                                                     std::memory_order_relaxed);
+      }
       if (!progress_function.value) return;
       progress_function.value(CopyProgress{total_elements, read_elements,
                                            copied_elements += num_elements,
@@ -123,6 +160,10 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
     }
 
     void UpdateCommitProgress(Index num_elements) {
+      if (progress_counters) {
+        progress_counters->committed_elements.fetch_add(
+            num_elements, std::memory_order_relaxed);
+      }
       if (!progress_function.value) return;
       progress_function.value(CopyProgress{total_elements, read_elements,
                                            copied_elements,
@@ -141,84 +182,162 @@ struct CopyState : public internal::AtomicReferenceCount<CopyState> {
   Promise<void> copy_promise;
   Promise<void> commit_promise;
   IntrusivePtr<CommitState> commit_state{new CommitState};
+  ChunkOpBatchQueue<CopyInitiateWriteOp> chunk_batch;
   internal_tracing::TraceSpan tspan{"tensorstore.Copy"};
 
   void SetError(absl::Status error) {
     SetDeferredResult(copy_promise, std::move(error));
   }
+
+  /// Dispatches `op` to `executor` if permitted by `chunk_budget`, and
+  /// otherwise defers it until previously dispatched operations complete.
+  void StartChunkOp(CopyChunkOp op);
+
+  /// Releases the budget charged to a completed operation, dispatching any
+  /// deferred operations the released budget permits.
+  void FinishChunkOp(size_t budget_bytes);
+
+  /// Returns `true` if an operation charging `budget_bytes` may be
+  /// dispatched.
+  ///
+  /// To ensure progress, an operation is always permitted when no other
+  /// operation is in flight.
+  ///
+  /// Must be called with `budget_mutex` held.
+  bool BudgetPermits(size_t budget_bytes) const {
+    if (in_flight_chunks == 0) return true;
+    if (chunk_budget.max_chunks != 0 &&
+        in_flight_chunks >= chunk_budget.max_chunks) {
+      return false;
+    }
+    if (chunk_budget.max_bytes != 0 &&
+        in_flight_bytes + budget_bytes > chunk_budget.max_bytes) {
+      return false;
+    }
+    return true;
+  }
+
+  /// Limit on in-flight chunk copy operations; no limit if both fields are 0.
+  CopyChunkBudget chunk_budget;
+
+  /// Protects the in-flight accounting and `deferred_ops`.
+  absl::Mutex budget_mutex;
+  size_t in_flight_chunks = 0;
+  size_t in_flight_bytes = 0;
+
+  /// Chunk copy operations deferred until permitted by `chunk_budget`.
+  std::deque<CopyChunkOp> deferred_ops;
 };
 
-/// Callback invoked by `CopyWriteChunkReceiver` (using the executor) to copy
-/// data from the relevant portion of a single `ReadChunk` to a `WriteChunk`.
-struct CopyChunkOp {
-  IntrusivePtr<CopyState> state;
-  ReadChunk adjusted_read_chunk;
-  WriteChunk write_chunk;
-  void operator()() {
-    DefaultNDIterableArena arena;
-
-    LockCollection lock_collection;
-
-    absl::Status copy_status;
-    Future<const void> commit_future;
-    {
-      TENSORSTORE_ASSIGN_OR_RETURN(
-          auto guard,
-          LockChunks(lock_collection, adjusted_read_chunk.impl,
-                     write_chunk.impl),
-          state->SetError(_));
-
-      TENSORSTORE_ASSIGN_OR_RETURN(
-          auto source_iterable,
-          adjusted_read_chunk.impl(ReadChunk::BeginRead{},
-                                   std::move(adjusted_read_chunk.transform),
-                                   arena),
-          state->SetError(_));
-
-      TENSORSTORE_ASSIGN_OR_RETURN(
-          auto target_iterable,
-          write_chunk.impl(WriteChunk::BeginWrite{}, write_chunk.transform,
-                           arena),
-          state->SetError(_));
-
-      source_iterable = GetConvertedInputNDIterable(
-          std::move(source_iterable), target_iterable->dtype(),
-          state->data_type_conversion);
-
-      copy_status = NDIterableCopier(*source_iterable, *target_iterable,
-                                     write_chunk.transform.input_shape(), arena)
-                        .Copy();
-
-      auto end_write_result =
-          write_chunk.impl(WriteChunk::EndWrite{}, write_chunk.transform,
-                           copy_status.ok(), arena);
-      commit_future = std::move(end_write_result.commit_future);
-      if (copy_status.ok()) {
-        copy_status = std::move(end_write_result.copy_status);
-      }
+void CopyState::StartChunkOp(CopyChunkOp op) {
+  if (chunk_budget.max_chunks == 0 && chunk_budget.max_bytes == 0) {
+    // No budget configured.
+    executor(std::move(op));
+    return;
+  }
+  {
+    absl::MutexLock lock(&budget_mutex);
+    if (!BudgetPermits(op.budget_bytes)) {
+      deferred_ops.push_back(std::move(op));
+      return;
+    }
+    ++in_flight_chunks;
+    in_flight_bytes += op.budget_bytes;
+  }
+  executor(std::move(op));
+}
+
+void CopyState::FinishChunkOp(size_t budget_bytes) {
+  if (chunk_budget.max_chunks == 0 && chunk_budget.max_bytes == 0) return;
+  std::vector<CopyChunkOp> ready_ops;
+  {
+    absl::MutexLock lock(&budget_mutex);
+    --in_flight_chunks;
+    in_flight_bytes -= budget_bytes;
+    while (!deferred_ops.empty() &&
+           BudgetPermits(deferred_ops.front().budget_bytes)) {
+      ++in_flight_chunks;
+      in_flight_bytes += deferred_ops.front().budget_bytes;
+      ready_ops.push_back(std::move(deferred_ops.front()));
+      deferred_ops.pop_front();
     }
+  }
+  for (auto& op : ready_ops) {
+    executor(std::move(op));
+  }
+}
+
+void CopyChunkOp::operator()() {
+  CopyChunk();
+  // Release the budget charged to this operation, possibly dispatching
+  // deferred operations.
+  state->FinishChunkOp(budget_bytes);
+}
+
+void CopyChunkOp::CopyChunk() {
+  DefaultNDIterableArena arena;
+
+  LockCollection lock_collection;
+
+  absl::Status copy_status;
+  Future<const void> commit_future;
+  {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto guard,
+        LockChunks(lock_collection, adjusted_read_chunk.impl,
+                   write_chunk.impl),
+        state->SetError(_));
+
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto source_iterable,
+        adjusted_read_chunk.impl(ReadChunk::BeginRead{},
+                                 std::move(adjusted_read_chunk.transform),
+                                 arena),
+        state->SetError(_));
+
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto target_iterable,
+        write_chunk.impl(WriteChunk::BeginWrite{}, write_chunk.transform,
+                         arena),
+        state->SetError(_));
+
+    source_iterable = GetConvertedInputNDIterable(
+        std::move(source_iterable), target_iterable->dtype(),
+        state->data_type_conversion);
+
+    copy_status = NDIterableCopier(*source_iterable, *target_iterable,
+                                   write_chunk.transform.input_shape(), arena)
+                      .Copy();
+
+    auto end_write_result =
+        write_chunk.impl(WriteChunk::EndWrite{}, write_chunk.transform,
+                         copy_status.ok(), arena);
+    commit_future = std::move(end_write_result.commit_future);
     if (copy_status.ok()) {
-      const Index num_elements = write_chunk.transform.domain().num_elements();
-      state->commit_state->UpdateCopyProgress(num_elements);
-      struct CommitCallback {
-        IntrusivePtr<CopyState::CommitState> state;
-        Index num_elements;
-        void operator()(Promise<void>, Future<const void>) const {
-          state->UpdateCommitProgress(num_elements);
-        }
-      };
-      if (!state->commit_promise.null() && !commit_future.null()) {
-        // For transactional writes, `state->commit_promise` is null.
-        LinkValue(CommitCallback{state->commit_state, num_elements},
-                  state->commit_promise, commit_future);
-      } else {
-        state->commit_state->UpdateCommitProgress(num_elements);
+      copy_status = std::move(end_write_result.copy_status);
+    }
+  }
+  if (copy_status.ok()) {
+    const Index num_elements = write_chunk.transform.domain().num_elements();
+    state->commit_state->UpdateCopyProgress(num_elements);
+    struct CommitCallback {
+      IntrusivePtr<CopyState::CommitState> state;
+      Index num_elements;
+      void operator()(Promise<void>, Future<const void>) const {
+        state->UpdateCommitProgress(num_elements);
       }
+    };
+    if (!state->commit_promise.null() && !commit_future.null()) {
+      // For transactional writes, `state->commit_promise` is null.
+      LinkValue(CommitCallback{state->commit_state, num_elements},
+                state->commit_promise, commit_future);
     } else {
-      state->SetError(std::move(copy_status));
+      state->commit_state->UpdateCommitProgress(num_elements);
     }
+  } else {
+    state->SetError(std::move(copy_status));
   }
-};
+}
 
 /// FlowReceiver used by `CopyReadChunkReceiver` to copy data from a given
 /// `read_chunk` to the target `write_chunk` chunks as the target chunks become
@@ -247,11 +366,15 @@ struct CopyWriteChunkReceiver {
         state->SetError(_));
     ReadChunk adjusted_read_chunk{read_chunk.impl,
                                   std::move(read_chunk_transform)};
-    // Defer the actual copying to the executor.
+    const size_t budget_bytes =
+        static_cast<size_t>(write_chunk.transform.domain().num_elements()) *
+        state->target_driver->dtype().size();
+    // Defer the actual copying to the executor, subject to the in-flight
+    // chunk budget.
     //
     // Don't move `state` since `set_value` may be called multiple times.
-    state->executor(CopyChunkOp{state, std::move(adjusted_read_chunk),
-                                std::move(write_chunk)});
+    state->StartChunkOp(CopyChunkOp{state, std::move(adjusted_read_chunk),
+                                    std::move(write_chunk), budget_bytes});
   }
 };
 
@@ -296,11 +419,15 @@ struct CopyReadChunkReceiver {
   void set_done() {}
   void set_error(absl::Status error) { state->SetError(std::move(error)); }
   void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {
-    // Defer actual work to executor.
+    // Defer actual work to executor.  Dispatches are batched so that a burst
+    // of synchronously-delivered chunks costs one executor dispatch per
+    // `kMaxOpsPerDrain` chunks while still proceeding concurrently.
     //
     // Don't move `state` since `set_value` may be called multiple times.
-    state->executor(CopyInitiateWriteOp{state, std::move(chunk),
-                                        std::move(cell_transform)});
+    if (state->chunk_batch.Add(CopyInitiateWriteOp{
+            state, std::move(chunk), std::move(cell_transform)})) {
+      state->executor([state = state] { state->chunk_batch.Drain(); });
+    }
   }
 };
 
@@ -324,6 +451,10 @@ struct DriverCopyInitiateOp {
         static_cast<void>(promise.SetResult(_)));
     state->commit_state->total_elements =
         target_transform.input_domain().num_elements();
+    if (state->commit_state->progress_counters) {
+      state->commit_state->progress_counters->total_elements.fetch_add(
+          state->commit_state->total_elements, std::memory_order_relaxed);
+    }
     state->copy_promise = std::move(promise);
     state->target_transform = std::move(target_transform);
 
@@ -363,7 +494,10 @@ WriteFutures DriverCopy(Executor executor, DriverHandle source,
       state->target_transaction,
       internal::AcquireOpenTransactionPtrOrError(target.transaction));
   state->alignment_options = options.alignment_options;
+  state->chunk_budget = options.chunk_budget;
   state->commit_state->progress_function = std::move(options.progress_function);
+  state->commit_state->progress_counters =
+      std::move(options.progress_counters.value);
   auto copy_pair = PromiseFuturePair<void>::Make(MakeResult());
   PromiseFuturePair<void> commit_pair;
   if (!state->target_transaction) {
@@ -407,4 +407,87 @@ TEST(DownsampleArrayTest, MultipleBlocks) {
               Optional(tensorstore::MatchesArray(expected_downsampled)));
 }
 
+// The vectorized mean-accumulation kernels used for 2x/4x factors on uint8,
+// uint16, and float32 must match the generic path exactly, including
+// round-half-to-even behavior and scalar handling of the vector tail.  The
+// extent of 37 output elements exercises both the full-vector body and the
+// scalar tail.
+
+template <typename Element>
+Element RoundedMean(uint64_t total, Index factor) {
+  uint64_t quotient = total / factor;
+  uint64_t remainder = total % factor;
+  return static_cast<Element>(
+      quotient +
+      (remainder * 2 + (quotient & 1) > static_cast<uint64_t>(factor)));
+}
+
+TEST(DownsampleArrayTest, MeanVectorizedUint8) {
+  for (const Index factor : {2, 4}) {
+    auto source = tensorstore::AllocateArray<uint8_t>({5, 37 * factor});
+    auto expected = tensorstore::AllocateArray<uint8_t>({5, 37});
+    for (Index i = 0; i < 5; ++i) {
+      for (Index j = 0; j < 37; ++j) {
+        uint64_t total = 0;
+        for (Index k = 0; k < factor; ++k) {
+          const auto value =
+              static_cast<uint8_t>(i * 71 + (j * factor + k) * 31);
+          source(i, j * factor + k) = value;
+          total += value;
+        }
+        expected(i, j) = RoundedMean<uint8_t>(total, factor);
+      }
+    }
+    EXPECT_THAT(DownsampleArray(source, {{1, factor}}, DownsampleMethod::kMean),
+                Optional(tensorstore::MatchesArray(expected)))
+        << "factor=" << factor;
+  }
+}
+
+TEST(DownsampleArrayTest, MeanVectorizedUint16) {
+  for (const Index factor : {2, 4}) {
+    auto source = tensorstore::AllocateArray<uint16_t>({5, 37 * factor});
+    auto expected = tensorstore::AllocateArray<uint16_t>({5, 37});
+    for (Index i = 0; i < 5; ++i) {
+      for (Index j = 0; j < 37; ++j) {
+        uint64_t total = 0;
+        for (Index k = 0; k < factor; ++k) {
+          const auto value =
+              static_cast<uint16_t>(i * 4099 + (j * factor + k) * 257);
+          source(i, j * factor + k) = value;
+          total += value;
+        }
+        expected(i, j) = RoundedMean<uint16_t>(total, factor);
+      }
+    }
+    EXPECT_THAT(DownsampleArray(source, {{1, factor}}, DownsampleMethod::kMean),
+                Optional(tensorstore::MatchesArray(expected)))
+        << "factor=" << factor;
+  }
+}
+
+TEST(DownsampleArrayTest, MeanVectorizedFloat) {
+  for (const Index factor : {2, 4}) {
+    auto source = tensorstore::AllocateArray<float>({5, 37 * factor});
+    auto expected = tensorstore::AllocateArray<float>({5, 37});
+    for (Index i = 0; i < 5; ++i) {
+      for (Index j = 0; j < 37; ++j) {
+        float total = 0;
+        for (Index k = 0; k < factor; ++k) {
+          // Integer values so that sums and means are exact regardless of
+          // accumulation order.
+          const auto value =
+              static_cast<float>((i * 13 + (j * factor + k) * 7) % 64);
+          source(i, j * factor + k) = value;
+          total += value;
+        }
+        expected(i, j) = total / static_cast<float>(factor);
+      }
+    }
+    EXPECT_THAT(DownsampleArray(source, {{1, factor}}, DownsampleMethod::kMean),
+                Optional(tensorstore::MatchesArray(expected)))
+        << "factor=" << factor;
+  }
+}
+
 }  // namespace
@@ -47,6 +47,14 @@
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/str_cat.h"
 
+// Runtime-dispatched AVX2 mean-accumulation kernels are only generated with
+// GCC/Clang on x86, which support per-function target attributes and
+// `__builtin_cpu_supports`.
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define TENSORSTORE_INTERNAL_DOWNSAMPLE_AVX2 1
+#endif
+
 // Uncomment the line below for debug logging.
 // #define TENSORSTORE_INTERNAL_DOWNSAMPLE_DEBUG 1
 
@@ -487,6 +495,192 @@ template <>
 struct ReductionTraits<DownsampleMethod::kMode, bool>
     : public ReductionTraits<DownsampleMethod::kMean, bool> {};
 
+/// Indicates that a vectorized kernel is available for accumulating groups of
+/// 2 or 4 consecutive input elements along the inner iteration dimension.
+///
+/// Only `DownsampleMethod::kMean` benefits: it is the method used for image
+/// pyramids and its accumulation ignores the per-element bookkeeping
+/// (`element_offset`/`max_total_elements`) that the storing methods require.
+template <DownsampleMethod Method, typename Element>
+constexpr bool kHasVectorizedAccumulate = false;
+
+#ifdef TENSORSTORE_INTERNAL_DOWNSAMPLE_AVX2
+
+template <>
+inline constexpr bool kHasVectorizedAccumulate<DownsampleMethod::kMean,
+                                               uint8_t> = true;
+template <>
+inline constexpr bool kHasVectorizedAccumulate<DownsampleMethod::kMean,
+                                               uint16_t> = true;
+template <>
+inline constexpr bool kHasVectorizedAccumulate<DownsampleMethod::kMean, float> =
+    true;
+
+bool HaveAvx2() {
+  static const bool have = __builtin_cpu_supports("avx2");
+  return have;
+}
+
+/// The `AccumulateGroupsAvx2` kernels below add the sum of each group of
+/// `factor` (2 or 4) consecutive source elements to the corresponding
+/// accumulator element.  `count` is the number of accumulator elements; the
+/// source row holds `count * factor` elements.  The integer kernels compute
+/// horizontal pairwise sums at successively wider element types (no overflow:
+/// two `uint8_t` fit in `uint16_t`, etc.) before widening to the `uint64_t`
+/// accumulators.
+
+/// Adds 4 uint16 values (the low 4 elements of `sums4`) to 4 uint64
+/// accumulators.
+__attribute__((target("avx2"))) inline void AddUint16x4ToAcc(uint64_t* acc,
+                                                             __m128i sums4) {
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(acc),
+      _mm256_add_epi64(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc)),
+          _mm256_cvtepu16_epi64(sums4)));
+}
+
+__attribute__((target("avx2"))) void AccumulateGroupsAvx2(uint64_t* acc,
+                                                          const uint8_t* from,
+                                                          Index count,
+                                                          Index factor) {
+  Index i = 0;
+  if (factor == 2) {
+    const __m256i ones8 = _mm256_set1_epi8(1);
+    for (; i + 16 <= count; i += 16) {
+      __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 2 * i));
+      // 16 pairwise sums as uint16 (max 510).
+      __m256i sums16 = _mm256_maddubs_epi16(v, ones8);
+      __m128i lo = _mm256_castsi256_si128(sums16);
+      __m128i hi = _mm256_extracti128_si256(sums16, 1);
+      AddUint16x4ToAcc(acc + i, lo);
+      AddUint16x4ToAcc(acc + i + 4, _mm_srli_si128(lo, 8));
+      AddUint16x4ToAcc(acc + i + 8, hi);
+      AddUint16x4ToAcc(acc + i + 12, _mm_srli_si128(hi, 8));
+    }
+  } else {
+    const __m256i ones8 = _mm256_set1_epi8(1);
+    const __m256i ones16 = _mm256_set1_epi16(1);
+    for (; i + 8 <= count; i += 8) {
+      __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 4 * i));
+      // 8 sums of 4 consecutive uint8 as uint32.
+      __m256i sums32 =
+          _mm256_madd_epi16(_mm256_maddubs_epi16(v, ones8), ones16);
+      __m128i lo = _mm256_castsi256_si128(sums32);
+      __m128i hi = _mm256_extracti128_si256(sums32, 1);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(acc + i),
+          _mm256_add_epi64(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i)),
+              _mm256_cvtepu32_epi64(lo)));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(acc + i + 4),
+          _mm256_add_epi64(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i + 4)),
+              _mm256_cvtepu32_epi64(hi)));
+    }
+  }
+  for (; i < count; ++i) {
+    uint64_t total = 0;
+    for (Index j = 0; j < factor; ++j) total += from[factor * i + j];
+    acc[i] += total;
+  }
+}
+
+__attribute__((target("avx2"))) void AccumulateGroupsAvx2(uint64_t* acc,
+                                                          const uint16_t* from,
+                                                          Index count,
+                                                          Index factor) {
+  Index i = 0;
+  const __m256i mask32 = _mm256_set1_epi32(0xffff);
+  if (factor == 2) {
+    for (; i + 8 <= count; i += 8) {
+      __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 2 * i));
+      // 8 pairwise sums as uint32.
+      __m256i sums32 = _mm256_add_epi32(_mm256_and_si256(v, mask32),
+                                        _mm256_srli_epi32(v, 16));
+      __m128i lo = _mm256_castsi256_si128(sums32);
+      __m128i hi = _mm256_extracti128_si256(sums32, 1);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(acc + i),
+          _mm256_add_epi64(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i)),
+              _mm256_cvtepu32_epi64(lo)));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(acc + i + 4),
+          _mm256_add_epi64(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i + 4)),
+              _mm256_cvtepu32_epi64(hi)));
+    }
+  } else {
+    const __m256i mask64 = _mm256_set1_epi64x(0xffffffff);
+    for (; i + 4 <= count; i += 4) {
+      __m256i v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 4 * i));
+      __m256i sums32 = _mm256_add_epi32(_mm256_and_si256(v, mask32),
+                                        _mm256_srli_epi32(v, 16));
+      // 4 sums of 4 consecutive uint16 as uint64.
+      __m256i sums64 = _mm256_add_epi64(_mm256_and_si256(sums32, mask64),
+                                        _mm256_srli_epi64(sums32, 32));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(acc + i),
+          _mm256_add_epi64(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i)),
+              sums64));
+    }
+  }
+  for (; i < count; ++i) {
+    uint64_t total = 0;
+    for (Index j = 0; j < factor; ++j) total += from[factor * i + j];
+    acc[i] += total;
+  }
+}
+
+/// Computes the 8 pairwise sums of the 16 consecutive floats in `a` (first 8)
+/// and `b` (last 8), in order.
+__attribute__((target("avx2"))) inline __m256 PairwiseAddPs(__m256 a,
+                                                            __m256 b) {
+  __m256 even = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  __m256 odd = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+  // `shuffle_ps` operates per 128-bit lane, leaving the 64-bit chunks of the
+  // sum in the order [0, 2, 1, 3]; permute them back into order.
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(
+      _mm256_castps_pd(_mm256_add_ps(even, odd)), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+__attribute__((target("avx2"))) void AccumulateGroupsAvx2(float* acc,
+                                                          const float* from,
+                                                          Index count,
+                                                          Index factor) {
+  Index i = 0;
+  if (factor == 2) {
+    for (; i + 8 <= count; i += 8) {
+      __m256 sums = PairwiseAddPs(_mm256_loadu_ps(from + 2 * i),
+                                  _mm256_loadu_ps(from + 2 * i + 8));
+      _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i), sums));
+    }
+  } else {
+    for (; i + 8 <= count; i += 8) {
+      __m256 sums_lo = PairwiseAddPs(_mm256_loadu_ps(from + 4 * i),
+                                     _mm256_loadu_ps(from + 4 * i + 8));
+      __m256 sums_hi = PairwiseAddPs(_mm256_loadu_ps(from + 4 * i + 16),
+                                     _mm256_loadu_ps(from + 4 * i + 24));
+      __m256 sums = PairwiseAddPs(sums_lo, sums_hi);
+      _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i), sums));
+    }
+  }
+  for (; i < count; ++i) {
+    float total = 0;
+    for (Index j = 0; j < factor; ++j) total += from[factor * i + j];
+    acc[i] += total;
+  }
+}
+
+#endif  // TENSORSTORE_INTERNAL_DOWNSAMPLE_AVX2
+
 /// Template class that generates the type-specific and method-specific
 /// implementation for performing the downsample computation.
 ///
@@ -567,6 +761,34 @@ struct DownsampleImpl {
         }
       };
 
+#ifdef TENSORSTORE_INTERNAL_DOWNSAMPLE_AVX2
+      if constexpr (kHasVectorizedAccumulate<Method, Element>) {
+        // Vectorized fast path for accumulating full groups of 2 or 4
+        // consecutive elements along a contiguous inner dimension.  Partial
+        // groups (at the block boundary) use the generic path below.  The
+        // callback's element bookkeeping may be ignored because the mean
+        // reduction does not use it.
+        if (ArrayAccessor::buffer_kind == IterationBufferKind::kContiguous &&
+            (downsample_factor[1] == 2 || downsample_factor[1] == 4) &&
+            base_block_offset[1] == 0 &&
+            base_block_shape[1] ==
+                output_block_shape[1] * downsample_factor[1] &&
+            HaveAvx2()) {
+          for_each_source_index(
+              std::integral_constant<Index, 0>{},
+              [&](Index output_outer_i, Index source_outer_i, Index element_i,
+                  Index num_source_elements) {
+                AccumulateGroupsAvx2(
+                    acc + output_outer_i * output_block_shape[1],
+                    ArrayAccessor::template GetPointerAtPosition<Element>(
+                        source_pointer, source_outer_i, 0),
+                    output_block_shape[1], downsample_factor[1]);
+              });
+          return true;
+        }
+      }
+#endif  // TENSORSTORE_INTERNAL_DOWNSAMPLE_AVX2
+
       const auto process_input_row = [&](Index output_outer_i,
                                          Index source_outer_i,
                                          Index num_outer_elements,
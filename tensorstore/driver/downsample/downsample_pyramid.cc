@@ -0,0 +1,75 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/downsample/downsample_pyramid.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/downsample/downsample_array.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+
+Future<void> WriteDownsampledPyramid(SharedOffsetArray<const void> source,
+                                     TensorStore<> base,
+                                     span<const PyramidLevel> levels,
+                                     DownsampleMethod method) {
+  std::vector<AnyFuture> commit_futures;
+  commit_futures.reserve(levels.size() + 1);
+
+  // Restricts `store` to the domain of `data` and issues an asynchronous
+  // write; only the commit future is retained since copying from an
+  // in-memory array completes by commit time.
+  const auto issue_write = [&](const SharedOffsetArray<const void>& data,
+                               const TensorStore<>& store) -> absl::Status {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto target,
+        store | AllDims().SizedInterval(data.origin(), data.shape()));
+    commit_futures.push_back(
+        tensorstore::Write(data, std::move(target)).commit_future);
+    return absl::OkStatus();
+  };
+
+  TENSORSTORE_RETURN_IF_ERROR(issue_write(source, base));
+
+  // Each level is computed from the previous level's in-memory data, so the
+  // full-resolution data is never re-read from the base and the total
+  // downsampling work is a geometric series in the base size.
+  SharedOffsetArray<const void> current = std::move(source);
+  for (size_t i = 0; i < static_cast<size_t>(levels.size()); ++i) {
+    const auto& level = levels[i];
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto downsampled,
+        DownsampleArray(current, level.downsample_factors, method),
+        MaybeAnnotateStatus(
+            _, tensorstore::StrCat("Computing pyramid level ", i)));
+    current = std::move(downsampled);
+    TENSORSTORE_RETURN_IF_ERROR(issue_write(current, level.store));
+  }
+
+  return WaitAllFuture(span<const AnyFuture>(commit_futures));
+}
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
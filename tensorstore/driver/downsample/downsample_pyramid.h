@@ -0,0 +1,65 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_DOWNSAMPLE_DOWNSAMPLE_PYRAMID_H_
+#define TENSORSTORE_DRIVER_DOWNSAMPLE_DOWNSAMPLE_PYRAMID_H_
+
+#include <vector>
+
+#include "tensorstore/array.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/index.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_downsample {
+
+/// Specifies one coarser level of a multiscale pyramid.
+struct PyramidLevel {
+  /// Store receiving the downsampled data for this level.
+  TensorStore<> store;
+
+  /// Downsample factors relative to the *previous* level (the base for the
+  /// first entry), one per dimension.
+  std::vector<Index> downsample_factors;
+};
+
+/// Writes `source` to `base` and, in the same pass, writes successively
+/// downsampled copies to each store in `levels`, computing each level from
+/// the previous level's in-memory data rather than re-reading the base.
+///
+/// The domain of `source` specifies the target region within `base`.  The
+/// region written to each level is obtained by downsampling that domain with
+/// the same convention as the `downsample` driver.  For results identical to
+/// downsampling the full dataset, the bounds of `source` must be multiples of
+/// the cumulative downsample factors, except where they coincide with the
+/// bounds of `base`.
+///
+/// \param source Data to write, with its domain positioned within `base`.
+/// \param base Store receiving the full-resolution data.
+/// \param levels Successively coarser stores; may be empty.
+/// \param method Downsampling method to use for every level.
+/// \returns A future that becomes ready when the writes to `base` and to all
+///     levels have committed.
+Future<void> WriteDownsampledPyramid(SharedOffsetArray<const void> source,
+                                     TensorStore<> base,
+                                     span<const PyramidLevel> levels,
+                                     DownsampleMethod method);
+
+}  // namespace internal_downsample
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_DOWNSAMPLE_DOWNSAMPLE_PYRAMID_H_
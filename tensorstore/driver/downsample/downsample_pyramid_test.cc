@@ -0,0 +1,106 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/downsample/downsample_pyramid.h"
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/downsample_method.h"
+#include "tensorstore/driver/array/array.h"
+#include "tensorstore/index.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::DownsampleMethod;
+using ::tensorstore::Index;
+using ::tensorstore::MakeArray;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::internal_downsample::PyramidLevel;
+using ::tensorstore::internal_downsample::WriteDownsampledPyramid;
+
+TEST(WriteDownsampledPyramidTest, TwoLevels) {
+  auto base_array = tensorstore::AllocateArray<float>({4, 4});
+  auto level1_array = tensorstore::AllocateArray<float>({2, 2});
+  auto level2_array = tensorstore::AllocateArray<float>({1, 1});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base,
+                                   tensorstore::FromArray(base_array));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level1,
+                                   tensorstore::FromArray(level1_array));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level2,
+                                   tensorstore::FromArray(level2_array));
+
+  auto source = MakeArray<float>({{1, 2, 3, 4},
+                                  {5, 6, 7, 8},
+                                  {9, 10, 11, 12},
+                                  {13, 14, 15, 16}});
+  std::vector<PyramidLevel> levels;
+  levels.push_back(PyramidLevel{level1, {2, 2}});
+  levels.push_back(PyramidLevel{level2, {2, 2}});
+  TENSORSTORE_ASSERT_OK(
+      WriteDownsampledPyramid(source, base, levels, DownsampleMethod::kMean)
+          .result());
+
+  EXPECT_EQ(source, base_array);
+  EXPECT_EQ(MakeArray<float>({{3.5, 5.5}, {11.5, 13.5}}), level1_array);
+  EXPECT_EQ(MakeArray<float>({{8.5}}), level2_array);
+}
+
+TEST(WriteDownsampledPyramidTest, PartialRegion) {
+  auto base_array = tensorstore::AllocateArray<int>({4}, tensorstore::c_order,
+                                                    tensorstore::value_init);
+  auto level1_array = tensorstore::AllocateArray<int>({2}, tensorstore::c_order,
+                                                      tensorstore::value_init);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base,
+                                   tensorstore::FromArray(base_array));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level1,
+                                   tensorstore::FromArray(level1_array));
+
+  // Only the second half of the domain is written; the downsampled region
+  // is derived from the source domain.
+  auto source = tensorstore::MakeOffsetArray<int>({2}, {10, 20});
+  std::vector<PyramidLevel> levels;
+  levels.push_back(PyramidLevel{level1, {2}});
+  TENSORSTORE_ASSERT_OK(
+      WriteDownsampledPyramid(source, base, levels, DownsampleMethod::kStride)
+          .result());
+
+  EXPECT_EQ(MakeArray<int>({0, 0, 10, 20}), base_array);
+  EXPECT_EQ(MakeArray<int>({0, 10}), level1_array);
+}
+
+TEST(WriteDownsampledPyramidTest, InvalidFactors) {
+  auto base_array = tensorstore::AllocateArray<float>({4});
+  auto level1_array = tensorstore::AllocateArray<float>({2});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base,
+                                   tensorstore::FromArray(base_array));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto level1,
+                                   tensorstore::FromArray(level1_array));
+
+  std::vector<PyramidLevel> levels;
+  levels.push_back(PyramidLevel{level1, {2, 2}});
+  EXPECT_THAT(WriteDownsampledPyramid(MakeArray<float>({1, 2, 3, 4}), base,
+                                      levels, DownsampleMethod::kMean)
+                  .result(),
+              MatchesStatus(absl::StatusCode::kInvalidArgument,
+                            "Computing pyramid level 0: .*"));
+}
+
+}  // namespace
@@ -1192,6 +1192,13 @@ ReadChunk MakeArrayBackedReadChunk(TransformedArray<Shared<const void>> data) {
                                        Arena* arena) {
       return GetTransformedArrayNDIterable({data, chunk_transform}, arena);
     }
+
+    bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                    TransformedSharedArray<const void>& read_result) {
+      read_result = TransformedSharedArray<const void>(
+          data, IndexTransform<>(chunk_transform));
+      return true;
+    }
   };
   ReadChunk chunk;
   chunk.impl = ReadChunkImpl{data.element_pointer()};
@@ -42,6 +42,7 @@
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_domain_builder.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/cache/async_cache.h"
 #include "tensorstore/internal/cache/async_initialized_cache_mixin.h"
@@ -529,6 +530,21 @@ struct ReadChunkImpl {
     return internal::GetTransformedArrayNDIterable(*lock.data(),
                                                    chunk_transform, arena);
   }
+
+  bool operator()(internal::ReadChunk::ReadArray,
+                  IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) const {
+    LockType lock{*entry};
+    assert(lock.data());
+    // The decoded image is immutable, so a zero-copy view that shares
+    // ownership of it may be handed out.
+    auto transformed_array = MakeTransformedArray(
+        SharedArray<const void, 3>(*lock.data()),
+        IndexTransform<>(chunk_transform));
+    if (!transformed_array.ok()) return false;
+    read_result = std::move(transformed_array).value();
+    return true;
+  }
 };
 
 template <typename Specialization>
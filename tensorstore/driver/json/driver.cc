@@ -33,10 +33,12 @@
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/driver/driver_spec.h"
 #include "tensorstore/driver/json/json_change_map.h"
+#include "tensorstore/driver/json/json_splice.h"
 #include "tensorstore/driver/registry.h"
 #include "tensorstore/index.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/cache/async_cache.h"
 #include "tensorstore/internal/cache/async_initialized_cache_mixin.h"
@@ -100,7 +102,18 @@ class JsonCache
   using Base = internal::KvsBackedCache<JsonCache, internal::AsyncCache>;
 
  public:
-  using ReadData = ::nlohmann::json;
+  /// Decoded document, together with the encoded representation from which it
+  /// was decoded (or to which it was most recently encoded).
+  ///
+  /// The encoded representation is retained so that `DoApply` can re-encode
+  /// pointer writes incrementally, splicing just the modified subtrees rather
+  /// than re-serializing the full document.  If `encoded` is empty, no
+  /// encoded representation is retained (e.g. the document was written
+  /// without first being read) and `DoEncode` serializes `value` in full.
+  struct ReadData {
+    ::nlohmann::json value{::nlohmann::json::value_t::discarded};
+    absl::Cord encoded;
+  };
 
   JsonCache() : Base(kvstore::DriverPtr()) {}
 
@@ -116,18 +129,25 @@ class JsonCache
               execution::set_error(receiver, decode_result.status());
               return;
             }
-            execution::set_value(receiver, std::make_shared<::nlohmann::json>(
-                                               *std::move(decode_result)));
+            auto read_data = std::make_shared<ReadData>();
+            read_data->value = *std::move(decode_result);
+            if (value) read_data->encoded = *std::move(value);
+            execution::set_value(receiver, std::move(read_data));
           });
     }
     void DoEncode(std::shared_ptr<const ReadData> data,
                   EncodeReceiver receiver) override {
-      const auto& json_value = *data;
-      if (json_value.is_discarded()) {
+      if (data->value.is_discarded()) {
         execution::set_value(receiver, std::nullopt);
         return;
       }
-      execution::set_value(receiver, absl::Cord(json_value.dump()));
+      // `DoApply` retains an incrementally-spliced encoded representation
+      // when possible; otherwise the document must be serialized in full.
+      if (!data->encoded.empty()) {
+        execution::set_value(receiver, data->encoded);
+        return;
+      }
+      execution::set_value(receiver, absl::Cord(data->value.dump()));
     }
   };
 
@@ -162,16 +182,18 @@ class JsonCache
             }
 
             if (!unmodified) {
-              auto* existing_json =
-                  static_cast<const ::nlohmann::json*>(read_state.data.get());
+              auto* existing_state =
+                  static_cast<const ReadData*>(read_state.data.get());
               ::nlohmann::json new_json;
               // Apply changes.  If `existing_state` is non-null (equivalent to
               // `unconditional == false`), provide it to `Apply`.  Otherwise,
-              // pass in a placeholder value (which won't be used).
+              // pass in a placeholder value (which won't be used).  The
+              // placeholder is an lvalue to avoid copying the existing
+              // document merely to pass it as an argument.
+              const ::nlohmann::json placeholder(
+                  ::nlohmann::json::value_t::discarded);
               auto result = changes_.Apply(
-                  existing_json
-                      ? *existing_json
-                      : ::nlohmann::json(::nlohmann::json::value_t::discarded));
+                  existing_state ? existing_state->value : placeholder);
               if (result.ok()) {
                 new_json = *std::move(result);
               } else {
@@ -181,11 +203,22 @@ class JsonCache
               // For conditional states, only mark dirty if it differs from the
               // existing state, since otherwise the writeback can be skipped
               // (and instead the state can just be verified).
-              if (!existing_json ||
-                  !internal_json::JsonSame(new_json, *existing_json)) {
+              if (!existing_state ||
+                  !internal_json::JsonSame(new_json, existing_state->value)) {
                 read_state.stamp.generation.MarkDirty();
-                read_state.data =
-                    std::make_shared<::nlohmann::json>(std::move(new_json));
+                auto new_data = std::make_shared<ReadData>();
+                // Re-encode incrementally by splicing the modified subtrees
+                // into the retained encoded representation when possible;
+                // otherwise leave `encoded` empty and `DoEncode` serializes
+                // the full document.
+                if (existing_state && !existing_state->encoded.empty()) {
+                  if (auto spliced = internal_json_driver::SpliceJsonChanges(
+                          existing_state->encoded, changes_)) {
+                    new_data->encoded = *std::move(spliced);
+                  }
+                }
+                new_data->value = std::move(new_json);
+                read_state.data = std::move(new_data);
               }
             }
             execution::set_value(receiver, std::move(read_state));
@@ -428,17 +461,24 @@ struct ReadChunkImpl {
     // Note that this acquires a lock on the entry, not the node, and
     // therefore does not conflict with the lock registered with the
     // `LockCollection`.
-    std::shared_ptr<const ::nlohmann::json> read_value =
+    std::shared_ptr<const JsonCache::ReadData> read_data =
         AsyncCache::ReadLock<JsonCache::ReadData>(*entry).shared_data();
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto* sub_value,
-        json_pointer::Dereference(*read_value, driver->json_pointer_),
+        json_pointer::Dereference(read_data->value, driver->json_pointer_),
         entry->AnnotateError(_, /*reading=*/true));
     return GetTransformedArrayNDIterable(
-        std::shared_ptr<const ::nlohmann::json>(std::move(read_value),
+        std::shared_ptr<const ::nlohmann::json>(std::move(read_data),
                                                 sub_value),
         std::move(chunk_transform), arena);
   }
+
+  bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) const {
+    // There is no benefit to a zero-copy view of a single JSON value over the
+    // `BeginRead` code path.
+    return false;
+  }
 };
 
 /// TensorStore Driver ReadChunk implementation for the case of a transactional
@@ -459,11 +499,11 @@ struct ReadChunkTransactionImpl {
   Result<NDIterable::Ptr> operator()(ReadChunk::BeginRead,
                                      IndexTransform<> chunk_transform,
                                      Arena* arena) {
-    std::shared_ptr<const ::nlohmann::json> existing_value;
+    std::shared_ptr<const JsonCache::ReadData> existing_read_data;
     StorageGeneration read_generation;
     {
       AsyncCache::ReadLock<JsonCache::ReadData> lock(*node);
-      existing_value = lock.shared_data();
+      existing_read_data = lock.shared_data();
       read_generation = lock.stamp().generation;
     }
     auto value = std::allocate_shared<::nlohmann::json>(
@@ -475,20 +515,25 @@ struct ReadChunkTransactionImpl {
         TENSORSTORE_RETURN_IF_ERROR(
             node->RequireRepeatableRead(read_generation));
       }
-      assert(existing_value ||
+      assert(existing_read_data ||
              node->changes_.CanApplyUnconditionally(driver->json_pointer_));
+      const ::nlohmann::json placeholder(::nlohmann::json::value_t::discarded);
       TENSORSTORE_ASSIGN_OR_RETURN(
           *value,
           node->changes_.Apply(
-              existing_value
-                  ? *existing_value
-                  : ::nlohmann::json(::nlohmann::json::value_t::discarded),
+              existing_read_data ? existing_read_data->value : placeholder,
               driver->json_pointer_),
           GetOwningEntry(*node).AnnotateError(_, /*reading=*/true));
     }
     return GetTransformedArrayNDIterable(std::move(value), chunk_transform,
                                          arena);
   }
+
+  bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) const {
+    // Uncommitted modifications must be applied by the `BeginRead` code path.
+    return false;
+  }
 };
 
 void JsonDriver::Read(ReadRequest request, ReadChunkReceiver receiver) {
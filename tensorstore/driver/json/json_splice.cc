@@ -0,0 +1,281 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/json/json_splice.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/driver/json/json_change_map.h"
+
+namespace tensorstore {
+namespace internal_json_driver {
+namespace {
+
+/// Minimal scanner over the text of an already-validated JSON document.
+///
+/// Since the document is known to parse successfully, any syntax error
+/// encountered indicates a bug; scanning methods simply report failure, which
+/// causes callers to fall back to full re-serialization.
+class JsonScanner {
+ public:
+  explicit JsonScanner(std::string_view text) : text_(text) {}
+
+  size_t position() const { return pos_; }
+
+  char Peek() const { return pos_ < text_.size() ? text_[pos_] : '\0'; }
+
+  void SkipWhitespace() {
+    while (pos_ < text_.size() && IsWhitespace(text_[pos_])) ++pos_;
+  }
+
+  /// Skips over a string literal, returning the raw text including the
+  /// enclosing quotation marks.
+  std::optional<std::string_view> SkipString() {
+    if (Peek() != '"') return std::nullopt;
+    const size_t start = pos_++;
+    while (pos_ < text_.size()) {
+      const char c = text_[pos_];
+      if (c == '\\') {
+        pos_ += 2;
+      } else if (c == '"') {
+        ++pos_;
+        return text_.substr(start, pos_ - start);
+      } else {
+        ++pos_;
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// Skips over a complete value, including any leading whitespace.
+  bool SkipValue() {
+    SkipWhitespace();
+    const char first = Peek();
+    if (first == '"') return SkipString().has_value();
+    if (first == '{' || first == '[') {
+      size_t depth = 0;
+      while (pos_ < text_.size()) {
+        const char c = text_[pos_];
+        if (c == '"') {
+          if (!SkipString()) return false;
+          continue;
+        }
+        ++pos_;
+        if (c == '{' || c == '[') {
+          ++depth;
+        } else if (c == '}' || c == ']') {
+          if (--depth == 0) return true;
+        }
+      }
+      return false;
+    }
+    // Number, `true`, `false`, or `null`.
+    const size_t start = pos_;
+    while (pos_ < text_.size() && !IsValueDelimiter(text_[pos_])) ++pos_;
+    return pos_ != start;
+  }
+
+  /// Positions the scanner at the start of the value of the member of the
+  /// current object (the scanner must be positioned at its "{") whose name
+  /// equals `key`.
+  ///
+  /// The full object is scanned so that if `key` occurs more than once, the
+  /// last occurrence is used, consistent with `::nlohmann::json::parse`
+  /// retaining the last duplicate member.
+  bool DescendObjectMember(std::string_view key) {
+    if (Peek() != '{') return false;
+    ++pos_;
+    SkipWhitespace();
+    std::optional<size_t> value_pos;
+    if (Peek() != '}') {
+      while (true) {
+        SkipWhitespace();
+        auto raw_key = SkipString();
+        if (!raw_key) return false;
+        SkipWhitespace();
+        if (Peek() != ':') return false;
+        ++pos_;
+        SkipWhitespace();
+        if (KeyEquals(*raw_key, key)) value_pos = pos_;
+        if (!SkipValue()) return false;
+        SkipWhitespace();
+        if (Peek() != ',') break;
+        ++pos_;
+      }
+      if (Peek() != '}') return false;
+    }
+    if (!value_pos) return false;
+    pos_ = *value_pos;
+    return true;
+  }
+
+  /// Positions the scanner at the start of the element of the current array
+  /// (the scanner must be positioned at its "[") indexed by the reference
+  /// token `token`.
+  bool DescendArrayElement(std::string_view token) {
+    // Per RFC 6901, an array index must be a base-10 integer without leading
+    // zeroes.  The "-" token refers to the non-existent element after the
+    // last element.
+    if (token.empty() || (token.size() > 1 && token[0] == '0') ||
+        token.size() > 15) {
+      return false;
+    }
+    size_t index = 0;
+    for (const char c : token) {
+      if (c < '0' || c > '9') return false;
+      index = index * 10 + (c - '0');
+    }
+    if (Peek() != '[') return false;
+    ++pos_;
+    SkipWhitespace();
+    if (Peek() == ']') return false;
+    for (size_t i = 0; i < index; ++i) {
+      if (!SkipValue()) return false;
+      SkipWhitespace();
+      if (Peek() != ',') return false;
+      ++pos_;
+    }
+    SkipWhitespace();
+    return true;
+  }
+
+ private:
+  static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  }
+
+  static bool IsValueDelimiter(char c) {
+    return c == ',' || c == '}' || c == ']' || IsWhitespace(c);
+  }
+
+  /// Compares the raw text of a string literal (including the enclosing
+  /// quotation marks) against the decoded string `key`.
+  static bool KeyEquals(std::string_view raw, std::string_view key) {
+    const std::string_view contents = raw.substr(1, raw.size() - 2);
+    if (contents.find('\\') == std::string_view::npos) return contents == key;
+    // The literal contains escapes; decode it to compare.
+    const auto decoded = ::nlohmann::json::parse(raw, /*cb=*/nullptr,
+                                                 /*allow_exceptions=*/false);
+    return decoded.is_string() &&
+           decoded.get_ref<const std::string&>() == key;
+  }
+
+  std::string_view text_;
+  size_t pos_ = 0;
+};
+
+/// Splits `sub_value_pointer` into its first decoded reference token and the
+/// remaining pointer suffix.
+///
+/// \pre `json_pointer::Validate(sub_value_pointer).ok()`
+/// \pre `!sub_value_pointer.empty()`
+std::pair<std::string, std::string_view> SplitPointer(
+    std::string_view sub_value_pointer) {
+  assert(!sub_value_pointer.empty() && sub_value_pointer[0] == '/');
+  sub_value_pointer.remove_prefix(1);
+  const size_t end = sub_value_pointer.find('/');
+  const std::string_view raw = sub_value_pointer.substr(0, end);
+  const std::string_view rest = (end == std::string_view::npos)
+                                    ? std::string_view{}
+                                    : sub_value_pointer.substr(end);
+  std::string token;
+  token.reserve(raw.size());
+  for (size_t i = 0; i < raw.size(); ++i) {
+    if (raw[i] == '~') {
+      // `Validate` guarantees that '~' is followed by '0' or '1'.
+      token += (raw[++i] == '0') ? '~' : '/';
+    } else {
+      token += raw[i];
+    }
+  }
+  return {std::move(token), rest};
+}
+
+}  // namespace
+
+std::optional<EncodedValueRange> FindEncodedValue(
+    std::string_view encoded, std::string_view sub_value_pointer) {
+  JsonScanner scanner(encoded);
+  while (!sub_value_pointer.empty()) {
+    auto [token, rest] = SplitPointer(sub_value_pointer);
+    sub_value_pointer = rest;
+    scanner.SkipWhitespace();
+    bool found;
+    if (scanner.Peek() == '{') {
+      found = scanner.DescendObjectMember(token);
+    } else if (scanner.Peek() == '[') {
+      found = scanner.DescendArrayElement(token);
+    } else {
+      found = false;
+    }
+    if (!found) return std::nullopt;
+  }
+  scanner.SkipWhitespace();
+  const size_t begin = scanner.position();
+  if (!scanner.SkipValue()) return std::nullopt;
+  return EncodedValueRange{begin, scanner.position()};
+}
+
+std::optional<absl::Cord> SpliceJsonChanges(const absl::Cord& encoded,
+                                            const JsonChangeMap& changes) {
+  // The copy shares the representation of `encoded`; flattening it allows
+  // unmodified portions of the result to be returned as zero-copy subcords.
+  absl::Cord flat = encoded;
+  const std::string_view text = flat.Flatten();
+  struct Splice {
+    EncodedValueRange range;
+    std::string replacement;
+  };
+  std::vector<Splice> splices;
+  splices.reserve(changes.underlying_map().size());
+  for (const auto& [sub_value_pointer, sub_value] : changes.underlying_map()) {
+    if (sub_value.is_discarded()) {
+      // Deletion also removes the object member or array element containing
+      // the value, which is not expressible as a value splice.
+      return std::nullopt;
+    }
+    auto range = FindEncodedValue(text, sub_value_pointer);
+    if (!range) return std::nullopt;
+    splices.push_back(Splice{*range, sub_value.dump()});
+  }
+  // The change map is normalized such that no pointer contains another, which
+  // implies that the byte ranges are disjoint.
+  std::sort(splices.begin(), splices.end(),
+            [](const Splice& a, const Splice& b) {
+              return a.range.begin < b.range.begin;
+            });
+  absl::Cord result;
+  size_t offset = 0;
+  for (auto& splice : splices) {
+    assert(splice.range.begin >= offset);
+    result.Append(flat.Subcord(offset, splice.range.begin - offset));
+    result.Append(std::move(splice.replacement));
+    offset = splice.range.end;
+  }
+  result.Append(flat.Subcord(offset, text.size() - offset));
+  return result;
+}
+
+}  // namespace internal_json_driver
+}  // namespace tensorstore
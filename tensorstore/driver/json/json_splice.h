@@ -0,0 +1,71 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_JSON_JSON_SPLICE_H_
+#define TENSORSTORE_DRIVER_JSON_JSON_SPLICE_H_
+
+/// \file
+/// Incremental re-encoding of JSON documents modified via JSON Pointer.
+
+#include <stddef.h>
+
+#include <optional>
+#include <string_view>
+
+#include "absl/strings/cord.h"
+#include "tensorstore/driver/json/json_change_map.h"
+
+namespace tensorstore {
+namespace internal_json_driver {
+
+/// Byte range of an encoded value within an encoded JSON document.
+struct EncodedValueRange {
+  size_t begin;
+  size_t end;
+};
+
+/// Locates the byte range of the value referenced by `sub_value_pointer`
+/// within the encoded JSON document `encoded`.
+///
+/// If the object containing the referenced value contains duplicate member
+/// names, the last matching member is located, consistent with
+/// `::nlohmann::json::parse` retaining the last duplicate.
+///
+/// \pre `encoded` parses successfully as JSON.
+/// \pre `json_pointer::Validate(sub_value_pointer).ok()`
+/// \returns The byte range of the referenced value, or `std::nullopt` if
+///     `sub_value_pointer` does not refer to an existing value.
+std::optional<EncodedValueRange> FindEncodedValue(
+    std::string_view encoded, std::string_view sub_value_pointer);
+
+/// Applies `changes` to the encoded JSON document `encoded`, by splicing the
+/// encoded replacement values in place of the byte ranges of the values they
+/// replace, without re-serializing the unmodified portions of the document.
+///
+/// Unmodified portions of the result share the representation of `encoded`.
+///
+/// \pre `encoded` parses successfully to a value to which `changes` can be
+///     applied.
+/// \returns The encoded result of applying `changes`, or `std::nullopt` if
+///     the changes cannot be expressed as value splices (e.g. a change
+///     deletes a value, or adds an object member or array element that is not
+///     present in `encoded`); in that case the caller must re-serialize the
+///     full document.
+std::optional<absl::Cord> SpliceJsonChanges(const absl::Cord& encoded,
+                                            const JsonChangeMap& changes);
+
+}  // namespace internal_json_driver
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_JSON_JSON_SPLICE_H_
@@ -0,0 +1,113 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/json/json_splice.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/driver/json/json_change_map.h"
+#include "tensorstore/internal/json_gtest.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::MatchesJson;
+using ::tensorstore::internal_json_driver::FindEncodedValue;
+using ::tensorstore::internal_json_driver::JsonChangeMap;
+using ::tensorstore::internal_json_driver::SpliceJsonChanges;
+
+// Returns the text of the value referenced by `sub_value_pointer` within
+// `encoded`, or `std::nullopt` if not found.
+std::optional<std::string> GetEncodedValue(std::string_view encoded,
+                                           std::string_view sub_value_pointer) {
+  auto range = FindEncodedValue(encoded, sub_value_pointer);
+  if (!range) return std::nullopt;
+  return std::string(encoded.substr(range->begin, range->end - range->begin));
+}
+
+TEST(FindEncodedValueTest, Basic) {
+  constexpr std::string_view doc =
+      R"( { "a" : [ 1 , {"b": "x,]"} , true ] , "c/d" : null } )";
+  EXPECT_THAT(GetEncodedValue(doc, ""),
+              ::testing::Optional(std::string(doc.substr(1, doc.size() - 2))));
+  EXPECT_THAT(
+      GetEncodedValue(doc, "/a"),
+      ::testing::Optional(std::string(R"([ 1 , {"b": "x,]"} , true ])")));
+  EXPECT_THAT(GetEncodedValue(doc, "/a/0"),
+              ::testing::Optional(std::string("1")));
+  EXPECT_THAT(GetEncodedValue(doc, "/a/1/b"),
+              ::testing::Optional(std::string("\"x,]\"")));
+  EXPECT_THAT(GetEncodedValue(doc, "/a/2"),
+              ::testing::Optional(std::string("true")));
+  // Escaped member names are decoded before comparison.
+  EXPECT_THAT(GetEncodedValue(doc, "/c~1d"),
+              ::testing::Optional(std::string("null")));
+  EXPECT_EQ(std::nullopt, GetEncodedValue(doc, "/missing"));
+  EXPECT_EQ(std::nullopt, GetEncodedValue(doc, "/a/3"));
+  EXPECT_EQ(std::nullopt, GetEncodedValue(doc, "/a/-"));
+  EXPECT_EQ(std::nullopt, GetEncodedValue(doc, "/a/01"));
+  EXPECT_EQ(std::nullopt, GetEncodedValue(doc, "/a/0/b"));
+}
+
+TEST(FindEncodedValueTest, DuplicateKeys) {
+  // `::nlohmann::json::parse` retains the last duplicate member, so the last
+  // occurrence must be located.
+  EXPECT_THAT(GetEncodedValue(R"({"a": 1, "a": 2})", "/a"),
+              ::testing::Optional(std::string("2")));
+}
+
+TEST(SpliceJsonChangesTest, MultipleChanges) {
+  const absl::Cord encoded(
+      R"({"a": {"x": 1, "y": [2, 3]}, "b": "old", "c": 4})");
+  JsonChangeMap changes;
+  TENSORSTORE_EXPECT_OK(changes.AddChange("/a/y/1", 42));
+  TENSORSTORE_EXPECT_OK(changes.AddChange("/b", "new"));
+  auto spliced = SpliceJsonChanges(encoded, changes);
+  ASSERT_TRUE(spliced.has_value());
+  // Unmodified portions retain their original encoding.
+  EXPECT_EQ(R"({"a": {"x": 1, "y": [2, 42]}, "b": "new", "c": 4})",
+            std::string(*spliced));
+  // The spliced representation decodes to the same value as applying the
+  // changes to the decoded document.
+  EXPECT_THAT(
+      ::nlohmann::json::parse(std::string(*spliced)),
+      MatchesJson(changes
+                      .Apply(::nlohmann::json::parse(std::string(encoded)))
+                      .value()));
+}
+
+TEST(SpliceJsonChangesTest, Unspliceable) {
+  const absl::Cord encoded(R"({"a": 1})");
+  {
+    // Adding a new member is not expressible as a value splice.
+    JsonChangeMap changes;
+    TENSORSTORE_EXPECT_OK(changes.AddChange("/b", 2));
+    EXPECT_EQ(std::nullopt, SpliceJsonChanges(encoded, changes));
+  }
+  {
+    // Deletion is not expressible as a value splice.
+    JsonChangeMap changes;
+    TENSORSTORE_EXPECT_OK(changes.AddChange(
+        "/a", ::nlohmann::json(::nlohmann::json::value_t::discarded)));
+    EXPECT_EQ(std::nullopt, SpliceJsonChanges(encoded, changes));
+  }
+}
+
+}  // namespace
@@ -1014,6 +1014,24 @@ struct GetMetadataForOpen {
         TENSORSTORE_ASSIGN_OR_RETURN(
             auto metadata, state->Create(nullptr, {/*.assume_metadata=*/true}),
             static_cast<void>(promise.SetResult(_)));
+        if (base.spec_->assume_cached_metadata) {
+          // If the spec requests metadata rechecking, speculatively fetch the
+          // stored metadata concurrently with the open (which completes
+          // immediately using the assumed metadata) and any data reads issued
+          // by the caller.  Subsequent operations that consult the metadata,
+          // such as `ResolveBounds` and transactional writes, validate
+          // against the fetched metadata and fail on mismatch.  With the
+          // default staleness bound of `absl::InfinitePast()` no fetch is
+          // issued, preserving the documented behavior of not reading the
+          // metadata when opening.
+          if (auto staleness_bound =
+                  base.spec_->staleness.metadata.BoundAtOpen(base.request_time_)
+                      .time;
+              staleness_bound != absl::InfinitePast()) {
+            base.metadata_cache_entry_->Read({staleness_bound, batch})
+                .IgnoreFuture();
+          }
+        }
         promise.SetResult(
             state->CreateDriverHandleFromMetadata(std::move(metadata)));
         return;
@@ -379,6 +379,39 @@ TEST(N5DriverTest, CreateRank0) {
   };
 }
 
+// Tests copying between two chunked stores with a limit on in-flight chunk
+// copy operations, which forces most of the chunk copy operations through the
+// deferred-dispatch path.
+TEST(N5DriverTest, CopyWithChunkBudget) {
+  auto context = Context::Default();
+  ::nlohmann::json source_spec = GetJsonSpec();
+  source_spec["kvstore"]["path"] = "source/";
+  ::nlohmann::json target_spec = GetJsonSpec();
+  target_spec["kvstore"]["path"] = "target/";
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source,
+      tensorstore::Open(source_spec, context, tensorstore::OpenMode::create)
+          .result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto target,
+      tensorstore::Open(target_spec, context, tensorstore::OpenMode::create)
+          .result());
+  auto array = tensorstore::AllocateArray<int16_t>({10, 11});
+  for (Index i = 0; i < 10; ++i) {
+    for (Index j = 0; j < 11; ++j) {
+      array(i, j) = static_cast<int16_t>(i * 11 + j);
+    }
+  }
+  TENSORSTORE_EXPECT_OK(tensorstore::Write(array, source));
+  // Each chunk copy operation targets at most one 3x2 block (12 bytes), so
+  // the byte budget additionally restricts the copy to one operation at a
+  // time.
+  TENSORSTORE_EXPECT_OK(tensorstore::Copy(
+      source, target,
+      tensorstore::CopyChunkBudget{/*.max_chunks=*/2, /*.max_bytes=*/12}));
+  EXPECT_THAT(tensorstore::Read(target).result(), ::testing::Optional(array));
+}
+
 TEST(N5DriverTest, Resize) {
   for (bool enable_cache : {false, true}) {
     for (const auto resize_mode :
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <string>
@@ -25,11 +26,13 @@
 #include "tensorstore/driver/n5/compressor.h"
 #include "tensorstore/driver/n5/metadata.h"
 #include "tensorstore/index.h"
+#include "tensorstore/internal/compression/zlib.h"
 #include "tensorstore/internal/json_binding/gtest.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
+namespace zlib = tensorstore::zlib;
 using ::tensorstore::Index;
 using ::tensorstore::MakeArray;
 using ::tensorstore::MatchesStatus;
@@ -110,4 +113,37 @@ TEST(GzipCompressionTest, Golden) {
   }
 }
 
+// Parallel gzip compressors split large inputs into multiple gzip members,
+// which is permitted by RFC 1952; all members must be decoded.
+TEST(GzipCompressionTest, MultiMember) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto metadata,
+      N5Metadata::FromJson({{"dimensions", {10, 11, 12}},
+                            {"blockSize", {1, 2, 3}},
+                            {"dataType", "uint16"},
+                            {"compression", {{"type", "gzip"}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto raw_metadata,
+      N5Metadata::FromJson({{"dimensions", {10, 11, 12}},
+                            {"blockSize", {1, 2, 3}},
+                            {"dataType", "uint16"},
+                            {"compression", {{"type", "raw"}}}}));
+  auto array = MakeArray<uint16_t>({{{1, 3, 5}, {2, 4, 6}}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto raw_buffer,
+                                   EncodeChunk(raw_metadata, array));
+  // The chunk header (mode, rank, and block shape) precedes the block data.
+  const size_t header_size = 2 + 2 + 4 * 3;
+  const absl::Cord block_data =
+      raw_buffer.Subcord(header_size, raw_buffer.size() - header_size);
+  // Compress the two halves of the block data as separate gzip members.
+  zlib::Options options;
+  options.use_gzip_header = true;
+  absl::Cord encoded = raw_buffer.Subcord(0, header_size);
+  const size_t split = block_data.size() / 2;
+  zlib::Encode(block_data.Subcord(0, split), &encoded, options);
+  zlib::Encode(block_data.Subcord(split, block_data.size() - split), &encoded,
+               options);
+  EXPECT_EQ(array, DecodeChunk(metadata, encoded));
+}
+
 }  // namespace
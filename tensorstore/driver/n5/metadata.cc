@@ -31,7 +31,9 @@
 #include "absl/strings/cord.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/types/span.h"
 #include <nlohmann/json.hpp>
+#include "riegeli/bytes/array_writer.h"
 #include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
 #include "riegeli/bytes/reader.h"
@@ -50,6 +52,7 @@
 #include "tensorstore/index_space/dimension_units.h"
 #include "tensorstore/index_space/index_domain.h"
 #include "tensorstore/index_space/index_domain_builder.h"
+#include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/internal/json/same.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/data_type.h"
@@ -301,39 +304,57 @@ Result<SharedArray<const void>> DecodeChunk(const N5Metadata& metadata,
   return decoded_array;
 }
 
+namespace {
+// Writes the chunk header.
+// mode: 0x0 = default
+bool WriteChunkHeader(const N5Metadata& metadata,
+                      const SharedArrayView<const void>& array,
+                      riegeli::Writer& writer) {
+  if (!riegeli::WriteBigEndian16(0, writer) ||
+      !riegeli::WriteBigEndian16(metadata.rank, writer)) {
+    return false;
+  }
+  for (DimensionIndex i = 0; i < array.rank(); ++i) {
+    if (!riegeli::WriteBigEndian32(array.shape()[i], writer)) return false;
+  }
+  return true;
+}
+}  // namespace
+
 Result<absl::Cord> EncodeChunk(const N5Metadata& metadata,
                                SharedArrayView<const void> array) {
   assert(absl::c_equal(metadata.chunk_shape, array.shape()));
-  absl::Cord encoded;
-  riegeli::CordWriter<> base_writer(&encoded);
-  riegeli::Writer* writer = &base_writer;
-
-  // Write header
-  // mode: 0x0 = default
-  if (!riegeli::WriteBigEndian16(0, *writer) ||
-      !riegeli::WriteBigEndian16(metadata.rank, *writer)) {
-    return writer->status();
-  }
-  for (DimensionIndex i = 0; i < array.rank(); ++i) {
-    if (!riegeli::WriteBigEndian32(array.shape()[i], *writer)) {
-      return writer->status();
+  // Always write chunks as full size, to avoid race conditions or data loss
+  // in the event of a concurrent resize.
+  if (!metadata.compressor) {
+    // Without a compressor the encoded size is known exactly; encode directly
+    // into a single flat block rather than assembling the chunk from copied
+    // cord blocks.
+    const size_t header_bytes = 4 + sizeof(uint32_t) * metadata.rank;
+    internal::FlatCordBuilder builder(
+        header_bytes + array.num_elements() * metadata.dtype.size());
+    riegeli::ArrayWriter<> writer(
+        absl::MakeSpan(builder.data(), builder.size()));
+    if (!WriteChunkHeader(metadata, array, writer) ||
+        !internal::EncodeArrayEndian(array, endian::big, fortran_order,
+                                     writer)) {
+      return writer.status();
     }
+    if (!writer.Close()) return writer.status();
+    return std::move(builder).Build();
   }
-  std::unique_ptr<riegeli::Writer> compressed_writer;
-  if (metadata.compressor) {
-    compressed_writer =
-        metadata.compressor->GetWriter(base_writer, metadata.dtype.size());
-    writer = compressed_writer.get();
+  absl::Cord encoded;
+  riegeli::CordWriter<> base_writer(&encoded);
+  if (!WriteChunkHeader(metadata, array, base_writer)) {
+    return base_writer.status();
   }
-  // Always write chunks as full size, to avoid race conditions or data loss
-  // in the event of a concurrent resize.
+  std::unique_ptr<riegeli::Writer> compressed_writer =
+      metadata.compressor->GetWriter(base_writer, metadata.dtype.size());
   if (!internal::EncodeArrayEndian(array, endian::big, fortran_order,
-                                   *writer)) {
-    return writer->status();
-  }
-  if (compressed_writer && !compressed_writer->Close()) {
+                                   *compressed_writer)) {
     return compressed_writer->status();
   }
+  if (!compressed_writer->Close()) return compressed_writer->status();
   if (!base_writer.Close()) return base_writer.status();
   return encoded;
 }
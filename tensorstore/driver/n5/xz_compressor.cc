@@ -32,12 +32,22 @@ struct Registration {
     using internal::XzCompressor;
     namespace jb = tensorstore::internal_json_binding;
     RegisterCompressor<XzCompressor>(
-        "xz", jb::Object(jb::Member(
-                  "preset",
-                  jb::Projection(&XzCompressor::level,
-                                 jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
-                                     [](auto* v) { *v = 6; },
-                                     jb::Integer<uint32_t>(0, 9))))));
+        "xz",
+        jb::Object(
+            jb::Member("preset",
+                       jb::Projection(&XzCompressor::level,
+                                      jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
+                                          [](auto* v) { *v = 6; },
+                                          jb::Integer<uint32_t>(0, 9)))),
+            // TensorStore-specific extension: number of encoding threads.  Not
+            // part of the n5 specification; omitted from the stored metadata
+            // unless explicitly specified.  The encoded stream is a standard
+            // multi-block xz stream regardless.
+            jb::Member("threads",
+                       jb::Projection(&XzCompressor::threads,
+                                      jb::DefaultValue(
+                                          [](auto* v) { *v = 1; },
+                                          jb::Integer<int>(1))))));
   }
 } registration;
 
@@ -46,6 +46,9 @@ TEST(XzCompressionTest, Parse) {
       {{{"type", "xz"}}, {{"type", "xz"}, {"preset", 6}}},
       // Parse with preset option.
       {{{"type", "xz"}, {"preset", 3}}, {{"type", "xz"}, {"preset", 3}}},
+      // Parse with threads option (TensorStore-specific extension).
+      {{{"type", "xz"}, {"threads", 4}},
+       {{"type", "xz"}, {"preset", 6}, {"threads", 4}}},
   });
 
   // Invalid preset option type
@@ -58,6 +61,10 @@ TEST(XzCompressionTest, Parse) {
   EXPECT_THAT(Compressor::FromJson({{"type", "xz"}, {"preset", 10}}),
               MatchesStatus(absl::StatusCode::kInvalidArgument));
 
+  // Invalid threads option value
+  EXPECT_THAT(Compressor::FromJson({{"type", "xz"}, {"threads", 0}}),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+
   // Invalid extra option
   EXPECT_THAT(Compressor::FromJson({{"type", "xz"}, {"extra", "x"}}),
               MatchesStatus(absl::StatusCode::kInvalidArgument));
@@ -35,15 +35,29 @@ struct Registration {
   Registration() {
     RegisterCompressor<ZstdCompressor>(
         "zstd",
-        jb::Object(jb::Member(
-            "level",
-            jb::Projection(
-                &ZstdCompressor::level,
-                jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
-                    [](auto* v) { *v = 0; },
-                    jb::Integer<int>(
-                        ZstdWriterBase::Options::kMinCompressionLevel,
-                        ZstdWriterBase::Options::kMaxCompressionLevel))))));
+        jb::Object(
+            jb::Member(
+                "level",
+                jb::Projection(
+                    &ZstdCompressor::level,
+                    jb::DefaultValue<jb::kAlwaysIncludeDefaults>(
+                        [](auto* v) { *v = 0; },
+                        jb::Integer<int>(
+                            ZstdWriterBase::Options::kMinCompressionLevel,
+                            ZstdWriterBase::Options::kMaxCompressionLevel)))),
+            jb::Member(
+                "window_log",
+                jb::Projection(
+                    &ZstdCompressor::window_log,
+                    jb::DefaultValue(
+                        [](auto* v) { *v = 0; },
+                        jb::Integer<int>(
+                            ZstdWriterBase::Options::kMinWindowLog,
+                            ZstdWriterBase::Options::kMaxWindowLog)))),
+            jb::Member("adaptive",
+                       jb::Projection(&ZstdCompressor::adaptive,
+                                      jb::DefaultValue(
+                                          [](auto* v) { *v = false; })))));
   }
 } registration;
 
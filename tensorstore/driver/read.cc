@@ -14,25 +14,34 @@
 
 #include "tensorstore/driver/read.h"
 
+#include <stdint.h>
+
 #include <atomic>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
 
 #include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/array.h"
 #include "tensorstore/batch.h"
 #include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
 #include "tensorstore/container_kind.h"
 #include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/data_type_conversion.h"
 #include "tensorstore/driver/chunk.h"
+#include "tensorstore/driver/chunk_receiver_utils.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/alignment.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/output_index_method.h"
 #include "tensorstore/index_space/transformed_array.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/lock_collection.h"
@@ -49,7 +58,9 @@
 #include "tensorstore/rank.h"
 #include "tensorstore/read_write_options.h"
 #include "tensorstore/resize_options.h"
+#include "tensorstore/strided_layout.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/dimension_set.h"
 #include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/sender.h"
@@ -57,6 +68,7 @@
 #include "tensorstore/util/extents.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
 
 namespace tensorstore {
@@ -64,6 +76,9 @@ namespace internal {
 
 namespace {
 
+template <typename PromiseValue>
+struct ReadChunkOp;
+
 /// Local state for the asynchronous operation initiated by the two `DriverRead`
 /// overloads.
 ///
@@ -107,16 +122,44 @@ struct ReadState
   TransformedArray<Shared<void>> target;
   DomainAlignmentOptions alignment_options;
   ReadProgressFunction read_progress_function;
+  ReadStatsFunction read_stats_function;
+  std::shared_ptr<AtomicReadProgress> progress_counters;
   Promise<PromiseValue> promise;
   std::atomic<Index> copied_elements{0};
   Index total_elements;
+  Index element_size = 0;
+  absl::Time start_time = absl::InfinitePast();
+  std::atomic<int64_t> first_chunk_ns{0};
+  std::atomic<int64_t> copy_time_ns{0};
+  std::atomic<Index> chunk_count{0};
+  ChunkOpBatchQueue<ReadChunkOp<PromiseValue>> chunk_batch;
   internal_tracing::TraceSpan tspan{"tensorstore.Read"};
 
+  /// The destructor marks the completion of the operation, since `promise`
+  /// becomes ready only once all references to `ReadState` are released.
+  ~ReadState() {
+    if (!read_stats_function.value) return;
+    ReadOperationStats stats;
+    stats.copied_elements = copied_elements.load(std::memory_order_relaxed);
+    stats.copied_bytes = stats.copied_elements * element_size;
+    stats.chunk_count = chunk_count.load(std::memory_order_relaxed);
+    stats.total_time = absl::Now() - start_time;
+    stats.first_chunk_time =
+        absl::Nanoseconds(first_chunk_ns.load(std::memory_order_relaxed));
+    stats.copy_time =
+        absl::Nanoseconds(copy_time_ns.load(std::memory_order_relaxed));
+    read_stats_function.value(std::move(stats));
+  }
+
   void SetError(absl::Status error) {
     SetDeferredResult(promise, std::move(error));
   }
 
   void UpdateProgress(Index num_elements) {
+    if (progress_counters) {
+      progress_counters->copied_elements.fetch_add(num_elements,
+                                                   std::memory_order_relaxed);
+    }
     if (!read_progress_function.value) return;
     read_progress_function.value(
         ReadProgress{total_elements, copied_elements += num_elements});
@@ -131,6 +174,17 @@ struct ReadChunkOp {
   ReadChunk chunk;
   IndexTransform<> cell_transform;
   void operator()() {
+    const bool collect_stats =
+        static_cast<bool>(state->read_stats_function.value);
+    absl::Time copy_start_time = absl::InfinitePast();
+    if (collect_stats) {
+      copy_start_time = absl::Now();
+      int64_t expected = 0;
+      state->first_chunk_ns.compare_exchange_strong(
+          expected,
+          absl::ToInt64Nanoseconds(copy_start_time - state->start_time),
+          std::memory_order_relaxed);
+    }
     // Map the portion of the target array that corresponds to this chunk to
     // the index space expected by the chunk.
     TENSORSTORE_ASSIGN_OR_RETURN(
@@ -141,6 +195,12 @@ struct ReadChunkOp {
         internal::CopyReadChunk(chunk.impl, std::move(chunk.transform),
                                 state->data_type_conversion, target);
     if (copy_status.ok()) {
+      if (collect_stats) {
+        state->copy_time_ns.fetch_add(
+            absl::ToInt64Nanoseconds(absl::Now() - copy_start_time),
+            std::memory_order_relaxed);
+        state->chunk_count.fetch_add(1, std::memory_order_relaxed);
+      }
       state->UpdateProgress(ProductOfExtents(target.shape()));
     } else {
       state->SetError(std::move(copy_status));
@@ -163,9 +223,13 @@ struct ReadChunkReceiver {
   void set_error(absl::Status error) { state->SetError(std::move(error)); }
   void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {
     // Defer all work to the executor, because we don't know on which thread
-    // this may be called.
-    state->executor(ReadChunkOp<PromiseValue>{state, std::move(chunk),
-                                              std::move(cell_transform)});
+    // this may be called.  Dispatches are batched so that a burst of
+    // synchronously-delivered chunks costs one executor dispatch per
+    // `kMaxOpsPerDrain` chunks while still copying concurrently.
+    if (state->chunk_batch.Add(ReadChunkOp<PromiseValue>{
+            state, std::move(chunk), std::move(cell_transform)})) {
+      state->executor([state = state] { state->chunk_batch.Drain(); });
+    }
   }
 };
 
@@ -186,6 +250,10 @@ struct DriverReadIntoExistingInitiateOp {
         static_cast<void>(promise.SetResult(_)));
     state->promise = std::move(promise);
     state->total_elements = source_transform.domain().num_elements();
+    if (state->progress_counters) {
+      state->progress_counters->total_elements.fetch_add(
+          state->total_elements, std::memory_order_relaxed);
+    }
 
     // Initiate the read on the driver.
     auto source_driver = std::move(state->source_driver);
@@ -198,6 +266,33 @@ struct DriverReadIntoExistingInitiateOp {
   }
 };
 
+/// Returns `true` if the input domain of `transform` can be enlarged without
+/// invalidating its output index maps: constant and single-input-dimension
+/// maps remain valid over a larger domain, but index array maps would be
+/// evaluated outside the bounds of the index arrays.
+bool CanExpandInputDomain(IndexTransformView<> transform) {
+  for (DimensionIndex output_dim = 0, output_rank = transform.output_rank();
+       output_dim < output_rank; ++output_dim) {
+    if (transform.output_index_maps()[output_dim].method() ==
+        OutputIndexMethod::array) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Returns a zero-copy view of `array` restricted to `box`.
+///
+/// The element pointer of an offset array addresses position 0 rather than
+/// the origin, so cropping requires only shrinking the domain.
+SharedOffsetArray<void> CropToBox(SharedOffsetArray<void> array,
+                                  BoxView<> box) {
+  assert(Contains(array.domain(), box));
+  StridedLayout<dynamic_rank, offset_origin> layout(box, array.byte_strides());
+  return SharedOffsetArray<void>(std::move(array.element_pointer()),
+                                 std::move(layout));
+}
+
 /// Callback used by `DriverRead` to initiate a read into a new array once the
 /// source transform bounds have been resolved.
 struct DriverReadIntoNewInitiateOp {
@@ -205,6 +300,12 @@ struct DriverReadIntoNewInitiateOp {
   IntrusivePtr<State> state;
   DataType target_dtype;
   ContiguousLayoutOrder target_layout_order;
+  ReadAllocateFunction allocate_function;
+  /// If `align_to_chunks == true`, `requested_box` is the original read
+  /// domain; the transform bounds were marked implicit before resolving, so
+  /// `source_transform` arrives with the full driver domain.
+  Box<> requested_box;
+  bool align_to_chunks;
   void operator()(Promise<SharedOffsetArray<void>> promise,
                   ReadyFuture<IndexTransform<>> source_transform_future) {
     IndexTransform<> source_transform =
@@ -216,12 +317,74 @@ struct DriverReadIntoNewInitiateOp {
       return;
     }
 
-    auto array = AllocateArray(source_transform.domain().box(),
-                               target_layout_order, default_init, target_dtype);
+    if (align_to_chunks) {
+      BoxView<> full_box = source_transform.domain().box();
+      if (!Contains(full_box, requested_box)) {
+        promise.SetResult(absl::OutOfRangeError(tensorstore::StrCat(
+            "Requested read domain ", requested_box,
+            " is not contained within the resolved domain ", full_box)));
+        return;
+      }
+      // Expand the requested domain outward to read-chunk boundaries,
+      // clipped to the driver domain.  Failure to determine the chunk grid
+      // just means no expansion.
+      Box<> aligned_box(requested_box);
+      if (auto layout_result =
+              state->source_driver->GetChunkLayout(source_transform);
+          layout_result.ok()) {
+        if (auto info_result =
+                layout_result->GetReadChunkAlignedBox(requested_box);
+            info_result.ok()) {
+          for (DimensionIndex i = 0; i < aligned_box.rank(); ++i) {
+            aligned_box[i] =
+                Intersect(info_result->aligned_box[i], full_box[i]);
+          }
+        }
+      }
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          source_transform,
+          ComposeTransforms(std::move(source_transform),
+                            IdentityTransform(aligned_box)),
+          static_cast<void>(promise.SetResult(_)));
+    }
+
+    SharedOffsetArray<void> array;
+    if (allocate_function.value) {
+      auto array_result =
+          allocate_function.value(source_transform.domain().box(),
+                                  target_dtype, target_layout_order);
+      if (!array_result.ok()) {
+        promise.SetResult(std::move(array_result).status());
+        return;
+      }
+      array = *std::move(array_result);
+      if (array.dtype() != target_dtype ||
+          array.domain() != source_transform.domain().box()) {
+        promise.SetResult(absl::InvalidArgumentError(tensorstore::StrCat(
+            "Allocate function returned array with dtype ", array.dtype(),
+            " and domain ", array.domain(), ", but dtype ", target_dtype,
+            " and domain ", source_transform.domain().box(),
+            " are required")));
+        return;
+      }
+    } else {
+      array =
+          AllocateArray(source_transform.domain().box(), target_layout_order,
+                        default_init, target_dtype);
+    }
     auto& r = promise.raw_result() = std::move(array);
     state->target = *r;
+    if (align_to_chunks) {
+      // The read fills the chunk-aligned allocation via `state->target`; the
+      // future resolves to a zero-copy crop with the requested domain.
+      *r = CropToBox(*r, requested_box);
+    }
     state->promise = std::move(promise);
     state->total_elements = source_transform.input_domain().num_elements();
+    if (state->progress_counters) {
+      state->progress_counters->total_elements.fetch_add(
+          state->total_elements, std::memory_order_relaxed);
+    }
 
     // Initiate the read on the driver.
     auto source_driver = std::move(state->source_driver);
@@ -235,6 +398,57 @@ struct DriverReadIntoNewInitiateOp {
   }
 };
 
+/// Local state for the asynchronous operation initiated by `DriverPrefetch`.
+///
+/// Chunks are requested exactly as for `DriverRead`, but are simply dropped
+/// once received: a driver backed by a chunk cache fetches the underlying
+/// data in the course of preparing each `ReadChunk`, which is all that
+/// prefetching requires.
+struct PrefetchState : public internal::AtomicReferenceCount<PrefetchState> {
+  DriverPtr source_driver;
+  internal::OpenTransactionPtr source_transaction;
+  Batch source_batch{no_batch};
+  Promise<void> promise;
+  internal_tracing::TraceSpan tspan{"tensorstore.Prefetch"};
+};
+
+/// FlowReceiver used by `DriverPrefetch` that discards received chunks.
+struct PrefetchChunkReceiver {
+  IntrusivePtr<PrefetchState> state;
+  FutureCallbackRegistration cancel_registration;
+  void set_starting(AnyCancelReceiver cancel) {
+    cancel_registration =
+        state->promise.ExecuteWhenNotNeeded(std::move(cancel));
+  }
+  void set_stopping() { cancel_registration(); }
+  void set_done() {}
+  void set_error(absl::Status error) {
+    SetDeferredResult(state->promise, std::move(error));
+  }
+  void set_value(ReadChunk chunk, IndexTransform<> cell_transform) {}
+};
+
+/// Callback used by `DriverPrefetch` to initiate the read once the source
+/// transform bounds have been resolved.
+struct DriverPrefetchInitiateOp {
+  IntrusivePtr<PrefetchState> state;
+  void operator()(Promise<void> promise,
+                  ReadyFuture<IndexTransform<>> source_transform_future) {
+    IndexTransform<> source_transform =
+        std::move(source_transform_future.value());
+    state->promise = std::move(promise);
+
+    // Initiate the read on the driver.
+    auto source_driver = std::move(state->source_driver);
+    Driver::ReadRequest request;
+    request.transaction = std::move(state->source_transaction);
+    request.batch = std::move(state->source_batch);
+    request.transform = std::move(source_transform);
+    source_driver->Read(std::move(request),
+                        PrefetchChunkReceiver{std::move(state)});
+  }
+};
+
 }  // namespace
 
 Future<void> DriverRead(Executor executor, DriverHandle source,
@@ -257,6 +471,12 @@ Future<void> DriverRead(Executor executor, DriverHandle source,
   state->target = std::move(target);
   state->alignment_options = options.alignment_options;
   state->read_progress_function = std::move(options.progress_function);
+  state->read_stats_function = std::move(options.stats_function);
+  state->progress_counters = std::move(options.progress_counters.value);
+  if (state->read_stats_function.value) {
+    state->element_size = state->target.dtype()->size;
+    state->start_time = absl::Now();
+  }
   auto pair = PromiseFuturePair<void>::Make(MakeResult());
 
   // Resolve the bounds for `source.transform`.
@@ -299,8 +519,28 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       internal::AcquireOpenTransactionPtrOrError(source.transaction));
   state->source_batch = std::move(options.batch);
   state->read_progress_function = std::move(options.progress_function);
+  state->progress_counters = std::move(options.progress_counters.value);
   auto pair = PromiseFuturePair<SharedOffsetArray<void>>::Make();
 
+  // If chunk-aligned expansion was requested and the transform domain can be
+  // safely enlarged, mark the bounds implicit so that `ResolveBounds` yields
+  // the full driver domain; the initiate callback then clips the aligned
+  // expansion of `requested_box` against it.
+  Box<> requested_box;
+  bool align_to_chunks = false;
+  if (options.align_read_to_chunks.value) {
+    auto domain = source.transform.domain();
+    if ((domain.implicit_lower_bounds() | domain.implicit_upper_bounds())
+            .none() &&
+        IsFinite(domain.box()) && CanExpandInputDomain(source.transform)) {
+      requested_box = Box<>(domain.box());
+      const DimensionSet all = DimensionSet::UpTo(domain.rank());
+      source.transform =
+          WithImplicitDimensions(std::move(source.transform), all, all);
+      align_to_chunks = true;
+    }
+  }
+
   // Resolve the bounds for `source.transform`.
   Driver::ResolveBoundsRequest request;
   request.transaction = state->source_transaction;
@@ -311,10 +551,12 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       state->source_driver->ResolveBounds(std::move(request));
 
   // Initiate the read once the bounds have been resolved.
-  LinkValue(WithExecutor(std::move(executor),
-                         DriverReadIntoNewInitiateOp{std::move(state),
-                                                     options.target_dtype,
-                                                     options.layout_order}),
+  LinkValue(WithExecutor(
+                std::move(executor),
+                DriverReadIntoNewInitiateOp{
+                    std::move(state), options.target_dtype,
+                    options.layout_order, std::move(options.allocate_function),
+                    std::move(requested_box), align_to_chunks}),
             std::move(pair.promise), std::move(transform_future));
   return std::move(pair.future);
 }
@@ -327,6 +569,81 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
       std::move(executor), std::move(source), {std::move(options), dtype});
 }
 
+Future<void> DriverPrefetch(DriverHandle source, PrefetchOptions options) {
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::ValidateSupportsRead(source.driver.read_write_mode()));
+  auto executor = source.driver->data_copy_executor();
+  IntrusivePtr<PrefetchState> state(new PrefetchState);
+  state->source_driver = std::move(source.driver);
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      state->source_transaction,
+      internal::AcquireOpenTransactionPtrOrError(source.transaction));
+  state->source_batch = std::move(options.batch);
+  auto pair = PromiseFuturePair<void>::Make(MakeResult());
+
+  // Resolve the bounds for `source.transform`.
+  Driver::ResolveBoundsRequest request;
+  request.transaction = state->source_transaction;
+  request.transform = std::move(source.transform);
+  request.options.Set(fix_resizable_bounds).IgnoreError();
+  auto transform_future =
+      state->source_driver->ResolveBounds(std::move(request));
+
+  // Initiate the read once the bounds have been resolved.
+  LinkValue(WithExecutor(std::move(executor),
+                         DriverPrefetchInitiateOp{std::move(state)}),
+            std::move(pair.promise), std::move(transform_future));
+  return std::move(pair.future);
+}
+
+namespace {
+
+/// Returns `true` if elements of `dtype` may be copied with `memcpy`.
+bool IsTriviallyCopyableDataType(DataType dtype) {
+  const DataTypeId id = dtype.id();
+  return id != DataTypeId::custom && id != DataTypeId::string_t &&
+         id != DataTypeId::ustring_t && id != DataTypeId::json_t;
+}
+
+/// Attempts to copy `source` to `target` with a single `memcpy`.
+///
+/// Succeeds only if both iterables are direct views of in-memory arrays of
+/// the same trivially-copyable data type that are contiguous in C order over
+/// `shape`, as is the case for whole-chunk aligned reads with an identity
+/// transform.  Otherwise, returns `false` without copying anything.
+bool TryDirectCopy(const NDIterable& source, const NDIterable& target,
+                   tensorstore::span<const Index> shape) {
+  const DataType dtype = source.dtype();
+  if (dtype != target.dtype() || !IsTriviallyCopyableDataType(dtype)) {
+    return false;
+  }
+  const DimensionIndex rank = shape.size();
+  Index source_byte_strides[kMaxRank];
+  Index target_byte_strides[kMaxRank];
+  const void* source_data = source.GetDirectDataPointer(
+      tensorstore::span<Index>(source_byte_strides, rank));
+  if (!source_data) return false;
+  void* target_data = target.GetDirectDataPointer(
+      tensorstore::span<Index>(target_byte_strides, rank));
+  if (!target_data) return false;
+  Index contiguous_byte_strides[kMaxRank];
+  ComputeStrides(ContiguousLayoutOrder::c, dtype->size, shape,
+                 tensorstore::span<Index>(contiguous_byte_strides, rank));
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    // Strides of size-1 dimensions do not affect the layout.
+    if (shape[i] == 1) continue;
+    if (source_byte_strides[i] != contiguous_byte_strides[i] ||
+        target_byte_strides[i] != contiguous_byte_strides[i]) {
+      return false;
+    }
+  }
+  std::memcpy(target_data, source_data,
+              ProductOfExtents(shape) * dtype->size);
+  return true;
+}
+
+}  // namespace
+
 absl::Status CopyReadChunk(
     ReadChunk::Impl& chunk, IndexTransform<> chunk_transform,
     const DataTypeConversionLookupResult& chunk_conversion,
@@ -344,6 +661,14 @@ absl::Status CopyReadChunk(
       auto source_iterable,
       chunk(ReadChunk::BeginRead{}, std::move(chunk_transform), arena));
 
+  // Fast path: an identity-transform read of a whole contiguous chunk region
+  // with no data type conversion reduces to a single `memcpy`, bypassing
+  // iteration setup entirely.
+  if (!!(chunk_conversion.flags & DataTypeConversionFlags::kIdentity) &&
+      TryDirectCopy(*source_iterable, *target_iterable, target.shape())) {
+    return absl::OkStatus();
+  }
+
   source_iterable = GetConvertedInputNDIterable(
       std::move(source_iterable), target_iterable->dtype(), chunk_conversion);
 
@@ -85,6 +85,18 @@ Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
 Future<SharedOffsetArray<void>> DriverReadIntoNewArray(
     DriverHandle source, ReadIntoNewArrayOptions options);
 
+/// Fetches the data that would be read by `DriverRead`, without copying it
+/// anywhere.
+///
+/// For drivers backed by a chunk cache, this populates the cache, so that a
+/// subsequent read of the same region is satisfied without additional I/O
+/// (subject to the configured staleness bounds and cache pool limits).
+///
+/// \param source Source TensorStore.
+/// \returns A future that becomes ready when all chunks have been fetched or
+///     an error occurs.
+Future<void> DriverPrefetch(DriverHandle source, PrefetchOptions options);
+
 /// Copies `chunk` transformed by `chunk_transform` to `target`.
 absl::Status CopyReadChunk(
     ReadChunk::Impl& chunk, IndexTransform<> chunk_transform,
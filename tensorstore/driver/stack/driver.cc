@@ -27,11 +27,13 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
-#include "absl/hash/hash.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
-#include "tensorstore/box.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/batch.h"
 #include "tensorstore/context.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/chunk.h"
@@ -58,6 +60,8 @@
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/internal/json_binding/staleness_bound.h"  // IWYU pragma: keep
 #include "tensorstore/internal/json_binding/std_array.h"  // IWYU pragma: keep
+#include "tensorstore/internal/metrics/histogram.h"
+#include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/tagged_ptr.h"
 #include "tensorstore/internal/type_traits.h"
 #include "tensorstore/open_mode.h"
@@ -150,49 +154,184 @@ struct StackLayer {
 
 namespace jb = tensorstore::internal_json_binding;
 
-/// Used to index individual cells
-struct Cell {
-  std::vector<Index> points;
-
-  Cell(std::vector<Index> data) : points(std::move(data)) {}
-  Cell(tensorstore::span<const Index> data)
-      : points(data.begin(), data.end()) {}
-
-  tensorstore::span<const Index> as_span() const {
-    return tensorstore::span<const Index>(points);
+auto& stack_grid_index_build_time_ms =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
+        "/tensorstore/stack/grid_index_build_time_ms",
+        internal_metrics::MetricMetadata(
+            "Time to build the layer grid index when opening a \"stack\" "
+            "driver",
+            internal_metrics::Units::kMilliseconds));
+
+auto& stack_planning_time_ms =
+    internal_metrics::Histogram<internal_metrics::DefaultBucketer>::New(
+        "/tensorstore/stack/planning_time_ms",
+        internal_metrics::MetricMetadata(
+            "Time to partition a \"stack\" driver read/write into per-layer "
+            "operations",
+            internal_metrics::Units::kMilliseconds));
+
+/// Static spatial index mapping grid cells to the topmost layer covering them.
+///
+/// Each layer covers a contiguous range of cells along each dimension of the
+/// `IrregularGrid`.  The per-layer cell ranges are packed into an R-tree
+/// (bulk-loaded by sorting the ranges lexicographically by their origins), so
+/// that resolving a cell to its layer is logarithmic rather than linear in the
+/// number of layers, and construction is `O(n log n)` in the number of layers
+/// rather than proportional to the total number of covered cells, which grows
+/// quadratically (or worse) when layer boundaries are unaligned, as in large
+/// image mosaics.
+class LayerCellIndex {
+ public:
+  /// Builds the index.  `starts` and `ends` specify for each layer the
+  /// inclusive grid cell bounds along each dimension; both have
+  /// `num_layers * rank` elements.
+  void Build(DimensionIndex rank, size_t num_layers,
+             tensorstore::span<const Index> starts,
+             tensorstore::span<const Index> ends) {
+    assert(starts.size() == static_cast<ptrdiff_t>(num_layers * rank));
+    assert(ends.size() == static_cast<ptrdiff_t>(num_layers * rank));
+    rank_ = rank;
+    num_layers_ = num_layers;
+    layer_starts_.assign(starts.begin(), starts.end());
+    layer_ends_.assign(ends.begin(), ends.end());
+    layer_order_.clear();
+    nodes_.clear();
+    node_bounds_.clear();
+    if (num_layers == 0 || rank == 0) return;
+    layer_order_.resize(num_layers);
+    std::iota(layer_order_.begin(), layer_order_.end(), size_t{0});
+    std::sort(layer_order_.begin(), layer_order_.end(),
+              [&](size_t a, size_t b) {
+                for (DimensionIndex dim = 0; dim < rank; ++dim) {
+                  const Index sa = layer_starts_[a * rank + dim];
+                  const Index sb = layer_starts_[b * rank + dim];
+                  if (sa != sb) return sa < sb;
+                }
+                return a < b;
+              });
+    // Build the leaf level, then interior levels until one root remains.
+    size_t level_begin = 0;
+    for (size_t i = 0; i < num_layers; i += kFanout) {
+      AddNode(i, std::min(i + kFanout, num_layers), /*height=*/0);
+    }
+    size_t height = 1;
+    size_t level_end = nodes_.size();
+    while (level_end - level_begin > 1) {
+      for (size_t i = level_begin; i < level_end; i += kFanout) {
+        AddNode(i, std::min(i + kFanout, level_end), height);
+      }
+      level_begin = level_end;
+      level_end = nodes_.size();
+      ++height;
+    }
   }
-};
 
-struct CellHash {
-  using is_transparent = void;
-
-  size_t operator()(tensorstore::span<const Index> v) const {
-    return absl::Hash<tensorstore::span<const Index>>{}(v);
-  }
-  size_t operator()(const Cell& v) const {
-    return absl::Hash<tensorstore::span<const Index>>{}(v.as_span());
+  /// Returns the index of the topmost (highest-numbered) layer whose cell
+  /// range contains `cell`, or -1 if no layer contains it.  Later layers take
+  /// precedence, matching the order in which layers are specified.
+  ptrdiff_t QueryTopmostLayer(tensorstore::span<const Index> cell) const {
+    if (num_layers_ == 0) return -1;
+    // A rank-0 grid consists of a single cell covered by every layer.
+    if (rank_ == 0) return static_cast<ptrdiff_t>(num_layers_) - 1;
+    assert(cell.size() == rank_);
+    ptrdiff_t best = -1;
+    absl::InlinedVector<size_t, 2 * kFanout> stack;
+    stack.push_back(nodes_.size() - 1);
+    while (!stack.empty()) {
+      const size_t node_i = stack.back();
+      stack.pop_back();
+      const Node& node = nodes_[node_i];
+      // A subtree whose highest layer does not exceed the best match found so
+      // far cannot affect the result.
+      if (static_cast<ptrdiff_t>(node.max_layer) <= best) continue;
+      if (!Contains(node_bounds_.data() + node_i * 2 * rank_, cell)) continue;
+      if (node.height == 0) {
+        for (size_t i = node.begin; i < node.end; ++i) {
+          const size_t layer_i = layer_order_[i];
+          if (static_cast<ptrdiff_t>(layer_i) > best &&
+              Contains(layer_starts_.data() + layer_i * rank_,
+                       layer_ends_.data() + layer_i * rank_, cell)) {
+            best = static_cast<ptrdiff_t>(layer_i);
+          }
+        }
+      } else {
+        for (size_t i = node.begin; i < node.end; ++i) stack.push_back(i);
+      }
+    }
+    return best;
   }
-};
 
-struct CellEq {
-  using is_transparent = void;
+ private:
+  // Maximum number of children per node.
+  constexpr static size_t kFanout = 16;
+
+  struct Node {
+    // Range of children: indices into `nodes_` for interior nodes
+    // (`height > 0`), or into `layer_order_` for leaf nodes (`height == 0`).
+    size_t begin;
+    size_t end;
+    // Highest layer index within the subtree, used for pruning.
+    size_t max_layer;
+    size_t height;
+  };
 
-  bool operator()(const Cell& a, tensorstore::span<const Index> b) const {
-    return std::equal(a.as_span().begin(), a.as_span().end(), b.begin(),
-                      b.end());
-  }
-  bool operator()(tensorstore::span<const Index> a, const Cell& b) const {
-    return std::equal(a.begin(), a.end(), b.as_span().begin(),
-                      b.as_span().end());
+  static bool Contains(const Index* lower, const Index* upper,
+                       tensorstore::span<const Index> cell) {
+    for (ptrdiff_t dim = 0; dim < cell.size(); ++dim) {
+      if (cell[dim] < lower[dim] || cell[dim] > upper[dim]) return false;
+    }
+    return true;
   }
-  bool operator()(const Cell& a, const Cell& b) const {
-    return std::equal(a.as_span().begin(), a.as_span().end(),
-                      b.as_span().begin(), b.as_span().end());
+  bool Contains(const Index* bounds, tensorstore::span<const Index> cell) const {
+    return Contains(bounds, bounds + rank_, cell);
   }
-  bool operator()(tensorstore::span<const Index> a,
-                  tensorstore::span<const Index> b) const {
-    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+
+  // Appends a node covering children `[begin, end)` of the level below
+  // `height` (layers for `height == 0`), computing its bounds and `max_layer`.
+  void AddNode(size_t begin, size_t end, size_t height) {
+    Node node{begin, end, /*max_layer=*/0, height};
+    const size_t bounds_i = node_bounds_.size();
+    node_bounds_.resize(bounds_i + 2 * rank_);
+    Index* lower = node_bounds_.data() + bounds_i;
+    Index* upper = lower + rank_;
+    std::fill_n(lower, rank_, kInfIndex);
+    std::fill_n(upper, rank_, -kInfIndex);
+    for (size_t i = begin; i < end; ++i) {
+      const Index* child_lower;
+      const Index* child_upper;
+      size_t child_max_layer;
+      if (height == 0) {
+        const size_t layer_i = layer_order_[i];
+        child_lower = layer_starts_.data() + layer_i * rank_;
+        child_upper = layer_ends_.data() + layer_i * rank_;
+        child_max_layer = layer_i;
+      } else {
+        child_lower = node_bounds_.data() + i * 2 * rank_;
+        child_upper = child_lower + rank_;
+        child_max_layer = nodes_[i].max_layer;
+      }
+      for (DimensionIndex dim = 0; dim < rank_; ++dim) {
+        lower[dim] = std::min(lower[dim], child_lower[dim]);
+        upper[dim] = std::max(upper[dim], child_upper[dim]);
+      }
+      node.max_layer = std::max(node.max_layer, child_max_layer);
+    }
+    nodes_.push_back(node);
   }
+
+  DimensionIndex rank_ = 0;
+  size_t num_layers_ = 0;
+  // Inclusive per-dimension cell bounds for each layer, `rank_` values per
+  // layer.
+  std::vector<Index> layer_starts_;
+  std::vector<Index> layer_ends_;
+  // Layer indices in tree order; leaf nodes reference ranges of this array.
+  std::vector<size_t> layer_order_;
+  // Tree nodes, leaves first, root last.
+  std::vector<Node> nodes_;
+  // Bounding boxes of the nodes: `2 * rank_` values per node, inclusive min
+  // bounds followed by inclusive max bounds.
+  std::vector<Index> node_bounds_;
 };
 
 // Certain operations are applied to either a sequence of
@@ -514,7 +653,7 @@ class StackDriver
   IndexDomain<> layer_domain_;
   IrregularGrid grid_;
 
-  absl::flat_hash_map<Cell, size_t, CellHash, CellEq> grid_to_layer_;
+  LayerCellIndex layer_cell_index_;
 };
 
 Result<internal::Driver::Handle> MakeStackDriverHandle(
@@ -564,42 +703,38 @@ Future<internal::Driver::Handle> StackDriverSpec::Open(
 }
 
 /// The mechanism used here is to construct an irregular grid based on
-/// each layer's effective transform, and then, for each of those grid
-/// points, store the layer associated with the bounding rectangle.
-///
-/// If this becomes a problem, we may want to consider constructing
-/// an R-tree variant using the layer MBRs to restrict the query space,
-/// then applying a similar gridding decomposition to the read transforms.
+/// each layer's effective transform, and then build an R-tree over the range
+/// of grid cells covered by each layer.  Resolving a grid cell to the topmost
+/// layer covering it is then logarithmic in the number of layers, and the
+/// construction cost is independent of the total number of covered cells.
 absl::Status StackDriver::InitializeGridIndices(
     tensorstore::span<const IndexDomain<>> domains) {
   assert(domains.size() == layers_.size());
+  const absl::Time build_start = absl::Now();
   grid_ =
       IrregularGrid::Make(layers_.empty() ? tensorstore::span(&layer_domain_, 1)
                                           : tensorstore::span(domains));
 
-  Index start[kMaxRank];
-  Index shape[kMaxRank];
   const DimensionIndex rank = grid_.rank();
+  std::vector<Index> starts(domains.size() * rank);
+  std::vector<Index> ends(domains.size() * rank);
   for (size_t layer_i = 0; layer_i < domains.size(); layer_i++) {
     auto& d = domains[layer_i];
     for (DimensionIndex dim = 0; dim < rank; dim++) {
-      start[dim] = grid_(dim, d[dim].inclusive_min(), nullptr);
-      shape[dim] = 1 + grid_(dim, d[dim].inclusive_max(), nullptr) - start[dim];
+      starts[layer_i * rank + dim] =
+          grid_(dim, d[dim].inclusive_min(), nullptr);
+      ends[layer_i * rank + dim] = grid_(dim, d[dim].inclusive_max(), nullptr);
     }
-    // Set the mapping for all irregular grid cell covered by this layer
-    // to point to this layer.
-    IterateOverIndexRange<>(
-        BoxView<>(rank, start, shape),
-        [layer_i, this](tensorstore::span<const Index> key) {
-          grid_to_layer_[key] = layer_i;
-        });
   }
+  layer_cell_index_.Build(rank, domains.size(), starts, ends);
+  stack_grid_index_build_time_ms.Observe(
+      absl::ToInt64Milliseconds(absl::Now() - build_start));
 
 #if !defined(NDEBUG)
   // Log the missing cells.
   IterateOverIndexRange<>(
       grid_.shape(), [this](tensorstore::span<const Index> key) {
-        if (auto it = grid_to_layer_.find(key); it == grid_to_layer_.end()) {
+        if (layer_cell_index_.QueryTopmostLayer(key) == -1) {
           ABSL_LOG(INFO) << "\"stack\" driver missing grid cell: " << key;
         }
       });
@@ -728,13 +863,15 @@ struct OpenLayerOp {
 
     UnmappedOpType unmapped{self};
     absl::flat_hash_map<size_t, std::vector<IndexTransform<>>> layers_to_load;
+    const absl::Time planning_start = absl::Now();
     auto status = tensorstore::internal::PartitionIndexTransformOverGrid(
         dimension_order, self->grid_, state->request.transform,
         [&](tensorstore::span<const Index> grid_cell_indices,
             IndexTransformView<> cell_transform) {
-          auto it = self->grid_to_layer_.find(grid_cell_indices);
-          if (it != self->grid_to_layer_.end()) {
-            const size_t layer_i = it->second;
+          const ptrdiff_t match =
+              self->layer_cell_index_.QueryTopmostLayer(grid_cell_indices);
+          if (match != -1) {
+            const size_t layer_i = static_cast<size_t>(match);
             const auto& layer = self->layers_[layer_i];
             if (layer.driver) {
               // Layer is already open, dispatch operation directly.
@@ -745,13 +882,15 @@ struct OpenLayerOp {
                   tensorstore::MaybeAnnotateStatus(
                       _, absl::StrFormat("Layer %d", layer_i)));
             } else {
-              layers_to_load[it->second].emplace_back(cell_transform);
+              layers_to_load[layer_i].emplace_back(cell_transform);
             }
             return absl::OkStatus();
           } else {
             return unmapped(grid_cell_indices, cell_transform);
           }
         });
+    stack_planning_time_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - planning_start));
     if (!status.ok()) {
       state->SetError(std::move(status));
       return;
@@ -760,13 +899,31 @@ struct OpenLayerOp {
       return;
     }
 
+    // All layer opens share a single batch, so that reads issued while
+    // opening (e.g. metadata and attribute files) are coalesced across
+    // layers rather than dispatched individually; for a large mosaic this
+    // turns thousands of small metadata reads into a few batched requests.
+    // A caller-supplied read batch is reused, so that layer opens also
+    // coalesce with any other operations in that batch.
+    Batch layer_open_batch{no_batch};
+    if constexpr (std::is_same_v<typename StateType::RequestType,
+                                 internal::Driver::ReadRequest>) {
+      layer_open_batch = state->request.batch;
+    }
+    if (!layer_open_batch && layers_to_load.size() > 1) {
+      layer_open_batch = Batch::New();
+    }
+
     // Open each layer and invoke OpType for all corresponding cell
-    // transforms.
+    // transforms.  Only layers intersecting the request are opened; the
+    // remaining layers stay closed since their domains are fully determined
+    // by the spec.
     for (auto& kv : layers_to_load) {
       const size_t layer_i = kv.first;
       const auto& layer = self->layers_[layer_i];
       internal::DriverOpenRequest request;
       request.transaction = state->request.transaction;
+      request.batch = layer_open_batch;
       request.read_write_mode = StateType::kMode;
       Link(WithExecutor(
                self->data_copy_executor(),
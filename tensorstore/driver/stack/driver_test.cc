@@ -27,6 +27,7 @@
 #include <nlohmann/json.hpp>
 #include "tensorstore/array.h"
 #include "tensorstore/array_testutil.h"
+#include "tensorstore/batch.h"
 #include "tensorstore/box.h"
 #include "tensorstore/context.h"
 #include "tensorstore/data_type.h"
@@ -238,6 +239,26 @@ TEST(StackDriverTest, Read) {
   }
 }
 
+TEST(StackDriverTest, ReadWithBatch) {
+  ::nlohmann::json json_spec{
+      {"driver", "stack"},
+      {"layers", ::nlohmann::json::array_t({GetRank1Length4ArrayDriver(-3),
+                                            GetRank1Length4ArrayDriver(0),
+                                            GetRank1Length4ArrayDriver(3, 6)})},
+  };
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   tensorstore::Open(json_spec).result());
+
+  // Layer opens triggered by the read are funneled through the supplied
+  // batch.
+  auto batch = tensorstore::Batch::New();
+  auto future = tensorstore::Read<tensorstore::zero_origin>(store, batch);
+  batch.Release();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto array, future.result());
+  EXPECT_THAT(array, MatchesArray<int32_t>({1, 2, 3, 1, 2, 3, 1, 2, 3}));
+}
+
 TEST(StackDriverTest, ReadSparse) {
   ::nlohmann::json json_spec{
       {"driver", "stack"},
@@ -27,9 +27,12 @@
 
 #include "absl/base/optimization.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/array.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/batch_impl.h"
 #include "tensorstore/box.h"
 #include "tensorstore/chunk_layout.h"
 #include "tensorstore/codec_spec.h"
@@ -167,6 +170,8 @@ class VirtualChunkedCache : public internal::ConcreteChunkCache {
 
   ReadFunction read_function_;
 
+  BatchReadFunction batch_read_function_;
+
   WriteFunction write_function_;
 
   Context::Resource<internal::DataCopyConcurrencyResource>
@@ -224,16 +229,184 @@ bool GetPermutedPartialArray(
   return true;
 }
 
+/// Quantum for converting the measured cost of a read function call into
+/// eviction-cost credits: one credit per 10ms of compute time, so a chunk
+/// that takes 200ms to regenerate receives 20 credits while trivially
+/// recomputed chunks remain subject to plain LRU.
+constexpr absl::Duration kEvictionCostQuantum = absl::Milliseconds(10);
+
+/// Applies the result of a read function call to `node`, which must remain
+/// valid until `ReadSuccess` or `ReadError` is called.
+///
+/// `compute_time` is the measured cost of the read function call that
+/// produced the chunk, used to preferentially retain costly-to-regenerate
+/// chunks in the cache pool.
+template <typename EntryOrNode>
+void CompleteChunkRead(
+    EntryOrNode& node, const Result<TimestampedStorageGeneration>& result,
+    std::shared_ptr<VirtualChunkedCache::ReadData> read_data,
+    absl::Duration compute_time) {
+  if (!result.ok()) {
+    node.ReadError(result.status());
+    return;
+  }
+  GetOwningEntry(node).SetEvictionCost(
+      static_cast<size_t>(absl::FDivDuration(compute_time,
+                                             kEvictionCostQuantum)));
+  if (StorageGeneration::IsUnknown(result->generation)) {
+    // Ignore read_data
+    internal::AsyncCache::ReadState read_state;
+    {
+      internal::AsyncCache::ReadLock<VirtualChunkedCache::ReadData> lock{node};
+      read_state = lock.read_state();
+    }
+    read_state.stamp.time = result->time;
+    node.ReadSuccess(std::move(read_state));
+    return;
+  }
+  node.ReadSuccess({std::move(read_data), *result});
+}
+
+/// Aggregates the chunk reads issued within a single `Batch` for a given
+/// cache, so that `batch_read_function_` is invoked just once for all of the
+/// chunks, amortizing per-call overhead (which can be significant, e.g. when
+/// the function dispatches to Python).
+class BatchReadEntry : public Batch::Impl::Entry {
+ public:
+  using KeyParam = VirtualChunkedCache*;
+
+  explicit BatchReadEntry(VirtualChunkedCache& cache)
+      : Batch::Impl::Entry(/*nesting_depth=*/0), cache_(&cache) {}
+
+  VirtualChunkedCache* key() const { return cache_.get(); }
+
+  // Registers a chunk read with the batch entry for `request.batch`, creating
+  // it if necessary.  The batch cannot be submitted before this returns,
+  // because the caller necessarily holds a batch reference.
+  template <typename EntryOrNode>
+  static void MakeRequest(
+      VirtualChunkedCache& cache, EntryOrNode& node,
+      const internal::AsyncCache::AsyncCacheReadRequest& request) {
+    Batch::Impl::From(request.batch)
+        ->GetEntry<BatchReadEntry>(
+            &cache, [&] { return std::make_unique<BatchReadEntry>(cache); })
+        .AddRequest(request.staleness_bound,
+                    PendingRead{&node, &GetOwningEntry(node),
+                                &CompletePendingRead<EntryOrNode>});
+  }
+
+  // Invoked exactly once, when the batch is submitted; responsible for
+  // destroying the entry.
+  void Submit(Batch::View batch) override {
+    auto& executor = cache_->executor();
+    executor([self = std::unique_ptr<BatchReadEntry>(this)] {
+      self->DoBatchRead();
+    });
+  }
+
+ private:
+  using ReadData = VirtualChunkedCache::ReadData;
+
+  // Pending chunk read, with the target entry or transaction node type-erased.
+  struct PendingRead {
+    void* entry_or_node;
+    VirtualChunkedCache::Entry* chunk_entry;
+    void (*complete)(void* entry_or_node,
+                     const Result<TimestampedStorageGeneration>& result,
+                     std::shared_ptr<ReadData> read_data,
+                     absl::Duration compute_time);
+  };
+
+  template <typename EntryOrNode>
+  static void CompletePendingRead(
+      void* entry_or_node, const Result<TimestampedStorageGeneration>& result,
+      std::shared_ptr<ReadData> read_data, absl::Duration compute_time) {
+    CompleteChunkRead(*static_cast<EntryOrNode*>(entry_or_node), result,
+                      std::move(read_data), compute_time);
+  }
+
+  void AddRequest(absl::Time staleness_bound, PendingRead&& pending) {
+    absl::MutexLock lock(&mutex_);
+    staleness_bound_ = std::max(staleness_bound_, staleness_bound);
+    pending_.push_back(std::move(pending));
+  }
+
+  void DoBatchRead() {
+    // No further requests can be added once the batch has been submitted;
+    // `mutex_` is not needed.
+    auto& cache = *cache_;
+    const auto& component_spec = cache.grid().components.front();
+    span<const Index> cell_shape = component_spec.shape();
+    std::vector<Array<void, dynamic_rank, offset_origin>> chunk_arrays;
+    chunk_arrays.reserve(pending_.size());
+    std::vector<std::pair<PendingRead, std::shared_ptr<ReadData>>> completions;
+    completions.reserve(pending_.size());
+    for (auto& pending : pending_) {
+      auto full_array = AllocateArray(cell_shape, c_order, default_init,
+                                      component_spec.dtype());
+      Array<const void, dynamic_rank, offset_origin> partial_array;
+      auto read_data =
+          tensorstore::internal::make_shared_for_overwrite<ReadData[]>(1);
+      if (!GetPermutedPartialArray(*pending.chunk_entry, full_array,
+                                   partial_array)) {
+        pending.complete(
+            pending.entry_or_node,
+            TimestampedStorageGeneration{StorageGeneration::NoValue(),
+                                         absl::InfiniteFuture()},
+            std::move(read_data), absl::ZeroDuration());
+        continue;
+      }
+      read_data.get()[0] = std::move(full_array);
+      chunk_arrays.push_back(ConstDataTypeCast<void>(std::move(partial_array)));
+      completions.emplace_back(pending, std::move(read_data));
+    }
+    if (chunk_arrays.empty()) return;
+    ReadParameters read_params;
+    read_params.executor_ = cache.executor();
+    // `if_not_equal_` is left unspecified: a single generation applies to the
+    // entire batch, so per-chunk generation conditions cannot be used.
+    read_params.staleness_bound_ = staleness_bound_;
+    const absl::Time start_time = absl::Now();
+    auto read_future =
+        cache.batch_read_function_(chunk_arrays, std::move(read_params));
+    read_future.Force();
+    read_future.ExecuteWhenReady(
+        [completions = std::move(completions), start_time](
+            ReadyFuture<TimestampedStorageGeneration> future) mutable {
+          // Attribute the cost of the batched call evenly to its chunks.
+          const absl::Duration compute_time =
+              (absl::Now() - start_time) /
+              static_cast<int64_t>(completions.size());
+          for (auto& [pending, read_data] : completions) {
+            pending.complete(pending.entry_or_node, future.result(),
+                             std::move(read_data), compute_time);
+          }
+        });
+  }
+
+  internal::CachePtr<VirtualChunkedCache> cache_;
+  absl::Mutex mutex_;
+  absl::Time staleness_bound_ = absl::InfinitePast();
+  std::vector<PendingRead> pending_;
+};
+
 template <typename EntryOrNode>
 void VirtualChunkedCache::DoRead(EntryOrNode& node,
                                  AsyncCacheReadRequest request) {
   auto& cache = GetOwningCache(node);
-  if (!cache.read_function_) {
+  if (!cache.read_function_ && !cache.batch_read_function_) {
     // Normally happens only in the case of a partial chunk write.
     node.ReadError(absl::InvalidArgumentError(
         "Write-only virtual chunked view requires chunk-aligned writes"));
     return;
   }
+  if (cache.batch_read_function_ && request.batch.deferred()) {
+    // Defer the read until the batch is submitted, so that all of the chunks
+    // read using the batch are computed by a single call to
+    // `batch_read_function_`.
+    BatchReadEntry::MakeRequest(cache, node, request);
+    return;
+  }
   auto& executor = cache.executor();
   // `node` is guaranteed to remain valid until `ReadSuccess` or `ReadError`
   // is called.  Therefore we don't need to separately hold a reference.
@@ -262,36 +435,25 @@ void VirtualChunkedCache::DoRead(EntryOrNode& node,
     read_data.get()[0] = full_array;
     ReadParameters read_params;
     read_params.executor_ = cache.executor();
-    {
+    if (cache.read_function_) {
       ReadLock<ReadData> lock{node};
       read_params.if_not_equal_ = lock.stamp().generation;
     }
     read_params.staleness_bound_ = staleness_bound;
+    auto chunk_array = ConstDataTypeCast<void>(std::move(partial_array));
+    const absl::Time start_time = absl::Now();
     auto read_future =
-        cache.read_function_(ConstDataTypeCast<void>(std::move(partial_array)),
-                             std::move(read_params));
+        cache.read_function_
+            ? cache.read_function_(std::move(chunk_array),
+                                   std::move(read_params))
+            : cache.batch_read_function_(span(&chunk_array, 1),
+                                         std::move(read_params));
     read_future.Force();
     read_future.ExecuteWhenReady(
-        [&node, read_data = std::move(read_data)](
+        [&node, read_data = std::move(read_data), start_time](
             ReadyFuture<TimestampedStorageGeneration> future) mutable {
-          auto& r = future.result();
-          if (!r.ok()) {
-            node.ReadError(std::move(r).status());
-            return;
-          }
-          if (StorageGeneration::IsUnknown(r->generation)) {
-            // Ignore read_data
-            ReadState read_state;
-            {
-              ReadLock<ReadData> lock{node};
-              read_state = lock.read_state();
-            }
-            read_state.stamp.time = r->time;
-            node.ReadSuccess(std::move(read_state));
-            return;
-          }
-          node.ReadSuccess({std::move(read_data), std::move(*r)});
-          return;
+          CompleteChunkRead(node, future.result(), std::move(read_data),
+                            absl::Now() - start_time);
         });
   });
 }
@@ -388,6 +550,7 @@ class VirtualChunkedDriverSpec
   constexpr static const char id[] = "virtual_chunked";
 
   std::optional<ReadFunction> read_function;
+  std::optional<BatchReadFunction> batch_read_function;
   std::optional<WriteFunction> write_function;
   Context::Resource<internal::DataCopyConcurrencyResource>
       data_copy_concurrency;
@@ -396,8 +559,8 @@ class VirtualChunkedDriverSpec
 
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
     return f(internal::BaseCast<internal::DriverSpec>(x), x.read_function,
-             x.write_function, x.data_copy_concurrency, x.cache_pool,
-             x.data_staleness);
+             x.batch_read_function, x.write_function, x.data_copy_concurrency,
+             x.cache_pool, x.data_staleness);
   };
 
   OpenMode open_mode() const override {
@@ -478,6 +641,9 @@ Result<internal::TransformedDriverSpec> VirtualChunkedDriver::GetBoundSpec(
   if (cache.read_function_) {
     driver_spec->read_function = cache.read_function_;
   }
+  if (cache.batch_read_function_) {
+    driver_spec->batch_read_function = cache.batch_read_function_;
+  }
   if (cache.write_function_) {
     driver_spec->write_function = cache.write_function_;
   }
@@ -550,8 +716,14 @@ Result<internal::TransformedDriverSpec> VirtualChunkedDriver::GetBoundSpec(
 Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
     Transaction transaction, const VirtualChunkedDriverSpec& spec,
     ReadWriteMode read_write_mode) {
+  if (spec.read_function && spec.batch_read_function) {
+    return absl::InvalidArgumentError(
+        "read_function and batch_read_function cannot both be specified");
+  }
+  const bool has_read_function =
+      spec.read_function.has_value() || spec.batch_read_function.has_value();
   if ((read_write_mode & ReadWriteMode::read) == ReadWriteMode::read &&
-      !spec.read_function) {
+      !has_read_function) {
     return absl::InvalidArgumentError("Reading not supported");
   }
   if ((read_write_mode & ReadWriteMode::write) == ReadWriteMode::write &&
@@ -560,7 +732,7 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
   }
   if (read_write_mode == ReadWriteMode::dynamic) {
     read_write_mode =
-        (spec.read_function ? ReadWriteMode::read : ReadWriteMode{}) |
+        (has_read_function ? ReadWriteMode::read : ReadWriteMode{}) |
         (spec.write_function ? ReadWriteMode::write : ReadWriteMode{});
   }
 
@@ -678,6 +850,9 @@ Result<internal::Driver::Handle> VirtualChunkedDriver::OpenFromSpecData(
         if (spec.read_function) {
           cache->read_function_ = *spec.read_function;
         }
+        if (spec.batch_read_function) {
+          cache->batch_read_function_ = *spec.batch_read_function;
+        }
         if (spec.write_function) {
           cache->write_function_ = *spec.write_function;
         }
@@ -737,6 +912,33 @@ Result<internal::Driver::Handle> MakeDriver(
   return VirtualChunkedDriver::OpenFromSpecData(std::move(options.transaction),
                                                 spec);
 }
+
+Result<internal::Driver::Handle> MakeBatchDriver(
+    virtual_chunked::BatchReadFunction batch_read_function,
+    OpenOptions&& options) {
+  VirtualChunkedDriverSpec spec;
+  spec.batch_read_function = std::move(batch_read_function);
+  spec.schema = static_cast<Schema&&>(options);
+
+  if (!options.context) {
+    options.context = Context::Default();
+  }
+
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      spec.cache_pool,
+      options.context.GetResource<internal::CachePoolResource>());
+
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      spec.data_copy_concurrency,
+      options.context.GetResource<internal::DataCopyConcurrencyResource>());
+
+  if (options.recheck_cached_data.specified()) {
+    spec.data_staleness = StalenessBound(options.recheck_cached_data);
+  }
+
+  return VirtualChunkedDriver::OpenFromSpecData(std::move(options.transaction),
+                                                spec);
+}
 }  // namespace internal_virtual_chunked
 }  // namespace virtual_chunked
 
@@ -747,6 +949,8 @@ struct GarbageCollection<virtual_chunked::VirtualChunkedDriver> {
                     const virtual_chunked::VirtualChunkedDriver& value) {
     garbage_collection::GarbageCollectionVisit(visitor,
                                                value.cache()->read_function_);
+    garbage_collection::GarbageCollectionVisit(
+        visitor, value.cache()->batch_read_function_);
     garbage_collection::GarbageCollectionVisit(visitor,
                                                value.cache()->write_function_);
   }
@@ -14,6 +14,7 @@
 
 #include "tensorstore/virtual_chunked.h"
 
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/array.h"
+#include "tensorstore/batch.h"
 #include "tensorstore/chunk_layout.h"
 #include "tensorstore/context.h"
 #include "tensorstore/data_type.h"
@@ -582,4 +584,68 @@ TEST(VirtualChunkedTest, NonAtomicSingleChunk) {
   TENSORSTORE_ASSERT_OK(future);
 }
 
+// Returns a batched view equivalent to `CoordinatesView(0, ...)`, counting
+// the number of batch read function calls and total chunks received.
+template <typename... Option>
+Result<tensorstore::TensorStore<Index, dynamic_rank,
+                                tensorstore::ReadWriteMode::read>>
+BatchedCoordinatesView(std::atomic<int>& call_count,
+                       std::atomic<int>& chunk_count, Option&&... option) {
+  return tensorstore::VirtualChunkedBatched<Index>(
+      tensorstore::NonSerializable{
+          [&call_count, &chunk_count](auto outputs, auto read_params)
+              -> Future<TimestampedStorageGeneration> {
+            ++call_count;
+            for (const auto& output : outputs) {
+              ++chunk_count;
+              tensorstore::IterateOverIndexRange(
+                  output.domain(), [&](span<const Index> indices) {
+                    output(indices) = indices[0];
+                  });
+            }
+            return TimestampedStorageGeneration{
+                StorageGeneration::FromString(""), absl::Now()};
+          }},
+      std::forward<Option>(option)...);
+}
+
+TEST(VirtualChunkedTest, BatchedRead) {
+  std::atomic<int> call_count{0};
+  std::atomic<int> chunk_count{0};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, BatchedCoordinatesView(
+                      call_count, chunk_count, tensorstore::Schema::Shape({8}),
+                      tensorstore::ChunkLayout::ChunkShape({2})));
+  auto batch = tensorstore::Batch::New();
+  auto future0 = tensorstore::Read<tensorstore::zero_origin>(
+      store | tensorstore::Dims(0).HalfOpenInterval(0, 4), batch);
+  auto future1 = tensorstore::Read<tensorstore::zero_origin>(
+      store | tensorstore::Dims(0).HalfOpenInterval(4, 8), batch);
+  batch.Release();
+  EXPECT_THAT(
+      future0.result(),
+      ::testing::Optional(tensorstore::MakeArray<Index>({0, 1, 2, 3})));
+  EXPECT_THAT(
+      future1.result(),
+      ::testing::Optional(tensorstore::MakeArray<Index>({4, 5, 6, 7})));
+  // All 4 chunks are computed by a single call.
+  EXPECT_EQ(1, call_count);
+  EXPECT_EQ(4, chunk_count);
+}
+
+TEST(VirtualChunkedTest, BatchedReadWithoutBatch) {
+  std::atomic<int> call_count{0};
+  std::atomic<int> chunk_count{0};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, BatchedCoordinatesView(
+                      call_count, chunk_count, tensorstore::Schema::Shape({8}),
+                      tensorstore::ChunkLayout::ChunkShape({2})));
+  EXPECT_THAT(tensorstore::Read(store).result(),
+              ::testing::Optional(
+                  tensorstore::MakeArray<Index>({0, 1, 2, 3, 4, 5, 6, 7})));
+  // Without a batch, the function is called once per chunk.
+  EXPECT_EQ(4, call_count);
+  EXPECT_EQ(4, chunk_count);
+}
+
 }  // namespace
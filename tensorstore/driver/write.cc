@@ -14,14 +14,20 @@
 
 #include "tensorstore/driver/write.h"
 
+#include <stdint.h>
+
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <utility>
 
 #include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/data_type_conversion.h"
 #include "tensorstore/driver/chunk.h"
+#include "tensorstore/driver/chunk_receiver_utils.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/driver/driver_handle.h"
 #include "tensorstore/index.h"
@@ -56,6 +62,8 @@ namespace internal {
 
 namespace {
 
+struct WriteChunkOp;
+
 /// Local state for the asynchronous operation initiated by the `DriverWrite`
 /// function.
 ///
@@ -101,17 +109,66 @@ struct WriteState : public internal::AtomicReferenceCount<WriteState> {
   /// otherwise referenced, to be freed).
   struct CommitState : public internal::AtomicReferenceCount<CommitState> {
     WriteProgressFunction write_progress_function;
+    WriteStatsFunction write_stats_function;
+    std::shared_ptr<AtomicWriteProgress> progress_counters;
     Index total_elements;
+    Index element_size = 0;
+    absl::Time start_time = absl::InfinitePast();
     std::atomic<Index> copied_elements{0};
     std::atomic<Index> committed_elements{0};
+    std::atomic<int64_t> copy_time_ns{0};
+    std::atomic<int64_t> copy_end_ns{0};
+    std::atomic<Index> chunk_count{0};
+
+    /// The destructor marks the completion of the operation: the last
+    /// reference is released only once copying has completed and all commit
+    /// callbacks have run (or, for transactional writes, once copying has
+    /// completed).
+    ~CommitState() {
+      if (!write_stats_function.value) return;
+      WriteOperationStats stats;
+      stats.copied_elements = copied_elements.load(std::memory_order_relaxed);
+      stats.copied_bytes = stats.copied_elements * element_size;
+      stats.chunk_count = chunk_count.load(std::memory_order_relaxed);
+      stats.total_time = absl::Now() - start_time;
+      stats.copy_time =
+          absl::Nanoseconds(copy_time_ns.load(std::memory_order_relaxed));
+      stats.commit_time = std::max(
+          absl::ZeroDuration(),
+          stats.total_time -
+              absl::Nanoseconds(copy_end_ns.load(std::memory_order_relaxed)));
+      write_stats_function.value(std::move(stats));
+    }
+
+    void RecordChunkCopied(absl::Time copy_start_time) {
+      const absl::Time end_time = absl::Now();
+      copy_time_ns.fetch_add(absl::ToInt64Nanoseconds(end_time -
+                                                      copy_start_time),
+                             std::memory_order_relaxed);
+      chunk_count.fetch_add(1, std::memory_order_relaxed);
+      const int64_t end_ns = absl::ToInt64Nanoseconds(end_time - start_time);
+      int64_t prev = copy_end_ns.load(std::memory_order_relaxed);
+      while (prev < end_ns &&
+             !copy_end_ns.compare_exchange_weak(prev, end_ns,
+                                                std::memory_order_relaxed)) {
+      }
+    }
 
     void UpdateCopyProgress(Index num_elements) {
+      if (progress_counters) {
+        progress_counters->copied_elements.fetch_add(
+            num_elements, std::memory_order_relaxed);
+      }
       if (!write_progress_function.value) return;
       write_progress_function.value(WriteProgress{
           total_elements, copied_elements += num_elements, committed_elements});
     }
 
     void UpdateCommitProgress(Index num_elements) {
+      if (progress_counters) {
+        progress_counters->committed_elements.fetch_add(
+            num_elements, std::memory_order_relaxed);
+      }
       if (!write_progress_function.value) return;
       write_progress_function.value(WriteProgress{
           total_elements, copied_elements, committed_elements += num_elements});
@@ -127,6 +184,7 @@ struct WriteState : public internal::AtomicReferenceCount<WriteState> {
   Promise<void> copy_promise;
   Promise<void> commit_promise;
   IntrusivePtr<CommitState> commit_state{new CommitState};
+  ChunkOpBatchQueue<WriteChunkOp> chunk_batch;
   internal_tracing::TraceSpan tspan{"tensorstore.Write"};
 
   void SetError(absl::Status error) {
@@ -141,6 +199,10 @@ struct WriteChunkOp {
   WriteChunk chunk;
   IndexTransform<> cell_transform;
   void operator()() {
+    const bool collect_stats =
+        static_cast<bool>(state->commit_state->write_stats_function.value);
+    absl::Time copy_start_time = absl::InfinitePast();
+    if (collect_stats) copy_start_time = absl::Now();
     // Map the portion of the source array that corresponds to this chunk
     // to the index space expected by the chunk.
     TENSORSTORE_ASSIGN_OR_RETURN(
@@ -204,6 +266,9 @@ struct WriteChunkOp {
     }
 
     if (copy_status.ok()) {
+      if (collect_stats) {
+        state->commit_state->RecordChunkCopied(copy_start_time);
+      }
       const Index num_elements = chunk.transform.input_domain().num_elements();
       state->commit_state->UpdateCopyProgress(num_elements);
       struct CommitCallback {
@@ -240,11 +305,15 @@ struct WriteChunkReceiver {
   void set_error(absl::Status error) { state->SetError(std::move(error)); }
   void set_value(WriteChunk chunk, IndexTransform<> cell_transform) {
     // Defer all work to the executor, because we don't know on which thread
-    // this may be called.
+    // this may be called.  Dispatches are batched so that a burst of
+    // synchronously-delivered chunks costs one executor dispatch per
+    // `kMaxOpsPerDrain` chunks while still copying concurrently.
     //
     // Don't move `state` since `set_value` may be called multiple times.
-    state->executor(
-        WriteChunkOp{state, std::move(chunk), std::move(cell_transform)});
+    if (state->chunk_batch.Add(
+            WriteChunkOp{state, std::move(chunk), std::move(cell_transform)})) {
+      state->executor([state = state] { state->chunk_batch.Drain(); });
+    }
   }
 };
 
@@ -264,6 +333,10 @@ struct DriverWriteInitiateOp {
         static_cast<void>(promise.SetResult(_)));
     state->commit_state->total_elements =
         target_transform.domain().num_elements();
+    if (state->commit_state->progress_counters) {
+      state->commit_state->progress_counters->total_elements.fetch_add(
+          state->commit_state->total_elements, std::memory_order_relaxed);
+    }
     state->copy_promise = std::move(promise);
 
     // Initiate the write on the driver.
@@ -299,6 +372,13 @@ WriteFutures DriverWrite(Executor executor,
   state->alignment_options = options.alignment_options;
   state->commit_state->write_progress_function =
       std::move(options.progress_function);
+  state->commit_state->progress_counters =
+      std::move(options.progress_counters.value);
+  state->commit_state->write_stats_function = std::move(options.stats_function);
+  if (state->commit_state->write_stats_function.value) {
+    state->commit_state->element_size = state->target_driver->dtype()->size;
+    state->commit_state->start_time = absl::Now();
+  }
   auto copy_pair = PromiseFuturePair<void>::Make(MakeResult());
   PromiseFuturePair<void> commit_pair;
   if (!state->target_transaction) {
@@ -0,0 +1,536 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/zarr/consolidated_metadata.h"
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/garbage_collection.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_zarr {
+namespace {
+
+constexpr std::string_view kConsolidatedMetadataFilename = ".zmetadata";
+
+/// Cached contents of a single ".zmetadata" file.
+struct ConsolidatedDir {
+  /// Generation of the ".zmetadata" file itself.  `NoValue` indicates the
+  /// file is known not to exist (the absence is cached as well).
+  TimestampedStorageGeneration stamp;
+
+  /// Maps keys relative to the directory (e.g. "array/.zarray") to their
+  /// JSON-encoded values.
+  absl::flat_hash_map<std::string, absl::Cord> entries;
+};
+
+using ConsolidatedDirPtr = std::shared_ptr<const ConsolidatedDir>;
+
+/// SAX handler that splits the "metadata" member of a ".zmetadata" document
+/// into the JSON text of each entry in a single pass.
+///
+/// Consolidated metadata files for large hierarchies contain thousands of
+/// entries; building a DOM for the whole document and re-serializing each
+/// entry allocates far more than the entries themselves.  This handler emits
+/// each entry's text directly from the SAX events, so only the per-entry
+/// strings are materialized.  Any unexpected input aborts the SAX parse, and
+/// the caller falls back to the DOM path for error reporting.
+class ConsolidatedEntrySplitter {
+ public:
+  using number_integer_t = ::nlohmann::json::number_integer_t;
+  using number_unsigned_t = ::nlohmann::json::number_unsigned_t;
+  using number_float_t = ::nlohmann::json::number_float_t;
+  using string_t = ::nlohmann::json::string_t;
+  using binary_t = ::nlohmann::json::binary_t;
+
+  bool null() { return Value("null"); }
+  bool boolean(bool val) { return Value(val ? "true" : "false"); }
+  bool number_integer(number_integer_t val) { return Value(absl::StrCat(val)); }
+  bool number_unsigned(number_unsigned_t val) {
+    return Value(absl::StrCat(val));
+  }
+  bool number_float(number_float_t /*val*/, const string_t& s) {
+    // The original token is used, so numbers round-trip exactly.
+    return Value(s);
+  }
+  bool string(string_t& val) {
+    if (capturing_ || pending_entry_) {
+      if (pending_entry_) BeginCapture();
+      MaybeComma();
+      AppendQuoted(val);
+      if (first_stack_.empty()) FinishEntry();
+      return true;
+    }
+    return Value(std::string_view{});
+  }
+  bool binary(binary_t&) { return false; }
+
+  bool start_object(size_t /*elements*/) {
+    if (capturing_ || pending_entry_) return StartContainer('{');
+    if (depth_ == 0) {
+      ++depth_;
+      return true;
+    }
+    if (pending_metadata_) {
+      pending_metadata_ = false;
+      saw_metadata_ = true;
+      in_metadata_ = true;
+      metadata_depth_ = ++depth_;
+      return true;
+    }
+    ++depth_;
+    return true;
+  }
+
+  bool end_object() {
+    if (capturing_) return EndContainer('}');
+    if (in_metadata_ && depth_ == metadata_depth_) in_metadata_ = false;
+    --depth_;
+    return true;
+  }
+
+  bool start_array(size_t /*elements*/) {
+    if (capturing_ || pending_entry_) return StartContainer('[');
+    // The root value and the "metadata" member must be objects.
+    if (depth_ == 0 || pending_metadata_) return false;
+    ++depth_;
+    return true;
+  }
+
+  bool end_array() {
+    if (capturing_) return EndContainer(']');
+    --depth_;
+    return true;
+  }
+
+  bool key(string_t& val) {
+    if (capturing_) {
+      MaybeComma();
+      AppendQuoted(val);
+      buf_ += ':';
+      after_key_ = true;
+      return true;
+    }
+    if (in_metadata_ && depth_ == metadata_depth_) {
+      current_key_ = val;
+      pending_entry_ = true;
+      return true;
+    }
+    if (depth_ == 1 && val == "metadata") pending_metadata_ = true;
+    return true;
+  }
+
+  bool parse_error(size_t /*position*/, const std::string& /*last_token*/,
+                   const ::nlohmann::detail::exception& /*ex*/) {
+    return false;
+  }
+
+  /// Returns `true` if a well-formed document with a "metadata" object was
+  /// processed.
+  bool valid() const { return saw_metadata_ && !capturing_ && depth_ == 0; }
+
+  absl::flat_hash_map<std::string, absl::Cord> entries() && {
+    return std::move(entries_);
+  }
+
+ private:
+  // Emits a comma if required before the next value or key in the current
+  // container of the entry being captured.
+  void MaybeComma() {
+    if (first_stack_.empty()) return;
+    if (after_key_) {
+      after_key_ = false;
+      return;
+    }
+    if (!first_stack_.back()) {
+      buf_ += ',';
+    } else {
+      first_stack_.back() = false;
+    }
+  }
+
+  void AppendQuoted(std::string_view s) {
+    buf_ += '"';
+    for (const char c : s) {
+      switch (c) {
+        case '"':
+          buf_ += "\\\"";
+          break;
+        case '\\':
+          buf_ += "\\\\";
+          break;
+        case '\b':
+          buf_ += "\\b";
+          break;
+        case '\f':
+          buf_ += "\\f";
+          break;
+        case '\n':
+          buf_ += "\\n";
+          break;
+        case '\r':
+          buf_ += "\\r";
+          break;
+        case '\t':
+          buf_ += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            absl::StrAppend(
+                &buf_, "\\u",
+                absl::Hex(static_cast<unsigned char>(c),
+                          absl::PadSpec::kZeroPad4));
+          } else {
+            buf_ += c;
+          }
+      }
+    }
+    buf_ += '"';
+  }
+
+  void BeginCapture() {
+    pending_entry_ = false;
+    capturing_ = true;
+    buf_.clear();
+    first_stack_.clear();
+    after_key_ = false;
+  }
+
+  void FinishEntry() {
+    // Duplicate keys within "metadata": last entry wins, matching the DOM
+    // parse.
+    entries_.insert_or_assign(std::move(current_key_), absl::Cord(buf_));
+    capturing_ = false;
+  }
+
+  bool Value(std::string_view text) {
+    if (capturing_ || pending_entry_) {
+      if (pending_entry_) BeginCapture();
+      MaybeComma();
+      buf_ += text;
+      if (first_stack_.empty()) FinishEntry();
+      return true;
+    }
+    // The root value and the "metadata" member must be objects.
+    if (depth_ == 0 || pending_metadata_) return false;
+    return true;
+  }
+
+  bool StartContainer(char open) {
+    if (pending_entry_) BeginCapture();
+    MaybeComma();
+    buf_ += open;
+    first_stack_.push_back(true);
+    ++depth_;
+    return true;
+  }
+
+  bool EndContainer(char close) {
+    buf_ += close;
+    first_stack_.pop_back();
+    after_key_ = false;
+    --depth_;
+    if (first_stack_.empty()) FinishEntry();
+    return true;
+  }
+
+  absl::flat_hash_map<std::string, absl::Cord> entries_;
+  std::string current_key_;
+  std::string buf_;
+  std::vector<bool> first_stack_;
+  size_t depth_ = 0;
+  size_t metadata_depth_ = 0;
+  bool pending_metadata_ = false;
+  bool saw_metadata_ = false;
+  bool in_metadata_ = false;
+  bool pending_entry_ = false;
+  bool capturing_ = false;
+  bool after_key_ = false;
+};
+
+Result<absl::flat_hash_map<std::string, absl::Cord>> ParseConsolidatedEntries(
+    absl::Cord encoded) {
+  const auto flat = encoded.Flatten();
+  ConsolidatedEntrySplitter splitter;
+  if (::nlohmann::json::sax_parse(flat, &splitter) && splitter.valid()) {
+    return std::move(splitter).entries();
+  }
+  // Fall back to a DOM parse, which distinguishes the malformed-JSON and
+  // missing-"metadata" error cases.
+  nlohmann::json j = nlohmann::json::parse(flat, nullptr,
+                                           /*allow_exceptions=*/false);
+  if (j.is_discarded() || !j.is_object()) {
+    return absl::FailedPreconditionError(
+        "Consolidated metadata (\".zmetadata\") is not a valid JSON object");
+  }
+  auto it = j.find("metadata");
+  if (it == j.end() || !it->is_object()) {
+    return absl::FailedPreconditionError(
+        "Consolidated metadata (\".zmetadata\") is missing the \"metadata\" "
+        "member");
+  }
+  absl::flat_hash_map<std::string, absl::Cord> entries;
+  for (const auto& [key, value] : it->items()) {
+    entries.emplace(key, absl::Cord(value.dump()));
+  }
+  return entries;
+}
+
+/// Produces the read result for `rel_key` served from a consolidated
+/// metadata file with generation `zmeta_stamp`.
+///
+/// The returned generation is derived from the ".zmetadata" generation and
+/// the relative key, so that conditional re-reads correctly report "not
+/// modified" for as long as the consolidated file is unchanged, and report a
+/// new generation whenever it is rewritten.
+Result<kvstore::ReadResult> ServeFromConsolidated(
+    const TimestampedStorageGeneration& zmeta_stamp, std::string_view rel_key,
+    const absl::Cord& value, const kvstore::ReadOptions& options) {
+  TimestampedStorageGeneration stamp{
+      StorageGeneration::FromString(tensorstore::StrCat(
+          zmeta_stamp.generation.value, "+", rel_key)),
+      zmeta_stamp.time};
+  if (!options.generation_conditions.Matches(stamp.generation)) {
+    return kvstore::ReadResult::Unspecified(std::move(stamp));
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto byte_range,
+                               options.byte_range.Validate(value.size()));
+  return kvstore::ReadResult::Value(internal::GetSubCord(value, byte_range),
+                                    std::move(stamp));
+}
+
+class ConsolidatedMetadataKvStoreDriver : public kvstore::Driver {
+ public:
+  explicit ConsolidatedMetadataKvStoreDriver(kvstore::DriverPtr base)
+      : base_(std::move(base)) {}
+
+  Future<kvstore::ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    // Once metadata is modified through this kvstore, the per-key generations
+    // of the underlying store are required for read-modify-write operations
+    // to converge, and the consolidated snapshot is stale by definition.
+    DisableConsolidated();
+    return base_->Write(std::move(key), std::move(value), std::move(options));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    DisableConsolidated();
+    return base_->DeleteRange(std::move(range));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    base_->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_->DescribeKey(key);
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const override {
+    return base_->GetSupportedFeatures(key_range);
+  }
+
+  void GarbageCollectionVisit(
+      garbage_collection::GarbageCollectionVisitor& visitor) const override {
+    garbage_collection::GarbageCollectionVisit(visitor, *base_);
+  }
+
+  /// Returns the (possibly cached) contents of "<dir>/.zmetadata".
+  ///
+  /// A cached result is reused if it was fetched no earlier than
+  /// `staleness_bound`; otherwise a conditional re-read is issued.
+  Future<ConsolidatedDirPtr> GetConsolidatedDir(const std::string& dir,
+                                                absl::Time staleness_bound);
+
+  /// Attempts to serve `state->key` from the consolidated metadata of `dir`,
+  /// walking up to successive ancestor directories and finally falling back
+  /// to a direct read from the base kvstore.
+  struct ReadState;
+  static void ReadFromDir(internal::IntrusivePtr<ReadState> state,
+                          std::string dir,
+                          Promise<kvstore::ReadResult> promise);
+
+  void DisableConsolidated() {
+    if (!disabled_.exchange(true, std::memory_order_acq_rel)) {
+      absl::MutexLock lock(&mutex_);
+      dirs_.clear();
+    }
+  }
+
+  kvstore::DriverPtr base_;
+
+  struct DirCacheSlot {
+    Future<ConsolidatedDirPtr> future;
+    absl::Time fetch_time = absl::InfinitePast();
+  };
+
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, DirCacheSlot> dirs_ ABSL_GUARDED_BY(mutex_);
+  std::atomic<bool> disabled_{false};
+};
+
+struct ConsolidatedMetadataKvStoreDriver::ReadState
+    : public internal::AtomicReferenceCount<ReadState> {
+  internal::IntrusivePtr<ConsolidatedMetadataKvStoreDriver> self;
+  Key key;
+  ReadOptions options;
+};
+
+void ConsolidatedMetadataKvStoreDriver::ReadFromDir(
+    internal::IntrusivePtr<ReadState> state, std::string dir,
+    Promise<kvstore::ReadResult> promise) {
+  auto dir_future =
+      state->self->GetConsolidatedDir(dir, state->options.staleness_bound);
+  LinkValue(
+      [state = std::move(state), dir = std::move(dir)](
+          Promise<kvstore::ReadResult> promise,
+          ReadyFuture<ConsolidatedDirPtr> future) mutable {
+        const ConsolidatedDir& dir_info = *future.value();
+        if (!StorageGeneration::IsNoValue(dir_info.stamp.generation)) {
+          std::string_view rel_key = state->key;
+          if (!dir.empty()) rel_key.remove_prefix(dir.size() + 1);
+          if (auto it = dir_info.entries.find(rel_key);
+              it != dir_info.entries.end()) {
+            promise.SetResult(ServeFromConsolidated(
+                dir_info.stamp, rel_key, it->second, state->options));
+            return;
+          }
+          // A ".zmetadata" file that does not mention `rel_key` is not
+          // authoritative for its absence: it may predate the node.  Keep
+          // looking.
+        }
+        if (dir.empty()) {
+          // No ancestor defines a consolidated entry for this key.
+          LinkResult(std::move(promise),
+                     state->self->base_->Read(state->key, state->options));
+          return;
+        }
+        const size_t sep = dir.rfind('/');
+        ReadFromDir(std::move(state),
+                    sep == std::string::npos ? std::string() : dir.substr(0, sep),
+                    std::move(promise));
+      },
+      std::move(promise), std::move(dir_future));
+}
+
+Future<kvstore::ReadResult> ConsolidatedMetadataKvStoreDriver::Read(
+    Key key, ReadOptions options) {
+  // Only keys of the form "<dir>/<name>" can be served from a consolidated
+  // metadata file in an ancestor of "<dir>".
+  const size_t last_sep = key.rfind('/');
+  if (last_sep == std::string::npos || last_sep == 0 ||
+      disabled_.load(std::memory_order_acquire)) {
+    return base_->Read(std::move(key), std::move(options));
+  }
+  const size_t dir_sep = key.rfind('/', last_sep - 1);
+  std::string dir =
+      dir_sep == std::string::npos ? std::string() : key.substr(0, dir_sep);
+  auto state = internal::MakeIntrusivePtr<ReadState>();
+  state->self.reset(this);
+  state->key = std::move(key);
+  state->options = std::move(options);
+  auto [promise, future] = PromiseFuturePair<kvstore::ReadResult>::Make();
+  ReadFromDir(std::move(state), std::move(dir), std::move(promise));
+  return std::move(future);
+}
+
+Future<ConsolidatedDirPtr>
+ConsolidatedMetadataKvStoreDriver::GetConsolidatedDir(
+    const std::string& dir, absl::Time staleness_bound) {
+  std::string zmeta_key =
+      dir.empty() ? std::string(kConsolidatedMetadataFilename)
+                  : tensorstore::StrCat(dir, "/", kConsolidatedMetadataFilename);
+  absl::MutexLock lock(&mutex_);
+  auto& slot = dirs_[dir];
+  if (!slot.future.null() &&
+      (!slot.future.ready() || slot.fetch_time >= staleness_bound)) {
+    return slot.future;
+  }
+  kvstore::ReadOptions read_options;
+  read_options.staleness_bound = staleness_bound;
+  ConsolidatedDirPtr existing;
+  if (!slot.future.null() && slot.future.result().ok()) {
+    existing = slot.future.value();
+    if (!StorageGeneration::IsNoValue(existing->stamp.generation)) {
+      read_options.generation_conditions.if_not_equal =
+          existing->stamp.generation;
+    }
+  }
+  slot.fetch_time = absl::Now();
+  slot.future = MapFutureValue(
+      InlineExecutor{},
+      [existing = std::move(existing)](
+          kvstore::ReadResult& result) -> Result<ConsolidatedDirPtr> {
+        if (result.aborted()) {
+          // Not modified; reuse the cached entries with the new timestamp.
+          auto updated = std::make_shared<ConsolidatedDir>(*existing);
+          updated->stamp.time = result.stamp.time;
+          return updated;
+        }
+        auto dir_info = std::make_shared<ConsolidatedDir>();
+        dir_info->stamp = std::move(result.stamp);
+        if (result.has_value()) {
+          TENSORSTORE_ASSIGN_OR_RETURN(dir_info->entries,
+                                       ParseConsolidatedEntries(result.value));
+        }
+        return dir_info;
+      },
+      base_->Read(std::move(zmeta_key), std::move(read_options)));
+  return slot.future;
+}
+
+}  // namespace
+
+kvstore::DriverPtr GetConsolidatedMetadataKeyValueStore(
+    kvstore::DriverPtr base) {
+  return kvstore::DriverPtr(
+      new ConsolidatedMetadataKvStoreDriver(std::move(base)));
+}
+
+}  // namespace internal_zarr
+}  // namespace tensorstore
@@ -0,0 +1,51 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_DRIVER_ZARR_CONSOLIDATED_METADATA_H_
+#define TENSORSTORE_DRIVER_ZARR_CONSOLIDATED_METADATA_H_
+
+/// \file
+/// Support for zarr v2 consolidated metadata (".zmetadata") files.
+///
+/// Consolidated metadata, as written by `zarr.consolidate_metadata`, stores a
+/// copy of every ".zarray"/".zattrs"/".zgroup" file within a group in a single
+/// group-level ".zmetadata" JSON file, so that all of the metadata for a
+/// hierarchy can be retrieved with a single read.
+
+#include "tensorstore/kvstore/driver.h"
+
+namespace tensorstore {
+namespace internal_zarr {
+
+/// Returns an adapter kvstore that serves reads of per-node metadata keys
+/// (e.g. "path/to/array/.zarray") from a consolidated ".zmetadata" file in an
+/// ancestor directory, falling back to `base` if no ancestor defines a
+/// consolidated entry for the key.
+///
+/// The ".zmetadata" files themselves are read from `base` and cached within
+/// the returned adapter, subject to the `staleness_bound` of each read
+/// request, so that opening many arrays within the same group requires only a
+/// single underlying read.  A consolidated metadata file is a snapshot: if it
+/// is out of date with respect to the individual metadata files, reads served
+/// from it are correspondingly out of date.  Once a write or delete is issued
+/// through the adapter, consolidated serving is disabled and all subsequent
+/// reads are forwarded to `base`, since read-modify-write operations require
+/// the true per-key generations.
+kvstore::DriverPtr GetConsolidatedMetadataKeyValueStore(
+    kvstore::DriverPtr base);
+
+}  // namespace internal_zarr
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_DRIVER_ZARR_CONSOLIDATED_METADATA_H_
@@ -0,0 +1,167 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/driver/zarr/consolidated_metadata.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/memory/memory_key_value_store.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::StorageGeneration;
+using ::tensorstore::internal_zarr::GetConsolidatedMetadataKeyValueStore;
+
+::nlohmann::json GetZarrayJson() {
+  return {{"zarr_format", 2},     {"shape", {10}},
+          {"chunks", {5}},        {"dtype", "<i2"},
+          {"compressor", nullptr}, {"filters", nullptr},
+          {"fill_value", nullptr}, {"order", "C"}};
+}
+
+kvstore::KvStore GetStoreWithConsolidatedMetadata() {
+  auto base = tensorstore::GetMemoryKeyValueStore();
+  kvstore::KvStore base_store(base);
+  ::nlohmann::json zmetadata{
+      {"zarr_consolidated_format", 1},
+      {"metadata",
+       {{".zgroup", {{"zarr_format", 2}}}, {"arr/.zarray", GetZarrayJson()}}}};
+  TENSORSTORE_EXPECT_OK(kvstore::Write(base_store, "group/.zmetadata",
+                                       absl::Cord(zmetadata.dump()))
+                            .result());
+  return kvstore::KvStore(GetConsolidatedMetadataKeyValueStore(base));
+}
+
+TEST(ConsolidatedMetadataTest, ServesEntriesFromConsolidatedFile) {
+  auto store = GetStoreWithConsolidatedMetadata();
+  // The individual ".zarray" key does not exist in the base kvstore; the read
+  // is served entirely from "group/.zmetadata".
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store, "group/arr/.zarray").result());
+  ASSERT_TRUE(read_result.has_value());
+  EXPECT_EQ(GetZarrayJson(),
+            ::nlohmann::json::parse(std::string(read_result.value)));
+
+  // A conditional re-read with the returned generation reports "not
+  // modified".
+  kvstore::ReadOptions options;
+  options.generation_conditions.if_not_equal = read_result.stamp.generation;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto second_result,
+      kvstore::Read(store, "group/arr/.zarray", options).result());
+  EXPECT_TRUE(second_result.aborted());
+
+  // Distinct keys served from the same ".zmetadata" file have distinct
+  // generations.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto group_result, kvstore::Read(store, "group/.zgroup").result());
+  ASSERT_TRUE(group_result.has_value());
+  EXPECT_NE(read_result.stamp.generation, group_result.stamp.generation);
+}
+
+TEST(ConsolidatedMetadataTest, RoundTripsEntryValues) {
+  auto base = tensorstore::GetMemoryKeyValueStore();
+  kvstore::KvStore base_store(base);
+  // Entry values covering every JSON value type, including strings requiring
+  // escaping and non-integer fill values, survive the single-pass parse of
+  // the ".zmetadata" file.
+  ::nlohmann::json attrs{{"description", "line1\nline\"2\"\\t"},
+                         {"scale", 0.125},
+                         {"offset", -3},
+                         {"active", true},
+                         {"missing", nullptr},
+                         {"levels", {1, {2, 3}, ::nlohmann::json::object()}}};
+  ::nlohmann::json zmetadata{
+      {"zarr_consolidated_format", 1},
+      {"metadata",
+       {{".zattrs", attrs}, {"arr/.zarray", GetZarrayJson()}}}};
+  TENSORSTORE_EXPECT_OK(kvstore::Write(base_store, "group/.zmetadata",
+                                       absl::Cord(zmetadata.dump()))
+                            .result());
+  kvstore::KvStore store(GetConsolidatedMetadataKeyValueStore(base));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store, "group/.zattrs").result());
+  ASSERT_TRUE(read_result.has_value());
+  EXPECT_EQ(attrs, ::nlohmann::json::parse(std::string(read_result.value)));
+}
+
+TEST(ConsolidatedMetadataTest, FallsBackToBase) {
+  auto base = tensorstore::GetMemoryKeyValueStore();
+  kvstore::KvStore base_store(base);
+  TENSORSTORE_EXPECT_OK(
+      kvstore::Write(base_store, "group/arr/.zarray",
+                     absl::Cord(GetZarrayJson().dump()))
+          .result());
+  kvstore::KvStore store(GetConsolidatedMetadataKeyValueStore(base));
+  // No ".zmetadata" exists; the read is forwarded to the base kvstore.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store, "group/arr/.zarray").result());
+  EXPECT_TRUE(read_result.has_value());
+
+  // A key not mentioned by any consolidated file is also forwarded.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto missing_result, kvstore::Read(store, "group/other/.zarray").result());
+  EXPECT_TRUE(missing_result.not_found());
+}
+
+TEST(ConsolidatedMetadataTest, WriteDisablesConsolidatedServing) {
+  auto store = GetStoreWithConsolidatedMetadata();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store, "group/arr/.zarray").result());
+  EXPECT_TRUE(read_result.has_value());
+
+  // After a metadata write through the adapter, reads reflect the true
+  // per-key state of the base kvstore rather than the consolidated snapshot.
+  TENSORSTORE_EXPECT_OK(
+      kvstore::Write(store, "group/arr2/.zarray",
+                     absl::Cord(GetZarrayJson().dump()))
+          .result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto after_write, kvstore::Read(store, "group/arr/.zarray").result());
+  EXPECT_TRUE(after_write.not_found());
+}
+
+TEST(ConsolidatedMetadataTest, ObservesNewConsolidatedFile) {
+  auto base = tensorstore::GetMemoryKeyValueStore();
+  kvstore::KvStore base_store(base);
+  kvstore::KvStore store(GetConsolidatedMetadataKeyValueStore(base));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto read_result, kvstore::Read(store, "group/arr/.zarray").result());
+  EXPECT_TRUE(read_result.not_found());
+
+  // Writing a ".zmetadata" file directly to the base kvstore is observed by
+  // reads with a later staleness bound.
+  ::nlohmann::json zmetadata{{"zarr_consolidated_format", 1},
+                             {"metadata", {{"arr/.zarray", GetZarrayJson()}}}};
+  TENSORSTORE_EXPECT_OK(kvstore::Write(base_store, "group/.zmetadata",
+                                       absl::Cord(zmetadata.dump()))
+                            .result());
+  kvstore::ReadOptions options;
+  options.staleness_bound = absl::Now();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto second_result,
+      kvstore::Read(store, "group/arr/.zarray", options).result());
+  EXPECT_TRUE(second_result.has_value());
+}
+
+}  // namespace
@@ -38,6 +38,7 @@
 #include "tensorstore/data_type.h"
 #include "tensorstore/driver/kvs_backed_chunk_driver.h"
 #include "tensorstore/driver/registry.h"
+#include "tensorstore/driver/zarr/consolidated_metadata.h"
 #include "tensorstore/driver/zarr/driver_impl.h"
 #include "tensorstore/driver/zarr/metadata.h"
 #include "tensorstore/driver/zarr/spec.h"
@@ -148,6 +149,10 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
                    jb::Projection<&ZarrDriverSpec::metadata_key>(
                        jb::DefaultValue<jb::kNeverIncludeDefaults>(
                            [](auto* obj) { *obj = kDefaultMetadataKey; }))),
+        jb::Member("consolidated_metadata",
+                   jb::Projection<&ZarrDriverSpec::consolidated_metadata>(
+                       jb::DefaultValue<jb::kNeverIncludeDefaults>(
+                           [](auto* obj) { *obj = false; }))),
         // Deprecated `key_encoding` property.
         jb::LoadSave(jb::OptionalMember(
             "key_encoding",
@@ -454,11 +459,25 @@ class ZarrDriver::OpenState : public ZarrDriver::OpenStateBase {
     return tensorstore::StrCat(spec().store.path, spec().metadata_key);
   }
 
+  std::string GetMetadataCacheKey() override {
+    std::string result;
+    internal::EncodeCacheKey(&result, spec().consolidated_metadata);
+    return result;
+  }
+
   std::unique_ptr<internal_kvs_backed_chunk_driver::MetadataCache>
   GetMetadataCache(MetadataCache::Initializer initializer) override {
     return std::make_unique<MetadataCache>(std::move(initializer));
   }
 
+  Result<kvstore::DriverPtr> GetMetadataKeyValueStore(
+      kvstore::DriverPtr base_kv_store) override {
+    if (spec().consolidated_metadata) {
+      return GetConsolidatedMetadataKeyValueStore(std::move(base_kv_store));
+    }
+    return base_kv_store;
+  }
+
   Result<std::shared_ptr<const void>> Create(const void* existing_metadata,
                                              CreateOptions options) override {
     if (existing_metadata) {
@@ -63,6 +63,7 @@
 #include "tensorstore/open.h"
 #include "tensorstore/open_mode.h"
 #include "tensorstore/rank.h"
+#include "tensorstore/read_write_options.h"
 #include "tensorstore/resize_options.h"
 #include "tensorstore/schema.h"
 #include "tensorstore/spec.h"
@@ -353,6 +354,56 @@ TEST(ZarrDriverTest, Create) {
   }
 }
 
+TEST(ZarrDriverTest, ReadAlignedToChunks) {
+  auto context = Context::Default();
+  ::nlohmann::json json_spec{
+      {"driver", "zarr"},
+      {"kvstore", {{"driver", "memory"}}},
+      {"metadata",
+       {
+           {"compressor", nullptr},
+           {"dtype", "<i2"},
+           {"shape", {10, 10}},
+           {"chunks", {4, 4}},
+       }},
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, context, tensorstore::OpenMode::create,
+                        tensorstore::ReadWriteMode::read_write)
+          .result());
+  auto array = tensorstore::AllocateArray<int16_t>({10, 10});
+  for (Index i = 0; i < 10; ++i) {
+    for (Index j = 0; j < 10; ++j) {
+      array(i, j) = static_cast<int16_t>(i * 100 + j);
+    }
+  }
+  TENSORSTORE_ASSERT_OK(tensorstore::Write(array, store).result());
+
+  // Read a box that is not aligned to the 4x4 chunk grid.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto sliced, store | tensorstore::AllDims().SizedInterval({3, 2}, {4, 5}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto aligned_read,
+      tensorstore::Read(sliced, tensorstore::AlignReadToChunks{true}).result());
+  // The result domain is the requested domain, not the expanded domain.
+  EXPECT_EQ(tensorstore::BoxView({3, 2}, {4, 5}), aligned_read.domain());
+  EXPECT_THAT(tensorstore::Read(sliced).result(),
+              ::testing::Optional(aligned_read));
+
+  // The chunk-aligned expansion is clipped to the array bounds.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto edge_sliced,
+      store | tensorstore::AllDims().SizedInterval({7, 9}, {3, 1}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto edge_read,
+      tensorstore::Read(edge_sliced, tensorstore::AlignReadToChunks{true})
+          .result());
+  EXPECT_EQ(tensorstore::BoxView({7, 9}, {3, 1}), edge_read.domain());
+  EXPECT_THAT(tensorstore::Read(edge_sliced).result(),
+              ::testing::Optional(edge_read));
+}
+
 // Tests that a non-default `metadata_key` value in the spec works.
 TEST(ZarrDriverTest, CreateWithMetadataKey) {
   ::nlohmann::json json_spec = GetJsonSpec();
@@ -423,6 +474,49 @@ TEST(ZarrDriverTest, CreateWithMetadataKey) {
       MatchesStatus(absl::StatusCode::kAlreadyExists,
                     "Error opening \"zarr\" driver: "
                     "Error writing \"prefix/zarray\""));
+}
+
+// Tests that `consolidated_metadata` permits opening an array whose metadata
+// exists only in a consolidated ".zmetadata" file.
+TEST(ZarrDriverTest, OpenWithConsolidatedMetadata) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto kvs, kvstore::Open({{"driver", "memory"}}, context).result());
+  ::nlohmann::json zmetadata{
+      {"zarr_consolidated_format", 1},
+      {"metadata",
+       {{"prefix/.zarray",
+         {{"zarr_format", 2},
+          {"shape", {10}},
+          {"chunks", {5}},
+          {"dtype", "<i2"},
+          {"compressor", nullptr},
+          {"filters", nullptr},
+          {"fill_value", nullptr},
+          {"order", "C"}}}}}};
+  TENSORSTORE_ASSERT_OK(
+      kvstore::Write(kvs, ".zmetadata", absl::Cord(zmetadata.dump())).result());
+
+  ::nlohmann::json json_spec{
+      {"driver", "zarr"},
+      {"kvstore", {{"driver", "memory"}, {"path", "prefix/"}}},
+      {"consolidated_metadata", true},
+  };
+  // The individual "prefix/.zarray" key does not exist; the metadata is
+  // served from the consolidated ".zmetadata" file.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, tensorstore::Open(json_spec, context,
+                                    tensorstore::OpenMode::open,
+                                    tensorstore::ReadWriteMode::read)
+                      .result());
+  EXPECT_EQ(tensorstore::Box<1>({10}), store.domain().box());
+
+  // Without `consolidated_metadata`, the open fails.
+  json_spec.erase("consolidated_metadata");
+  EXPECT_THAT(tensorstore::Open(json_spec, context, tensorstore::OpenMode::open,
+                                tensorstore::ReadWriteMode::read)
+                  .result(),
+              MatchesStatus(absl::StatusCode::kNotFound));
 
   // Check that create or open succeeds.
   TENSORSTORE_EXPECT_OK(tensorstore::Open(
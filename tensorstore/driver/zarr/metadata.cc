@@ -39,7 +39,6 @@
 #include <nlohmann/json_fwd.hpp>
 #include "riegeli/bytes/cord_reader.h"
 #include "riegeli/bytes/cord_writer.h"
-#include "riegeli/bytes/read_all.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/write.h"
 #include "riegeli/bytes/writer.h"
@@ -522,12 +521,30 @@ Result<absl::InlinedVector<SharedArray<const void>, 1>> DecodeChunk(
     riegeli::CordReader<absl::Cord> base_reader(std::move(buffer));
     auto compressed_reader = metadata.compressor->GetReader(
         base_reader, metadata.dtype.bytes_per_outer_element);
-    TENSORSTORE_RETURN_IF_ERROR(
-        riegeli::ReadAll(std::move(compressed_reader), buffer));
+    // Decompress directly into a single flat buffer of the expected chunk
+    // size, rather than materializing an intermediate cord that would have to
+    // be flattened below: each decoded block is written straight to its final
+    // location, and peak memory is one decoded chunk.
+    internal::FlatCordBuilder decoded(metadata.chunk_layout.bytes_per_chunk);
+    const bool read_ok =
+        compressed_reader->Read(decoded.size(), decoded.data());
+    const bool has_more = read_ok && compressed_reader->Pull();
+    if (!compressed_reader->ok()) return compressed_reader->status();
+    if (!read_ok || has_more) {
+      return absl::InvalidArgumentError(tensorstore::StrCat(
+          "Uncompressed chunk is ",
+          has_more ? tensorstore::StrCat("at least ",
+                                         decoded.size() +
+                                             compressed_reader->available())
+                   : tensorstore::StrCat(compressed_reader->pos()),
+          " bytes, but should be ", metadata.chunk_layout.bytes_per_chunk,
+          " bytes"));
+    }
+    if (!compressed_reader->Close()) return compressed_reader->status();
     if (!base_reader.VerifyEndAndClose()) return base_reader.status();
-  }
-  if (static_cast<Index>(buffer.size()) !=
-      metadata.chunk_layout.bytes_per_chunk) {
+    buffer = std::move(decoded).Build();
+  } else if (static_cast<Index>(buffer.size()) !=
+             metadata.chunk_layout.bytes_per_chunk) {
     return absl::InvalidArgumentError(tensorstore::StrCat(
         "Uncompressed chunk is ", buffer.size(), " bytes, but should be ",
         metadata.chunk_layout.bytes_per_chunk, " bytes"));
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string>
+#include <string_view>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
@@ -41,6 +44,24 @@ TEST_P(ZlibCompressorTest, SmallRoundtrip) {
   EXPECT_EQ(input, decode_result);
 }
 
+// Tests that streaming decode produces the same result as `Decode`.
+TEST_P(ZlibCompressorTest, DecodeStreaming) {
+  auto compressor =
+      Compressor::FromJson({{"id", GetParam()}, {"level", 6}}).value();
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result;
+  TENSORSTORE_ASSERT_OK(compressor->Encode(input, &encode_result, 1));
+  std::string decode_result;
+  TENSORSTORE_ASSERT_OK(compressor->DecodeStreaming(
+      encode_result,
+      [&](std::string_view decoded_block) {
+        decode_result.append(decoded_block);
+        return absl::OkStatus();
+      },
+      1));
+  EXPECT_EQ(input, decode_result);
+}
+
 // Tests that specifying a level of 1 gives the same result as not specifying a
 // level.
 TEST_P(ZlibCompressorTest, DefaultLevel) {
@@ -61,6 +61,21 @@ TEST(ZstdCompressorTest, NonDefaultLevel) {
   EXPECT_EQ(input, decode_result);
 }
 
+// Tests that specifying a window log and adaptive mode round trips.
+TEST(ZstdCompressorTest, WindowLogAndAdaptive) {
+  auto compressor = Compressor::FromJson({{"id", "zstd"},
+                                          {"level", 3},
+                                          {"window_log", 23},
+                                          {"adaptive", true}})
+                        .value();
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result;
+  TENSORSTORE_ASSERT_OK(compressor->Encode(input, &encode_result, 1));
+  absl::Cord decode_result;
+  TENSORSTORE_ASSERT_OK(compressor->Decode(encode_result, &decode_result, 1));
+  EXPECT_EQ(input, decode_result);
+}
+
 // Tests that an invalid parameter gives an error.
 TEST(ZstdCompressorTest, InvalidParameter) {
   EXPECT_THAT(Compressor::FromJson({{"id", "zstd"}, {"level", "6"}}),
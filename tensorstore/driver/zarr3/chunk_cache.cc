@@ -39,6 +39,7 @@
 #include "tensorstore/index.h"
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
+#include "tensorstore/index_space/internal/compose_transforms.h"
 #include "tensorstore/internal/cache/cache.h"
 #include "tensorstore/internal/cache/chunk_cache.h"
 #include "tensorstore/internal/cache/kvs_backed_chunk_cache.h"
@@ -268,6 +269,10 @@ void ShardedReadOrWrite(
   auto state = internal::MakeIntrusivePtr<State>(std::move(receiver));
   assert(chunked_to_cell_dimensions.size() == chunk_shape.size());
   internal_grid_partition::RegularGridRef regular_grid{chunk_shape};
+  // Successive cell transforms produced by `PartitionIndexTransformOverGrid`
+  // typically differ only by translation of their input domains; the cache
+  // avoids recomposing the output index maps for each cell.
+  internal_index_space::ComposeTransformsCache compose_cache;
   auto status = internal::PartitionIndexTransformOverGrid(
       chunked_to_cell_dimensions, regular_grid, transform,
       [&](span<const Index> grid_cell_indices,
@@ -276,7 +281,8 @@ void ShardedReadOrWrite(
           return absl::CancelledError("");
         }
         TENSORSTORE_ASSIGN_OR_RETURN(
-            auto cell_to_source, ComposeTransforms(transform, cell_transform));
+            auto cell_to_source,
+            compose_cache.Compose(transform, IndexTransform<>(cell_transform)));
         TENSORSTORE_ASSIGN_OR_RETURN(
             cell_to_source,
             TranslateCellToSourceTransformForShard(std::move(cell_to_source),
@@ -349,8 +355,7 @@ void ZarrShardedChunkCache::Write(
            request.store_data_equal_to_fill_value](auto entry) {
         internal::OpenTransactionPtr shard_transaction = transaction;
         if (!shard_transaction) {
-          shard_transaction = internal::TransactionState::MakeImplicit();
-          shard_transaction->RequestCommit();
+          shard_transaction = entry->GetImplicitTransaction();
         }
         return [=, entry = std::move(entry)](
                    span<const Index> decoded_shape, IndexTransform<> transform,
@@ -482,6 +487,21 @@ void ZarrShardedChunkCache::Entry::DoInitialize() {
   sub_chunk_cache->parent_chunk_ = this;
 }
 
+internal::OpenTransactionPtr
+ZarrShardedChunkCache::Entry::GetImplicitTransaction() {
+  absl::MutexLock lock(&implicit_transaction_mutex);
+  if (implicit_transaction) {
+    if (auto shard_transaction =
+            implicit_transaction->AcquireImplicitOpenPtr()) {
+      return shard_transaction;
+    }
+  }
+  auto shard_transaction = internal::TransactionState::MakeImplicit();
+  shard_transaction->RequestCommit();
+  implicit_transaction.reset(shard_transaction.get());
+  return shard_transaction;
+}
+
 kvstore::Driver* ZarrShardedChunkCache::GetKvStoreDriver() {
   return this->base_kvstore_.get();
 }
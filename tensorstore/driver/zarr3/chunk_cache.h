@@ -21,6 +21,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
@@ -229,6 +230,23 @@ class ZarrShardedChunkCache : public internal::Cache, public ZarrChunkCache {
               static_cast<ptrdiff_t>(key().size() / sizeof(Index))};
     }
 
+    /// Returns an open transaction to use for a non-transactional write to
+    /// this shard.
+    ///
+    /// Re-uses `implicit_transaction` while it remains open, so that
+    /// concurrent non-transactional writes to the same shard are coalesced
+    /// into a single writeback of the shard object, rather than each issuing
+    /// a separate read-modify-write of the shard.  Otherwise, creates (and
+    /// caches) a new implicit transaction, with commit requested as soon as
+    /// it is no longer in use.
+    internal::OpenTransactionPtr GetImplicitTransaction();
+
+    absl::Mutex implicit_transaction_mutex;
+    // Most recently created implicit transaction for non-transactional writes
+    // to this shard, which may still be open.
+    internal::TransactionState::WeakPtr implicit_transaction
+        ABSL_GUARDED_BY(implicit_transaction_mutex);
+
     void DoInitialize() override;
   };
 
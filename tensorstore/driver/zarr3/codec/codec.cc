@@ -52,6 +52,11 @@ int64_t ZarrBytesToBytesCodec::PreparedState::encoded_size() const {
   return -1;
 }
 
+ZarrArrayToArrayCodec::Ptr ZarrArrayToArrayCodec::TryCompose(
+    const ZarrArrayToArrayCodec& next) const {
+  return nullptr;
+}
+
 bool ZarrShardingCodec::is_sharding_codec() const { return true; }
 
 absl::Status ZarrCodecChain::PreparedState::EncodeArray(
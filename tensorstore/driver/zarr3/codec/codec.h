@@ -164,6 +164,18 @@ class ZarrArrayToArrayCodec
 
   virtual ~ZarrArrayToArrayCodec();
 
+  // Returns a single codec equivalent to applying `*this` followed by `next`,
+  // or `nullptr` if the two codecs cannot be combined.
+  //
+  // This is used by `ZarrCodecChainSpec::Resolve` to fuse adjacent "array ->
+  // array" codecs in the resolved chain, e.g. two consecutive "transpose"
+  // codecs, so that encoding/decoding does not incur a separate prepared state
+  // and per-chunk transform composition for each codec.  Fusion does not
+  // affect the resolved spec (and therefore the stored metadata).
+  //
+  // The default implementation returns `nullptr`.
+  virtual Ptr TryCompose(const ZarrArrayToArrayCodec& next) const;
+
   // Returns a prepared state that may be used to decode arrays of the specified
   // shape.
   virtual Result<PreparedState::Ptr> Prepare(
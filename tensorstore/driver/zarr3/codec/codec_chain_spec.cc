@@ -302,6 +302,24 @@ ZarrCodecChainSpec::Resolve(ArrayCodecResolveParameters&& decoded,
             TransposeCodecSpec::Options{std::move(new_order)})));
   }
 
+  // Fuse adjacent "array -> array" codecs where possible, e.g. two
+  // consecutive "transpose" codecs, which commonly arise when an inner-order
+  // transpose is inserted above after a user-specified transpose.  Fusion
+  // avoids a separate prepared state and per-chunk transform composition for
+  // each codec; `resolved_spec` is unaffected, since it must reflect the
+  // stored metadata.
+  if (auto& codecs = chain->array_to_array; codecs.size() > 1) {
+    size_t fused_i = 0;
+    for (size_t i = 1; i < codecs.size(); ++i) {
+      if (auto fused = codecs[fused_i]->TryCompose(*codecs[i])) {
+        codecs[fused_i] = std::move(fused);
+      } else {
+        codecs[++fused_i] = std::move(codecs[i]);
+      }
+    }
+    codecs.resize(fused_i + 1);
+  }
+
   TENSORSTORE_ASSIGN_OR_RETURN(
       chain->array_to_bytes,
       array_to_bytes_codec_ptr->Resolve(
@@ -39,6 +39,20 @@ namespace tensorstore {
 namespace internal_zarr3 {
 namespace {
 
+// Appends/verifies a digest of the encoded representation.
+//
+// The digest is computed incrementally during the streaming write/read
+// itself (via `DigestSuffixedWriter`/`DigestSuffixedReader`), rather than in
+// a separate pass over the encoded chunk.  For CRC32C, the digester is
+// backed by `absl::ExtendCrc32c`, which uses hardware CRC32C instructions
+// with multi-stream pipelining where available.
+//
+// The checksum of a single chunk is not split into sections checksummed on
+// separate threads (and combined with `absl::ConcatCrc32c`): the codec
+// interface is synchronous and has no executor.  Large shards do not hit a
+// serial checksum ceiling, however, since a "crc32c" codec in the sub-chunk
+// codec chain is evaluated independently per sub-chunk, concurrently on the
+// `data_copy_concurrency` executor.
 template <typename Digester, typename DigestWriterTraits,
           typename DigestVerifierTraits>
 class DigestCodec : public ZarrBytesToBytesCodec {
@@ -17,6 +17,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cassert>
 #include <numeric>
 #include <string>
 #include <string_view>
@@ -24,6 +25,8 @@
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "riegeli/bytes/read_all.h"
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "tensorstore/array.h"
@@ -84,13 +87,85 @@ class ShardingIndexedCodec : public ZarrShardingCodec {
   class State : public ZarrShardingCodec::PreparedState,
                 public internal::LexicographicalGridIndexKeyParser {
    public:
+    // Encodes/decodes a complete shard through the sub-chunk codec chain.
+    //
+    // The zarr3 driver does not use these methods: it accesses sub-chunks
+    // individually through the kvstore adapter returned by
+    // `GetSubChunkKvstore`, which encodes and decodes each sub-chunk as a
+    // separate task on the `data_copy_concurrency` executor.  These methods
+    // provide the full-shard path used when the sharding codec is invoked as
+    // an ordinary codec chain.  Sub-chunks are processed in shard index
+    // (C order) for deterministic output.
     absl::Status EncodeArray(SharedArrayView<const void> decoded,
                              riegeli::Writer& writer) const final {
-      return absl::InternalError("");
+      const span<const Index> sub_chunk_shape =
+          sub_chunk_grid->components[0].shape();
+      const DimensionIndex rank = sub_chunk_shape.size();
+      assert(decoded.rank() == rank);
+      zarr3_sharding_indexed::ShardEntries entries;
+      const int64_t num_sub_chunks = shard_index_params_.num_entries;
+      entries.entries.resize(num_sub_chunks);
+      Index grid_cell[kMaxRank];
+      for (int64_t i = 0; i < num_sub_chunks; ++i) {
+        GetContiguousIndices<c_order, Index>(
+            i, sub_chunk_grid_shape_, span<Index>(&grid_cell[0], rank));
+        Index byte_offset = 0;
+        for (DimensionIndex d = 0; d < rank; ++d) {
+          byte_offset +=
+              grid_cell[d] * sub_chunk_shape[d] * decoded.byte_strides()[d];
+        }
+        SharedArrayView<const void> sub_chunk_array(
+            AddByteOffset(decoded.element_pointer(), byte_offset),
+            StridedLayoutView<>(sub_chunk_shape, decoded.byte_strides()));
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            entries.entries[i],
+            sub_chunk_codec_state->EncodeArray(std::move(sub_chunk_array)));
+      }
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto encoded, zarr3_sharding_indexed::EncodeShard(
+                            entries, shard_index_params_));
+      assert(encoded.has_value());
+      if (!writer.Write(*std::move(encoded))) return writer.status();
+      return absl::OkStatus();
     }
     Result<SharedArray<const void>> DecodeArray(
         span<const Index> decoded_shape, riegeli::Reader& reader) const final {
-      return absl::InternalError("");
+      absl::Cord shard_data;
+      TENSORSTORE_RETURN_IF_ERROR(riegeli::ReadAll(reader, shard_data));
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto entries, zarr3_sharding_indexed::DecodeShard(
+                            shard_data, shard_index_params_));
+      const span<const Index> sub_chunk_shape =
+          sub_chunk_grid->components[0].shape();
+      const DimensionIndex rank = sub_chunk_shape.size();
+      assert(decoded_shape.size() == rank);
+      auto full_array = AllocateArray(decoded_shape, c_order, default_init,
+                                      sub_chunk_grid->components[0].dtype());
+      Index grid_cell[kMaxRank];
+      for (int64_t i = 0; i < shard_index_params_.num_entries; ++i) {
+        auto& entry = entries.entries[i];
+        if (!entry) {
+          return absl::DataLossError(
+              tensorstore::StrCat("Missing sub-chunk ", i, " in shard"));
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto sub_chunk_array, sub_chunk_codec_state->DecodeArray(
+                                      sub_chunk_shape, std::move(*entry)));
+        GetContiguousIndices<c_order, Index>(
+            i, sub_chunk_grid_shape_, span<Index>(&grid_cell[0], rank));
+        Index byte_offset = 0;
+        for (DimensionIndex d = 0; d < rank; ++d) {
+          byte_offset +=
+              grid_cell[d] * sub_chunk_shape[d] * full_array.byte_strides()[d];
+        }
+        CopyArray(sub_chunk_array,
+                  ArrayView<void>(AddByteOffset(full_array.element_pointer(),
+                                                byte_offset),
+                                  StridedLayoutView<>(
+                                      sub_chunk_shape,
+                                      full_array.byte_strides())));
+      }
+      return full_array;
     }
 
     kvstore::DriverPtr GetSubChunkKvstore(
@@ -33,7 +33,9 @@ using ::tensorstore::MatchesJson;
 using ::tensorstore::MatchesStatus;
 using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
 using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
+using ::tensorstore::internal_zarr3::TestCodecRoundTrip;
 using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
 using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
 
@@ -62,6 +64,33 @@ TEST(ShardingIndexedTest, Basic) {
                          }}}}));
 }
 
+TEST(ShardingIndexedTest, RoundTrip) {
+  CodecRoundTripTestParams p;
+  p.shape = {4, 6};
+  p.spec = ::nlohmann::json::array_t{
+      {{"name", "sharding_indexed"},
+       {"configuration",
+        {
+            {"chunk_shape", {2, 3}},
+            {"codecs",
+             {{
+                 {"name", "bytes"},
+                 {"configuration", {{"endian", "little"}}},
+             }}},
+            {"index_codecs",
+             {
+                 {
+                     {"name", "bytes"},
+                     {"configuration", {{"endian", "little"}}},
+                 },
+                 {
+                     {"name", "crc32c"},
+                 },
+             }},
+        }}}};
+  TestCodecRoundTrip(p);
+}
+
 TEST(ShardingIndexedTest, InvalidBytesToBytes) {
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto spec, ZarrCodecChainSpec::FromJson({
@@ -122,6 +122,26 @@ class TransposeCodec : public ZarrArrayToArrayCodec {
   explicit TransposeCodec(std::vector<DimensionIndex> inverse_order)
       : inverse_order_(std::move(inverse_order)) {}
 
+  ZarrArrayToArrayCodec::Ptr TryCompose(
+      const ZarrArrayToArrayCodec& next) const final {
+    auto* next_transpose = dynamic_cast<const TransposeCodec*>(&next);
+    if (!next_transpose ||
+        next_transpose->inverse_order_.size() != inverse_order_.size()) {
+      return nullptr;
+    }
+    // `*this` maps decoded dimension `i` to encoded dimension
+    // `inverse_order_[i]`, which `next` then maps to
+    // `next.inverse_order_[inverse_order_[i]]`.
+    std::vector<DimensionIndex> fused_inverse_order(inverse_order_.size());
+    for (DimensionIndex i = 0;
+         i < static_cast<DimensionIndex>(inverse_order_.size()); ++i) {
+      fused_inverse_order[i] =
+          next_transpose->inverse_order_[inverse_order_[i]];
+    }
+    return internal::MakeIntrusivePtr<TransposeCodec>(
+        std::move(fused_inverse_order));
+  }
+
   class State : public ZarrArrayToArrayCodec::PreparedState {
    public:
     span<const Index> encoded_shape() const final { return encoded_shape_; }
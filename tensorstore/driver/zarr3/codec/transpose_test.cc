@@ -14,22 +14,44 @@
 
 #include <stdint.h>
 
+#include <utility>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/random/random.h"
 #include "absl/status/status.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/array_testutil.h"
+#include "tensorstore/contiguous_layout.h"
 #include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
 #include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_spec.h"
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/data_type_random_generator.h"
 #include "tensorstore/internal/json_gtest.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
 
+using ::tensorstore::AllocateArray;
+using ::tensorstore::c_order;
 using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::MatchesArrayIdentically;
 using ::tensorstore::MatchesJson;
 using ::tensorstore::MatchesStatus;
+using ::tensorstore::Result;
+using ::tensorstore::span;
+using ::tensorstore::value_init;
+using ::tensorstore::internal::MakeRandomArray;
 using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
 using ::tensorstore::internal_zarr3::CodecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::CodecSpecRoundTripTestParams;
 using ::tensorstore::internal_zarr3::GetDefaultBytesCodecJson;
@@ -37,6 +59,7 @@ using ::tensorstore::internal_zarr3::TestCodecMerge;
 using ::tensorstore::internal_zarr3::TestCodecRoundTrip;
 using ::tensorstore::internal_zarr3::TestCodecSpecResolve;
 using ::tensorstore::internal_zarr3::TestCodecSpecRoundTrip;
+using ::tensorstore::internal_zarr3::ZarrCodecChain;
 using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
 
 TEST(TransposeTest, Basic) {
@@ -92,6 +115,48 @@ TEST(TransposeTest, RoundTrip) {
   TestCodecRoundTrip(p);
 }
 
+TEST(TransposeTest, FuseAdjacent) {
+  const auto resolve =
+      [](::nlohmann::json json_spec) -> Result<ZarrCodecChain::Ptr> {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto spec, ZarrCodecChainSpec::FromJson(json_spec,
+                                                {/*.constraints=*/true}));
+    ArrayCodecResolveParameters decoded_params;
+    decoded_params.dtype = dtype_v<uint16_t>;
+    decoded_params.rank = 3;
+    decoded_params.fill_value = AllocateArray(span<const Index>{}, c_order,
+                                              value_init, decoded_params.dtype);
+    BytesCodecResolveParameters encoded_params;
+    return spec.Resolve(std::move(decoded_params), encoded_params);
+  };
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto fused_chain,
+      resolve(
+          {{{"name", "transpose"}, {"configuration", {{"order", {2, 1, 0}}}}},
+           {{"name", "transpose"}, {"configuration", {{"order", {1, 0, 2}}}}}}));
+  // The two adjacent transpose codecs are fused into a single codec.
+  EXPECT_EQ(1, fused_chain->array_to_array.size());
+  // The fused codec is equivalent to the composed permutation.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto single_chain,
+      resolve(
+          {{{"name", "transpose"}, {"configuration", {{"order", {1, 2, 0}}}}}}));
+  const std::vector<Index> shape{30, 40, 50};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto fused_state,
+                                   fused_chain->Prepare(shape));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto single_state,
+                                   single_chain->Prepare(shape));
+  absl::BitGen gen;
+  auto data = MakeRandomArray(gen, shape, dtype_v<uint16_t>, c_order);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto fused_encoded,
+                                   fused_state->EncodeArray(data));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto single_encoded,
+                                   single_state->EncodeArray(data));
+  EXPECT_EQ(single_encoded, fused_encoded);
+  EXPECT_THAT(fused_state->DecodeArray(shape, fused_encoded),
+              ::testing::Optional(MatchesArrayIdentically(data)));
+}
+
 TEST(TransposeTest, RankMismatch) {
   ArrayCodecResolveParameters p;
   p.dtype = dtype_v<uint16_t>;
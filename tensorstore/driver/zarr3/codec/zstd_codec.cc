@@ -17,10 +17,15 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "absl/status/status.h"
+#include "absl/strings/escaping.h"
+#include <nlohmann/json.hpp>
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "riegeli/zstd/zstd_dictionary.h"
 #include "riegeli/zstd/zstd_reader.h"
 #include "riegeli/zstd/zstd_writer.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
@@ -28,7 +33,9 @@
 #include "tensorstore/driver/zarr3/codec/registry.h"
 #include "tensorstore/internal/global_initializer.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json/value_as.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/json_binding/std_optional.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
 
@@ -40,8 +47,11 @@ using ::riegeli::ZstdWriterBase;
 
 class ZstdCodec : public ZarrBytesToBytesCodec {
  public:
-  explicit ZstdCodec(int level, bool checksum)
-      : level_(level), checksum_(checksum) {}
+  explicit ZstdCodec(int level, bool checksum,
+                     riegeli::ZstdDictionary dictionary)
+      : level_(level),
+        checksum_(checksum),
+        dictionary_(std::move(dictionary)) {}
 
   class State : public ZarrBytesToBytesCodec::PreparedState {
    public:
@@ -51,6 +61,11 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
       Writer::Options options;
       options.set_compression_level(level_);
       options.set_store_checksum(checksum_);
+      if (!dictionary_.empty()) {
+        // The digested dictionary is computed once and cached within the
+        // shared dictionary representation.
+        options.set_dictionary(dictionary_);
+      }
       if (decoded_size_ != -1) {
         options.set_pledged_size(decoded_size_);
       }
@@ -61,11 +76,15 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
         riegeli::Reader& encoded_reader) const final {
       using Reader = riegeli::ZstdReader<riegeli::Reader*>;
       Reader::Options options;
+      if (!dictionary_.empty()) {
+        options.set_dictionary(dictionary_);
+      }
       return std::make_unique<Reader>(&encoded_reader, options);
     }
 
     int level_;
     bool checksum_;
+    riegeli::ZstdDictionary dictionary_;
     int64_t decoded_size_;
   };
 
@@ -73,6 +92,7 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
     auto state = internal::MakeIntrusivePtr<State>();
     state->level_ = level_;
     state->checksum_ = checksum_;
+    state->dictionary_ = dictionary_;
     state->decoded_size_ = decoded_size;
     return state;
   }
@@ -80,6 +100,25 @@ class ZstdCodec : public ZarrBytesToBytesCodec {
  private:
   int level_;
   bool checksum_;
+  riegeli::ZstdDictionary dictionary_;
+};
+
+// JSON binder for the raw dictionary bytes, represented in JSON as a
+// base64-encoded string.
+constexpr auto Base64Binder = [](auto is_loading, const auto& options,
+                                 auto* obj,
+                                 ::nlohmann::json* j) -> absl::Status {
+  if constexpr (is_loading) {
+    if (!j->is_string() ||
+        !absl::Base64Unescape(j->get<std::string>(), obj)) {
+      return internal_json::ExpectedError(*j, "base64-encoded string");
+    }
+  } else {
+    std::string encoded;
+    absl::Base64Escape(*obj, &encoded);
+    *j = std::move(encoded);
+  }
+  return absl::OkStatus();
 };
 
 }  // namespace
@@ -91,6 +130,8 @@ absl::Status ZstdCodecSpec::MergeFrom(const ZarrCodecSpec& other, bool strict) {
       MergeConstraint<&Options::level>("level", options, other_options));
   TENSORSTORE_RETURN_IF_ERROR(
       MergeConstraint<&Options::checksum>("checksum", options, other_options));
+  TENSORSTORE_RETURN_IF_ERROR(MergeConstraint<&Options::dictionary>(
+      "dictionary", options, other_options, Base64Binder));
   return absl::OkStatus();
 }
 
@@ -108,12 +149,17 @@ Result<ZarrBytesToBytesCodec::Ptr> ZstdCodecSpec::Resolve(
     if (options.level && options.checksum) {
       resolved_spec->reset(this);
     } else {
-      resolved_spec->reset(
-          new ZstdCodecSpec(Options{resolved_level, resolved_checksum}));
+      resolved_spec->reset(new ZstdCodecSpec(
+          Options{resolved_level, resolved_checksum, options.dictionary}));
     }
   }
+  riegeli::ZstdDictionary dictionary;
+  if (options.dictionary) {
+    dictionary.set_data(*options.dictionary);
+  }
   return internal::MakeIntrusivePtr<ZstdCodec>(resolved_level,
-                                               resolved_checksum);
+                                               resolved_checksum,
+                                               std::move(dictionary));
 }
 
 TENSORSTORE_GLOBAL_INITIALIZER {
@@ -130,7 +176,9 @@ TENSORSTORE_GLOBAL_INITIALIZER {
                              ZstdWriterBase::Options::kMaxCompressionLevel)))),
           jb::Member("checksum",
                      jb::Projection<&Options::checksum>(
-                         OptionalIfConstraintsBinder())))  //
+                         OptionalIfConstraintsBinder())),
+          jb::Member("dictionary", jb::Projection<&Options::dictionary>(
+                                       jb::Optional(Base64Binder))))  //
                                      ));
 }
 
@@ -16,6 +16,7 @@
 #define TENSORSTORE_DRIVER_ZARR3_CODEC_ZSTD_CODEC_H_
 
 #include <optional>
+#include <string>
 
 #include "absl/status/status.h"
 #include "tensorstore/driver/zarr3/codec/codec.h"
@@ -30,6 +31,13 @@ class ZstdCodecSpec : public ZarrBytesToBytesCodecSpec {
   struct Options {
     std::optional<int> level;
     std::optional<bool> checksum;
+
+    /// Optional shared compression dictionary (raw bytes), stored in the codec
+    /// configuration as a base64-encoded string.  This is a TensorStore
+    /// extension to the zarr v3 `zstd` codec, intended for datasets of many
+    /// small similar chunks, where a dictionary trained offline on sampled
+    /// chunks substantially improves the compression ratio.
+    std::optional<std::string> dictionary;
   };
   ZstdCodecSpec() = default;
   explicit ZstdCodecSpec(const Options& options) : options(options) {}
@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string>
+
 #include <gtest/gtest.h>
+#include "absl/strings/escaping.h"
 #include "tensorstore/driver/zarr3/codec/codec_test_util.h"
 
 namespace {
@@ -67,4 +70,38 @@ TEST(ZstdTest, RoundTrip) {
   TestCodecRoundTrip(p);
 }
 
+TEST(ZstdTest, DictionarySpecRoundTrip) {
+  std::string dictionary = "some shared dictionary contents";
+  std::string encoded_dictionary;
+  absl::Base64Escape(dictionary, &encoded_dictionary);
+  CodecSpecRoundTripTestParams p;
+  p.orig_spec = {
+      {{"name", "zstd"},
+       {"configuration",
+        {{"level", 7},
+         {"checksum", false},
+         {"dictionary", encoded_dictionary}}}},
+  };
+  p.expected_spec = {
+      GetDefaultBytesCodecJson(),
+      {{"name", "zstd"},
+       {"configuration",
+        {{"level", 7},
+         {"checksum", false},
+         {"dictionary", encoded_dictionary}}}},
+  };
+  TestCodecSpecRoundTrip(p);
+}
+
+TEST(ZstdTest, DictionaryRoundTrip) {
+  std::string encoded_dictionary;
+  absl::Base64Escape("some shared dictionary contents", &encoded_dictionary);
+  CodecRoundTripTestParams p;
+  p.spec = {
+      {{"name", "zstd"},
+       {"configuration", {{"dictionary", encoded_dictionary}}}},
+  };
+  TestCodecRoundTrip(p);
+}
+
 }  // namespace
@@ -52,6 +52,7 @@
 #include "tensorstore/kvstore/test_util.h"
 #include "tensorstore/open.h"
 #include "tensorstore/open_mode.h"
+#include "tensorstore/progress.h"
 #include "tensorstore/read_write_options.h"
 #include "tensorstore/schema.h"
 #include "tensorstore/spec.h"
@@ -147,6 +148,123 @@ TEST(ZarrDriverTest, ShardedTranspose) {
   EXPECT_THAT(tensorstore::Read(store).result(), ::testing::Optional(array));
 }
 
+// Tests that pipelined non-transactional writes to sub-chunks of the same
+// shard (issued without waiting for the previous write to complete, so that
+// they may coalesce into a single shard writeback) produce the correct
+// result.
+TEST(ZarrDriverTest, ShardedPipelinedWrites) {
+  std::vector<Index> shape{8, 8};
+  auto array = tensorstore::AllocateArray<uint16_t>(shape);
+  for (Index i = 0; i < shape[0]; ++i) {
+    for (Index j = 0; j < shape[1]; ++j) {
+      array(i, j) = static_cast<uint16_t>(i * 100 + j);
+    }
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(
+          {
+              {"driver", "zarr3"},
+              {"kvstore", "memory://"},
+              {"metadata",
+               {
+                   {"data_type", "uint16"},
+                   {"shape", shape},
+                   {"chunk_grid",
+                    {{"name", "regular"},
+                     {"configuration", {{"chunk_shape", {8, 8}}}}}},
+                   {"codecs",
+                    {
+                        {{"name", "sharding_indexed"},
+                         {"configuration", {{"chunk_shape", {2, 2}}}}},
+                    }},
+               }},
+          },
+          tensorstore::OpenMode::create)
+          .result());
+  std::vector<tensorstore::WriteFutures> futures;
+  for (Index i = 0; i < shape[0]; i += 2) {
+    for (Index j = 0; j < shape[1]; j += 2) {
+      futures.push_back(tensorstore::Write(
+          array | tensorstore::Dims(0, 1).SizedInterval({i, j}, {2, 2}),
+          store | tensorstore::Dims(0, 1).SizedInterval({i, j}, {2, 2})));
+    }
+  }
+  for (auto& future : futures) {
+    TENSORSTORE_ASSERT_OK(future.status());
+  }
+  EXPECT_THAT(tensorstore::Read(store).result(), ::testing::Optional(array));
+}
+
+TEST(ZarrDriverTest, Prefetch) {
+  ::nlohmann::json json_spec{
+      {"driver", "zarr3"},
+      {"kvstore",
+       {
+           {"driver", "mock_key_value_store"},
+           {"path", "prefix/"},
+       }},
+      {"metadata",
+       {
+           {"data_type", "uint16"},
+           {"shape", {8, 8}},
+           {"chunk_grid",
+            {{"name", "regular"},
+             {"configuration", {{"chunk_shape", {4, 4}}}}}},
+       }},
+      {"recheck_cached_metadata", false},
+      {"recheck_cached_data", false},
+  };
+  auto array = tensorstore::AllocateArray<uint16_t>({8, 8});
+  for (Index i = 0; i < 8; ++i) {
+    for (Index j = 0; j < 8; ++j) {
+      array(i, j) = static_cast<uint16_t>(i * 100 + j);
+    }
+  }
+
+  {
+    // Populate the store using a separate context, so that the cache used for
+    // the prefetch below starts out empty.
+    auto write_context = Context::Default();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto mock_key_value_store_resource,
+        write_context
+            .GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+    (*mock_key_value_store_resource)->forward_to =
+        tensorstore::GetMemoryKeyValueStore();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto store, tensorstore::Open(json_spec, write_context,
+                                      tensorstore::OpenMode::create)
+                        .result());
+    TENSORSTORE_ASSERT_OK(tensorstore::Write(array, store));
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto context,
+      Context::FromJson(
+          {{"cache_pool", {{"total_bytes_limit", 1024 * 1024 * 10}}}}));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto mock_key_value_store_resource,
+      context.GetResource<tensorstore::internal::MockKeyValueStoreResource>());
+  auto mock_kvstore = *mock_key_value_store_resource;
+  mock_kvstore->forward_to = tensorstore::GetMemoryKeyValueStore();
+  mock_kvstore->log_requests = true;
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(json_spec, context, tensorstore::OpenMode::open)
+          .result());
+  mock_kvstore->request_log.pop_all();
+
+  // Prefetching fetches each of the 4 chunks into the cache.
+  TENSORSTORE_ASSERT_OK(tensorstore::Prefetch(store));
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(4));
+
+  // The subsequent read is satisfied entirely from the cache.
+  EXPECT_THAT(tensorstore::Read(store).result(), ::testing::Optional(array));
+  EXPECT_THAT(mock_kvstore->request_log.pop_all(), ::testing::SizeIs(0));
+}
+
 TENSORSTORE_GLOBAL_INITIALIZER {
   tensorstore::internal::TensorStoreDriverBasicFunctionalityTestOptions options;
   options.test_name = "zarr3";
@@ -418,6 +418,11 @@ absl::Status ComputeStridedSliceMap(OptionallyImplicitIndexInterval orig,
 Result<IndexInterval> GetAffineTransformDomain(IndexInterval interval,
                                                Index offset, Index divisor) {
   assert(divisor != 0);
+  if (offset == 0 && divisor == 1) {
+    // Fast path for the identity case, which dominates bounds propagation
+    // through slice-only transforms and cannot overflow.
+    return interval;
+  }
   if (interval == IndexInterval()) {
     // Special case for fully unbounded interval.  Divisor and offset don't need
     // to be checked in this case (and the checks below are too restrictive for
@@ -1105,6 +1105,22 @@ TEST(GetAffineTransformDomainTest, Divisor1) {
                 .value());
 }
 
+TEST(GetAffineTransformDomainTest, IdentityFastPath) {
+  // Identity transforms must return the interval unchanged, including
+  // unbounded, partially-bounded, and empty intervals.
+  for (auto interval : {
+           IndexInterval(),
+           IndexInterval::UncheckedClosed(1, 9),
+           IndexInterval::UncheckedClosed(-kInfIndex, 9),
+           IndexInterval::UncheckedClosed(1, kInfIndex),
+           IndexInterval::UncheckedSized(10, 0),
+       }) {
+    EXPECT_EQ(interval, GetAffineTransformDomain(interval, /*offset=*/0,
+                                                 /*divisor=*/1)
+                            .value());
+  }
+}
+
 TEST(GetAffineTransformDomainTest, Divisor2) {
   EXPECT_EQ(IndexInterval::UncheckedClosed(-2, 1),
             GetAffineTransformDomain(IndexInterval::UncheckedClosed(1, 9),
@@ -30,6 +30,7 @@ using ::tensorstore::Index;
 using ::tensorstore::IndexInterval;
 using ::tensorstore::IndexTransformBuilder;
 using ::tensorstore::IndexTransformView;
+using ::tensorstore::internal_index_space::ComposeTransformsCache;
 using ::tensorstore::kMaxFiniteIndex;
 using ::tensorstore::MakeArray;
 using ::tensorstore::MatchesStatus;
@@ -58,6 +59,40 @@ TEST(ComposeTransformsTest, EmptyDomain) {
   EXPECT_EQ(expected_a_to_c, a_to_c);
 }
 
+TEST(ComposeTransformsTest, Rank4Strided) {
+  // Exercises the output-rank-specialized composition kernel with a mixture of
+  // strided and constant maps.
+  auto b_to_c = IndexTransformBuilder<4, 4>()
+                    .input_origin({0, 1, 2, 3})
+                    .input_shape({4, 4, 4, 4})
+                    .output_single_input_dimension(0, 5, 2, 1)
+                    .output_single_input_dimension(1, -3, -1, 0)
+                    .output_constant(2, 8)
+                    .output_single_input_dimension(3, 0, 1, 3)
+                    .Finalize()
+                    .value();
+  auto a_to_b = IndexTransformBuilder<4, 4>()
+                    .input_origin({0, 0, 0, 0})
+                    .input_shape({4, 4, 4, 4})
+                    .output_single_input_dimension(0, 0, 1, 1)
+                    .output_single_input_dimension(1, 1, 1, 0)
+                    .output_constant(2, 2)
+                    .output_single_input_dimension(3, 3, 1, 2)
+                    .Finalize()
+                    .value();
+  auto a_to_c = ComposeTransforms(b_to_c, a_to_b).value();
+  auto expected_a_to_c = IndexTransformBuilder<4, 4>()
+                             .input_origin({0, 0, 0, 0})
+                             .input_shape({4, 4, 4, 4})
+                             .output_single_input_dimension(0, 7, 2, 0)
+                             .output_single_input_dimension(1, -3, -1, 1)
+                             .output_constant(2, 8)
+                             .output_single_input_dimension(3, 3, 1, 2)
+                             .Finalize()
+                             .value();
+  EXPECT_EQ(expected_a_to_c, a_to_c);
+}
+
 TEST(ComposeTransformsTest, TransformArrayError) {
   auto b_to_c = IndexTransformBuilder<1, 1>()
                     .input_origin({0})
@@ -346,4 +381,89 @@ TEST(ComposeTransformsTest, TransformIndexArraySkipRepeatedElements) {
               ::testing::ElementsAre(8, 0));
 }
 
+TEST(ComposeTransformsCacheTest, RepeatedComposition) {
+  auto b_to_c = IndexTransformBuilder<2, 2>()
+                    .input_origin({0, 0})
+                    .input_shape({100, 100})
+                    .output_single_input_dimension(0, 10, 2, 0)
+                    .output_single_input_dimension(1, -5, 3, 1)
+                    .Finalize()
+                    .value();
+  auto a_to_b = IndexTransformBuilder<2, 2>()
+                    .input_origin({0, 0})
+                    .input_shape({4, 4})
+                    .output_identity_transform()
+                    .Finalize()
+                    .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected,
+                                   ComposeTransforms(b_to_c, a_to_b));
+  ComposeTransformsCache cache;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto composed1,
+                                   cache.Compose(b_to_c, a_to_b));
+  EXPECT_EQ(expected, composed1);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto composed2,
+                                   cache.Compose(b_to_c, a_to_b));
+  EXPECT_EQ(expected, composed2);
+}
+
+TEST(ComposeTransformsCacheTest, TranslatedDomain) {
+  auto b_to_c = IndexTransformBuilder<2, 2>()
+                    .input_origin({0, 0})
+                    .input_shape({100, 100})
+                    .output_single_input_dimension(0, 10, 2, 0)
+                    .output_single_input_dimension(1, -5, 3, 1)
+                    .Finalize()
+                    .value();
+  ComposeTransformsCache cache;
+  // Compose with cell transforms that differ only by translation, as produced
+  // when iterating over grid cells.
+  for (Index origin = 0; origin < 12; origin += 4) {
+    auto a_to_b = IndexTransformBuilder<2, 2>()
+                      .input_origin({origin, 0})
+                      .input_shape({4, 4})
+                      .output_identity_transform()
+                      .Finalize()
+                      .value();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected,
+                                     ComposeTransforms(b_to_c, a_to_b));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto composed,
+                                     cache.Compose(b_to_c, a_to_b));
+    EXPECT_EQ(expected, composed) << "origin=" << origin;
+  }
+}
+
+TEST(ComposeTransformsCacheTest, IndexArrayFallback) {
+  auto b_to_c = IndexTransformBuilder<1, 1>()
+                    .input_origin({0})
+                    .input_shape({10})
+                    .output_identity_transform()
+                    .Finalize()
+                    .value();
+  ComposeTransformsCache cache;
+  auto a_to_b0 = IndexTransformBuilder<1, 1>()
+                     .input_origin({0})
+                     .input_shape({2})
+                     .output_index_array(0, 0, 1, MakeArray<Index>({3, 5}))
+                     .Finalize()
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected0,
+                                   ComposeTransforms(b_to_c, a_to_b0));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto composed0,
+                                   cache.Compose(b_to_c, a_to_b0));
+  EXPECT_EQ(expected0, composed0);
+  // Index array maps depend on the input domain, and must not be reused when
+  // only the domain matches.
+  auto a_to_b1 = IndexTransformBuilder<1, 1>()
+                     .input_origin({1})
+                     .input_shape({2})
+                     .output_index_array(0, 0, 1, MakeArray<Index>({2, 7}))
+                     .Finalize()
+                     .value();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected1,
+                                   ComposeTransforms(b_to_c, a_to_b1));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto composed1,
+                                   cache.Compose(b_to_c, a_to_b1));
+  EXPECT_EQ(expected1, composed1);
+}
+
 }  // namespace
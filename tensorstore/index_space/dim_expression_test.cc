@@ -537,4 +537,19 @@ TEST(DimExpressionTest, DimRange) {
   EXPECT_EQ(322, ((*view)(2)));
 }
 
+TEST(DimExpressionTest, ChainedOpsReuseUniqueTransformStorage) {
+  /// Regression test for the performance property that applying a chain of
+  /// rank-preserving operations to a uniquely-owned transform rewrites the
+  /// same transform storage in place, rather than building an intermediate
+  /// transform per operation.
+  auto transform = tensorstore::IdentityTransform(BoxView({0, 2}, {5, 6}));
+  const Index* const origin_data = transform.domain().origin().data();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto new_transform,
+      Dims(0).TranslateBy(5).Stride(2).Label("x")(std::move(transform)));
+  EXPECT_EQ(origin_data, new_transform.domain().origin().data());
+  EXPECT_EQ(BoxView({3, 2}, {2, 6}), new_transform.domain().box());
+  EXPECT_EQ("x", new_transform.domain().labels()[0]);
+}
+
 }  // namespace
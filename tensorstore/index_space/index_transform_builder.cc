@@ -17,13 +17,105 @@
 #include "absl/base/optimization.h"
 #include "absl/status/status.h"
 #include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/internal/transform_rep_impl.h"
 #include "tensorstore/internal/dimension_labels.h"
 #include "tensorstore/internal/integer_overflow.h"
+#include "tensorstore/util/byte_strided_pointer.h"
 
 namespace tensorstore {
 namespace internal_index_space {
 
+namespace {
+
+/// Attempts to replace the index array map `map`, whose index array was
+/// specified by `index_array` (already validated to be broadcast-compatible
+/// with the input domain), with an equivalent `constant` or
+/// `single_input_dimension` map.
+///
+/// The replacement is performed only if the index array varies along at most
+/// one input dimension with a constant step, every array element is contained
+/// in the finite subset of `map.index_array_data().index_range`, and the
+/// equivalent offset and stride do not overflow; otherwise, `map` is left
+/// unchanged.
+void MaybeConvertStridedIndexArray(
+    const SharedArrayView<const Index, dynamic_rank, offset_origin>&
+        index_array,
+    span<const Index> input_origin, span<const Index> input_shape,
+    OutputIndexMap& map) {
+  const DimensionIndex input_rank = input_shape.size();
+  const IndexArrayData& index_array_data = map.index_array_data();
+  // Determine the single input dimension, if any, along which the index array
+  // varies.  Note that `index_array_data.byte_strides` has already been set to
+  // `0` for broadcast dimensions.
+  DimensionIndex array_dim = -1;
+  for (DimensionIndex input_dim = 0; input_dim < input_rank; ++input_dim) {
+    if (index_array_data.byte_strides[input_dim] == 0 ||
+        input_shape[input_dim] <= 1) {
+      continue;
+    }
+    if (array_dim != -1) return;
+    array_dim = input_dim;
+  }
+  // Bounds checking of index array values normally occurs lazily when the
+  // transform is used.  To preserve those lazy errors, only convert if every
+  // value is valid.
+  const IndexInterval index_range = index_array_data.index_range;
+  const auto value_is_valid = [&](Index value) {
+    return IsFiniteIndex(value) && Contains(index_range, value);
+  };
+  const Index first_value = *index_array.byte_strided_origin_pointer();
+  if (!value_is_valid(first_value)) return;
+  Index step = 0;
+  if (array_dim != -1) {
+    ByteStridedPointer<const Index> pointer =
+        index_array.byte_strided_origin_pointer();
+    const Index byte_stride = index_array.byte_strides()[array_dim];
+    Index prev_value = first_value;
+    for (Index i = 1; i < input_shape[array_dim]; ++i) {
+      pointer += byte_stride;
+      const Index value = *pointer;
+      if (!value_is_valid(value)) return;
+      Index diff;
+      if (internal::SubOverflow(value, prev_value, &diff)) return;
+      if (i == 1) {
+        step = diff;
+      } else if (diff != step) {
+        return;
+      }
+      prev_value = value;
+    }
+  }
+  // The map is equivalent to:
+  //
+  //     `output = (offset + stride * (first_value - step * input_origin))
+  //             + (stride * step) * input`.
+  Index new_stride;
+  Index new_offset;
+  if (internal::MulOverflow(map.stride(), step, &new_stride) ||
+      internal::MulOverflow(map.stride(), first_value, &new_offset) ||
+      internal::AddOverflow(map.offset(), new_offset, &new_offset)) {
+    return;
+  }
+  if (array_dim != -1 && new_stride != 0) {
+    Index origin_term;
+    if (internal::MulOverflow(new_stride, input_origin[array_dim],
+                              &origin_term) ||
+        internal::SubOverflow(new_offset, origin_term, &new_offset)) {
+      return;
+    }
+  }
+  if (array_dim == -1 || new_stride == 0) {
+    map.SetConstant();
+  } else {
+    map.SetSingleInputDimension(array_dim);
+  }
+  map.offset() = new_offset;
+  map.stride() = new_stride;
+}
+
+}  // namespace
+
 void InitializeTransformRepForBuilder(TransformRep* data) {
   assert(data != nullptr);
   const DimensionIndex output_rank = data->output_rank;
@@ -182,6 +274,11 @@ absl::Status SetOutputIndexMapsAndValidateTransformRep(
                 initializer.index_array.layout().origin_byte_offset(),
                 IndexInnerProduct(input_rank, input_origin.data(),
                                   index_array_data.byte_strides)));
+        if ((flags & BuilderFlags::kSimplifyStridedIndexArrays) !=
+            BuilderFlags::kDefault) {
+          MaybeConvertStridedIndexArray(initializer.index_array, input_origin,
+                                        input_shape, map);
+        }
       }
     } else if (initializer.input_dimension) {
       const DimensionIndex input_dim = *initializer.input_dimension;
@@ -66,7 +66,10 @@ enum class BuilderFlags : unsigned int {
   kSetUpper = 4,
 
   /// Indicates that `implicit_upper_bounds` was called.
-  kSetImplicitUpper = 8
+  kSetImplicitUpper = 8,
+
+  /// Indicates that `simplify_strided_index_arrays` was called.
+  kSimplifyStridedIndexArrays = 16,
 };
 
 inline BuilderFlags operator|(BuilderFlags a, BuilderFlags b) {
@@ -801,6 +804,29 @@ class IndexTransformBuilder {
     return *this;
   }
 
+  /// Requests that `Finalize` replace index array output index maps whose
+  /// values follow a constant-stride pattern with equivalent `constant` or
+  /// `single_input_dimension` maps.
+  ///
+  /// User-supplied index arrays are frequently affine (e.g. the result of an
+  /// `arange`-style slice); converting them back to strided maps allows
+  /// iteration to use fast strided copies rather than gather-based iteration.
+  /// An index array map is only replaced if it varies along at most one input
+  /// dimension with a constant step, every array element is contained in the
+  /// finite subset of its `index_range`, and the equivalent offset and stride
+  /// are representable without overflow; otherwise the index array map is
+  /// retained unchanged.
+  ///
+  /// This conversion is not enabled by default because the representation of a
+  /// transform is observable (e.g. via comparison and conversion to JSON), and
+  /// callers may depend on index array maps being preserved exactly.
+  ///
+  /// \pre `valid() == true`
+  IndexTransformBuilder& simplify_strided_index_arrays() {
+    flags_ |= internal_index_space::BuilderFlags::kSimplifyStridedIndexArrays;
+    return *this;
+  }
+
   /// Validates and returns the specified index transform.
   ///
   /// \pre `valid() == true`
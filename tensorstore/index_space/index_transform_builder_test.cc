@@ -14,6 +14,7 @@
 
 #include "tensorstore/index_space/index_transform_builder.h"
 
+#include <limits>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -587,6 +588,130 @@ TEST(IndexTransformBuilderTest, IndexArrayWithEmptyExplicitDomain) {
               ::testing::Optional(expected));
 }
 
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayAffine) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected,  //
+                                   IndexTransformBuilder(1, 1)
+                                       .input_origin({1})
+                                       .input_shape({3})
+                                       .output_single_input_dimension(0, 7, 18,
+                                                                      0)
+                                       .Finalize());
+  EXPECT_THAT(IndexTransformBuilder(1, 1)
+                  .input_origin({1})
+                  .input_shape({3})
+                  .output_index_array(0, 7, 9, MakeArray<Index>({2, 4, 6}))
+                  .simplify_strided_index_arrays()
+                  .Finalize(),
+              ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayConstant) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected,  //
+                                   IndexTransformBuilder(2, 1)
+                                       .input_shape({2, 3})
+                                       .output_constant(0, 11)
+                                       .Finalize());
+  // All elements are equal, so the index array reduces to a constant map.
+  EXPECT_THAT(IndexTransformBuilder(2, 1)
+                  .input_shape({2, 3})
+                  .output_index_array(0, 1, 2, MakeArray<Index>({{5, 5, 5}}))
+                  .simplify_strided_index_arrays()
+                  .Finalize(),
+              ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayBroadcast) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto expected,  //
+                                   IndexTransformBuilder(2, 1)
+                                       .input_origin({2, 0})
+                                       .input_shape({2, 3})
+                                       .output_single_input_dimension(0, 3, -2,
+                                                                      1)
+                                       .Finalize());
+  // The index array is broadcast along input dimension 0 and affine along
+  // input dimension 1.
+  EXPECT_THAT(IndexTransformBuilder(2, 1)
+                  .input_origin({2, 0})
+                  .input_shape({2, 3})
+                  .output_index_array(0, 1, 2, MakeArray<Index>({{1, 0, -1}}))
+                  .simplify_strided_index_arrays()
+                  .Finalize(),
+              ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayNotAffine) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto expected,  //
+      IndexTransformBuilder(1, 1)
+          .input_shape({3})
+          .output_index_array(0, 0, 1, MakeArray<Index>({1, 2, 4}))
+          .Finalize());
+  EXPECT_THAT(IndexTransformBuilder(1, 1)
+                  .input_shape({3})
+                  .output_index_array(0, 0, 1, MakeArray<Index>({1, 2, 4}))
+                  .simplify_strided_index_arrays()
+                  .Finalize(),
+              ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayMultipleDimensions) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto expected,  //
+      IndexTransformBuilder(2, 1)
+          .input_shape({2, 2})
+          .output_index_array(0, 0, 1, MakeArray<Index>({{1, 2}, {3, 4}}))
+          .Finalize());
+  // The index array varies along more than one input dimension, and is
+  // retained even though it is affine in each dimension separately.
+  EXPECT_THAT(
+      IndexTransformBuilder(2, 1)
+          .input_shape({2, 2})
+          .output_index_array(0, 0, 1, MakeArray<Index>({{1, 2}, {3, 4}}))
+          .simplify_strided_index_arrays()
+          .Finalize(),
+      ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayOutOfRange) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto expected,  //
+      IndexTransformBuilder(1, 1)
+          .input_shape({3})
+          .output_index_array(0, 0, 1, MakeArray<Index>({2, 4, 6}),
+                              IndexInterval::Closed(0, 4))
+          .Finalize());
+  // Element `6` is outside the index range; the index array is retained so
+  // that the error still occurs lazily when the transform is used.
+  EXPECT_THAT(IndexTransformBuilder(1, 1)
+                  .input_shape({3})
+                  .output_index_array(0, 0, 1, MakeArray<Index>({2, 4, 6}),
+                                      IndexInterval::Closed(0, 4))
+                  .simplify_strided_index_arrays()
+                  .Finalize(),
+              ::testing::Optional(expected));
+}
+
+TEST(IndexTransformBuilderTest, SimplifyStridedIndexArrayOverflow) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto expected,  //
+      IndexTransformBuilder(1, 1)
+          .input_shape({2})
+          .output_index_array(
+              0, 0, 2,
+              MakeArray<Index>({0, std::numeric_limits<Index>::max() / 2 + 1}))
+          .Finalize());
+  // The equivalent stride would overflow, so the index array is retained.
+  EXPECT_THAT(
+      IndexTransformBuilder(1, 1)
+          .input_shape({2})
+          .output_index_array(
+              0, 0, 2,
+              MakeArray<Index>({0, std::numeric_limits<Index>::max() / 2 + 1}))
+          .simplify_strided_index_arrays()
+          .Finalize(),
+      ::testing::Optional(expected));
+}
+
 TEST(IndexDomainBuilderTest, Null) {
   IndexDomainBuilder builder(nullptr);
   EXPECT_FALSE(builder.valid());
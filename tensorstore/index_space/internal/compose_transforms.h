@@ -46,6 +46,44 @@ Result<IndexTransform<dynamic_rank, dynamic_rank, container>> ComposeTransforms(
     IndexTransform<dynamic_rank, dynamic_rank, container> a_to_b,
     bool domain_only);
 
+/// Memoizes composition of a fixed `b_to_c` transform with a sequence of
+/// `a_to_b` transforms that differ only by translation of their input domains,
+/// as produced when iterating over the grid cells of a chunked view.
+///
+/// When `b_to_c` matches the previously-composed transform and the new
+/// `a_to_b` is identical to the previous one except for its input domain
+/// bounds (and neither transform uses an index array map), the output index
+/// maps of the composed transform do not depend on the input domain and are
+/// copied from the previous result; only the input domain is recomputed via
+/// `PropagateBounds`.
+///
+/// The cache holds references to the previous transforms.  Since a transform
+/// representation is only modified in place while uniquely owned, a cached
+/// pointer match guarantees the contents are unchanged.
+///
+/// This class is not thread-safe; use a separate instance per iteration.
+class ComposeTransformsCache {
+ public:
+  /// Returns the composition of `b_to_c` and `a_to_b`, equivalent to
+  /// `ComposeTransforms(b_to_c.get(), false, a_to_b.get(), false,
+  /// domain_only)`.
+  Result<TransformRep::Ptr<>> Compose(TransformRep::Ptr<> b_to_c,
+                                      TransformRep::Ptr<> a_to_b,
+                                      bool domain_only = false);
+
+  /// Same as above, but with `IndexTransform` parameters.
+  Result<IndexTransform<dynamic_rank, dynamic_rank, container>> Compose(
+      IndexTransform<dynamic_rank, dynamic_rank, container> b_to_c,
+      IndexTransform<dynamic_rank, dynamic_rank, container> a_to_b,
+      bool domain_only = false);
+
+ private:
+  TransformRep::Ptr<> b_to_c_;
+  TransformRep::Ptr<> a_to_b_;
+  TransformRep::Ptr<> result_;
+  bool domain_only_ = false;
+};
+
 }  // namespace internal_index_space
 }  // namespace tensorstore
 
@@ -112,15 +112,22 @@ absl::Status PropagateBoundsImpl(BoxView<> b,
     }
     const DimensionIndex a_dim = map.input_dimension();
     assert(a_dim >= 0 && a_dim < a.rank());
-    // TODO(jbms): In some cases, this will result in a result_out_of_range
-    // error even though we could have obtained a non-overflowed bound from a
-    // different dimension, or from the input domain.
-    TENSORSTORE_ASSIGN_OR_RETURN(
-        OptionallyImplicitIndexInterval propagated_a_bounds,
-        GetAffineTransformDomain(b_bounds_oi, map.offset(), map.stride()),
-        MaybeAnnotateStatus(
-            _, tensorstore::StrCat("Propagating bounds from dimension ", b_dim,
-                                   " to input dimension ", a_dim)));
+    OptionallyImplicitIndexInterval propagated_a_bounds;
+    if (map.offset() == 0 && output_stride == 1) {
+      // Identity maps (the common case for slice-only transforms) propagate
+      // the bounds unchanged and cannot overflow.
+      propagated_a_bounds = b_bounds_oi;
+    } else {
+      // TODO(jbms): In some cases, this will result in a result_out_of_range
+      // error even though we could have obtained a non-overflowed bound from a
+      // different dimension, or from the input domain.
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          propagated_a_bounds,
+          GetAffineTransformDomain(b_bounds_oi, map.offset(), map.stride()),
+          MaybeAnnotateStatus(
+              _, tensorstore::StrCat("Propagating bounds from dimension ",
+                                     b_dim, " to input dimension ", a_dim)));
+    }
     propagated_a_bounds = IntersectPreferringExplicit(
         propagated_a_bounds,
         OptionallyImplicitIndexInterval{a[a_dim],
@@ -39,6 +39,48 @@ void FreeIndexArrayData(IndexArrayData* data) {
   std::free(data);
 }
 
+/// Transforms with input and output rank <= `kSmallRankCapacity` account for
+/// the vast majority of allocations (per-chunk transform churn is dominated by
+/// rank <= 4 arrays), so their fixed-size blocks are cached on a per-thread
+/// free list rather than returned to the global allocator.
+constexpr DimensionIndex kSmallRankCapacity = 4;
+
+/// Maximum number of cached blocks per thread.
+constexpr size_t kSmallRepFreeListLimit = 32;
+
+constexpr size_t SmallRepAllocationSize() {
+  return sizeof(TransformRep) + sizeof(OutputIndexMap) * kSmallRankCapacity +
+         kSmallRankCapacity * (sizeof(Index) * 2 + sizeof(std::string));
+}
+
+struct SmallRepFreeList {
+  struct Node {
+    Node* next;
+  };
+
+  Node* head = nullptr;
+  size_t size = 0;
+
+  ~SmallRepFreeList() {
+    while (head != nullptr) {
+      Node* node = head;
+      head = node->next;
+      ::operator delete(static_cast<void*>(node));
+    }
+  }
+};
+
+thread_local SmallRepFreeList small_rep_free_list;
+
+/// Returns `true` if the block for the given capacities is served by the
+/// per-thread free list.  All allocations with both capacities <=
+/// `kSmallRankCapacity` use a block of size `SmallRepAllocationSize()`.
+constexpr bool IsSmallRep(DimensionIndex input_rank_capacity,
+                          DimensionIndex output_rank_capacity) {
+  return input_rank_capacity <= kSmallRankCapacity &&
+         output_rank_capacity <= kSmallRankCapacity;
+}
+
 void CopyTrivialFields(TransformRep* source, TransformRep* dest) {
   assert(dest->input_rank_capacity >= source->input_rank &&
          dest->output_rank_capacity >= source->output_rank);
@@ -141,14 +183,26 @@ TransformRep::Ptr<> TransformRep::Allocate(
   ABSL_CHECK(input_rank_capacity >= 0 && output_rank_capacity >= 0 &&
              input_rank_capacity <= kMaxRank &&
              output_rank_capacity <= kMaxRank);
-  const size_t total_size =
-      // header size
-      sizeof(TransformRep) +
-      // size of OutputIndexMap array
-      sizeof(OutputIndexMap) * output_rank_capacity +
-      // size of input_origin, input_shape, and input_labels arrays
-      input_rank_capacity * (sizeof(Index) * 2 + sizeof(std::string));
-  char* base_ptr = static_cast<char*>(::operator new(total_size));
+  char* base_ptr;
+  if (IsSmallRep(input_rank_capacity, output_rank_capacity) &&
+      small_rep_free_list.head != nullptr) {
+    auto* node = small_rep_free_list.head;
+    small_rep_free_list.head = node->next;
+    --small_rep_free_list.size;
+    base_ptr = reinterpret_cast<char*>(node);
+  } else {
+    const size_t total_size =
+        IsSmallRep(input_rank_capacity, output_rank_capacity)
+            ? SmallRepAllocationSize()
+            :
+            // header size
+            sizeof(TransformRep) +
+                // size of OutputIndexMap array
+                sizeof(OutputIndexMap) * output_rank_capacity +
+                // size of input_origin, input_shape, and input_labels arrays
+                input_rank_capacity * (sizeof(Index) * 2 + sizeof(std::string));
+    base_ptr = static_cast<char*>(::operator new(total_size));
+  }
   TransformRep* ptr =  // NOLINT
       new (base_ptr + sizeof(OutputIndexMap) * output_rank_capacity)
           TransformRep;
@@ -168,9 +222,19 @@ void DestroyLabelFields(TransformRep* ptr) {
 
 void TransformRep::Free(TransformRep* ptr) {
   assert(ptr->reference_count == 0);
+  const bool is_small =
+      IsSmallRep(ptr->input_rank_capacity, ptr->output_rank_capacity);
   DestroyLabelFields(ptr);
   std::destroy_n(ptr->output_index_maps().begin(), ptr->output_rank_capacity);
-  ::operator delete(static_cast<void*>(ptr->output_index_maps().data()));
+  void* block = static_cast<void*>(ptr->output_index_maps().data());
+  if (is_small && small_rep_free_list.size < kSmallRepFreeListLimit) {
+    auto* node = new (block) SmallRepFreeList::Node;
+    node->next = small_rep_free_list.head;
+    small_rep_free_list.head = node;
+    ++small_rep_free_list.size;
+    return;
+  }
+  ::operator delete(block);
 }
 
 void CopyTransformRep(TransformRep* source, TransformRep* dest) {
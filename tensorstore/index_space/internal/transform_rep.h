@@ -341,6 +341,10 @@ struct TransformRep {
   /// `::operator new` (either throws `std::bad_alloc` or terminates the
   /// program).
   ///
+  /// Allocations with both capacities <= 4 are served from a per-thread cache
+  /// of fixed-size blocks, so the common case of slicing/composing small-rank
+  /// transforms does not hit the global allocator.
+  ///
   /// \dchecks `input_rank_capacity >= 0`
   /// \dchecks `output_rank_capacity >= 0`
   /// \returns A non-null transform representation pointer.
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
+
 #include <benchmark/benchmark.h>
 #include "absl/log/absl_check.h"
 #include "tensorstore/index.h"
@@ -33,12 +35,20 @@ struct BenchmarkArrayConfig {
   std::vector<Index> shape;
   std::vector<DimensionIndex> order;
   std::vector<bool> indexed;
+  /// Dimensions to broadcast (stride 0): the allocated array is indexed at
+  /// position 0 of the dimension regardless of the iteration position.  May be
+  /// empty to indicate no broadcasting.
+  std::vector<bool> broadcast;
 };
 std::ostream& operator<<(std::ostream& os, const BenchmarkArrayConfig& config) {
-  return os << "s=" << span(config.shape) << ", o=" << span(config.order)
-            << ", i="
-            << span(std::vector<int>(config.indexed.begin(),
-                                     config.indexed.end()));
+  os << "s=" << span(config.shape) << ", o=" << span(config.order) << ", i="
+     << span(std::vector<int>(config.indexed.begin(), config.indexed.end()));
+  if (!config.broadcast.empty()) {
+    os << ", b="
+       << span(std::vector<int>(config.broadcast.begin(),
+                                config.broadcast.end()));
+  }
+  return os;
 }
 
 tensorstore::TransformedSharedArray<char> Allocate(
@@ -65,6 +75,15 @@ tensorstore::TransformedSharedArray<char> Allocate(
                       .OuterIndexArraySlice(index_array)(std::move(transform))
                       .value();
     }
+    if (!config.broadcast.empty() && config.broadcast[i]) {
+      // Replace dimension `i` by a dummy dimension of the same extent that
+      // does not affect the array position (stride 0).
+      transform =
+          tensorstore::Dims(i).IndexSlice(0)(std::move(transform)).value();
+      transform = tensorstore::Dims(i).AddNew().SizedInterval(
+          0, copy_shape[i])(std::move(transform))
+                      .value();
+    }
   }
   return MakeTransformedArray(std::move(array), std::move(transform)).value();
 }
@@ -100,8 +119,28 @@ void BenchmarkCopy(const BenchmarkConfig& config, ::benchmark::State& state) {
         },
         config.constraints, source, dest));
   }
+  state.SetItemsProcessed(state.iterations());
 }
 
+/// Copies the same number of elements with a raw pointer loop, as an upper
+/// bound to compare the transformed-array iteration overhead against.
+void BenchmarkRawLoopCopy(::benchmark::State& state) {
+  const Index num_elements = state.range(0);
+  std::vector<char> source(num_elements), dest(num_elements);
+  while (state.KeepRunningBatch(num_elements)) {
+    const char* source_ptr = source.data();
+    char* dest_ptr = dest.data();
+    for (Index i = 0; i < num_elements; ++i) dest_ptr[i] = source_ptr[i];
+    ::benchmark::DoNotOptimize(dest_ptr);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BenchmarkRawLoopCopy)
+    ->Arg(16 * 16 * 16)
+    ->Arg(32 * 32 * 32)
+    ->Arg(64 * 64 * 64)
+    ->Arg(128 * 128 * 128);
+
 struct RegisterIterateBenchmarks {
   static void Register(const BenchmarkConfig& config) {
     ::benchmark::RegisterBenchmark(
@@ -188,6 +227,60 @@ struct RegisterIterateBenchmarks {
            /*order=*/{0, 1, 2},
            /*indexed=*/{true, false, false}},
       });
+
+      // Index-array-driven gather from a transposed source into a strided
+      // destination (mixed affine+array transform).
+      Register({
+          /*copy_shape=*/{size, size, size},
+          /*constraints=*/{},
+          /*source=*/
+          {/*shape=*/{size, size, size},
+           /*order=*/{2, 1, 0},
+           /*indexed=*/{true, false, true}},
+          /*dest=*/
+          {/*shape=*/{size, size, size},
+           /*order=*/{0, 1, 2},
+           /*indexed=*/{false, false, false}},
+      });
+
+      // Broadcast source dimension (stride 0).
+      Register({
+          /*copy_shape=*/{size, size, size},
+          /*constraints=*/{},
+          /*source=*/
+          {/*shape=*/{size, size, size},
+           /*order=*/{0, 1, 2},
+           /*indexed=*/{false, false, false},
+           /*broadcast=*/{false, true, false}},
+          /*dest=*/
+          {/*shape=*/{size, size, size},
+           /*order=*/{0, 1, 2},
+           /*indexed=*/{false, false, false}},
+      });
+    }
+
+    // Rank sweep: contiguous copies of approximately 2^18 elements at ranks 1
+    // to 8, to measure the per-dimension overhead of the iteration machinery.
+    for (DimensionIndex rank = 1; rank <= 8; ++rank) {
+      const Index extent = static_cast<Index>(
+          std::round(std::pow(2.0, 18.0 / static_cast<double>(rank))));
+      std::vector<Index> shape(rank, extent);
+      std::vector<DimensionIndex> order(rank);
+      for (DimensionIndex i = 0; i < rank; ++i) order[i] = i;
+      std::vector<DimensionIndex> reversed_order(order.rbegin(), order.rend());
+      std::vector<bool> indexed(rank, false);
+      Register({
+          /*copy_shape=*/shape,
+          /*constraints=*/{},
+          /*source=*/{shape, order, indexed},
+          /*dest=*/{shape, order, indexed},
+      });
+      Register({
+          /*copy_shape=*/shape,
+          /*constraints=*/{},
+          /*source=*/{shape, order, indexed},
+          /*dest=*/{shape, reversed_order, indexed},
+      });
     }
   }
 } register_iterate_benchmarks_;
@@ -21,6 +21,7 @@
 #include <new>
 #include <utility>
 
+#include "absl/numeric/bits.h"
 #include "tensorstore/internal/exception_macros.h"
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/util/span.h"
@@ -28,6 +29,101 @@
 namespace tensorstore {
 namespace internal {
 
+/// Thread-local pool of heap blocks, bucketed by power-of-two size class.
+///
+/// Used by `Arena` for allocations that do not fit in the fixed-size buffer,
+/// and to recycle cache entry and transaction node storage (see
+/// `internal/cache/cache.h`).
+///
+/// Blocks are rounded up to a power-of-two size class and retained on a
+/// per-thread free list when deallocated (up to `kMaxRetainedBytes` per
+/// thread), so repeated per-chunk operations reuse blocks instead of
+/// round-tripping through `operator new`.  Blocks may be released on a
+/// different thread than they were allocated on; they are simply retained by
+/// the releasing thread's pool.
+class ArenaHeapBlockPool {
+ public:
+  /// Pooled blocks are allocated with this alignment; requests with greater
+  /// alignment bypass the pool.
+  constexpr static size_t kAlignment = 64;
+  constexpr static size_t kMinBlockBytes = 64;
+  constexpr static size_t kMaxBlockBytes = size_t{1} << 20;
+  constexpr static size_t kMaxRetainedBytes = size_t{4} << 20;
+
+  ArenaHeapBlockPool() = default;
+  ArenaHeapBlockPool(const ArenaHeapBlockPool&) = delete;
+  ArenaHeapBlockPool& operator=(const ArenaHeapBlockPool&) = delete;
+
+  ~ArenaHeapBlockPool() {
+    for (size_t c = 0; c < kNumClasses; ++c) {
+      const size_t block_bytes = kMinBlockBytes << c;
+      FreeBlock* block = free_lists_[c];
+      while (block) {
+        FreeBlock* next = block->next;
+        ::operator delete(static_cast<void*>(block), block_bytes,
+                          std::align_val_t(kAlignment));
+        block = next;
+      }
+    }
+  }
+
+  /// Returns `true` if an allocation may be served from the pool.  Both
+  /// `Allocate` and `Deallocate` must agree, so eligibility depends only on
+  /// the request.
+  static bool Eligible(size_t num_bytes, size_t alignment) {
+    return alignment <= kAlignment && num_bytes <= kMaxBlockBytes;
+  }
+
+  void* Allocate(size_t num_bytes) {
+    const size_t block_bytes = BlockBytes(num_bytes);
+    const size_t c = ClassIndex(block_bytes);
+    if (FreeBlock* block = free_lists_[c]) {
+      free_lists_[c] = block->next;
+      retained_bytes_ -= block_bytes;
+      return static_cast<void*>(block);
+    }
+    return ::operator new(block_bytes, std::align_val_t(kAlignment));
+  }
+
+  void Deallocate(void* p, size_t num_bytes) {
+    const size_t block_bytes = BlockBytes(num_bytes);
+    if (retained_bytes_ + block_bytes > kMaxRetainedBytes) {
+      ::operator delete(p, block_bytes, std::align_val_t(kAlignment));
+      return;
+    }
+    const size_t c = ClassIndex(block_bytes);
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next = free_lists_[c];
+    free_lists_[c] = block;
+    retained_bytes_ += block_bytes;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  constexpr static size_t kNumClasses =
+      absl::countr_zero(kMaxBlockBytes) - absl::countr_zero(kMinBlockBytes) + 1;
+
+  static size_t BlockBytes(size_t num_bytes) {
+    return absl::bit_ceil(num_bytes | kMinBlockBytes);
+  }
+
+  static size_t ClassIndex(size_t block_bytes) {
+    return absl::countr_zero(block_bytes) - absl::countr_zero(kMinBlockBytes);
+  }
+
+  FreeBlock* free_lists_[kNumClasses] = {};
+  size_t retained_bytes_ = 0;
+};
+
+/// Returns the calling thread's block pool.
+inline ArenaHeapBlockPool& GetArenaHeapBlockPool() {
+  thread_local ArenaHeapBlockPool pool;
+  return pool;
+}
+
 /// Simple memory allocation arena implementation.
 ///
 /// Allocations are served from the optional fixed-size buffer provided to the
@@ -62,6 +158,8 @@ class Arena {
     void* ptr = static_cast<void*>(initial_buffer_.end() - remaining_bytes_);
     if (std::align(alignment, num_bytes, ptr, remaining_bytes_)) {
       remaining_bytes_ -= num_bytes;
+    } else if (ArenaHeapBlockPool::Eligible(num_bytes, alignment)) {
+      ptr = GetArenaHeapBlockPool().Allocate(num_bytes);
     } else {
       ptr = ::operator new(num_bytes, std::align_val_t(alignment));
     }
@@ -84,7 +182,12 @@ class Arena {
                                initial_buffer_.size())) {
       return;
     }
-    ::operator delete(static_cast<void*>(p), n * sizeof(T),
+    const size_t num_bytes = n * sizeof(T);
+    if (ArenaHeapBlockPool::Eligible(num_bytes, alignment)) {
+      GetArenaHeapBlockPool().Deallocate(static_cast<void*>(p), num_bytes);
+      return;
+    }
+    ::operator delete(static_cast<void*>(p), num_bytes,
                       std::align_val_t(alignment));
   }
 
@@ -98,4 +98,22 @@ TEST(ArenaTest, MultipleSmall) {
   EXPECT_THAT(vec4, ::testing::ElementsAreArray(std::vector<int32_t>(5, 8)));
 }
 
+// Tests that heap blocks are reused across Arena instances on the same
+// thread.
+TEST(ArenaTest, HeapBlockReuse) {
+  void* first = nullptr;
+  {
+    Arena arena;
+    unsigned char* ptr = arena.allocate(2000, 16);
+    first = ptr;
+    arena.deallocate(ptr, 2000, 16);
+  }
+  {
+    Arena arena;
+    unsigned char* ptr = arena.allocate(2000, 16);
+    EXPECT_EQ(first, ptr);
+    arena.deallocate(ptr, 2000, 16);
+  }
+}
+
 }  // namespace
@@ -23,6 +23,7 @@
 #include "absl/base/optimization.h"
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/array.h"
 #include "tensorstore/box.h"
 #include "tensorstore/contiguous_layout.h"
@@ -75,16 +76,51 @@ SharedArrayView<const void> AsyncWriteArray::Spec::GetFillValueForDomain(
                           overall_fill_value.byte_strides().data()));
 }
 
+Result<IndexTransform<>> AsyncWriteArray::ReadTransformCache::GetComposed(
+    StridedLayoutView<dynamic_rank, offset_origin> data_layout,
+    IndexTransform<> chunk_transform) {
+  {
+    absl::MutexLock lock(&mutex_);
+    if (composed_transform_.valid() && data_layout_ == data_layout &&
+        chunk_transform_ == chunk_transform) {
+      return composed_transform_;
+    }
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto composed, ComposeLayoutAndTransform(data_layout, chunk_transform));
+  absl::MutexLock lock(&mutex_);
+  data_layout_ = StridedLayout<dynamic_rank, offset_origin>(data_layout);
+  chunk_transform_ = std::move(chunk_transform);
+  composed_transform_ = composed;
+  return composed;
+}
+
 Result<NDIterable::Ptr> AsyncWriteArray::Spec::GetReadNDIterable(
     SharedArrayView<const void> array, BoxView<> domain,
     IndexTransform<> chunk_transform, Arena* arena) const {
+  return GetReadNDIterable(std::move(array), domain, std::move(chunk_transform),
+                           /*transform_cache=*/nullptr, arena);
+}
+
+Result<NDIterable::Ptr> AsyncWriteArray::Spec::GetReadNDIterable(
+    SharedArrayView<const void> array, BoxView<> domain,
+    IndexTransform<> chunk_transform, ReadTransformCache* transform_cache,
+    Arena* arena) const {
   if (!array.valid()) array = GetFillValueForDomain(domain);
   assert(internal::RangesEqual(array.shape(), domain.shape()));
   StridedLayoutView<dynamic_rank, offset_origin> data_layout(
       domain, array.byte_strides());
-  TENSORSTORE_ASSIGN_OR_RETURN(
-      chunk_transform,
-      ComposeLayoutAndTransform(data_layout, std::move(chunk_transform)));
+  if (transform_cache) {
+    // The composed transform may be shared with the cache and with concurrent
+    // reads; any subsequent in-place modification will copy it first.
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        chunk_transform,
+        transform_cache->GetComposed(data_layout, std::move(chunk_transform)));
+  } else {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        chunk_transform,
+        ComposeLayoutAndTransform(data_layout, std::move(chunk_transform)));
+  }
   return GetTransformedArrayNDIterable(
       {AddByteOffset(std::move(array.element_pointer()),
                      -data_layout.origin_byte_offset()),
@@ -24,8 +24,10 @@
 
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/array.h"
 #include "tensorstore/box.h"
 #include "tensorstore/contiguous_layout.h"
@@ -65,6 +67,31 @@ struct AsyncWriteArray {
       : write_state(std::move(other.write_state)),
         read_generation(std::move(other.read_generation)) {}
 
+  /// Thread-safe one-slot cache of the composed transform computed by
+  /// `Spec::GetReadNDIterable`.
+  ///
+  /// Steady-state workloads repeatedly read the same chunk through the same
+  /// view (e.g. once per training epoch).  The composition of the chunk data
+  /// layout with the read transform depends only on the layout and the
+  /// transform, and therefore need not be recomputed for such repeated reads.
+  class ReadTransformCache {
+   public:
+    /// Returns the composition of `data_layout` with `chunk_transform`,
+    /// equivalent to
+    /// `ComposeLayoutAndTransform(data_layout, chunk_transform)`, reusing the
+    /// previously-computed composition if both arguments are unchanged.
+    Result<IndexTransform<>> GetComposed(
+        StridedLayoutView<dynamic_rank, offset_origin> data_layout,
+        IndexTransform<> chunk_transform);
+
+   private:
+    absl::Mutex mutex_;
+    StridedLayout<dynamic_rank, offset_origin> data_layout_
+        ABSL_GUARDED_BY(mutex_);
+    IndexTransform<> chunk_transform_ ABSL_GUARDED_BY(mutex_);
+    IndexTransform<> composed_transform_ ABSL_GUARDED_BY(mutex_);
+  };
+
   struct Spec {
     Spec() = default;
 
@@ -137,6 +164,15 @@ struct AsyncWriteArray {
                                               IndexTransform<> chunk_transform,
                                               Arena* arena) const;
 
+    /// Same as above, but additionally consults `transform_cache` (which may
+    /// be `nullptr`) to avoid recomputing the composition of the chunk layout
+    /// with `chunk_transform` when the same view repeatedly reads the same
+    /// chunk.
+    Result<NDIterable::Ptr> GetReadNDIterable(
+        SharedArrayView<const void> array, BoxView<> domain,
+        IndexTransform<> chunk_transform, ReadTransformCache* transform_cache,
+        Arena* arena) const;
+
     size_t EstimateReadStateSizeInBytes(
         bool valid, tensorstore::span<const Index> shape) const {
       if (!valid) return 0;
@@ -140,6 +140,54 @@ TEST(SpecTest, Basic) {
   }
 }
 
+TEST(SpecTest, ReadTransformCache) {
+  auto overall_fill_value = MakeOffsetArray<int32_t>(
+      {-2, 0}, {
+                   {1, 2, 3, 4, 5, 6, 7, 8, 9},
+                   {11, 12, 13, 14, 15, 16, 17, 18, 19},
+                   {21, 22, 23, 24, 25, 26, 27, 28, 29},
+                   {31, 32, 33, 34, 35, 36, 37, 38, 39},
+               });
+  tensorstore::Box<> component_bounds({-1, -kInfIndex}, {3, kInfSize});
+  Spec spec{overall_fill_value, component_bounds};
+
+  auto read_array = MakeArray<int32_t>({{7, 8, 9}, {10, 11, 12}});
+  AsyncWriteArray::ReadTransformCache transform_cache;
+
+  const auto read_with_cache = [&](tensorstore::IndexTransform<> transform,
+                                   tensorstore::span<const Index> shape) {
+    Arena arena;
+    auto iterable =
+        spec.GetReadNDIterable(read_array, /*domain=*/BoxView<>({2, 6}, {2, 3}),
+                               std::move(transform), &transform_cache, &arena)
+            .value();
+    return CopyNDIterable(std::move(iterable), shape, &arena);
+  };
+
+  auto transform_a =
+      tensorstore::IdentityTransform(tensorstore::Box<>({2, 6}, {2, 2}));
+  auto expected_a = MakeArray<int32_t>({{7, 8}, {10, 11}});
+
+  // First read populates the cache; the second repeats the same chunk
+  // transform and layout and is served from the cache.
+  EXPECT_EQ(expected_a, read_with_cache(transform_a,
+                                        tensorstore::span<const Index>({2, 2})));
+  EXPECT_EQ(expected_a, read_with_cache(transform_a,
+                                        tensorstore::span<const Index>({2, 2})));
+
+  // A different chunk transform invalidates the cached composition.
+  auto transform_b =
+      tensorstore::IdentityTransform(tensorstore::Box<>({3, 7}, {1, 2}));
+  EXPECT_EQ(MakeArray<int32_t>({{11, 12}}),
+            read_with_cache(transform_b,
+                            tensorstore::span<const Index>({1, 2})));
+
+  // The original transform still produces the correct result after the cache
+  // has been replaced.
+  EXPECT_EQ(expected_a, read_with_cache(transform_a,
+                                        tensorstore::span<const Index>({2, 2})));
+}
+
 TEST(MaskedArrayTest, Basic) {
   auto overall_fill_value = MakeOffsetArray<int32_t>(
       {-2, 0}, {
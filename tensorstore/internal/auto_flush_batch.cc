@@ -0,0 +1,71 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/auto_flush_batch.h"
+
+#include <stdint.h>
+
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/thread/schedule_at.h"
+
+namespace tensorstore {
+namespace internal {
+
+Batch AutoFlushBatch::GetBatch() {
+  absl::MutexLock lock(&mutex_);
+  if (!batch_) {
+    batch_ = Batch::New();
+    if (options_.max_delay != absl::InfiniteDuration()) {
+      // The callback holds a reference to `this`, which keeps this
+      // `AutoFlushBatch` alive until the deadline expires.
+      ScheduleAt(absl::Now() + options_.max_delay,
+                 [self = IntrusivePtr<AutoFlushBatch>(this),
+                  generation = generation_]() mutable {
+                   self->DeadlineExpired(generation);
+                 });
+    }
+  }
+  Batch batch = batch_;
+  if (options_.max_joins != 0 && ++join_count_ >= options_.max_joins) {
+    FlushCurrentBatch();
+  }
+  return batch;
+}
+
+void AutoFlushBatch::Flush() {
+  absl::MutexLock lock(&mutex_);
+  FlushCurrentBatch();
+}
+
+void AutoFlushBatch::DeadlineExpired(uint64_t generation) {
+  absl::MutexLock lock(&mutex_);
+  if (generation != generation_) {
+    // The batch for which this deadline was scheduled was already flushed.
+    return;
+  }
+  FlushCurrentBatch();
+}
+
+void AutoFlushBatch::FlushCurrentBatch() {
+  batch_.Release();
+  join_count_ = 0;
+  ++generation_;
+}
+
+}  // namespace internal
+}  // namespace tensorstore
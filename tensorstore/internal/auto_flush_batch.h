@@ -0,0 +1,108 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_AUTO_FLUSH_BATCH_H_
+#define TENSORSTORE_INTERNAL_AUTO_FLUSH_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Maintains a current `Batch` that is automatically flushed after a bounded
+/// delay or a bounded number of uses.
+///
+/// This allows independent tasks, such as concurrent request handlers, to
+/// share a batch (and therefore share I/O round trips) without coordinating
+/// handle lifetimes: each task calls `GetBatch` to join the current batch and
+/// simply releases the returned handle once it has issued its operations.
+///
+/// Flushing the current batch releases only the reference owned by the
+/// `AutoFlushBatch`; consistent with the usual `Batch` semantics, the batch
+/// is submitted once the handles returned by `GetBatch` have also been
+/// released.  Consequently, a flush never interrupts a task that is still
+/// issuing operations; it merely stops new tasks from joining the batch.
+///
+/// Example usage:
+///
+///     auto auto_batch = AutoFlushBatch::Make(
+///         {/*.max_delay=*/absl::Milliseconds(5), /*.max_joins=*/100});
+///
+///     // In each request handler:
+///     {
+///       auto batch = auto_batch->GetBatch();
+///       options.batch = batch;
+///       future = kvstore::Read(store, key, std::move(options));
+///     }  // Handle released; batch submitted once flushed.
+class AutoFlushBatch : public AtomicReferenceCount<AutoFlushBatch> {
+ public:
+  struct Options {
+    /// Maximum time after a batch is started (by the first `GetBatch` call)
+    /// before it is flushed.  A value of `absl::InfiniteDuration()` disables
+    /// time-based flushing.
+    absl::Duration max_delay = absl::InfiniteDuration();
+
+    /// Number of `GetBatch` calls after which the current batch is flushed.
+    /// A value of 0 means there is no limit.
+    size_t max_joins = 0;
+  };
+
+  static IntrusivePtr<AutoFlushBatch> Make(Options options) {
+    return IntrusivePtr<AutoFlushBatch>(new AutoFlushBatch(options));
+  }
+
+  /// Returns a handle to the current batch, starting a new batch (and its
+  /// flush deadline) if there is none.
+  Batch GetBatch();
+
+  /// Flushes the current batch, if any, immediately.
+  void Flush();
+
+ private:
+  explicit AutoFlushBatch(Options options) : options_(options) {}
+
+  /// Called by the timer scheduled when a batch is started.
+  void DeadlineExpired(uint64_t generation);
+
+  /// Releases the reference to the current batch and invalidates any pending
+  /// deadline callback for it.
+  void FlushCurrentBatch() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  Options options_;
+
+  absl::Mutex mutex_;
+
+  /// Reference to the current batch that keeps it open between `GetBatch`
+  /// calls.  Equal to `no_batch` if there is no current batch.
+  Batch batch_ ABSL_GUARDED_BY(mutex_){no_batch};
+
+  /// Number of `GetBatch` calls for the current batch.
+  size_t join_count_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  /// Incremented each time the current batch is flushed, in order to
+  /// distinguish stale deadline callbacks from the one for the current batch.
+  uint64_t generation_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_AUTO_FLUSH_BATCH_H_
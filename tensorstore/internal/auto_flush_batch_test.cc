@@ -0,0 +1,109 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/auto_flush_batch.h"
+
+#include <stddef.h>
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/batch_impl.h"
+
+namespace {
+
+using ::tensorstore::Batch;
+using ::tensorstore::internal::AutoFlushBatch;
+
+// Batch entry that signals a notification when the batch is submitted.
+struct NotifyEntry : public Batch::Impl::Entry {
+  using KeyParam = absl::Notification*;
+
+  explicit NotifyEntry(absl::Notification* notification)
+      : Batch::Impl::Entry(/*nesting_depth=*/0), notification_(notification) {}
+
+  absl::Notification* notification_;
+  absl::Notification* key() const { return notification_; }
+
+  void Submit(Batch::View batch) override {
+    notification_->Notify();
+    delete this;
+  }
+};
+
+void AddNotifyEntry(Batch::View batch, absl::Notification* notification) {
+  Batch::Impl::From(batch)->GetEntry<NotifyEntry>(
+      notification, [&] { return std::make_unique<NotifyEntry>(notification); });
+}
+
+bool SameBatch(Batch::View a, Batch::View b) { return a.impl_ == b.impl_; }
+
+TEST(AutoFlushBatchTest, MaxJoins) {
+  auto auto_batch = AutoFlushBatch::Make({/*.max_delay=*/absl::InfiniteDuration(),
+                                          /*.max_joins=*/2});
+  auto batch1 = auto_batch->GetBatch();
+  auto batch2 = auto_batch->GetBatch();
+  EXPECT_TRUE(SameBatch(batch1, batch2));
+
+  // The second join reached `max_joins`, so a subsequent call starts a new
+  // batch.
+  auto batch3 = auto_batch->GetBatch();
+  EXPECT_FALSE(SameBatch(batch1, batch3));
+
+  absl::Notification submitted;
+  AddNotifyEntry(batch1, &submitted);
+
+  // The first batch was already flushed; it is submitted once the handles
+  // returned by `GetBatch` are released.
+  batch1.Release();
+  EXPECT_FALSE(submitted.HasBeenNotified());
+  batch2.Release();
+  EXPECT_TRUE(submitted.HasBeenNotified());
+}
+
+TEST(AutoFlushBatchTest, ManualFlush) {
+  auto auto_batch = AutoFlushBatch::Make({});
+  auto batch1 = auto_batch->GetBatch();
+
+  absl::Notification submitted;
+  AddNotifyEntry(batch1, &submitted);
+
+  auto_batch->Flush();
+  EXPECT_FALSE(submitted.HasBeenNotified());
+
+  auto batch2 = auto_batch->GetBatch();
+  EXPECT_FALSE(SameBatch(batch1, batch2));
+
+  batch1.Release();
+  EXPECT_TRUE(submitted.HasBeenNotified());
+}
+
+TEST(AutoFlushBatchTest, MaxDelay) {
+  auto auto_batch =
+      AutoFlushBatch::Make({/*.max_delay=*/absl::Milliseconds(1)});
+  auto batch = auto_batch->GetBatch();
+
+  absl::Notification submitted;
+  AddNotifyEntry(batch, &submitted);
+
+  // The batch is not submitted until the deadline releases the reference held
+  // by `auto_batch`.
+  batch.Release();
+  submitted.WaitForNotification();
+}
+
+}  // namespace
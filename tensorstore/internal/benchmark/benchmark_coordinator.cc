@@ -0,0 +1,171 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/benchmark/benchmark_coordinator.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/internal/json/json.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_benchmark {
+namespace {
+
+std::string BarrierKey(std::string_view name, int64_t worker_id) {
+  return tensorstore::StrCat("barrier/", name, "/", worker_id);
+}
+
+std::string ReportKey(int64_t worker_id) {
+  return tensorstore::StrCat("report/", worker_id);
+}
+
+}  // namespace
+
+absl::Status WaitAtBarrier(const CoordinatorOptions& options,
+                           std::string_view name) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto kvstore, kvstore::Open(options.kvstore_spec).result());
+  TENSORSTORE_RETURN_IF_ERROR(
+      kvstore::Write(kvstore, BarrierKey(name, options.worker_id),
+                     absl::Cord("1"))
+          .result());
+
+  const absl::Time deadline = absl::Now() + options.barrier_timeout;
+  const std::string prefix = tensorstore::StrCat("barrier/", name, "/");
+  while (true) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto entries,
+        kvstore::ListFuture(kvstore, {KeyRange::Prefix(prefix)}).result());
+    if (static_cast<int64_t>(entries.size()) >= options.num_workers) {
+      return absl::OkStatus();
+    }
+    if (absl::Now() >= deadline) {
+      return absl::DeadlineExceededError(tensorstore::StrCat(
+          "Barrier ", name, " timed out with ", entries.size(), " of ",
+          options.num_workers, " workers"));
+    }
+    absl::SleepFor(absl::Milliseconds(100));
+  }
+}
+
+absl::Status PublishWorkerReport(const CoordinatorOptions& options,
+                                 ::nlohmann::json report) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto kvstore, kvstore::Open(options.kvstore_spec).result());
+  return kvstore::Write(kvstore, ReportKey(options.worker_id),
+                        absl::Cord(report.dump()))
+      .result()
+      .status();
+}
+
+Result<std::vector<::nlohmann::json>> CollectWorkerReports(
+    const CoordinatorOptions& options) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto kvstore, kvstore::Open(options.kvstore_spec).result());
+  std::vector<::nlohmann::json> reports;
+  reports.reserve(options.num_workers);
+  for (int64_t i = 0; i < options.num_workers; ++i) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto read_result, kvstore::Read(kvstore, ReportKey(i)).result());
+    if (!read_result.has_value()) {
+      return absl::NotFoundError(
+          tensorstore::StrCat("Missing report for worker ", i));
+    }
+    reports.push_back(
+        internal_json::ParseJson(std::string(read_result.value)));
+  }
+  return reports;
+}
+
+void ReportCombinedResults(const std::vector<::nlohmann::json>& reports) {
+  // Sums the values of all metrics whose name ends with `suffix`; kvstore
+  // drivers report `/tensorstore/kvstore/<driver>/bytes_read`, etc.
+  auto sum_metric_values = [](const ::nlohmann::json& report,
+                              std::string_view suffix) -> int64_t {
+    int64_t total = 0;
+    auto it = report.find("metrics");
+    if (it == report.end() || !it->is_array()) return total;
+    for (const auto& metric : *it) {
+      auto name_it = metric.find("name");
+      if (name_it == metric.end() || !name_it->is_string()) continue;
+      const std::string name = name_it->get<std::string>();
+      if (name.size() < suffix.size() ||
+          std::string_view(name).substr(name.size() - suffix.size()) !=
+              suffix) {
+        continue;
+      }
+      auto values_it = metric.find("values");
+      if (values_it == metric.end() || !values_it->is_array()) continue;
+      for (const auto& v : *values_it) {
+        auto value_it = v.find("value");
+        if (value_it != v.end() && value_it->is_number()) {
+          total += value_it->get<int64_t>();
+        }
+      }
+    }
+    return total;
+  };
+
+  int64_t total_read = 0;
+  int64_t total_written = 0;
+  double min_elapsed = 0;
+  double max_elapsed = 0;
+  for (const auto& report : reports) {
+    const int64_t worker_id = report.value<int64_t>("worker_id", -1);
+    const double elapsed = report.value<double>("elapsed_seconds", 0);
+    const int64_t read = sum_metric_values(report, "/bytes_read");
+    const int64_t written = sum_metric_values(report, "/bytes_written");
+    total_read += read;
+    total_written += written;
+    min_elapsed = (min_elapsed == 0) ? elapsed : std::min(min_elapsed, elapsed);
+    max_elapsed = std::max(max_elapsed, elapsed);
+    std::cout << absl::StrFormat(
+                     "worker %d: %.2f seconds, read %.3f MB, wrote %.3f MB",
+                     worker_id, elapsed, read / 1e6, written / 1e6)
+              << std::endl;
+  }
+  if (max_elapsed <= 0) return;
+
+  // Combined throughput uses the slowest worker; the run is not complete
+  // until the last worker finishes.
+  std::cout << absl::StrFormat(
+                   "combined: read %.3f MB/second, wrote %.3f MB/second over "
+                   "%d workers (skew: slowest/fastest = %.2f)",
+                   total_read / 1e6 / max_elapsed,
+                   total_written / 1e6 / max_elapsed, reports.size(),
+                   min_elapsed > 0 ? max_elapsed / min_elapsed : 0)
+            << std::endl;
+}
+
+}  // namespace internal_benchmark
+}  // namespace tensorstore
@@ -0,0 +1,73 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_BENCHMARK_BENCHMARK_COORDINATOR_H_
+#define TENSORSTORE_INTERNAL_BENCHMARK_BENCHMARK_COORDINATOR_H_
+
+#include <stdint.h>
+
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_benchmark {
+
+/// Options for coordinating N benchmark worker processes through a shared
+/// kvstore.  All workers must be started with the same `kvstore_spec` and
+/// `num_workers`, and distinct `worker_id` values in `[0, num_workers)`.
+///
+/// The kvstore location should be empty at the start of a run; barrier and
+/// report keys are not cleaned up, so reusing a location across runs will
+/// cause barriers to release immediately.
+struct CoordinatorOptions {
+  kvstore::Spec kvstore_spec;
+  int64_t num_workers = 1;
+  int64_t worker_id = 0;
+  absl::Duration barrier_timeout = absl::Minutes(10);
+};
+
+/// Blocks until all `num_workers` workers have arrived at the barrier `name`,
+/// by writing a per-worker key and polling the barrier prefix.
+///
+/// \error `absl::StatusCode::kDeadlineExceeded` if the remaining workers do
+///     not arrive within `barrier_timeout`.
+absl::Status WaitAtBarrier(const CoordinatorOptions& options,
+                           std::string_view name);
+
+/// Publishes this worker's result report for aggregation.
+absl::Status PublishWorkerReport(const CoordinatorOptions& options,
+                                 ::nlohmann::json report);
+
+/// Reads the reports published by all workers.  Call only after a barrier
+/// that follows `PublishWorkerReport` on every worker.
+Result<std::vector<::nlohmann::json>> CollectWorkerReports(
+    const CoordinatorOptions& options);
+
+/// Prints combined throughput and per-worker skew from worker reports.
+///
+/// Each report is expected to contain `worker_id`, `elapsed_seconds`, and a
+/// `metrics` array as produced by `internal::CollectMetricsToJson`; bytes are
+/// summed from metrics named `.../bytes_read` and `.../bytes_written`.
+void ReportCombinedResults(const std::vector<::nlohmann::json>& reports);
+
+}  // namespace internal_benchmark
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_BENCHMARK_BENCHMARK_COORDINATOR_H_
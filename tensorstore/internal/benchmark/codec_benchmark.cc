@@ -0,0 +1,233 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks zarr3 codec chains over a matrix of chunk sizes and data types.
+//
+// Each benchmark has 3 parameters:
+//
+// BM_Encode/<codec>/<bytes>/<dtype>
+// BM_Decode/<codec>/<bytes>/<dtype>
+//
+// codec:
+//
+//   Index into the codec chain table (the resolved name is reported via the
+//   benchmark label).
+//
+// bytes:
+//
+//   Approximate decoded chunk size in bytes; the chunk shape is the largest
+//   cube not exceeding this size.
+//
+// dtype:
+//
+//   Index into the data type table (uint8, uint16, float32).
+//
+// The "bytes_per_second" statistic reports decoded bytes per second, and the
+// "ratio" counter reports `encoded_bytes / decoded_bytes`, so that codec
+// configurations can be compared empirically on both axes.
+
+#include <stdint.h>
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "absl/random/random.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_cat.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/index.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace {
+
+using ::tensorstore::AllocateArray;
+using ::tensorstore::c_order;
+using ::tensorstore::DataType;
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::SharedArray;
+using ::tensorstore::span;
+using ::tensorstore::value_init;
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::ZarrCodecChain;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
+
+struct CodecEntry {
+  std::string name;
+  ::nlohmann::json json_spec;
+};
+
+::nlohmann::json BytesCodecJson() {
+  return {{"name", "bytes"}, {"configuration", {{"endian", "little"}}}};
+}
+
+const std::vector<CodecEntry>& CodecEntries() {
+  static const auto* entries = new std::vector<CodecEntry>{
+      {"raw", {BytesCodecJson()}},
+      {"gzip6",
+       {BytesCodecJson(),
+        {{"name", "gzip"}, {"configuration", {{"level", 6}}}}}},
+      {"zstd3",
+       {BytesCodecJson(),
+        {{"name", "zstd"}, {"configuration", {{"level", 3}}}}}},
+      {"zstd9",
+       {BytesCodecJson(),
+        {{"name", "zstd"}, {"configuration", {{"level", 9}}}}}},
+      {"blosc_lz4_shuffle",
+       {BytesCodecJson(),
+        {{"name", "blosc"},
+         {"configuration",
+          {{"cname", "lz4"}, {"clevel", 5}, {"shuffle", "shuffle"}}}}}},
+      {"blosc_zstd_bitshuffle",
+       {BytesCodecJson(),
+        {{"name", "blosc"},
+         {"configuration",
+          {{"cname", "zstd"}, {"clevel", 5}, {"shuffle", "bitshuffle"}}}}}},
+      {"zstd3_crc32c",
+       {BytesCodecJson(),
+        {{"name", "zstd"}, {"configuration", {{"level", 3}}}},
+        {{"name", "crc32c"}}}},
+      {"transpose_zstd3",
+       {{{"name", "transpose"}, {"configuration", {{"order", "F"}}}},
+        BytesCodecJson(),
+        {{"name", "zstd"}, {"configuration", {{"level", 3}}}}}},
+  };
+  return *entries;
+}
+
+const std::vector<DataType>& DataTypes() {
+  static const auto* dtypes = new std::vector<DataType>{
+      dtype_v<uint8_t>, dtype_v<uint16_t>, dtype_v<float>};
+  return *dtypes;
+}
+
+// Fills `data` with a smooth ramp plus small-alphabet noise, representative
+// of imaging data that is compressible but not trivially constant.
+template <typename T>
+void FillBenchmarkData(T* data, Index num_elements) {
+  absl::BitGen gen;
+  for (Index i = 0; i < num_elements; ++i) {
+    data[i] = static_cast<T>(static_cast<uint8_t>(i >> 6) +
+                             absl::Uniform(gen, 0, 16));
+  }
+}
+
+struct BenchmarkHelper {
+  explicit BenchmarkHelper(const CodecEntry& entry, int64_t chunk_bytes,
+                           DataType dtype) {
+    // Largest cube not exceeding `chunk_bytes`.
+    const Index side = static_cast<Index>(
+        std::cbrt(static_cast<double>(chunk_bytes / dtype.size())));
+    shape.assign(3, side);
+    auto array = AllocateArray(shape, c_order, value_init, dtype);
+    const Index num_elements = array.num_elements();
+    if (dtype == dtype_v<uint8_t>) {
+      FillBenchmarkData(static_cast<uint8_t*>(array.data()), num_elements);
+    } else if (dtype == dtype_v<uint16_t>) {
+      FillBenchmarkData(static_cast<uint16_t*>(array.data()), num_elements);
+    } else {
+      FillBenchmarkData(static_cast<float*>(array.data()), num_elements);
+    }
+    source_data = std::move(array);
+    total_bytes = num_elements * dtype.size();
+
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto spec, ZarrCodecChainSpec::FromJson(entry.json_spec,
+                                                {/*.constraints=*/true}));
+    ArrayCodecResolveParameters decoded_params;
+    decoded_params.dtype = dtype;
+    decoded_params.rank = 3;
+    decoded_params.fill_value =
+        AllocateArray(span<const Index>{}, c_order, value_init, dtype);
+    BytesCodecResolveParameters encoded_params;
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto chain, spec.Resolve(std::move(decoded_params), encoded_params));
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(prepared_state, chain->Prepare(shape));
+
+    label = absl::StrCat(entry.name, "/", dtype.name(), "/", total_bytes, "b");
+  }
+
+  std::vector<Index> shape;
+  SharedArray<void> source_data;
+  int64_t total_bytes;
+  ZarrCodecChain::PreparedState::Ptr prepared_state;
+  std::string label;
+};
+
+void BM_Encode(benchmark::State& state) {
+  BenchmarkHelper helper{CodecEntries()[state.range(0)], state.range(1),
+                         DataTypes()[state.range(2)]};
+  state.SetLabel(helper.label);
+  int64_t encoded_bytes = 0;
+  for (auto s : state) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto encoded, helper.prepared_state->EncodeArray(helper.source_data));
+    encoded_bytes = encoded.size();
+    benchmark::DoNotOptimize(encoded);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          helper.total_bytes);
+  state.counters["ratio"] = static_cast<double>(encoded_bytes) /
+                            static_cast<double>(helper.total_bytes);
+}
+
+void BM_Decode(benchmark::State& state) {
+  BenchmarkHelper helper{CodecEntries()[state.range(0)], state.range(1),
+                         DataTypes()[state.range(2)]};
+  state.SetLabel(helper.label);
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto encoded, helper.prepared_state->EncodeArray(helper.source_data));
+  for (auto s : state) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto decoded,
+        helper.prepared_state->DecodeArray(helper.shape, encoded));
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          helper.total_bytes);
+  state.counters["ratio"] = static_cast<double>(encoded.size()) /
+                            static_cast<double>(helper.total_bytes);
+}
+
+template <typename Bench>
+void DefineArgs(Bench* bench) {
+  bench->ArgNames({"codec", "bytes", "dtype"});
+  for (size_t codec = 0; codec < CodecEntries().size(); ++codec) {
+    for (int64_t chunk_bytes :
+         {int64_t{16} << 10, int64_t{256} << 10, int64_t{4} << 20,
+          int64_t{64} << 20}) {
+      for (size_t dtype = 0; dtype < DataTypes().size(); ++dtype) {
+        bench->Args({static_cast<int64_t>(codec), chunk_bytes,
+                     static_cast<int64_t>(dtype)});
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_Encode)->Apply(DefineArgs);
+BENCHMARK(BM_Decode)->Apply(DefineArgs);
+
+}  // namespace
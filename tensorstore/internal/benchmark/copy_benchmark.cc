@@ -0,0 +1,209 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// Benchmark matrix for the NDIterable copy kernels.
+///
+/// Sweeps data type conversion pairs, dimension permutations, strided vs.
+/// contiguous layouts, and ranks 1-5.  Each benchmark reports bytes/s
+/// (source bytes read plus target bytes written), so throughput can be
+/// compared against memory bandwidth and tracked across hardware and copy
+/// kernel changes.
+///
+/// Run with:
+///
+///     bazel run -c opt \
+///       //tensorstore/internal/benchmark:copy_benchmark
+
+#include <stdint.h>
+
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include "tensorstore/array.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/data_type_conversion.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/index_space/transformed_array.h"
+#include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/nditerable.h"
+#include "tensorstore/internal/nditerable_array.h"
+#include "tensorstore/internal/nditerable_copy.h"
+#include "tensorstore/internal/nditerable_data_type_conversion.h"
+#include "tensorstore/internal/nditerable_transformed_array.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+namespace {
+
+using ::tensorstore::AllocateArray;
+using ::tensorstore::c_order;
+using ::tensorstore::ContiguousLayoutOrder;
+using ::tensorstore::fortran_order;
+using ::tensorstore::Index;
+using ::tensorstore::SharedOffsetArrayView;
+using ::tensorstore::TransformedArray;
+using ::tensorstore::value_init;
+using ::tensorstore::internal::Arena;
+using ::tensorstore::internal::GetArrayNDIterable;
+using ::tensorstore::internal::GetConvertedInputNDIterable;
+using ::tensorstore::internal::GetTransformedArrayNDIterable;
+using ::tensorstore::internal::NDIterable;
+using ::tensorstore::internal::NDIterableCopier;
+
+NDIterable::Ptr GetNDIterable(SharedOffsetArrayView<const void> array,
+                              Arena* arena) {
+  return GetArrayNDIterable(std::move(array), arena);
+}
+
+NDIterable::Ptr GetNDIterable(
+    TransformedArray<tensorstore::Shared<const void>> array, Arena* arena) {
+  return GetTransformedArrayNDIterable(std::move(array), arena).value();
+}
+
+/// Copies `source` to `target` (converting the data type if necessary) once
+/// per iteration, and reports the total bytes moved.
+///
+/// Iterable construction is performed inside the loop so that the reported
+/// throughput includes iteration setup cost, which matters for small shapes.
+template <typename SourceArray, typename TargetArray>
+void RunCopyBenchmark(benchmark::State& state, SourceArray source,
+                      TargetArray target,
+                      tensorstore::span<const Index> shape) {
+  const auto converter = ::tensorstore::internal::GetDataTypeConverter(
+      source.dtype(), target.dtype());
+  for (auto s : state) {
+    Arena arena;
+    auto source_iterable = GetNDIterable(source, &arena);
+    auto target_iterable = GetNDIterable(target, &arena);
+    source_iterable = GetConvertedInputNDIterable(
+        std::move(source_iterable), target_iterable->dtype(), converter);
+    NDIterableCopier copier(*source_iterable, *target_iterable, shape, &arena);
+    TENSORSTORE_CHECK_OK(copier.Copy());
+  }
+  Index num_elements = 1;
+  for (const Index size : shape) num_elements *= size;
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations()) * num_elements *
+      (source.dtype()->size + target.dtype()->size));
+}
+
+/// Contiguous C-order copy between arrays of data types `Source` and
+/// `Target`, covering both the identity copy and the elementwise conversion
+/// kernels.
+template <typename Source, typename Target>
+void BM_ConvertContiguous(benchmark::State& state) {
+  auto source =
+      AllocateArray<Source>({64, 256, 256}, c_order, value_init);
+  auto target =
+      AllocateArray<Target>({64, 256, 256}, c_order, value_init);
+  RunCopyBenchmark(state, source, target, source.shape());
+}
+
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint8_t, uint8_t);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint64_t, uint64_t);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint8_t, float);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, int8_t, float);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint16_t, float);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, int16_t, float);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, int32_t, float);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, uint16_t, double);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, int32_t, double);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, float, double);
+BENCHMARK_TEMPLATE(BM_ConvertContiguous, double, float);
+
+/// Contiguous same-dtype copy at ranks 1-5 with a fixed total element count,
+/// measuring per-rank iteration overhead.
+template <int Rank>
+void BM_CopyRank(benchmark::State& state) {
+  constexpr Index kShapes[5][5] = {
+      {4194304},
+      {2048, 2048},
+      {256, 128, 128},
+      {64, 64, 32, 32},
+      {32, 32, 16, 16, 16},
+  };
+  const tensorstore::span<const Index> shape(kShapes[Rank - 1], Rank);
+  auto source = AllocateArray<uint32_t>(shape, c_order, value_init);
+  auto target = AllocateArray<uint32_t>(shape, c_order, value_init);
+  RunCopyBenchmark(state, source, target, shape);
+}
+
+BENCHMARK_TEMPLATE(BM_CopyRank, 1);
+BENCHMARK_TEMPLATE(BM_CopyRank, 2);
+BENCHMARK_TEMPLATE(BM_CopyRank, 3);
+BENCHMARK_TEMPLATE(BM_CopyRank, 4);
+BENCHMARK_TEMPLATE(BM_CopyRank, 5);
+
+/// Copy between a C-order source and Fortran-order target (or vice versa),
+/// exercising the transpose copy path where no contiguous dimension is shared.
+template <typename T, ContiguousLayoutOrder SourceOrder,
+          ContiguousLayoutOrder TargetOrder>
+void BM_CopyPermuted(benchmark::State& state) {
+  const Index size = state.range(0);
+  auto source =
+      AllocateArray<T>({size, size, size}, SourceOrder, value_init);
+  auto target =
+      AllocateArray<T>({size, size, size}, TargetOrder, value_init);
+  RunCopyBenchmark(state, source, target, source.shape());
+}
+
+BENCHMARK_TEMPLATE(BM_CopyPermuted, uint8_t, c_order, fortran_order)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(BM_CopyPermuted, uint32_t, c_order, fortran_order)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(BM_CopyPermuted, uint32_t, fortran_order, c_order)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(BM_CopyPermuted, uint64_t, c_order, fortran_order)
+    ->Arg(64)
+    ->Arg(256);
+
+/// Copy from a strided (every-other-element along the last dimension) source
+/// into a contiguous target, exercising the strided buffer kinds.
+template <typename T>
+void BM_CopyStridedSource(benchmark::State& state) {
+  const Index size = state.range(0);
+  auto base = AllocateArray<T>({size, size * 2}, c_order, value_init);
+  auto source =
+      (base | tensorstore::Dims(1).Stride(2)).value();
+  auto target = AllocateArray<T>({size, size}, c_order, value_init);
+  RunCopyBenchmark(state, source, target, target.shape());
+}
+
+BENCHMARK_TEMPLATE(BM_CopyStridedSource, uint8_t)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_CopyStridedSource, uint32_t)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_CopyStridedSource, double)->Arg(1024);
+
+/// Copy from a contiguous source into a strided target.
+template <typename T>
+void BM_CopyStridedTarget(benchmark::State& state) {
+  const Index size = state.range(0);
+  auto source = AllocateArray<T>({size, size}, c_order, value_init);
+  auto base = AllocateArray<T>({size, size * 2}, c_order, value_init);
+  auto target =
+      (base | tensorstore::Dims(1).Stride(2)).value();
+  RunCopyBenchmark(state, source, target, source.shape());
+}
+
+BENCHMARK_TEMPLATE(BM_CopyStridedTarget, uint8_t)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_CopyStridedTarget, uint32_t)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_CopyStridedTarget, double)->Arg(1024);
+
+}  // namespace
@@ -56,6 +56,7 @@ bazel run -c opt \
 #include <string.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <iostream>
 #include <optional>
@@ -79,6 +80,7 @@ bazel run -c opt \
 #include "tensorstore/context.h"
 #include "absl/flags/parse.h"
 #include "tensorstore/internal/benchmark/metric_utils.h"
+#include "tensorstore/internal/metrics/histogram.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/metrics/registry.h"
 #include "tensorstore/internal/metrics/value.h"
@@ -120,6 +122,20 @@ ABSL_FLAG(bool, clean_before_write, false,
 
 ABSL_FLAG(size_t, read_blowup, 1, "Number of chunk reads for each read loop.");
 
+ABSL_FLAG(double, target_qps, 0,
+          "If positive, run the read benchmark open-loop, issuing reads with "
+          "Poisson arrivals at this target rate instead of issuing them all "
+          "at once.  Closed-loop runs hide queueing collapse; with open-loop "
+          "arrivals, latency grows without bound once the target rate "
+          "exceeds capacity.");
+
+ABSL_FLAG(double, warmup_seconds, 5,
+          "With --target_qps, reads issued during the first warmup_seconds "
+          "are excluded from the latency report.");
+
+ABSL_FLAG(double, measure_seconds, 30,
+          "With --target_qps, duration of the measurement phase.");
+
 ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>,
           metric_kvstore_spec, {},
           "KvStore spec for writing the metric data in json.  See examples at "
@@ -179,6 +195,51 @@ void PerOperationMetricCollection(::nlohmann::json* all_metrics,
   }
 }
 
+// Thread-safe latency histogram over the `LatencyBucketer` buckets, used to
+// derive approximate percentiles for the latency report.
+struct LatencyRecorder {
+  using Bucketer = internal_metrics::LatencyBucketer;
+
+  std::array<std::atomic<int64_t>, Bucketer::Max> buckets = {};
+  std::atomic<int64_t> count = 0;
+
+  void Record(absl::Duration latency) {
+    const double ms = absl::FDivDuration(latency, absl::Milliseconds(1));
+    buckets[Bucketer::BucketForValue(ms)].fetch_add(1,
+                                                    std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Returns the upper bound in milliseconds of bucket `b`.
+  static double BucketUpperBoundMs(size_t b) {
+    if (b <= 1) return static_cast<double>(b);
+    const size_t numerator = ((b - 2) % 4 + 5) << ((b - 2) / 4);
+    return numerator / 4.0;
+  }
+
+  // Returns an upper bound in milliseconds on the `q`-th latency quantile,
+  // e.g. `q = 0.99` for p99.
+  double PercentileMs(double q) const {
+    const int64_t total = count.load(std::memory_order_relaxed);
+    const int64_t target = static_cast<int64_t>(q * total);
+    int64_t cumulative = 0;
+    for (size_t b = 0; b < buckets.size(); ++b) {
+      cumulative += buckets[b].load(std::memory_order_relaxed);
+      if (cumulative > target) return BucketUpperBoundMs(b);
+    }
+    return BucketUpperBoundMs(Bucketer::OverflowBucket);
+  }
+
+  void PrintSummary() const {
+    std::cout << "Latency summary: "
+              << absl::StrFormat(
+                     "count=%d, p50<=%.2f ms, p99<=%.2f ms, p99.9<=%.2f ms",
+                     count.load(), PercentileMs(0.5), PercentileMs(0.99),
+                     PercentileMs(0.999))
+              << std::endl;
+  }
+};
+
 void MaybeCleanExisting(Context context, kvstore::Spec kvstore_spec) {
   // When set, delete the kvstore. For ocdbt, delete everything at "base".
   if (!absl::GetFlag(FLAGS_clean_before_write)) {
@@ -350,9 +411,11 @@ void DoReadBenchmark(Context context, kvstore::Spec kvstore_spec,
     auto start_time = absl::Now();
     std::atomic<size_t> bytes_read = 0;
     std::atomic<size_t> files_read = 0;
+    LatencyRecorder latency;
 
-    auto value_lambda = [&](Promise<void> a_promise,
+    auto value_lambda = [&](absl::Time issue_time, Promise<void> a_promise,
                             ReadyFuture<kvstore::ReadResult> a_future) {
+      latency.Record(absl::Now() - issue_time);
       files_read.fetch_add(1);
       if (a_future.result().ok()) {
         bytes_read.fetch_add(a_future.result()->value.size());
@@ -365,7 +428,11 @@ void DoReadBenchmark(Context context, kvstore::Spec kvstore_spec,
          j < std::max(size_t{1}, absl::GetFlag(FLAGS_read_blowup)); j++) {
       for (const auto& key : input.keys) {
         if (promise.ready()) break;
-        LinkValue(value_lambda, promise, kvstore::Read(kvstore, key));
+        LinkValue(
+            [&value_lambda, issue_time = absl::Now()](auto p, auto f) {
+              value_lambda(issue_time, std::move(p), std::move(f));
+            },
+            promise, kvstore::Read(kvstore, key));
       }
     }
 
@@ -384,11 +451,106 @@ void DoReadBenchmark(Context context, kvstore::Spec kvstore_spec,
               << std::endl;
 
     read_throughput.Set(throughput);
+    latency.PrintSummary();
 
     PerOperationMetricCollection(all_metrics, absl::StrFormat("read_%03d", i));
   }
 }
 
+// Open-loop read benchmark: reads arrive as a Poisson process at
+// --target_qps, independent of completions, so queueing delay shows up as
+// latency rather than as reduced throughput.  Reads issued during the warmup
+// phase are excluded from the report.
+void DoOpenLoopReadBenchmark(Context context, kvstore::Spec kvstore_spec,
+                             Prepared input, ::nlohmann::json* all_metrics) {
+  if (input.keys.empty()) {
+    std::cerr << "No keys to read." << std::endl;
+    return;
+  }
+  const double target_qps = absl::GetFlag(FLAGS_target_qps);
+  const absl::Duration warmup =
+      absl::Seconds(absl::GetFlag(FLAGS_warmup_seconds));
+  const absl::Duration measure =
+      absl::Seconds(absl::GetFlag(FLAGS_measure_seconds));
+
+  std::cout << absl::StrFormat(
+                   "Starting open-loop read benchmark. target_qps=%.1f, "
+                   "warmup=%s, measure=%s",
+                   target_qps, absl::FormatDuration(warmup),
+                   absl::FormatDuration(measure))
+            << std::endl;
+
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto kvstore, kvstore::Open(kvstore_spec, context).result());
+
+  absl::InsecureBitGen gen;
+  LatencyRecorder latency;
+  std::atomic<size_t> bytes_read = 0;
+  std::atomic<int64_t> measured_reads = 0;
+  std::atomic<int64_t> in_flight = 0;
+  std::atomic<int64_t> peak_in_flight = 0;
+
+  const absl::Time start = absl::Now();
+  const absl::Time measure_start = start + warmup;
+  const absl::Time end = measure_start + measure;
+  absl::Time next_arrival = start;
+  int64_t issued = 0;
+
+  // Promise/Future pair used to track completion of all reads.
+  auto [promise, future] = PromiseFuturePair<void>::Make(absl::OkStatus());
+  while (!promise.ready()) {
+    // Poisson arrivals: exponentially-distributed interarrival times.
+    next_arrival +=
+        absl::Seconds(absl::Exponential<double>(gen, target_qps));
+    if (next_arrival > end) break;
+    if (const absl::Time now = absl::Now(); next_arrival > now) {
+      absl::SleepFor(next_arrival - now);
+    }
+    const auto& key =
+        input.keys[absl::Uniform<size_t>(gen, 0, input.keys.size())];
+    const absl::Time issue_time = absl::Now();
+    const bool measured = issue_time >= measure_start;
+    const int64_t current = in_flight.fetch_add(1) + 1;
+    int64_t peak = peak_in_flight.load(std::memory_order_relaxed);
+    while (current > peak &&
+           !peak_in_flight.compare_exchange_weak(peak, current)) {
+    }
+    LinkValue(
+        [&, issue_time, measured](Promise<void> a_promise,
+                                  ReadyFuture<kvstore::ReadResult> a_future) {
+          in_flight.fetch_sub(1);
+          if (!measured) return;
+          latency.Record(absl::Now() - issue_time);
+          measured_reads.fetch_add(1);
+          if (a_future.result().ok()) {
+            bytes_read.fetch_add(a_future.result()->value.size());
+          }
+        },
+        promise, kvstore::Read(kvstore, key));
+    ++issued;
+  }
+
+  // Wait until all reads are complete.
+  promise = {};
+  TENSORSTORE_CHECK_OK(future.result());
+
+  const double measure_s = absl::FDivDuration(measure, absl::Seconds(1));
+  const double achieved_qps = measured_reads.load() / measure_s;
+  const double throughput =
+      static_cast<double>(bytes_read.load()) / 1e6 / measure_s;
+  read_throughput.Set(throughput);
+
+  std::cout << "Open-loop read summary: "
+            << absl::StrFormat(
+                   "issued=%d, achieved %.1f of %.1f QPS, %.3f MB/second, "
+                   "peak in-flight=%d",
+                   issued, achieved_qps, target_qps, peak_in_flight.load())
+            << std::endl;
+  latency.PrintSummary();
+
+  PerOperationMetricCollection(all_metrics, "open_loop_read");
+}
+
 void DoKvstoreBenchmark() {
   auto kvstore_spec = absl::GetFlag(FLAGS_kvstore_spec).value;
   internal::EnsureDirectoryPath(kvstore_spec.path);
@@ -402,7 +564,12 @@ void DoKvstoreBenchmark() {
 
   auto prepared = DoWriteBenchmark(context, kvstore_spec, &all_metrics);
   prepared = MaybeListKeys(context, kvstore_spec, std::move(prepared));
-  DoReadBenchmark(context, kvstore_spec, std::move(prepared), &all_metrics);
+  if (absl::GetFlag(FLAGS_target_qps) > 0) {
+    DoOpenLoopReadBenchmark(context, kvstore_spec, std::move(prepared),
+                            &all_metrics);
+  } else {
+    DoReadBenchmark(context, kvstore_spec, std::move(prepared), &all_metrics);
+  }
 
   auto written = internal::WriteMetricCollectionToKvstore(
       std::move(all_metrics), absl::GetFlag(FLAGS_metric_kvstore_spec).value);
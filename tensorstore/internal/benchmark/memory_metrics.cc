@@ -0,0 +1,185 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/benchmark/memory_metrics.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <psapi.h>
+#else  // !_WIN32
+#include <sys/resource.h>
+#endif  // _WIN32
+
+#include <atomic>
+#include <new>
+
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/internal/metrics/registry.h"
+
+namespace tensorstore {
+namespace internal_benchmark {
+namespace {
+
+std::atomic<int64_t> allocation_count{0};
+std::atomic<int64_t> allocated_bytes{0};
+
+void RecordAllocation(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(static_cast<int64_t>(size),
+                            std::memory_order_relaxed);
+}
+
+internal_metrics::CollectedMetric MakeValueMetric(const char* metric_name,
+                                                  const char* description,
+                                                  int64_t value) {
+  internal_metrics::CollectedMetric metric;
+  metric.metric_name = metric_name;
+  metric.metadata = internal_metrics::MetricMetadata(description);
+  metric.tag = "value";
+  metric.values.push_back(
+      internal_metrics::CollectedMetric::Value{/*fields=*/{}, value});
+  return metric;
+}
+
+// Registers the memory metrics on first use of this library.
+const bool register_memory_metrics = [] {
+  auto& registry = internal_metrics::GetMetricRegistry();
+  registry.AddGeneric("/tensorstore/benchmark/memory/allocation_count", [] {
+    return MakeValueMetric(
+        "/tensorstore/benchmark/memory/allocation_count",
+        "Cumulative heap allocations made by the process.",
+        GetAllocationStats().allocation_count);
+  });
+  registry.AddGeneric("/tensorstore/benchmark/memory/allocated_bytes", [] {
+    return MakeValueMetric(
+        "/tensorstore/benchmark/memory/allocated_bytes",
+        "Cumulative bytes requested from the heap by the process.",
+        GetAllocationStats().allocated_bytes);
+  });
+  registry.AddGeneric("/tensorstore/benchmark/memory/peak_rss_bytes", [] {
+    return MakeValueMetric("/tensorstore/benchmark/memory/peak_rss_bytes",
+                           "Peak resident set size of the process.",
+                           GetPeakRssBytes());
+  });
+  return true;
+}();
+
+}  // namespace
+
+AllocationStats GetAllocationStats() {
+  return AllocationStats{allocation_count.load(std::memory_order_relaxed),
+                         allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+int64_t GetPeakRssBytes() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters,
+                              sizeof(counters))) {
+    return 0;
+  }
+  return static_cast<int64_t>(counters.PeakWorkingSetSize);
+#else   // !_WIN32
+  struct rusage usage;
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+  // ru_maxrss is in bytes on darwin.
+  return static_cast<int64_t>(usage.ru_maxrss);
+#else
+  // ru_maxrss is in kilobytes elsewhere.
+  return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif  // _WIN32
+}
+
+}  // namespace internal_benchmark
+}  // namespace tensorstore
+
+// Counting replacements for the global allocation functions.  These are
+// deliberately thin wrappers around malloc/free: the goal is attribution, not
+// a different allocator, so benchmark numbers remain representative.
+void* operator new(size_t size) {
+  tensorstore::internal_benchmark::RecordAllocation(size);
+  void* ptr = ::malloc(size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](size_t size) { return ::operator new(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  tensorstore::internal_benchmark::RecordAllocation(size);
+  return ::malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+  return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { ::free(ptr); }
+void operator delete[](void* ptr) noexcept { ::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { ::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { ::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  ::free(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  ::free(ptr);
+}
+
+#if defined(__cpp_aligned_new)
+void* operator new(size_t size, std::align_val_t alignment) {
+  tensorstore::internal_benchmark::RecordAllocation(size);
+#ifdef _WIN32
+  void* ptr = ::_aligned_malloc(size, static_cast<size_t>(alignment));
+#else
+  void* ptr = ::aligned_alloc(static_cast<size_t>(alignment), size);
+#endif
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return ::operator new(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#ifdef _WIN32
+  ::_aligned_free(ptr);
+#else
+  ::free(ptr);
+#endif
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+  ::operator delete(ptr, alignment);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept {
+  ::operator delete(ptr, alignment);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept {
+  ::operator delete(ptr, alignment);
+}
+#endif  // __cpp_aligned_new
@@ -0,0 +1,49 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_BENCHMARK_MEMORY_METRICS_H_
+#define TENSORSTORE_INTERNAL_BENCHMARK_MEMORY_METRICS_H_
+
+#include <stdint.h>
+
+namespace tensorstore {
+namespace internal_benchmark {
+
+/// Allocator activity of the process since startup, counted by the
+/// `operator new` / `operator delete` replacements in memory_metrics.cc.
+///
+/// Linking this library into a benchmark binary registers the metrics
+///
+///   /tensorstore/benchmark/memory/allocation_count
+///   /tensorstore/benchmark/memory/allocated_bytes
+///   /tensorstore/benchmark/memory/peak_rss_bytes
+///
+/// so allocator behavior appears in every metric dump alongside throughput;
+/// per-operation collection then yields allocations per operation.
+struct AllocationStats {
+  int64_t allocation_count = 0;
+  int64_t allocated_bytes = 0;
+};
+
+/// Returns the cumulative allocation totals for the process.
+AllocationStats GetAllocationStats();
+
+/// Returns the peak resident set size of the process in bytes, or 0 if
+/// unavailable on this platform.
+int64_t GetPeakRssBytes();
+
+}  // namespace internal_benchmark
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_BENCHMARK_MEMORY_METRICS_H_
@@ -16,12 +16,14 @@
 
 #include <algorithm>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include <nlohmann/json.hpp>
@@ -117,6 +119,61 @@ absl::Status WriteMetricCollectionToKvstore(::nlohmann::json all_metrics,
   return absl::OkStatus();
 }
 
+std::vector<BaselineComparison> CompareBenchmarksToBaseline(
+    const ::nlohmann::json& current, const ::nlohmann::json& baseline,
+    std::string_view value_key, double threshold) {
+  std::vector<BaselineComparison> comparisons;
+  if (!current.is_object() || !baseline.is_object()) return comparisons;
+  if (current.value("version", -1) != baseline.value("version", -2)) {
+    return comparisons;
+  }
+  const std::string key(value_key);
+
+  // Extracts the ("id", `key`) pair from a benchmark entry.
+  const auto get_entry =
+      [&](const ::nlohmann::json& entry,
+          std::string& id) -> std::optional<double> {
+    if (!entry.is_object()) return std::nullopt;
+    auto id_it = entry.find("id");
+    auto value_it = entry.find(key);
+    if (id_it == entry.end() || !id_it->is_string() ||
+        value_it == entry.end() || !value_it->is_number()) {
+      return std::nullopt;
+    }
+    id = id_it->get<std::string>();
+    return value_it->get<double>();
+  };
+
+  absl::flat_hash_map<std::string, double> baseline_values;
+  if (auto it = baseline.find("benchmarks");
+      it != baseline.end() && it->is_array()) {
+    for (const auto& entry : *it) {
+      std::string id;
+      if (auto value = get_entry(entry, id)) {
+        baseline_values[id] = *value;
+      }
+    }
+  }
+
+  if (auto it = current.find("benchmarks");
+      it != current.end() && it->is_array()) {
+    for (const auto& entry : *it) {
+      BaselineComparison comparison;
+      auto value = get_entry(entry, comparison.id);
+      if (!value) continue;
+      comparison.current = *value;
+      if (auto baseline_it = baseline_values.find(comparison.id);
+          baseline_it != baseline_values.end()) {
+        comparison.baseline = baseline_it->second;
+        comparison.regressed =
+            comparison.current < (1.0 - threshold) * comparison.baseline;
+      }
+      comparisons.push_back(std::move(comparison));
+    }
+  }
+  return comparisons;
+}
+
 void DumpMetrics(std::string_view prefix) {
   std::vector<std::string> lines;
   for (const auto& metric :
@@ -15,7 +15,9 @@
 #ifndef TENSORSTORE_INTERNAL_BENCHMARK_METRIC_UTILS_H_
 #define TENSORSTORE_INTERNAL_BENCHMARK_METRIC_UTILS_H_
 
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 #include "tensorstore/kvstore/spec.h"
@@ -41,6 +43,33 @@ absl::Status WriteMetricCollectionToKvstore(::nlohmann::json all_metrics,
                                             const kvstore::Spec& kvstore_spec,
                                             bool final_collect = true);
 
+// Result of comparing one benchmark entry against its baseline entry.
+struct BaselineComparison {
+  std::string id;
+  double current = 0;
+  double baseline = 0;  // 0 indicates no matching baseline entry.
+  bool regressed = false;
+};
+
+// Compares the "benchmarks" entries of `current` against those of `baseline`.
+//
+// Both collections must be objects of the form written by
+// //tensorstore/internal/benchmark:regression_benchmark:
+//
+//   {"version": 1, "benchmarks": [{"id": <string>, <value_key>: <number>}]}
+//
+// `value_key` names a throughput-style measure where larger is better; an
+// entry is reported as regressed when its value falls below
+// `(1 - threshold) * baseline`.  Entries of `current` without a matching
+// baseline entry are reported with `baseline == 0` and never regress.
+//
+// Returns an empty vector if `baseline` is not an object whose "version"
+// matches that of `current` (the baseline must be regenerated after a format
+// change).
+std::vector<BaselineComparison> CompareBenchmarksToBaseline(
+    const ::nlohmann::json& current, const ::nlohmann::json& baseline,
+    std::string_view value_key, double threshold);
+
 // Print out metrics to stdout, sorted by keys
 void DumpMetrics(std::string_view prefix);
 
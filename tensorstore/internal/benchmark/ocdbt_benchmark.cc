@@ -0,0 +1,370 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file ocdbt_benchmark measures OCDBT commit latency, read amplification,
+/// and node cache hit rate across key counts, value sizes, node sizes, and
+/// writer counts, to guide the choice of `max_decoded_node_bytes` and tree
+/// fan-out per workload.
+///
+/* Examples
+
+# 1M keys of 100 bytes over a memory base, 4 concurrent writers.
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:ocdbt_benchmark -- \
+  --base_kvstore_spec='"memory://"' \
+  --num_keys=1000000 \
+  --value_size=100 \
+  --num_writers=4
+
+# Large nodes over a file base.
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:ocdbt_benchmark -- \
+  --base_kvstore_spec='"file:///tmp/ocdbt_benchmark"' \
+  --num_keys=10000000 \
+  --max_decoded_node_bytes=1048576 \
+  --cache_pool_bytes=104857600
+
+# Distributed commit path via a local coordinator.
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:ocdbt_benchmark -- \
+  --base_kvstore_spec='"memory://"' \
+  --num_keys=1000000 \
+  --num_writers=8 \
+  --use_coordinator
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/log/absl_check.h"
+#include "absl/log/absl_log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/internal/benchmark/metric_utils.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/registry.h"
+#include "tensorstore/internal/thread/thread.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/distributed/coordinator_server.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/json_absl_flag.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>,
+          base_kvstore_spec, {},
+          "Base kvstore over which the OCDBT database is created, e.g. "
+          "\"memory://\" or \"file:///tmp/ocdbt_benchmark\".");
+
+ABSL_FLAG(int64_t, num_keys, 1000000, "Number of keys to write.");
+
+ABSL_FLAG(int64_t, value_size, 100, "Size of each value in bytes.");
+
+ABSL_FLAG(int64_t, batch_size, 1000,
+          "Number of writes per atomic commit; commit latency is reported "
+          "per batch.");
+
+ABSL_FLAG(int64_t, num_writers, 1,
+          "Number of concurrent writer threads, each committing its own "
+          "batches.");
+
+ABSL_FLAG(int64_t, num_reads, 100000,
+          "Number of random point reads issued after the write phase.");
+
+ABSL_FLAG(int64_t, max_decoded_node_bytes, 0,
+          "If non-zero, sets the OCDBT \"max_decoded_node_bytes\" config "
+          "option, which bounds node size and thereby the tree fan-out.");
+
+ABSL_FLAG(int64_t, max_inline_value_bytes, -1,
+          "If non-negative, sets the OCDBT \"max_inline_value_bytes\" config "
+          "option.");
+
+ABSL_FLAG(int64_t, version_tree_arity_log2, 0,
+          "If non-zero, sets the OCDBT \"version_tree_arity_log2\" config "
+          "option.");
+
+ABSL_FLAG(int64_t, cache_pool_bytes, 0,
+          "\"total_bytes_limit\" of the cache pool used for B+tree nodes.");
+
+ABSL_FLAG(bool, use_coordinator, false,
+          "Starts a local coordinator server and commits through the "
+          "distributed path.");
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::Context;
+
+// Sums the values of a counter metric across fields.  Returns 0 if the metric
+// does not exist.
+int64_t GetCounterValue(std::string_view name) {
+  auto collected =
+      tensorstore::internal_metrics::GetMetricRegistry().Collect(name);
+  if (!collected) return 0;
+  int64_t total = 0;
+  for (const auto& v : collected->values) {
+    if (const auto* x = std::get_if<int64_t>(&v.value)) total += *x;
+  }
+  return total;
+}
+
+absl::Cord MakeRandomValue(absl::InsecureBitGen& gen, size_t size) {
+  std::string data(size, 0);
+  for (auto& c : data) {
+    c = static_cast<char>(absl::Uniform<uint8_t>(gen));
+  }
+  return absl::Cord(std::move(data));
+}
+
+std::string GetKey(int64_t i) { return absl::StrFormat("key/%012d", i); }
+
+struct CommitLatencies {
+  absl::Mutex mutex;
+  std::vector<absl::Duration> latencies ABSL_GUARDED_BY(mutex);
+
+  void Record(absl::Duration d) {
+    absl::MutexLock lock(&mutex);
+    latencies.push_back(d);
+  }
+
+  void Report() {
+    absl::MutexLock lock(&mutex);
+    if (latencies.empty()) return;
+    std::sort(latencies.begin(), latencies.end());
+    absl::Duration total;
+    for (auto d : latencies) total += d;
+    const auto percentile = [&](double p) {
+      return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+    };
+    std::cout << absl::StrFormat(
+                     "Commit latency over %d commits: mean=%s p50=%s p90=%s "
+                     "p99=%s max=%s",
+                     latencies.size(), absl::FormatDuration(total / latencies.size()),
+                     absl::FormatDuration(percentile(0.5)),
+                     absl::FormatDuration(percentile(0.9)),
+                     absl::FormatDuration(percentile(0.99)),
+                     absl::FormatDuration(latencies.back()))
+              << std::endl;
+  }
+};
+
+void DoWritePhase(const kvstore::KvStore& store, CommitLatencies& latencies) {
+  const int64_t num_keys = absl::GetFlag(FLAGS_num_keys);
+  const int64_t batch_size = std::max(int64_t{1}, absl::GetFlag(FLAGS_batch_size));
+  const int64_t num_writers =
+      std::max(int64_t{1}, absl::GetFlag(FLAGS_num_writers));
+  const int64_t value_size = absl::GetFlag(FLAGS_value_size);
+
+  std::cout << absl::StrFormat(
+                   "Starting write phase: num_keys=%d value_size=%d "
+                   "batch_size=%d num_writers=%d",
+                   num_keys, value_size, batch_size, num_writers)
+            << std::endl;
+
+  const auto start_time = absl::Now();
+  std::vector<tensorstore::internal::Thread> threads;
+  threads.reserve(num_writers);
+  for (int64_t w = 0; w < num_writers; ++w) {
+    threads.emplace_back(
+        tensorstore::internal::Thread({"ocdbt_writer"}, [&, w] {
+          absl::InsecureBitGen gen;
+          auto value = MakeRandomValue(gen, value_size);
+          // Writer `w` writes keys `[w * keys_per_writer, ...)`.
+          const int64_t keys_per_writer =
+              (num_keys + num_writers - 1) / num_writers;
+          const int64_t begin = w * keys_per_writer;
+          const int64_t end = std::min(num_keys, begin + keys_per_writer);
+          for (int64_t i = begin; i < end;) {
+            auto transaction =
+                tensorstore::Transaction(tensorstore::atomic_isolated);
+            TENSORSTORE_CHECK_OK_AND_ASSIGN(auto transactional_store,
+                                            store | transaction);
+            const int64_t batch_end = std::min(end, i + batch_size);
+            for (; i < batch_end; ++i) {
+              TENSORSTORE_CHECK_OK(
+                  kvstore::Write(transactional_store, GetKey(i), value)
+                      .result());
+            }
+            const auto commit_start = absl::Now();
+            TENSORSTORE_CHECK_OK(transaction.CommitAsync().result());
+            latencies.Record(absl::Now() - commit_start);
+          }
+        }));
+  }
+  for (auto& t : threads) t.Join();
+
+  const double elapsed_s =
+      absl::FDivDuration(absl::Now() - start_time, absl::Seconds(1));
+  std::cout << absl::StrFormat("Write summary: %d keys in %.0f ms: %.0f keys/second",
+                               num_keys, elapsed_s * 1e3, num_keys / elapsed_s)
+            << std::endl;
+  latencies.Report();
+}
+
+void DoReadPhase(const kvstore::KvStore& store, std::string_view base_driver) {
+  const int64_t num_keys = absl::GetFlag(FLAGS_num_keys);
+  const int64_t num_reads = absl::GetFlag(FLAGS_num_reads);
+  if (num_reads == 0 || num_keys == 0) return;
+
+  std::cout << absl::StrFormat("Starting read phase: num_reads=%d", num_reads)
+            << std::endl;
+
+  const std::string bytes_read_metric =
+      tensorstore::StrCat("/tensorstore/kvstore/", base_driver, "/bytes_read");
+  const int64_t base_bytes_before = GetCounterValue(bytes_read_metric);
+  const int64_t cache_hits_before =
+      GetCounterValue("/tensorstore/cache/hit_count");
+  const int64_t cache_misses_before =
+      GetCounterValue("/tensorstore/cache/miss_count");
+
+  absl::InsecureBitGen gen;
+  std::atomic<int64_t> bytes_read = 0;
+  const auto start_time = absl::Now();
+  auto [promise, future] =
+      tensorstore::PromiseFuturePair<void>::Make(absl::OkStatus());
+  for (int64_t i = 0; i < num_reads; ++i) {
+    if (promise.ready()) break;
+    LinkValue(
+        [&bytes_read](tensorstore::Promise<void> promise,
+                      tensorstore::ReadyFuture<kvstore::ReadResult> future) {
+          bytes_read.fetch_add(future.value().value.size());
+        },
+        promise,
+        kvstore::Read(store, GetKey(absl::Uniform<int64_t>(gen, 0, num_keys))));
+  }
+  promise = {};
+  TENSORSTORE_CHECK_OK(future.result());
+
+  const double elapsed_s =
+      absl::FDivDuration(absl::Now() - start_time, absl::Seconds(1));
+  std::cout << absl::StrFormat("Read summary: %d reads in %.0f ms: %.0f reads/second",
+                               num_reads, elapsed_s * 1e3,
+                               num_reads / elapsed_s)
+            << std::endl;
+
+  const int64_t base_bytes = GetCounterValue(bytes_read_metric) - base_bytes_before;
+  if (base_bytes > 0 && bytes_read.load() > 0) {
+    std::cout << absl::StrFormat(
+                     "Read amplification: %.2fx (%d base kvstore bytes for %d "
+                     "value bytes)",
+                     static_cast<double>(base_bytes) / bytes_read.load(),
+                     base_bytes, bytes_read.load())
+              << std::endl;
+  } else {
+    std::cout << "Read amplification: unavailable (base kvstore \""
+              << base_driver << "\" reports no bytes_read metric)" << std::endl;
+  }
+  const int64_t hits =
+      GetCounterValue("/tensorstore/cache/hit_count") - cache_hits_before;
+  const int64_t misses =
+      GetCounterValue("/tensorstore/cache/miss_count") - cache_misses_before;
+  if (hits + misses > 0) {
+    std::cout << absl::StrFormat(
+                     "Node cache hit rate: %.1f%% (%d hits, %d misses)",
+                     100.0 * hits / (hits + misses), hits, misses)
+              << std::endl;
+  }
+}
+
+void Run() {
+  auto base_spec = absl::GetFlag(FLAGS_base_kvstore_spec).value;
+  if (!base_spec.valid()) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(base_spec,
+                                    kvstore::Spec::FromJson("memory://"));
+  }
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(auto base_json, base_spec.ToJson());
+  std::string base_driver;
+  if (base_json.is_object()) {
+    base_driver = base_json.value("driver", "");
+  } else if (base_json.is_string()) {
+    auto url = base_json.get<std::string>();
+    base_driver = url.substr(0, url.find(':'));
+  }
+
+  // Optionally start a local coordinator and register it with the context, so
+  // that commits go through the distributed cooperator path.
+  ::nlohmann::json context_json{
+      {"cache_pool",
+       {{"total_bytes_limit", absl::GetFlag(FLAGS_cache_pool_bytes)}}}};
+  tensorstore::ocdbt::CoordinatorServer coordinator;
+  if (absl::GetFlag(FLAGS_use_coordinator)) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        coordinator, tensorstore::ocdbt::CoordinatorServer::Start({}));
+    context_json["ocdbt_coordinator"] = {
+        {"address", tensorstore::StrCat("localhost:", coordinator.port())}};
+    std::cout << "Started coordinator on port " << coordinator.port()
+              << std::endl;
+  }
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto context_spec, Context::Spec::FromJson(std::move(context_json)));
+  Context context(context_spec);
+
+  ::nlohmann::json config = ::nlohmann::json::object();
+  if (auto v = absl::GetFlag(FLAGS_max_decoded_node_bytes); v != 0) {
+    config["max_decoded_node_bytes"] = v;
+  }
+  if (auto v = absl::GetFlag(FLAGS_max_inline_value_bytes); v >= 0) {
+    config["max_inline_value_bytes"] = v;
+  }
+  if (auto v = absl::GetFlag(FLAGS_version_tree_arity_log2); v != 0) {
+    config["version_tree_arity_log2"] = v;
+  }
+  ::nlohmann::json ocdbt_json{{"driver", "ocdbt"}, {"base", base_json}};
+  if (!config.empty()) ocdbt_json["config"] = config;
+
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto store, kvstore::Open(ocdbt_json, context).result());
+
+  CommitLatencies latencies;
+  DoWritePhase(store, latencies);
+  DoReadPhase(store, base_driver);
+
+  std::cout << std::endl;
+  tensorstore::internal::DumpMetrics("/tensorstore/");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  Run();
+  return 0;
+}
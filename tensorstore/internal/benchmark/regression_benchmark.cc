@@ -0,0 +1,419 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Aggregated performance regression suite.
+
+Runs a curated set of fixed-workload benchmarks spanning the major
+performance-sensitive layers (array copy kernels, the chunk cache, the thread
+pool, zarr3 codecs, and the kvstore layer), and emits a versioned JSON result
+collection suitable for baseline tracking.
+
+# Run the suite and record a baseline:
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:regression_benchmark -- \
+  --baseline_kvstore_spec='"file:///tmp/regression_baseline.json"' \
+  --update_baseline
+
+# Later, compare against the baseline, failing (exit code 1) on any benchmark
+# that is more than 15% slower:
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:regression_benchmark -- \
+  --baseline_kvstore_spec='"file:///tmp/regression_baseline.json"' \
+  --regression_threshold=0.15
+
+# Run a subset of the suite:
+
+bazel run -c opt \
+  //tensorstore/internal/benchmark:regression_benchmark -- \
+  --benchmarks=copy/,codec/
+*/
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/log/absl_log.h"
+#include "absl/random/random.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/array.h"
+#include "tensorstore/context.h"
+#include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
+#include "tensorstore/driver/zarr3/codec/codec.h"
+#include "tensorstore/driver/zarr3/codec/codec_chain_spec.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/benchmark/metric_utils.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/json_absl_flag.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+
+ABSL_FLAG(std::string, benchmarks, "",
+          "Comma-separated list of benchmark id prefixes to run.  Empty runs "
+          "the full suite.");
+
+ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>,
+          baseline_kvstore_spec, {},
+          "KvStore spec of the baseline result collection.  When set, the "
+          "current results are compared against the baseline and the process "
+          "exits with a non-zero status if any benchmark regresses by more "
+          "than --regression_threshold.");
+
+ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>,
+          output_kvstore_spec, {},
+          "KvStore spec to which the current result collection is written.");
+
+ABSL_FLAG(bool, update_baseline, false,
+          "Write the current results to --baseline_kvstore_spec instead of "
+          "comparing against it.");
+
+ABSL_FLAG(double, regression_threshold, 0.15,
+          "Allowed fractional slowdown relative to the baseline before a "
+          "benchmark is reported as regressed.");
+
+ABSL_FLAG(int64_t, repeat_runs, 3,
+          "Number of times each benchmark is run; the best throughput is "
+          "reported, which reduces sensitivity to machine noise.");
+
+namespace tensorstore {
+namespace {
+
+using ::tensorstore::internal_zarr3::ArrayCodecResolveParameters;
+using ::tensorstore::internal_zarr3::BytesCodecResolveParameters;
+using ::tensorstore::internal_zarr3::ZarrCodecChain;
+using ::tensorstore::internal_zarr3::ZarrCodecChainSpec;
+
+// Version of the emitted result collection.  Bump when the set of benchmarks
+// or their workloads change incompatibly; baselines must then be regenerated.
+constexpr int kResultVersion = 1;
+
+constexpr std::string_view kValueKey = "work_per_second";
+
+// One curated benchmark.  `run` executes a fixed workload and returns the
+// amount of work performed (bytes for io/copy benchmarks, tasks for the
+// thread pool), which is divided by the measured wall time.
+struct RegressionBenchmark {
+  std::string id;
+  std::string unit;  // "bytes" or "tasks"
+  int64_t (*run)();
+};
+
+template <typename T>
+SharedArray<T> MakeSourceArray(span<const Index> shape) {
+  auto array = AllocateArray<T>(shape, c_order, value_init);
+  absl::InsecureBitGen gen;
+  T* data = array.data();
+  for (Index i = 0; i < array.num_elements(); ++i) {
+    data[i] = static_cast<T>(static_cast<uint8_t>(i >> 6) +
+                             absl::Uniform(gen, 0, 16));
+  }
+  return array;
+}
+
+int64_t RunCopyContiguous() {
+  constexpr Index kShape[] = {64, 1024, 1024};  // 64 MiB
+  constexpr int kRepeats = 8;
+  auto source = MakeSourceArray<uint8_t>(kShape);
+  auto target = AllocateArray<uint8_t>(kShape, c_order, value_init);
+  for (int i = 0; i < kRepeats; ++i) {
+    CopyArray(source, target);
+  }
+  return kRepeats * source.num_elements() * int64_t{sizeof(uint8_t)};
+}
+
+int64_t RunCopyTransposed() {
+  constexpr Index kShape[] = {4096, 4096};  // 64 MiB
+  constexpr int kRepeats = 4;
+  // A fortran-order source copied to a c-order target exercises the strided
+  // copy kernels.
+  auto source = AllocateArray<uint32_t>(kShape, fortran_order, value_init);
+  auto target = AllocateArray<uint32_t>(kShape, c_order, value_init);
+  for (int i = 0; i < kRepeats; ++i) {
+    CopyArray(source, target);
+  }
+  return kRepeats * source.num_elements() * int64_t{sizeof(uint32_t)};
+}
+
+int64_t RunCopyConvert() {
+  constexpr Index kShape[] = {32, 1024, 1024};  // 64 MiB of uint16
+  constexpr int kRepeats = 4;
+  auto source = MakeSourceArray<uint16_t>(kShape);
+  auto target = AllocateArray<float>(kShape, c_order, value_init);
+  for (int i = 0; i < kRepeats; ++i) {
+    TENSORSTORE_CHECK_OK(CopyConvertedArray(source, target));
+  }
+  return kRepeats * source.num_elements() * int64_t{sizeof(uint16_t)};
+}
+
+// Prepares a zstd level 3 codec chain for a 4 MiB uint16 cube.
+struct CodecState {
+  CodecState() {
+    constexpr Index kSide = 128;  // 128^3 * 2 bytes = 4 MiB
+    shape.assign(3, kSide);
+    source = MakeSourceArray<uint16_t>(shape);
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto spec,
+        ZarrCodecChainSpec::FromJson(
+            {{{"name", "bytes"}, {"configuration", {{"endian", "little"}}}},
+             {{"name", "zstd"}, {"configuration", {{"level", 3}}}}},
+            {/*.constraints=*/true}));
+    ArrayCodecResolveParameters decoded_params;
+    decoded_params.dtype = dtype_v<uint16_t>;
+    decoded_params.rank = 3;
+    decoded_params.fill_value =
+        AllocateArray(span<const Index>{}, c_order, value_init,
+                      dtype_v<uint16_t>);
+    BytesCodecResolveParameters encoded_params;
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto chain, spec.Resolve(std::move(decoded_params), encoded_params));
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(prepared_state, chain->Prepare(shape));
+  }
+
+  std::vector<Index> shape;
+  SharedArray<uint16_t> source;
+  ZarrCodecChain::PreparedState::Ptr prepared_state;
+};
+
+int64_t RunCodecEncode() {
+  constexpr int kRepeats = 16;
+  CodecState state;
+  for (int i = 0; i < kRepeats; ++i) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto encoded, state.prepared_state->EncodeArray(state.source));
+  }
+  return kRepeats * state.source.num_elements() * int64_t{sizeof(uint16_t)};
+}
+
+int64_t RunCodecDecode() {
+  constexpr int kRepeats = 16;
+  CodecState state;
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto encoded, state.prepared_state->EncodeArray(state.source));
+  for (int i = 0; i < kRepeats; ++i) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto decoded, state.prepared_state->DecodeArray(state.shape, encoded));
+  }
+  return kRepeats * state.source.num_elements() * int64_t{sizeof(uint16_t)};
+}
+
+int64_t RunThreadPoolFanout() {
+  constexpr int64_t kTasks = 1 << 18;
+  auto executor = internal::DetachedThreadPool(16);
+  absl::BlockingCounter counter(kTasks);
+  for (int64_t i = 0; i < kTasks; ++i) {
+    executor([&counter] { counter.DecrementCount(); });
+  }
+  counter.Wait();
+  return kTasks;
+}
+
+int64_t RunCacheChunkReadHit() {
+  constexpr int kRepeats = 8;
+  auto context =
+      Context::FromJson(
+          {{"cache_pool", {{"total_bytes_limit", int64_t{1} << 30}}}})
+          .value();
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(
+          {
+              {"driver", "n5"},
+              {"kvstore", "memory://regression/"},
+              {"metadata",
+               {
+                   {"compression", {{"type", "raw"}}},
+                   {"dataType", "uint8"},
+                   {"blockSize", {64, 64, 64}},
+                   {"dimensions", {256, 256, 256}},
+               }},
+          },
+          context, OpenMode::create, ReadWriteMode::read_write)
+          .result());
+  constexpr Index kShape[] = {256, 256, 256};  // 16 MiB
+  auto source = MakeSourceArray<uint8_t>(kShape);
+  TENSORSTORE_CHECK_OK(tensorstore::Write(source, store).result());
+  // Warm the chunk cache so that the timed loop measures cache hits.
+  TENSORSTORE_CHECK_OK(tensorstore::Read(store).result());
+  int64_t bytes = 0;
+  for (int i = 0; i < kRepeats; ++i) {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(auto array,
+                                    tensorstore::Read(store).result());
+    bytes += array.num_elements();
+  }
+  return bytes;
+}
+
+int64_t RunKvstoreMemoryWriteRead() {
+  constexpr int kNumValues = 256;
+  constexpr int64_t kValueBytes = 1 << 20;
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto kvstore, kvstore::Open("memory://regression/").result());
+  absl::Cord value(std::string(kValueBytes, 'x'));
+  std::vector<AnyFuture> futures;
+  futures.reserve(kNumValues);
+  for (int i = 0; i < kNumValues; ++i) {
+    futures.push_back(kvstore::Write(
+        kvstore, absl::StrFormat("key/%04d", i), value));
+  }
+  for (auto& future : futures) {
+    TENSORSTORE_CHECK_OK(future.status());
+  }
+  std::vector<AnyFuture> reads;
+  reads.reserve(kNumValues);
+  for (int i = 0; i < kNumValues; ++i) {
+    reads.push_back(kvstore::Read(kvstore, absl::StrFormat("key/%04d", i)));
+  }
+  for (auto& future : reads) {
+    TENSORSTORE_CHECK_OK(future.status());
+  }
+  return 2 * kNumValues * kValueBytes;
+}
+
+const std::vector<RegressionBenchmark>& Benchmarks() {
+  static const auto* benchmarks = new std::vector<RegressionBenchmark>{
+      {"copy/contiguous", "bytes", &RunCopyContiguous},
+      {"copy/transposed", "bytes", &RunCopyTransposed},
+      {"copy/convert_uint16_float32", "bytes", &RunCopyConvert},
+      {"codec/zstd3_encode", "bytes", &RunCodecEncode},
+      {"codec/zstd3_decode", "bytes", &RunCodecDecode},
+      {"thread_pool/fanout", "tasks", &RunThreadPoolFanout},
+      {"cache/chunk_read_hit", "bytes", &RunCacheChunkReadHit},
+      {"kvstore/memory_write_read", "bytes", &RunKvstoreMemoryWriteRead},
+  };
+  return *benchmarks;
+}
+
+bool ShouldRun(const RegressionBenchmark& benchmark) {
+  const std::string& filter = absl::GetFlag(FLAGS_benchmarks);
+  if (filter.empty()) return true;
+  for (std::string_view prefix : absl::StrSplit(filter, ',')) {
+    if (absl::StartsWith(benchmark.id, prefix)) return true;
+  }
+  return false;
+}
+
+int RunRegressionSuite() {
+  const int64_t repeat_runs = std::max(int64_t{1},
+                                       absl::GetFlag(FLAGS_repeat_runs));
+  ::nlohmann::json results{
+      {"version", kResultVersion},
+      {"timestamp", absl::FormatTime(absl::RFC3339_sec, absl::Now(),
+                                     absl::UTCTimeZone())},
+      {"benchmarks", ::nlohmann::json::array()},
+  };
+  for (const auto& benchmark : Benchmarks()) {
+    if (!ShouldRun(benchmark)) continue;
+    int64_t work = 0;
+    double best_elapsed_seconds = 0;
+    double best_work_per_second = 0;
+    for (int64_t run = 0; run < repeat_runs; ++run) {
+      const absl::Time start_time = absl::Now();
+      work = benchmark.run();
+      const double elapsed_seconds =
+          absl::FDivDuration(absl::Now() - start_time, absl::Seconds(1));
+      const double work_per_second = work / elapsed_seconds;
+      if (work_per_second > best_work_per_second) {
+        best_work_per_second = work_per_second;
+        best_elapsed_seconds = elapsed_seconds;
+      }
+    }
+    std::cout << absl::StrFormat("%-28s %12d %s in %8.3f ms:  %.3f M%s/second",
+                                 benchmark.id, work, benchmark.unit,
+                                 best_elapsed_seconds * 1e3,
+                                 best_work_per_second / 1e6, benchmark.unit)
+              << std::endl;
+    results["benchmarks"].push_back({
+        {"id", benchmark.id},
+        {"unit", benchmark.unit},
+        {"work", work},
+        {"elapsed_seconds", best_elapsed_seconds},
+        {std::string(kValueKey), best_work_per_second},
+    });
+  }
+  results["metrics"] =
+      internal::CollectMetricsToJson("regression_benchmark", "/tensorstore/");
+
+  if (auto output_spec = absl::GetFlag(FLAGS_output_kvstore_spec).value;
+      output_spec.valid()) {
+    TENSORSTORE_CHECK_OK(internal::WriteMetricCollectionToKvstore(
+        results, output_spec, /*final_collect=*/false));
+  }
+
+  auto baseline_spec = absl::GetFlag(FLAGS_baseline_kvstore_spec).value;
+  if (!baseline_spec.valid()) return 0;
+  if (absl::GetFlag(FLAGS_update_baseline)) {
+    TENSORSTORE_CHECK_OK(internal::WriteMetricCollectionToKvstore(
+        results, baseline_spec, /*final_collect=*/false));
+    return 0;
+  }
+
+  auto baseline = internal::ReadMetricCollectionFromKvstore(baseline_spec);
+  auto comparisons = internal::CompareBenchmarksToBaseline(
+      results, baseline, kValueKey,
+      absl::GetFlag(FLAGS_regression_threshold));
+  if (comparisons.empty()) {
+    ABSL_LOG(WARNING) << "No comparable baseline found; run with "
+                         "--update_baseline to record one.";
+    return 0;
+  }
+  bool any_regressed = false;
+  for (const auto& comparison : comparisons) {
+    if (comparison.baseline == 0) {
+      std::cout << absl::StrFormat("%-28s no baseline", comparison.id)
+                << std::endl;
+      continue;
+    }
+    const double change =
+        (comparison.current - comparison.baseline) / comparison.baseline;
+    std::cout << absl::StrFormat("%-28s %+7.2f%% vs baseline%s", comparison.id,
+                                 change * 100,
+                                 comparison.regressed ? "  REGRESSED" : "")
+              << std::endl;
+    any_regressed |= comparison.regressed;
+  }
+  return any_regressed ? 1 : 0;
+}
+
+}  // namespace
+}  // namespace tensorstore
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);  // InitTensorstore
+  return tensorstore::RunRegressionSuite();
+}
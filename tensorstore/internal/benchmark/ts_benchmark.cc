@@ -112,13 +112,19 @@ bazel run -c opt \
 #include "absl/flags/flag.h"
 #include "absl/log/absl_log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/driver/driver_testutil.h"
 #include "absl/flags/parse.h"
 #include "tensorstore/index.h"
+#include "tensorstore/internal/benchmark/benchmark_coordinator.h"
 #include "tensorstore/internal/benchmark/metric_utils.h"
 #include "tensorstore/internal/benchmark/vector_flag.h"
+#include "tensorstore/kvstore/spec.h"
 #include "tensorstore/spec.h"
 #include "tensorstore/util/json_absl_flag.h"
 #include "tensorstore/util/result.h"
@@ -180,6 +186,20 @@ ABSL_FLAG(int64_t, repeat_reads, 1,
 ABSL_FLAG(int64_t, repeat_writes, 0,
           "Number of times to repeat write benchmark.");
 
+ABSL_FLAG(tensorstore::JsonAbslFlag<tensorstore::kvstore::Spec>,
+          coordinator_kvstore_spec, {},
+          "KvStore spec of a shared scratch location used to run multiple "
+          "worker processes in lockstep.  The location must be empty at the "
+          "start of the run and accessible to all workers.");
+
+ABSL_FLAG(int64_t, num_workers, 1,
+          "Total number of coordinated worker processes.  Values greater "
+          "than 1 enable coordination via --coordinator_kvstore_spec.");
+
+ABSL_FLAG(int64_t, worker_id, 0,
+          "Id of this worker process, in [0, --num_workers).  Worker 0 "
+          "reports the combined results.");
+
 namespace tensorstore {
 namespace {
 
@@ -220,9 +240,43 @@ void DoTsBenchmark() {
            "be set";
   }
 
+  internal_benchmark::CoordinatorOptions coordinator;
+  coordinator.kvstore_spec = absl::GetFlag(FLAGS_coordinator_kvstore_spec).value;
+  coordinator.num_workers = absl::GetFlag(FLAGS_num_workers);
+  coordinator.worker_id = absl::GetFlag(FLAGS_worker_id);
+  const bool coordinated = coordinator.num_workers > 1;
+  if (coordinated) {
+    // Start all workers in lockstep so that they contend with each other for
+    // the full duration of the run.
+    TENSORSTORE_CHECK_OK(
+        internal_benchmark::WaitAtBarrier(coordinator, "start"));
+  }
+
+  const absl::Time start_time = absl::Now();
   absl::InsecureBitGen gen;
   TENSORSTORE_CHECK_OK(TestDriverWriteReadChunks(gen, options));
 
+  if (coordinated) {
+    const double elapsed_seconds =
+        absl::FDivDuration(absl::Now() - start_time, absl::Seconds(1));
+    ::nlohmann::json report{
+        {"worker_id", coordinator.worker_id},
+        {"elapsed_seconds", elapsed_seconds},
+        {"metrics",
+         internal::CollectMetricsToJson(
+             absl::StrCat("worker_", coordinator.worker_id), "/tensorstore/")},
+    };
+    TENSORSTORE_CHECK_OK(
+        internal_benchmark::PublishWorkerReport(coordinator, std::move(report)));
+    TENSORSTORE_CHECK_OK(
+        internal_benchmark::WaitAtBarrier(coordinator, "done"));
+    if (coordinator.worker_id == 0) {
+      TENSORSTORE_CHECK_OK_AND_ASSIGN(
+          auto reports, internal_benchmark::CollectWorkerReports(coordinator));
+      internal_benchmark::ReportCombinedResults(reports);
+    }
+  }
+
   internal::DumpMetrics("");
 }
 
@@ -0,0 +1,222 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/blocked_transpose_copy.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define TENSORSTORE_INTERNAL_TRANSPOSE_AVX2 1
+#endif
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+// Trivially-copyable stand-ins for complex element types, with the same size
+// but no stricter alignment than the real element types.
+struct TwoUint32 {
+  uint32_t v[2];
+};
+struct TwoUint64 {
+  uint64_t v[2];
+};
+
+#ifdef TENSORSTORE_INTERNAL_TRANSPOSE_AVX2
+
+bool HaveAvx2() {
+  static const bool have = __builtin_cpu_supports("avx2");
+  return have;
+}
+
+// Transposes an 8x8 block of 4-byte elements.  `src` holds 8 rows of 8
+// contiguous elements with a byte stride of `src_outer_stride` between rows;
+// the transposed rows are stored contiguously with a byte stride of
+// `dest_stride` between them.
+__attribute__((target("avx2"))) void Transpose8x8Avx2(const char* src,
+                                                      Index src_outer_stride,
+                                                      char* dest,
+                                                      Index dest_stride) {
+  auto load = [&](int i) {
+    return _mm256_loadu_ps(
+        reinterpret_cast<const float*>(src + i * src_outer_stride));
+  };
+  __m256 r0 = load(0), r1 = load(1), r2 = load(2), r3 = load(3), r4 = load(4),
+         r5 = load(5), r6 = load(6), r7 = load(7);
+  __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+  __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+  auto store = [&](int i, __m256 v) {
+    _mm256_storeu_ps(reinterpret_cast<float*>(dest + i * dest_stride), v);
+  };
+  store(0, _mm256_permute2f128_ps(s0, s4, 0x20));
+  store(1, _mm256_permute2f128_ps(s1, s5, 0x20));
+  store(2, _mm256_permute2f128_ps(s2, s6, 0x20));
+  store(3, _mm256_permute2f128_ps(s3, s7, 0x20));
+  store(4, _mm256_permute2f128_ps(s0, s4, 0x31));
+  store(5, _mm256_permute2f128_ps(s1, s5, 0x31));
+  store(6, _mm256_permute2f128_ps(s2, s6, 0x31));
+  store(7, _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+
+#endif  // TENSORSTORE_INTERNAL_TRANSPOSE_AVX2
+
+// Copies `rows` x `cols` elements from `src` to `dest` with arbitrary byte
+// strides, in L1-sized tiles so that both the source and destination access
+// patterns stay cache-resident regardless of which one is contiguous.
+template <typename T>
+void CopyBlocked(Index rows, Index cols, const char* src,
+                 Index src_outer_stride, Index src_inner_stride, char* dest,
+                 Index dest_outer_stride, Index dest_inner_stride) {
+  constexpr Index kTile = sizeof(T) >= 4 ? 16 : 64;
+#ifdef TENSORSTORE_INTERNAL_TRANSPOSE_AVX2
+  // Pure transpose of 4-byte elements: source rows contiguous, destination
+  // columns contiguous.  Use the SIMD shuffle kernel for full 8x8 sub-tiles.
+  const bool use_simd_transpose =
+      sizeof(T) == 4 &&
+      src_inner_stride == static_cast<Index>(sizeof(T)) &&
+      dest_outer_stride == static_cast<Index>(sizeof(T)) && HaveAvx2();
+#endif
+  for (Index i0 = 0; i0 < rows; i0 += kTile) {
+    const Index i1 = std::min(rows, i0 + kTile);
+    for (Index j0 = 0; j0 < cols; j0 += kTile) {
+      const Index j1 = std::min(cols, j0 + kTile);
+      Index i = i0;
+#ifdef TENSORSTORE_INTERNAL_TRANSPOSE_AVX2
+      if (use_simd_transpose) {
+        for (; i + 8 <= i1; i += 8) {
+          Index j = j0;
+          for (; j + 8 <= j1; j += 8) {
+            Transpose8x8Avx2(
+                src + i * src_outer_stride + j * src_inner_stride,
+                src_outer_stride,
+                dest + i * dest_outer_stride + j * dest_inner_stride,
+                dest_inner_stride);
+          }
+          for (; j < j1; ++j) {
+            for (Index ii = i; ii < i + 8; ++ii) {
+              *reinterpret_cast<T*>(dest + ii * dest_outer_stride +
+                                    j * dest_inner_stride) =
+                  *reinterpret_cast<const T*>(src + ii * src_outer_stride +
+                                              j * src_inner_stride);
+            }
+          }
+        }
+      }
+#endif
+      for (; i < i1; ++i) {
+        const char* src_row = src + i * src_outer_stride;
+        char* dest_row = dest + i * dest_outer_stride;
+        for (Index j = j0; j < j1; ++j) {
+          *reinterpret_cast<T*>(dest_row + j * dest_inner_stride) =
+              *reinterpret_cast<const T*>(src_row + j * src_inner_stride);
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+struct BlockedTransposeCopyLoop {
+  static bool Loop(void* /*context*/, IterationBufferShape shape,
+                   IterationBufferPointer source, IterationBufferPointer dest,
+                   void* /*arg*/) {
+    const Index rows = shape[0];
+    const Index cols = shape[1];
+    const char* src = static_cast<const char*>(source.pointer.get());
+    char* dst = static_cast<char*>(dest.pointer.get());
+    if (source.inner_byte_stride == static_cast<Index>(sizeof(T)) &&
+        dest.inner_byte_stride == static_cast<Index>(sizeof(T))) {
+      // Both sides contiguous along the inner dimension; copy row-wise.
+      for (Index i = 0; i < rows; ++i) {
+        std::memcpy(dst + i * dest.outer_byte_stride,
+                    src + i * source.outer_byte_stride, cols * sizeof(T));
+      }
+      return true;
+    }
+    CopyBlocked<T>(rows, cols, src, source.outer_byte_stride,
+                   source.inner_byte_stride, dst, dest.outer_byte_stride,
+                   dest.inner_byte_stride);
+    return true;
+  }
+};
+
+template <typename T>
+constexpr SpecializedElementwiseFunctionPointer<2, void*>
+GetBlockedTransposeCopyLoop() {
+  return &BlockedTransposeCopyLoop<T>::Loop;
+}
+
+}  // namespace
+
+SpecializedElementwiseFunctionPointer<2, void*> GetBlockedTransposeCopyFunction(
+    DataType dtype) {
+  switch (dtype->id) {
+    case DataTypeId::bool_t:
+    case DataTypeId::char_t:
+    case DataTypeId::byte_t:
+    case DataTypeId::int8_t:
+    case DataTypeId::uint8_t:
+    case DataTypeId::float8_e4m3fn_t:
+    case DataTypeId::float8_e4m3fnuz_t:
+    case DataTypeId::float8_e4m3b11fnuz_t:
+    case DataTypeId::float8_e5m2_t:
+    case DataTypeId::float8_e5m2fnuz_t:
+      return GetBlockedTransposeCopyLoop<uint8_t>();
+    case DataTypeId::int16_t:
+    case DataTypeId::uint16_t:
+    case DataTypeId::float16_t:
+    case DataTypeId::bfloat16_t:
+      return GetBlockedTransposeCopyLoop<uint16_t>();
+    case DataTypeId::int32_t:
+    case DataTypeId::uint32_t:
+    case DataTypeId::float32_t:
+      return GetBlockedTransposeCopyLoop<uint32_t>();
+    case DataTypeId::int64_t:
+    case DataTypeId::uint64_t:
+    case DataTypeId::float64_t:
+      return GetBlockedTransposeCopyLoop<uint64_t>();
+    case DataTypeId::complex64_t:
+      return GetBlockedTransposeCopyLoop<TwoUint32>();
+    case DataTypeId::complex128_t:
+      return GetBlockedTransposeCopyLoop<TwoUint64>();
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,49 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_BLOCKED_TRANSPOSE_COPY_H_
+#define TENSORSTORE_INTERNAL_BLOCKED_TRANSPOSE_COPY_H_
+
+/// \file
+/// Cache-blocked copy kernel for strided 2-d blocks of trivial elements.
+///
+/// When the input and output iterables of a copy prefer different dimension
+/// orders (e.g. a C-order zarr chunk copied to an F-order consumer), the
+/// element-at-a-time `copy_assign` loop for `IterationBufferKind::kStrided`
+/// buffers degenerates to a strided gather that thrashes the cache.  This
+/// kernel instead copies each 2-d block in L1-sized tiles, and uses a SIMD
+/// shuffle transpose (AVX2, selected at runtime) for 4-byte elements when the
+/// block is a pure transpose (input contiguous along the inner dimension,
+/// output contiguous along the outer dimension, or vice versa).
+
+#include "tensorstore/data_type.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Returns a replacement for `dtype->copy_assign[IterationBufferKind::
+/// kStrided]` that performs cache-blocked tiled copies, or `nullptr` if
+/// `dtype` is not a trivially-copyable scalar type of size 1, 2, 4, 8, or 16
+/// bytes.
+///
+/// The returned function ignores the closure context and the `void*` status
+/// argument, exactly like `copy_assign`.
+SpecializedElementwiseFunctionPointer<2, void*> GetBlockedTransposeCopyFunction(
+    DataType dtype);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_BLOCKED_TRANSPOSE_COPY_H_
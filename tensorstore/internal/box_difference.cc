@@ -72,26 +72,32 @@ namespace internal {
 ///
 /// As a special case, if the intersection is empty in any dimension, the
 /// difference is simply equal to `outer` (which is just a single box).
-namespace {
-Index GetNumSubtractionSubBoxes(BoxView<> outer, BoxView<> inner) {
+BoxDifference::BoxDifference(BoxView<> outer, BoxView<> inner)
+    : outer_(outer), inner_(inner), intersection_(outer.rank()) {
   assert(outer.rank() == inner.rank());
   const DimensionIndex rank = outer.rank();
   Index total_count = 1;
   for (DimensionIndex i = 0; i < rank; ++i) {
     IndexInterval outer_interval = outer[i];
     IndexInterval inner_interval = inner[i];
-    Index num_parts = 1;
-    if (Intersect(outer_interval, inner_interval).empty()) {
+    IndexInterval intersection = Intersect(outer_interval, inner_interval);
+    intersection_[i] = intersection;
+    if (intersection.empty()) {
       // Intersection in this dimension is empty, difference is simply equal to
       // `outer`.
-      return 1;
+      intersection_empty_ = true;
+      num_sub_boxes_ = 1;
+      return;
     }
+    Index num_parts = 1;
     if (outer_interval.inclusive_min() < inner_interval.inclusive_min()) {
       // "before" part is non-empty
+      has_before_[i] = true;
       ++num_parts;
     }
     if (outer_interval.inclusive_max() > inner_interval.inclusive_max()) {
       // "after" part is non-empty
+      has_after_[i] = true;
       ++num_parts;
     }
     // Note: total_count is bounded by `pow(3, kMaxRank)`, which cannot
@@ -100,53 +106,39 @@ Index GetNumSubtractionSubBoxes(BoxView<> outer, BoxView<> inner) {
   }
   // Subtract 1 for the one box corresponding to the intersection interval in
   // all dimensions, which is not included in the difference.
-  return total_count - 1;
+  num_sub_boxes_ = total_count - 1;
 }
-}  // namespace
-
-BoxDifference::BoxDifference(BoxView<> outer, BoxView<> inner)
-    : outer_(outer),
-      inner_(inner),
-      num_sub_boxes_(GetNumSubtractionSubBoxes(outer, inner)) {}
 
 void BoxDifference::GetSubBox(Index sub_box_index, MutableBoxView<> out) const {
   const DimensionIndex rank = out.rank();
   assert(rank == outer_.rank());
   assert(sub_box_index >= 0 && sub_box_index < num_sub_boxes_);
+  if (intersection_empty_) {
+    out.DeepAssign(outer_);
+    return;
+  }
   // Increment by 1, because the all zero bit pattern corresponds to the
   // intersection interval of all dimensions, which is not part of the
   // subtraction result.
   ++sub_box_index;
   for (DimensionIndex i = 0; i < rank; ++i) {
-    IndexInterval outer_interval = outer_[i];
-    IndexInterval inner_interval = inner_[i];
-    Index num_parts = 1;
-    IndexInterval intersection = Intersect(outer_interval, inner_interval);
-    if (intersection.empty()) {
-      out.DeepAssign(outer_);
-      return;
-    }
-    const bool has_before =
-        outer_interval.inclusive_min() < inner_interval.inclusive_min();
-    const bool has_after =
-        outer_interval.inclusive_max() > inner_interval.inclusive_max();
-    if (has_before) ++num_parts;
-    if (has_after) ++num_parts;
+    const Index num_parts = 1 + static_cast<Index>(has_before_[i]) +
+                            static_cast<Index>(has_after_[i]);
     const Index part_i = sub_box_index % num_parts;
     switch (part_i) {
       case 0:
-        out[i] = intersection;
+        out[i] = intersection_[i];
         break;
       case 1:
-        if (has_before) {
+        if (has_before_[i]) {
           out[i] = IndexInterval::UncheckedHalfOpen(
-              outer_interval.inclusive_min(), inner_interval.inclusive_min());
+              outer_[i].inclusive_min(), inner_[i].inclusive_min());
           break;
         }
         [[fallthrough]];
       case 2:
-        out[i] = IndexInterval::UncheckedHalfOpen(
-            inner_interval.exclusive_max(), outer_interval.exclusive_max());
+        out[i] = IndexInterval::UncheckedHalfOpen(inner_[i].exclusive_max(),
+                                                  outer_[i].exclusive_max());
         break;
     }
     sub_box_index /= num_parts;
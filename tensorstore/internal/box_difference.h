@@ -19,6 +19,8 @@
 
 #include "tensorstore/box.h"
 #include "tensorstore/index.h"
+#include "tensorstore/util/dimension_set.h"
+#include "tensorstore/util/iterate.h"
 
 namespace tensorstore {
 namespace internal {
@@ -26,6 +28,10 @@ namespace internal {
 /// Represents the difference of two n-dimensional boxes/hyperrectangles as a
 /// sequence of disjoint sub-boxes.
 ///
+/// The per-dimension decomposition into "before", "intersection", and "after"
+/// parts is precomputed by the constructor, so that enumerating the sub-boxes
+/// via `GetSubBox` does not recompute the intersection for each sub-box.
+///
 /// TODO(jbms): Consider implementing a C++ iterator interface.
 class BoxDifference {
  public:
@@ -56,6 +62,15 @@ class BoxDifference {
  private:
   BoxView<> outer_;
   BoxView<> inner_;
+  /// Intersection of `outer_` and `inner_`, precomputed per dimension.
+  Box<dynamic_rank(kNumInlinedDims)> intersection_;
+  /// Indicates for each dimension whether the "before" part is non-empty.
+  DimensionSet has_before_;
+  /// Indicates for each dimension whether the "after" part is non-empty.
+  DimensionSet has_after_;
+  /// Indicates that the intersection is empty in some dimension, in which case
+  /// the difference is simply equal to `outer_`.
+  bool intersection_empty_ = false;
   Index num_sub_boxes_;
 };
 
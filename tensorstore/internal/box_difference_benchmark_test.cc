@@ -0,0 +1,54 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include "tensorstore/box.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/internal/box_difference.h"
+
+namespace {
+
+using ::tensorstore::Box;
+using ::tensorstore::DimensionIndex;
+using ::tensorstore::Index;
+using ::tensorstore::IndexInterval;
+using ::tensorstore::internal::BoxDifference;
+
+// Enumerates all sub-boxes of the difference between an outer box and an inner
+// box strictly contained within it, which is the worst case of
+// `pow(3, rank) - 1` sub-boxes.  This is the pattern of the write-invalidation
+// path, where the difference between the old and new chunk grid bounds is
+// enumerated to determine the chunks to delete.
+void BM_EnumerateSubBoxes(benchmark::State& state) {
+  const DimensionIndex rank = state.range(0);
+  Box<> outer(rank), inner(rank), part(rank);
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    outer[i] = IndexInterval::UncheckedSized(0, 100);
+    inner[i] = IndexInterval::UncheckedSized(30, 40);
+  }
+  Index num_sub_boxes = 0;
+  for (auto s : state) {
+    BoxDifference difference(outer, inner);
+    for (Index i = 0, n = difference.num_sub_boxes(); i < n; ++i) {
+      difference.GetSubBox(i, part);
+      benchmark::DoNotOptimize(part);
+    }
+    num_sub_boxes += difference.num_sub_boxes();
+  }
+  state.SetItemsProcessed(num_sub_boxes);
+}
+BENCHMARK(BM_EnumerateSubBoxes)->DenseRange(1, 5);
+
+}  // namespace
@@ -0,0 +1,133 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/broadcast_fill.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+bool AllBytesEqual(const char* pattern, ptrdiff_t size) {
+  for (ptrdiff_t i = 1; i < size; ++i) {
+    if (pattern[i] != pattern[0]) return false;
+  }
+  return true;
+}
+
+/// Pair-of-scalar stand-ins for complex element types, which have the
+/// alignment of their component type rather than of a same-size integer.
+struct TwoUint32 {
+  uint32_t v[2];
+};
+struct TwoUint64 {
+  uint64_t v[2];
+};
+
+template <typename T>
+struct BroadcastFillLoop {
+  static bool Loop(void* /*context*/, IterationBufferShape shape,
+                   IterationBufferPointer source, IterationBufferPointer dest,
+                   void* /*arg*/) {
+    const Index rows = shape[0];
+    const Index cols = shape[1];
+    const char* src = static_cast<const char*>(source.pointer.get());
+    char* dst = static_cast<char*>(dest.pointer.get());
+    for (Index i = 0; i < rows; ++i) {
+      const T pattern =
+          *reinterpret_cast<const T*>(src + i * source.outer_byte_stride);
+      char* dst_row = dst + i * dest.outer_byte_stride;
+      if (dest.inner_byte_stride == static_cast<Index>(sizeof(T))) {
+        FillWithPattern(cols, sizeof(T), &pattern, dst_row);
+      } else {
+        for (Index j = 0; j < cols; ++j) {
+          *reinterpret_cast<T*>(dst_row + j * dest.inner_byte_stride) =
+              pattern;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace
+
+void FillWithPattern(Index count, ptrdiff_t element_size, const void* pattern,
+                     void* dest) {
+  if (count == 0) return;
+  const char* pattern_bytes = static_cast<const char*>(pattern);
+  char* dest_bytes = static_cast<char*>(dest);
+  if (AllBytesEqual(pattern_bytes, element_size)) {
+    std::memset(dest_bytes, pattern_bytes[0], count * element_size);
+    return;
+  }
+  // Store the pattern once, then repeatedly double the filled prefix with
+  // large (SIMD-optimized) memcpy calls.
+  const Index total_bytes = count * element_size;
+  std::memcpy(dest_bytes, pattern_bytes, element_size);
+  Index filled_bytes = element_size;
+  while (filled_bytes < total_bytes) {
+    const Index n = std::min(filled_bytes, total_bytes - filled_bytes);
+    std::memcpy(dest_bytes + filled_bytes, dest_bytes, n);
+    filled_bytes += n;
+  }
+}
+
+SpecializedElementwiseFunctionPointer<2, void*> GetBroadcastFillCopyFunction(
+    DataType dtype) {
+  switch (dtype->id) {
+    case DataTypeId::bool_t:
+    case DataTypeId::char_t:
+    case DataTypeId::byte_t:
+    case DataTypeId::int8_t:
+    case DataTypeId::uint8_t:
+    case DataTypeId::float8_e4m3fn_t:
+    case DataTypeId::float8_e4m3fnuz_t:
+    case DataTypeId::float8_e4m3b11fnuz_t:
+    case DataTypeId::float8_e5m2_t:
+    case DataTypeId::float8_e5m2fnuz_t:
+      return &BroadcastFillLoop<uint8_t>::Loop;
+    case DataTypeId::int16_t:
+    case DataTypeId::uint16_t:
+    case DataTypeId::float16_t:
+    case DataTypeId::bfloat16_t:
+      return &BroadcastFillLoop<uint16_t>::Loop;
+    case DataTypeId::int32_t:
+    case DataTypeId::uint32_t:
+    case DataTypeId::float32_t:
+      return &BroadcastFillLoop<uint32_t>::Loop;
+    case DataTypeId::int64_t:
+    case DataTypeId::uint64_t:
+    case DataTypeId::float64_t:
+      return &BroadcastFillLoop<uint64_t>::Loop;
+    case DataTypeId::complex64_t:
+      return &BroadcastFillLoop<TwoUint32>::Loop;
+    case DataTypeId::complex128_t:
+      return &BroadcastFillLoop<TwoUint64>::Loop;
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace internal
+}  // namespace tensorstore
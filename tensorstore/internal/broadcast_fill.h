@@ -0,0 +1,59 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_BROADCAST_FILL_H_
+#define TENSORSTORE_INTERNAL_BROADCAST_FILL_H_
+
+/// \file
+/// Broadcast-fill kernel for copying from constant (zero-stride) sources.
+///
+/// Reading a region backed by a missing chunk materializes the fill value by
+/// copying from a zero-stride broadcast array; the element-at-a-time
+/// `copy_assign` loop for `IterationBufferKind::kStrided` buffers runs far
+/// below memset speed for that case.  This kernel instead stores the repeated
+/// element pattern in large blocks (memset when all pattern bytes are equal,
+/// doubling memcpy otherwise).
+
+#include <stddef.h>
+
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Fills `count` contiguous elements of `element_size` bytes at `dest` with
+/// the pattern at `pattern`.
+///
+/// `dest` must not overlap `pattern`.
+void FillWithPattern(Index count, ptrdiff_t element_size, const void* pattern,
+                     void* dest);
+
+/// Returns a replacement for `dtype->copy_assign[IterationBufferKind::
+/// kStrided]` for blocks whose source inner byte stride is 0 (each source row
+/// is a single broadcast element), or `nullptr` if `dtype` is not a
+/// trivially-copyable scalar type.
+///
+/// The returned function must only be called for blocks satisfying
+/// `source.inner_byte_stride == 0`; the destination may have any strides.
+/// It ignores the closure context and the `void*` status argument, exactly
+/// like `copy_assign`.
+SpecializedElementwiseFunctionPointer<2, void*> GetBroadcastFillCopyFunction(
+    DataType dtype);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_BROADCAST_FILL_H_
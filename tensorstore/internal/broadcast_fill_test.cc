@@ -0,0 +1,105 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/broadcast_fill.h"
+
+#include <stdint.h>
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+namespace {
+
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::internal::FillWithPattern;
+using ::tensorstore::internal::GetBroadcastFillCopyFunction;
+using ::tensorstore::internal::IterationBufferPointer;
+
+TEST(FillWithPatternTest, ZeroCount) {
+  int32_t dest = 123;
+  const int32_t pattern = 456;
+  FillWithPattern(0, sizeof(int32_t), &pattern, &dest);
+  EXPECT_EQ(123, dest);
+}
+
+TEST(FillWithPatternTest, AllBytesEqual) {
+  const uint32_t pattern = 0xabababab;
+  std::vector<uint32_t> dest(37);
+  FillWithPattern(dest.size(), sizeof(uint32_t), &pattern, dest.data());
+  EXPECT_THAT(dest, ::testing::Each(pattern));
+}
+
+TEST(FillWithPatternTest, MultiBytePattern) {
+  const uint32_t pattern = 0x12345678;
+  // Non-power-of-2 count exercises the final partial doubling step.
+  std::vector<uint32_t> dest(37);
+  FillWithPattern(dest.size(), sizeof(uint32_t), &pattern, dest.data());
+  EXPECT_THAT(dest, ::testing::Each(pattern));
+}
+
+TEST(FillWithPatternTest, SingleElement) {
+  const uint64_t pattern = 0x0102030405060708;
+  uint64_t dest = 0;
+  FillWithPattern(1, sizeof(uint64_t), &pattern, &dest);
+  EXPECT_EQ(pattern, dest);
+}
+
+TEST(GetBroadcastFillCopyFunctionTest, SupportedTypes) {
+  EXPECT_NE(nullptr, GetBroadcastFillCopyFunction(dtype_v<bool>));
+  EXPECT_NE(nullptr, GetBroadcastFillCopyFunction(dtype_v<uint8_t>));
+  EXPECT_NE(nullptr, GetBroadcastFillCopyFunction(dtype_v<int32_t>));
+  EXPECT_NE(nullptr, GetBroadcastFillCopyFunction(dtype_v<double>));
+  EXPECT_NE(nullptr,
+            GetBroadcastFillCopyFunction(dtype_v<std::complex<float>>));
+  EXPECT_EQ(nullptr, GetBroadcastFillCopyFunction(dtype_v<std::string>));
+  EXPECT_EQ(nullptr, GetBroadcastFillCopyFunction(dtype_v<::nlohmann::json>));
+}
+
+TEST(GetBroadcastFillCopyFunctionTest, StridedDest) {
+  const auto fill = GetBroadcastFillCopyFunction(dtype_v<int32_t>);
+  ASSERT_NE(nullptr, fill);
+  const int32_t pattern[2] = {7, 8};
+  // Dest rows are interleaved: stride of 2 elements within a row.
+  std::vector<int32_t> dest(2 * 3 * 2, 0);
+  IterationBufferPointer source_pointer(const_cast<int32_t*>(pattern),
+                                        Index(sizeof(int32_t)), Index(0));
+  IterationBufferPointer dest_pointer(dest.data(), Index(3 * 2 * 4),
+                                      Index(2 * 4));
+  EXPECT_TRUE(fill(nullptr, {2, 3}, source_pointer, dest_pointer, nullptr));
+  EXPECT_THAT(dest, ::testing::ElementsAre(7, 0, 7, 0, 7, 0,  //
+                                           8, 0, 8, 0, 8, 0));
+}
+
+TEST(GetBroadcastFillCopyFunctionTest, ContiguousDest) {
+  const auto fill = GetBroadcastFillCopyFunction(dtype_v<int32_t>);
+  ASSERT_NE(nullptr, fill);
+  const int32_t pattern = 42;
+  std::vector<int32_t> dest(7, 0);
+  IterationBufferPointer source_pointer(const_cast<int32_t*>(&pattern),
+                                        Index(0), Index(0));
+  IterationBufferPointer dest_pointer(dest.data(), Index(7 * 4), Index(4));
+  EXPECT_TRUE(fill(nullptr, {1, 7}, source_pointer, dest_pointer, nullptr));
+  EXPECT_THAT(dest, ::testing::Each(42));
+}
+
+}  // namespace
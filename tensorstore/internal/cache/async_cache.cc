@@ -23,6 +23,7 @@
 #include <mutex>  // NOLINT
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/call_once.h"
 #include "absl/base/no_destructor.h"
@@ -35,6 +36,7 @@
 #include "tensorstore/batch.h"
 #include "tensorstore/batch_impl.h"
 #include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/writeback_pressure.h"
 #include "tensorstore/internal/compare.h"
 #include "tensorstore/internal/container/intrusive_linked_list.h"
 #include "tensorstore/internal/container/intrusive_red_black_tree.h"
@@ -206,6 +208,7 @@ void MaybeStartReadOrWriteback(Entry& entry, UniqueWriterLock<Entry> lock,
           if (read_request_issued) return;
           ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
               << *committing_transaction_node << "ReadyForCommit";
+          IncrementWritebackQueueDepth();
           committing_transaction_node->ReadyForCommit();
           break;
         case PrepareForCommitState::kReadyForCommitCalled:
@@ -258,6 +261,8 @@ void SetReadState(EntryOrNode& entry_or_node, ReadState&& read_state,
   if (change != 0) {
     if constexpr (std::is_same_v<EntryOrNode, TransactionNode>) {
       entry_or_node.UpdateSizeInBytes(change);
+      GetOwningCache(entry_or_node)
+          .UpdateQueuedWritebackSize(*entry_or_node.transaction(), change);
     } else {
       entry_or_node.NotifySizeChanged();
     }
@@ -323,8 +328,16 @@ Future<const void> RequestRead(EntryOrNode& entry_or_node,
     }
   }
 
+  // `staleness_bound` not satisfied by current data.  If stale data from a
+  // prior successful read is available and permitted, the returned future is
+  // ready immediately, but a read is still requested below in order to
+  // revalidate the cached data in the background.
+  const bool serve_stale_data =
+      options.stale_while_revalidate && existing_time != absl::InfinitePast() &&
+      !(must_not_be_known_to_be_stale &&
+        effective_request_state.known_to_be_stale);
+
   auto& request_state = entry_or_node.read_request_state_;
-  // `staleness_bound` not satisfied by current data.
   request_state.queued_time =
       std::max(request_state.queued_time,
                std::min(options.staleness_bound, absl::Now()));
@@ -332,12 +345,19 @@ Future<const void> RequestRead(EntryOrNode& entry_or_node,
       request_state.issued_time >= options.staleness_bound) {
     // Another read is in progress, and `staleness_bound` will be satisfied by
     // it when it completes.
+    if (serve_stale_data) return MakeReadyFuture();
     return GetFuture(request_state.issued);
   }
 
+  // Note: When serving stale data, `future` merely keeps the queued promise
+  // alive until the read is issued by `MaybeIssueRead` below; it is not
+  // returned to the caller.  If the read cannot be issued immediately (e.g.
+  // due to an in-progress writeback), the background revalidation may be
+  // elided as cancelled; a subsequent read request re-requests it.
   auto future = GetFuture(request_state.queued);
 
-  if (options.batch.deferred() && request_state.queued_request_is_deferred) {
+  if (!serve_stale_data && options.batch.deferred() &&
+      request_state.queued_request_is_deferred) {
     // Don't actually issue request, just ensure there is a batch node for
     // it.  The actual request will be issued when the batch is submitted.
     using BatchE = AsyncCacheBatchEntry<EntryOrNode>;
@@ -353,6 +373,7 @@ Future<const void> RequestRead(EntryOrNode& entry_or_node,
   }
 
   MaybeIssueRead(entry_or_node, std::move(lock), options.batch);
+  if (serve_stale_data) return MakeReadyFuture();
   return future;
 }
 
@@ -444,6 +465,7 @@ void RemoveTransactionFromMap(TransactionNode& node) {
 void ResolveIssuedWriteback(AsyncCache::TransactionNode& node,
                             UniqueWriterLock<Entry> lock) {
   auto& entry = GetOwningEntry(node);
+  DecrementWritebackQueueDepth();
 
   // Writeback of this transaction must have been in progress.
   assert(node.prepare_for_commit_state_.load(std::memory_order_relaxed) ==
@@ -555,6 +577,7 @@ void AsyncCache::TransactionNode::PrepareForCommit() {
       << *this << "PrepareForCommit";
   // Acquire reference to be released by `Commit`.
   intrusive_ptr_increment(this);
+  GetOwningCache(*this).UnqueueWriteback(*transaction());
   auto& entry = GetOwningEntry(*this);
   UniqueWriterLock lock(entry);
   RemoveTransactionFromMap(*this);
@@ -587,6 +610,7 @@ void AsyncCache::TransactionNode::PrepareForCommit() {
 
 void AsyncCache::TransactionNode::Abort() {
   ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG) << *this << "Abort";
+  GetOwningCache(*this).UnqueueWriteback(*transaction());
   auto& entry = GetOwningEntry(*this);
   UniqueWriterLock lock(entry);
   RemoveTransactionFromMap(*this);
@@ -621,6 +645,83 @@ void AsyncCache::TransactionNode::WritebackError() {
   ResolveIssuedWriteback(*this, UniqueWriterLock{GetOwningEntry(*this)});
 }
 
+bool AsyncCache::MaybeQueueWriteback(TransactionState& transaction) {
+  auto* pool = this->pool();
+  if (!pool) return false;
+  const auto& limits = pool->limits();
+  if (limits.queued_for_writeback_bytes_limit == 0) return false;
+  assert(transaction.implicit_transaction());
+  // Commit references to transactions for which writeback is to be requested,
+  // collected while holding `queued_writebacks_mutex_`.  `RequestCommit` must
+  // not be called with the mutex held, since commit may complete synchronously
+  // and re-enter `UnqueueWriteback`.
+  std::vector<TransactionState::CommitPtr> pending_commits;
+  {
+    absl::MutexLock lock(&queued_writebacks_mutex_);
+    auto [it, inserted] = queued_writebacks_.try_emplace(&transaction);
+    if (inserted) {
+      it->second.commit_ptr.reset(&transaction);
+      it->second.sequence = next_queued_writeback_sequence_++;
+      it->second.size = transaction.total_bytes();
+      queued_writeback_bytes_ += it->second.size;
+    }
+    const bool largest_first = limits.writeback_order ==
+                               CachePoolLimits::WritebackOrder::kLargestFirst;
+    while (queued_writeback_bytes_ > limits.queued_for_writeback_bytes_limit &&
+           !queued_writebacks_.empty()) {
+      auto victim = queued_writebacks_.begin();
+      for (auto other = queued_writebacks_.begin();
+           other != queued_writebacks_.end(); ++other) {
+        if (largest_first ? (other->second.size > victim->second.size ||
+                             (other->second.size == victim->second.size &&
+                              other->second.sequence < victim->second.sequence))
+                          : other->second.sequence < victim->second.sequence) {
+          victim = other;
+        }
+      }
+      ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+          << "requesting queued writeback: transaction=" << victim->first
+          << ", size=" << victim->second.size;
+      queued_writeback_bytes_ -= victim->second.size;
+      pending_commits.push_back(std::move(victim->second.commit_ptr));
+      queued_writebacks_.erase(victim);
+    }
+  }
+  for (auto& commit_ptr : pending_commits) {
+    commit_ptr->RequestCommit();
+  }
+  return true;
+}
+
+void AsyncCache::UpdateQueuedWritebackSize(TransactionState& transaction,
+                                           size_t new_minus_old) {
+  if (!transaction.implicit_transaction()) return;
+  auto* pool = this->pool();
+  if (!pool || pool->limits().queued_for_writeback_bytes_limit == 0) return;
+  absl::MutexLock lock(&queued_writebacks_mutex_);
+  auto it = queued_writebacks_.find(&transaction);
+  if (it == queued_writebacks_.end()) return;
+  it->second.size += new_minus_old;
+  queued_writeback_bytes_ += new_minus_old;
+}
+
+void AsyncCache::UnqueueWriteback(TransactionState& transaction) {
+  if (!transaction.implicit_transaction()) return;
+  auto* pool = this->pool();
+  if (!pool || pool->limits().queued_for_writeback_bytes_limit == 0) return;
+  TransactionState::CommitPtr commit_ptr;
+  {
+    absl::MutexLock lock(&queued_writebacks_mutex_);
+    auto it = queued_writebacks_.find(&transaction);
+    if (it == queued_writebacks_.end()) return;
+    queued_writeback_bytes_ -= it->second.size;
+    // Release the commit reference with the mutex released, since releasing
+    // the last commit reference invokes transaction cleanup.
+    commit_ptr = std::move(it->second.commit_ptr);
+    queued_writebacks_.erase(it);
+  }
+}
+
 Result<OpenTransactionNodePtr<AsyncCache::TransactionNode>>
 AsyncCache::Entry::GetTransactionNodeImpl(OpenTransactionPtr& transaction) {
   // Initializes `node` if it has not already been initialized.  Returns `true`
@@ -677,7 +778,9 @@ AsyncCache::Entry::GetTransactionNodeImpl(OpenTransactionPtr& transaction) {
         std::swap(stale_node, node);
         continue;
       }
-      node->transaction()->RequestCommit();
+      if (!GetOwningCache(*this).MaybeQueueWriteback(*node->transaction())) {
+        node->transaction()->RequestCommit();
+      }
       break;
     }
   } else {
@@ -747,6 +850,7 @@ void AsyncCache::TransactionNode::WriterUnlock() {
   const size_t change = new_size - std::exchange(write_state_size_, new_size);
   if (change == 0) return;
   this->UpdateSizeInBytes(change);
+  GetOwningCache(*this).UpdateQueuedWritebackSize(*transaction(), change);
 }
 
 bool AsyncCache::TransactionNode::try_lock() {
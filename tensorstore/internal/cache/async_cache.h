@@ -19,6 +19,7 @@
 /// `Cache` class with asynchronous read and read-modify-write functionality.
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <memory>
@@ -28,11 +29,13 @@
 
 #include "absl/base/call_once.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/cache/cache.h"
 #include "tensorstore/internal/container/intrusive_red_black_tree.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -332,6 +335,20 @@ class AsyncCache : public Cache {
 
     /// Batch to use.
     Batch::View batch;
+
+    /// If cached data from a prior successful read is available but does not
+    /// satisfy `staleness_bound`, complete the request immediately with the
+    /// stale cached data, and revalidate it in the background.  The
+    /// revalidation read is issued immediately rather than deferred to
+    /// `batch`, since no caller is waiting on it.
+    ///
+    /// This avoids blocking periodic latency spikes when a bounded staleness
+    /// interval expires, at the cost of the caller possibly observing data
+    /// older than `staleness_bound`.  It has no effect if no prior read has
+    /// completed successfully, or if the cached data is known to be stale due
+    /// to a local modification (unless `must_not_be_known_to_be_stale` is
+    /// `false`).
+    bool stale_while_revalidate = false;
   };
 
   /// Base Entry class.  `Derived` classes must define a nested `Derived::Entry`
@@ -514,6 +531,25 @@ class AsyncCache : public Cache {
 
     ~TransactionNode();
 
+    /// Like cache entries, transaction nodes are allocated per write and
+    /// churned heavily; recycle their storage through the thread-local
+    /// size-class pool.
+    static void* operator new(size_t size) {
+      if (ArenaHeapBlockPool::Eligible(size,
+                                       __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+        return GetArenaHeapBlockPool().Allocate(size);
+      }
+      return ::operator new(size);
+    }
+    static void operator delete(void* p, size_t size) {
+      if (ArenaHeapBlockPool::Eligible(size,
+                                       __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+        GetArenaHeapBlockPool().Deallocate(p, size);
+        return;
+      }
+      ::operator delete(p, size);
+    }
+
     /// Acquires an exclusive lock on the "modification state" (i.e. `mutex_`).
     /// When recording modifications, this lock must be held.  `TransactionNode`
     /// may be used with `UniqueWriterLock`.
@@ -953,7 +989,60 @@ class AsyncCache : public Cache {
   /// }
   virtual TransactionNode* DoAllocateTransactionNode(Entry& entry) = 0;
 
+  // Treat as private:
+  //
+  // The following methods implement deferred writeback of non-transactional
+  // writes (see `CachePoolLimits::queued_for_writeback_bytes_limit`).
+
+  // Called in place of `TransactionState::RequestCommit` for the implicit
+  // transaction created by a non-transactional write.
+  //
+  // If deferred writeback is not enabled for the cache pool, returns `false`
+  // without queuing `transaction`; the caller must then request commit
+  // directly.  Otherwise, adds `transaction` to `queued_writebacks_` (holding
+  // a commit reference to keep it alive) and returns `true`.  If the total
+  // queued size then exceeds `queued_for_writeback_bytes_limit`, additionally
+  // requests commit of queued transactions, in the order specified by
+  // `CachePoolLimits::writeback_order`, until the queued size is below the
+  // limit.
+  bool MaybeQueueWriteback(TransactionState& transaction);
+
+  // Adjusts the queued size accounted to `transaction` by `new_minus_old`, if
+  // `transaction` is queued.  Note that this does not itself trigger
+  // writeback, since it may be called with entry or node locks held; the
+  // queued size is only checked against the limit by `MaybeQueueWriteback`.
+  void UpdateQueuedWritebackSize(TransactionState& transaction,
+                                 size_t new_minus_old);
+
+  // Removes `transaction` from `queued_writebacks_`, if queued.  Called once
+  // commit or abort of `transaction` begins.
+  void UnqueueWriteback(TransactionState& transaction);
+
  private:
+  struct QueuedWriteback {
+    // Commit reference that keeps the transaction alive (and prevents it from
+    // being aborted) while queued.
+    TransactionState::CommitPtr commit_ptr;
+    // Monotonically increasing sequence number indicating age.
+    uint64_t sequence;
+    // Size currently accounted to this transaction in
+    // `queued_writeback_bytes_`.  Approximates `transaction->total_bytes()`.
+    size_t size;
+  };
+
+  absl::Mutex queued_writebacks_mutex_;
+
+  // Implicit transactions for which writeback has been deferred.
+  absl::flat_hash_map<TransactionState*, QueuedWriteback> queued_writebacks_
+      ABSL_GUARDED_BY(queued_writebacks_mutex_);
+
+  // Sum of the `size` members of `queued_writebacks_`.
+  size_t queued_writeback_bytes_ ABSL_GUARDED_BY(queued_writebacks_mutex_) = 0;
+
+  // Sequence number to assign to the next queued writeback.
+  uint64_t next_queued_writeback_sequence_
+      ABSL_GUARDED_BY(queued_writebacks_mutex_) = 0;
+
   size_t batch_nesting_depth_ = 0;
 };
 
@@ -346,6 +346,56 @@ TEST(AsyncCacheTest, ReadBasic) {
   }
 }
 
+TEST(AsyncCacheTest, StaleWhileRevalidate) {
+  auto pool = CachePool::Make(CachePool::Limits{});
+  RequestLog log;
+  auto cache = GetCache<TestCache>(
+      pool.get(), "", [&] { return std::make_unique<TestCache>(&log); });
+  auto entry = GetCacheEntry(cache, "a");
+
+  // With no prior successful read, the request blocks on the read.
+  {
+    AsyncCache::AsyncCacheReadRequest request;
+    request.staleness_bound = absl::Now();
+    request.stale_while_revalidate = true;
+    auto read_future = entry->Read(request);
+    ASSERT_FALSE(read_future.ready());
+    ASSERT_EQ(1, log.reads.size());
+    log.reads.pop().Success(absl::Now());
+    ASSERT_TRUE(read_future.ready());
+    TENSORSTORE_EXPECT_OK(read_future);
+  }
+
+  // Cached data that does not satisfy the staleness bound is returned
+  // immediately, while a revalidation read is issued in the background.
+  {
+    AsyncCache::AsyncCacheReadRequest request;
+    request.staleness_bound = UniqueNow();
+    request.stale_while_revalidate = true;
+    auto read_future = entry->Read(request);
+    ASSERT_TRUE(read_future.ready());
+    TENSORSTORE_EXPECT_OK(read_future);
+    ASSERT_EQ(1, log.reads.size());
+
+    // A second request while the revalidation read is in progress also
+    // completes immediately.
+    auto read_future1 = entry->Read(request);
+    ASSERT_TRUE(read_future1.ready());
+    TENSORSTORE_EXPECT_OK(read_future1);
+    ASSERT_EQ(1, log.reads.size());
+
+    auto read_time = absl::Now();
+    log.reads.pop().Success(read_time);
+
+    // Once revalidated, a normal read within the updated time completes
+    // immediately without issuing another read request.
+    auto read_future2 = entry->Read({read_time});
+    ASSERT_TRUE(read_future2.ready());
+    TENSORSTORE_EXPECT_OK(read_future2);
+    ASSERT_EQ(0, log.reads.size());
+  }
+}
+
 TEST(AsyncCacheTest, ReadFailed) {
   auto pool = CachePool::Make(kSmallCacheLimits);
   RequestLog log;
@@ -577,6 +627,115 @@ TEST(AsyncCacheTest, WritebackRequestedByCache) {
   ASSERT_EQ(0, log.writebacks.size());
 }
 
+// Performs a non-transactional write of the specified `size` to `entry`, and
+// returns the commit future of the associated implicit transaction.
+Future<const void> DeferredWrite(
+    const tensorstore::internal::PinnedCacheEntry<TestCache>& entry,
+    size_t size) {
+  auto node = entry->CreateWriteTransaction();
+  UniqueWriterLock lock(*node);
+  node->size = size;
+  node->MarkSizeUpdated();
+  return node->transaction()->future();
+}
+
+TEST(AsyncCacheTest, QueuedWritebackLargestFirst) {
+  CachePool::Limits limits;
+  limits.queued_for_writeback_bytes_limit = 1000;
+  auto pool = CachePool::Make(limits);
+  RequestLog log;
+  auto cache = GetCache<TestCache>(
+      pool.get(), "", [&] { return std::make_unique<TestCache>(&log); });
+  auto entry_a = GetCacheEntry(cache, "a");
+  auto entry_b = GetCacheEntry(cache, "b");
+  auto entry_c = GetCacheEntry(cache, "c");
+  auto entry_d = GetCacheEntry(cache, "d");
+
+  // Writeback is deferred while the queued size remains below the limit.
+  auto write_a = DeferredWrite(entry_a, 300);
+  auto write_b = DeferredWrite(entry_b, 500);
+  auto write_c = DeferredWrite(entry_c, 600);
+  ASSERT_EQ(0, log.writebacks.size());
+
+  // The queued size (1400) now exceeds the limit.  Writeback of the largest
+  // queued write ("c") is requested when the next write is queued, bringing
+  // the queued size (900) back below the limit.
+  auto write_d = DeferredWrite(entry_d, 100);
+  ASSERT_EQ(1, log.writebacks.size());
+  {
+    auto write_req = log.writebacks.pop();
+    EXPECT_EQ("c", GetOwningEntry(*write_req.node).key());
+    write_req.Success();
+  }
+  ASSERT_TRUE(write_c.ready());
+  TENSORSTORE_EXPECT_OK(write_c);
+
+  // Forcing the future of a queued write still requests writeback immediately.
+  write_a.Force();
+  ASSERT_EQ(1, log.writebacks.size());
+  {
+    auto write_req = log.writebacks.pop();
+    EXPECT_EQ("a", GetOwningEntry(*write_req.node).key());
+    write_req.Success();
+  }
+  ASSERT_TRUE(write_a.ready());
+  TENSORSTORE_EXPECT_OK(write_a);
+
+  // Drain the remaining queued writes.
+  write_b.Force();
+  write_d.Force();
+  log.HandleWritebacks();
+  ASSERT_TRUE(write_b.ready());
+  ASSERT_TRUE(write_d.ready());
+  TENSORSTORE_EXPECT_OK(write_b);
+  TENSORSTORE_EXPECT_OK(write_d);
+}
+
+TEST(AsyncCacheTest, QueuedWritebackOldestFirst) {
+  CachePool::Limits limits;
+  limits.queued_for_writeback_bytes_limit = 1000;
+  limits.writeback_order = CachePool::Limits::WritebackOrder::kOldestFirst;
+  auto pool = CachePool::Make(limits);
+  RequestLog log;
+  auto cache = GetCache<TestCache>(
+      pool.get(), "", [&] { return std::make_unique<TestCache>(&log); });
+  auto entry_a = GetCacheEntry(cache, "a");
+  auto entry_b = GetCacheEntry(cache, "b");
+  auto entry_c = GetCacheEntry(cache, "c");
+  auto entry_d = GetCacheEntry(cache, "d");
+
+  auto write_a = DeferredWrite(entry_a, 300);
+  auto write_b = DeferredWrite(entry_b, 600);
+  auto write_c = DeferredWrite(entry_c, 600);
+  ASSERT_EQ(0, log.writebacks.size());
+
+  // The queued size (1500) now exceeds the limit.  Writeback of the two
+  // oldest queued writes ("a" and then "b") is requested when the next write
+  // is queued, bringing the queued size (700) back below the limit.
+  auto write_d = DeferredWrite(entry_d, 100);
+  ASSERT_EQ(2, log.writebacks.size());
+  {
+    auto write_req = log.writebacks.pop();
+    EXPECT_EQ("a", GetOwningEntry(*write_req.node).key());
+    write_req.Success();
+  }
+  {
+    auto write_req = log.writebacks.pop();
+    EXPECT_EQ("b", GetOwningEntry(*write_req.node).key());
+    write_req.Success();
+  }
+  ASSERT_TRUE(write_a.ready());
+  ASSERT_TRUE(write_b.ready());
+  TENSORSTORE_EXPECT_OK(write_a);
+  TENSORSTORE_EXPECT_OK(write_b);
+
+  write_c.Force();
+  write_d.Force();
+  log.HandleWritebacks();
+  ASSERT_TRUE(write_c.ready());
+  ASSERT_TRUE(write_d.ready());
+}
+
 TEST(AsyncCacheTest, TransactionalReadBasic) {
   auto pool = CachePool::Make(CachePool::Limits{});
   RequestLog log;
@@ -17,12 +17,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <array>
+#include <algorithm>
 #include <atomic>
-#include <bitset>
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <mutex>  // NOLINT
+#include <ostream>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -35,10 +36,12 @@
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/function_ref.h"
+#include "absl/strings/escaping.h"
 #include "absl/synchronization/mutex.h"
 #include "tensorstore/internal/cache/cache_pool_limits.h"
 #include "tensorstore/internal/container/intrusive_linked_list.h"
 #include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/memory_budget.h"
 #include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/mutex.h"
@@ -74,12 +77,33 @@ inline void DebugAssertMutexHeld(absl::Mutex* mutex) {}
 using LruListAccessor =
     internal::intrusive_linked_list::MemberAccessor<LruListNode>;
 
+namespace {
+size_t ReclaimPoolBytes(CachePoolImpl* pool, size_t bytes_to_reclaim);
+}  // namespace
+
 CachePoolImpl::CachePoolImpl(const CachePool::Limits& limits)
-    : limits_(limits),
-      total_bytes_(0),
-      strong_references_(1),
-      weak_references_(1) {
-  Initialize(LruListAccessor{}, &eviction_queue_);
+    : limits_(limits), strong_references_(1), weak_references_(1) {
+  for (auto& lru_shard : lru_shards_) {
+    Initialize(LruListAccessor{}, &lru_shard.eviction_queue);
+  }
+  if (limits_.total_bytes_limit != 0) {
+    // Participate in the process-wide memory budget: when the budget is
+    // exceeded, unused entries are evicted beyond what this pool's own limit
+    // requires.
+    budget_reclaimer_token_ =
+        internal::MemoryBudget::Global().RegisterReclaimer(
+            internal::MemoryBudget::kPriorityCachePool,
+            [this](size_t bytes_to_reclaim) {
+              return ReclaimPoolBytes(this, bytes_to_reclaim);
+            });
+  }
+}
+
+CachePoolImpl::~CachePoolImpl() {
+  if (budget_reclaimer_token_ != 0) {
+    internal::MemoryBudget::Global().UnregisterReclaimer(
+        budget_reclaimer_token_);
+  }
 }
 
 namespace {
@@ -127,94 +151,130 @@ void UnlinkListNode(LruListNode* node) noexcept {
 
 void UnregisterEntryFromPool(CacheEntryImpl* entry,
                              CachePoolImpl* pool) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
+  auto& lru_shard = pool->ShardForKey(entry->key_);
+  DebugAssertMutexHeld(&lru_shard.mutex);
   UnlinkListNode(entry);
-  pool->total_bytes_.fetch_sub(entry->num_bytes_, std::memory_order_relaxed);
+  lru_shard.total_bytes.fetch_sub(entry->num_bytes_,
+                                  std::memory_order_relaxed);
+  internal::MemoryBudget::Global().AdjustUsage(
+      -static_cast<ptrdiff_t>(entry->num_bytes_));
 }
 
 void AddToEvictionQueue(CachePoolImpl* pool, CacheEntryImpl* entry) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
-  auto* eviction_queue = &pool->eviction_queue_;
+  auto& lru_shard = pool->ShardForKey(entry->key_);
+  DebugAssertMutexHeld(&lru_shard.mutex);
   if (!OnlyContainsNode(LruListAccessor{}, entry)) {
     Remove(LruListAccessor{}, entry);
   }
-  InsertBefore(LruListAccessor{}, eviction_queue, entry);
+  entry->lru_sequence_ =
+      pool->next_lru_sequence_.fetch_add(1, std::memory_order_relaxed);
+  InsertBefore(LruListAccessor{}, &lru_shard.eviction_queue, entry);
 }
 
 void DestroyCache(CachePoolImpl* pool, CacheImpl* cache);
 
-void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
-  DebugAssertMutexHeld(&pool->lru_mutex_);
-
-  constexpr size_t kBufferSize = 64;
-  std::array<CacheEntryImpl*, kBufferSize> entries_to_delete;
-  // Indicates for each entry in `entries_to_delete` whether its cache should
-  // also be deleted.
-  std::bitset<kBufferSize> should_delete_cache_for_entry;
-  size_t num_entries_to_delete = 0;
-
-  const auto destroy_entries = [&] {
-    internal::ScopedWriterUnlock unlock(pool->lru_mutex_);
-    for (size_t i = 0; i < num_entries_to_delete; ++i) {
-      auto* entry = entries_to_delete[i];
-      if (should_delete_cache_for_entry[i]) {
-        DestroyCache(entry->cache_->pool_, entry->cache_);
+// Evicts least-recently-used entries while the pool's total size exceeds
+// `target_total_bytes`.
+//
+// Must be called without holding any LRU shard mutex.
+void EvictEntriesDownTo(CachePoolImpl* pool,
+                        size_t target_total_bytes) noexcept {
+  while (pool->total_bytes() > target_total_bytes) {
+    // Find the shard whose queue front is the globally least-recently-used
+    // entry, as indicated by `lru_sequence_`.  The choice is approximate,
+    // since the queues may change concurrently.
+    CachePoolImpl::LruShard* oldest_shard = nullptr;
+    uint64_t oldest_sequence = 0;
+    for (auto& lru_shard : pool->lru_shards_) {
+      absl::MutexLock lock(&lru_shard.mutex);
+      auto* queue = &lru_shard.eviction_queue;
+      if (queue->next == queue) continue;
+      const uint64_t sequence =
+          static_cast<CacheEntryImpl*>(queue->next)->lru_sequence_;
+      if (!oldest_shard || sequence < oldest_sequence) {
+        oldest_shard = &lru_shard;
+        oldest_sequence = sequence;
       }
-      // Note: The cache that owns entry may have already been destroyed.
-      entry->cache_ = nullptr;
-      delete Access::StaticCast<CacheEntry>(entry);
     }
-  };
-
-  while (pool->total_bytes_.load(std::memory_order_acquire) >
-         pool->limits_.total_bytes_limit) {
-    auto* queue = &pool->eviction_queue_;
-    if (queue->next == queue) {
-      // Queue empty.
+    if (!oldest_shard) {
+      // All queues empty.
       break;
     }
-    auto* entry = static_cast<CacheEntryImpl*>(queue->next);
-    auto* cache = entry->cache_;
-    bool evict = false;
+    CacheEntryImpl* entry_to_delete = nullptr;
     bool should_delete_cache = false;
-    auto& shard = cache->ShardForKey(entry->key_);
-    if (absl::MutexLock lock(&shard.mutex);
-        entry->reference_count_.load(std::memory_order_acquire) == 0) {
-      [[maybe_unused]] size_t erase_count = shard.entries.erase(entry);
-      assert(erase_count == 1);
-      if (shard.entries.empty()) {
-        if (DecrementCacheReferenceCount(cache,
-                                         CacheImpl::kNonEmptyShardIncrement)
-                .should_delete()) {
-          should_delete_cache = true;
+    {
+      absl::MutexLock lru_lock(&oldest_shard->mutex);
+      auto* queue = &oldest_shard->eviction_queue;
+      if (queue->next == queue) continue;
+      auto* entry = static_cast<CacheEntryImpl*>(queue->next);
+      // Entries with remaining regeneration-cost credits are passed over and
+      // re-queued as most recently used instead of evicted; the total number
+      // of credits is finite, so eviction still terminates.
+      if (const uint16_t cost =
+              entry->eviction_cost_.load(std::memory_order_relaxed);
+          cost > 0) {
+        entry->eviction_cost_.store(cost - 1, std::memory_order_relaxed);
+        AddToEvictionQueue(pool, entry);
+        continue;
+      }
+      auto* cache = entry->cache_;
+      bool evict = false;
+      auto& shard = cache->ShardForKey(entry->key_);
+      if (absl::MutexLock lock(&shard.mutex);
+          entry->reference_count_.load(std::memory_order_acquire) == 0) {
+        [[maybe_unused]] size_t erase_count = shard.entries.erase(entry);
+        assert(erase_count == 1);
+        if (shard.entries.empty()) {
+          if (DecrementCacheReferenceCount(cache,
+                                           CacheImpl::kNonEmptyShardIncrement)
+                  .should_delete()) {
+            should_delete_cache = true;
+          }
         }
+        evict = true;
       }
-      evict = true;
-    }
-    if (!evict) {
-      // Entry is still in use, remove it from LRU eviction list.  For
-      // efficiency, entries aren't removed from the eviction list when the
-      // reference count increases.  It will be put back on the eviction list
-      // the next time the reference count becomes 0.  There is no race
-      // condition here because both `cache->entries_mutex_` and
-      // `pool->lru_mutex_` are held, and the reference count cannot increase
-      // from zero except while holding `cache->entries_mutex_`, and the
-      // reference count cannot decrease to zero except while holding
-      // `pool->lru_mutex_`.
-      UnlinkListNode(entry);
-      continue;
+      if (!evict) {
+        // Entry is still in use, remove it from LRU eviction list.  For
+        // efficiency, entries aren't removed from the eviction list when the
+        // reference count increases.  It will be put back on the eviction
+        // list the next time the reference count becomes 0.  There is no race
+        // condition here because both the entry shard mutex and the LRU shard
+        // mutex are held, and the reference count cannot increase from zero
+        // except while holding the entry shard mutex, and the reference count
+        // cannot decrease to zero except while holding the LRU shard mutex.
+        UnlinkListNode(entry);
+        continue;
+      }
+      UnregisterEntryFromPool(entry, pool);
+      evict_count.Increment();
+      pool->evict_count_.fetch_add(1, std::memory_order_relaxed);
+      entry_to_delete = entry;
     }
-    UnregisterEntryFromPool(entry, pool);
-    evict_count.Increment();
-    // Enqueue entry to be destroyed with `pool->lru_mutex_` released.
-    should_delete_cache_for_entry[num_entries_to_delete] = should_delete_cache;
-    entries_to_delete[num_entries_to_delete++] = entry;
-    if (num_entries_to_delete == entries_to_delete.size()) {
-      destroy_entries();
-      num_entries_to_delete = 0;
+    // Destroy the entry with no LRU shard mutex held.
+    if (should_delete_cache) {
+      DestroyCache(entry_to_delete->cache_->pool_, entry_to_delete->cache_);
     }
+    // Note: The cache that owns entry may have already been destroyed.
+    entry_to_delete->cache_ = nullptr;
+    delete Access::StaticCast<CacheEntry>(entry_to_delete);
   }
-  destroy_entries();
+}
+
+// Evicts least-recently-used entries while the pool is over its byte limit.
+//
+// Must be called without holding any LRU shard mutex.
+void MaybeEvictEntries(CachePoolImpl* pool) noexcept {
+  EvictEntriesDownTo(pool, pool->limits_.total_bytes_limit);
+}
+
+// Reclaimer registered with `internal::MemoryBudget`: evicts unused entries
+// to free approximately `bytes_to_reclaim` bytes, and returns the number of
+// bytes actually freed.
+size_t ReclaimPoolBytes(CachePoolImpl* pool, size_t bytes_to_reclaim) {
+  const size_t before = pool->total_bytes();
+  EvictEntriesDownTo(pool, before - std::min(before, bytes_to_reclaim));
+  const size_t after = pool->total_bytes();
+  return before - std::min(before, after);
 }
 
 void InitializeNewEntry(CacheEntryImpl* entry, CacheImpl* cache) noexcept {
@@ -239,8 +299,14 @@ void DestroyCache(CachePoolImpl* pool,
       }
     }
     if (HasLruCache(pool)) {
-      absl::MutexLock lru_lock(&pool->lru_mutex_);
-      for (auto& shard : cache->shards_) {
+      // The i-th entry shard of the cache and the i-th LRU shard of the pool
+      // are keyed by the same hash, so all entries of `cache->shards_[i]`
+      // belong to `pool->lru_shards_[i]`.
+      for (size_t shard_index = 0; shard_index < CacheImpl::kNumShards;
+           ++shard_index) {
+        auto& lru_shard = pool->lru_shards_[shard_index];
+        auto& shard = cache->shards_[shard_index];
+        absl::MutexLock lru_lock(&lru_shard.mutex);
         absl::MutexLock lock(&shard.mutex);
         for (CacheEntryImpl* entry : shard.entries) {
           // Increment reference count by 2, to ensure that concurrently
@@ -370,7 +436,9 @@ void StrongPtrTraitsCacheEntry::decrement_impl(
     } else {
       auto lock = DecrementReferenceCountWithLock(
           entry_impl->reference_count_,
-          [pool_impl]() -> absl::Mutex& { return pool_impl->lru_mutex_; },
+          [&]() -> absl::Mutex& {
+            return pool_impl->ShardForKey(entry_impl->key_).mutex;
+          },
           new_count,
           /*decrease_amount=*/2, /*lock_threshold=*/1);
       TENSORSTORE_INTERNAL_CACHE_DEBUG_REFCOUNT("CacheEntry:decrement",
@@ -378,6 +446,9 @@ void StrongPtrTraitsCacheEntry::decrement_impl(
       if (!lock) return;
       if (new_count == 0) {
         AddToEvictionQueue(pool_impl, entry_impl);
+        // Release the LRU shard mutex before evicting, since eviction
+        // acquires the shard mutexes itself.
+        lock = {};
         MaybeEvictEntries(pool_impl);
       }
     }
@@ -502,6 +573,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
     auto it = shard.entries.find(key);
     if (it != shard.entries.end()) {
       hit_count.Increment();
+      cache_impl->pool_->hit_count_.fetch_add(1, std::memory_order_relaxed);
       auto* entry_impl = *it;
       auto old_count =
           entry_impl->reference_count_.fetch_add(2, std::memory_order_acq_rel);
@@ -520,6 +592,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
                                   internal::adopt_object_ref);
     } else {
       miss_count.Increment();
+      cache_impl->pool_->miss_count_.fetch_add(1, std::memory_order_relaxed);
       std::string temp_key(key);  // May throw, done before allocating entry.
       auto* entry_impl =
           Access::StaticCast<CacheEntryImpl>(cache->DoAllocateEntry());
@@ -550,7 +623,7 @@ PinnedCacheEntry<Cache> GetCacheEntryInternal(internal::Cache* cache,
     if (HasLruCache(cache_impl->pool_)) {
       size_t new_size = entry_impl->num_bytes_ =
           cache->DoGetSizeInBytes(returned_entry.get());
-      UpdateTotalBytes(*cache_impl->pool_, new_size);
+      UpdateTotalBytes(*cache_impl->pool_, *entry_impl, new_size);
     }
   });
   return returned_entry;
@@ -674,7 +747,8 @@ void intrusive_ptr_decrement(CacheEntryWeakState* p)
   }
   auto pool_lock = DecrementReferenceCountWithLock(
       entry->reference_count_,
-      [pool]() -> absl::Mutex& { return pool->lru_mutex_; }, new_count,
+      [&]() -> absl::Mutex& { return pool->ShardForKey(entry->key_).mutex; },
+      new_count,
       /*decrease_amount=*/1,
       /*lock_threshold=*/0);
   TENSORSTORE_INTERNAL_CACHE_DEBUG_REFCOUNT("CacheEntry:decrement", entry,
@@ -685,6 +759,9 @@ void intrusive_ptr_decrement(CacheEntryWeakState* p)
   // state if applicable.
   weak_lock = {};
   AddToEvictionQueue(pool, entry);
+  // Release the LRU shard mutex before evicting, since eviction acquires the
+  // shard mutexes itself.
+  pool_lock = {};
   MaybeEvictEntries(pool);
 }
 
@@ -724,15 +801,42 @@ internal::IntrusivePtr<CacheEntryWeakState> AcquireWeakCacheEntryReference(
       weak_state, internal::adopt_object_ref);
 }
 
-void UpdateTotalBytes(CachePoolImpl& pool, ptrdiff_t change) {
-  assert(HasLruCache(&pool));
-  if (pool.total_bytes_.fetch_add(change, std::memory_order_acq_rel) + change <=
-          pool.limits_.total_bytes_limit ||
-      change <= 0) {
+// Invokes the registered high-water-mark callback if `total_bytes()` has
+// crossed the mark from below.  Must be called without holding any LRU shard
+// or cache shard mutex.
+void MaybeNotifyHighWaterMark(CachePoolImpl* pool) {
+  const size_t high_water_mark =
+      pool->high_water_mark_bytes_.load(std::memory_order_relaxed);
+  if (high_water_mark == 0) return;
+  const size_t total_bytes = pool->total_bytes();
+  if (total_bytes < high_water_mark) {
+    pool->above_high_water_mark_.store(false, std::memory_order_relaxed);
+    return;
+  }
+  if (pool->above_high_water_mark_.exchange(true, std::memory_order_relaxed)) {
+    // Already notified since the total was last observed below the mark.
     return;
   }
-  absl::MutexLock lock(&pool.lru_mutex_);
-  MaybeEvictEntries(&pool);
+  std::function<void(size_t)> callback;
+  {
+    absl::MutexLock lock(&pool->high_water_mark_mutex_);
+    callback = pool->high_water_mark_callback_;
+  }
+  if (callback) callback(total_bytes);
+}
+
+void UpdateTotalBytes(CachePoolImpl& pool, CacheEntryImpl& entry,
+                      ptrdiff_t change) {
+  assert(HasLruCache(&pool));
+  pool.ShardForKey(entry.key_)
+      .total_bytes.fetch_add(change, std::memory_order_acq_rel);
+  internal::MemoryBudget::Global().AdjustUsage(change);
+  if (change > 0 && pool.total_bytes() > pool.limits_.total_bytes_limit) {
+    MaybeEvictEntries(&pool);
+  }
+  // Notify after eviction, so that the callback reflects only memory that
+  // could not be reclaimed by evicting unused entries.
+  MaybeNotifyHighWaterMark(&pool);
 }
 
 }  // namespace internal_cache
@@ -785,7 +889,69 @@ void CacheEntry::WriterUnlock() {
   ptrdiff_t change = new_size - std::exchange(num_bytes_, new_size);
   lock.unlock();
 
-  internal_cache::UpdateTotalBytes(*pool_impl, change);
+  internal_cache::UpdateTotalBytes(
+      *pool_impl,
+      *internal_cache::Access::StaticCast<internal_cache::CacheEntryImpl>(this),
+      change);
+}
+
+CachePool::Stats CachePool::CollectStats(bool include_entries) {
+  auto* pool =
+      internal_cache::Access::StaticCast<internal_cache::CachePoolImpl>(this);
+  Stats stats;
+  stats.limits = pool->limits_;
+  stats.total_bytes = pool->total_bytes();
+  stats.hit_count = pool->hit_count_.load(std::memory_order_relaxed);
+  stats.miss_count = pool->miss_count_.load(std::memory_order_relaxed);
+  stats.evict_count = pool->evict_count_.load(std::memory_order_relaxed);
+  absl::MutexLock lock(&pool->caches_mutex_);
+  stats.caches.reserve(pool->caches_.size());
+  for (internal_cache::CacheImpl* cache : pool->caches_) {
+    auto& cache_stats = stats.caches.emplace_back();
+    cache_stats.cache_identifier = cache->cache_identifier_;
+    cache_stats.cache_type = cache->cache_type_->name();
+    for (auto& shard : cache->shards_) {
+      absl::MutexLock shard_lock(&shard.mutex);
+      cache_stats.num_entries += shard.entries.size();
+      for (internal_cache::CacheEntryImpl* entry : shard.entries) {
+        // `num_bytes_` and `lru_sequence_` are guarded by other mutexes that
+        // cannot be acquired here without inverting the lock order; they are
+        // read unsynchronized, consistent with the approximate nature of the
+        // snapshot.
+        const size_t num_bytes = entry->num_bytes_;
+        cache_stats.total_bytes += num_bytes;
+        if (!include_entries) continue;
+        auto& entry_stats = cache_stats.entries.emplace_back();
+        entry_stats.key = entry->key_;
+        entry_stats.num_bytes = num_bytes;
+        entry_stats.use_count =
+            entry->reference_count_.load(std::memory_order_acquire) / 2;
+        entry_stats.lru_sequence = entry->lru_sequence_;
+      }
+    }
+  }
+  return stats;
+}
+
+std::ostream& operator<<(std::ostream& os, const CachePool::Stats& stats) {
+  os << "{ total_bytes=" << stats.total_bytes
+     << ", total_bytes_limit=" << stats.limits.total_bytes_limit
+     << ", hit_count=" << stats.hit_count
+     << ", miss_count=" << stats.miss_count
+     << ", evict_count=" << stats.evict_count << " }";
+  for (const auto& cache_stats : stats.caches) {
+    os << "\ncache " << cache_stats.cache_type << " \""
+       << absl::CHexEscape(cache_stats.cache_identifier)
+       << "\": num_entries=" << cache_stats.num_entries
+       << ", total_bytes=" << cache_stats.total_bytes;
+    for (const auto& entry_stats : cache_stats.entries) {
+      os << "\n  entry \"" << absl::CHexEscape(entry_stats.key)
+         << "\": num_bytes=" << entry_stats.num_bytes
+         << ", use_count=" << entry_stats.use_count
+         << ", lru_sequence=" << entry_stats.lru_sequence;
+    }
+  }
+  return os;
 }
 
 CachePool::StrongPtr CachePool::Make(const CachePool::Limits& cache_limits) {
@@ -795,6 +961,17 @@ CachePool::StrongPtr CachePool::Make(const CachePool::Limits& cache_limits) {
   return pool;
 }
 
+void CachePool::SetHighWaterMarkCallback(
+    size_t high_water_mark_bytes, std::function<void(size_t)> callback) {
+  {
+    absl::MutexLock lock(&high_water_mark_mutex_);
+    high_water_mark_callback_ = std::move(callback);
+  }
+  high_water_mark_bytes_.store(high_water_mark_bytes,
+                               std::memory_order_relaxed);
+  above_high_water_mark_.store(false, std::memory_order_relaxed);
+}
+
 CachePool::StrongPtr::StrongPtr(const CachePool::WeakPtr& ptr)
     : Base(ptr.get(), adopt_object_ref) {
   if (!ptr) return;
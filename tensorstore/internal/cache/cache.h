@@ -63,15 +63,21 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <functional>
+#include <iosfwd>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/cache/cache_impl.h"
 #include "tensorstore/internal/cache/cache_pool_limits.h"
 #include "tensorstore/internal/intrusive_ptr.h"
@@ -106,6 +112,104 @@ class CachePool : private internal_cache::CachePoolImpl {
   /// Returns the limits of this cache pool.
   const Limits& limits() const { return limits_; }
 
+  /// Registers a callback to be invoked when the total number of bytes in use
+  /// crosses `high_water_mark_bytes` from below.
+  ///
+  /// `Limits::total_bytes_limit` is a soft limit: in-use entries cannot be
+  /// evicted, so the pool may overshoot it arbitrarily while reads or decodes
+  /// are in flight.  This callback allows the application to react to such
+  /// overshoot, e.g. by releasing its own buffers or throttling the admission
+  /// of further requests.
+  ///
+  /// The callback is invoked with the observed total number of bytes, from an
+  /// arbitrary thread that is in the middle of a cache operation.  It must not
+  /// block or re-enter the cache pool or any cache contained in it; any
+  /// non-trivial work should be scheduled on a separate executor.  After the
+  /// callback is invoked, it is not invoked again until the total is first
+  /// observed below `high_water_mark_bytes`.  Crossing detection is
+  /// approximate, to the same degree that `Limits::total_bytes_limit` is.
+  ///
+  /// \param high_water_mark_bytes Threshold in bytes, typically greater than
+  ///     `Limits::total_bytes_limit`.  A value of 0 disables notification.
+  /// \param callback Callback to register, replacing any previously-registered
+  ///     callback.  May be null to unregister.
+  void SetHighWaterMarkCallback(size_t high_water_mark_bytes,
+                                std::function<void(size_t)> callback);
+
+  /// Statistics for a single cache entry, as returned by `CollectStats`.
+  struct EntryStats {
+    /// Entry key (may contain arbitrary bytes).
+    std::string key;
+
+    /// Most recently computed size of the entry in bytes.
+    size_t num_bytes;
+
+    /// Number of strong references to the entry.  A non-zero count indicates
+    /// the entry is in use and cannot be evicted.
+    uint32_t use_count;
+
+    /// Sequence number assigned when the entry was most recently added to an
+    /// eviction queue; lower values indicate less recently used entries.
+    /// Only meaningful for entries with `use_count == 0`.
+    uint64_t lru_sequence;
+  };
+
+  /// Statistics for a single cache, as returned by `CollectStats`.
+  struct CacheStats {
+    /// Identifier specified when the cache was created with `GetCache`.
+    std::string cache_identifier;
+
+    /// Implementation-defined name of the cache type.
+    std::string cache_type;
+
+    /// Number of entries in the cache.
+    size_t num_entries = 0;
+
+    /// Sum of the entry sizes in bytes.
+    size_t total_bytes = 0;
+
+    /// Per-entry statistics.  Empty unless `include_entries` was specified.
+    std::vector<EntryStats> entries;
+  };
+
+  /// Statistics for a cache pool, as returned by `CollectStats`.
+  struct Stats {
+    /// Limits of the pool.
+    Limits limits;
+
+    /// Approximate total number of bytes consumed by entries in the pool.
+    size_t total_bytes;
+
+    /// Number of times an entry lookup found an existing entry.
+    int64_t hit_count;
+
+    /// Number of times an entry lookup allocated a new entry.
+    int64_t miss_count;
+
+    /// Number of entries evicted due to memory pressure.
+    int64_t evict_count;
+
+    /// Per-cache statistics, for each cache registered in the pool under a
+    /// non-empty cache key.
+    std::vector<CacheStats> caches;
+
+    /// Prints a human-readable multi-line representation, suitable for
+    /// debugging output.
+    friend std::ostream& operator<<(std::ostream& os, const Stats& stats);
+  };
+
+  /// Collects a snapshot of the current contents of the pool, for debugging
+  /// and for tuning `Limits::total_bytes_limit`.
+  ///
+  /// The snapshot is approximate: entry sizes, reference counts, and LRU
+  /// sequence numbers are read without per-entry synchronization and may be
+  /// slightly stale with respect to concurrent cache operations.
+  ///
+  /// \param include_entries If `true`, includes per-entry statistics in
+  ///     `CacheStats::entries`.  Enumerating every entry may briefly block
+  ///     concurrent lookups on large pools.
+  Stats CollectStats(bool include_entries = false);
+
   class WeakPtr;
 
   /// Reference-counted pointer to a cache pool that keeps in-use and recently
@@ -261,6 +365,22 @@ class ABSL_LOCKABLE CacheEntry : private internal_cache::CacheEntryImpl {
     flags_ |= kSizeChanged;
   }
 
+  /// Maximum value accepted by `SetEvictionCost`; larger values are clamped.
+  constexpr static size_t kMaxEvictionCost = 64;
+
+  /// Sets the relative cost of regenerating this entry, weighed by the cache
+  /// pool's eviction policy in the style of cost-aware policies such as GDSF.
+  ///
+  /// An entry with cost `n` is passed over, and re-queued as most recently
+  /// used, up to `n` times when it reaches the front of the eviction queue,
+  /// so costly-to-regenerate entries are preferentially retained.  The
+  /// default cost of 0 gives plain least-recently-used behavior.
+  void SetEvictionCost(size_t cost) {
+    eviction_cost_.store(
+        static_cast<uint16_t>(std::min(cost, kMaxEvictionCost)),
+        std::memory_order_relaxed);
+  }
+
   /// Initializes an entry after it is allocated.
   ///
   /// Derived classes may override this method if initialization is required.
@@ -280,6 +400,24 @@ class ABSL_LOCKABLE CacheEntry : private internal_cache::CacheEntryImpl {
     return internal_cache::AcquireWeakCacheEntryReference(this);
   }
 
+  /// Entries are churned constantly under eviction; recycle their storage
+  /// through the thread-local size-class pool rather than the global heap.
+  /// This applies to all derived entry types, since `DoAllocateEntry`
+  /// implementations allocate with a plain new-expression.
+  static void* operator new(size_t size) {
+    if (ArenaHeapBlockPool::Eligible(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+      return GetArenaHeapBlockPool().Allocate(size);
+    }
+    return ::operator new(size);
+  }
+  static void operator delete(void* p, size_t size) {
+    if (ArenaHeapBlockPool::Eligible(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__)) {
+      GetArenaHeapBlockPool().Deallocate(p, size);
+      return;
+    }
+    ::operator delete(p, size);
+  }
+
   /// Destroys the cache entry.
   ///
   /// Warning: The destructor must not call `GetOwningCache(*this)` to obtain a
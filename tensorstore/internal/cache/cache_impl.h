@@ -25,6 +25,7 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -143,6 +144,18 @@ class CacheEntryImpl : public internal_cache::LruListNode {
   // Set if the return value of `DoGetSizeInBytes` may have changed.
   constexpr static Flags kSizeChanged = 1;
 
+  // Sequence number assigned when the entry was most recently added to an
+  // eviction queue; orders entries across the per-shard eviction queues of the
+  // pool.  Must only be accessed while holding the mutex of the entry's LRU
+  // shard (`CachePoolImpl::ShardForKey(key_)`).
+  uint64_t lru_sequence_;
+
+  // Remaining regeneration-cost credits, set via
+  // `CacheEntry::SetEvictionCost`.  Each time the entry reaches the front of
+  // the eviction queue with a non-zero credit, it is re-queued as most
+  // recently used and one credit is consumed, instead of being evicted.
+  std::atomic<uint16_t> eviction_cost_{0};
+
   // Initially set to `nullptr`.  Allocated when the first weak reference is
   // obtained, and remains until the entry is destroyed even if all weak
   // references are released.
@@ -218,8 +231,9 @@ class CacheImpl {
   /// If a thread causes the reference count to reach a ``ShouldDelete == true`
   /// state from a `ShouldDelete == false` state, then the thread must destroy
   /// the cache immediately. However, because of the use of multiple mutexes
-  /// (per shard mutexes on the cache entries hash table, `pool_->lru mutex_`,
-  /// `pool_->caches_mutex_`), it is possible for another thread that is
+  /// (per shard mutexes on the cache entries hash table, the pool's LRU shard
+  /// mutexes, `pool_->caches_mutex_`), it is possible for another thread that
+  /// is
   /// modifying `reference_count` to encounter a cache already in the
   /// `ShouldDelete == true`. In this case, the other thread is NOT responsible
   /// for destroying the cache, but can safely access it as long as it holds the
@@ -251,9 +265,16 @@ class CacheImpl {
 
   Shard shards_[kNumShards];
 
-  Shard& ShardForKey(std::string_view key) {
+  /// Returns the shard index for `key`.  The pool's LRU shards
+  /// (`CachePoolImpl::ShardForKey`) use the same mapping, so all entries of
+  /// the i-th entry shard of a cache belong to the i-th LRU shard of the pool.
+  static size_t ShardIndexForKey(std::string_view key) {
     absl::Hash<std::string_view> h;
-    return shards_[h(key) & 7];
+    return h(key) & (kNumShards - 1);
+  }
+
+  Shard& ShardForKey(std::string_view key) {
+    return shards_[ShardIndexForKey(key)];
   }
 
   // Key by which a cache may be looked up in a `CachePool`.
@@ -267,26 +288,82 @@ class CacheImpl {
 class CachePoolImpl {
  public:
   explicit CachePoolImpl(const CachePoolLimits& limits);
+  ~CachePoolImpl();
 
   using CacheKey = CacheImpl::CacheKey;
 
+  constexpr static size_t kNumShards = CacheImpl::kNumShards;
+
   CachePoolLimits limits_;
-  std::atomic<size_t> total_bytes_;
 
-  // Protects access to `eviction_queue_`.  If `lru_mutex_` is held at the same
-  // time as `caches_mutex_`, `caches_mutex_` must be acquired first.  If
-  // `lru_mutex_` is held at the same time as `entries_mutex_`, `lru_mutex_`
-  // must be acquired first.
-  absl::Mutex lru_mutex_;
+  // Eviction bookkeeping is sharded by entry key hash so that concurrent entry
+  // pin/unpin operations do not serialize on a single pool-wide mutex.  Each
+  // shard maintains its own LRU eviction queue and byte count; the limit check
+  // sums the per-shard byte counts (approximately, since the counts may change
+  // concurrently), and eviction removes the least-recently-used entry among
+  // the shard queue fronts, as determined by `CacheEntryImpl::lru_sequence_`.
+  struct ABSL_CACHELINE_ALIGNED LruShard {
+    // Protects access to `eviction_queue`.  If an LRU shard mutex is held at
+    // the same time as `caches_mutex_`, `caches_mutex_` must be acquired
+    // first.  If an LRU shard mutex is held at the same time as a
+    // `CacheImpl::Shard` mutex, the LRU shard mutex must be acquired first.
+    absl::Mutex mutex;
 
-  // next points to the front of the queue, which is the first to be evicted.
-  LruListNode eviction_queue_;
+    // next points to the front of the queue, which is the first to be evicted.
+    LruListNode eviction_queue;
+
+    // Bytes consumed by entries assigned to this shard.
+    std::atomic<size_t> total_bytes{0};
+  };
+
+  LruShard lru_shards_[kNumShards];
+
+  /// Returns the LRU shard for `key`.  Uses the same mapping as
+  /// `CacheImpl::ShardForKey`.
+  LruShard& ShardForKey(std::string_view key) {
+    return lru_shards_[CacheImpl::ShardIndexForKey(key)];
+  }
+
+  /// Returns the approximate total number of bytes consumed by entries in the
+  /// pool.  The per-shard counts are summed without synchronization.
+  size_t total_bytes() const {
+    size_t total = 0;
+    for (const auto& lru_shard : lru_shards_) {
+      total += lru_shard.total_bytes.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  // Assigns `CacheEntryImpl::lru_sequence_` values.
+  std::atomic<uint64_t> next_lru_sequence_{0};
+
+  // Per-pool statistics (see `CachePool::CollectStats`).  These parallel the
+  // global `/tensorstore/cache/*` metrics but are attributable to a single
+  // pool.
+  std::atomic<int64_t> hit_count_{0};
+  std::atomic<int64_t> miss_count_{0};
+  std::atomic<int64_t> evict_count_{0};
+
+  // High-water-mark notification state (see
+  // `CachePool::SetHighWaterMarkCallback`).  The callback is invoked, without
+  // any cache pool or cache mutex held, when `total_bytes()` is observed to
+  // cross `high_water_mark_bytes_` from below; it is re-armed once the total
+  // is observed below the mark again.
+  absl::Mutex high_water_mark_mutex_;
+  std::function<void(size_t)> high_water_mark_callback_
+      ABSL_GUARDED_BY(high_water_mark_mutex_);
+  std::atomic<size_t> high_water_mark_bytes_{0};
+  std::atomic<bool> above_high_water_mark_{false};
 
   // Protects access to `caches_`.
   absl::Mutex caches_mutex_;
   internal::HeterogeneousHashSet<CacheImpl*, CacheKey, &CacheImpl::cache_key>
       caches_;
 
+  // Token for the eviction reclaimer registered with the process-wide
+  // `internal::MemoryBudget`, or 0 if none was registered.
+  int64_t budget_reclaimer_token_ = 0;
+
   /// Initial strong reference returned when the cache pool is created.
   std::atomic<size_t> strong_references_;
   /// One weak reference is kept until strong_references_ becomes 0.
@@ -395,7 +472,8 @@ inline bool HasLruCache(CachePoolImpl* pool) {
   return pool && pool->limits_.total_bytes_limit != 0;
 }
 
-void UpdateTotalBytes(CachePoolImpl& pool, ptrdiff_t change);
+void UpdateTotalBytes(CachePoolImpl& pool, CacheEntryImpl& entry,
+                      ptrdiff_t change);
 
 }  // namespace internal_cache
 }  // namespace tensorstore
@@ -22,10 +22,40 @@ namespace internal {
 
 /// Memory limit parameters for a cache pool.
 struct CachePoolLimits {
+  /// Specifies the order in which writeback is requested for queued
+  /// non-transactional writes once `queued_for_writeback_bytes_limit` is
+  /// exceeded.
+  enum class WritebackOrder {
+    /// Writeback is requested for the implicit transaction with the largest
+    /// number of dirty bytes first.  Among transactions of equal size, older
+    /// transactions are written back first.
+    kLargestFirst,
+    /// Writeback is requested in the order in which the implicit transactions
+    /// were created.
+    kOldestFirst,
+  };
+
   size_t total_bytes_limit = 0;
 
+  /// Soft limit on the total number of dirty bytes due to non-transactional
+  /// writes that may be queued for writeback.
+  ///
+  /// If equal to 0 (the default), writeback of each non-transactional write is
+  /// requested as soon as the write completes.  If non-zero, writeback is
+  /// instead deferred until either the returned commit future is forced or the
+  /// total queued size exceeds this limit, at which point writeback is
+  /// requested according to `writeback_order` until the queued size is below
+  /// the limit.  As with `total_bytes_limit`, this limit is approximate and
+  /// may be exceeded transiently.
+  size_t queued_for_writeback_bytes_limit = 0;
+
+  /// Order in which queued writebacks are requested.  Has no effect unless
+  /// `queued_for_writeback_bytes_limit` is non-zero.
+  WritebackOrder writeback_order = WritebackOrder::kLargestFirst;
+
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-    return f(x.total_bytes_limit);
+    return f(x.total_bytes_limit, x.queued_for_writeback_bytes_limit,
+             x.writeback_order);
   };
 };
 
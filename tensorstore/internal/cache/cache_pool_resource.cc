@@ -14,12 +14,15 @@
 
 #include "tensorstore/internal/cache/cache_pool_resource.h"
 
+#include <string_view>
+
 #include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/cache/cache.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/json_binding/enum.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
 #include "tensorstore/util/result.h"
 
@@ -37,7 +40,20 @@ struct CachePoolResourceTraits
     return jb::Object(
         jb::Member("total_bytes_limit",
                    jb::Projection(&Spec::total_bytes_limit,
-                                  jb::DefaultValue([](auto* v) { *v = 0; }))));
+                                  jb::DefaultValue([](auto* v) { *v = 0; }))),
+        jb::Member("queued_for_writeback_bytes_limit",
+                   jb::Projection(&Spec::queued_for_writeback_bytes_limit,
+                                  jb::DefaultValue([](auto* v) { *v = 0; }))),
+        jb::Member(
+            "writeback_order",
+            jb::Projection(
+                &Spec::writeback_order,
+                jb::DefaultValue(
+                    [](auto* v) { *v = Spec::WritebackOrder::kLargestFirst; },
+                    jb::Enum<Spec::WritebackOrder, std::string_view>({
+                        {Spec::WritebackOrder::kLargestFirst, "largest_first"},
+                        {Spec::WritebackOrder::kOldestFirst, "oldest_first"},
+                    })))));
   }
   static Result<Resource> Create(const Spec& limits,
                                  ContextResourceCreationContext context) {
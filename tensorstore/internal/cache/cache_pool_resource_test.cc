@@ -16,9 +16,11 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/status/status.h"
 #include <nlohmann/json.hpp>
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/cache_pool_limits.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/status.h"
@@ -28,6 +30,7 @@ namespace {
 
 using ::tensorstore::Context;
 using ::tensorstore::MatchesStatus;
+using ::tensorstore::internal::CachePoolLimits;
 using ::tensorstore::internal::CachePoolResource;
 
 TEST(CachePoolResourceTest, Default) {
@@ -52,4 +55,21 @@ TEST(CachePoolResourceTest, TotalBytesLimitOnly) {
   EXPECT_EQ(100u, (*cache)->limits().total_bytes_limit);
 }
 
+TEST(CachePoolResourceTest, QueuedForWritebackBytesLimit) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto resource_spec, Context::Resource<CachePoolResource>::FromJson(
+                              {{"queued_for_writeback_bytes_limit", 500},
+                               {"writeback_order", "oldest_first"}}));
+  auto cache = Context::Default().GetResource(resource_spec).value();
+  EXPECT_EQ(500u, (*cache)->limits().queued_for_writeback_bytes_limit);
+  EXPECT_EQ(CachePoolLimits::WritebackOrder::kOldestFirst,
+            (*cache)->limits().writeback_order);
+}
+
+TEST(CachePoolResourceTest, InvalidWritebackOrder) {
+  EXPECT_THAT(Context::Resource<CachePoolResource>::FromJson(
+                  {{"writeback_order", "smallest_first"}}),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
 }  // namespace
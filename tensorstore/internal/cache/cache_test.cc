@@ -22,6 +22,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -163,7 +164,11 @@ void AssertInvariants(const CachePool::StrongPtr& pool,
                       absl::flat_hash_set<Cache*> expected_caches)
     ABSL_NO_THREAD_SAFETY_ANALYSIS {
   auto* pool_impl = GetPoolImpl(pool);
-  auto eviction_queue_entries = GetEntrySet(&pool_impl->eviction_queue_);
+  absl::flat_hash_set<EntryIdentifier> eviction_queue_entries;
+  for (auto& lru_shard : pool_impl->lru_shards_) {
+    auto shard_entries = GetEntrySet(&lru_shard.eviction_queue);
+    eviction_queue_entries.insert(shard_entries.begin(), shard_entries.end());
+  }
 
   absl::flat_hash_set<EntryIdentifier> expected_eviction_queue_entries;
 
@@ -202,7 +207,7 @@ void AssertInvariants(const CachePool::StrongPtr& pool,
     }
   }
 
-  EXPECT_EQ(expected_total_bytes, pool_impl->total_bytes_);
+  EXPECT_EQ(expected_total_bytes, pool_impl->total_bytes());
 
   EXPECT_THAT(expected_eviction_queue_entries,
               ::testing::IsSubsetOf(eviction_queue_entries));
@@ -597,6 +602,33 @@ TEST_P(NamedOrAnonymousCacheTest, UpdateSizeNoEvict) {
               UnorderedElementsAre(Pair(cache_key, "a")));  // No change
 }
 
+TEST_P(NamedOrAnonymousCacheTest, EvictionCostRetainsEntry) {
+  CachePool::Limits limits;
+  limits.total_bytes_limit = 10000;
+  auto pool = CachePool::Make(limits);
+  auto test_cache = GetCache(pool);
+  {
+    auto entry = GetCacheEntry(test_cache, "a");
+    entry->data = "a";
+    entry->ChangeSize(5000);
+    entry->SetEvictionCost(1);
+  }
+  {
+    auto entry = GetCacheEntry(test_cache, "b");
+    entry->data = "b";
+    entry->ChangeSize(5000);
+  }
+  EXPECT_THAT(log->entry_destroy_log, ElementsAre());
+
+  // Adding another entry triggers eviction.  "a" is least recently used but
+  // holds one cost credit, so it is passed over and "b" is evicted instead.
+  GetCacheEntry(test_cache, "c")->data = "c";
+  EXPECT_THAT(log->entry_destroy_log,
+              UnorderedElementsAre(Pair(cache_key, "b")));
+  TENSORSTORE_INTERNAL_ASSERT_CACHE_INVARIANTS(pool, {test_cache.get()});
+  EXPECT_EQ("a", GetCacheEntry(test_cache, "a")->data);
+}
+
 // Tests that having one cache hold a strong pointer to another cache does not
 // lead to a circular reference and memory leak (the actual test is done by the
 // heap leak checker or sanitizer).
@@ -1103,6 +1135,71 @@ TEST(CacheTest, PoolWithNonZeroBytesLimit) {
   EXPECT_THAT(log->entry_destroy_log, ElementsAre(Pair("cache", "a")));
 }
 
+TEST(CacheTest, HighWaterMarkCallback) {
+  auto pool = CachePool::Make(CachePool::Limits{10000});
+  std::vector<size_t> notifications;
+  pool->SetHighWaterMarkCallback(
+      20000, [&](size_t total_bytes) { notifications.push_back(total_bytes); });
+  auto cache = GetTestCache(pool.get(), "cache");
+  auto entry = GetCacheEntry(cache, "a");
+
+  // The pinned entry may overshoot `total_bytes_limit` without reaching the
+  // high-water mark.
+  entry->ChangeSize(15000);
+  EXPECT_THAT(notifications, ElementsAre());
+
+  // Growing past the high-water mark invokes the callback once.
+  entry->ChangeSize(25000);
+  EXPECT_THAT(notifications, ElementsAre(25000));
+
+  // Growing further does not notify again.
+  entry->ChangeSize(30000);
+  EXPECT_THAT(notifications, ElementsAre(25000));
+
+  // Shrinking below the mark re-arms the notification.
+  entry->ChangeSize(15000);
+  entry->ChangeSize(25000);
+  EXPECT_THAT(notifications, ElementsAre(25000, 25000));
+}
+
+TEST(CacheTest, CollectStats) {
+  auto pool = CachePool::Make(CachePool::Limits{10000000});
+  auto cache = GetTestCache(pool.get(), "cache");
+  {
+    auto entry_a = GetCacheEntry(cache, "a");
+    entry_a->ChangeSize(5000);
+    auto entry_b = GetCacheEntry(cache, "b");
+    entry_b->ChangeSize(3000);
+
+    auto stats = pool->CollectStats(/*include_entries=*/true);
+    EXPECT_EQ(10000000, stats.limits.total_bytes_limit);
+    EXPECT_EQ(8000, stats.total_bytes);
+    EXPECT_EQ(0, stats.hit_count);
+    EXPECT_EQ(2, stats.miss_count);
+    EXPECT_EQ(0, stats.evict_count);
+    ASSERT_EQ(1, stats.caches.size());
+    const auto& cache_stats = stats.caches[0];
+    EXPECT_EQ("cache", cache_stats.cache_identifier);
+    EXPECT_EQ(2, cache_stats.num_entries);
+    EXPECT_EQ(8000, cache_stats.total_bytes);
+    ASSERT_EQ(2, cache_stats.entries.size());
+    for (const auto& entry_stats : cache_stats.entries) {
+      EXPECT_THAT(entry_stats.key, ::testing::AnyOf("a", "b"));
+      EXPECT_EQ(entry_stats.key == "a" ? 5000 : 3000, entry_stats.num_bytes);
+      EXPECT_EQ(1, entry_stats.use_count);
+    }
+  }
+  // A repeated lookup is counted as a hit, and released entries as not in use.
+  GetCacheEntry(cache, "a");
+  auto stats = pool->CollectStats(/*include_entries=*/true);
+  EXPECT_EQ(1, stats.hit_count);
+  EXPECT_EQ(2, stats.miss_count);
+  ASSERT_EQ(1, stats.caches.size());
+  for (const auto& entry_stats : stats.caches[0].entries) {
+    EXPECT_EQ(0, entry_stats.use_count);
+  }
+}
+
 TEST(CacheTest, WeakRefOwnedByEntry) {
   auto log = std::make_shared<TestCache::RequestLog>();
   auto pool = CachePool::Make(kSmallCacheLimits);
@@ -0,0 +1,187 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/cached_kvstore.h"
+
+#include <stddef.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/cache/async_cache.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/internal/cache/kvs_backed_cache.h"
+#include "tensorstore/internal/estimate_heap_usage/estimate_heap_usage.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/execution.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/garbage_collection.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+/// Caches the encoded value associated with each key of the base kvstore.
+///
+/// The "decoding" performed by this cache is trivial: the value is simply
+/// retained as an `absl::Cord`.  Generation and staleness handling is
+/// provided by `KvsBackedCache`.
+class KvStoreValueCache
+    : public internal::KvsBackedCache<KvStoreValueCache, internal::AsyncCache> {
+  using Base =
+      internal::KvsBackedCache<KvStoreValueCache, internal::AsyncCache>;
+
+ public:
+  using ReadData = absl::Cord;
+  using Base::Base;
+
+  class Entry : public Base::Entry {
+   public:
+    using OwningCache = KvStoreValueCache;
+
+    size_t ComputeReadDataSizeInBytes(const void* read_data) override {
+      return internal::EstimateHeapUsage(
+          *static_cast<const absl::Cord*>(read_data));
+    }
+
+    void DoDecode(std::optional<absl::Cord> value,
+                  DecodeReceiver receiver) override {
+      std::shared_ptr<absl::Cord> read_data;
+      if (value) {
+        read_data = std::make_shared<absl::Cord>(*std::move(value));
+      }
+      execution::set_value(receiver, std::move(read_data));
+    }
+  };
+
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+  TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
+    return new TransactionNode(static_cast<Entry&>(entry));
+  }
+};
+
+class CachedKvStoreDriver final : public kvstore::Driver {
+ public:
+  explicit CachedKvStoreDriver(CachePtr<KvStoreValueCache> cache)
+      : cache_(std::move(cache)) {}
+
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    return base()->Write(std::move(key), std::move(value), std::move(options));
+  }
+
+  absl::Status ReadModifyWrite(internal::OpenTransactionPtr& transaction,
+                               size_t& phase, Key key,
+                               ReadModifyWriteSource& source) override {
+    return base()->ReadModifyWrite(transaction, phase, std::move(key), source);
+  }
+
+  absl::Status TransactionalDeleteRange(
+      const internal::OpenTransactionPtr& transaction,
+      KeyRange range) override {
+    return base()->TransactionalDeleteRange(transaction, std::move(range));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    return base()->DeleteRange(std::move(range));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    return base()->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base()->DescribeKey(key);
+  }
+
+  Result<kvstore::DriverSpecPtr> GetBoundSpec() const override {
+    return base()->GetBoundSpec();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base()->GetSupportedFeatures(key_range);
+  }
+
+  void GarbageCollectionVisit(
+      garbage_collection::GarbageCollectionVisitor& visitor) const override {
+    return base()->GarbageCollectionVisit(visitor);
+  }
+
+  kvstore::Driver* base() const { return cache_->kvstore_driver(); }
+
+ private:
+  CachePtr<KvStoreValueCache> cache_;
+};
+
+Future<kvstore::ReadResult> CachedKvStoreDriver::Read(Key key,
+                                                      ReadOptions options) {
+  auto entry = GetCacheEntry(cache_, key);
+  auto read_future = entry->Read({options.staleness_bound, options.batch});
+  return MapFuture(
+      InlineExecutor{},
+      [entry = std::move(entry), options = std::move(options)](
+          const Result<void>& result) -> Result<kvstore::ReadResult> {
+        TENSORSTORE_RETURN_IF_ERROR(result);
+        AsyncCache::ReadLock<absl::Cord> lock(*entry);
+        auto stamp = lock.stamp();
+        if (!options.generation_conditions.Matches(stamp.generation)) {
+          return kvstore::ReadResult::Unspecified(std::move(stamp));
+        }
+        if (!lock.data()) {
+          return kvstore::ReadResult::Missing(std::move(stamp));
+        }
+        const absl::Cord& value = *lock.data();
+        TENSORSTORE_ASSIGN_OR_RETURN(auto byte_range,
+                                     options.byte_range.Validate(value.size()));
+        return kvstore::ReadResult::Value(internal::GetSubCord(value,
+                                                               byte_range),
+                                          std::move(stamp));
+      },
+      std::move(read_future));
+}
+
+}  // namespace
+
+kvstore::DriverPtr MakeCachedKvStoreDriver(kvstore::DriverPtr base,
+                                           const CachePool::WeakPtr& pool,
+                                           std::string cache_identifier) {
+  auto cache = GetCache<KvStoreValueCache>(pool.get(), cache_identifier, [&] {
+    return std::make_unique<KvStoreValueCache>(std::move(base));
+  });
+  return kvstore::DriverPtr(new CachedKvStoreDriver(std::move(cache)));
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,60 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CACHE_CACHED_KVSTORE_H_
+#define TENSORSTORE_INTERNAL_CACHE_CACHED_KVSTORE_H_
+
+/// \file
+/// Read-through caching adapter for `kvstore::Driver`.
+
+#include <string>
+
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/kvstore/driver.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Adapts a base kvstore to cache the encoded value associated with each key
+/// in a `CachePool`.
+///
+/// This provides a second cache tier below any cache of decoded data: the
+/// encoded representation of a compressed chunk is typically several times
+/// smaller than its decoded representation, so when access is sparse, a
+/// larger working set can be retained per byte of cache budget by layering a
+/// decoded cache with a small (or disabled) pool on top of an encoded cache.
+///
+/// Reads are satisfied from the cache subject to
+/// `kvstore::ReadOptions::staleness_bound`; cached values older than the
+/// staleness bound are revalidated against the base kvstore using the cached
+/// generation.  Byte range requests and generation conditions are applied to
+/// the cached value.  Writes, deletes, and transactional operations are
+/// forwarded directly to the base kvstore and do not update the cache; a
+/// subsequent read with a newer staleness bound observes the new value via
+/// revalidation.
+///
+/// \param base Base kvstore.
+/// \param pool Cache pool in which to cache encoded values.
+/// \param cache_identifier Identifies the cache within `pool`.  Adapters
+///     created with the same pool and non-empty identifier share a single
+///     cache, and must therefore have equivalent base kvstores.  An empty
+///     identifier results in a separate cache.
+kvstore::DriverPtr MakeCachedKvStoreDriver(kvstore::DriverPtr base,
+                                           const CachePool::WeakPtr& pool,
+                                           std::string cache_identifier = {});
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CACHE_CACHED_KVSTORE_H_
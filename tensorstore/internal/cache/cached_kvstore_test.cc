@@ -0,0 +1,120 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/cached_kvstore.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/cache/cache.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/memory/memory_key_value_store.h"
+#include "tensorstore/kvstore/mock_kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::OptionalByteRangeRequest;
+using ::tensorstore::internal::CachePool;
+using ::tensorstore::internal::MakeCachedKvStoreDriver;
+using ::tensorstore::internal::MockKeyValueStore;
+
+namespace kvstore = ::tensorstore::kvstore;
+
+TEST(CachedKvStoreTest, Read) {
+  auto mock_store = MockKeyValueStore::Make();
+  mock_store->forward_to = tensorstore::GetMemoryKeyValueStore();
+  mock_store->log_requests = true;
+  auto pool = CachePool::Make(CachePool::Limits{10000000});
+  auto store =
+      MakeCachedKvStoreDriver(mock_store, CachePool::WeakPtr(pool), "");
+
+  // Writes are forwarded directly to the base kvstore.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto write_stamp,
+      kvstore::Write({store}, "a", absl::Cord("value")).result());
+  EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(1));
+
+  // The initial read is satisfied by reading from the base kvstore.
+  kvstore::ReadOptions read_options;
+  read_options.staleness_bound = absl::InfinitePast();
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result, kvstore::Read({store}, "a", read_options).result());
+    EXPECT_EQ(absl::Cord("value"), read_result.value);
+    EXPECT_EQ(write_stamp.generation, read_result.stamp.generation);
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(1));
+  }
+
+  // A repeat read within the staleness bound is satisfied from the cache.
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result, kvstore::Read({store}, "a", read_options).result());
+    EXPECT_EQ(absl::Cord("value"), read_result.value);
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(0));
+  }
+
+  // Byte range requests are applied to the cached value.
+  {
+    auto byte_range_options = read_options;
+    byte_range_options.byte_range = OptionalByteRangeRequest(1, 3);
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result,
+        kvstore::Read({store}, "a", byte_range_options).result());
+    EXPECT_EQ(absl::Cord("al"), read_result.value);
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(0));
+  }
+
+  // Generation conditions are applied to the cached value.
+  {
+    auto conditional_options = read_options;
+    conditional_options.generation_conditions.if_not_equal =
+        write_stamp.generation;
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result,
+        kvstore::Read({store}, "a", conditional_options).result());
+    EXPECT_TRUE(read_result.aborted());
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(0));
+  }
+
+  // Reads of a missing key are also cached.
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result, kvstore::Read({store}, "b", read_options).result());
+    EXPECT_TRUE(read_result.not_found());
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(1));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        read_result, kvstore::Read({store}, "b", read_options).result());
+    EXPECT_TRUE(read_result.not_found());
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(0));
+  }
+
+  // A read with a newer staleness bound revalidates against the base kvstore
+  // and observes a value written directly to the base kvstore.
+  TENSORSTORE_ASSERT_OK(
+      kvstore::Write({mock_store->forward_to}, "a", absl::Cord("new_value"))
+          .result());
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto read_result, kvstore::Read({store}, "a").result());
+    EXPECT_EQ(absl::Cord("new_value"), read_result.value);
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(1));
+  }
+}
+
+}  // namespace
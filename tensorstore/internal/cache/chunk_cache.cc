@@ -52,7 +52,9 @@
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/rank.h"
 #include "tensorstore/read_write_options.h"
+#include "tensorstore/strided_layout.h"
 #include "tensorstore/transaction.h"
+#include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
@@ -166,7 +168,37 @@ struct ReadChunkImpl {
           tensorstore::StrCat(entry->DescribeChunk(), " is missing"));
     }
     return grid.components[component_index].array_spec.GetReadNDIterable(
-        std::move(read_array), domain, std::move(chunk_transform), arena);
+        std::move(read_array), domain, std::move(chunk_transform),
+        &entry->read_transform_cache, arena);
+  }
+
+  bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) const {
+    auto& grid = GetOwningCache(*entry).grid();
+    const auto& array_spec = grid.components[component_index].array_spec;
+    auto domain = grid.GetCellDomain(component_index, entry->cell_indices());
+    SharedArray<const void, dynamic_rank(kMaxRank)> read_array{
+        ChunkCache::GetReadComponent(
+            AsyncCache::ReadLock<ChunkCache::ReadData>(*entry).data(),
+            component_index)};
+    if (!read_array.valid()) {
+      if (!fill_missing_data_reads) return false;
+      // A missing chunk is implicitly equal to the fill value, which is
+      // likewise immutable and may be referenced indefinitely.
+      read_array = array_spec.GetFillValueForDomain(domain);
+    }
+    StridedLayoutView<dynamic_rank, offset_origin> data_layout(
+        domain, read_array.byte_strides());
+    auto composed_transform = ComposeLayoutAndTransform(
+        data_layout, IndexTransform<>(chunk_transform));
+    // In the case of an error, fall back to the `BeginRead` code path, which
+    // will return the same error.
+    if (!composed_transform.ok()) return false;
+    read_result = TransformedSharedArray<const void>(
+        AddByteOffset(std::move(read_array.element_pointer()),
+                      -data_layout.origin_byte_offset()),
+        std::move(composed_transform).value());
+    return true;
   }
 };
 
@@ -244,6 +276,14 @@ struct ReadChunkTransactionImpl {
                                        std::move(read_array), read_generation,
                                        std::move(chunk_transform), arena);
   }
+
+  bool operator()(ReadChunk::ReadArray, IndexTransformView<> chunk_transform,
+                  TransformedSharedArray<const void>& read_result) const {
+    // Uncommitted writes made previously in the same transaction may need to
+    // be merged with the cached chunk data, which requires the `BeginRead`
+    // code path.
+    return false;
+  }
 };
 
 /// TensorStore Driver WriteChunk implementation for the chunk cache.
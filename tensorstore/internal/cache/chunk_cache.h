@@ -106,6 +106,12 @@ class ChunkCache : public AsyncCache {
     size_t ComputeReadDataSizeInBytes(const void* read_data) override;
 
     virtual std::string DescribeChunk();
+
+    /// Cache of the composed read transform most recently used to read a
+    /// component of this chunk.  Reads that repeat the same view over this
+    /// chunk (common in steady-state training workloads) skip recomputing the
+    /// composition.
+    AsyncWriteArray::ReadTransformCache read_transform_cache;
   };
 
   class TransactionNode : public AsyncCache::TransactionNode {
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <ostream>
@@ -23,6 +25,7 @@
 #include <benchmark/benchmark.h>
 #include "absl/base/optimization.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/array.h"
@@ -383,4 +386,192 @@ struct RegisterBenchmarks {
   }
 } register_benchmarks_;
 
+/// Total cycles threads have spent blocked on contended `absl::Mutex`
+/// acquisitions, accumulated process-wide via `absl::RegisterMutexProfiler`.
+std::atomic<int64_t> mutex_wait_cycles{0};
+
+void MutexProfiler(int64_t wait_cycles) {
+  mutex_wait_cycles.fetch_add(wait_cycles, std::memory_order_relaxed);
+}
+
+/// Benchmark configuration for the multi-threaded contention benchmark.
+struct ContentionBenchmarkConfig {
+  /// Source and target data type.
+  tensorstore::DataType dtype;
+
+  /// Shape of the contiguous region read or written by each operation.
+  std::vector<Index> copy_shape;
+
+  /// Specifies the cell shape to use for the chunk cache.  Must have length
+  /// equal to `copy_shape.size()`.
+  std::vector<Index> cell_shape;
+
+  /// Byte limit of the shared cache pool.  Chosen smaller than the combined
+  /// working set so that eviction is active during the benchmark.
+  size_t total_bytes_limit;
+
+  /// Percentage of operations that are reads; the remainder are writes.
+  int read_percent;
+
+  /// Number of distinct regions each thread cycles through.
+  Index regions_per_thread;
+};
+
+[[maybe_unused]] std::ostream& operator<<(
+    std::ostream& os, const ContentionBenchmarkConfig& config) {
+  return os << "Contention: copy_shape=" << span(config.copy_shape)
+            << ", cell_shape=" << span(config.cell_shape)
+            << ", total_bytes_limit=" << config.total_bytes_limit
+            << ", read_percent=" << config.read_percent
+            << ", regions_per_thread=" << config.regions_per_thread;
+}
+
+/// Shared state for a mixed read/write workload run from multiple benchmark
+/// threads against a single `CachePool` with a finite byte limit, in order to
+/// measure scaling of the shared cache data structures with eviction active.
+class ContentionBenchmarkRunner {
+ public:
+  explicit ContentionBenchmarkRunner(const ContentionBenchmarkConfig& config)
+      : config_(config) {
+    pool_ = CachePool::Make(CachePool::Limits{config.total_bytes_limit});
+    const DimensionIndex rank = config.copy_shape.size();
+    assert(rank == static_cast<DimensionIndex>(config.cell_shape.size()));
+    std::vector<DimensionIndex> chunked_dims;
+    for (DimensionIndex i = 0; i < rank; ++i) chunked_dims.push_back(i);
+    ChunkGridSpecification grid({ChunkGridSpecification::Component{
+        tensorstore::internal::AsyncWriteArray::Spec{
+            BroadcastArray(AllocateArray(/*shape=*/span<const Index>{},
+                                         tensorstore::c_order,
+                                         tensorstore::value_init, config.dtype),
+                           tensorstore::BoxView<>(rank))
+                .value(),
+            Box<>(rank)},
+        /*chunk_shape=*/config.cell_shape, chunked_dims}});
+    // Operations are performed with an inline executor so that all work is
+    // done on the benchmark threads themselves.
+    cache_ = GetCache<BenchmarkCache>(pool_.get(), "", [&] {
+      return std::make_unique<BenchmarkCache>(grid,
+                                              tensorstore::InlineExecutor{});
+    });
+    driver_.reset(new TestDriver(TestDriver::Initializer{cache_, 0}));
+  }
+
+  /// Returns the transform for region `region` of thread `thread_index`.
+  ///
+  /// Each thread operates on its own disjoint set of chunks; contention is
+  /// limited to the shared cache pool data structures.
+  IndexTransform<> MakeTransform(int thread_index, Index region) const {
+    const DimensionIndex rank = config_.copy_shape.size();
+    std::vector<Index> origin(rank, 0);
+    origin[0] = (thread_index * config_.regions_per_thread + region) *
+                config_.copy_shape[0];
+    return ChainResult(tensorstore::IdentityTransform(rank),
+                       tensorstore::AllDims().SizedInterval(
+                           origin, config_.copy_shape))
+        .value();
+  }
+
+  void RunOnce(const IndexTransform<>& transform,
+               const SharedArray<void>& array, bool read) {
+    if (read) {
+      DriverRead(cache_->executor(), {driver_, transform}, array,
+                 DriverReadOptions{})
+          .result();
+    } else {
+      DriverWrite(cache_->executor(), array,
+                  /*target=*/{driver_, transform}, DriverWriteOptions{})
+          .commit_future.result();
+    }
+  }
+
+ private:
+  ContentionBenchmarkConfig config_;
+  tensorstore::internal::CachePool::StrongPtr pool_;
+  tensorstore::internal::CachePtr<BenchmarkCache> cache_;
+  tensorstore::internal::DriverPtr driver_;
+};
+
+/// Creates the shared runner when the first thread of a run arrives and
+/// destroys it when the last thread leaves.
+struct ContentionRunnerHolder {
+  absl::Mutex mutex;
+  int active_threads = 0;
+  std::unique_ptr<ContentionBenchmarkRunner> runner;
+};
+
+void BenchmarkContention(const ContentionBenchmarkConfig& config,
+                         const std::shared_ptr<ContentionRunnerHolder>& holder,
+                         ::benchmark::State& state) {
+  ContentionBenchmarkRunner* runner;
+  {
+    absl::MutexLock lock(&holder->mutex);
+    if (++holder->active_threads == 1) {
+      holder->runner = std::make_unique<ContentionBenchmarkRunner>(config);
+    }
+    runner = holder->runner.get();
+  }
+
+  std::vector<IndexTransform<>> transforms;
+  for (Index region = 0; region < config.regions_per_thread; ++region) {
+    transforms.push_back(runner->MakeTransform(state.thread_index(), region));
+  }
+  auto array = AllocateArray(config.copy_shape, tensorstore::c_order,
+                             tensorstore::value_init, config.dtype);
+  const Index num_bytes = array.num_elements() * config.dtype->size;
+
+  // Mutex wait cycles are accumulated process-wide; the delta over the
+  // measurement loop is only approximate, since threads do not start and stop
+  // at exactly the same time.
+  const int64_t start_wait_cycles =
+      mutex_wait_cycles.load(std::memory_order_relaxed);
+  int64_t i = 0;
+  Index total_bytes = 0;
+  while (state.KeepRunningBatch(num_bytes)) {
+    const bool read = (i % 100) < config.read_percent;
+    runner->RunOnce(transforms[i % config.regions_per_thread], array, read);
+    ++i;
+    total_bytes += num_bytes;
+  }
+  state.SetBytesProcessed(total_bytes);
+  if (state.thread_index() == 0) {
+    state.counters["mutex_wait_cycles"] = static_cast<double>(
+        mutex_wait_cycles.load(std::memory_order_relaxed) - start_wait_cycles);
+  }
+
+  {
+    absl::MutexLock lock(&holder->mutex);
+    if (--holder->active_threads == 0) holder->runner.reset();
+  }
+}
+
+struct RegisterContentionBenchmarks {
+  static void Register(const ContentionBenchmarkConfig& config) {
+    auto holder = std::make_shared<ContentionRunnerHolder>();
+    ::benchmark::RegisterBenchmark(
+        tensorstore::StrCat(config).c_str(),
+        [config, holder](auto& state) {
+          BenchmarkContention(config, holder, state);
+        })
+        ->ThreadRange(1, 16)
+        ->UseRealTime();
+  }
+
+  RegisterContentionBenchmarks() {
+    absl::RegisterMutexProfiler(MutexProfiler);
+    for (const int read_percent : {100, 90, 50, 0}) {
+      for (const size_t total_bytes_limit :
+           {size_t{4} << 20, size_t{32} << 20}) {
+        Register({
+            /*dtype=*/tensorstore::dtype_v<int>,
+            /*copy_shape=*/{32, 32, 32},
+            /*cell_shape=*/{32, 32, 32},
+            /*total_bytes_limit=*/total_bytes_limit,
+            /*read_percent=*/read_percent,
+            /*regions_per_thread=*/32,
+        });
+      }
+    }
+  }
+} register_contention_benchmarks_;
+
 }  // namespace
@@ -644,6 +644,117 @@ TEST_F(ChunkCacheTest, ReadSingleComponentOneDimensionalExisting) {
   }
 }
 
+// Tests that the absence of a chunk is cached: a repeat read of a missing
+// chunk within the staleness bound is served from memory without issuing
+// another kvstore read.
+TEST_F(ChunkCacheTest, ReadMissingChunkNegativeCaching) {
+  grid = GetSimple1DGrid();
+  auto cache = MakeChunkCache();
+
+  // Read chunk 1, which is missing from the data store.
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfinitePast()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 2));
+    {
+      auto r = mock_store->read_requests.pop();
+      EXPECT_THAT(ParseKey(r.key), ElementsAre(1));
+      r(memory_store);
+    }
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({2, 3})));
+  }
+
+  // Initialize chunk 1 in the data store.  The cache still reflects its
+  // absence.
+  SetChunk({1}, {MakeArray<int>({42, 43})});
+
+  // The repeat read is satisfied from the cached negative read state without
+  // issuing any new read requests.
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfinitePast()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 2));
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({2, 3})));
+  }
+
+  // A read with a staleness bound of `absl::InfiniteFuture()` revalidates and
+  // observes the newly-written chunk.
+  {
+    auto read_future =
+        tensorstore::Read(GetTensorStore(cache, absl::InfiniteFuture()) |
+                          tensorstore::Dims(0).TranslateSizedInterval(2, 2));
+    {
+      auto r = mock_store->read_requests.pop();
+      EXPECT_THAT(ParseKey(r.key), ElementsAre(1));
+      r(memory_store);
+    }
+    EXPECT_THAT(read_future.result(),
+                ::testing::Optional(tensorstore::MakeArray({42, 43})));
+  }
+}
+
+// Tests that `ReadChunk::ReadArray` provides a zero-copy view that shares
+// ownership of the cached chunk data.
+TEST_F(ChunkCacheTest, ReadArrayZeroCopyView) {
+  grid = GetSimple1DGrid();
+  // Initialize chunk 1 in the data store.
+  SetChunk({1}, {MakeArray<int>({42, 43})});
+  auto cache = MakeChunkCache();
+
+  // Read cells 1 and 2: cell 1 is present in the data store, while cell 2 is
+  // missing and implicitly equal to the fill value.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, GetTensorStore(cache, absl::InfinitePast()) |
+                      tensorstore::Dims(0).TranslateSizedInterval(3, 3));
+  auto chunks_future = tensorstore::internal::CollectReadChunks(store);
+  {
+    auto r = mock_store->read_requests.pop();
+    EXPECT_THAT(ParseKey(r.key), ElementsAre(1));
+    r(memory_store);
+  }
+  {
+    auto r = mock_store->read_requests.pop();
+    EXPECT_THAT(ParseKey(r.key), ElementsAre(2));
+    r(memory_store);
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto chunks, chunks_future.result());
+  ASSERT_EQ(2u, chunks.size());
+
+  // The view of cell 1 aliases the cached chunk data.
+  {
+    auto& chunk = chunks[0].first;
+    tensorstore::TransformedSharedArray<const void> read_result;
+    ASSERT_TRUE(chunk.impl(tensorstore::internal::ReadChunk::ReadArray{},
+                           chunk.transform, read_result));
+    EXPECT_THAT(MakeCopy(read_result),
+                ::testing::Optional(tensorstore::MakeOffsetArray({3}, {43})));
+    auto entry = GetEntryForGridCell(*cache, span<const Index>({1}));
+    auto cached_array = ChunkCache::GetReadComponent(
+        AsyncCache::ReadLock<ChunkCache::ReadData>(*entry).data(), 0);
+    ASSERT_TRUE(cached_array.valid());
+    // The element pointer is adjusted by the origin of the cell domain.
+    EXPECT_EQ(static_cast<const void*>(
+                  static_cast<const char*>(cached_array.data()) -
+                  2 * sizeof(int)),
+              read_result.element_pointer().data());
+  }
+
+  // The view of the missing cell 2 aliases the fill value.
+  {
+    auto& chunk = chunks[1].first;
+    tensorstore::TransformedSharedArray<const void> read_result;
+    ASSERT_TRUE(chunk.impl(tensorstore::internal::ReadChunk::ReadArray{},
+                           chunk.transform, read_result));
+    EXPECT_THAT(
+        MakeCopy(read_result),
+        ::testing::Optional(tensorstore::MakeOffsetArray({4}, {4, 5})));
+    EXPECT_EQ(grid->components[0].array_spec.overall_fill_value.data(),
+              read_result.element_pointer().data());
+  }
+}
+
 // Test reading the fill value from a two-dimensional chunk cache.
 TEST_F(ChunkCacheTest, TwoDimensional) {
   grid = ChunkGridSpecification({ChunkGridSpecification::Component{
@@ -1455,6 +1566,41 @@ TEST_F(ChunkCacheTest, FullyOverwritePartialChunk) {
   }
 }
 
+// Tests that a chunk fully overwritten by multiple partial writes in the same
+// transaction is written back unconditionally, without reading the existing
+// chunk data.
+TEST_F(ChunkCacheTest, FullyOverwriteViaMultiplePartialWrites) {
+  // Dimension 0 is chunked with a size of 2.
+  grid = GetSimple1DGrid();
+  auto cache = MakeChunkCache();
+
+  Transaction transaction(tensorstore::isolated);
+
+  // Overwrite each half of chunk 0 separately.
+  for (Index i = 0; i < 2; ++i) {
+    auto write_future = tensorstore::Write(
+        MakeArray<int>({static_cast<int>(11 + i)}),
+        GetTensorStore(cache, /*data_staleness=*/{}, /*component_index=*/0,
+                       /*transaction=*/transaction) |
+            tensorstore::Dims(0).TranslateSizedInterval(i, 1));
+    TENSORSTORE_EXPECT_OK(write_future.result());
+  }
+
+  auto commit_future = transaction.CommitAsync();
+
+  // Writeback issues only an unconditional write request, with no read of the
+  // existing chunk data.
+  {
+    auto r = mock_store->write_requests.pop();
+    EXPECT_THAT(ParseKey(r.key), ElementsAre(0));
+    EXPECT_EQ(StorageGeneration::Unknown(),
+              r.options.generation_conditions.if_equal);
+    r(memory_store);
+  }
+  EXPECT_THAT(GetChunk({0}), ElementsAre(MakeArray<int>({11, 12})));
+  TENSORSTORE_EXPECT_OK(commit_future);
+}
+
 TEST_F(ChunkCacheTest, WritebackError) {
   // Dimension 0 is chunked with a size of 2.
   grid = GetSimple1DGrid();
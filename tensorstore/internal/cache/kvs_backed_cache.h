@@ -20,6 +20,7 @@
 /// Integrates `AsyncCache` with `kvstore::Driver`.
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <optional>
@@ -28,9 +29,11 @@
 #include <utility>
 
 #include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/cache/async_cache.h"
 #include "tensorstore/kvstore/driver.h"
@@ -77,6 +80,12 @@ void KvsBackedCache_IncrementReadErrorMetric();
 /// `kvstore::Driver`, and handling the timestamps and `StorageGeneration`
 /// values.
 ///
+/// A key that is not present in the kvstore is represented by a null
+/// `ReadData` pointer with a generation of `StorageGeneration::NoValue`.
+/// This negative result is cached and served subject to the same staleness
+/// bound as any other read state; repeat reads of missing keys within the
+/// staleness bound do not re-query the kvstore.
+///
 /// \tparam Parent Parent class, must inherit from (or equal) `AsyncCache`.
 template <typename Derived, typename Parent>
 class KvsBackedCache : public Parent {
@@ -366,6 +375,15 @@ class KvsBackedCache : public Parent {
               << ", mode=" << writeback_mode_ << ", encoding: " << update.stamp
               << ", commit_started=" << self_->transaction()->commit_started();
           self_->new_data_ = update.data;
+          if (auto encoded_value =
+                  self_->GetSpeculativeEncodedValue(update.stamp.generation)) {
+            ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
+                << *self_ << "DoApply: using speculatively-encoded value";
+            EncodeReceiverImpl encode_receiver{self_, std::move(update.stamp),
+                                               std::move(receiver_)};
+            encode_receiver.set_value(*std::move(encoded_value));
+            return;
+          }
           ABSL_LOG_IF(INFO, TENSORSTORE_ASYNC_CACHE_DEBUG)
               << *self_ << "DoEncode";
           auto update_data =
@@ -413,6 +431,88 @@ class KvsBackedCache : public Parent {
 
     void KvsRevoke() override { this->Revoke(); }
 
+    /// Speculatively encodes the current writeback value in the background,
+    /// so that a subsequent commit can issue the already-prepared bytes
+    /// rather than running the potentially-expensive encode step (e.g.
+    /// compression) in the commit critical path.
+    ///
+    /// This only has an effect if the node is unconditional (e.g. corresponds
+    /// to a fully-overwritten chunk); otherwise, the writeback value depends
+    /// on existing data that has not yet been read, and computing it would
+    /// require a read round trip.
+    ///
+    /// Derived caches that call this method once a node becomes quiescent
+    /// must call `InvalidateSpeculativeEncode` whenever the node is
+    /// subsequently modified.  Must not be called with the node's writer lock
+    /// held, since `DoApply` may be invoked synchronously.
+    void StartSpeculativeEncode() {
+      if (!this->IsUnconditional()) return;
+      uint64_t generation;
+      {
+        absl::MutexLock lock(&speculative_encode_mutex_);
+        if (speculative_encode_in_progress_) return;
+        speculative_encode_in_progress_ = true;
+        generation = speculative_encode_generation_;
+      }
+      struct SpeculativeEncodeReceiverImpl {
+        WeakTransactionNodePtr<TransactionNode> self_;
+        uint64_t generation_;
+        void set_error(absl::Status error) { Done(std::nullopt); }
+        void set_cancel() { ABSL_UNREACHABLE(); }  // COV_NF_LINE
+        void set_value(std::optional<absl::Cord> value) {
+          Done(std::optional<std::optional<absl::Cord>>(std::move(value)));
+        }
+        void Done(std::optional<std::optional<absl::Cord>> value) {
+          absl::MutexLock lock(&self_->speculative_encode_mutex_);
+          self_->speculative_encode_in_progress_ = false;
+          if (value &&
+              generation_ == self_->speculative_encode_generation_) {
+            self_->speculative_encoded_value_ = *std::move(value);
+          }
+        }
+      };
+      struct SpeculativeApplyReceiverImpl {
+        WeakTransactionNodePtr<TransactionNode> self_;
+        uint64_t generation_;
+        void set_error(absl::Status error) { Abort(); }
+        void set_cancel() { ABSL_UNREACHABLE(); }  // COV_NF_LINE
+        void set_value(AsyncCache::ReadState update) {
+          if (StorageGeneration::IsConditional(update.stamp.generation) ||
+              !StorageGeneration::IsInnerLayerDirty(update.stamp.generation)) {
+            // Either there is nothing to write back, or the writeback value
+            // depends on existing data that has not yet been read.
+            Abort();
+            return;
+          }
+          auto* self = self_.get();
+          auto update_data =
+              std::static_pointer_cast<const typename Derived::ReadData>(
+                  std::move(update.data));
+          GetOwningEntry(*self).DoEncode(
+              std::move(update_data),
+              SpeculativeEncodeReceiverImpl{std::move(self_), generation_});
+        }
+        void Abort() {
+          absl::MutexLock lock(&self_->speculative_encode_mutex_);
+          self_->speculative_encode_in_progress_ = false;
+        }
+      };
+      AsyncCache::TransactionNode::ApplyOptions apply_options;
+      apply_options.staleness_bound = absl::InfinitePast();
+      this->DoApply(std::move(apply_options),
+                    SpeculativeApplyReceiverImpl{
+                        WeakTransactionNodePtr<TransactionNode>(this),
+                        generation});
+    }
+
+    /// Discards any speculatively-encoded value.  Must be called whenever
+    /// the node is modified after a call to `StartSpeculativeEncode`.
+    void InvalidateSpeculativeEncode() {
+      absl::MutexLock lock(&speculative_encode_mutex_);
+      ++speculative_encode_generation_;
+      speculative_encoded_value_ = std::nullopt;
+    }
+
     // Must be called with `mutex()` held.
     virtual absl::Status RequireRepeatableRead(
         const StorageGeneration& generation) {
@@ -436,6 +536,17 @@ class KvsBackedCache : public Parent {
    private:
     friend class KvsBackedCache;
 
+    // Returns the speculatively-encoded value for the current writeback
+    // state, if one is available (see `StartSpeculativeEncode`).  The inner
+    // `std::optional` is `std::nullopt` if the encoded value indicates
+    // deletion.
+    std::optional<std::optional<absl::Cord>> GetSpeculativeEncodedValue(
+        const StorageGeneration& generation) {
+      if (StorageGeneration::IsConditional(generation)) return std::nullopt;
+      absl::MutexLock lock(&speculative_encode_mutex_);
+      return speculative_encoded_value_;
+    }
+
     // Target to which this `ReadModifyWriteSource` is bound.
     ReadModifyWriteTarget* target_;
 
@@ -445,6 +556,21 @@ class KvsBackedCache : public Parent {
     // If not `StorageGeneration::Unknown()`, requires that the prior generation
     // match this generation when the transaction is committed.
     StorageGeneration require_repeatable_read_;
+
+    // Speculative encoding state (see `StartSpeculativeEncode`).
+    absl::Mutex speculative_encode_mutex_;
+
+    // Incremented by `InvalidateSpeculativeEncode` in order to invalidate the
+    // result of any in-progress speculative encode.
+    uint64_t speculative_encode_generation_
+        ABSL_GUARDED_BY(speculative_encode_mutex_) = 0;
+
+    bool speculative_encode_in_progress_
+        ABSL_GUARDED_BY(speculative_encode_mutex_) = false;
+
+    // Speculatively-encoded value, if available.
+    std::optional<std::optional<absl::Cord>> speculative_encoded_value_
+        ABSL_GUARDED_BY(speculative_encode_mutex_);
   };
 
   /// Returns the associated `kvstore::Driver`.
@@ -21,10 +21,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
+#include "absl/base/call_once.h"
 #include "absl/container/fixed_array.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "tensorstore/array.h"
 #include "tensorstore/index.h"
@@ -33,6 +36,8 @@
 #include "tensorstore/internal/cache/chunk_cache.h"
 #include "tensorstore/internal/cache/kvs_backed_cache.h"
 #include "tensorstore/internal/memory.h"
+#include "tensorstore/internal/ref_counted_string.h"
+#include "tensorstore/transaction_impl.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -43,8 +48,12 @@ namespace tensorstore {
 namespace internal {
 
 std::string KvsBackedChunkCache::Entry::GetKeyValueStoreKey() {
-  auto& cache = GetOwningCache(*this);
-  return cache.GetChunkStorageKey(this->cell_indices());
+  absl::call_once(storage_key_once_, [&] {
+    auto& cache = GetOwningCache(*this);
+    storage_key_ = RefCountedString(
+        std::string_view(cache.GetChunkStorageKey(this->cell_indices())));
+  });
+  return std::string(std::string_view(storage_key_));
 }
 
 void KvsBackedChunkCache::Entry::DoDecode(std::optional<absl::Cord> value,
@@ -107,12 +116,25 @@ void KvsBackedChunkCache::Entry::DoEncode(std::shared_ptr<const ReadData> data,
   execution::set_value(receiver, *std::move(encoded_result));
 }
 
+absl::Status KvsBackedChunkCache::TransactionNode::OnModified() {
+  InvalidateSpeculativeEncode();
+  if (this->IsUnconditional()) {
+    // `OnModified` is called with the node's writer lock held.  Defer the
+    // speculative encode to the executor to avoid invoking `DoApply` with the
+    // lock held.
+    GetOwningCache(*this).executor()(
+        [node = WeakTransactionNodePtr<TransactionNode>(this)] {
+          node->StartSpeculativeEncode();
+        });
+  }
+  return Base::TransactionNode::OnModified();
+}
+
 std::string KvsBackedChunkCache::Entry::DescribeChunk() {
   auto& cache = GetOwningCache(*this);
-  auto cell_indices = this->cell_indices();
-  return tensorstore::StrCat("chunk ", cell_indices, " stored at ",
-                             cache.kvstore_driver()->DescribeKey(
-                                 cache.GetChunkStorageKey(cell_indices)));
+  return tensorstore::StrCat(
+      "chunk ", this->cell_indices(), " stored at ",
+      cache.kvstore_driver()->DescribeKey(GetKeyValueStoreKey()));
 }
 
 }  // namespace internal
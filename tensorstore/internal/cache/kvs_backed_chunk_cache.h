@@ -19,12 +19,15 @@
 #include <optional>
 #include <string>
 
+#include "absl/base/call_once.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "tensorstore/array.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/cache/chunk_cache.h"
 #include "tensorstore/internal/cache/kvs_backed_cache.h"
+#include "tensorstore/internal/ref_counted_string.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 
@@ -76,6 +79,26 @@ class KvsBackedChunkCache
                   EncodeReceiver receiver) override;
     std::string GetKeyValueStoreKey() override;
     std::string DescribeChunk() override;
+
+   private:
+    // Storage key formatted from the cell indices, computed on first use.
+    // Entries outlive individual operations, so repeated reads and writebacks
+    // of the same chunk reuse this storage rather than re-formatting the key
+    // per operation.
+    absl::once_flag storage_key_once_;
+    RefCountedString storage_key_;
+  };
+
+  class TransactionNode : public Base::TransactionNode {
+   public:
+    using OwningCache = KvsBackedChunkCache;
+    using Base::TransactionNode::TransactionNode;
+
+    /// Speculatively encodes fully-overwritten chunks in the background once
+    /// each write operation completes, so that commit can issue the prepared
+    /// bytes rather than encoding in the commit critical path (see
+    /// `KvsBackedCache::TransactionNode::StartSpeculativeEncode`).
+    absl::Status OnModified() override;
   };
 
   Entry* DoAllocateEntry() override { return new Entry; }
@@ -0,0 +1,42 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/cache/writeback_pressure.h"
+
+#include <stdint.h>
+
+#include <atomic>
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+std::atomic<int64_t> writeback_queue_depth{0};
+
+}  // namespace
+
+void IncrementWritebackQueueDepth() {
+  writeback_queue_depth.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DecrementWritebackQueueDepth() {
+  writeback_queue_depth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int64_t GetWritebackQueueDepth() {
+  return writeback_queue_depth.load(std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,45 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_CACHE_WRITEBACK_PRESSURE_H_
+#define TENSORSTORE_INTERNAL_CACHE_WRITEBACK_PRESSURE_H_
+
+/// \file Process-wide gauge of in-flight cache writebacks.
+///
+/// `AsyncCache` increments the gauge when a transaction node's writeback is
+/// issued to storage and decrements it when the writeback resolves.  The
+/// depth serves as a backpressure signal for producers that trade CPU for
+/// bytes written, such as the adaptive zstd compression mode: a deep queue
+/// means storage is the bottleneck, while an empty queue means the producer
+/// is.
+
+#include <stdint.h>
+
+namespace tensorstore {
+namespace internal {
+
+/// Records that a writeback has been issued to storage.
+void IncrementWritebackQueueDepth();
+
+/// Records that a previously issued writeback has completed (successfully or
+/// not).
+void DecrementWritebackQueueDepth();
+
+/// Returns the number of currently in-flight writebacks.
+int64_t GetWritebackQueueDepth();
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_CACHE_WRITEBACK_PRESSURE_H_
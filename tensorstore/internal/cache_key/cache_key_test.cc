@@ -20,7 +20,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/time/time.h"
+#include <nlohmann/json.hpp>
 #include "tensorstore/internal/cache_key/absl_time.h"
+#include "tensorstore/internal/cache_key/json.h"
 #include "tensorstore/internal/cache_key/std_optional.h"
 #include "tensorstore/internal/cache_key/std_variant.h"
 
@@ -75,4 +77,42 @@ TEST(CacheKeyTest, Variant) {
   }
 }
 
+TEST(CacheKeyTest, Json) {
+  ::nlohmann::json v{{"a", 1}, {"b", {{"c", "x"}, {"d", false}}}};
+
+  // The streamed encoding matches encoding the materialized `dump()`.
+  std::string key;
+  tensorstore::internal::EncodeCacheKey(&key, v);
+  std::string expected;
+  tensorstore::internal::EncodeCacheKey(&expected, v.dump());
+  EXPECT_EQ(expected, key);
+
+  {
+    std::string key2;
+    tensorstore::internal::EncodeCacheKey(
+        &key2, ::nlohmann::json{{"a", 1}, {"b", {{"c", "x"}, {"d", true}}}});
+    EXPECT_NE(key, key2);
+  }
+}
+
+TEST(CacheKeyTest, JsonObject) {
+  ::nlohmann::json::object_t v{{"a", 1}, {"b", "x"}};
+
+  std::string key;
+  tensorstore::internal::EncodeCacheKey(&key, v);
+
+  {
+    std::string key2;
+    tensorstore::internal::EncodeCacheKey(
+        &key2, ::nlohmann::json::object_t{{"a", 1}, {"b", "y"}});
+    EXPECT_NE(key, key2);
+  }
+  {
+    std::string key3;
+    tensorstore::internal::EncodeCacheKey(
+        &key3, ::nlohmann::json::object_t{{"a", 1}});
+    EXPECT_NE(key, key3);
+  }
+}
+
 }  // namespace
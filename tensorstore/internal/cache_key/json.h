@@ -15,25 +15,63 @@
 #ifndef TENSORSTORE_INTERNAL_CACHE_KEY_JSON_H_
 #define TENSORSTORE_INTERNAL_CACHE_KEY_JSON_H_
 
+#include <stddef.h>
+
+#include <cstring>
 #include <string>
 
 #include <nlohmann/json.hpp>
 #include "tensorstore/internal/cache_key/cache_key.h"
+#include "tensorstore/internal/unowned_to_shared.h"
 
 namespace tensorstore {
 namespace internal {
 
+namespace internal_cache_key {
+
+/// Output adapter that appends directly to the cache key being computed.
+struct JsonCacheKeyOutputAdapter
+    : public ::nlohmann::detail::output_adapter_protocol<char> {
+  explicit JsonCacheKeyOutputAdapter(std::string& out) : out_(out) {}
+  void write_character(char c) final { out_ += c; }
+  void write_characters(const char* s, size_t length) final {
+    out_.append(s, length);
+  }
+  std::string& out_;
+};
+
+}  // namespace internal_cache_key
+
 template <>
 struct CacheKeyEncoder<::nlohmann::json> {
   static void Encode(std::string* out, const ::nlohmann::json& v) {
-    internal::EncodeCacheKey(out, v.dump());
+    // Produces the same encoding as `EncodeCacheKey(out, v.dump())`, but
+    // streams the JSON representation directly into `out` (filling in the
+    // length prefix afterwards) rather than materializing it in a separate
+    // buffer and then copying it.
+    const size_t size_offset = out->size();
+    size_t size = 0;
+    out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+    {
+      internal_cache_key::JsonCacheKeyOutputAdapter output_adapter(*out);
+      ::nlohmann::detail::serializer<::nlohmann::json> s(
+          internal::UnownedToShared(&output_adapter), ' ');
+      s.dump(v, /*pretty_print=*/false, /*ensure_ascii=*/false, 0);
+    }
+    size = out->size() - size_offset - sizeof(size);
+    std::memcpy(out->data() + size_offset, &size, sizeof(size));
   }
 };
 
 template <>
 struct CacheKeyEncoder<::nlohmann::json::object_t> {
   static void Encode(std::string* out, const ::nlohmann::json::object_t& v) {
-    internal::EncodeCacheKey(out, ::nlohmann::json(v).dump());
+    // Encoded member-wise to avoid copying `v` into a temporary
+    // `::nlohmann::json` value.
+    internal::EncodeCacheKey(out, v.size());
+    for (const auto& [key, value] : v) {
+      internal::EncodeCacheKey(out, key, value);
+    }
   }
 };
 
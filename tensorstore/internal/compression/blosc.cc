@@ -16,8 +16,11 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -108,6 +111,66 @@ Result<size_t> GetDecodedSize(std::string_view input) {
   return nbytes;
 }
 
+absl::Status DecodeRange(std::string_view input, size_t offset, size_t length,
+                         char* output) {
+  TENSORSTORE_ASSIGN_OR_RETURN(const size_t nbytes, GetDecodedSize(input));
+  if (offset + length > nbytes) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Requested byte range [", offset, ", ", offset + length,
+        ") exceeds decoded size of ", nbytes));
+  }
+  if (length == 0) return absl::OkStatus();
+  if (offset == 0 && length == nbytes) {
+    const int n = blosc_decompress_ctx(input.data(), output, nbytes,
+                                       /*numinternalthreads=*/1);
+    if (n <= 0) {
+      return absl::InvalidArgumentError(tensorstore::StrCat("Blosc error: ", n));
+    }
+    return absl::OkStatus();
+  }
+  // `blosc_getitem` operates on items of `typesize` bytes.
+  size_t typesize;
+  int flags;
+  blosc_cbuffer_metainfo(input.data(), &typesize, &flags);
+  if (typesize == 0) {
+    return absl::InvalidArgumentError("Invalid blosc-compressed data");
+  }
+  const size_t start_item = offset / typesize;
+  const size_t end_item = (offset + length + typesize - 1) / typesize;
+  if (end_item * typesize > nbytes) {
+    // The range extends into a final partial item, which `blosc_getitem`
+    // cannot retrieve; decode everything and copy the requested range.
+    auto scratch = std::make_unique<char[]>(nbytes);
+    const int n = blosc_decompress_ctx(input.data(), scratch.get(), nbytes,
+                                       /*numinternalthreads=*/1);
+    if (n <= 0) {
+      return absl::InvalidArgumentError(tensorstore::StrCat("Blosc error: ", n));
+    }
+    std::memcpy(output, scratch.get() + offset, length);
+    return absl::OkStatus();
+  }
+  if (offset % typesize == 0 && length % typesize == 0) {
+    const int n =
+        blosc_getitem(input.data(), static_cast<int>(start_item),
+                      static_cast<int>(end_item - start_item), output);
+    if (n < 0 || static_cast<size_t>(n) != length) {
+      return absl::InvalidArgumentError(tensorstore::StrCat("Blosc error: ", n));
+    }
+    return absl::OkStatus();
+  }
+  // Unaligned range: retrieve the covering items and copy the requested slice.
+  const size_t item_bytes = (end_item - start_item) * typesize;
+  auto scratch = std::make_unique<char[]>(item_bytes);
+  const int n =
+      blosc_getitem(input.data(), static_cast<int>(start_item),
+                    static_cast<int>(end_item - start_item), scratch.get());
+  if (n < 0 || static_cast<size_t>(n) != item_bytes) {
+    return absl::InvalidArgumentError(tensorstore::StrCat("Blosc error: ", n));
+  }
+  std::memcpy(output, scratch.get() + (offset - start_item * typesize), length);
+  return absl::OkStatus();
+}
+
 BloscWriter::BloscWriter(const blosc::Options& options,
                          riegeli::Writer& base_writer)
     : CordWriter(riegeli::CordWriterBase::Options().set_max_block_size(
@@ -155,42 +218,61 @@ BloscReader::BloscReader(riegeli::Reader& base_reader)
 }
 
 bool BloscReader::ToleratesReadingAhead() { return true; }
+bool BloscReader::SupportsRandomAccess() { return true; }
 bool BloscReader::SupportsSize() { return true; }
 bool BloscReader::PullSlow(size_t min_length, size_t recommended_length) {
-  if (decoded_size_ == 0 || start() != nullptr || pos() > 0) {
+  if (start() != nullptr) {
     // Data was already decoded.  The precondition `min_length > available()`
     // for this method implies that `min_length` would exceed EOF.
     return false;
   }
+  const size_t prev_pos = static_cast<size_t>(pos());
+  if (prev_pos >= decoded_size_) return false;
   auto result = blosc::DecodeWithCallback(encoded_data_, [&](size_t n) {
     assert(n == decoded_size_);
     auto* buffer = new char[n];
     buffer_.reset(buffer);
     set_buffer(buffer, n);
-    move_limit_pos(n);
+    move_limit_pos(n - prev_pos);
+    set_cursor(buffer + prev_pos);
     return buffer;
   });
   if (!result.ok()) {
     Fail(std::move(result).status());
     return false;
   }
-  return min_length <= decoded_size_;
+  return min_length <= available();
 }
 
 bool BloscReader::ReadSlow(size_t length, char* dest) {
-  if (decoded_size_ == 0 || start() != nullptr || pos() > 0 ||
-      length < decoded_size_) {
-    // Use default implementation which may call `PullSlow`.
+  if (start() != nullptr || pos() >= decoded_size_ ||
+      (pos() == 0 && length < decoded_size_)) {
+    // Use default implementation which may call `PullSlow`.  Small reads from
+    // the beginning decode the entire value once into the buffer, so that
+    // subsequent sequential reads are just copies.
     return Reader::ReadSlow(length, dest);
   }
-  if (auto result = blosc::DecodeWithCallback(encoded_data_,
-                                              [&](size_t n) { return dest; });
-      !result.ok()) {
-    Fail(std::move(result).status());
+  // Reading a sub-range (typically after a seek): decompress only the blocks
+  // that intersect the requested range.
+  const size_t prev_pos = static_cast<size_t>(pos());
+  const size_t n = std::min(length, decoded_size_ - prev_pos);
+  if (auto status = blosc::DecodeRange(encoded_data_, prev_pos, n, dest);
+      !status.ok()) {
+    Fail(std::move(status));
+    return false;
+  }
+  move_limit_pos(n);
+  return length == n;
+}
+
+bool BloscReader::SeekSlow(riegeli::Position new_pos) {
+  if (start() != nullptr) {
+    // The buffer spans the entire decoded value, so `new_pos` is past EOF.
+    set_cursor(limit());
     return false;
   }
-  move_limit_pos(decoded_size_);
-  return length == decoded_size_;
+  set_limit_pos(std::min(new_pos, riegeli::Position{decoded_size_}));
+  return new_pos <= decoded_size_;
 }
 
 }  // namespace blosc
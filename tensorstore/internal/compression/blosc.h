@@ -100,6 +100,19 @@ Result<size_t> DecodeWithCallback(
 // Returns the decoded size of the input.
 Result<size_t> GetDecodedSize(std::string_view input);
 
+// Decodes the byte range `[offset, offset + length)` of the decoded
+// representation of `input` into `output`, which must have room for `length`
+// bytes.
+//
+// Only the blosc blocks that intersect the requested range are decompressed
+// (via `blosc_getitem`), making this much cheaper than `Decode` when a small
+// fraction of a large buffer is needed.
+//
+// \error `absl::StatusCode::kInvalidArgument` if `input` is corrupt or the
+//     requested range exceeds the decoded size.
+absl::Status DecodeRange(std::string_view input, size_t offset, size_t length,
+                         char* output);
+
 // Writes blosc-encoded data to an underlying writer.
 //
 // Because the c-blosc library does not support streaming, this buffers the
@@ -124,16 +137,22 @@ class BloscWriter : public riegeli::CordWriter<absl::Cord> {
 //
 // Because the c-blosc library does not support streaming, this buffers the
 // entire encoded value.
+//
+// Supports random access: seeking and then reading decompresses only the
+// blosc blocks that intersect the requested range, rather than the entire
+// value.
 class BloscReader : public riegeli::Reader {
  public:
   explicit BloscReader(riegeli::Reader& base_reader);
   BloscReader(BloscReader&&) = delete;
   bool ToleratesReadingAhead() override;
+  bool SupportsRandomAccess() override;
   bool SupportsSize() override;
 
  protected:
   bool PullSlow(size_t min_length, size_t recommended_length) override;
   bool ReadSlow(size_t length, char* dest) override;
+  bool SeekSlow(riegeli::Position new_pos) override;
   absl::optional<riegeli::Position> SizeImpl() override {
     return decoded_size_;
   }
@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 #include "absl/status/status.h"
 #include <blosc.h>
+#include "riegeli/bytes/string_reader.h"
 #include "tensorstore/util/status_testutil.h"
 
 namespace {
@@ -88,6 +89,78 @@ TEST(BloscTest, EncodeDecode) {
   }
 }
 
+// Tests that decoding a byte range matches the corresponding substring of the
+// decoded value, including unaligned ranges and ranges extending into a final
+// partial element.
+TEST(BloscTest, DecodeRange) {
+  for (blosc::Options options : GetTestOptions()) {
+    for (const auto& array : GetTestArrays()) {
+      for (const size_t element_size : {1, 2, 10}) {
+        options.element_size = element_size;
+        TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                         blosc::Encode(array, options));
+        const std::vector<std::pair<size_t, size_t>> ranges{
+            {0, array.size()},
+            {0, array.size() / 2},
+            {array.size() / 3, array.size() / 2},
+            {array.size() / 2, array.size() - array.size() / 2},
+            {array.size(), 0},
+        };
+        for (const auto& [offset, length] : ranges) {
+          std::string output(length, '\0');
+          TENSORSTORE_ASSERT_OK(
+              blosc::DecodeRange(encoded, offset, length, output.data()));
+          EXPECT_EQ(array.substr(offset, length), output)
+              << "offset=" << offset << ", length=" << length
+              << ", element_size=" << element_size;
+        }
+      }
+    }
+  }
+}
+
+// Tests that decoding a byte range that exceeds the decoded size returns an
+// error.
+TEST(BloscTest, DecodeRangeOutOfBounds) {
+  const std::string_view array =
+      "The quick brown fox jumped over the lazy dog.";
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto encoded,
+      blosc::Encode(array, blosc::Options{/*.compressor=*/"lz4", /*.clevel=*/5,
+                                          /*.shuffle=*/-1, /*.blocksize=*/0,
+                                          /*.element_size=*/1}));
+  char buffer[1];
+  EXPECT_THAT(blosc::DecodeRange(encoded, array.size(), 1, buffer),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
+// Tests that `BloscReader` supports seeking and then reading a sub-range.
+TEST(BloscTest, ReaderSeekAndRead) {
+  std::string array(100000, '\0');
+  unsigned char v = 0;
+  for (auto& x : array) {
+    x = (v += 7);
+  }
+  blosc::Options options{/*.compressor=*/"lz4", /*.clevel=*/5,
+                         /*.shuffle=*/BLOSC_SHUFFLE, /*.blocksize=*/1024,
+                         /*.element_size=*/4};
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                   blosc::Encode(array, options));
+  for (const auto& [offset, length] :
+       std::vector<std::pair<size_t, size_t>>{
+           {0, 100}, {3, 101}, {50000, 4096}, {99990, 10}, {99990, 100}}) {
+    riegeli::StringReader base_reader(encoded);
+    blosc::BloscReader reader(base_reader);
+    EXPECT_TRUE(reader.SupportsRandomAccess());
+    ASSERT_TRUE(reader.Seek(offset));
+    std::string output;
+    reader.Read(length, output);
+    EXPECT_EQ(array.substr(offset, length), output)
+        << "offset=" << offset << ", length=" << length;
+    EXPECT_TRUE(reader.Close());
+  }
+}
+
 // Tests that the compressed data has the expected blosc complib.
 TEST(BloscTest, CheckComplib) {
   const std::string_view array =
@@ -17,8 +17,10 @@
 #include <stddef.h>
 
 #include <memory>
+#include <string_view>
 #include <utility>
 
+#include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "riegeli/bytes/cord_reader.h"
@@ -59,5 +61,25 @@ absl::Status JsonSpecifiedCompressor::Decode(const absl::Cord& input,
   return absl::OkStatus();
 }
 
+absl::Status JsonSpecifiedCompressor::DecodeStreaming(
+    const absl::Cord& input,
+    absl::FunctionRef<absl::Status(std::string_view decoded_block)>
+        consume_block,
+    size_t element_bytes) const {
+  riegeli::CordReader<> base_reader(&input);
+  auto reader = GetReader(base_reader, element_bytes);
+  while (reader->Pull()) {
+    TENSORSTORE_RETURN_IF_ERROR(
+        consume_block(std::string_view(reader->cursor(), reader->available())));
+    reader->move_cursor(reader->available());
+  }
+  if (!reader->Close()) {
+    return MaybeConvertStatusTo(reader->status(),
+                                absl::StatusCode::kInvalidArgument);
+  }
+  if (!base_reader.VerifyEndAndClose()) return base_reader.status();
+  return absl::OkStatus();
+}
+
 }  // namespace internal
 }  // namespace tensorstore
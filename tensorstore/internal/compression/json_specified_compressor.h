@@ -18,8 +18,10 @@
 #include <stddef.h>
 
 #include <memory>
+#include <string_view>
 
 #include "absl/base/attributes.h"
+#include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "riegeli/bytes/reader.h"
@@ -80,6 +82,28 @@ class JsonSpecifiedCompressor
   absl::Status Decode(const absl::Cord& input, absl::Cord* output,
                       size_t element_bytes) const;
 
+  /// Decodes `input` incrementally, invoking `consume_block` with each decoded
+  /// block as soon as the decompressor produces it.
+  ///
+  /// Unlike `Decode`, the full decoded buffer is never materialized: the
+  /// consumer (e.g. a copy into the destination array) runs interleaved with
+  /// decompression, and peak memory is bounded by the decompressor's internal
+  /// block size rather than by the decoded size.
+  ///
+  /// \param input The input data.
+  /// \param consume_block Invoked with each decoded block, in order.  The
+  ///     block is only valid for the duration of the call.  Decoding stops if
+  ///     an error is returned, and the error is propagated.
+  /// \param element_bytes Specifies the element size as a hint to the
+  ///     compressor, e.g. `4` if `input` is actually a sequence of `int32_t`
+  ///     values.  Must be `> 0`.
+  /// \error `absl::StatusCode::kInvalidArgument` if `input` is invalid.
+  absl::Status DecodeStreaming(
+      const absl::Cord& input,
+      absl::FunctionRef<absl::Status(std::string_view decoded_block)>
+          consume_block,
+      size_t element_bytes) const;
+
   using ToJsonOptions = JsonSerializationOptions;
   using FromJsonOptions = JsonSerializationOptions;
 
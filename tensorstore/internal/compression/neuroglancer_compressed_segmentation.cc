@@ -26,6 +26,11 @@
 #include "absl/base/internal/endian.h"
 #include "absl/container/flat_hash_map.h"
 
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define TENSORSTORE_INTERNAL_COMPRESSED_SEG_AVX2 1
+#endif
+
 namespace tensorstore {
 namespace neuroglancer_compressed_segmentation {
 
@@ -223,17 +228,231 @@ void ReadBlockHeader(const void* header, size_t* encoded_value_base_offset,
   *encoded_value_base_offset = (h >> 32) & 0xffffff;
 }
 
+namespace {
+
+// Decodes a complete block into contiguous C order output, assuming
+// `table_size >= 2**kEncodedBits` so that no per-element bounds check is
+// required.  Specializing on `kEncodedBits` lets the compiler unroll and
+// vectorize the bit-unpacking and table lookups.
+template <typename Label, size_t kEncodedBits>
+void DecodeBlockFullScalar(const char* encoded_input, const char* table_input,
+                           ptrdiff_t num_elements, Label* output) {
+  constexpr uint32_t encoded_value_mask =
+      kEncodedBits == 32 ? 0xffffffff : (uint32_t(1) << kEncodedBits) - 1;
+  constexpr ptrdiff_t elements_per_word = 32 / kEncodedBits;
+  for (ptrdiff_t i = 0; i < num_elements;) {
+    const uint32_t word =
+        absl::little_endian::Load32(encoded_input + i / elements_per_word * 4);
+    for (ptrdiff_t j = 0; j < elements_per_word && i < num_elements; ++j, ++i) {
+      const size_t index = (word >> (j * kEncodedBits)) & encoded_value_mask;
+      if constexpr (sizeof(Label) == 4) {
+        output[i] = absl::little_endian::Load32(table_input + index * 4);
+      } else {
+        output[i] = absl::little_endian::Load64(table_input + index * 8);
+      }
+    }
+  }
+}
+
+#ifdef TENSORSTORE_INTERNAL_COMPRESSED_SEG_AVX2
+
+bool HaveAvx2() {
+  static const bool have = __builtin_cpu_supports("avx2");
+  return have;
+}
+
+// AVX2 variants of `DecodeBlockFullScalar`: indices are unpacked 8 at a time
+// (by zero-extension for 8/16/32 bits, or per-lane variable shifts for
+// narrower encodings) and the table lookups use gather instructions.
+//
+// Note: Not templates because GCC does not support the `target` attribute on
+// function templates.
+__attribute__((target("avx2"))) void DecodeBlockFullAvx2(
+    size_t encoded_bits, const char* encoded_input, const char* table_input,
+    ptrdiff_t num_elements, uint32_t* output) {
+  const int* table = reinterpret_cast<const int*>(table_input);
+  const uint32_t encoded_value_mask =
+      encoded_bits == 32 ? 0xffffffff : (uint32_t(1) << encoded_bits) - 1;
+  ptrdiff_t i = 0;
+  switch (encoded_bits) {
+    case 8:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(encoded_input + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                            _mm256_i32gather_epi32(table, index, 4));
+      }
+      break;
+    case 16:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(encoded_input + i * 2)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                            _mm256_i32gather_epi32(table, index, 4));
+      }
+      break;
+    case 32:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(encoded_input + i * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                            _mm256_i32gather_epi32(table, index, 4));
+      }
+      break;
+    default: {
+      // 1, 2, or 4 bits: each 32-bit word holds `32 / encoded_bits >= 8`
+      // indices.
+      const __m256i mask = _mm256_set1_epi32(encoded_value_mask);
+      const __m256i lane_shifts = _mm256_mullo_epi32(
+          _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+          _mm256_set1_epi32(static_cast<int>(encoded_bits)));
+      const ptrdiff_t elements_per_word = 32 / encoded_bits;
+      for (; i + elements_per_word <= num_elements;) {
+        const __m256i word = _mm256_set1_epi32(
+            static_cast<int>(absl::little_endian::Load32(
+                encoded_input + i / elements_per_word * 4)));
+        for (ptrdiff_t j = 0; j < elements_per_word; j += 8, i += 8) {
+          const __m256i shifts = _mm256_add_epi32(
+              _mm256_set1_epi32(static_cast<int>(j * encoded_bits)),
+              lane_shifts);
+          const __m256i index =
+              _mm256_and_si256(_mm256_srlv_epi32(word, shifts), mask);
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                              _mm256_i32gather_epi32(table, index, 4));
+        }
+      }
+      break;
+    }
+  }
+  for (; i < num_elements; ++i) {
+    const size_t index = (absl::little_endian::Load32(
+                              encoded_input + i * encoded_bits / 32 * 4) >>
+                          (i * encoded_bits % 32)) &
+                         encoded_value_mask;
+    output[i] = absl::little_endian::Load32(table_input + index * 4);
+  }
+}
+
+__attribute__((target("avx2"))) void DecodeBlockFullAvx2(
+    size_t encoded_bits, const char* encoded_input, const char* table_input,
+    ptrdiff_t num_elements, uint64_t* output) {
+  const long long* table = reinterpret_cast<const long long*>(table_input);
+  const uint32_t encoded_value_mask =
+      encoded_bits == 32 ? 0xffffffff : (uint32_t(1) << encoded_bits) - 1;
+  ptrdiff_t i = 0;
+  // Note: The gathers are written out at each use rather than factored into a
+  // local lambda because GCC does not propagate the `target` attribute to
+  // lambdas.
+#define TENSORSTORE_INTERNAL_GATHER_AND_STORE_64(index)                       \
+  _mm256_storeu_si256(                                                        \
+      reinterpret_cast<__m256i*>(output + i),                                 \
+      _mm256_i32gather_epi64(table, _mm256_castsi256_si128(index), 8));       \
+  _mm256_storeu_si256(                                                        \
+      reinterpret_cast<__m256i*>(output + i + 4),                             \
+      _mm256_i32gather_epi64(table, _mm256_extracti128_si256(index, 1), 8))
+  switch (encoded_bits) {
+    case 8:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(encoded_input + i)));
+        TENSORSTORE_INTERNAL_GATHER_AND_STORE_64(index);
+      }
+      break;
+    case 16:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(encoded_input + i * 2)));
+        TENSORSTORE_INTERNAL_GATHER_AND_STORE_64(index);
+      }
+      break;
+    case 32:
+      for (; i + 8 <= num_elements; i += 8) {
+        const __m256i index = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(encoded_input + i * 4));
+        TENSORSTORE_INTERNAL_GATHER_AND_STORE_64(index);
+      }
+      break;
+    default: {
+      const __m256i mask = _mm256_set1_epi32(encoded_value_mask);
+      const __m256i lane_shifts = _mm256_mullo_epi32(
+          _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+          _mm256_set1_epi32(static_cast<int>(encoded_bits)));
+      const ptrdiff_t elements_per_word = 32 / encoded_bits;
+      for (; i + elements_per_word <= num_elements;) {
+        const __m256i word = _mm256_set1_epi32(
+            static_cast<int>(absl::little_endian::Load32(
+                encoded_input + i / elements_per_word * 4)));
+        for (ptrdiff_t j = 0; j < elements_per_word; j += 8, i += 8) {
+          const __m256i shifts = _mm256_add_epi32(
+              _mm256_set1_epi32(static_cast<int>(j * encoded_bits)),
+              lane_shifts);
+          const __m256i index =
+              _mm256_and_si256(_mm256_srlv_epi32(word, shifts), mask);
+          TENSORSTORE_INTERNAL_GATHER_AND_STORE_64(index);
+        }
+      }
+      break;
+    }
+  }
+#undef TENSORSTORE_INTERNAL_GATHER_AND_STORE_64
+  for (; i < num_elements; ++i) {
+    const size_t index = (absl::little_endian::Load32(
+                              encoded_input + i * encoded_bits / 32 * 4) >>
+                          (i * encoded_bits % 32)) &
+                         encoded_value_mask;
+    output[i] = absl::little_endian::Load64(table_input + index * 8);
+  }
+}
+
+#endif  // TENSORSTORE_INTERNAL_COMPRESSED_SEG_AVX2
+
+template <typename Label>
+void DecodeBlockFull(size_t encoded_bits, const char* encoded_input,
+                     const char* table_input, ptrdiff_t num_elements,
+                     Label* output) {
+#ifdef TENSORSTORE_INTERNAL_COMPRESSED_SEG_AVX2
+  if (HaveAvx2()) {
+    DecodeBlockFullAvx2(encoded_bits, encoded_input, table_input, num_elements,
+                        output);
+    return;
+  }
+#endif
+  switch (encoded_bits) {
+    case 1:
+      DecodeBlockFullScalar<Label, 1>(encoded_input, table_input, num_elements,
+                                      output);
+      break;
+    case 2:
+      DecodeBlockFullScalar<Label, 2>(encoded_input, table_input, num_elements,
+                                      output);
+      break;
+    case 4:
+      DecodeBlockFullScalar<Label, 4>(encoded_input, table_input, num_elements,
+                                      output);
+      break;
+    case 8:
+      DecodeBlockFullScalar<Label, 8>(encoded_input, table_input, num_elements,
+                                      output);
+      break;
+    case 16:
+      DecodeBlockFullScalar<Label, 16>(encoded_input, table_input,
+                                       num_elements, output);
+      break;
+    default:
+      DecodeBlockFullScalar<Label, 32>(encoded_input, table_input,
+                                       num_elements, output);
+      break;
+  }
+}
+
+}  // namespace
+
 template <typename Label>
 bool DecodeBlock(size_t encoded_bits, const char* encoded_input,
                  const char* table_input, size_t table_size,
                  const ptrdiff_t block_shape[3],
                  const ptrdiff_t output_shape[3],
                  const ptrdiff_t output_byte_strides[3], Label* output) {
-  // TODO(jbms): Consider specializing this function for the value of
-  // `encoded_bits` and whether `table_size` is `< 2**encoded_bits`.  If
-  // `table_size >= 2**encoded_bits`, there is no need to check below that
-  // `index <= table_size`.
-
   // Invokes `callback(label, z, y, x)` for each block position in C order.  If
   // `callback` returns `false`, stops iterating and returns `false`.  Otherwise
   // returns `true` when done.
@@ -275,6 +494,24 @@ bool DecodeBlock(size_t encoded_bits, const char* encoded_input,
         });
   }
 
+  // Fast path for decoding a complete block into contiguous C order output:
+  // when the table covers every possible encoded index
+  // (`table_size >= 2**encoded_bits`), no per-element validation is required,
+  // and the decode reduces to flat bit-unpacking and table lookups,
+  // specialized per `encoded_bits` and vectorized where supported.
+  if (encoded_bits <= 32 && (encoded_bits & (encoded_bits - 1)) == 0 &&
+      output_shape[0] == block_shape[0] && output_shape[1] == block_shape[1] &&
+      output_shape[2] == block_shape[2] &&
+      output_byte_strides[2] == ptrdiff_t(sizeof(Label)) &&
+      output_byte_strides[1] == block_shape[2] * ptrdiff_t(sizeof(Label)) &&
+      output_byte_strides[0] ==
+          block_shape[1] * block_shape[2] * ptrdiff_t(sizeof(Label)) &&
+      table_size >= (uint64_t(1) << encoded_bits)) {
+    DecodeBlockFull(encoded_bits, encoded_input, table_input,
+                    block_shape[0] * block_shape[1] * block_shape[2], output);
+    return true;
+  }
+
   const uint32_t encoded_value_mask = (1U << encoded_bits) - 1;
   return for_each_position([&](Label& output_label, ptrdiff_t z, ptrdiff_t y,
                                ptrdiff_t x) {
@@ -0,0 +1,104 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "absl/random/random.h"
+#include "tensorstore/internal/compression/neuroglancer_compressed_segmentation.h"
+
+namespace {
+
+using ::tensorstore::neuroglancer_compressed_segmentation::DecodeChannel;
+using ::tensorstore::neuroglancer_compressed_segmentation::EncodeChannel;
+
+constexpr ptrdiff_t kVolumeShape[3] = {64, 64, 64};
+constexpr ptrdiff_t kBlockShape[3] = {8, 8, 8};
+
+// Generates a volume containing `num_distinct_ids` distinct labels.  The
+// number of distinct labels determines `encoded_bits`, which is the main
+// factor affecting encode/decode performance.
+template <typename Label>
+std::vector<Label> MakeInput(size_t num_distinct_ids) {
+  absl::BitGen gen;
+  std::vector<Label> labels(num_distinct_ids);
+  for (auto& label : labels) {
+    label = absl::Uniform<Label>(gen);
+  }
+  std::vector<Label> input(kVolumeShape[0] * kVolumeShape[1] * kVolumeShape[2]);
+  for (auto& value : input) {
+    value = labels[absl::Uniform(gen, 0u, labels.size())];
+  }
+  return input;
+}
+
+template <typename Label>
+void BM_EncodeChannel(benchmark::State& state) {
+  constexpr ptrdiff_t s = sizeof(Label);
+  const ptrdiff_t byte_strides[3] = {kVolumeShape[1] * kVolumeShape[2] * s,
+                                     kVolumeShape[2] * s, s};
+  const auto input = MakeInput<Label>(state.range(0));
+  for (auto _ : state) {
+    std::string output;
+    EncodeChannel(input.data(), kVolumeShape, byte_strides, kBlockShape,
+                  &output);
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size() * sizeof(Label));
+}
+
+template <typename Label>
+void BM_DecodeChannel(benchmark::State& state) {
+  constexpr ptrdiff_t s = sizeof(Label);
+  const ptrdiff_t byte_strides[3] = {kVolumeShape[1] * kVolumeShape[2] * s,
+                                     kVolumeShape[2] * s, s};
+  const auto input = MakeInput<Label>(state.range(0));
+  std::string encoded;
+  EncodeChannel(input.data(), kVolumeShape, byte_strides, kBlockShape,
+                &encoded);
+  std::vector<Label> output(input.size());
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(DecodeChannel(encoded, kBlockShape,
+                                             kVolumeShape, byte_strides,
+                                             output.data()));
+  }
+  state.SetBytesProcessed(state.iterations() * output.size() * sizeof(Label));
+}
+
+BENCHMARK_TEMPLATE(BM_EncodeChannel, uint32_t)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(BM_EncodeChannel, uint64_t)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(BM_DecodeChannel, uint32_t)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096);
+BENCHMARK_TEMPLATE(BM_DecodeChannel, uint64_t)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096);
+
+}  // namespace
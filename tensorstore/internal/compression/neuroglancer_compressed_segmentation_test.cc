@@ -450,4 +450,42 @@ TEST(RoundTripTest, Random) {
                                /*num_iterations=*/100);
 }
 
+// Round trips complete 8x8x8 blocks in contiguous C order with exactly
+// `2**encoded_bits` distinct labels per block, which exercises the specialized
+// full-block decode path in `DecodeBlock` (the table covers every possible
+// encoded index, so no per-element bounds check is required).
+template <typename T>
+void FullBlockRoundTrip(size_t num_distinct_ids) {
+  const ptrdiff_t block_shape[3] = {8, 8, 8};
+  const ptrdiff_t input_shape[3] = {16, 16, 16};
+  constexpr ptrdiff_t s = sizeof(T);
+  const ptrdiff_t input_byte_strides[3] = {input_shape[1] * input_shape[2] * s,
+                                           input_shape[2] * s, s};
+  absl::BitGen gen;
+  std::vector<T> labels(num_distinct_ids);
+  for (auto& label : labels) {
+    label = absl::Uniform<T>(gen);
+  }
+  std::vector<T> input(input_shape[0] * input_shape[1] * input_shape[2]);
+  // Ensure every label occurs in every block so that the per-block table size
+  // is exactly `num_distinct_ids`.
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = labels[i % labels.size()];
+  }
+  std::string output;
+  EncodeChannel(input.data(), input_shape, input_byte_strides, block_shape,
+                &output);
+  std::vector<T> decoded_output(input.size());
+  EXPECT_TRUE(DecodeChannel(output, block_shape, input_shape,
+                            input_byte_strides, decoded_output.data()));
+  EXPECT_EQ(input, decoded_output);
+}
+
+TEST(RoundTripTest, FullBlocks) {
+  for (const size_t num_distinct_ids : {1, 2, 4, 16, 256}) {
+    FullBlockRoundTrip<uint32_t>(num_distinct_ids);
+    FullBlockRoundTrip<uint64_t>(num_distinct_ids);
+  }
+}
+
 }  // namespace
@@ -37,6 +37,7 @@ std::unique_ptr<riegeli::Writer> XzCompressor::GetWriter(
   options.set_check(static_cast<Writer::Check>(check));
   options.set_compression_level(level);
   options.set_extreme(extreme);
+  options.set_parallelism(threads > 1 ? threads : 0);
   return std::make_unique<Writer>(&base_writer, options);
 }
 
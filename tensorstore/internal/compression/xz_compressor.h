@@ -41,6 +41,14 @@ struct XzOptions {
 
   /// Specifies the integrity check to use.
   ::lzma_check check = LZMA_CHECK_CRC64;
+
+  /// Specifies the number of threads to use for encoding.  If greater than 1,
+  /// liblzma's multi-threaded encoder (`lzma_stream_encoder_mt`) is used: the
+  /// input is split into blocks that are compressed concurrently.  The result
+  /// is a standard multi-block xz stream that any decoder can read, but is
+  /// typically slightly larger than the single-threaded encoding.  Decoding is
+  /// unaffected.
+  int threads = 1;
 };
 
 class XzCompressor : public JsonSpecifiedCompressor, public XzOptions {
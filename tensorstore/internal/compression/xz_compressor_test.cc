@@ -78,6 +78,27 @@ TEST(XzCompressorTest, LargeRoundtrip) {
   EXPECT_EQ(input, decode_result);
 }
 
+// Tests that multi-threaded encoding produces a standard multi-block xz
+// stream that decodes normally.
+TEST(XzCompressorTest, MultiThreadedRoundtrip) {
+  std::string input(1000000, '\0');
+  unsigned char x = 0;
+  for (auto& v : input) {
+    v = x;
+    x += 7;
+  }
+  XzCompressor compressor;
+  compressor.threads = 4;
+  absl::Cord encode_result, decode_result;
+  TENSORSTORE_ASSERT_OK(
+      compressor.Encode(absl::Cord(input), &encode_result, 0));
+  // Decode with a default (single-threaded) compressor to verify that the
+  // encoded representation does not require special decoding support.
+  XzCompressor decompressor;
+  TENSORSTORE_ASSERT_OK(decompressor.Decode(encode_result, &decode_result, 0));
+  EXPECT_EQ(input, decode_result);
+}
+
 // Tests that specifying a level of 9 gives a result that is different from 6.
 TEST(XzCompressorTest, NonDefaultLevel) {
   XzCompressor compressor;
@@ -14,10 +14,13 @@
 
 #include "tensorstore/internal/compression/zlib.h"
 
+#include <memory>
+
 #include "absl/base/optimization.h"
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
 #include "tensorstore/internal/compression/cord_stream_manager.h"
+#include "tensorstore/util/status.h"
 
 // Include zlib header last because it defines a bunch of poorly-named macros.
 #include <zlib.h>
@@ -26,16 +29,6 @@ namespace tensorstore {
 namespace zlib {
 namespace {
 
-struct InflateOp {
-  static int Init(z_stream* s, [[maybe_unused]] int level, int header_option) {
-    return inflateInit2(s, /*windowBits=*/15 /* (default) */
-                               + header_option);
-  }
-  static int Process(z_stream* s, int flags) { return inflate(s, flags); }
-  static int Destroy(z_stream* s) { return inflateEnd(s); }
-  static constexpr bool kDataErrorPossible = true;
-};
-
 struct DeflateOp {
   static int Init(z_stream* s, int level, int header_option) {
     return deflateInit2(s, level, Z_DEFLATED,
@@ -49,17 +42,37 @@ struct DeflateOp {
   static constexpr bool kDataErrorPossible = false;
 };
 
-/// Inflates or deflates using zlib.
+/// Runs `inflate` over `input` until no further progress can be made,
+/// appending decoded data to `*output`.
 ///
-/// \tparam Op Either `InflateOp` or `DeflateOp`.
+/// \returns The final zlib result code, and sets `*input_remaining` to
+///     indicate whether `input` was fully consumed.
+int InflateFragment(z_stream* s, const absl::Cord& input, absl::Cord* output,
+                    int flags, bool* input_remaining) {
+  internal::CordStreamManager<z_stream, /*BufferSize=*/16 * 1024>
+      stream_manager(*s, input, output);
+  int err;
+  while (true) {
+    stream_manager.FeedInputAndOutputBuffers();
+    err = inflate(s, flags);
+    const bool made_progress = stream_manager.HandleOutput();
+    if (err == Z_OK) continue;
+    if (err == Z_BUF_ERROR && made_progress) continue;
+    break;
+  }
+  *input_remaining = stream_manager.has_input_remaining();
+  return err;
+}
+
+/// Deflates using zlib.
+///
+/// \tparam Op Must be `DeflateOp`.
 /// \param input The input data.
 /// \param output[in,out] Output buffer to which output data is appended.
 /// \param level Compression level, must be in the range [0, 9].
 /// \param use_gzip_header If `true`, use gzip header.  Otherwise, use zlib
 ///     header.
 /// \returns `absl::Status()` on success.
-/// \error `absl::StatusCode::kInvalidArgument` if decoding fails due to input
-///     input.
 template <typename Op>
 absl::Status ProcessZlib(const absl::Cord& input, absl::Cord* output, int level,
                          bool use_gzip_header) {
@@ -115,7 +128,64 @@ void Encode(const absl::Cord& input, absl::Cord* output,
 
 absl::Status Decode(const absl::Cord& input, absl::Cord* output,
                     bool use_gzip_header) {
-  return ProcessZlib<InflateOp>(input, output, 0, use_gzip_header);
+  IncrementalDecoder decoder(use_gzip_header);
+  TENSORSTORE_RETURN_IF_ERROR(decoder.Append(input));
+  TENSORSTORE_RETURN_IF_ERROR(decoder.Finish());
+  output->Append(std::move(decoder.output()));
+  return absl::OkStatus();
+}
+
+struct IncrementalDecoder::Stream {
+  z_stream s = {};
+  ~Stream() { inflateEnd(&s); }
+};
+
+IncrementalDecoder::IncrementalDecoder(bool use_gzip_header)
+    : stream_(std::make_unique<Stream>()) {
+  const int header_option = use_gzip_header ? 16 /* require gzip header */
+                                            : 0;
+  if (inflateInit2(&stream_->s, /*windowBits=*/15 /* (default) */
+                                    + header_option) != Z_OK) {
+    // Terminate if allocating even the small amount of memory required fails.
+    ABSL_CHECK(false);
+  }
+}
+
+IncrementalDecoder::~IncrementalDecoder() = default;
+
+absl::Status IncrementalDecoder::Append(const absl::Cord& input) {
+  if (done_) {
+    if (input.empty()) return absl::OkStatus();
+    return absl::InvalidArgumentError("Error decoding zlib-compressed data");
+  }
+  bool input_remaining;
+  const int err =
+      InflateFragment(&stream_->s, input, &output_, Z_NO_FLUSH,
+                      &input_remaining);
+  if (err == Z_STREAM_END) {
+    done_ = true;
+    if (input_remaining) {
+      return absl::InvalidArgumentError("Error decoding zlib-compressed data");
+    }
+    return absl::OkStatus();
+  }
+  if (err == Z_BUF_ERROR && !input_remaining) {
+    // Additional input is required to make further progress.
+    return absl::OkStatus();
+  }
+  return absl::InvalidArgumentError("Error decoding zlib-compressed data");
+}
+
+absl::Status IncrementalDecoder::Finish() {
+  if (done_) return absl::OkStatus();
+  bool input_remaining;
+  const int err = InflateFragment(&stream_->s, absl::Cord(), &output_,
+                                  Z_FINISH, &input_remaining);
+  if (err != Z_STREAM_END) {
+    return absl::InvalidArgumentError("Error decoding zlib-compressed data");
+  }
+  done_ = true;
+  return absl::OkStatus();
 }
 
 }  // namespace zlib
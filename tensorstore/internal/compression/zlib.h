@@ -18,6 +18,8 @@
 /// \file
 /// Convenience interface to the zlib library.
 
+#include <memory>
+
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 
@@ -56,6 +58,45 @@ void Encode(const absl::Cord& input, absl::Cord* output,
 absl::Status Decode(const absl::Cord& input, absl::Cord* output,
                     bool use_gzip_header);
 
+/// Incrementally decompresses a zlib- or gzip-compressed stream.
+///
+/// The compressed stream may be supplied one fragment at a time as it arrives
+/// (e.g. from an `internal_http::HttpResponseHandler` as response body
+/// fragments are received), allowing decompression to overlap the transfer
+/// rather than waiting for the complete stream.
+class IncrementalDecoder {
+ public:
+  /// \param use_gzip_header Specifies the header type with which the stream
+  ///     was encoded.
+  explicit IncrementalDecoder(bool use_gzip_header);
+  ~IncrementalDecoder();
+
+  IncrementalDecoder(const IncrementalDecoder&) = delete;
+  IncrementalDecoder& operator=(const IncrementalDecoder&) = delete;
+
+  /// Decompresses the next fragment of the stream, appending decoded data to
+  /// `output()`.
+  ///
+  /// \error `absl::StatusCode::kInvalidArgument` if the stream is corrupt, or
+  ///     if `input` continues past the end of the stream.
+  absl::Status Append(const absl::Cord& input);
+
+  /// Indicates that the end of the stream has been reached.
+  ///
+  /// \error `absl::StatusCode::kInvalidArgument` if the stream is truncated.
+  absl::Status Finish();
+
+  /// Decompressed data accumulated so far.  The caller may move out or clear
+  /// already-consumed data between calls to `Append`.
+  absl::Cord& output() { return output_; }
+
+ private:
+  struct Stream;  // Wraps `z_stream`, which cannot be named here.
+  std::unique_ptr<Stream> stream_;
+  absl::Cord output_;
+  bool done_ = false;
+};
+
 }  // namespace zlib
 }  // namespace tensorstore
 
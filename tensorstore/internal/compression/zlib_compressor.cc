@@ -42,6 +42,10 @@ std::unique_ptr<riegeli::Reader> ZlibCompressor::GetReader(
   Reader::Options options;
   options.set_header(use_gzip_header ? Reader::Header::kGzip
                                      : Reader::Header::kZlib);
+  // Multi-member files are valid gzip (RFC 1952), and are produced by
+  // parallel gzip compressors for large inputs.  Decode all members rather
+  // than failing due to trailing data after the first member.
+  if (use_gzip_header) options.set_concatenate(true);
   return std::make_unique<Reader>(&base_reader, options);
 }
 
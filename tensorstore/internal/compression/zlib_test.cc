@@ -16,7 +16,9 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -108,6 +110,62 @@ TEST_P(ZlibCompressorTest, NonDefaultLevel) {
   EXPECT_EQ(input, decode_result);
 }
 
+// Tests that incremental decoding of a fragmented stream produces the same
+// result as buffered decoding, and that output may be consumed between
+// fragments.
+TEST_P(ZlibCompressorTest, IncrementalDecode) {
+  const bool use_gzip_header = GetParam();
+  std::string input(100000, '\0');
+  unsigned char x = 0;
+  for (auto& v : input) {
+    v = x;
+    x += 7;
+  }
+  zlib::Options options{6, use_gzip_header};
+  absl::Cord encode_result;
+  zlib::Encode(absl::Cord(input), &encode_result, options);
+  zlib::IncrementalDecoder decoder(use_gzip_header);
+  absl::Cord decode_result;
+  constexpr size_t kFragmentSize = 1000;
+  for (size_t i = 0; i < encode_result.size(); i += kFragmentSize) {
+    TENSORSTORE_ASSERT_OK(decoder.Append(encode_result.Subcord(
+        i, std::min(kFragmentSize, encode_result.size() - i))));
+    decode_result.Append(std::move(decoder.output()));
+    decoder.output().Clear();
+  }
+  TENSORSTORE_ASSERT_OK(decoder.Finish());
+  decode_result.Append(std::move(decoder.output()));
+  EXPECT_EQ(input, decode_result);
+}
+
+// Tests that a truncated stream is detected by `Finish`.
+TEST_P(ZlibCompressorTest, IncrementalDecodeTruncated) {
+  const bool use_gzip_header = GetParam();
+  zlib::Options options{6, use_gzip_header};
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result;
+  zlib::Encode(input, &encode_result, options);
+  ASSERT_GE(encode_result.size(), 1);
+  zlib::IncrementalDecoder decoder(use_gzip_header);
+  TENSORSTORE_ASSERT_OK(
+      decoder.Append(encode_result.Subcord(0, encode_result.size() - 1)));
+  EXPECT_THAT(decoder.Finish(),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
+// Tests that data following the end of the stream is detected.
+TEST_P(ZlibCompressorTest, IncrementalDecodeTrailingData) {
+  const bool use_gzip_header = GetParam();
+  zlib::Options options{6, use_gzip_header};
+  const absl::Cord input("The quick brown fox jumped over the lazy dog.");
+  absl::Cord encode_result;
+  zlib::Encode(input, &encode_result, options);
+  zlib::IncrementalDecoder decoder(use_gzip_header);
+  TENSORSTORE_ASSERT_OK(decoder.Append(encode_result));
+  EXPECT_THAT(decoder.Append(absl::Cord("trailing")),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
 // Tests that decoding corrupt data gives an error.
 TEST_P(ZlibCompressorTest, DecodeCorruptData) {
   const bool use_gzip_header = GetParam();
@@ -15,29 +15,62 @@
 #include "tensorstore/internal/compression/zstd_compressor.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "riegeli/bytes/writer.h"
 #include "riegeli/zstd/zstd_reader.h"
 #include "riegeli/zstd/zstd_writer.h"
+#include "tensorstore/internal/cache/writeback_pressure.h"
 
 namespace tensorstore {
 namespace internal {
+namespace {
+
+// Highest level the adaptive mode will escalate to; beyond this, zstd levels
+// cost far more CPU than they save in bytes for typical chunk data.
+constexpr int kMaxAdaptiveLevel = 19;
+
+// Returns the compression level to use for the next chunk given the current
+// writeback queue depth.  With at most one writeback in flight the storage
+// sink is keeping up, so compression effort is reduced; as the queue deepens,
+// the level is raised from the configured baseline to trade CPU for bytes.
+int AdaptiveLevel(int base_level, int64_t queue_depth) {
+  if (queue_depth <= 1) {
+    return std::max(base_level - 2, 1);
+  }
+  return static_cast<int>(std::min<int64_t>(base_level + (queue_depth - 2) / 2,
+                                            kMaxAdaptiveLevel));
+}
+
+}  // namespace
 
 std::unique_ptr<riegeli::Writer> ZstdCompressor::GetWriter(
     riegeli::Writer& base_writer, size_t element_bytes) const {
   using Writer = riegeli::ZstdWriter<riegeli::Writer*>;
   Writer::Options options;
-  options.set_compression_level(level);
+  options.set_compression_level(
+      adaptive ? AdaptiveLevel(level, GetWritebackQueueDepth()) : level);
+  if (window_log != 0) {
+    options.set_window_log(window_log);
+  }
+  if (!dictionary.empty()) {
+    options.set_dictionary(dictionary);
+  }
   return std::make_unique<Writer>(&base_writer, options);
 }
 
 std::unique_ptr<riegeli::Reader> ZstdCompressor::GetReader(
     riegeli::Reader& base_reader, size_t element_bytes) const {
   using Reader = riegeli::ZstdReader<riegeli::Reader*>;
-  return std::make_unique<Reader>(&base_reader);
+  Reader::Options options;
+  if (!dictionary.empty()) {
+    options.set_dictionary(dictionary);
+  }
+  return std::make_unique<Reader>(&base_reader, options);
 }
 
 }  // namespace internal
@@ -23,6 +23,7 @@
 
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
+#include "riegeli/zstd/zstd_dictionary.h"
 #include "tensorstore/internal/compression/json_specified_compressor.h"
 
 namespace tensorstore {
@@ -30,6 +31,26 @@ namespace internal {
 
 struct ZstdOptions {
   int level = 0;
+
+  /// Base-2 logarithm of the match window size, or 0 to use the default
+  /// derived from the compression level.  Larger windows improve compression
+  /// of highly redundant data; zstd automatically enables long-distance
+  /// matching for windows of 128MiB and above (`window_log >= 27`).
+  int window_log = 0;
+
+  /// If `true`, the compression level is adjusted per chunk based on the
+  /// current depth of the cache writeback queue, in the spirit of
+  /// `zstd --adapt`: a deep queue means storage is the bottleneck and more
+  /// CPU is spent shrinking each chunk, while an empty queue means
+  /// compression is the bottleneck and `level` is reduced.  `level` serves as
+  /// the baseline.
+  bool adaptive = false;
+
+  /// Optional shared compression dictionary (raw, un-digested bytes).  If
+  /// empty, no dictionary is used.  The digested form is computed once and
+  /// cached within the shared dictionary representation, so that repeated
+  /// encode/decode operations reuse it.
+  riegeli::ZstdDictionary dictionary;
 };
 
 class ZstdCompressor : public JsonSpecifiedCompressor, public ZstdOptions {
@@ -14,11 +14,9 @@
 
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 
-#include <algorithm>
-#include <thread>  // NOLINT
-
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/concurrency_resource_provider.h"
+#include "tensorstore/internal/os/cpu_topology.h"
 
 namespace tensorstore {
 namespace internal {
@@ -30,12 +28,11 @@ struct DataCopyConcurrencyResourceTraits
   DataCopyConcurrencyResourceTraits()
       : ConcurrencyResourceTraits(
             // This resource is for CPU-bound tasks.  Therefore, there is no
-            // advantage in oversubscribing the number of available CPU cores.
-            //
-            // Always use at least 1 thread in case
-            // `std::thread::hardware_concurrency()` returns 0 (due to being
-            // unable to determine number of cpu cores).
-            std::max(size_t(1), size_t(std::thread::hardware_concurrency()))) {}
+            // advantage in oversubscribing the cpu actually available to the
+            // process: physical cores (SMT siblings contribute little to
+            // memory-bandwidth-bound copies), further capped by the process's
+            // affinity mask and any cgroup cpu quota.  Always at least 1.
+            internal_os::GetEffectivePhysicalCoreCount()) {}
 };
 
 const ContextResourceRegistration<DataCopyConcurrencyResourceTraits>
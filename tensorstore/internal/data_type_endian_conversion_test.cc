@@ -100,6 +100,27 @@ TEST(EncodeDecodeArrayTest, Uint16) {
                                                   0x90, 0x12, 0x33, 0x44}));
 }
 
+// Test encoding a non-contiguous uint32 array large enough to span multiple
+// gather/scatter blocks of the blocked byte-swap path.
+TEST(EncodeDecodeArrayTest, Uint32StridedLarge) {
+  constexpr Index kSize = 300;
+  std::vector<uint32_t> source(2 * kSize);
+  for (Index i = 0; i < 2 * kSize; ++i) {
+    source[i] = static_cast<uint32_t>(0x01020304 * (i + 1));
+  }
+  std::vector<uint32_t> dest(2 * kSize);
+  EncodeArray(Array(source.data(), {2, kSize}, c_order),
+              Array(dest.data(), {2, kSize}, fortran_order), endian::big);
+  for (Index i = 0; i < 2; ++i) {
+    for (Index j = 0; j < kSize; ++j) {
+      const uint32_t value = source[i * kSize + j];
+      const uint32_t swapped = (value >> 24) | ((value >> 8) & 0xff00u) |
+                               ((value << 8) & 0xff0000u) | (value << 24);
+      EXPECT_EQ(swapped, dest[j * 2 + i]) << "i=" << i << ", j=" << j;
+    }
+  }
+}
+
 // Test encoding a float16 array.
 TEST(EncodeDecodeArrayTest, Float16) {
   using ::tensorstore::dtypes::float16_t;
@@ -31,6 +31,7 @@
 #include "tensorstore/internal/riegeli/delimited.h"
 #include "tensorstore/internal/riegeli/json_input.h"
 #include "tensorstore/internal/riegeli/json_output.h"
+#include "tensorstore/internal/swap_endian_bulk.h"
 #include "tensorstore/util/endian.h"
 #include "tensorstore/util/str_cat.h"
 #include "tensorstore/util/utf8_string.h"
@@ -38,6 +39,12 @@
 namespace tensorstore {
 namespace internal {
 
+/// Number of elements gathered into a temporary contiguous block per
+/// `SwapEndianBulk` call when iterating over non-contiguous buffers.  Large
+/// enough to amortize the bulk kernel's setup over many elements, while
+/// keeping the block (at most 2KiB for complex128) well within L1.
+constexpr Index kSwapEndianBlockElements = 128;
+
 template <size_t SubElementSize, size_t NumSubElements>
 struct SwapEndianUnalignedLoopImpl {
   // Type used as a placeholder for a value of size
@@ -49,24 +56,154 @@ struct SwapEndianUnalignedLoopImpl {
   static_assert(sizeof(UnalignedValue) == SubElementSize * NumSubElements);
   static_assert(alignof(UnalignedValue) == 1);
 
-  void operator()(UnalignedValue* value, void* arg) const {
-    SwapEndianUnalignedInplace<SubElementSize, NumSubElements>(value);
-  }
+  struct InplaceLoopImpl {
+    using ElementwiseFunctionType = ElementwiseFunction<1, void*>;
 
-  void operator()(const UnalignedValue* source, UnalignedValue* target,
-                  void* arg) const {
-    SwapEndianUnaligned<SubElementSize, NumSubElements>(source, target);
-  }
+    template <typename ArrayAccessor>
+    static constexpr auto GetLoopFn() {
+      if constexpr (ArrayAccessor::buffer_kind ==
+                    internal::IterationBufferKind::kContiguous) {
+        return &Contiguous<ArrayAccessor>;
+      } else if constexpr (SubElementSize > 1) {
+        return &BlockLoop<ArrayAccessor>;
+      } else {
+        return &Loop<ArrayAccessor>;
+      }
+    }
+
+    // Contiguous fast path using the SIMD bulk byte-swap kernel.
+    template <typename ArrayAccessor>
+    static bool Contiguous(void* /*context*/,
+                           internal::IterationBufferShape shape,
+                           IterationBufferPointer value, void* /*arg*/) {
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        UnalignedValue* p =
+            ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                value, outer, 0);
+        SwapEndianBulk<SubElementSize>(shape[1] * NumSubElements, p, p);
+      }
+      return true;
+    }
+
+    // Non-contiguous path: gathers elements into an aligned contiguous block,
+    // swaps the block with the bulk kernel, and scatters it back, so that the
+    // per-element cost is limited to the two copies.
+    template <typename ArrayAccessor>
+    static bool BlockLoop(void* /*context*/,
+                          internal::IterationBufferShape shape,
+                          IterationBufferPointer value, void* /*arg*/) {
+      alignas(16) UnalignedValue block[kSwapEndianBlockElements];
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        for (Index inner = 0; inner < shape[1];
+             inner += kSwapEndianBlockElements) {
+          const Index n =
+              std::min(kSwapEndianBlockElements, shape[1] - inner);
+          for (Index i = 0; i < n; ++i) {
+            block[i] =
+                *ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                    value, outer, inner + i);
+          }
+          SwapEndianBulk<SubElementSize>(n * NumSubElements, block, block);
+          for (Index i = 0; i < n; ++i) {
+            *ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                value, outer, inner + i) = block[i];
+          }
+        }
+      }
+      return true;
+    }
+
+    template <typename ArrayAccessor>
+    static bool Loop(void* /*context*/, internal::IterationBufferShape shape,
+                     IterationBufferPointer value, void* /*arg*/) {
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        for (Index inner = 0; inner < shape[1]; ++inner) {
+          SwapEndianUnalignedInplace<SubElementSize, NumSubElements>(
+              ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                  value, outer, inner));
+        }
+      }
+      return true;
+    }
+  };
+
+  struct LoopImpl {
+    using ElementwiseFunctionType = ElementwiseFunction<2, void*>;
+
+    template <typename ArrayAccessor>
+    static constexpr auto GetLoopFn() {
+      if constexpr (ArrayAccessor::buffer_kind ==
+                    internal::IterationBufferKind::kContiguous) {
+        return &Contiguous<ArrayAccessor>;
+      } else if constexpr (SubElementSize > 1) {
+        return &BlockLoop<ArrayAccessor>;
+      } else {
+        return &Loop<ArrayAccessor>;
+      }
+    }
+
+    // Contiguous fast path using the SIMD bulk byte-swap kernel.
+    template <typename ArrayAccessor>
+    static bool Contiguous(void* /*context*/,
+                           internal::IterationBufferShape shape,
+                           IterationBufferPointer source,
+                           IterationBufferPointer target, void* /*arg*/) {
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        SwapEndianBulk<SubElementSize>(
+            shape[1] * NumSubElements,
+            ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                source, outer, 0),
+            ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                target, outer, 0));
+      }
+      return true;
+    }
 
-  using InplaceLoopImpl = internal_elementwise_function::SimpleLoopTemplate<
-      SwapEndianUnalignedLoopImpl<SubElementSize, NumSubElements>(
-          UnalignedValue),
-      void*>;
+    // Non-contiguous path: gathers source elements into an aligned contiguous
+    // block, swaps the block in place with the bulk kernel, and scatters it to
+    // the target.  The source is never written.
+    template <typename ArrayAccessor>
+    static bool BlockLoop(void* /*context*/,
+                          internal::IterationBufferShape shape,
+                          IterationBufferPointer source,
+                          IterationBufferPointer target, void* /*arg*/) {
+      alignas(16) UnalignedValue block[kSwapEndianBlockElements];
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        for (Index inner = 0; inner < shape[1];
+             inner += kSwapEndianBlockElements) {
+          const Index n =
+              std::min(kSwapEndianBlockElements, shape[1] - inner);
+          for (Index i = 0; i < n; ++i) {
+            block[i] =
+                *ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                    source, outer, inner + i);
+          }
+          SwapEndianBulk<SubElementSize>(n * NumSubElements, block, block);
+          for (Index i = 0; i < n; ++i) {
+            *ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                target, outer, inner + i) = block[i];
+          }
+        }
+      }
+      return true;
+    }
 
-  using LoopImpl = internal_elementwise_function::SimpleLoopTemplate<
-      SwapEndianUnalignedLoopImpl<SubElementSize, NumSubElements>(
-          UnalignedValue, UnalignedValue),
-      void*>;
+    template <typename ArrayAccessor>
+    static bool Loop(void* /*context*/, internal::IterationBufferShape shape,
+                     IterationBufferPointer source,
+                     IterationBufferPointer target, void* /*arg*/) {
+      for (Index outer = 0; outer < shape[0]; ++outer) {
+        for (Index inner = 0; inner < shape[1]; ++inner) {
+          SwapEndianUnaligned<SubElementSize, NumSubElements>(
+              ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                  source, outer, inner),
+              ArrayAccessor::template GetPointerAtPosition<UnalignedValue>(
+                  target, outer, inner));
+        }
+      }
+      return true;
+    }
+  };
 };
 
 /// Swaps endianness of elements of an array in place.
@@ -75,6 +212,10 @@ struct SwapEndianUnalignedLoopImpl {
 /// `SubElementSize*NumSubElements` bytes.  The byte swapping is performed
 /// independently on each sub-element of `SubElementSize` bytes.
 ///
+/// Contiguous buffers are swapped directly with `SwapEndianBulk`; other
+/// buffer kinds are processed `kSwapEndianBlockElements` elements at a time
+/// through a temporary contiguous block.
+///
 /// \param SubElementSize Size in bytes of each sub-element.
 /// \param NumSubElements Number of sub-elements in each element.
 template <size_t SubElementSize, size_t NumSubElements = 1>
@@ -102,6 +243,11 @@ using SwapEndianUnalignedInplaceLoopTemplate =
 /// - To copy an array of `uint32_t` elements without byte swapping, specify
 ///   `SubElementSize=1` and `NumSubElements=4`.
 ///
+/// If `SubElementSize > 1`, contiguous buffers are swapped directly with
+/// `SwapEndianBulk`, and other buffer kinds are processed
+/// `kSwapEndianBlockElements` elements at a time through a temporary
+/// contiguous block.
+///
 /// \param SubElementSize Size in bytes of each sub-element.
 /// \param NumSubElements Number of sub-elements in each element.
 template <size_t SubElementSize, size_t NumSubElements = 1>
@@ -265,11 +411,10 @@ struct WriteSwapEndianLoopTemplate {
             shape[1], static_cast<Index>(
                           element_i + (writer.available() / sizeof(Element))));
         char* cursor = writer.cursor();
-        for (; element_i < end_element_i; ++element_i) {
-          SwapEndianUnaligned<SubElementSize, NumSubElements>(input, cursor);
-          input++;
-          cursor += sizeof(Element);
-        }
+        const Index n = end_element_i - element_i;
+        SwapEndianBulk<SubElementSize>(n * NumSubElements, input, cursor);
+        input += n;
+        cursor += n * sizeof(Element);
         element_i = end_element_i;
         writer.set_cursor(cursor);
       }
@@ -403,11 +548,10 @@ struct ReadSwapEndianLoopTemplate {
             shape[1], static_cast<Index>(
                           element_i + (reader.available() / sizeof(Element))));
         const char* cursor = reader.cursor();
-        for (; element_i < end_element_i; ++element_i) {
-          SwapEndianUnaligned<SubElementSize, NumSubElements>(cursor, output);
-          cursor += sizeof(Element);
-          output++;
-        }
+        const Index n = end_element_i - element_i;
+        SwapEndianBulk<SubElementSize>(n * NumSubElements, cursor, output);
+        cursor += n * sizeof(Element);
+        output += n;
         element_i = end_element_i;
         reader.set_cursor(cursor);
       }
@@ -15,10 +15,10 @@
 #include "tensorstore/internal/file_io_concurrency_resource.h"
 
 #include <algorithm>
-#include <thread>  // NOLINT
 
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/concurrency_resource_provider.h"
+#include "tensorstore/internal/os/cpu_topology.h"
 
 namespace tensorstore {
 namespace internal {
@@ -27,10 +27,15 @@ namespace {
 struct FileIoConcurrencyResourceTraits
     : public ConcurrencyResourceTraits,
       public ContextResourceTraits<FileIoConcurrencyResource> {
-  // TODO(jbms): use beter method of picking concurrency limit
   FileIoConcurrencyResourceTraits()
       : ConcurrencyResourceTraits(
-            std::max(size_t(4), size_t(std::thread::hardware_concurrency()))) {}
+            // File I/O threads mostly block in the kernel, so modest
+            // oversubscription of the available cpus keeps device queues fed,
+            // but the limit must still track the effective cpu count (cgroup
+            // quota, affinity mask) rather than the machine's logical cpus:
+            // otherwise a 4-cpu container on a 64-cpu host runs 64 threads.
+            // A floor of 4 preserves I/O parallelism on tiny machines.
+            std::max(size_t(4), 2 * internal_os::GetEffectiveCpuCount())) {}
 };
 
 const ContextResourceRegistration<FileIoConcurrencyResourceTraits> registration;
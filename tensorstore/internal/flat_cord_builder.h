@@ -36,6 +36,11 @@ namespace internal {
 /// This results in a Cord containing just a single chunk, which is more
 /// efficient if the full size is known in advance and the entire string is
 /// likely to be retained.
+///
+/// Blocks allocated by the size-only constructors are served from a
+/// process-wide pool shared across encode and decode operations (see
+/// `internal_os::AcquirePooledHeapRegion`), and return to the pool when the
+/// built cord is released.
 class FlatCordBuilder {
  public:
   explicit FlatCordBuilder(size_t size) : FlatCordBuilder(size, size) {}
@@ -44,7 +49,7 @@ class FlatCordBuilder {
       : region_(std::move(region)), inuse_(region_.size()) {}
 
   FlatCordBuilder(size_t size, size_t inuse)
-      : FlatCordBuilder(internal_os::AllocateHeapRegion(size), inuse) {}
+      : FlatCordBuilder(internal_os::AcquirePooledHeapRegion(size), inuse) {}
 
   FlatCordBuilder(internal_os::MemoryRegion region, size_t inuse)
       : region_(std::move(region)), inuse_(inuse) {
@@ -16,6 +16,10 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <string>
 #include <utility>
 
 #include "absl/container/fixed_array.h"
@@ -203,6 +207,85 @@ void PartitionIndexTransformIterator::ApplyStridedSet(size_t i) {
   strided_next_position_[set_i] = restricted_domain.exclusive_max();
 }
 
+namespace {
+
+// Returns the allocation size of a transform representation with the given
+// capacities, matching the layout used by `TransformRep::Allocate`.
+size_t CellTransformAllocationSize(DimensionIndex input_rank_capacity,
+                                   DimensionIndex output_rank_capacity) {
+  return sizeof(internal_index_space::TransformRep) +
+         sizeof(internal_index_space::OutputIndexMap) * output_rank_capacity +
+         input_rank_capacity * (sizeof(Index) * 2 + sizeof(std::string));
+}
+
+}  // namespace
+
+PartitionedGridCellBatch::~PartitionedGridCellBatch() {
+  for (Cell& cell : cells_) {
+    auto* rep = cell.cell_transform;
+    // No owned references to the cell transforms may remain; otherwise the
+    // arena-allocated representation would be freed via `TransformRep::Free`
+    // when the last reference is released.
+    assert(rep->reference_count.load(std::memory_order_acquire) == 1);
+    std::destroy_n(rep->input_labels().begin(), rep->input_rank_capacity);
+    std::destroy_n(rep->output_index_maps().begin(), rep->output_rank_capacity);
+    arena_->deallocate(
+        reinterpret_cast<unsigned char*>(rep->output_index_maps().data()),
+        CellTransformAllocationSize(rep->input_rank_capacity,
+                                    rep->output_rank_capacity),
+        alignof(internal_index_space::TransformRep));
+    arena_->deallocate(const_cast<Index*>(cell.grid_cell_indices), grid_rank_);
+  }
+}
+
+void PartitionedGridCellBatch::AppendCell(
+    tensorstore::span<const Index> grid_cell_indices,
+    internal_index_space::TransformRep* cell_transform) {
+  grid_rank_ = grid_cell_indices.size();
+  Index* indices = arena_->allocate<Index>(grid_rank_);
+  std::copy_n(grid_cell_indices.begin(), grid_rank_, indices);
+
+  // Copy `cell_transform` into an arena allocation with the same layout as
+  // `TransformRep::Allocate`: the output index map array precedes the header,
+  // which is followed by the input origin, shape, and label arrays.
+  const DimensionIndex input_rank = cell_transform->input_rank;
+  const DimensionIndex output_rank = cell_transform->output_rank;
+  unsigned char* base_ptr = arena_->allocate(
+      CellTransformAllocationSize(input_rank, output_rank),
+      alignof(internal_index_space::TransformRep));
+  auto* rep = new (base_ptr + sizeof(internal_index_space::OutputIndexMap) *
+                                  output_rank)
+      internal_index_space::TransformRep;
+  rep->reference_count.store(1, std::memory_order_relaxed);
+  rep->input_rank_capacity = input_rank;
+  rep->output_rank_capacity = output_rank;
+  std::uninitialized_default_construct_n(rep->output_index_maps().begin(),
+                                         output_rank);
+  std::uninitialized_default_construct_n(rep->input_labels().begin(),
+                                         input_rank);
+  internal_index_space::CopyTransformRep(cell_transform, rep);
+  cells_.push_back(Cell{indices, rep});
+}
+
+absl::Status PartitionIndexTransformOverGridBatched(
+    tensorstore::span<const DimensionIndex> grid_output_dimensions,
+    OutputToGridCellFn output_to_grid_cell, IndexTransformView<> transform,
+    PartitionedGridCellBatch& batch) {
+  IndexTransformGridPartition partition_info;
+  TENSORSTORE_RETURN_IF_ERROR(PrePartitionIndexTransformOverGrid(
+      transform, grid_output_dimensions, output_to_grid_cell, partition_info));
+  PartitionIndexTransformIterator iterator(std::move(partition_info),
+                                           grid_output_dimensions,
+                                           output_to_grid_cell, transform);
+  while (!iterator.AtEnd()) {
+    batch.AppendCell(
+        iterator.output_grid_cell_indices(),
+        internal_index_space::TransformAccess::rep(iterator.cell_transform()));
+    iterator.Advance();
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace internal_grid_partition
 namespace internal {
 
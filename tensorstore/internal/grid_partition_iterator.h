@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include <cassert>
+#include <vector>
 
 #include "absl/container/fixed_array.h"
 #include "absl/container/inlined_vector.h"
@@ -28,6 +29,7 @@
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/internal/transform_rep.h"
+#include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/grid_partition_impl.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/span.h"
@@ -133,6 +135,74 @@ class PartitionIndexTransformIterator {
   absl::FixedArray<Index, internal::kNumInlinedDims> strided_next_position_;
 };
 
+/// Full set of grid cells produced by
+/// `PartitionIndexTransformOverGridBatched`.
+///
+/// The grid cell index vectors and cell transform representations for all
+/// cells are allocated from the `Arena` supplied to the constructor, rather
+/// than individually on the heap; only views are handed out.  The views remain
+/// valid until the batch is destroyed; owned references to the cell transforms
+/// must not be retained past the lifetime of the batch.  The arena must
+/// outlive the batch.
+class PartitionedGridCellBatch {
+ public:
+  explicit PartitionedGridCellBatch(internal::Arena* arena)
+      : arena_(arena), cells_(arena) {}
+  ~PartitionedGridCellBatch();
+
+  PartitionedGridCellBatch(const PartitionedGridCellBatch&) = delete;
+  PartitionedGridCellBatch& operator=(const PartitionedGridCellBatch&) =
+      delete;
+
+  /// Returns the number of grid cells.
+  size_t num_cells() const { return cells_.size(); }
+
+  /// Returns the grid cell index vector `h` for cell `i`.
+  tensorstore::span<const Index> grid_cell_indices(size_t i) const {
+    return {cells_[i].grid_cell_indices, grid_rank_};
+  }
+
+  /// Returns the cell transform for cell `i`.
+  IndexTransformView<> cell_transform(size_t i) const {
+    return internal_index_space::TransformAccess::Make<IndexTransformView<>>(
+        cells_[i].cell_transform);
+  }
+
+ private:
+  friend absl::Status PartitionIndexTransformOverGridBatched(
+      tensorstore::span<const DimensionIndex> grid_output_dimensions,
+      OutputToGridCellFn output_to_grid_cell, IndexTransformView<> transform,
+      PartitionedGridCellBatch& batch);
+
+  struct Cell {
+    const Index* grid_cell_indices;
+    internal_index_space::TransformRep* cell_transform;
+  };
+
+  // Appends a cell, copying `grid_cell_indices` and `cell_transform` into
+  // arena-allocated storage.
+  void AppendCell(tensorstore::span<const Index> grid_cell_indices,
+                  internal_index_space::TransformRep* cell_transform);
+
+  internal::Arena* arena_;
+  DimensionIndex grid_rank_ = 0;
+  std::vector<Cell, internal::ArenaAllocator<Cell>> cells_;
+};
+
+/// Same as `internal::PartitionIndexTransformOverGrid`, but computes the full
+/// set of grid cells in a single pass and records them in `batch`, rather than
+/// invoking a callback with a transient `cell_transform` for each cell.
+///
+/// Because every cell transform is copied into storage allocated from the
+/// arena associated with `batch`, this avoids the per-cell heap allocations
+/// that `PartitionIndexTransformOverGrid` incurs when the caller retains each
+/// `cell_transform`, at the cost of holding all cell transforms in memory at
+/// once.
+absl::Status PartitionIndexTransformOverGridBatched(
+    tensorstore::span<const DimensionIndex> grid_output_dimensions,
+    OutputToGridCellFn output_to_grid_cell, IndexTransformView<> transform,
+    PartitionedGridCellBatch& batch);
+
 }  // namespace internal_grid_partition
 namespace internal {
 
@@ -14,6 +14,8 @@
 
 #include "tensorstore/internal/grid_partition_iterator.h"
 
+#include <stddef.h>
+
 #include <utility>
 #include <vector>
 
@@ -25,6 +27,7 @@
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/index_space/index_transform_builder.h"
+#include "tensorstore/internal/arena.h"
 #include "tensorstore/internal/grid_partition_impl.h"
 #include "tensorstore/internal/regular_grid.h"
 #include "tensorstore/util/result.h"
@@ -93,6 +96,30 @@ std::vector<R> GetPartitions(
   return results;
 }
 
+/// Checks that `PartitionIndexTransformOverGridBatched` produces the same
+/// partitions as `PartitionIndexTransformOverGrid`.
+void ExpectBatchedPartitionsMatch(
+    const std::vector<DimensionIndex>& grid_output_dimensions,
+    const std::vector<Index>& grid_cell_shape, IndexTransformView<> transform) {
+  const auto expected =
+      GetPartitions(grid_output_dimensions, grid_cell_shape, transform);
+
+  RegularGridRef grid{grid_cell_shape};
+  tensorstore::internal::Arena arena;
+  tensorstore::internal_grid_partition::PartitionedGridCellBatch batch(&arena);
+  TENSORSTORE_CHECK_OK(
+      tensorstore::internal_grid_partition::
+          PartitionIndexTransformOverGridBatched(grid_output_dimensions, grid,
+                                                 transform, batch));
+  ASSERT_EQ(expected.size(), batch.num_cells());
+  for (size_t i = 0; i < batch.num_cells(); ++i) {
+    EXPECT_THAT(batch.grid_cell_indices(i),
+                ::testing::ElementsAreArray(expected[i].first))
+        << "i=" << i;
+    EXPECT_EQ(expected[i].second, batch.cell_transform(i)) << "i=" << i;
+  }
+}
+
 std::vector<R> GetPartitionsManual(
     const std::vector<DimensionIndex>& grid_output_dimensions,
     const std::vector<Index>& grid_cell_shape, IndexTransformView<> transform) {
@@ -696,4 +723,37 @@ TEST(PartitionIndexTransformOverRegularGrid,
                 .value()}));
 }
 
+TEST(PartitionIndexTransformOverGridBatched, TwoDimensionalIdentity) {
+  ExpectBatchedPartitionsMatch({0, 1}, {20, 10},
+                               IndexTransformBuilder<>(2, 2)
+                                   .input_origin({0, 0})
+                                   .input_shape({30, 30})
+                                   .output_identity_transform()
+                                   .Finalize()
+                                   .value());
+}
+
+TEST(PartitionIndexTransformOverGridBatched, IndexArrayAndStridedDimensions) {
+  ExpectBatchedPartitionsMatch(
+      {0, 1}, {10, 8},
+      IndexTransformBuilder<>(2, 2)
+          .input_origin({-4, 100})
+          .input_shape({6, 3})
+          .output_index_array(0, 0, 1, MakeArray<Index>({{5}, {15}, {15}, {15},
+                                                         {25}, {30}}))
+          .output_single_input_dimension(1, 1)
+          .Finalize()
+          .value());
+}
+
+TEST(PartitionIndexTransformOverGridBatched, EmptyDomain) {
+  ExpectBatchedPartitionsMatch({0}, {10},
+                               IndexTransformBuilder<>(1, 1)
+                                   .input_origin({0})
+                                   .input_shape({0})
+                                   .output_identity_transform()
+                                   .Finalize()
+                                   .value());
+}
+
 }  // namespace
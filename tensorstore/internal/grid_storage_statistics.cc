@@ -16,6 +16,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <limits>
@@ -63,55 +64,118 @@ namespace {
 
 using ::tensorstore::kvstore::ListEntry;
 
-template <typename T>
-struct MovableAtomic : public std::atomic<T> {
-  using std::atomic<T>::atomic;
-  MovableAtomic(MovableAtomic&& other) noexcept {
-    this->store(other.load(std::memory_order_relaxed),
-                std::memory_order_relaxed);
+// Maximum number of concurrent `List` operations issued for a single chunk
+// key range.
+constexpr Index kMaxParallelListShards = 16;
+
+// Minimum number of chunks per `List` operation when splitting a chunk key
+// range across multiple concurrent `List` operations.
+constexpr Index kMinChunksPerListShard = 65536;
+
+// State shared by the (possibly multiple) `List` operations issued for a
+// single chunk key range.  The number of chunks seen is aggregated across
+// all of the `List` operations, and the check for missing chunks is
+// performed once the last one completes.
+struct ShardedListState
+    : public internal::AtomicReferenceCount<ShardedListState> {
+  internal::IntrusivePtr<GridStorageStatisticsChunkHandler> handler;
+  Box<> grid_bounds;
+  std::atomic<int64_t> total_chunks_seen{0};
+  std::atomic<int64_t> remaining_lists{0};
+
+  void ListDone() {
+    if (--remaining_lists != 0) return;
+    if (grid_bounds.num_elements() !=
+        total_chunks_seen.load(std::memory_order_relaxed)) {
+      handler->state->ChunkMissing();
+    }
   }
 };
 
 struct ListReceiver {
-  internal::IntrusivePtr<GridStorageStatisticsChunkHandler> handler;
-  Box<> grid_bounds;
-  MovableAtomic<int64_t> total_chunks_seen{0};
+  internal::IntrusivePtr<ShardedListState> state;
   FutureCallbackRegistration cancel_registration;
 
   template <typename Cancel>
   void set_starting(Cancel cancel) {
     cancel_registration =
-        handler->state->promise.ExecuteWhenNotNeeded(std::move(cancel));
+        state->handler->state->promise.ExecuteWhenNotNeeded(std::move(cancel));
   }
 
   void set_stopping() { cancel_registration.Unregister(); }
 
-  void set_done() {
-    if (grid_bounds.num_elements() !=
-        total_chunks_seen.load(std::memory_order_relaxed)) {
-      handler->state->ChunkMissing();
-    }
-  }
+  void set_done() { state->ListDone(); }
 
   void set_value(ListEntry entry) {
+    auto& handler = *state->handler;
     Index grid_indices[kMaxRank];
-    const DimensionIndex rank = handler->grid_output_dimensions.size();
+    const DimensionIndex rank = handler.grid_output_dimensions.size();
     tensorstore::span<Index> grid_indices_span(&grid_indices[0], rank);
-    if (!handler->key_formatter->ParseKey(entry.key, grid_indices_span) ||
-        !Contains(grid_bounds,
+    if (!handler.key_formatter->ParseKey(entry.key, grid_indices_span) ||
+        !Contains(state->grid_bounds,
                   tensorstore::span<const Index>(grid_indices_span))) {
       return;
     }
-    ++total_chunks_seen;
+    ++state->total_chunks_seen;
 
-    handler->ChunkPresent(grid_indices_span);
+    handler.ChunkPresent(grid_indices_span);
   }
 
   void set_error(absl::Status error) {
-    handler->state->SetError(std::move(error));
+    state->handler->state->SetError(std::move(error));
   }
 };
 
+// Splits `key_range` into up to `kMaxParallelListShards` sub-ranges at keys
+// formatted from evenly-spaced grid indices along the first varying grid
+// dimension of `grid_bounds`.
+//
+// Any interior key is a valid partition point of a key range, so the
+// resulting sub-ranges tile `key_range` regardless of whether formatted keys
+// are lexicographically ordered by grid index; split points that fall
+// outside `key_range` are simply skipped, merging adjacent shards.
+std::vector<KeyRange> SplitKeyRangeForParallelList(
+    KeyRange key_range, BoxView<> grid_bounds,
+    const LexicographicalGridIndexKeyParser& key_formatter,
+    Index total_chunks) {
+  std::vector<KeyRange> ranges;
+  DimensionIndex split_dim = 0;
+  while (split_dim < grid_bounds.rank() &&
+         grid_bounds.shape()[split_dim] == 1) {
+    ++split_dim;
+  }
+  Index num_shards = 1;
+  if (split_dim < grid_bounds.rank()) {
+    num_shards = std::min({kMaxParallelListShards,
+                           grid_bounds.shape()[split_dim],
+                           total_chunks / kMinChunksPerListShard});
+  }
+  if (num_shards <= 1) {
+    ranges.push_back(std::move(key_range));
+    return ranges;
+  }
+  const IndexInterval interval = grid_bounds[split_dim];
+  Index grid_indices[kMaxRank];
+  std::copy_n(grid_bounds.origin().begin(), split_dim + 1, &grid_indices[0]);
+  std::string start = key_range.inclusive_min;
+  for (Index i = 1; i < num_shards; ++i) {
+    grid_indices[split_dim] =
+        interval.inclusive_min() + interval.size() / num_shards * i;
+    std::string split_key = key_formatter.FormatKey(
+        tensorstore::span<const Index>(&grid_indices[0], split_dim + 1));
+    if (split_key <= start ||
+        (!key_range.exclusive_max.empty() &&
+         split_key >= key_range.exclusive_max)) {
+      continue;
+    }
+    ranges.push_back(KeyRange(std::move(start), split_key));
+    start = std::move(split_key);
+  }
+  ranges.push_back(
+      KeyRange(std::move(start), std::move(key_range.exclusive_max)));
+  return ranges;
+}
+
 }  // namespace
 
 GridStorageStatisticsChunkHandler::~GridStorageStatisticsChunkHandler() =
@@ -217,11 +281,24 @@ void GetStorageStatisticsForRegularGridWithSemiLexicographicalKeys(
       return absl::OutOfRangeError(
           "Integer overflow computing number of chunks");
     }
-    kvstore::ListOptions list_options;
-    list_options.staleness_bound = staleness_bound;
-    list_options.range = std::move(key_range);
-    kvstore::List(kvs, std::move(list_options),
-                  ListReceiver{handler, Box<>(grid_bounds)});
+    auto shared_state = internal::MakeIntrusivePtr<ShardedListState>();
+    shared_state->handler = handler;
+    shared_state->grid_bounds = Box<>(grid_bounds);
+    // Large ranges are listed by multiple concurrent `List` operations over
+    // sub-ranges of the key range, which is much faster on high-latency
+    // kvstores.
+    auto ranges = SplitKeyRangeForParallelList(
+        std::move(key_range), grid_bounds, *handler->key_formatter,
+        cur_total_chunks);
+    shared_state->remaining_lists.store(static_cast<int64_t>(ranges.size()),
+                                        std::memory_order_relaxed);
+    for (auto& range : ranges) {
+      kvstore::ListOptions list_options;
+      list_options.staleness_bound = staleness_bound;
+      list_options.range = std::move(range);
+      kvstore::List(kvs, std::move(list_options),
+                    ListReceiver{shared_state});
+    }
     return absl::OkStatus();
   };
 
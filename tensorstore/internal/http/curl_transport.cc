@@ -45,12 +45,14 @@
 #include "tensorstore/internal/container/circular_queue.h"
 #include "tensorstore/internal/cord_util.h"
 #include "tensorstore/internal/env.h"
+#include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/internal/http/curl_factory.h"
 #include "tensorstore/internal/http/curl_handle.h"
 #include "tensorstore/internal/http/curl_wrappers.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_transport.h"
 #include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/tracing/trace_recorder.h"
 #include "tensorstore/internal/metrics/gauge.h"
 #include "tensorstore/internal/metrics/histogram.h"
 #include "tensorstore/internal/metrics/metadata.h"
@@ -126,6 +128,11 @@ uint32_t GetHttpThreads() {
                           .value_or(4u));
 }
 
+// Size of the curl receive buffer (CURLOPT_BUFFERSIZE), and of the flat
+// blocks into which the response body is accumulated before being adopted
+// into the response cord.
+constexpr size_t kCurlBufferSize = 512 * 1024;
+
 struct CurlRequestState {
   std::shared_ptr<CurlHandleFactory> factory_;
   CurlHandle handle_;
@@ -135,6 +142,7 @@ struct CurlRequestState {
   size_t payload_remaining_;
   HttpResponseHandler* response_handler_ = nullptr;
   size_t response_payload_size_ = 0;
+  std::optional<internal::FlatCordBuilder> response_buffer_;
   bool status_set = false;
   char error_buffer_[CURL_ERROR_SIZE];
 
@@ -147,7 +155,8 @@ struct CurlRequestState {
     // CURLOPT_SSL_VERIFYPEER CURLOPT_SSL_VERIFYHOST
 
     // Use a 512k buffer.
-    handle_.SetOption(CURLOPT_BUFFERSIZE, 512 * 1024);
+    handle_.SetOption(CURLOPT_BUFFERSIZE,
+                      static_cast<long>(kCurlBufferSize));
     handle_.SetOption(CURLOPT_TCP_NODELAY, 1L);
 
     handle_.SetOption(CURLOPT_WRITEDATA, this);
@@ -297,16 +306,56 @@ struct CurlRequestState {
     return data.size();
   }
 
+  // Allocates a flat block for the response body.  The first block of a
+  // response with a known Content-Length smaller than `kCurlBufferSize` is
+  // sized to the remaining payload to avoid over-allocation.
+  void AllocateResponseBuffer(size_t pending) {
+    size_t capacity = kCurlBufferSize;
+    curl_off_t content_length = -1;
+    handle_.GetInfo(CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
+    if (content_length >= 0 &&
+        static_cast<size_t>(content_length) > response_payload_size_) {
+      size_t remaining =
+          static_cast<size_t>(content_length) - response_payload_size_;
+      capacity = std::min(capacity, std::max(remaining, pending));
+    }
+    response_buffer_.emplace(std::max(capacity, pending), 0);
+  }
+
+  // Hands any accumulated response body to the handler.  The flat block is
+  // adopted into a cord without copying; a partially-filled block is
+  // trimmed by adjusting the external node rather than reallocating.
+  void FlushResponseBody() {
+    if (!response_buffer_) return;
+    const size_t capacity = response_buffer_->size();
+    const size_t used = capacity - response_buffer_->available();
+    absl::Cord chunk = std::move(*response_buffer_).Build();
+    response_buffer_ = std::nullopt;
+    if (used == 0) return;
+    chunk.RemoveSuffix(capacity - used);
+    response_handler_->OnResponseCordBody(std::move(chunk));
+  }
+
   static size_t CurlWriteCallback(void* contents, size_t size, size_t nmemb,
                                   void* userdata) {
     auto* self = static_cast<CurlRequestState*>(userdata);
     auto data =
         std::string_view(static_cast<char const*>(contents), size * nmemb);
-    if (self->MaybeSetStatusAndProcess()) {
-      self->response_payload_size_ += data.size();
-      self->response_handler_->OnResponseBody(data);
+    if (!self->MaybeSetStatusAndProcess()) return data.size();
+    const size_t n = data.size();
+    while (!data.empty()) {
+      if (self->response_buffer_ && self->response_buffer_->available() == 0) {
+        self->FlushResponseBody();
+      }
+      if (!self->response_buffer_) {
+        self->AllocateResponseBuffer(data.size());
+      }
+      size_t c = std::min(data.size(), self->response_buffer_->available());
+      self->response_buffer_->Append(data.substr(0, c));
+      self->response_payload_size_ += c;
+      data.remove_prefix(c);
     }
-    return data.size();
+    return n;
   }
 
   static size_t CurlReadCallback(void* contents, size_t size, size_t nmemb,
@@ -461,6 +510,11 @@ void MultiTransportImpl::FinishRequest(std::unique_ptr<CurlRequestState> state,
     curl_off_t total_time_us = 0;
     state->handle_.GetInfo(CURLINFO_TOTAL_TIME_T, &total_time_us);
     http_total_time_ms.Observe(total_time_us / 1000);
+    if (internal_tracing::TraceRecordingEnabled()) {
+      const absl::Duration total_time = absl::Microseconds(total_time_us);
+      internal_tracing::RecordTraceEvent("HttpRequest",
+                                         absl::Now() - total_time, total_time);
+    }
   }
 
   if (code != CURLE_OK) {
@@ -472,6 +526,7 @@ void MultiTransportImpl::FinishRequest(std::unique_ptr<CurlRequestState> state,
 
   http_response_codes.Increment(state->handle_.GetResponseCode());
   assert(state->status_set);
+  state->FlushResponseBody();
   state->response_handler_->OnComplete();
 }
 
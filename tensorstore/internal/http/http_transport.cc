@@ -18,13 +18,17 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string>
 #include <string_view>
 #include <utility>
 
 #include "absl/base/attributes.h"
+#include "absl/base/no_destructor.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
 #include "riegeli/bytes/cord_writer.h"
 #include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
@@ -50,6 +54,7 @@ class LegacyHttpResponseHandler : public HttpResponseHandler {
   void OnStatus(int32_t status_code) override;
   void OnResponseHeader(std::string_view data) override;
   void OnResponseBody(std::string_view data) override;
+  void OnResponseCordBody(absl::Cord data) override;
   void OnComplete() override;
 
  private:
@@ -79,6 +84,11 @@ void LegacyHttpResponseHandler::OnResponseBody(std::string_view data) {
   writer_.Write(data);
 }
 
+void LegacyHttpResponseHandler::OnResponseCordBody(absl::Cord data) {
+  // Appends by reference; the transport-owned blocks are not copied.
+  writer_.Write(std::move(data));
+}
+
 void LegacyHttpResponseHandler::OnFailure(absl::Status status) {
   ABSL_LOG_IF(INFO, verbose.Level(1)) << status;
   promise_.SetResult(std::move(status));
@@ -105,5 +115,31 @@ Future<HttpResponse> HttpTransport::IssueRequest(const HttpRequest& request,
   return std::move(pair.future);
 }
 
+void HttpTransport::PreWarmConnections(std::string_view base_url,
+                                       size_t num_connections) {
+  ABSL_LOG_IF(INFO, verbose)
+      << "Pre-warming " << num_connections << " connections to " << base_url;
+  auto request =
+      HttpRequestBuilder("HEAD", std::string(base_url)).BuildRequest();
+  for (size_t i = 0; i < num_connections; ++i) {
+    // The response (and any error) is irrelevant; the callback merely keeps
+    // the request alive until it completes.
+    IssueRequest(request, IssueRequestOptions{})
+        .ExecuteWhenReady([](ReadyFuture<HttpResponse>) {});
+  }
+}
+
+void PreWarmConnectionsOnce(HttpTransport& transport,
+                            std::string_view base_url,
+                            size_t num_connections) {
+  static absl::NoDestructor<absl::Mutex> mutex;
+  static absl::NoDestructor<absl::flat_hash_set<std::string>> warmed;
+  {
+    absl::MutexLock lock(&*mutex);
+    if (!warmed->emplace(base_url).second) return;
+  }
+  transport.PreWarmConnections(base_url, num_connections);
+}
+
 }  // namespace internal_http
 }  // namespace tensorstore
@@ -15,6 +15,7 @@
 #ifndef TENSORSTORE_INTERNAL_HTTP_HTTP_TRANSPORT_H_
 #define TENSORSTORE_INTERNAL_HTTP_HTTP_TRANSPORT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <string_view>
@@ -81,6 +82,15 @@ class HttpResponseHandler {
   virtual void OnResponseHeader(std::string_view data) = 0;
   // Raw body content is available. May be called multiple times.
   virtual void OnResponseBody(std::string_view data) = 0;
+  // Raw body content is available as a cord whose blocks may be adopted
+  // without copying. May be called multiple times, interleaved with
+  // `OnResponseBody`.  The default implementation forwards each chunk to
+  // `OnResponseBody`.
+  virtual void OnResponseCordBody(absl::Cord data) {
+    for (std::string_view chunk : data.Chunks()) {
+      OnResponseBody(chunk);
+    }
+  }
   // Request has completed with the provided http status code.
   virtual void OnComplete() = 0;
   // TODO: GetStopToken()
@@ -103,8 +113,23 @@ class HttpTransport {
   virtual void IssueRequestWithHandler(
       const HttpRequest& request, IssueRequestOptions options,
       HttpResponseHandler* response_handler) = 0;
+
+  /// Issues `num_connections` concurrent HEAD requests to `base_url`,
+  /// discarding the responses.  This resolves DNS and establishes pooled
+  /// connections (including TLS handshakes) ahead of the first real
+  /// request; with HTTP/2 multiplexing fewer than `num_connections`
+  /// connections may result.
+  void PreWarmConnections(std::string_view base_url, size_t num_connections);
 };
 
+/// Invokes `transport.PreWarmConnections(base_url, num_connections)` the
+/// first time it is called for `base_url` in this process; subsequent calls
+/// for the same URL are no-ops.  Intended for use when binding context
+/// resources, which may happen many times for the same endpoint.
+void PreWarmConnectionsOnce(HttpTransport& transport,
+                            std::string_view base_url,
+                            size_t num_connections);
+
 }  // namespace internal_http
 }  // namespace tensorstore
 
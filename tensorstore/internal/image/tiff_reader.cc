@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #include <algorithm>
@@ -56,7 +57,8 @@ struct TiffReader::Context : public LibTiffErrorBase {
   absl::Status ExtractErrors(absl::Status in);
 
   absl::Status Open();
-  absl::Status DefaultDecode(tensorstore::span<unsigned char> data);
+  absl::Status DefaultDecode(tensorstore::span<unsigned char> data,
+                             const TiffReaderOptions& options);
 };
 
 namespace {
@@ -258,9 +260,12 @@ absl::Status GetTIFFImageInfo(TIFF* tiff, TiffImageInfo& info) {
   return absl::OkStatus();
 }
 
-absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info,
+absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info, int32_t row_begin,
+                           int32_t row_end,
                            tensorstore::span<unsigned char> data) {
-  ImageView dest_view(info, data);
+  TiffImageInfo dest_info = info;
+  dest_info.height = row_end - row_begin;
+  ImageView dest_view(dest_info, data);
 
   // Translate 1,2,4 bits per sample to 8-bpp images.
   const unsigned char* mapping = nullptr;
@@ -277,7 +282,7 @@ absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info,
   uint32_t rows_per_strip = 1;
   TIFFGetFieldDefaulted(tiff, TIFFTAG_ROWSPERSTRIP, &rows_per_strip);
 
-  if (!mapping &&
+  if (!mapping && row_begin == 0 && row_end == info.height &&
       strip_bytes == rows_per_strip * dest_view.row_stride_bytes()) {
     /// No extra data && no mapping means that the TIFF can be read directly
     /// into the output buffer.
@@ -295,8 +300,14 @@ absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info,
   std::unique_ptr<unsigned char[]> buffer(new unsigned char[strip_bytes]);
   uint32_t line_bytes =
       info.width * (info.bits_per_sample_ / 8) * info.num_components;
-
-  for (size_t y = 0; y < info.height; y += rows_per_strip) {
+  // Number of source bytes consumed per row when translating sub-byte
+  // samples.
+  const ptrdiff_t packed_line_bytes =
+      (dest_view.row_stride_bytes() + trstride - 1) / trstride;
+
+  // Only the strips intersecting `[row_begin, row_end)` are decoded.
+  for (int64_t y = row_begin - (row_begin % rows_per_strip); y < row_end;
+       y += rows_per_strip) {
     // Read the strip.
     if (TIFFReadEncodedStrip(tiff, TIFFComputeStrip(tiff, y, 0), buffer.get(),
                              strip_bytes) == -1) {
@@ -304,9 +315,16 @@ absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info,
     }
 
     unsigned char* source_row = buffer.get();
-    for (size_t r = 0; r < rows_per_strip; r++) {
-      if (y + r >= info.height) break;
-      auto target_row = dest_view.data_row(y + r);
+    for (int64_t r = 0; r < rows_per_strip; r++) {
+      const int64_t image_y = y + r;
+      if (image_y >= row_end || image_y >= info.height) break;
+      if (image_y < row_begin) {
+        // Row precedes the requested range within the first strip.
+        source_row +=
+            (info.bits_per_sample_ >= 8) ? line_bytes : packed_line_bytes;
+        continue;
+      }
+      auto target_row = dest_view.data_row(image_y - row_begin);
 
       if (info.bits_per_sample_ >= 8) {
         assert(line_bytes == dest_view.row_stride_bytes());
@@ -325,9 +343,12 @@ absl::Status ReadStripImpl(TIFF* tiff, TiffImageInfo& info,
   return absl::OkStatus();
 }
 
-absl::Status ReadTiledImpl(TIFF* tiff, TiffImageInfo& info,
+absl::Status ReadTiledImpl(TIFF* tiff, TiffImageInfo& info, int32_t row_begin,
+                           int32_t row_end,
                            tensorstore::span<unsigned char> data) {
-  ImageView dest_view(info, data);
+  TiffImageInfo dest_info = info;
+  dest_info.height = row_end - row_begin;
+  ImageView dest_view(dest_info, data);
 
   // Translate 1,2,4 bits per sample to 8-bpp images.
   const unsigned char* mapping = nullptr;
@@ -351,14 +372,18 @@ absl::Status ReadTiledImpl(TIFF* tiff, TiffImageInfo& info,
                                 /*.num_components=*/info.num_components},
                       {tile_buffer.get(), tile_bytes});
 
-  for (size_t y = 0; y < info.height; y += tile_height) {
+  // Only the rows of tiles intersecting `[row_begin, row_end)` are decoded.
+  for (int64_t y = row_begin - (row_begin % tile_height); y < row_end;
+       y += tile_height) {
     for (size_t x = 0; x < info.width; x += tile_width) {
       if (TIFFReadTile(tiff, tile_buffer.get(), x, y, 0, 0) == -1) {
         return absl::DataLossError("TIFF read tile failed");
       }
-      for (size_t y1 = 0; y1 < tile_height; y1++) {
-        if ((y + y1) >= info.height) break;
-        auto target_row = dest_view.data_row(y + y1, x);
+      for (int64_t y1 = 0; y1 < tile_height; y1++) {
+        const int64_t image_y = y + y1;
+        if (image_y >= row_end || image_y >= info.height) break;
+        if (image_y < row_begin) continue;
+        auto target_row = dest_view.data_row(image_y - row_begin, x);
         auto tile_row = tile_view.data_row(y1);
         if (info.bits_per_sample_ >= 8) {
           memcpy(target_row.data(), tile_row.data(),
@@ -424,10 +449,24 @@ absl::Status TiffReader::Context::Open() {
 }
 
 absl::Status TiffReader::Context::DefaultDecode(
-    tensorstore::span<unsigned char> data) {
+    tensorstore::span<unsigned char> data, const TiffReaderOptions& options) {
   TiffImageInfo info;
   TENSORSTORE_RETURN_IF_ERROR(GetTIFFImageInfo(tiff_, info));
-  ABSL_CHECK_EQ(data.size(), ImageRequiredBytes(info));
+
+  const int32_t row_begin = options.row_begin;
+  const int32_t row_end =
+      options.row_end == -1 ? info.height : options.row_end;
+  if (row_begin < 0 || row_begin >= row_end || row_end > info.height) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("TIFF read failed: invalid row range [%d, %d) for "
+                        "image of height %d",
+                        options.row_begin, options.row_end, info.height));
+  }
+  {
+    TiffImageInfo dest_info = info;
+    dest_info.height = row_end - row_begin;
+    ABSL_CHECK_EQ(data.size(), ImageRequiredBytes(dest_info));
+  }
 
   // Additional fields checks (beyond the info)
   uint32_t compress_tag = 0;
@@ -476,9 +515,9 @@ absl::Status TiffReader::Context::DefaultDecode(
 
   absl::Status status;
   if (TIFFIsTiled(tiff_)) {
-    status = ReadTiledImpl(tiff_, info, data);
+    status = ReadTiledImpl(tiff_, info, row_begin, row_end, data);
   } else {
-    status = ReadStripImpl(tiff_, info, data);
+    status = ReadStripImpl(tiff_, info, row_begin, row_end, data);
   }
 
   return ExtractErrors(status);
@@ -534,7 +573,7 @@ absl::Status TiffReader::DecodeImpl(tensorstore::span<unsigned char> dest,
   if (!context_) {
     return absl::InternalError("No TIFF file to decode");
   }
-  return context_->DefaultDecode(dest);
+  return context_->DefaultDecode(dest, options);
 }
 
 }  // namespace internal_image
@@ -15,6 +15,8 @@
 #ifndef TENSORSTORE_INTERNAL_IMAGE_TIFF_READER_H_
 #define TENSORSTORE_INTERNAL_IMAGE_TIFF_READER_H_
 
+#include <stdint.h>
+
 #include <memory>
 
 #include "absl/status/status.h"
@@ -26,7 +28,16 @@
 namespace tensorstore {
 namespace internal_image {
 
-struct TiffReaderOptions {};
+struct TiffReaderOptions {
+  /// Restricts decoding to the half-open row interval `[row_begin, row_end)`
+  /// of the image; a `row_end` of -1 indicates the full image height.  Only
+  /// the strips or tiles intersecting the interval are read and decoded, so
+  /// a small window read of a large striped or tiled image does not decode
+  /// the entire image.  When restricted, `dest` must be sized for the
+  /// restricted region rather than for the full image.
+  int32_t row_begin = 0;
+  int32_t row_end = -1;
+};
 
 class TiffReader : public ImageReader {
  public:
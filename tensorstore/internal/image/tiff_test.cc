@@ -43,6 +43,7 @@ namespace {
 
 using ::tensorstore::internal_image::ImageInfo;
 using ::tensorstore::internal_image::TiffReader;
+using ::tensorstore::internal_image::TiffReaderOptions;
 using ::tensorstore::internal_image::TiffWriter;
 using ::tensorstore::internal_image::TiffWriterOptions;
 
@@ -162,6 +163,45 @@ TEST_F(TiffTest, EncodeDecode) {
   }
 }
 
+TEST_F(TiffTest, DecodeRowRange) {
+  constexpr int kWidth = 8;
+  constexpr int kHeight = 16;
+  uint8_t pixels[kWidth * kHeight];
+  for (size_t i = 0; i < sizeof(pixels); i++) {
+    pixels[i] = static_cast<uint8_t>(i);
+  }
+
+  absl::Cord encoded;
+  {
+    riegeli::CordWriter riegeli_writer(&encoded);
+    TiffWriter encoder;
+    ASSERT_THAT(encoder.Initialize(&riegeli_writer, TiffWriterOptions{}),
+                ::tensorstore::IsOk());
+    ASSERT_THAT(encoder.Encode(ImageInfo{kHeight, kWidth, 1}, pixels),
+                ::tensorstore::IsOk());
+    ASSERT_THAT(encoder.Done(), ::tensorstore::IsOk());
+  }
+
+  TiffReader decoder;
+  riegeli::CordReader cord_reader(&encoded);
+  ASSERT_THAT(decoder.Initialize(&cord_reader), ::tensorstore::IsOk());
+
+  // Decode only rows [5, 11); strips outside the range are not read.
+  TiffReaderOptions options;
+  options.row_begin = 5;
+  options.row_end = 11;
+  uint8_t partial[kWidth * 6] = {};
+  ASSERT_THAT(decoder.Decode(partial, options), ::tensorstore::IsOk());
+  EXPECT_THAT(partial, ::testing::ElementsAreArray(
+                           tensorstore::span(pixels + 5 * kWidth, 6 * kWidth)));
+
+  // An invalid row range is rejected.
+  options.row_begin = 11;
+  options.row_end = 5;
+  EXPECT_THAT(decoder.Decode(partial, options),
+              tensorstore::MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
 TEST_F(TiffTest, ReadMultiPage) {
   absl::Cord file_data;
   {
@@ -14,11 +14,15 @@
 
 #include "tensorstore/internal/masked_array.h"
 
+#include <stdint.h>
+
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <memory>
 #include <utility>
 
+#include "absl/numeric/bits.h"
 #include "absl/status/status.h"
 #include "tensorstore/array.h"
 #include "tensorstore/box.h"
@@ -28,6 +32,7 @@
 #include "tensorstore/index_interval.h"
 #include "tensorstore/index_space/index_transform.h"
 #include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/broadcast_fill.h"
 #include "tensorstore/internal/elementwise_function.h"
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/nditerable_buffer_management.h"
@@ -122,6 +127,66 @@ void RemoveMaskArrayIfNotNeeded(MaskData* mask) {
     mask->mask_array.element_pointer() = {};
   }
 }
+
+/// Returns `true` if `array` refers to a single contiguous block of memory in
+/// some dimension order, with all strides positive.
+bool IsContiguousBlock(ArrayView<const void> array) {
+  const DimensionIndex rank = array.rank();
+  DimensionIndex order[kMaxRank];
+  for (DimensionIndex i = 0; i < rank; ++i) order[i] = i;
+  std::sort(order, order + rank, [&](DimensionIndex a, DimensionIndex b) {
+    return array.byte_strides()[a] > array.byte_strides()[b];
+  });
+  Index expected_stride = array.dtype()->size;
+  for (DimensionIndex i = rank - 1; i >= 0; --i) {
+    const DimensionIndex dim = order[i];
+    const Index size = array.shape()[dim];
+    if (size == 1) continue;
+    if (array.byte_strides()[dim] != expected_stride) return false;
+    expected_stride *= size;
+  }
+  return true;
+}
+
+/// ORs the `n` contiguous mask values at `b` into `a`, a word at a time, and
+/// returns the resulting number of `true` values in `a`.
+Index UnionMaskWords(bool* a, const bool* b, Index n) {
+  constexpr Index kWordBytes = sizeof(uint64_t);
+  Index num_masked = 0;
+  Index i = 0;
+  for (; i + kWordBytes <= n; i += kWordBytes) {
+    uint64_t word_a, word_b;
+    std::memcpy(&word_a, a + i, kWordBytes);
+    std::memcpy(&word_b, b + i, kWordBytes);
+    word_a |= word_b;
+    std::memcpy(a + i, &word_a, kWordBytes);
+    // Each byte of `word_a` is 0 or 1, so the popcount equals the number of
+    // `true` values.
+    num_masked += absl::popcount(word_a);
+  }
+  for (; i < n; ++i) {
+    num_masked += static_cast<Index>(a[i] |= b[i]);
+  }
+  return num_masked;
+}
+
+/// Sets the `n` contiguous mask values at `p` to `true`, and returns the
+/// number that were previously `false`.
+Index SetMaskWords(bool* p, Index n) {
+  constexpr Index kWordBytes = sizeof(uint64_t);
+  Index num_changed = n;
+  Index i = 0;
+  for (; i + kWordBytes <= n; i += kWordBytes) {
+    uint64_t word;
+    std::memcpy(&word, p + i, kWordBytes);
+    num_changed -= absl::popcount(word);
+  }
+  for (; i < n; ++i) {
+    num_changed -= static_cast<Index>(p[i]);
+  }
+  std::memset(p, 1, n);
+  return num_changed;
+}
 }  // namespace
 
 MaskData::MaskData(DimensionIndex rank) : region(rank) {
@@ -163,15 +228,24 @@ void UnionMasks(BoxView<> box, MaskData* mask_a, MaskData* mask_b,
   assert(mask_b->region.rank() == box.rank());
 
   if (mask_a->mask_array.valid() && mask_b->mask_array.valid()) {
-    Index num_masked_elements = 0;
-    IterateOverArrays(
-        [&](bool* a, bool* b) {
-          if ((*a |= *b) == true) {
-            ++num_masked_elements;
-          }
-        },
-        /*constraints=*/{}, mask_a->mask_array, mask_b->mask_array);
-    mask_a->num_masked_elements = num_masked_elements;
+    if (mask_a->mask_array.layout() == mask_b->mask_array.layout() &&
+        IsContiguousBlock(mask_a->mask_array)) {
+      // Identical dense layouts: the two arrays have the same linearization,
+      // so the union can be computed a word at a time.
+      mask_a->num_masked_elements =
+          UnionMaskWords(mask_a->mask_array.data(), mask_b->mask_array.data(),
+                         mask_a->mask_array.num_elements());
+    } else {
+      Index num_masked_elements = 0;
+      IterateOverArrays(
+          [&](bool* a, bool* b) {
+            if ((*a |= *b) == true) {
+              ++num_masked_elements;
+            }
+          },
+          /*constraints=*/{}, mask_a->mask_array, mask_b->mask_array);
+      mask_a->num_masked_elements = num_masked_elements;
+    }
     Hull(mask_a->region, mask_b->region, mask_a->region);
     RemoveMaskArrayIfNotNeeded(mask_a);
     return;
@@ -196,15 +270,47 @@ void UnionMasks(BoxView<> box, MaskData* mask_a, MaskData* mask_b,
   ByteStridedPointer<bool> start = mask_a->mask_array.data();
   start += GetRelativeOffset(box.origin(), mask_b->region.origin(),
                              mask_a->mask_array.byte_strides());
-  IterateOverArrays(
-      [&](bool* ptr) {
-        if (!*ptr) ++mask_a->num_masked_elements;
-        *ptr = true;
-      },
-      /*constraints=*/{},
-      ArrayView<bool>(start.get(),
-                      StridedLayoutView<>(mask_b->region.shape(),
-                                          mask_a->mask_array.byte_strides())));
+  const tensorstore::span<const Index> strides =
+      mask_a->mask_array.byte_strides();
+  const DimensionIndex rank = box.rank();
+  DimensionIndex inner_dim = -1;
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    if (strides[i] == 1) inner_dim = i;
+  }
+  if (inner_dim != -1) {
+    // Rows of the region along the contiguous dimension of the mask array can
+    // be set (and their previously-unset values counted) a word at a time.
+    Index outer_shape[kMaxRank], outer_strides[kMaxRank];
+    DimensionIndex outer_rank = 0;
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      if (i == inner_dim) continue;
+      outer_shape[outer_rank] = mask_b->region.shape()[i];
+      outer_strides[outer_rank] = strides[i];
+      ++outer_rank;
+    }
+    const Index row_length = mask_b->region.shape()[inner_dim];
+    IterateOverArrays(
+        [&](bool* ptr) {
+          mask_a->num_masked_elements += SetMaskWords(ptr, row_length);
+        },
+        /*constraints=*/{},
+        ArrayView<bool>(
+            start.get(),
+            StridedLayoutView<>(
+                tensorstore::span<const Index>(outer_shape, outer_rank),
+                tensorstore::span<const Index>(outer_strides, outer_rank))));
+  } else {
+    IterateOverArrays(
+        [&](bool* ptr) {
+          if (!*ptr) ++mask_a->num_masked_elements;
+          *ptr = true;
+        },
+        /*constraints=*/{},
+        ArrayView<bool>(start.get(),
+                        StridedLayoutView<>(
+                            mask_b->region.shape(),
+                            mask_a->mask_array.byte_strides())));
+  }
   Hull(mask_a->region, mask_b->region, mask_a->region);
   RemoveMaskArrayIfNotNeeded(mask_a);
 }
@@ -218,6 +324,17 @@ void RebaseMaskedArray(BoxView<> box, ArrayView<const void> source,
   if (mask.num_masked_elements == num_elements) return;
   DataType dtype = source.dtype();
   if (mask.num_masked_elements == 0) {
+    // Fast path: a constant source (e.g. a fill-value broadcast for an
+    // unmaterialized chunk) written to a contiguous destination reduces to a
+    // pattern fill.
+    const auto source_byte_strides = source.byte_strides();
+    if (num_elements > 0 && GetBroadcastFillCopyFunction(dtype) &&
+        std::all_of(source_byte_strides.begin(), source_byte_strides.end(),
+                    [](Index stride) { return stride == 0; }) &&
+        IsContiguousBlock(dest)) {
+      FillWithPattern(num_elements, dtype->size, source.data(), dest.data());
+      return;
+    }
     [[maybe_unused]] const auto success = internal::IterateOverArrays(
         {&dtype->copy_assign, /*context=*/nullptr},
         /*arg=*/nullptr, skip_repeated_elements, source, dest);
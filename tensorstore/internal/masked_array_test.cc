@@ -689,6 +689,58 @@ TEST(UnionMasksTest, MaskArrayAndMaskArrayEqualsMaskArray) {
   EXPECT_EQ(MakeArray<bool>({1, 0, 1, 1, 0}), tester.mask_array());
 }
 
+// Uses masks longer than one 8-byte word to exercise the word-at-a-time merge
+// path (including the partial final word).
+TEST(UnionMasksTest, MaskArrayAndMaskArrayWordAtATime) {
+  MaskedArrayWriteTester<int> tester{BoxView({17})};
+  MaskedArrayWriteTester<int> tester_b{BoxView({17})};
+
+  // Use MaskedArrayWriteTester::Write as a simple way to modify the mask.
+  TENSORSTORE_EXPECT_OK(tester.Write(
+      (tester.transform() |
+       Dims(0).IndexArraySlice(MakeArray<Index>({1, 3, 9, 15})))
+          .value(),
+      MakeArray({1, 2, 3, 4})));
+  EXPECT_TRUE(tester.mask_array().valid());
+  TENSORSTORE_EXPECT_OK(tester_b.Write(
+      (tester_b.transform() |
+       Dims(0).IndexArraySlice(MakeArray<Index>({0, 9, 16})))
+          .value(),
+      MakeArray({1, 2, 3})));
+  EXPECT_TRUE(tester_b.mask_array().valid());
+  tester.Combine(std::move(tester_b));
+
+  EXPECT_EQ(6, tester.num_masked_elements());
+  EXPECT_EQ(BoxView({17}), tester.mask_region());
+  EXPECT_EQ(MakeArray<bool>({1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+                             1}),
+            tester.mask_array());
+}
+
+// Merges a rectangular region into a mask array, with a row longer than one
+// 8-byte word to exercise the word-at-a-time set-and-count path.
+TEST(UnionMasksTest, MaskArrayAndNoMaskArrayWordAtATime) {
+  MaskedArrayWriteTester<int> tester{BoxView({17})};
+  MaskedArrayWriteTester<int> tester_b{BoxView({17})};
+
+  TENSORSTORE_EXPECT_OK(tester.Write(
+      (tester.transform() | Dims(0).IndexArraySlice(MakeArray<Index>({0, 16})))
+          .value(),
+      MakeArray({1, 2})));
+  EXPECT_TRUE(tester.mask_array().valid());
+  TENSORSTORE_EXPECT_OK(tester_b.Write(
+      (tester_b.transform() | Dims(0).TranslateSizedInterval(2, 12)).value(),
+      MakeArray({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12})));
+  EXPECT_FALSE(tester_b.mask_array().valid());
+  tester.Combine(std::move(tester_b));
+
+  EXPECT_EQ(14, tester.num_masked_elements());
+  EXPECT_EQ(BoxView({17}), tester.mask_region());
+  EXPECT_EQ(MakeArray<bool>({1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                             1}),
+            tester.mask_array());
+}
+
 TEST(UnionMasksTest, MaskArrayAndMaskArrayEqualsNoMaskArray) {
   MaskedArrayWriteTester<int> tester{BoxView({1}, {5})};
   MaskedArrayWriteTester<int> tester_b{BoxView({1}, {5})};
@@ -0,0 +1,94 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/memory_budget.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/base/no_destructor.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/env.h"
+
+namespace tensorstore {
+namespace internal {
+
+MemoryBudget& MemoryBudget::Global() {
+  static absl::NoDestructor<MemoryBudget> budget;
+  static const bool initialized = [] {
+    budget->SetLimit(
+        internal::GetEnvValue<size_t>("TENSORSTORE_MEMORY_BUDGET_BYTES")
+            .value_or(0));
+    return true;
+  }();
+  static_cast<void>(initialized);
+  return *budget;
+}
+
+void MemoryBudget::AdjustUsage(ptrdiff_t change) {
+  const size_t usage =
+      usage_.fetch_add(change, std::memory_order_relaxed) + change;
+  if (change <= 0) return;
+  const size_t limit = limit_.load(std::memory_order_relaxed);
+  if (limit == 0 || usage <= limit) return;
+  MaybeReclaim();
+}
+
+void MemoryBudget::MaybeReclaim() {
+  // Only one thread reclaims at a time; other over-budget threads proceed,
+  // relying on the in-progress reclamation.
+  bool expected = false;
+  if (!reclaim_in_progress_.compare_exchange_strong(
+          expected, true, std::memory_order_acquire)) {
+    return;
+  }
+  {
+    absl::MutexLock lock(&mutex_);
+    for (auto& entry : reclaimers_) {
+      const size_t limit = limit_.load(std::memory_order_relaxed);
+      const size_t usage = usage_.load(std::memory_order_relaxed);
+      if (limit == 0 || usage <= limit) break;
+      entry.reclaimer(usage - limit);
+    }
+  }
+  reclaim_in_progress_.store(false, std::memory_order_release);
+}
+
+int64_t MemoryBudget::RegisterReclaimer(int priority, Reclaimer reclaimer) {
+  absl::MutexLock lock(&mutex_);
+  const int64_t token = next_token_++;
+  auto it = std::upper_bound(
+      reclaimers_.begin(), reclaimers_.end(), priority,
+      [](int p, const RegisteredReclaimer& r) { return p < r.priority; });
+  reclaimers_.insert(it,
+                     RegisteredReclaimer{token, priority, std::move(reclaimer)});
+  return token;
+}
+
+void MemoryBudget::UnregisterReclaimer(int64_t token) {
+  absl::MutexLock lock(&mutex_);
+  for (auto it = reclaimers_.begin(); it != reclaimers_.end(); ++it) {
+    if (it->token == token) {
+      reclaimers_.erase(it);
+      return;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace tensorstore
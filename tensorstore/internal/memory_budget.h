@@ -0,0 +1,110 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_MEMORY_BUDGET_H_
+#define TENSORSTORE_INTERNAL_MEMORY_BUDGET_H_
+
+/// \file Process-wide memory budget shared across subsystems.
+///
+/// Cache pools, the flat block pool, and other holders of large buffers each
+/// enforce only their own limits; their sum is what the process is actually
+/// charged for.  `MemoryBudget` maintains a single usage gauge that
+/// participating subsystems adjust as they allocate and free, along with a
+/// registry of prioritized reclamation callbacks.  When usage exceeds the
+/// configured limit, reclaimers are invoked in priority order (lowest first)
+/// until usage drops back under the limit or no reclaimer can release
+/// anything further, so the process degrades gracefully instead of OOMing.
+///
+/// The limit defaults to unlimited; set the environment variable
+/// :envvar:`TENSORSTORE_MEMORY_BUDGET_BYTES` or call `SetLimit` to cap it.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+namespace tensorstore {
+namespace internal {
+
+class MemoryBudget {
+ public:
+  /// Callback invoked when usage exceeds the limit.  Attempts to release up
+  /// to `bytes_to_reclaim` bytes of budgeted memory and returns the number of
+  /// bytes actually released.  Reclaimers are invoked with an internal lock
+  /// held and therefore must not call back into `MemoryBudget` other than via
+  /// `AdjustUsage`.
+  using Reclaimer = std::function<size_t(size_t bytes_to_reclaim)>;
+
+  /// Well-known reclaimer priorities.  Lower values are reclaimed first.
+  constexpr static int kPriorityPooledBuffers = 0;
+  constexpr static int kPriorityCachePool = 100;
+
+  /// Returns the process-wide budget.
+  static MemoryBudget& Global();
+
+  /// Returns the limit in bytes, or 0 if unlimited.
+  size_t limit() const { return limit_.load(std::memory_order_relaxed); }
+
+  /// Sets the limit in bytes.  A value of 0 disables the budget.
+  void SetLimit(size_t limit) {
+    limit_.store(limit, std::memory_order_relaxed);
+  }
+
+  /// Returns the current registered usage in bytes.
+  size_t usage() const { return usage_.load(std::memory_order_relaxed); }
+
+  /// Adjusts the usage gauge by `change` bytes.  If the limit is then
+  /// exceeded, invokes reclaimers until usage is back under the limit or all
+  /// reclaimers have been given a chance.
+  void AdjustUsage(ptrdiff_t change);
+
+  /// Registers `reclaimer` with the given priority.  Returns a token for use
+  /// with `UnregisterReclaimer`.
+  ///
+  /// `UnregisterReclaimer` blocks until any in-flight invocation of the
+  /// reclaimer completes, so a reclaimer may safely reference state that is
+  /// destroyed after unregistration.
+  int64_t RegisterReclaimer(int priority, Reclaimer reclaimer);
+  void UnregisterReclaimer(int64_t token);
+
+ private:
+  void MaybeReclaim();
+
+  std::atomic<size_t> usage_{0};
+  std::atomic<size_t> limit_{0};
+
+  struct RegisteredReclaimer {
+    int64_t token;
+    int priority;
+    Reclaimer reclaimer;
+  };
+
+  absl::Mutex mutex_;
+  // Sorted by priority; ties broken by registration order.
+  std::vector<RegisteredReclaimer> reclaimers_ ABSL_GUARDED_BY(mutex_);
+  int64_t next_token_ ABSL_GUARDED_BY(mutex_) = 1;
+  // Limits reclamation to one thread at a time; concurrent over-budget
+  // threads simply proceed, relying on the in-progress reclamation.
+  std::atomic<bool> reclaim_in_progress_{false};
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_MEMORY_BUDGET_H_
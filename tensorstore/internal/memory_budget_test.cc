@@ -0,0 +1,92 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/memory_budget.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal::MemoryBudget;
+
+TEST(MemoryBudgetTest, UnlimitedByDefault) {
+  MemoryBudget budget;
+  EXPECT_EQ(0, budget.limit());
+  budget.AdjustUsage(1000);
+  EXPECT_EQ(1000, budget.usage());
+  budget.AdjustUsage(-1000);
+  EXPECT_EQ(0, budget.usage());
+}
+
+TEST(MemoryBudgetTest, ReclaimersInvokedInPriorityOrder) {
+  MemoryBudget budget;
+  budget.SetLimit(100);
+  std::vector<int> invoked;
+  budget.RegisterReclaimer(MemoryBudget::kPriorityCachePool,
+                           [&](size_t bytes) {
+                             invoked.push_back(1);
+                             budget.AdjustUsage(-200);
+                             return size_t{200};
+                           });
+  budget.RegisterReclaimer(MemoryBudget::kPriorityPooledBuffers,
+                           [&](size_t bytes) {
+                             invoked.push_back(0);
+                             return size_t{0};
+                           });
+  budget.AdjustUsage(250);
+  EXPECT_EQ((std::vector<int>{0, 1}), invoked);
+  EXPECT_EQ(50, budget.usage());
+
+  // Under the limit: no further reclamation.
+  invoked.clear();
+  budget.AdjustUsage(40);
+  EXPECT_TRUE(invoked.empty());
+}
+
+TEST(MemoryBudgetTest, ReclamationStopsOnceUnderLimit) {
+  MemoryBudget budget;
+  budget.SetLimit(100);
+  int second_invocations = 0;
+  budget.RegisterReclaimer(0, [&](size_t bytes) {
+    budget.AdjustUsage(-static_cast<ptrdiff_t>(bytes));
+    return bytes;
+  });
+  budget.RegisterReclaimer(1, [&](size_t bytes) {
+    ++second_invocations;
+    return size_t{0};
+  });
+  budget.AdjustUsage(150);
+  EXPECT_EQ(100, budget.usage());
+  EXPECT_EQ(0, second_invocations);
+}
+
+TEST(MemoryBudgetTest, UnregisteredReclaimerNotInvoked) {
+  MemoryBudget budget;
+  budget.SetLimit(100);
+  int invocations = 0;
+  int64_t token = budget.RegisterReclaimer(0, [&](size_t bytes) {
+    ++invocations;
+    return size_t{0};
+  });
+  budget.UnregisterReclaimer(token);
+  budget.AdjustUsage(150);
+  EXPECT_EQ(0, invocations);
+  budget.AdjustUsage(-150);
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include "tensorstore/internal/metrics/histogram.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <cassert>
 #include <string>
@@ -46,6 +47,27 @@ static const absl::NoDestructor<std::vector<std::string>> kDefaultBucketLabels(
       return labels;
     }());
 
+static const absl::NoDestructor<std::vector<std::string>> kLatencyBucketLabels(
+    []() {
+      std::vector<std::string> labels;
+      labels.push_back("0");
+      labels.push_back("1");
+      for (size_t b = 2; b < LatencyBucketer::OverflowBucket; b++) {
+        // Bucket `b` covers values with binary exponent `exp` and 2-bit
+        // mantissa sub-bucket `sub`; the upper bound is
+        // `2^(exp-1) * (5 + sub) / 4`, which is fractional only for the first
+        // two exponents.
+        const uint64_t exp = (b - 2) / 4 + 1;
+        const uint64_t numerator = ((b - 2) % 4 + 5) << (exp - 1);
+        if (numerator % 4 == 0) {
+          labels.push_back(absl::StrCat(numerator / 4));
+        } else {
+          labels.push_back(absl::StrCat(numerator / 4.0));
+        }
+      }
+      return labels;
+    }());
+
 }  // namespace
 
 std::string_view DefaultBucketer::LabelForBucket(size_t b) {
@@ -60,5 +82,17 @@ void DefaultBucketer::SetHistogramLabels(
                                          kDefaultBucketLabels->end());
 }
 
+std::string_view LatencyBucketer::LabelForBucket(size_t b) {
+  assert(b < LatencyBucketer::Max);
+  if (b < kLatencyBucketLabels->size()) return (*kLatencyBucketLabels)[b];
+  return "Inf";
+}
+
+void LatencyBucketer::SetHistogramLabels(
+    std::vector<std::string_view>& labels) {
+  labels = std::vector<std::string_view>(kLatencyBucketLabels->begin(),
+                                         kLatencyBucketLabels->end());
+}
+
 }  // namespace internal_metrics
 }  // namespace tensorstore
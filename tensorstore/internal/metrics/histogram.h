@@ -80,6 +80,45 @@ struct DefaultBucketer {
   static void SetHistogramLabels(std::vector<std::string_view>& labels);
 };
 
+/// LatencyBucketer buckets non-negative values with 4 sub-buckets per power
+/// of 2, giving ~25% relative resolution for accurate high-percentile
+/// latency estimates:
+///  n<0: bucket 0
+///  0<=n<1: bucket 1
+///  n>=1: bucket 2 + 4 * (log2(n)) + sub-bucket
+struct LatencyBucketer {
+  /// Name of Bucketer.
+  static constexpr const char kTag[] = "latency_histogram";
+
+  /// Number of power-of-2 intervals with sub-bucket resolution.
+  static constexpr size_t Exponents = 32;
+
+  /// Number of buckets.
+  static constexpr size_t Max = 131;
+  static constexpr size_t UnderflowBucket = 0;
+  static constexpr size_t OverflowBucket = 130;
+
+  /// Mapping from value to bucket in the range [0 .. Max-1].
+  static size_t BucketForValue(double value) {
+    if (!std::isfinite(value)) return UnderflowBucket;
+    if (value < 0) return UnderflowBucket;
+    int exp = 0;
+    const double m = std::frexp(value, &exp);
+    if (exp <= 0) return 1;
+    if (exp > static_cast<int>(Exponents)) return OverflowBucket;
+    // `m` is in [0.5, 1); use the next 2 mantissa bits as the sub-bucket.
+    const size_t sub = static_cast<size_t>((m - 0.5) * 8);
+    return 2 + (exp - 1) * 4 + sub;
+  }
+
+  /// Upper-bound label for the bucket.
+  /// OverflowBucket should return "Inf".
+  static std::string_view LabelForBucket(size_t b);
+
+  // Fills in the labels for the histogram.
+  static void SetHistogramLabels(std::vector<std::string_view>& labels);
+};
+
 /// A Histogram metric records a distribution value.
 ///
 /// A Histogram Cell is described by a Bucketer and a set of Fields.
@@ -210,31 +249,24 @@ class ABSL_CACHELINE_ALIGNED HistogramCell : public Bucketer {
     size_t idx = Bucketer::BucketForValue(value);
     if (idx < 0 || idx >= Max) return;
 
-    // Use bit0 of count as a spinlock.
-    uint64_t count = AcquireCountSpinlock();
-    uint64_t new_count = count + 2;
-
-    // Compute a new mean using the method of provisional means.
-    double mean = mean_.load(std::memory_order_relaxed);
-    double new_mean = mean + (value - mean) / (new_count >> 1);
-    mean_.store(new_mean, std::memory_order_relaxed);
-    if (new_count > 2) {
-      double ssd_delta = (value - mean) * (value - new_mean);
-      sum_squared_deviation_.store(
-          sum_squared_deviation_.load(std::memory_order_relaxed) + ssd_delta);
-    }
-    count_ = new_count;  // release spinlock
-
+    count_.fetch_add(1, std::memory_order_relaxed);
+    AtomicAdd(sum_, value);
+    AtomicAdd(sum_of_squares_, value * value);
     buckets_[idx].fetch_add(1, std::memory_order_relaxed);
   }
 
   // There is potential inconsistency between count/sum/bucket
-  double GetMean() const { return mean_.load(std::memory_order_relaxed); }
-  int64_t GetCount() const {
-    return static_cast<int64_t>(count_.load(std::memory_order_relaxed) >> 1);
+  double GetMean() const {
+    const int64_t count = count_.load(std::memory_order_relaxed);
+    return count == 0 ? 0.0 : sum_.load(std::memory_order_relaxed) / count;
   }
-  int64_t GetSSD() const {
-    return sum_squared_deviation_.load(std::memory_order_relaxed);
+  int64_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+  double GetSSD() const {
+    const int64_t count = count_.load(std::memory_order_relaxed);
+    if (count == 0) return 0.0;
+    const double sum = sum_.load(std::memory_order_relaxed);
+    return std::max(0.0, sum_of_squares_.load(std::memory_order_relaxed) -
+                             sum * sum / count);
   }
 
   int64_t GetBucket(size_t idx) const {
@@ -243,46 +275,44 @@ class ABSL_CACHELINE_ALIGNED HistogramCell : public Bucketer {
   }
 
   void Reset() {
-    // Use bit0 of count as a spinlock.
-    AcquireCountSpinlock();
-    mean_.store(0, std::memory_order_relaxed);
-    sum_squared_deviation_.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    sum_of_squares_.store(0, std::memory_order_relaxed);
     for (auto& b : buckets_) {
       b.store(0, std::memory_order_relaxed);
     }
-    count_ = 0;  // release spinlock
   }
 
   CollectedMetric::Histogram Collect(std::vector<std::string> fields) const {
     std::vector<int64_t> buckets;
     buckets.reserve(Bucketer::Max);
-    uint64_t count = AcquireCountSpinlock();
-    double mean = mean_.load(std::memory_order_relaxed);
-    double ssd = sum_squared_deviation_.load(std::memory_order_relaxed);
-    count_ = count;  // release spinlock before iterating over buckets
+    const double sum = sum_.load(std::memory_order_relaxed);
+    const double sum_of_squares =
+        sum_of_squares_.load(std::memory_order_relaxed);
     int64_t bucket_count = 0;
     for (auto& b : buckets_) {
       int64_t x = b.load(std::memory_order_relaxed);
       buckets.push_back(x);
       bucket_count += x;
     }
+    const double mean = bucket_count == 0 ? 0.0 : sum / bucket_count;
+    const double ssd = std::max(0.0, sum_of_squares - sum * mean);
     return CollectedMetric::Histogram{std::move(fields), bucket_count, mean,
                                       ssd, std::move(buckets)};
   }
 
  private:
-  // Acquires the bit-0 spinlock on count_.
-  uint64_t AcquireCountSpinlock() const {
-    uint64_t count;
-    do {
-      count = count_.fetch_or(1);
-    } while (count & 1);
-    return count;
+  // C++ 20 will add std::atomic::fetch_add support for floating point types
+  static void AtomicAdd(std::atomic<double>& v_atomic, double value) {
+    double v = v_atomic.load(std::memory_order_relaxed);
+    while (!v_atomic.compare_exchange_weak(v, v + value)) {
+      // repeat
+    }
   }
 
-  mutable std::atomic<uint64_t> count_{0};  // mutable for spinlock.
-  std::atomic<double> mean_{0.0};
-  std::atomic<double> sum_squared_deviation_{0.0};
+  std::atomic<int64_t> count_{0};
+  std::atomic<double> sum_{0.0};
+  std::atomic<double> sum_of_squares_{0.0};
   std::array<std::atomic<int64_t>, Max> buckets_{};
 };
 
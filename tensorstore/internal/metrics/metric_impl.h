@@ -276,12 +276,12 @@ class AbstractMetric<Cell, true> : public AbstractMetricBase<0> {
 
  private:
   size_t get_id() const {
-    thread_local size_t id = MetricThreadCounter() & 3;
+    thread_local size_t id = MetricThreadCounter() & 7;
     return id;
   }
 
-  Cell cells_[4];
-  static_assert(sizeof(cells_) == 4 * ABSL_CACHELINE_SIZE);
+  Cell cells_[8];
+  static_assert(sizeof(cells_) == 8 * ABSL_CACHELINE_SIZE);
 };
 
 // Lock-free Specialization for no fields.
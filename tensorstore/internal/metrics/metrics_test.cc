@@ -41,6 +41,7 @@ using ::tensorstore::internal_metrics::DefaultBucketer;
 using ::tensorstore::internal_metrics::Gauge;
 using ::tensorstore::internal_metrics::GetMetricRegistry;
 using ::tensorstore::internal_metrics::Histogram;
+using ::tensorstore::internal_metrics::LatencyBucketer;
 using ::tensorstore::internal_metrics::MaxGauge;
 using ::tensorstore::internal_metrics::MetricMetadata;
 using ::tensorstore::internal_metrics::Value;
@@ -263,6 +264,43 @@ TEST(MetricTest, DefaultBucketer) {
             DefaultBucketer::LabelForBucket(DefaultBucketer::OverflowBucket));
 }
 
+TEST(MetricTest, LatencyBucketer) {
+  // Boundary cases.
+  EXPECT_EQ(LatencyBucketer::UnderflowBucket,
+            LatencyBucketer::BucketForValue(-1));
+  EXPECT_EQ(1, LatencyBucketer::BucketForValue(0));
+  EXPECT_EQ(1, LatencyBucketer::BucketForValue(0.5));
+
+  // 4 sub-buckets per power of 2.
+  EXPECT_EQ(2, LatencyBucketer::BucketForValue(1));
+  EXPECT_EQ(3, LatencyBucketer::BucketForValue(1.25));
+  EXPECT_EQ(4, LatencyBucketer::BucketForValue(1.5));
+  EXPECT_EQ(5, LatencyBucketer::BucketForValue(1.75));
+  EXPECT_EQ(6, LatencyBucketer::BucketForValue(2));
+  EXPECT_EQ(8, LatencyBucketer::BucketForValue(3));
+  EXPECT_EQ(41, LatencyBucketer::BucketForValue(1000));
+
+  EXPECT_EQ(LatencyBucketer::OverflowBucket - 1,
+            LatencyBucketer::BucketForValue(
+                std::nextafter(static_cast<double>(1ull << 32), 0)));
+  EXPECT_EQ(LatencyBucketer::OverflowBucket,
+            LatencyBucketer::BucketForValue(static_cast<double>(1ull << 32)));
+
+  // Labels
+  EXPECT_EQ("0",
+            LatencyBucketer::LabelForBucket(LatencyBucketer::UnderflowBucket));
+  EXPECT_EQ("1", LatencyBucketer::LabelForBucket(1));
+  EXPECT_EQ("1.25", LatencyBucketer::LabelForBucket(2));
+  EXPECT_EQ("2", LatencyBucketer::LabelForBucket(5));
+  EXPECT_EQ("2.5", LatencyBucketer::LabelForBucket(6));
+  EXPECT_EQ("1024", LatencyBucketer::LabelForBucket(41));
+  EXPECT_EQ("4294967296", LatencyBucketer::LabelForBucket(
+                              LatencyBucketer::OverflowBucket - 1));
+
+  EXPECT_EQ("Inf",
+            LatencyBucketer::LabelForBucket(LatencyBucketer::OverflowBucket));
+}
+
 TEST(MetricTest, Histogram) {
   auto& histogram = Histogram<DefaultBucketer>::New("/tensorstore/hist1",
                                                     MetricMetadata("A metric"));
@@ -0,0 +1,203 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/metrics/prometheus_scrape_server.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else  // !_WIN32
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#endif  // _WIN32
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/internal/metrics/collect.h"
+#include "tensorstore/internal/metrics/prometheus.h"
+#include "tensorstore/internal/metrics/registry.h"
+#include "tensorstore/internal/thread/thread.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_metrics {
+namespace {
+
+#ifdef _WIN32
+using socket_t = SOCKET;
+constexpr socket_t kInvalidSocket = INVALID_SOCKET;
+int GetSocketErrno() { return WSAGetLastError(); }
+void CloseSocket(socket_t sock) { ::closesocket(sock); }
+void EnsureSocketsInitialized() {
+  static bool initialized = [] {
+    WSADATA wsa_data;
+    return ::WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0;
+  }();
+  (void)initialized;
+}
+#else   // _WIN32
+using socket_t = int;
+constexpr socket_t kInvalidSocket = -1;
+int GetSocketErrno() { return errno; }
+void CloseSocket(socket_t sock) { ::close(sock); }
+void EnsureSocketsInitialized() {}
+#endif  // _WIN32
+
+// Sends the entire buffer, retrying on short writes.
+void SendAll(socket_t sock, std::string_view data) {
+  while (!data.empty()) {
+    const auto n = ::send(sock, data.data(), data.size(), 0);
+    if (n <= 0) return;
+    data.remove_prefix(static_cast<size_t>(n));
+  }
+}
+
+// Returns the path of the request, or an empty view if the request is not a
+// GET request.
+std::string_view ParseGetRequestPath(std::string_view request) {
+  if (request.substr(0, 4) != "GET ") return {};
+  request.remove_prefix(4);
+  const size_t end = request.find(' ');
+  if (end == std::string_view::npos) return {};
+  return request.substr(0, end);
+}
+
+}  // namespace
+
+std::string FormatMetricsForPrometheus(std::string_view metric_prefix) {
+  auto metrics = GetMetricRegistry().CollectWithPrefix(metric_prefix);
+  std::sort(metrics.begin(), metrics.end(),
+            [](const CollectedMetric& a, const CollectedMetric& b) {
+              return a.metric_name < b.metric_name;
+            });
+  std::string result;
+  for (const auto& metric : metrics) {
+    PrometheusExpositionFormat(metric, [&result](std::string line) {
+      result.append(line);
+      result.append("\n");
+    });
+  }
+  return result;
+}
+
+Result<std::unique_ptr<PrometheusScrapeServer>> PrometheusScrapeServer::Start(
+    Options options) {
+  EnsureSocketsInitialized();
+  socket_t sock = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (sock == kInvalidSocket) {
+    return absl::UnavailableError(
+        tensorstore::StrCat("Failed to create scrape server socket: errno=",
+                            GetSocketErrno()));
+  }
+  int yes = 1;
+  ::setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char*>(&yes),
+               sizeof(yes));
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(options.port);
+  if (::bind(sock, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) !=
+          0 ||
+      ::listen(sock, 4) != 0) {
+    auto status = absl::UnavailableError(tensorstore::StrCat(
+        "Failed to bind scrape server to port ", options.port,
+        ": errno=", GetSocketErrno()));
+    CloseSocket(sock);
+    return status;
+  }
+
+  socklen_t addr_len = sizeof(addr);
+  if (::getsockname(sock, reinterpret_cast<struct sockaddr*>(&addr),
+                    &addr_len) != 0) {
+    auto status = absl::UnavailableError(tensorstore::StrCat(
+        "Failed to determine scrape server port: errno=", GetSocketErrno()));
+    CloseSocket(sock);
+    return status;
+  }
+
+  std::unique_ptr<PrometheusScrapeServer> server(new PrometheusScrapeServer);
+  server->options_ = std::move(options);
+  server->port_ = ntohs(addr.sin_port);
+  server->listen_socket_ = static_cast<uintptr_t>(sock);
+  server->thread_ = internal::Thread({"prom_scrape"},
+                                     [s = server.get()] { s->Serve(); });
+  return server;
+}
+
+PrometheusScrapeServer::~PrometheusScrapeServer() {
+  stopping_.store(true, std::memory_order_relaxed);
+  // Closing the listen socket unblocks the pending `accept`.
+  CloseSocket(static_cast<socket_t>(listen_socket_));
+  thread_.Join();
+}
+
+void PrometheusScrapeServer::Serve() {
+  const socket_t listen_socket = static_cast<socket_t>(listen_socket_);
+  while (!stopping_.load(std::memory_order_relaxed)) {
+    socket_t client = ::accept(listen_socket, nullptr, nullptr);
+    if (client == kInvalidSocket) {
+      if (stopping_.load(std::memory_order_relaxed)) break;
+      continue;
+    }
+    // Read the request headers; only the request line is examined.
+    std::string request;
+    char buf[1024];
+    while (request.find("\r\n\r\n") == std::string::npos &&
+           request.size() < 16 * 1024) {
+      const auto n = ::recv(client, buf, sizeof(buf), 0);
+      if (n <= 0) break;
+      request.append(buf, static_cast<size_t>(n));
+    }
+    const std::string_view path = ParseGetRequestPath(request);
+    if (path == "/metrics" || path.substr(0, 9) == "/metrics?") {
+      std::string body = FormatMetricsForPrometheus(options_.metric_prefix);
+      SendAll(client,
+              tensorstore::StrCat(
+                  "HTTP/1.1 200 OK\r\n"
+                  "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                  "Content-Length: ",
+                  body.size(), "\r\nConnection: close\r\n\r\n", body));
+    } else {
+      SendAll(client,
+              "HTTP/1.1 404 Not Found\r\n"
+              "Content-Length: 0\r\nConnection: close\r\n\r\n");
+    }
+    CloseSocket(client);
+  }
+}
+
+}  // namespace internal_metrics
+}  // namespace tensorstore
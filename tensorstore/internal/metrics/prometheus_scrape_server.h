@@ -0,0 +1,86 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_METRICS_PROMETHEUS_SCRAPE_SERVER_H_
+#define TENSORSTORE_INTERNAL_METRICS_PROMETHEUS_SCRAPE_SERVER_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "tensorstore/internal/thread/thread.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_metrics {
+
+/// Formats all metrics registered under `metric_prefix` in the prometheus
+/// exposition format, one line per sample.
+std::string FormatMetricsForPrometheus(std::string_view metric_prefix);
+
+/// Minimal embedded HTTP server that serves the metric registry in prometheus
+/// exposition format.
+///
+/// The server runs a single thread that handles one scrape request per
+/// connection on the `/metrics` path.  Metrics are collected at scrape time,
+/// so serving adds no cost to the metric update path.
+///
+/// Example:
+///
+///     TENSORSTORE_ASSIGN_OR_RETURN(
+///         auto server, PrometheusScrapeServer::Start({/*.port=*/9090}));
+///
+class PrometheusScrapeServer {
+ public:
+  struct Options {
+    /// Port to listen on.  A value of 0 selects an unused port, which may be
+    /// retrieved with `port()`.
+    uint16_t port = 0;
+
+    /// Only metrics beginning with this prefix are exported.
+    std::string metric_prefix = "/tensorstore/";
+  };
+
+  /// Starts serving scrape requests in a background thread.
+  ///
+  /// \error `absl::StatusCode::kUnavailable` if the port cannot be bound.
+  static Result<std::unique_ptr<PrometheusScrapeServer>> Start(Options options);
+
+  /// Stops the server and joins the serving thread.
+  ~PrometheusScrapeServer();
+
+  /// Returns the port the server is listening on.
+  uint16_t port() const { return port_; }
+
+ private:
+  PrometheusScrapeServer() = default;
+
+  void Serve();
+
+  Options options_;
+  uint16_t port_ = 0;
+  // Listen socket; holds a `socket_t`, which is a `SOCKET` on Windows and a
+  // file descriptor otherwise.
+  uintptr_t listen_socket_ = 0;
+  std::atomic<bool> stopping_{false};
+  internal::Thread thread_;
+};
+
+}  // namespace internal_metrics
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_METRICS_PROMETHEUS_SCRAPE_SERVER_H_
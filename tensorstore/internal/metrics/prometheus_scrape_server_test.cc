@@ -0,0 +1,81 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/metrics/prometheus_scrape_server.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/str_cat.h"
+#include "tensorstore/internal/http/curl_transport.h"
+#include "tensorstore/internal/http/http_request.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::internal_http::HttpRequestBuilder;
+using ::tensorstore::internal_metrics::Counter;
+using ::tensorstore::internal_metrics::FormatMetricsForPrometheus;
+using ::tensorstore::internal_metrics::MetricMetadata;
+using ::tensorstore::internal_metrics::PrometheusScrapeServer;
+using ::testing::HasSubstr;
+
+auto& scrape_test_counter = Counter<int64_t>::New(
+    "/tensorstore/scrape_test/count", MetricMetadata("A test counter."));
+
+TEST(PrometheusScrapeServerTest, FormatMetricsForPrometheus) {
+  scrape_test_counter.Increment();
+  EXPECT_THAT(FormatMetricsForPrometheus("/tensorstore/scrape_test/"),
+              HasSubstr("tensorstore_scrape_test_count"));
+}
+
+TEST(PrometheusScrapeServerTest, ServesMetrics) {
+  scrape_test_counter.Increment();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto server, PrometheusScrapeServer::Start(
+                       {/*.port=*/0, /*.metric_prefix=*/"/tensorstore/"}));
+  ASSERT_NE(0, server->port());
+
+  auto transport = ::tensorstore::internal_http::GetDefaultHttpTransport();
+  auto response =
+      transport
+          ->IssueRequest(
+              HttpRequestBuilder(
+                  "GET", absl::StrCat("http://localhost:", server->port(),
+                                      "/metrics"))
+                  .BuildRequest(),
+              {})
+          .result();
+  TENSORSTORE_ASSERT_OK(response);
+  EXPECT_EQ(200, response->status_code);
+  EXPECT_THAT(std::string(response->payload),
+              HasSubstr("tensorstore_scrape_test_count"));
+
+  auto not_found =
+      transport
+          ->IssueRequest(
+              HttpRequestBuilder("GET",
+                                 absl::StrCat("http://localhost:",
+                                              server->port(), "/other"))
+                  .BuildRequest(),
+              {})
+          .result();
+  TENSORSTORE_ASSERT_OK(not_found);
+  EXPECT_EQ(404, not_found->status_code);
+}
+
+}  // namespace
@@ -44,19 +44,32 @@ void MetricRegistry::AddInternal(std::string_view metric_name,
 
 std::vector<CollectedMetric> MetricRegistry::CollectWithPrefix(
     std::string_view prefix) {
-  std::vector<CollectedMetric> all;
-  all.reserve(entries_.size());
-  absl::MutexLock l(&mu_);
-  for (auto& kv : entries_) {
-    if (prefix.empty() || absl::StartsWith(kv.first, prefix)) {
-      auto opt_metric = kv.second.poly(CollectMetricTag{});
-      if (opt_metric.has_value()) {
-        all.emplace_back(*std::move(opt_metric));
-        assert(all.back().metric_name == kv.first);
+  // Snapshot the matching entries under the lock, then collect outside of it.
+  // Entries are never removed, so the copied polys remain valid and collection
+  // does not block concurrent registration for the duration of the (possibly
+  // slow) per-metric `Collect` calls.
+  std::vector<std::pair<std::string_view, Entry>> snapshot;
+  std::vector<CollectHook> hooks;
+  {
+    absl::MutexLock l(&mu_);
+    snapshot.reserve(entries_.size());
+    for (auto& kv : entries_) {
+      if (prefix.empty() || absl::StartsWith(kv.first, prefix)) {
+        snapshot.emplace_back(kv.first, kv.second);
       }
     }
+    hooks = collect_hooks_;
+  }
+  std::vector<CollectedMetric> all;
+  all.reserve(snapshot.size());
+  for (auto& kv : snapshot) {
+    auto opt_metric = kv.second.poly(CollectMetricTag{});
+    if (opt_metric.has_value()) {
+      all.emplace_back(*std::move(opt_metric));
+      assert(all.back().metric_name == kv.first);
+    }
   }
-  for (auto& hook : collect_hooks_) {
+  for (auto& hook : hooks) {
     hook(prefix, all);
   }
 
@@ -64,11 +77,17 @@ std::vector<CollectedMetric> MetricRegistry::CollectWithPrefix(
 }
 
 std::optional<CollectedMetric> MetricRegistry::Collect(std::string_view name) {
-  absl::MutexLock l(&mu_);
-  auto it = entries_.find(name);
-  if (it == entries_.end()) return std::nullopt;
-  auto opt_metric = it->second.poly(CollectMetricTag{});
-  assert(!opt_metric.has_value() || opt_metric->metric_name == it->first);
+  Entry entry;
+  std::string_view metric_name;
+  {
+    absl::MutexLock l(&mu_);
+    auto it = entries_.find(name);
+    if (it == entries_.end()) return std::nullopt;
+    metric_name = it->first;
+    entry = it->second;
+  }
+  auto opt_metric = entry.poly(CollectMetricTag{});
+  assert(!opt_metric.has_value() || opt_metric->metric_name == metric_name);
   return opt_metric;
 }
 
@@ -78,8 +97,15 @@ MetricRegistry& GetMetricRegistry() {
 }
 
 void MetricRegistry::Reset() {
-  absl::MutexLock l(&mu_);
-  for (auto& [k, v] : entries_) {
+  std::vector<Entry> snapshot;
+  {
+    absl::MutexLock l(&mu_);
+    snapshot.reserve(entries_.size());
+    for (auto& [k, v] : entries_) {
+      snapshot.push_back(v);
+    }
+  }
+  for (auto& v : snapshot) {
     v.poly(ResetMetricTag{});
   }
 }
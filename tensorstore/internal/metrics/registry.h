@@ -34,8 +34,10 @@ namespace tensorstore {
 namespace internal_metrics {
 
 /// Registry which tracks metrics, similar to a Prometheus registry.
-/// Metrics can be queried individually or based on a prefix. Note
-/// that collection happens under lock, limiting collection parallelism.
+/// Metrics can be queried individually or based on a prefix.  The registry is
+/// append-only; collection snapshots the matching entries under a brief lock
+/// and invokes the per-metric collect functions outside of it, so frequent
+/// scrapes do not block concurrent metric registration.
 class MetricRegistry {
  public:
   struct CollectMetricTag {};
@@ -86,7 +88,8 @@ class MetricRegistry {
   std::optional<CollectedMetric> Collect(std::string_view name);
 
   /// Collect metrics that begin with the specified prefix.
-  /// The result is not ordered.
+  /// The result is not ordered.  Metrics registered concurrently with the call
+  /// may or may not be included.
   std::vector<CollectedMetric> CollectWithPrefix(std::string_view prefix);
 
   // Reset all the metrics in the registry
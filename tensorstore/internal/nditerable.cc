@@ -41,5 +41,10 @@ bool NDIterator::UpdateBlock(tensorstore::span<const Index> indices,
   return true;
 }
 
+void* NDIterable::GetDirectDataPointer(
+    tensorstore::span<Index> byte_strides) const {
+  return nullptr;
+}
+
 }  // namespace internal
 }  // namespace tensorstore
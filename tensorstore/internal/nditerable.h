@@ -381,6 +381,21 @@ class NDIterable : public NDIterableBufferConstraint {
   virtual NDIterator::Ptr GetIterator(
       IterationBufferKindLayoutView layout) const = 0;
 
+  /// Optional fast-path query for bypassing iteration entirely.
+  ///
+  /// If this iterable is a direct view of in-memory strided array data,
+  /// returns the data pointer corresponding to the zero position of the
+  /// implicitly associated `shape` and fills `byte_strides` (which must have
+  /// length equal to the rank of `shape`) with the corresponding byte strides.
+  /// Otherwise, returns `nullptr` and leaves `byte_strides` unmodified.
+  ///
+  /// This is used by `CopyReadChunk` to turn whole-chunk identity-transform
+  /// reads into a single `memcpy`.
+  ///
+  /// \remark The default implementation just returns `nullptr`.
+  virtual void* GetDirectDataPointer(
+      tensorstore::span<Index> byte_strides) const;
+
   /// Needed by `VirtualDestroyDeleter`.
   virtual void Destroy() = 0;
 
@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -258,6 +259,13 @@ class ArrayIterableImpl : public NDIterable::Base<ArrayIterableImpl> {
     }
   }
 
+  void* GetDirectDataPointer(
+      tensorstore::span<Index> byte_strides) const override {
+    assert(byte_strides.size() == static_cast<ptrdiff_t>(byte_strides_.size()));
+    std::copy(byte_strides_.begin(), byte_strides_.end(), byte_strides.begin());
+    return data_.get();
+  }
+
  private:
   std::shared_ptr<void> data_;
   DataType dtype_;
@@ -213,6 +213,16 @@ TEST(NDIterableArrayTest, Direct) {
   }
 }
 
+TEST(NDIterableArrayTest, GetDirectDataPointer) {
+  uint8_t data[24];
+  Array<uint8_t> array(data, StridedLayout<>({2, 3, 4}, {12, 4, 1}));
+  Arena arena;
+  auto iterable = GetArrayNDIterable(UnownedToShared(array), &arena);
+  Index byte_strides[3];
+  EXPECT_EQ(data, iterable->GetDirectDataPointer(byte_strides));
+  EXPECT_THAT(byte_strides, ::testing::ElementsAre(12, 4, 1));
+}
+
 TEST(NDIterableArrayTest, RankZero) {
   auto array = tensorstore::MakeScalarArray<int>(5);
 
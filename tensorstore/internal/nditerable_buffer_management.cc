@@ -0,0 +1,75 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/nditerable_buffer_management.h"
+
+#include <stddef.h>
+
+#include <new>
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+/// Maximum number of recycled buffers retained per thread.
+constexpr size_t kMaxPooledBuffers = 4;
+
+/// A recycled buffer is reused only if its size does not exceed twice the
+/// requested size, to bound wasted memory when block shapes change.
+constexpr size_t kMaxReuseFactor = 2;
+
+struct IterationBufferPool {
+  PooledIterationBuffer buffers[kMaxPooledBuffers];
+  size_t size = 0;
+
+  ~IterationBufferPool() {
+    for (size_t i = 0; i < size; ++i) {
+      ::operator delete(static_cast<void*>(buffers[i].data), buffers[i].bytes,
+                        std::align_val_t(buffers[i].alignment));
+    }
+  }
+};
+
+thread_local IterationBufferPool iteration_buffer_pool;
+
+}  // namespace
+
+PooledIterationBuffer AllocateIterationBuffer(size_t bytes, size_t alignment) {
+  auto& pool = iteration_buffer_pool;
+  for (size_t i = 0; i < pool.size; ++i) {
+    const auto& buffer = pool.buffers[i];
+    if (buffer.bytes >= bytes && buffer.bytes <= bytes * kMaxReuseFactor &&
+        buffer.alignment >= alignment) {
+      PooledIterationBuffer result = buffer;
+      pool.buffers[i] = pool.buffers[--pool.size];
+      return result;
+    }
+  }
+  return {static_cast<unsigned char*>(
+              ::operator new(bytes, std::align_val_t(alignment))),
+          bytes, alignment};
+}
+
+void ReleaseIterationBuffer(PooledIterationBuffer buffer) {
+  auto& pool = iteration_buffer_pool;
+  if (pool.size < kMaxPooledBuffers) {
+    pool.buffers[pool.size++] = buffer;
+    return;
+  }
+  ::operator delete(static_cast<void*>(buffer.data), buffer.bytes,
+                    std::align_val_t(buffer.alignment));
+}
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -97,6 +97,38 @@ class NDIterablesWithManagedBuffers
   }
 };
 
+/// Minimum allocation size for which `NDIteratorExternalBufferManager`
+/// obtains buffers from the thread-local iteration buffer pool rather than
+/// from the arena.
+///
+/// Chosen to exceed typical arena fixed-size buffers, so that small
+/// allocations still benefit from stack allocation.
+constexpr size_t kMinPooledIterationBufferBytes = 64 * 1024;
+
+/// Large iteration buffer obtained from `AllocateIterationBuffer`.
+///
+/// `bytes` and `alignment` reflect the actual allocation, which may exceed the
+/// requested values when a recycled buffer is returned, and must be preserved
+/// for the call to `ReleaseIterationBuffer`.
+struct PooledIterationBuffer {
+  unsigned char* data;
+  size_t bytes;
+  size_t alignment;
+};
+
+/// Allocates a buffer of at least `bytes` bytes with alignment of at least
+/// `alignment`, reusing a recycled buffer from the thread-local pool if one of
+/// a suitable size is available.
+///
+/// Buffers are recycled only on the thread that released them; successive
+/// chunk operations on the same executor thread therefore avoid repeated
+/// malloc/free of large block buffers.
+PooledIterationBuffer AllocateIterationBuffer(size_t bytes, size_t alignment);
+
+/// Returns a buffer obtained from `AllocateIterationBuffer` to the
+/// thread-local pool (or frees it if the pool is full).
+void ReleaseIterationBuffer(PooledIterationBuffer buffer);
+
 /// Manages external buffers needed for `NDIterator` objects.
 ///
 /// This is used by `NDIteratorsWithManagedBuffers` and by
@@ -172,9 +204,20 @@ class NDIteratorExternalBufferManager {
 
     if (!buffer_bytes_needed) return;
 
-    buffer_ = allocator_.arena()->allocate(buffer_bytes_needed, alignment);
-    buffer_size_ = buffer_bytes_needed;
-    buffer_alignment_ = alignment;
+    if (static_cast<size_t>(buffer_bytes_needed) >=
+        kMinPooledIterationBufferBytes) {
+      const auto pooled = AllocateIterationBuffer(buffer_bytes_needed,
+                                                  alignment);
+      buffer_ = pooled.data;
+      buffer_size_ = pooled.bytes;
+      buffer_alignment_ = pooled.alignment;
+      pooled_ = true;
+    } else {
+      buffer_ = allocator_.arena()->allocate(buffer_bytes_needed, alignment);
+      buffer_size_ = buffer_bytes_needed;
+      buffer_alignment_ = alignment;
+      pooled_ = false;
+    }
 
     ptrdiff_t buffer_offset = 0;
 
@@ -248,7 +291,11 @@ class NDIteratorExternalBufferManager {
         data_types_[i]->destroy(block_size_, buffer_pointers_[0][i].pointer);
       }
     }
-    allocator_.arena()->deallocate(buffer_, buffer_size_, buffer_alignment_);
+    if (pooled_) {
+      ReleaseIterationBuffer({buffer_, buffer_size_, buffer_alignment_});
+    } else {
+      allocator_.arena()->deallocate(buffer_, buffer_size_, buffer_alignment_);
+    }
     buffer_ = nullptr;
   }
 
@@ -258,6 +305,7 @@ class NDIteratorExternalBufferManager {
   unsigned char* buffer_;
   size_t buffer_size_;
   size_t buffer_alignment_;
+  bool pooled_ = false;
   std::array<std::array<IterationBufferPointer, Arity>, NumBufferKinds>
       buffer_pointers_;
 };
@@ -0,0 +1,70 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/nditerable_buffer_management.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal::AllocateIterationBuffer;
+using ::tensorstore::internal::kMinPooledIterationBufferBytes;
+using ::tensorstore::internal::PooledIterationBuffer;
+using ::tensorstore::internal::ReleaseIterationBuffer;
+
+TEST(IterationBufferPoolTest, ReusesReleasedBuffer) {
+  const size_t bytes = kMinPooledIterationBufferBytes;
+  PooledIterationBuffer buffer = AllocateIterationBuffer(bytes, 8);
+  ASSERT_NE(nullptr, buffer.data);
+  EXPECT_GE(buffer.bytes, bytes);
+  unsigned char* const data = buffer.data;
+  ReleaseIterationBuffer(buffer);
+
+  // Allocating the same size again on the same thread returns the recycled
+  // buffer.
+  PooledIterationBuffer reused = AllocateIterationBuffer(bytes, 8);
+  EXPECT_EQ(data, reused.data);
+  ReleaseIterationBuffer(reused);
+}
+
+TEST(IterationBufferPoolTest, DoesNotReuseMuchLargerBuffer) {
+  const size_t bytes = kMinPooledIterationBufferBytes;
+  PooledIterationBuffer large = AllocateIterationBuffer(bytes * 8, 8);
+  unsigned char* const data = large.data;
+  ReleaseIterationBuffer(large);
+
+  // A much smaller request does not reuse the large buffer.
+  PooledIterationBuffer small = AllocateIterationBuffer(bytes, 8);
+  EXPECT_NE(data, small.data);
+  ReleaseIterationBuffer(small);
+}
+
+TEST(IterationBufferPoolTest, RespectsAlignment) {
+  const size_t bytes = kMinPooledIterationBufferBytes;
+  PooledIterationBuffer buffer = AllocateIterationBuffer(bytes, 8);
+  unsigned char* const data = buffer.data;
+  ReleaseIterationBuffer(buffer);
+
+  // A request with a stricter alignment does not reuse a buffer with a weaker
+  // alignment.
+  PooledIterationBuffer aligned = AllocateIterationBuffer(bytes, 64);
+  EXPECT_NE(data, aligned.data);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(aligned.data) % 64);
+  ReleaseIterationBuffer(aligned);
+}
+
+}  // namespace
@@ -18,19 +18,28 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/data_type.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/arena.h"
+#include "tensorstore/internal/blocked_transpose_copy.h"
+#include "tensorstore/internal/broadcast_fill.h"
 #include "tensorstore/internal/element_copy_function.h"
 #include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/nditerable.h"
 #include "tensorstore/internal/nditerable_buffer_management.h"
 #include "tensorstore/internal/nditerable_util.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/span.h"
 
@@ -98,11 +107,21 @@ bool NDIteratorCopyManager::CopyImplBoth(NDIteratorCopyManager* self,
                                          IterationBufferShape block_shape,
                                          absl::Status* status) {
   IterationBufferPointer input_pointer, output_pointer;
-  return self->input_->GetBlock(indices, block_shape, &input_pointer, status) &&
-         self->output_->GetBlock(indices, block_shape, &output_pointer,
-                                 status) &&
-         self->copy_elements_function_(nullptr, block_shape, input_pointer,
-                                       output_pointer, status) &&
+  if (!self->input_->GetBlock(indices, block_shape, &input_pointer, status) ||
+      !self->output_->GetBlock(indices, block_shape, &output_pointer,
+                               status)) {
+    return false;
+  }
+  // Blocks with a zero source inner byte stride are broadcasts of a single
+  // element per row (e.g. fill values for unmaterialized chunks); use the
+  // pattern-store fill kernel instead of the element-at-a-time copy.
+  const auto copy_elements_function =
+      (self->broadcast_fill_elements_function_ &&
+       input_pointer.inner_byte_stride == 0)
+          ? self->broadcast_fill_elements_function_
+          : self->copy_elements_function_;
+  return copy_elements_function(nullptr, block_shape, input_pointer,
+                                output_pointer, status) &&
          self->output_->UpdateBlock(indices, block_shape, output_pointer,
                                     status);
 }
@@ -173,6 +192,26 @@ NDIteratorCopyManager::NDIteratorCopyManager(
           iterable.input()
               ->dtype()
               ->copy_assign[buffer_parameters.input_buffer_kind];
+      // For strided buffers of trivial elements (e.g. a layout mismatch due
+      // to a pure dimension permutation), substitute the cache-blocked
+      // transpose-aware copy kernel for the element-at-a-time loop.
+      if (buffer_parameters.input_buffer_kind ==
+              IterationBufferKind::kStrided &&
+          buffer_parameters.output_buffer_kind ==
+              IterationBufferKind::kStrided) {
+        if (auto function =
+                GetBlockedTransposeCopyFunction(iterable.input()->dtype())) {
+          copy_elements_function_ = function;
+        }
+      }
+      // Broadcast (zero-stride) sources are only representable with strided
+      // input buffers; the fill substitution is applied per block in
+      // `CopyImplBoth`.
+      if (buffer_parameters.input_buffer_kind ==
+          IterationBufferKind::kStrided) {
+        broadcast_fill_elements_function_ =
+            GetBroadcastFillCopyFunction(iterable.input()->dtype());
+      }
       break;
     case NDIterableCopyManager::BufferSource::kExternal:
       copy_impl_ = NDIteratorCopyManager::CopyImplExternal;
@@ -243,5 +282,156 @@ absl::Status NDIterableCopier::Copy() {
   return absl::OkStatus();
 }
 
+namespace {
+
+// Minimum number of elements each shard of a parallel copy should cover.
+// Below this, the cost of spawning tasks and duplicating iterator state
+// exceeds the benefit of additional memory bandwidth.
+constexpr Index kMinElementsPerCopyShard = 512 * 1024;
+
+// Shared state for a single `NDIterableParallelCopy` invocation.  Each shard
+// copies a contiguous range `[begin, end)` of the outermost iteration
+// dimension using its own iterators, arena, and external buffers.
+struct ParallelCopyState {
+  const NDIterableCopyManager& copy_manager;
+  NDIterable::IterationLayoutView layout_view;
+  IterationBufferShape block_shape;
+  std::atomic<bool> abort{false};
+  absl::Mutex mu;
+  absl::Status status ABSL_GUARDED_BY(mu);
+
+  void RecordError(absl::Status shard_status) {
+    abort.store(true, std::memory_order_relaxed);
+    absl::MutexLock lock(&mu);
+    if (status.ok()) {
+      status = GetElementCopyErrorStatus(std::move(shard_status));
+    }
+  }
+
+  void CopyShard(Index begin, Index end) {
+    Arena arena;
+    NDIteratorCopyManager iterator_copy_manager(copy_manager,
+                                                {layout_view, block_shape},
+                                                ArenaAllocator<>(&arena));
+    tensorstore::span<const Index> iteration_shape =
+        layout_view.iteration_shape;
+    const DimensionIndex rank = iteration_shape.size();
+    Index position[kMaxRank];
+    std::fill_n(position, rank, static_cast<Index>(0));
+    position[0] = begin;
+    absl::Status copy_status;
+    if (rank == 1) {
+      // The shard range is along the sole (innermost) dimension; copy it in
+      // blocks of up to the inner block size.
+      while (position[0] < end) {
+        if (abort.load(std::memory_order_relaxed)) return;
+        const Index block_size = std::min(block_shape[1], end - position[0]);
+        if (!iterator_copy_manager.Copy(
+                tensorstore::span<const Index>(position, 1), {1, block_size},
+                &copy_status)) {
+          RecordError(std::move(copy_status));
+          return;
+        }
+        position[0] += block_size;
+      }
+      return;
+    }
+    // Iterate as in `NDIterableCopier::Copy`, but with the extent of the
+    // outermost dimension clamped to `end`.
+    Index shard_shape[kMaxRank];
+    std::copy_n(iteration_shape.begin(), rank, shard_shape);
+    shard_shape[0] = end;
+    if (Index inner_block_size = block_shape[1];
+        inner_block_size != iteration_shape.back()) {
+      // Block shape is 1d, need to iterate over all dimensions including
+      // innermost dimension.
+      for (Index block_size = inner_block_size; block_size;) {
+        if (abort.load(std::memory_order_relaxed)) return;
+        if (!iterator_copy_manager.Copy(
+                tensorstore::span<const Index>(position, rank),
+                {1, block_size}, &copy_status)) {
+          RecordError(std::move(copy_status));
+          return;
+        }
+        block_size = StepBufferPositionForward(
+            tensorstore::span<const Index>(shard_shape, rank), block_size,
+            inner_block_size, position);
+      }
+    } else {
+      // Block shape is 2d, exclude innermost dimension from iteration.  When
+      // `rank == 2` the outer block dimension is the partitioned dimension,
+      // so the initial block must be clamped to the shard range.
+      const Index outer_block_size = block_shape[0];
+      Index block_size =
+          (rank == 2) ? std::min(outer_block_size, end - begin)
+                      : outer_block_size;
+      while (block_size) {
+        if (abort.load(std::memory_order_relaxed)) return;
+        if (!iterator_copy_manager.Copy(
+                tensorstore::span<const Index>(position, rank),
+                {block_size, inner_block_size}, &copy_status)) {
+          RecordError(std::move(copy_status));
+          return;
+        }
+        block_size = StepBufferPositionForward(
+            tensorstore::span<const Index>(shard_shape, rank - 1), block_size,
+            outer_block_size, position);
+      }
+    }
+  }
+};
+
+}  // namespace
+
+absl::Status NDIterableParallelCopy(const NDIterable& input,
+                                    const NDIterable& output,
+                                    tensorstore::span<const Index> shape,
+                                    IterationConstraints constraints,
+                                    size_t max_shards, const Executor& executor,
+                                    Arena* arena) {
+  NDIterableCopyManager copy_manager(&input, &output);
+  NDIterationLayoutInfo<> layout_info(copy_manager, shape, constraints);
+  if (layout_info.empty) return absl::OkStatus();
+  tensorstore::span<const Index> iteration_shape = layout_info.iteration_shape;
+  const Index outer_extent = iteration_shape[0];
+  Index total_elements = 1;
+  for (const Index size : iteration_shape) {
+    total_elements = wrap_on_overflow::Multiply(total_elements, size);
+  }
+  const size_t num_shards = static_cast<size_t>(std::min(
+      {static_cast<Index>(max_shards), outer_extent,
+       std::max(Index(1), total_elements / kMinElementsPerCopyShard)}));
+  if (num_shards <= 1) {
+    NDIterableCopier copier(input, output, shape, constraints, arena);
+    return copier.Copy();
+  }
+  ParallelCopyState state{
+      copy_manager, layout_info.layout_view(),
+      GetNDIterationBlockShape(copy_manager.GetWorkingMemoryBytesPerElement(
+                                   layout_info.layout_view()),
+                               iteration_shape)};
+  // Partition `[0, outer_extent)` into `num_shards` contiguous ranges.  All
+  // but the first shard run on `executor`; the first runs on the calling
+  // thread.
+  absl::BlockingCounter counter(static_cast<int>(num_shards) - 1);
+  const Index base_size = outer_extent / static_cast<Index>(num_shards);
+  const Index remainder = outer_extent % static_cast<Index>(num_shards);
+  const Index first_end = base_size + (remainder != 0);
+  Index begin = first_end;
+  for (size_t shard = 1; shard < num_shards; ++shard) {
+    const Index end =
+        begin + base_size + (static_cast<Index>(shard) < remainder);
+    executor([&state, &counter, begin, end] {
+      state.CopyShard(begin, end);
+      counter.DecrementCount();
+    });
+    begin = end;
+  }
+  state.CopyShard(0, first_end);
+  counter.Wait();
+  absl::MutexLock lock(&state.mu);
+  return std::move(state.status);
+}
+
 }  // namespace internal
 }  // namespace tensorstore
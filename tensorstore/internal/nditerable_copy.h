@@ -35,6 +35,7 @@
 #include "tensorstore/internal/nditerable_buffer_management.h"
 #include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/rank.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/span.h"
 
@@ -156,6 +157,11 @@ struct NDIteratorCopyManager {
   NDIterator::Ptr output_;
   CopyImpl copy_impl_;
   SpecializedElementwiseFunctionPointer<2, void*> copy_elements_function_;
+  // Non-null only for strided buffers of trivial elements; used in place of
+  // `copy_elements_function_` for blocks whose source inner byte stride is 0
+  // (e.g. fill-value broadcasts for unmaterialized chunks).
+  SpecializedElementwiseFunctionPointer<2, void*>
+      broadcast_fill_elements_function_ = nullptr;
   NDIteratorExternalBufferManager<1, 2> buffer_manager_;
 };
 
@@ -220,6 +226,41 @@ struct NDIterableCopier {
   NDIteratorCopyManager iterator_copy_manager_;
 };
 
+/// Copies from `input` to `output` in entirety, partitioning the outermost
+/// iteration dimension across `executor`.
+///
+/// Large contiguous copies are otherwise limited to a single core; this
+/// saturates memory bandwidth by running up to `max_shards` independent
+/// `NDIteratorCopyManager` instances, each over a contiguous sub-range of the
+/// outermost iteration dimension.  Falls back to a sequential
+/// `NDIterableCopier` when the copy volume is too small for parallelism to pay
+/// off, when the iteration layout has only a single outer position, or when
+/// `max_shards <= 1`.
+///
+/// Blocks until the copy completes.  The calling thread participates in the
+/// copy.
+///
+/// \param input The input (source) iterable.
+/// \param output The output (destination) iterable.
+/// \param shape The implicitly-associated shape of both `input` and `output`.
+/// \param constraints Constraints on the iteration order.
+/// \param max_shards Maximum number of copy shards, typically the concurrency
+///     limit of the executor (e.g. the `data_copy_concurrency` limit).
+/// \param executor Executor used to run all but one of the shards.
+/// \param arena Arena to use for memory allocation when falling back to a
+///     sequential copy.  Must be non-null.  (Each shard of a parallel copy
+///     uses its own arena.)
+/// \dchecks `input.dtype() == output.dtype()`.
+/// \requires `input` and `output` support concurrent iteration via separate
+///     iterators obtained from multiple threads (true of array-backed
+///     iterables).
+absl::Status NDIterableParallelCopy(const NDIterable& input,
+                                    const NDIterable& output,
+                                    tensorstore::span<const Index> shape,
+                                    IterationConstraints constraints,
+                                    size_t max_shards, const Executor& executor,
+                                    Arena* arena);
+
 }  // namespace internal
 }  // namespace tensorstore
 
@@ -37,7 +37,10 @@
 #include "tensorstore/internal/nditerable_elementwise_output_transform.h"
 #include "tensorstore/internal/nditerable_transformed_array.h"
 #include "tensorstore/internal/nditerable_util.h"
+#include "tensorstore/internal/thread/thread_pool.h"
 #include "tensorstore/rank.h"
+#include "tensorstore/strided_layout.h"
+#include "tensorstore/util/element_pointer.h"
 #include "tensorstore/util/iterate.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
@@ -85,6 +88,30 @@ TEST(NDIterableCopyTest, Example) {
   EXPECT_EQ(MakeArray<int>({{1, 2, 3}, {4, 0, 0}}), dest_array);
 }
 
+// Tests copying from a fully-broadcast (zero-stride) source, which exercises
+// the broadcast fill fast path for strided buffers.
+TEST(NDIterableCopyTest, BroadcastSource) {
+  int value = 42;
+  tensorstore::SharedArray<const int, 2> source_array(
+      tensorstore::UnownedToShared(tensorstore::ElementPointer<int>(&value)),
+      tensorstore::StridedLayout<2>({4, 5}, {0, 0}));
+  auto dest_array = tensorstore::AllocateArray<int>(
+      {4, 5}, tensorstore::c_order, tensorstore::value_init);
+  tensorstore::internal::Arena arena;
+  auto source_iterable =
+      GetTransformedArrayNDIterable(source_array, &arena).value();
+  auto dest_iterable =
+      GetTransformedArrayNDIterable(dest_array, &arena).value();
+  tensorstore::internal::NDIterableCopier copier(
+      *source_iterable, *dest_iterable, dest_array.shape(),
+      /*constraints=*/{}, &arena);
+  TENSORSTORE_EXPECT_OK(copier.Copy());
+  EXPECT_EQ(tensorstore::BroadcastArray(
+                tensorstore::MakeScalarArray<int>(42), dest_array.domain())
+                .value(),
+            dest_array);
+}
+
 /// Copies from a transformed array with an elementwise input transform to a
 /// transformed array with an elementwise output transform.
 template <typename IntermediateElement, typename SourceArray,
@@ -216,4 +243,116 @@ TEST_P(MaybeUnitBlockSizeTest, InnerIndexArray) {
   EXPECT_EQ(expected, dest);
 }
 
+// Copies a large array with `NDIterableParallelCopy` and verifies the result
+// matches the source.  The copy volume exceeds the minimum shard size, so the
+// copy is actually partitioned across the executor.
+TEST(NDIterableParallelCopyTest, LargeContiguous) {
+  auto source = tensorstore::AllocateArray<int>({16, 256, 512});
+  auto dest = tensorstore::AllocateArray<int>({16, 256, 512},
+                                              tensorstore::c_order,
+                                              tensorstore::value_init);
+  int value = 0;
+  for (Index i = 0; i < 16; ++i) {
+    for (Index j = 0; j < 256; ++j) {
+      for (Index k = 0; k < 512; ++k) {
+        source(i, j, k) = value++;
+      }
+    }
+  }
+  tensorstore::internal::Arena arena;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<const int>>(source), &arena));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto dest_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<int>>(dest), &arena));
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::NDIterableParallelCopy(
+      *source_iterable, *dest_iterable, dest.shape(), /*constraints=*/{},
+      /*max_shards=*/4, tensorstore::internal::DetachedThreadPool(4), &arena));
+  EXPECT_EQ(source, dest);
+}
+
+// Same as above but for a rank-1 copy, where the partitioned dimension is
+// also the innermost dimension.
+TEST(NDIterableParallelCopyTest, Rank1) {
+  constexpr Index kLength = 2 * 1024 * 1024 + 7;
+  auto source = tensorstore::AllocateArray<int>({kLength});
+  auto dest = tensorstore::AllocateArray<int>(
+      {kLength}, tensorstore::c_order, tensorstore::value_init);
+  for (Index i = 0; i < kLength; ++i) source(i) = static_cast<int>(i);
+  tensorstore::internal::Arena arena;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<const int>>(source), &arena));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto dest_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<int>>(dest), &arena));
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::NDIterableParallelCopy(
+      *source_iterable, *dest_iterable, dest.shape(), /*constraints=*/{},
+      /*max_shards=*/4, tensorstore::internal::DetachedThreadPool(4), &arena));
+  EXPECT_EQ(source, dest);
+}
+
+// Copies between C-order and F-order arrays, exercising the cache-blocked
+// transpose kernel for strided buffers.  Uses extents that are not a
+// multiple of the tile or SIMD block size.
+template <typename Element>
+void TestTransposeCopy() {
+  constexpr Index kRows = 70;
+  constexpr Index kCols = 131;
+  auto source = tensorstore::AllocateArray<Element>({kRows, kCols});
+  auto dest = tensorstore::AllocateArray<Element>(
+      {kRows, kCols}, tensorstore::fortran_order, tensorstore::value_init);
+  int value = 0;
+  for (Index i = 0; i < kRows; ++i) {
+    for (Index j = 0; j < kCols; ++j) {
+      source(i, j) = static_cast<Element>(value++);
+    }
+  }
+  tensorstore::internal::Arena arena;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<const Element>>(source),
+          &arena));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto dest_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<Element>>(dest), &arena));
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::NDIterableCopier(
+                            *source_iterable, *dest_iterable, dest.shape(),
+                            /*constraints=*/{}, &arena)
+                            .Copy());
+  EXPECT_EQ(source, dest);
+}
+
+TEST(NDIterableCopyTest, TransposeUint8) { TestTransposeCopy<uint8_t>(); }
+TEST(NDIterableCopyTest, TransposeUint16) { TestTransposeCopy<uint16_t>(); }
+TEST(NDIterableCopyTest, TransposeFloat) { TestTransposeCopy<float>(); }
+TEST(NDIterableCopyTest, TransposeDouble) { TestTransposeCopy<double>(); }
+
+// Small copies fall back to the sequential `NDIterableCopier`.
+TEST(NDIterableParallelCopyTest, SmallFallsBackToSequential) {
+  auto source = MakeArray<int>({{1, 2, 3}, {4, 5, 6}});
+  auto dest = tensorstore::AllocateArray<int>({2, 3}, tensorstore::c_order,
+                                              tensorstore::value_init);
+  tensorstore::internal::Arena arena;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto source_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<const int>>(source), &arena));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto dest_iterable,
+      GetTransformedArrayNDIterable(
+          tensorstore::TransformedArray<Shared<int>>(dest), &arena));
+  TENSORSTORE_ASSERT_OK(tensorstore::internal::NDIterableParallelCopy(
+      *source_iterable, *dest_iterable, dest.shape(), /*constraints=*/{},
+      /*max_shards=*/4, tensorstore::internal::DetachedThreadPool(4), &arena));
+  EXPECT_EQ(source, dest);
+}
+
 }  // namespace
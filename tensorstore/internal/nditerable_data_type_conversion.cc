@@ -28,12 +28,28 @@
 #include "tensorstore/internal/nditerable_elementwise_output_transform.h"
 #include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/internal/unique_with_intrusive_allocator.h"
+#include "tensorstore/internal/vectorized_data_type_conversion.h"
 
 namespace tensorstore {
 namespace internal {
 
 namespace {
 
+/// Substitutes a vectorized conversion kernel for the generic element-at-a-time
+/// converter when one is available for the `from` -> `to` pair.  The
+/// vectorized kernels are stateless, so the closure context is left unchanged.
+ElementwiseClosure<2, void*> MaybeVectorizeConversion(
+    DataType from, DataType to, ElementwiseClosure<2, void*> closure) {
+  if (from->id == DataTypeId::custom || to->id == DataTypeId::custom) {
+    return closure;
+  }
+  if (const auto* function =
+          GetVectorizedDataTypeConversion(from->id, to->id)) {
+    closure.function = function;
+  }
+  return closure;
+}
+
 /// CRTP base class implementation of `NDIterable` that simply forwards all
 /// method calls to a contained `NDIterable`.
 ///
@@ -119,9 +135,10 @@ NDIterable::Ptr GetConvertedInputNDIterable(
     return MakeUniqueWithVirtualIntrusiveAllocator<ReinterpretCastNDIterable>(
         allocator, std::move(iterable), target_type);
   }
-  return GetElementwiseInputTransformNDIterable({{std::move(iterable)}},
-                                                target_type, conversion.closure,
-                                                allocator.arena());
+  auto closure = MaybeVectorizeConversion(iterable->dtype(), target_type,
+                                          conversion.closure);
+  return GetElementwiseInputTransformNDIterable(
+      {{std::move(iterable)}}, target_type, closure, allocator.arena());
 }
 
 NDIterable::Ptr GetConvertedOutputNDIterable(
@@ -136,8 +153,10 @@ NDIterable::Ptr GetConvertedOutputNDIterable(
     return MakeUniqueWithVirtualIntrusiveAllocator<ReinterpretCastNDIterable>(
         allocator, std::move(iterable), source_type);
   }
+  auto closure = MaybeVectorizeConversion(source_type, iterable->dtype(),
+                                          conversion.closure);
   return GetElementwiseOutputTransformNDIterable(
-      std::move(iterable), source_type, conversion.closure, allocator.arena());
+      std::move(iterable), source_type, closure, allocator.arena());
 }
 
 }  // namespace internal
@@ -37,6 +37,7 @@
 #include "tensorstore/internal/nditerable_array.h"
 #include "tensorstore/internal/nditerable_copy.h"
 #include "tensorstore/internal/nditerable_transformed_array.h"
+#include "tensorstore/internal/nditerable_util.h"
 #include "tensorstore/util/result.h"
 #include "tensorstore/util/span.h"
 #include "tensorstore/util/status.h"
@@ -52,6 +53,7 @@ using ::tensorstore::Shared;
 using ::tensorstore::SharedArray;
 using ::tensorstore::TransformedArray;
 using ::tensorstore::internal::GetDataTypeConverter;
+using ::tensorstore::internal::NDIterableCopyManager;
 using ::testing::Pair;
 
 using ::tensorstore::dtypes::json_t;
@@ -113,6 +115,53 @@ TEST_P(NDIterableDataTypeConversionTest, Int32ToString) {
               Pair(absl::OkStatus(), MakeArray<string_t>({"1", "2", "3"})));
 }
 
+// When a converted iterable is copied to or from an array iterable, the
+// conversion function must operate directly on the buffer provided by the
+// array iterable, so that the conversion happens during the single copy out
+// of (or into) the source block rather than through an intermediate buffer.
+// These tests pin the `BufferSource` selection that guarantees this.
+TEST(NDIterableDataTypeConversionBufferSourceTest, ConvertedInput) {
+  tensorstore::internal::Arena arena;
+  auto source = MakeArray<int32_t>({1, 2, 3});
+  auto target = tensorstore::AllocateArray(
+      source.shape(), tensorstore::c_order, tensorstore::value_init,
+      dtype_v<float>);
+  auto source_iterable = GetConvertedInputNDIterable(
+      tensorstore::internal::GetArrayNDIterable(source, &arena), dtype_v<float>,
+      GetDataTypeConverter(dtype_v<int32_t>, dtype_v<float>));
+  auto target_iterable =
+      tensorstore::internal::GetArrayNDIterable(target, &arena);
+  NDIterableCopyManager copy_manager(source_iterable.get(),
+                                     target_iterable.get());
+  tensorstore::internal::NDIterationLayoutInfo<> layout_info(
+      copy_manager, target.shape(), tensorstore::c_order);
+  // The conversion fills the target buffer directly.
+  EXPECT_EQ(NDIterableCopyManager::BufferSource::kOutput,
+            copy_manager.GetBufferParameters(layout_info.layout_view())
+                .buffer_source);
+}
+
+TEST(NDIterableDataTypeConversionBufferSourceTest, ConvertedOutput) {
+  tensorstore::internal::Arena arena;
+  auto source = MakeArray<int32_t>({1, 2, 3});
+  auto target = tensorstore::AllocateArray(
+      source.shape(), tensorstore::c_order, tensorstore::value_init,
+      dtype_v<float>);
+  auto source_iterable =
+      tensorstore::internal::GetArrayNDIterable(source, &arena);
+  auto target_iterable = GetConvertedOutputNDIterable(
+      tensorstore::internal::GetArrayNDIterable(target, &arena),
+      dtype_v<int32_t>, GetDataTypeConverter(dtype_v<int32_t>, dtype_v<float>));
+  NDIterableCopyManager copy_manager(source_iterable.get(),
+                                     target_iterable.get());
+  tensorstore::internal::NDIterationLayoutInfo<> layout_info(
+      copy_manager, target.shape(), tensorstore::c_order);
+  // The conversion consumes the source buffer directly.
+  EXPECT_EQ(NDIterableCopyManager::BufferSource::kInput,
+            copy_manager.GetBufferParameters(layout_info.layout_view())
+                .buffer_source);
+}
+
 TEST_P(NDIterableDataTypeConversionTest, JsonToString) {
   EXPECT_THAT(
       Convert(MakeArray<json_t>({"hello", "world", 3}), dtype_v<string_t>),
@@ -97,7 +97,6 @@ class ElementwiseInputTransformNDIterable
   }
 
  private:
-  std::array<NDIterable::Ptr, Arity> inputs_;
   DataType output_dtype_;
   ElementwiseClosure<Arity + 1, void*> closure_;
   ArenaAllocator<> allocator_;
@@ -0,0 +1,184 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/cpu_topology.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <thread>  // NOLINT
+
+#ifdef __linux__
+
+#include <sched.h>
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+
+#endif
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+size_t HardwareConcurrency() {
+  return std::max(size_t{1}, size_t{std::thread::hardware_concurrency()});
+}
+
+#ifdef __linux__
+
+// Reads the first line of a procfs/sysfs file; empty on failure.
+std::string ReadSysfsLine(const std::string& path) {
+  std::ifstream file(path);
+  std::string contents;
+  if (file.is_open()) std::getline(file, contents);
+  return contents;
+}
+
+// Returns the cpu affinity mask of the process, or `false` on failure.
+bool GetAffinityMask(::cpu_set_t* cpus) {
+  CPU_ZERO(cpus);
+  return ::sched_getaffinity(0, sizeof(*cpus), cpus) == 0 &&
+         CPU_COUNT(cpus) > 0;
+}
+
+size_t ComputeLogicalCpuCount() {
+  ::cpu_set_t cpus;
+  if (!GetAffinityMask(&cpus)) return HardwareConcurrency();
+  return static_cast<size_t>(CPU_COUNT(&cpus));
+}
+
+size_t ComputePhysicalCoreCount() {
+  ::cpu_set_t cpus;
+  if (!GetAffinityMask(&cpus)) return GetLogicalCpuCount();
+  // SMT siblings share a (package_id, core_id) pair.
+  std::set<std::pair<int, int>> cores;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (!CPU_ISSET(cpu, &cpus)) continue;
+    int package_id, core_id;
+    if (!absl::SimpleAtoi(
+            ReadSysfsLine(absl::StrCat("/sys/devices/system/cpu/cpu", cpu,
+                                       "/topology/physical_package_id")),
+            &package_id) ||
+        !absl::SimpleAtoi(
+            ReadSysfsLine(absl::StrCat("/sys/devices/system/cpu/cpu", cpu,
+                                       "/topology/core_id")),
+            &core_id)) {
+      // Topology unavailable (e.g. restricted sysfs); do not guess.
+      return GetLogicalCpuCount();
+    }
+    cores.emplace(package_id, core_id);
+  }
+  return std::max(size_t{1}, cores.size());
+}
+
+// Parses a "<quota> <period>" pair (cgroup v2 `cpu.max` format), returning
+// the limit in whole cpus rounded up, or `0` if unlimited or unparseable.
+size_t ParseQuotaPeriod(std::string_view quota_str,
+                        std::string_view period_str) {
+  int64_t quota, period;
+  if (quota_str == "max" || !absl::SimpleAtoi(quota_str, &quota) ||
+      !absl::SimpleAtoi(period_str, &period) || quota <= 0 || period <= 0) {
+    return 0;
+  }
+  return static_cast<size_t>((quota + period - 1) / period);
+}
+
+size_t ComputeCgroupCpuLimit() {
+  // cgroup v2: the process's cgroup path is the "0::" entry of
+  // /proc/self/cgroup, relative to /sys/fs/cgroup.  Quotas may be imposed at
+  // any ancestor, so take the tightest limit along the path.
+  std::string cgroup_path;
+  {
+    std::ifstream file("/proc/self/cgroup");
+    std::string line;
+    while (file.is_open() && std::getline(file, line)) {
+      std::string_view entry = line;
+      if (absl::ConsumePrefix(&entry, "0::")) {
+        cgroup_path = std::string(entry);
+        break;
+      }
+    }
+  }
+  size_t limit = 0;
+  for (std::string_view dir = cgroup_path;;) {
+    std::string cpu_max =
+        ReadSysfsLine(absl::StrCat("/sys/fs/cgroup", dir, "/cpu.max"));
+    std::pair<std::string_view, std::string_view> parts =
+        absl::StrSplit(cpu_max, absl::MaxSplits(' ', 1));
+    size_t dir_limit = ParseQuotaPeriod(
+        parts.first, parts.second.empty() ? "100000" : parts.second);
+    if (dir_limit != 0 && (limit == 0 || dir_limit < limit)) {
+      limit = dir_limit;
+    }
+    size_t slash = dir.rfind('/');
+    if (slash == std::string_view::npos) break;
+    dir = dir.substr(0, slash);
+  }
+  if (limit != 0) return limit;
+  // cgroup v1 fallback: cfs quota of the mounted cpu controller.
+  return ParseQuotaPeriod(
+      ReadSysfsLine("/sys/fs/cgroup/cpu/cpu.cfs_quota_us"),
+      ReadSysfsLine("/sys/fs/cgroup/cpu/cpu.cfs_period_us"));
+}
+
+#else  // !defined(__linux__)
+
+size_t ComputeLogicalCpuCount() { return HardwareConcurrency(); }
+size_t ComputePhysicalCoreCount() { return GetLogicalCpuCount(); }
+size_t ComputeCgroupCpuLimit() { return 0; }
+
+#endif  // defined(__linux__)
+
+}  // namespace
+
+size_t GetLogicalCpuCount() {
+  static const size_t count = ComputeLogicalCpuCount();
+  return count;
+}
+
+size_t GetPhysicalCoreCount() {
+  static const size_t count = ComputePhysicalCoreCount();
+  return count;
+}
+
+size_t GetCgroupCpuLimit() {
+  static const size_t limit = ComputeCgroupCpuLimit();
+  return limit;
+}
+
+size_t GetEffectiveCpuCount() {
+  size_t count = GetLogicalCpuCount();
+  size_t limit = GetCgroupCpuLimit();
+  if (limit != 0) count = std::min(count, limit);
+  return std::max(size_t{1}, count);
+}
+
+size_t GetEffectivePhysicalCoreCount() {
+  size_t count = GetPhysicalCoreCount();
+  size_t limit = GetCgroupCpuLimit();
+  if (limit != 0) count = std::min(count, limit);
+  return std::max(size_t{1}, count);
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
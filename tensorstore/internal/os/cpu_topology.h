@@ -0,0 +1,59 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_CPU_TOPOLOGY_H_
+#define TENSORSTORE_INTERNAL_OS_CPU_TOPOLOGY_H_
+
+#include <stddef.h>
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Queries for the amount of cpu actually available to this process.
+///
+/// `std::thread::hardware_concurrency()` reports the logical cpus of the
+/// machine, which overstates what a containerized process may use: it ignores
+/// the cpu affinity mask, cgroup cpu quotas, and SMT.  These functions take
+/// those into account; on platforms where a given restriction cannot be
+/// queried it simply does not reduce the result.
+
+/// Returns the number of logical cpus this process may run on, per its cpu
+/// affinity mask.  Falls back to `std::thread::hardware_concurrency()` when
+/// the mask cannot be queried.  Always at least 1.
+size_t GetLogicalCpuCount();
+
+/// Returns the number of distinct physical cores among the cpus counted by
+/// `GetLogicalCpuCount()`, i.e. with SMT siblings counted once.  Falls back
+/// to `GetLogicalCpuCount()` when topology information is unavailable.
+/// Always at least 1.
+size_t GetPhysicalCoreCount();
+
+/// Returns the effective cpu limit imposed by the cgroup (v2 `cpu.max`, or
+/// the v1 cfs quota), rounded up to whole cpus, or `0` if no limit is set or
+/// cgroups are unsupported on this platform.
+size_t GetCgroupCpuLimit();
+
+/// Returns `GetLogicalCpuCount()` additionally capped by the cgroup cpu
+/// limit.  This is the number of threads beyond which a CPU-bound workload
+/// gains nothing and a throttled one degrades.  Always at least 1.
+size_t GetEffectiveCpuCount();
+
+/// Returns `GetPhysicalCoreCount()` additionally capped by the cgroup cpu
+/// limit.  Always at least 1.
+size_t GetEffectivePhysicalCoreCount();
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_CPU_TOPOLOGY_H_
@@ -0,0 +1,47 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/cpu_topology.h"
+
+#include <stddef.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal_os::GetCgroupCpuLimit;
+using ::tensorstore::internal_os::GetEffectiveCpuCount;
+using ::tensorstore::internal_os::GetEffectivePhysicalCoreCount;
+using ::tensorstore::internal_os::GetLogicalCpuCount;
+using ::tensorstore::internal_os::GetPhysicalCoreCount;
+
+TEST(CpuTopologyTest, Basic) {
+  size_t logical = GetLogicalCpuCount();
+  size_t physical = GetPhysicalCoreCount();
+  EXPECT_GE(logical, 1);
+  EXPECT_GE(physical, 1);
+  EXPECT_LE(physical, logical);
+}
+
+TEST(CpuTopologyTest, EffectiveCountsRespectLimits) {
+  size_t effective = GetEffectiveCpuCount();
+  EXPECT_GE(effective, 1);
+  EXPECT_LE(effective, GetLogicalCpuCount());
+  if (size_t limit = GetCgroupCpuLimit(); limit != 0) {
+    EXPECT_LE(effective, limit);
+  }
+  EXPECT_LE(GetEffectivePhysicalCoreCount(), effective);
+}
+
+}  // namespace
@@ -0,0 +1,143 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/file_change_watcher.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "tensorstore/util/result.h"
+
+#ifdef __linux__
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/os/error_code.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/util/quote_string.h"
+
+#endif  // __linux__
+
+namespace tensorstore {
+namespace internal_os {
+
+#ifndef __linux__
+
+std::unique_ptr<FileChangeWatcher> FileChangeWatcher::Create() {
+  return nullptr;
+}
+
+#else  // __linux__
+
+namespace {
+
+using ::tensorstore::internal::StatusFromOsError;
+
+/// Events that indicate that an immediate entry of the watched directory may
+/// have been added, removed, or modified, or that the directory itself is
+/// gone.
+constexpr uint32_t kWatchMask = IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE |
+                                IN_DELETE | IN_DELETE_SELF | IN_MODIFY |
+                                IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO |
+                                IN_ONLYDIR;
+
+class InotifyWatcher final : public FileChangeWatcher {
+ public:
+  explicit InotifyWatcher(UniqueFileDescriptor fd) : fd_(std::move(fd)) {}
+
+  Result<WatchToken> WatchDirectory(const std::string& path) override {
+    // The watch is registered before draining pending events, so that a
+    // change racing with registration invalidates the returned token rather
+    // than going unnoticed.
+    int wd = ::inotify_add_watch(fd_.get(), path.c_str(), kWatchMask);
+    if (wd == -1) {
+      return StatusFromOsError(errno,
+                               "Failed to watch: ", QuoteString(path));
+    }
+    absl::MutexLock lock(&mutex_);
+    DrainEvents();
+    auto [it, inserted] = epochs_.try_emplace(wd, 0);
+    if (inserted) {
+      // Watch descriptors are reused by the kernel once removed; start each
+      // incarnation at a distinct epoch so that tokens from a previous
+      // incarnation of the same descriptor never validate.
+      it->second = ++epoch_counter_;
+    }
+    return WatchToken{wd, it->second};
+  }
+
+  bool Unchanged(WatchToken token) override {
+    absl::MutexLock lock(&mutex_);
+    DrainEvents();
+    auto it = epochs_.find(token.wd);
+    return it != epochs_.end() && it->second == token.epoch;
+  }
+
+ private:
+  /// Processes all pending events, advancing the epoch of each affected
+  /// watch.  The descriptor is non-blocking, so this never waits.
+  void DrainEvents() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    alignas(struct inotify_event) char buf[4096];
+    while (true) {
+      ssize_t n;
+      do {
+        n = ::read(fd_.get(), buf, sizeof(buf));
+      } while (n < 0 && errno == EINTR);
+      if (n <= 0) break;  // EAGAIN: no pending events.
+      for (char* p = buf; p < buf + n;) {
+        auto* event = reinterpret_cast<struct inotify_event*>(p);
+        if (event->mask & IN_Q_OVERFLOW) {
+          // Events were dropped; conservatively invalidate every token.
+          for (auto& [wd, epoch] : epochs_) {
+            epoch = ++epoch_counter_;
+          }
+        } else if (auto it = epochs_.find(event->wd); it != epochs_.end()) {
+          it->second = ++epoch_counter_;
+          if (event->mask & IN_IGNORED) {
+            // The watch was removed (e.g. the directory was deleted).
+            epochs_.erase(it);
+          }
+        }
+        p += sizeof(struct inotify_event) + event->len;
+      }
+    }
+  }
+
+  UniqueFileDescriptor fd_;
+  absl::Mutex mutex_;
+  uint64_t epoch_counter_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<int, uint64_t> epochs_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace
+
+std::unique_ptr<FileChangeWatcher> FileChangeWatcher::Create() {
+  int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd == -1) return nullptr;
+  return std::make_unique<InotifyWatcher>(UniqueFileDescriptor(fd));
+}
+
+#endif  // __linux__
+
+}  // namespace internal_os
+}  // namespace tensorstore
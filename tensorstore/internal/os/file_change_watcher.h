@@ -0,0 +1,72 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_FILE_CHANGE_WATCHER_H_
+#define TENSORSTORE_INTERNAL_OS_FILE_CHANGE_WATCHER_H_
+
+/// \file Change notification for the immediate entries of watched
+/// directories, used to avoid re-validating cached file metadata with a
+/// ::stat round-trip per read.
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Identifies a point in a watched directory's event history.  Returned by
+/// `FileChangeWatcher::WatchDirectory`; treat as opaque.
+struct WatchToken {
+  int wd = -1;
+  uint64_t epoch = 0;
+};
+
+/// Watches directories for modifications using an OS change-notification
+/// facility (inotify on Linux).
+///
+/// Usage: call `WatchDirectory` on a file's parent directory *before*
+/// deriving metadata from the file (e.g. via ::fstat), and retain the
+/// returned token with the cached metadata.  Before reusing the metadata,
+/// call `Unchanged` with the token: if it returns `true`, no immediate entry
+/// of the directory has been created, modified, renamed, or deleted since
+/// the token was obtained, so the metadata is still current.  `Unchanged` is
+/// conservative: event-queue overflow, removal of the watch, or any other
+/// uncertainty invalidates outstanding tokens.
+///
+/// All methods are thread-safe.
+class FileChangeWatcher {
+ public:
+  virtual ~FileChangeWatcher() = default;
+
+  /// Creates a watcher, or returns `nullptr` if change notification is not
+  /// supported on this platform.
+  static std::unique_ptr<FileChangeWatcher> Create();
+
+  /// Begins (or continues) watching the directory `path`, returning a token
+  /// representing its current state.
+  virtual Result<WatchToken> WatchDirectory(const std::string& path) = 0;
+
+  /// Returns `true` if no changes to the immediate entries of the watched
+  /// directory have occurred since `token` was obtained.
+  virtual bool Unchanged(WatchToken token) = 0;
+};
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_FILE_CHANGE_WATCHER_H_
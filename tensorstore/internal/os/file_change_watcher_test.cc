@@ -0,0 +1,81 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/file_change_watcher.h"
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_os::DeleteFile;
+using ::tensorstore::internal_os::FileChangeWatcher;
+using ::tensorstore::internal_os::OpenFileWrapper;
+using ::tensorstore::internal_os::OpenFlags;
+using ::tensorstore::internal_os::WriteCordToFile;
+using ::tensorstore::internal_testing::ScopedTemporaryDirectory;
+
+void WriteFile(const std::string& path, const std::string& contents) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto f, OpenFileWrapper(path, OpenFlags::DefaultWrite));
+  TENSORSTORE_ASSERT_OK(WriteCordToFile(f.get(), absl::Cord(contents)));
+}
+
+TEST(FileChangeWatcherTest, Basic) {
+  auto watcher = FileChangeWatcher::Create();
+  if (!watcher) {
+    GTEST_SKIP() << "Change notification is not supported";
+  }
+
+  ScopedTemporaryDirectory tempdir;
+  WriteFile(tempdir.path() + "/foo.txt", "foo");
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto token,
+                                   watcher->WatchDirectory(tempdir.path()));
+  EXPECT_TRUE(watcher->Unchanged(token));
+
+  // Modifying a file in the directory invalidates the token.
+  WriteFile(tempdir.path() + "/foo.txt", "bar");
+  EXPECT_FALSE(watcher->Unchanged(token));
+
+  // Re-watching yields a valid token again.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(token,
+                                   watcher->WatchDirectory(tempdir.path()));
+  EXPECT_TRUE(watcher->Unchanged(token));
+
+  // Deleting a file also invalidates the token.
+  TENSORSTORE_ASSERT_OK(DeleteFile(tempdir.path() + "/foo.txt"));
+  EXPECT_FALSE(watcher->Unchanged(token));
+}
+
+TEST(FileChangeWatcherTest, MissingDirectory) {
+  auto watcher = FileChangeWatcher::Create();
+  if (!watcher) {
+    GTEST_SKIP() << "Change notification is not supported";
+  }
+
+  ScopedTemporaryDirectory tempdir;
+  EXPECT_THAT(watcher->WatchDirectory(tempdir.path() + "/missing"),
+              StatusIs(absl::StatusCode::kNotFound));
+}
+
+}  // namespace
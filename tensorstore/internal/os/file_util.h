@@ -32,6 +32,7 @@
 #include "tensorstore/internal/os/memory_region.h"
 #include "tensorstore/internal/os/unique_handle.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
 
 // Include system headers last to reduce impact of macros.
 #ifndef _WIN32
@@ -141,6 +142,16 @@ inline Result<UniqueFileDescriptor> OpenExistingFileForReading(
   return OpenFileWrapper(path, OpenFlags::OpenReadOnly);
 }
 
+#ifndef _WIN32
+/// Wrapper around ::openat; opens `path` relative to the open directory
+/// descriptor `dir_fd`.  Not available on Windows.
+///
+/// \returns The open file descriptor or a failure absl::Status code.
+Result<UniqueFileDescriptor> OpenFileWrapperAt(FileDescriptor dir_fd,
+                                               const std::string& path,
+                                               OpenFlags flags);
+#endif
+
 /// Reads from an open file.
 ///
 /// \param fd Open file descriptor.
@@ -151,6 +162,26 @@ inline Result<UniqueFileDescriptor> OpenExistingFileForReading(
 Result<ptrdiff_t> ReadFromFile(FileDescriptor fd, void* buf, size_t count,
                                int64_t offset);
 
+/// Destination buffer for a vectored read via `ReadvFromFile`.
+struct ReadVecBuffer {
+  char* data;
+  size_t size;
+};
+
+/// Reads consecutive bytes from an open file, scattering them across
+/// `buffers` in order.  Uses vectored I/O (::preadv) where available, so that
+/// a single system call can fill multiple buffers.  A buffer with
+/// `size == 0` is permitted and skipped.
+///
+/// \param fd Open file descriptor.
+/// \param buffers[out] Buffers to fill.
+/// \param offset Byte offset within file at which to start reading.
+/// \returns Total number of bytes read, which is less than the combined
+///     buffer size only at end of file, or a failure absl::Status code.
+Result<ptrdiff_t> ReadvFromFile(FileDescriptor fd,
+                                span<const ReadVecBuffer> buffers,
+                                int64_t offset);
+
 /// Reads the entire file into a string.
 ///
 /// \param fd Open file descriptor.
@@ -172,6 +203,47 @@ Result<ptrdiff_t> WriteToFile(FileDescriptor fd, const void* buf, size_t count);
 /// \returns Number of bytes written or a failure absl::Status code.
 Result<ptrdiff_t> WriteCordToFile(FileDescriptor fd, absl::Cord value);
 
+/// Enables or disables direct (unbuffered) I/O on an open file descriptor,
+/// bypassing the page cache where supported (`O_DIRECT` on Linux,
+/// `F_NOCACHE` on macOS).
+///
+/// \returns `absl::OkStatus` on success, or `kUnimplemented` if direct I/O
+///     is not supported on this platform or filesystem, or another failure
+///     absl::Status code.
+absl::Status SetDirectIo(FileDescriptor fd, bool direct);
+
+/// Writes the entirety of `value` to `fd`, which must be positioned at a
+/// page-aligned offset (e.g. the start of an empty file), bypassing the page
+/// cache for the page-aligned bulk of the data.  The data is staged through a
+/// page-aligned bounce buffer to satisfy direct I/O alignment requirements;
+/// any unaligned tail is written with ordinary buffered I/O.  The descriptor
+/// is returned to buffered mode before returning.
+///
+/// Intended for large values whose contents will not be read back soon, so
+/// that bulk writes do not evict the read working set from the page cache.
+///
+/// \returns Number of bytes written (always `value.size()` on success), or
+///     `kUnimplemented` if direct I/O is not supported on this platform or
+///     filesystem (in which case nothing has been written and the caller may
+///     fall back to buffered writes), or another failure absl::Status code.
+Result<ptrdiff_t> WriteCordToFileDirect(FileDescriptor fd, absl::Cord value);
+
+/// Copies `size` bytes from the beginning of `src_fd` to `dest_fd`, which
+/// must be positioned at the start of the file.  On Linux the copy is
+/// performed in the kernel via `::copy_file_range`, which on supporting
+/// filesystems shares extents with the source (reflink) rather than
+/// duplicating the data; otherwise the contents are streamed through a
+/// userspace buffer.
+///
+/// \param src_fd Source file descriptor opened for reading.
+/// \param dest_fd Destination file descriptor opened for writing.
+/// \param size Number of bytes to copy.
+/// \returns Number of bytes copied (always `size` on success), or
+///     `kOutOfRange` if the source file is shorter than `size`, or another
+///     failure absl::Status code.
+Result<ptrdiff_t> CopyFileContents(FileDescriptor src_fd,
+                                   FileDescriptor dest_fd, int64_t size);
+
 /// Truncates an open file.
 ///
 /// \returns `absl::OkStatus` on success, or a failure absl::Status code.
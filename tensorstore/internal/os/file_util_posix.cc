@@ -21,6 +21,7 @@
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <sys/file.h>
@@ -29,6 +30,7 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
@@ -257,6 +259,27 @@ Result<UniqueFileDescriptor> OpenFileWrapper(const std::string& path,
   }
 }
 
+Result<UniqueFileDescriptor> OpenFileWrapperAt(FileDescriptor dir_fd,
+                                               const std::string& path,
+                                               OpenFlags flags) {
+  LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
+                        {{"dir_fd", dir_fd}, {"path", path}});
+
+  FileDescriptor fd;
+  {
+    PotentiallyBlockingRegion region;
+    fd = ::openat(dir_fd, path.c_str(), static_cast<int>(flags) | O_CLOEXEC,
+                  0666);
+  }
+  if (fd == FileDescriptorTraits::Invalid()) {
+    auto status =
+        StatusFromOsError(errno, "Failed to open: ", QuoteString(path));
+    return std::move(tspan).EndWithStatus(std::move(status));
+  }
+  tspan.Log("fd", fd);
+  return UniqueFileDescriptor(fd);
+}
+
 Result<ptrdiff_t> ReadFromFile(FileDescriptor fd, void* buf, size_t count,
                                int64_t offset) {
   LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
@@ -273,6 +296,68 @@ Result<ptrdiff_t> ReadFromFile(FileDescriptor fd, void* buf, size_t count,
   return std::move(tspan).EndWithStatus(std::move(status));
 }
 
+Result<ptrdiff_t> ReadvFromFile(FileDescriptor fd,
+                                span<const ReadVecBuffer> buffers,
+                                int64_t offset) {
+  LoggedTraceSpan tspan(
+      __func__, detail_logging.Level(1),
+      {{"fd", fd}, {"buffers", buffers.size()}, {"offset", offset}});
+  ptrdiff_t total = 0;
+#ifdef __linux__
+  absl::InlinedVector<struct iovec, 8> iovs(buffers.size());
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    iovs[i].iov_base = buffers[i].data;
+    iovs[i].iov_len = buffers[i].size;
+  }
+  size_t first = 0;
+  while (first < iovs.size()) {
+    if (iovs[first].iov_len == 0) {
+      ++first;
+      continue;
+    }
+    const int iov_count = static_cast<int>(
+        std::min(iovs.size() - first, static_cast<size_t>(IOV_MAX)));
+    ssize_t n;
+    do {
+      PotentiallyBlockingRegion region;
+      n = ::preadv(fd, &iovs[first], iov_count,
+                   static_cast<off_t>(offset + total));
+    } while ((n < 0) && (errno == EINTR || errno == EAGAIN));
+    if (n < 0) {
+      auto status = StatusFromOsError(errno, "Failed to read from file");
+      return std::move(tspan).EndWithStatus(std::move(status));
+    }
+    if (n == 0) break;  // End of file.
+    total += n;
+    // Advance past fully-filled buffers; adjust a partially-filled buffer.
+    size_t consumed = static_cast<size_t>(n);
+    while (first < iovs.size() && consumed >= iovs[first].iov_len) {
+      consumed -= iovs[first].iov_len;
+      ++first;
+    }
+    if (first < iovs.size() && consumed > 0) {
+      iovs[first].iov_base = static_cast<char*>(iovs[first].iov_base) + consumed;
+      iovs[first].iov_len -= consumed;
+    }
+  }
+#else
+  // ::preadv is not reliably available; fall back to one ::pread per buffer.
+  for (const auto& buffer : buffers) {
+    size_t buffer_offset = 0;
+    while (buffer_offset < buffer.size) {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto n,
+          ReadFromFile(fd, buffer.data + buffer_offset,
+                       buffer.size - buffer_offset, offset + total));
+      if (n == 0) return total;  // End of file.
+      buffer_offset += static_cast<size_t>(n);
+      total += n;
+    }
+  }
+#endif
+  return total;
+}
+
 Result<ptrdiff_t> WriteToFile(FileDescriptor fd, const void* buf,
                               size_t count) {
   LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
@@ -319,6 +404,154 @@ Result<ptrdiff_t> WriteCordToFile(FileDescriptor fd, absl::Cord value) {
   return std::move(tspan).EndWithStatus(std::move(status));
 }
 
+absl::Status SetDirectIo(FileDescriptor fd, bool direct) {
+  LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
+                        {{"fd", fd}, {"direct", direct}});
+#if defined(__linux__)
+  int flags = ::fcntl(fd, F_GETFL);
+  if (flags != -1) {
+    const int new_flags = direct ? (flags | O_DIRECT) : (flags & ~O_DIRECT);
+    if (new_flags == flags || ::fcntl(fd, F_SETFL, new_flags) != -1) {
+      return absl::OkStatus();
+    }
+  }
+  if (errno == EINVAL) {
+    // The filesystem does not support O_DIRECT.
+    return absl::UnimplementedError("O_DIRECT not supported");
+  }
+  auto status = StatusFromOsError(errno, "Failed to change O_DIRECT");
+  return std::move(tspan).EndWithStatus(std::move(status));
+#elif defined(__APPLE__)
+  if (::fcntl(fd, F_NOCACHE, direct ? 1 : 0) != -1) {
+    return absl::OkStatus();
+  }
+  auto status = StatusFromOsError(errno, "Failed to change F_NOCACHE");
+  return std::move(tspan).EndWithStatus(std::move(status));
+#else
+  return absl::UnimplementedError("Direct I/O not supported");
+#endif
+}
+
+Result<ptrdiff_t> WriteCordToFileDirect(FileDescriptor fd, absl::Cord value) {
+  LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
+                        {{"fd", fd}, {"count", value.size()}});
+  // Size of the page-aligned bounce buffer through which the data is staged.
+  constexpr size_t kBounceBufferSize = 4 * 1024 * 1024;
+
+  const size_t total_size = value.size();
+  const size_t alignment = GetDefaultPageSize();
+  const size_t aligned_size = total_size & ~(static_cast<size_t>(alignment) - 1);
+  if (aligned_size == 0) {
+    // Too small to benefit from bypassing the page cache.
+    return absl::UnimplementedError("Value smaller than a page");
+  }
+  TENSORSTORE_RETURN_IF_ERROR(SetDirectIo(fd, true));
+  MemoryRegion buffer = AllocateAlignedRegion(
+      alignment, std::min(aligned_size, kBounceBufferSize));
+  absl::Cord::CharIterator char_it = value.char_begin();
+  size_t remaining = aligned_size;
+  while (remaining > 0) {
+    const size_t chunk_size = std::min(remaining, buffer.size());
+    size_t copied = 0;
+    while (copied < chunk_size) {
+      std::string_view fragment = absl::Cord::ChunkRemaining(char_it);
+      const size_t len = std::min(fragment.size(), chunk_size - copied);
+      std::memcpy(buffer.data() + copied, fragment.data(), len);
+      absl::Cord::Advance(&char_it, len);
+      copied += len;
+    }
+    size_t buffer_offset = 0;
+    while (buffer_offset < chunk_size) {
+      ssize_t n;
+      do {
+        PotentiallyBlockingRegion region;
+        n = ::write(fd, buffer.data() + buffer_offset,
+                    chunk_size - buffer_offset);
+      } while ((n < 0) && (errno == EINTR || errno == EAGAIN));
+      if (n <= 0) {
+        if (n == 0) errno = ENOSPC;
+        auto status = StatusFromOsError(errno, "Failed to write to file");
+        // Best-effort restoration of buffered mode.
+        SetDirectIo(fd, false).IgnoreError();
+        return std::move(tspan).EndWithStatus(std::move(status));
+      }
+      buffer_offset += static_cast<size_t>(n);
+    }
+    remaining -= chunk_size;
+  }
+  TENSORSTORE_RETURN_IF_ERROR(SetDirectIo(fd, false));
+  // Write the unaligned tail with ordinary buffered I/O.
+  value.RemovePrefix(aligned_size);
+  while (!value.empty()) {
+    TENSORSTORE_ASSIGN_OR_RETURN(auto n, WriteCordToFile(fd, value));
+    value.RemovePrefix(n);
+  }
+  return static_cast<ptrdiff_t>(total_size);
+}
+
+Result<ptrdiff_t> CopyFileContents(FileDescriptor src_fd,
+                                   FileDescriptor dest_fd, int64_t size) {
+  LoggedTraceSpan tspan(
+      __func__, detail_logging.Level(1),
+      {{"src_fd", src_fd}, {"dest_fd", dest_fd}, {"size", size}});
+  // Size of the userspace buffer used when in-kernel copy is unavailable.
+  constexpr size_t kCopyBufferSize = 256 * 1024;
+
+  int64_t total = 0;
+#ifdef __linux__
+  // ::copy_file_range performs the copy in the kernel, and on supporting
+  // filesystems shares extents with the source (reflink) rather than
+  // duplicating the data.
+  off_t off_in = 0;
+  while (total < size) {
+    ssize_t n;
+    do {
+      PotentiallyBlockingRegion region;
+      n = ::copy_file_range(src_fd, &off_in, dest_fd, nullptr,
+                            static_cast<size_t>(size - total), 0);
+    } while ((n < 0) && (errno == EINTR || errno == EAGAIN));
+    if (n < 0) {
+      if (total == 0 && (errno == EXDEV || errno == EINVAL ||
+                         errno == ENOSYS || errno == EOPNOTSUPP)) {
+        // In-kernel copy is unavailable (e.g. an old kernel, or a
+        // filesystem that does not support it); fall back to a read/write
+        // loop.
+        break;
+      }
+      auto status = StatusFromOsError(errno, "Failed to copy file contents");
+      return std::move(tspan).EndWithStatus(std::move(status));
+    }
+    if (n == 0) break;  // End of file.
+    total += n;
+  }
+#endif
+  if (total < size) {
+    MemoryRegion buffer = AllocateHeapRegion(static_cast<size_t>(
+        std::min(size - total, static_cast<int64_t>(kCopyBufferSize))));
+    while (total < size) {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          ptrdiff_t n,
+          ReadFromFile(src_fd, buffer.data(),
+                       static_cast<size_t>(std::min(
+                           static_cast<int64_t>(buffer.size()), size - total)),
+                       total));
+      if (n == 0) {
+        auto status = absl::OutOfRangeError("File shrunk while copying");
+        return std::move(tspan).EndWithStatus(std::move(status));
+      }
+      const char* p = buffer.data();
+      while (n > 0) {
+        TENSORSTORE_ASSIGN_OR_RETURN(ptrdiff_t written,
+                                     WriteToFile(dest_fd, p, n));
+        p += written;
+        n -= written;
+        total += written;
+      }
+    }
+  }
+  return static_cast<ptrdiff_t>(total);
+}
+
 absl::Status TruncateFile(FileDescriptor fd) {
   LoggedTraceSpan tspan(__func__, detail_logging.Level(1), {{"fd", fd}});
   PotentiallyBlockingRegion region;
@@ -421,7 +654,11 @@ Result<MemoryRegion> MemmapFileReadOnly(FileDescriptor fd, size_t offset,
     return std::move(tspan).EndWithStatus(
         StatusFromOsError(errno, "Failed to mmap"));
   }
+  // Mapped files are read once, mostly front to back: start readahead now and
+  // widen the readahead window, allowing pages behind the reader to be
+  // dropped early.
   ::madvise(address, size, MADV_WILLNEED);
+  ::madvise(address, size, MADV_SEQUENTIAL);
 
   mmap_count.Increment();
   mmap_bytes.IncrementBy(size);
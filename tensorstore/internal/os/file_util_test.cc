@@ -55,6 +55,8 @@ using ::tensorstore::internal_os::OpenExistingFileForReading;
 using ::tensorstore::internal_os::OpenFileWrapper;
 using ::tensorstore::internal_os::OpenFlags;
 using ::tensorstore::internal_os::ReadFromFile;
+using ::tensorstore::internal_os::ReadvFromFile;
+using ::tensorstore::internal_os::ReadVecBuffer;
 using ::tensorstore::internal_os::RenameOpenFile;
 using ::tensorstore::internal_os::TruncateFile;
 using ::tensorstore::internal_os::WriteCordToFile;
@@ -135,6 +137,91 @@ TEST(FileUtilTest, Basics) {
   }
 }
 
+#ifndef _WIN32
+TEST(FileUtilTest, OpenFileWrapperAt) {
+  using ::tensorstore::internal_os::OpenDirectoryDescriptor;
+  using ::tensorstore::internal_os::OpenFileWrapperAt;
+
+  ScopedTemporaryDirectory tempdir;
+  {
+    auto f = OpenFileWrapper(tempdir.path() + "/foo.txt",
+                             OpenFlags::DefaultWrite);
+    EXPECT_THAT(f, IsOk());
+    EXPECT_THAT(WriteToFile(f->get(), "foo", 3), IsOkAndHolds(3));
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto dir_fd,
+                                   OpenDirectoryDescriptor(tempdir.path()));
+
+  char buf[16];
+  auto f = OpenFileWrapperAt(dir_fd.get(), "foo.txt", OpenFlags::OpenReadOnly);
+  EXPECT_THAT(f, IsOk());
+  EXPECT_THAT(ReadFromFile(f->get(), buf, 3, 0), IsOkAndHolds(3));
+  EXPECT_EQ("foo", std::string_view(buf, 3));
+
+  EXPECT_THAT(
+      OpenFileWrapperAt(dir_fd.get(), "missing.txt", OpenFlags::OpenReadOnly),
+      StatusIs(absl::StatusCode::kNotFound));
+}
+#endif
+
+TEST(FileUtilTest, ReadvFromFile) {
+  ScopedTemporaryDirectory tempdir;
+  std::string foo_txt = tempdir.path() + "/foo.txt";
+  {
+    auto f = OpenFileWrapper(foo_txt, OpenFlags::DefaultWrite);
+    EXPECT_THAT(f, IsOk());
+    EXPECT_THAT(WriteToFile(f->get(), "0123456789", 10), IsOkAndHolds(10));
+  }
+
+  auto f = OpenExistingFileForReading(foo_txt);
+  EXPECT_THAT(f, IsOk());
+
+  // Scatter a contiguous region across multiple buffers.
+  char a[3], b[1], c[4];
+  ReadVecBuffer buffers[] = {{a, 3}, {b, 0}, {b, 1}, {c, 4}};
+  EXPECT_THAT(ReadvFromFile(f->get(), buffers, 1), IsOkAndHolds(8));
+  EXPECT_EQ("123", std::string_view(a, 3));
+  EXPECT_EQ("4", std::string_view(b, 1));
+  EXPECT_EQ("5678", std::string_view(c, 4));
+
+  // Reading past the end of the file returns a short count.
+  ReadVecBuffer eof_buffers[] = {{a, 3}, {c, 4}};
+  EXPECT_THAT(ReadvFromFile(f->get(), eof_buffers, 8), IsOkAndHolds(2));
+  EXPECT_EQ("89", std::string_view(a, 2));
+}
+
+TEST(FileUtilTest, CopyFileContents) {
+  using ::tensorstore::internal_os::CopyFileContents;
+
+  ScopedTemporaryDirectory tempdir;
+  std::string src_txt = tempdir.path() + "/src.txt";
+  std::string dest_txt = tempdir.path() + "/dest.txt";
+  {
+    auto f = OpenFileWrapper(src_txt, OpenFlags::DefaultWrite);
+    EXPECT_THAT(f, IsOk());
+    EXPECT_THAT(WriteToFile(f->get(), "0123456789", 10), IsOkAndHolds(10));
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto src,
+                                   OpenExistingFileForReading(src_txt));
+  {
+    auto f = OpenFileWrapper(dest_txt, OpenFlags::DefaultWrite);
+    EXPECT_THAT(f, IsOk());
+    EXPECT_THAT(CopyFileContents(src->get(), f->get(), 10), IsOkAndHolds(10));
+
+    // Copying more than the source holds fails.
+    EXPECT_THAT(CopyFileContents(src->get(), f->get(), 11),
+                StatusIs(absl::StatusCode::kOutOfRange));
+  }
+
+  char buf[16];
+  auto f = OpenExistingFileForReading(dest_txt);
+  EXPECT_THAT(f, IsOk());
+  EXPECT_THAT(ReadFromFile(f->get(), buf, 10, 0), IsOkAndHolds(10));
+  EXPECT_EQ("0123456789", std::string_view(buf, 10));
+}
+
 TEST(FileUtilTest, ExclusiveFile) {
   ScopedTemporaryDirectory tempdir;
   std::string foo_txt = absl::StrCat(tempdir.path(), "/foo.txt",
@@ -67,6 +67,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
@@ -285,6 +286,27 @@ Result<ptrdiff_t> ReadFromFile(FileDescriptor fd, void* buf, size_t count,
   return std::move(tspan).EndWithStatus(std::move(status));
 }
 
+Result<ptrdiff_t> ReadvFromFile(FileDescriptor fd,
+                                span<const ReadVecBuffer> buffers,
+                                int64_t offset) {
+  // Windows has no positioned scatter-read equivalent to ::preadv; read each
+  // buffer sequentially.
+  ptrdiff_t total = 0;
+  for (const auto& buffer : buffers) {
+    size_t buffer_offset = 0;
+    while (buffer_offset < buffer.size) {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto n,
+          ReadFromFile(fd, buffer.data + buffer_offset,
+                       buffer.size - buffer_offset, offset + total));
+      if (n == 0) return total;  // End of file.
+      buffer_offset += static_cast<size_t>(n);
+      total += n;
+    }
+  }
+  return total;
+}
+
 Result<ptrdiff_t> WriteToFile(FileDescriptor fd, const void* buf,
                               size_t count) {
   LoggedTraceSpan tspan(__func__, detail_logging.Level(1),
@@ -322,6 +344,45 @@ Result<ptrdiff_t> WriteCordToFile(FileDescriptor fd, absl::Cord value) {
   return value.size();
 }
 
+absl::Status SetDirectIo(FileDescriptor fd, bool direct) {
+  // FILE_FLAG_NO_BUFFERING can only be specified when the handle is opened.
+  return absl::UnimplementedError("Direct I/O not supported");
+}
+
+Result<ptrdiff_t> WriteCordToFileDirect(FileDescriptor fd, absl::Cord value) {
+  return absl::UnimplementedError("Direct I/O not supported");
+}
+
+Result<ptrdiff_t> CopyFileContents(FileDescriptor src_fd,
+                                   FileDescriptor dest_fd, int64_t size) {
+  // There is no handle-based equivalent to ::copy_file_range; stream the
+  // contents through a userspace buffer.
+  constexpr size_t kCopyBufferSize = 256 * 1024;
+  MemoryRegion buffer = AllocateHeapRegion(static_cast<size_t>(
+      std::min(size, static_cast<int64_t>(kCopyBufferSize))));
+  int64_t total = 0;
+  while (total < size) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        ptrdiff_t n,
+        ReadFromFile(src_fd, buffer.data(),
+                     static_cast<size_t>(std::min(
+                         static_cast<int64_t>(buffer.size()), size - total)),
+                     total));
+    if (n == 0) {
+      return absl::OutOfRangeError("File shrunk while copying");
+    }
+    const char* p = buffer.data();
+    while (n > 0) {
+      TENSORSTORE_ASSIGN_OR_RETURN(ptrdiff_t written,
+                                   WriteToFile(dest_fd, p, n));
+      p += written;
+      n -= written;
+      total += written;
+    }
+  }
+  return static_cast<ptrdiff_t>(total);
+}
+
 absl::Status TruncateFile(FileDescriptor fd) {
   LoggedTraceSpan tspan(__func__, detail_logging.Level(1), {{"handle", fd}});
 
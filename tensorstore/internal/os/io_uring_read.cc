@@ -0,0 +1,307 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/io_uring_read.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/status/status.h"
+#include "tensorstore/util/span.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TENSORSTORE_INTERNAL_USE_IO_URING 1
+#endif
+
+#ifdef TENSORSTORE_INTERNAL_USE_IO_URING
+
+#include <atomic>
+#include <cerrno>
+#include <vector>
+
+#include "tensorstore/internal/os/error_code.h"
+
+// Include system headers last to reduce impact of macros.
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#endif  // TENSORSTORE_INTERNAL_USE_IO_URING
+
+namespace tensorstore {
+namespace internal_os {
+
+#ifndef TENSORSTORE_INTERNAL_USE_IO_URING
+
+bool IsIoUringSupported() { return false; }
+
+void IoUringBatchRead(span<IoUringReadRequest> requests) {
+  for (auto& request : requests) {
+    request.status =
+        absl::UnimplementedError("io_uring is not supported on this platform");
+  }
+}
+
+#else  // TENSORSTORE_INTERNAL_USE_IO_URING
+
+namespace {
+
+int SysIoUringSetup(unsigned entries, struct io_uring_params* p) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+int SysIoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                    unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+/// Minimal wrapper around a single io_uring instance, avoiding a liburing
+/// dependency.  Only the functionality needed by `IoUringBatchRead` is
+/// provided.
+class IoUring {
+ public:
+  /// Maximum number of in-flight operations; batches larger than this are
+  /// submitted in multiple rounds.
+  static constexpr unsigned kQueueDepth = 64;
+
+  IoUring() {
+    struct io_uring_params params = {};
+    ring_fd_ = SysIoUringSetup(kQueueDepth, &params);
+    if (ring_fd_ < 0) return;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED ||
+        sqes_ == MAP_FAILED) {
+      Close();
+      return;
+    }
+    auto* sq = static_cast<char*>(sq_ring_);
+    sq_head_ = reinterpret_cast<std::atomic<unsigned>*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<std::atomic<unsigned>*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(cq_ring_);
+    cq_head_ = reinterpret_cast<std::atomic<unsigned>*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<std::atomic<unsigned>*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    sq_entries_ = params.sq_entries;
+    ok_ = true;
+  }
+
+  ~IoUring() { Close(); }
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  bool ok() const { return ok_; }
+
+  /// Returns the next available submission queue entry, zero-initialized, or
+  /// `nullptr` if the submission queue is full.  Entries are not visible to
+  /// the kernel until `CommitSqes` is called.
+  struct io_uring_sqe* GetSqe() {
+    const unsigned head = sq_head_->load(std::memory_order_acquire);
+    if (local_sq_tail_ - head >= sq_entries_) return nullptr;
+    const unsigned index = local_sq_tail_ & sq_mask_;
+    ++local_sq_tail_;
+    sq_array_[index] = index;
+    auto* sqe = static_cast<struct io_uring_sqe*>(sqes_) + index;
+    *sqe = {};
+    return sqe;
+  }
+
+  /// Publishes entries obtained from `GetSqe`, returning the number of
+  /// not-yet-submitted entries.
+  unsigned CommitSqes() {
+    const unsigned tail = sq_tail_->load(std::memory_order_relaxed);
+    sq_tail_->store(local_sq_tail_, std::memory_order_release);
+    return local_sq_tail_ - tail;
+  }
+
+  /// Returns the next completion queue entry, or `nullptr` if none is
+  /// available.  The entry remains valid until `AdvanceCqe` is called.
+  struct io_uring_cqe* PeekCqe() {
+    const unsigned head = cq_head_->load(std::memory_order_relaxed);
+    if (head == cq_tail_->load(std::memory_order_acquire)) return nullptr;
+    return &cqes_[head & cq_mask_];
+  }
+
+  void AdvanceCqe() {
+    cq_head_->store(cq_head_->load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+  }
+
+  /// Submits `to_submit` published entries and waits for at least
+  /// `min_complete` completions.  Returns the number of entries submitted, or
+  /// `-1` with `errno` set.
+  int Enter(unsigned to_submit, unsigned min_complete) {
+    return SysIoUringEnter(ring_fd_, to_submit, min_complete,
+                           IORING_ENTER_GETEVENTS);
+  }
+
+ private:
+  void Close() {
+    if (sq_ring_ != MAP_FAILED) ::munmap(sq_ring_, sq_ring_size_);
+    if (cq_ring_ != MAP_FAILED) ::munmap(cq_ring_, cq_ring_size_);
+    if (sqes_ != MAP_FAILED) ::munmap(sqes_, sqes_size_);
+    sq_ring_ = cq_ring_ = sqes_ = MAP_FAILED;
+    if (ring_fd_ >= 0) ::close(ring_fd_);
+    ring_fd_ = -1;
+    ok_ = false;
+  }
+
+  int ring_fd_ = -1;
+  bool ok_ = false;
+  void* sq_ring_ = MAP_FAILED;
+  void* cq_ring_ = MAP_FAILED;
+  void* sqes_ = MAP_FAILED;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+  unsigned sq_entries_ = 0;
+  unsigned sq_mask_ = 0;
+  unsigned cq_mask_ = 0;
+  std::atomic<unsigned>* sq_head_ = nullptr;
+  std::atomic<unsigned>* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  std::atomic<unsigned>* cq_head_ = nullptr;
+  std::atomic<unsigned>* cq_tail_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+  unsigned local_sq_tail_ = 0;
+};
+
+/// Returns the ring for the current thread, creating it on first use.  Rings
+/// are not shared between threads, so no synchronization is required, and ring
+/// setup cost is amortized over all batches submitted by the thread.
+IoUring& GetThreadLocalRing() {
+  thread_local IoUring ring;
+  return ring;
+}
+
+}  // namespace
+
+bool IsIoUringSupported() {
+  static const bool supported = [] {
+    struct io_uring_params params = {};
+    const int fd = SysIoUringSetup(1, &params);
+    if (fd < 0) return false;
+    ::close(fd);
+    return true;
+  }();
+  return supported;
+}
+
+void IoUringBatchRead(span<IoUringReadRequest> requests) {
+  auto& ring = GetThreadLocalRing();
+  if (!ring.ok()) {
+    for (auto& request : requests) {
+      request.status = absl::UnimplementedError("io_uring is not supported");
+    }
+    return;
+  }
+  const size_t num_requests = requests.size();
+  // Bytes already read for each request, for continuing after short reads.
+  std::vector<size_t> completed(num_requests, 0);
+  // Per-request iovec; must remain stable while a read is in flight.
+  std::vector<struct iovec> iovs(num_requests);
+  // Indices of requests ready to be submitted or resubmitted, in reverse
+  // order so that requests are initially submitted in order.
+  std::vector<size_t> pending(num_requests);
+  for (size_t i = 0; i < num_requests; ++i) {
+    pending[i] = num_requests - 1 - i;
+  }
+  const auto fail_incomplete = [&](const absl::Status& status) {
+    for (size_t i = 0; i < num_requests; ++i) {
+      auto& request = requests[i];
+      if (request.status.ok() && completed[i] < request.size) {
+        request.status = status;
+      }
+    }
+  };
+  size_t num_done = 0;
+  unsigned to_submit = 0;
+  while (num_done < num_requests) {
+    while (!pending.empty()) {
+      auto* sqe = ring.GetSqe();
+      if (!sqe) break;
+      const size_t i = pending.back();
+      pending.pop_back();
+      auto& request = requests[i];
+      iovs[i].iov_base = request.buffer + completed[i];
+      iovs[i].iov_len = request.size - completed[i];
+      // `IORING_OP_READV` rather than `IORING_OP_READ` for compatibility with
+      // kernels prior to 5.6.
+      sqe->opcode = IORING_OP_READV;
+      sqe->fd = request.fd;
+      sqe->addr = reinterpret_cast<uint64_t>(&iovs[i]);
+      sqe->len = 1;
+      sqe->off = static_cast<uint64_t>(request.offset + completed[i]);
+      sqe->user_data = i;
+    }
+    to_submit += ring.CommitSqes();
+    const int n = ring.Enter(to_submit, /*min_complete=*/1);
+    if (n < 0) {
+      const int error = errno;
+      if (error != EINTR && error != EAGAIN) {
+        fail_incomplete(
+            internal::StatusFromOsError(error, "Error in io_uring_enter"));
+        return;
+      }
+    } else {
+      to_submit -= static_cast<unsigned>(n);
+    }
+    while (auto* cqe = ring.PeekCqe()) {
+      const size_t i = static_cast<size_t>(cqe->user_data);
+      const int res = cqe->res;
+      ring.AdvanceCqe();
+      auto& request = requests[i];
+      if (res < 0) {
+        if (res == -EINTR || res == -EAGAIN) {
+          pending.push_back(i);
+          continue;
+        }
+        request.status =
+            internal::StatusFromOsError(-res, "Error reading file");
+        ++num_done;
+      } else if (res == 0) {
+        request.status =
+            absl::UnavailableError("Length changed while reading");
+        ++num_done;
+      } else {
+        completed[i] += static_cast<size_t>(res);
+        if (completed[i] == request.size) {
+          ++num_done;
+        } else {
+          pending.push_back(i);
+        }
+      }
+    }
+  }
+}
+
+#endif  // TENSORSTORE_INTERNAL_USE_IO_URING
+
+}  // namespace internal_os
+}  // namespace tensorstore
@@ -0,0 +1,69 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_IO_URING_READ_H_
+#define TENSORSTORE_INTERNAL_OS_IO_URING_READ_H_
+
+/// \file Batched positional file reads using the Linux io_uring interface.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/status/status.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_os {
+
+/// Single positional read within a batch passed to `IoUringBatchRead`.
+struct IoUringReadRequest {
+  /// Open file to read from.
+  FileDescriptor fd = FileDescriptorTraits::Invalid();
+
+  /// Buffer of at least `size` bytes to fill.
+  char* buffer = nullptr;
+
+  /// Number of bytes to read.  The read fails with
+  /// `absl::StatusCode::kUnavailable` if the file ends before `size` bytes
+  /// have been read.
+  size_t size = 0;
+
+  /// Byte offset within the file at which to start reading.
+  int64_t offset = 0;
+
+  /// Per-request completion status, set by `IoUringBatchRead`.
+  absl::Status status;
+};
+
+/// Returns `true` if batched reads via io_uring are supported by the running
+/// kernel.  Always returns `false` on non-Linux platforms.
+bool IsIoUringSupported();
+
+/// Reads each request fully, submitting all requests to a single io_uring and
+/// waiting on the calling thread until all of them complete.
+///
+/// Compared to performing a blocking `ReadFromFile` call per request on a
+/// thread pool, this requires only a small number of syscalls for the entire
+/// batch and no thread wakeups.  Short reads are automatically resubmitted.
+///
+/// The completion status of each request is stored in
+/// `IoUringReadRequest::status`; if `IsIoUringSupported()` returns `false`,
+/// every request fails with `absl::StatusCode::kUnimplemented`.
+void IoUringBatchRead(span<IoUringReadRequest> requests);
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_IO_URING_READ_H_
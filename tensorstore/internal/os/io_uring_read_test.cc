@@ -0,0 +1,109 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/io_uring_read.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/internal/testing/scoped_directory.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::IsOk;
+using ::tensorstore::StatusIs;
+using ::tensorstore::internal_os::IoUringBatchRead;
+using ::tensorstore::internal_os::IoUringReadRequest;
+using ::tensorstore::internal_os::IsIoUringSupported;
+using ::tensorstore::internal_os::OpenExistingFileForReading;
+using ::tensorstore::internal_os::OpenFileWrapper;
+using ::tensorstore::internal_os::OpenFlags;
+using ::tensorstore::internal_os::WriteToFile;
+using ::tensorstore::internal_testing::ScopedTemporaryDirectory;
+
+TEST(IoUringReadTest, BatchRead) {
+  if (!IsIoUringSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  ScopedTemporaryDirectory tempdir;
+  std::string foo_txt = tempdir.path() + "/foo.txt";
+
+  std::string contents;
+  for (int i = 0; i < 1000; ++i) {
+    contents += "0123456789";
+  }
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto f, OpenFileWrapper(foo_txt, OpenFlags::DefaultWrite));
+    TENSORSTORE_ASSERT_OK(
+        WriteToFile(f.get(), contents.data(), contents.size()));
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto f,
+                                   OpenExistingFileForReading(foo_txt));
+
+  // Batch larger than the ring's queue depth, with varying sizes and offsets.
+  constexpr size_t kNumRequests = 100;
+  std::vector<std::string> buffers(kNumRequests);
+  std::vector<IoUringReadRequest> requests(kNumRequests);
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    buffers[i].resize(i + 1);
+    requests[i].fd = f.get();
+    requests[i].buffer = buffers[i].data();
+    requests[i].size = buffers[i].size();
+    requests[i].offset = static_cast<int64_t>(i * 10);
+  }
+  IoUringBatchRead(tensorstore::span(requests));
+  for (size_t i = 0; i < kNumRequests; ++i) {
+    EXPECT_THAT(requests[i].status, IsOk()) << i;
+    EXPECT_EQ(buffers[i], contents.substr(i * 10, i + 1)) << i;
+  }
+}
+
+TEST(IoUringReadTest, ReadPastEndOfFile) {
+  if (!IsIoUringSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  ScopedTemporaryDirectory tempdir;
+  std::string foo_txt = tempdir.path() + "/foo.txt";
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto f, OpenFileWrapper(foo_txt, OpenFlags::DefaultWrite));
+    TENSORSTORE_ASSERT_OK(WriteToFile(f.get(), "abc", 3));
+  }
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto f,
+                                   OpenExistingFileForReading(foo_txt));
+  char buffer[8];
+  IoUringReadRequest request;
+  request.fd = f.get();
+  request.buffer = buffer;
+  request.size = sizeof(buffer);
+  request.offset = 0;
+  IoUringBatchRead(tensorstore::span(&request, 1));
+  EXPECT_THAT(request.status, StatusIs(absl::StatusCode::kUnavailable));
+}
+
+}  // namespace
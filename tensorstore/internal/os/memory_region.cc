@@ -17,17 +17,172 @@
 #include <stddef.h>
 #include <stdio.h>
 
+#include <cassert>
 #include <cstdlib>
 #include <string_view>
+#include <vector>
 
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/env.h"
+#include "tensorstore/internal/memory_budget.h"
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 namespace tensorstore {
 namespace internal_os {
 namespace {
 
-void FreeHeap(char* data, size_t size) { ::free(data); }
+void FreeHeap(char* data, size_t size) {
+  ::free(data);
+  internal::MemoryBudget::Global().AdjustUsage(-static_cast<ptrdiff_t>(size));
+}
+
+#ifdef _WIN32
+void FreeAligned(char* data, size_t size) {
+  ::_aligned_free(data);
+  internal::MemoryBudget::Global().AdjustUsage(-static_cast<ptrdiff_t>(size));
+}
+#endif
+
+#ifdef __linux__
+void FreeMmap(char* data, size_t size) {
+  ::munmap(data, size);
+  internal::MemoryBudget::Global().AdjustUsage(-static_cast<ptrdiff_t>(size));
+}
+
+bool HugepagesEnabled() {
+  static const bool enabled =
+      internal::GetEnvValue<bool>("TENSORSTORE_HUGEPAGES").value_or(false);
+  return enabled;
+}
+#endif
+
+// Process-wide pool backing `AcquirePooledHeapRegion`.  Blocks are keyed by
+// exact size, which matches the access pattern of chunk encode/decode paths:
+// every buffer for a given dataset has the same size.  Blocks may be released
+// from arbitrary threads (e.g. by a cord releaser), so the pool is guarded by
+// a mutex; it is only touched once per region, not per byte.
+struct FlatBlockPool {
+  absl::Mutex mutex;
+
+  // Free blocks, by exact size.
+  absl::flat_hash_map<size_t, std::vector<char*>> free_blocks
+      ABSL_GUARDED_BY(mutex);
+
+  // Underlying deallocation function for every block owned by the pool,
+  // including blocks currently checked out.  Needed because
+  // `AllocateLargeHeapRegion` may return either malloc- or mmap-backed
+  // memory.
+  absl::flat_hash_map<char*, void (*)(char*, size_t)> base_free_fns
+      ABSL_GUARDED_BY(mutex);
+
+  size_t retained_bytes ABSL_GUARDED_BY(mutex) = 0;
+};
+
+// Frees retained blocks until approximately `bytes_to_reclaim` bytes have
+// been released or the pool is empty.  Returns the number of bytes released.
+size_t ReleaseFreeBlocks(FlatBlockPool& pool, size_t bytes_to_reclaim);
+
+FlatBlockPool& GetFlatBlockPool() {
+  static absl::NoDestructor<FlatBlockPool> pool;
+  // Free pooled blocks are the cheapest memory in the process to give up, so
+  // they are registered as the first reclaimer of the process-wide budget.
+  static const bool registered = [] {
+    internal::MemoryBudget::Global().RegisterReclaimer(
+        internal::MemoryBudget::kPriorityPooledBuffers,
+        [](size_t bytes_to_reclaim) {
+          return ReleaseFreeBlocks(*pool, bytes_to_reclaim);
+        });
+    return true;
+  }();
+  static_cast<void>(registered);
+  return *pool;
+}
+
+size_t ReleaseFreeBlocks(FlatBlockPool& pool, size_t bytes_to_reclaim) {
+  struct Block {
+    char* data;
+    size_t size;
+    void (*base_free)(char*, size_t);
+  };
+  std::vector<Block> to_free;
+  size_t released = 0;
+  {
+    absl::MutexLock lock(&pool.mutex);
+    for (auto& [size, blocks] : pool.free_blocks) {
+      while (!blocks.empty() && released < bytes_to_reclaim) {
+        char* data = blocks.back();
+        blocks.pop_back();
+        pool.retained_bytes -= size;
+        released += size;
+        auto it = pool.base_free_fns.find(data);
+        assert(it != pool.base_free_fns.end());
+        to_free.push_back(Block{data, size, it->second});
+        pool.base_free_fns.erase(it);
+      }
+      if (released >= bytes_to_reclaim) break;
+    }
+  }
+  // Free outside the lock; the underlying deallocation functions release the
+  // corresponding budget usage.
+  for (const Block& block : to_free) {
+    block.base_free(block.data, block.size);
+  }
+  return released;
+}
+
+size_t FlatBlockPoolCapacity() {
+  static const size_t capacity =
+      internal::GetEnvValue<size_t>("TENSORSTORE_FLAT_BLOCK_POOL_BYTES")
+          .value_or(size_t{64} << 20);
+  return capacity;
+}
+
+// `unmap_fn` for pooled regions: returns the block to the pool, or frees it
+// via its underlying deallocation function if the pool is over its retention
+// bound.
+void ReleasePooledBlock(char* data, size_t size) {
+  auto& pool = GetFlatBlockPool();
+  void (*base_free)(char*, size_t) = nullptr;
+  {
+    absl::MutexLock lock(&pool.mutex);
+    auto it = pool.base_free_fns.find(data);
+    assert(it != pool.base_free_fns.end());
+    if (pool.retained_bytes + size <= FlatBlockPoolCapacity()) {
+#ifdef __linux__
+      if (it->second == FreeMmap) {
+        // Let the kernel reclaim the pages of the retained block lazily under
+        // memory pressure; the mapping (and thus the block) remains reusable,
+        // with reclaimed pages re-faulted as zeros on the next use.  This must
+        // happen before the block becomes visible for reuse (hence under the
+        // lock), as `MADV_FREE` discards concurrent writes.
+#ifdef MADV_FREE
+        ::madvise(data, size, MADV_FREE);
+#else
+        ::madvise(data, size, MADV_DONTNEED);
+#endif
+      }
+#endif
+      pool.free_blocks[size].push_back(data);
+      pool.retained_bytes += size;
+      return;
+    }
+    base_free = it->second;
+    pool.base_free_fns.erase(it);
+  }
+  base_free(data, size);
+}
 
 }  // namespace
 
@@ -49,7 +204,86 @@ MemoryRegion AllocateHeapRegion(size_t size) {
   if (p == nullptr) {
     ABSL_LOG(FATAL) << "Failed to allocate memory " << size;
   }
+  internal::MemoryBudget::Global().AdjustUsage(size);
+  return MemoryRegion(static_cast<char*>(p), size, FreeHeap);
+}
+
+MemoryRegion AllocateAlignedRegion(size_t alignment, size_t size) {
+  assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+  if (size == 0) {
+    return MemoryRegion(nullptr, 0, FreeHeap);
+  }
+#ifdef _WIN32
+  void* p = ::_aligned_malloc(size, alignment);
+  if (p == nullptr) {
+    ABSL_LOG(FATAL) << "Failed to allocate memory " << size;
+  }
+  internal::MemoryBudget::Global().AdjustUsage(size);
+  return MemoryRegion(static_cast<char*>(p), size, FreeAligned);
+#else
+  void* p = nullptr;
+  if (::posix_memalign(&p, alignment, size) != 0) {
+    ABSL_LOG(FATAL) << "Failed to allocate memory " << size;
+  }
+  internal::MemoryBudget::Global().AdjustUsage(size);
   return MemoryRegion(static_cast<char*>(p), size, FreeHeap);
+#endif
+}
+
+MemoryRegion AllocateLargeHeapRegion(size_t size) {
+#ifdef __linux__
+  // Size from which buffers are mapped directly rather than drawn from the
+  // heap allocator.  Freeing a mapping is a real `munmap`, returning the
+  // pages to the kernel immediately instead of leaving them resident in an
+  // allocator arena until it decides to trim; a burst of large decoded
+  // chunks then cannot hold RSS after the buffers are released.  2 MiB is
+  // also the transparent hugepage size, below which `MADV_HUGEPAGE` is
+  // useless.
+  constexpr size_t kMmapThreshold = 2 * 1024 * 1024;
+  if (size >= kMmapThreshold) {
+    void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      if (HugepagesEnabled()) {
+        // Advisory; the kernel backs 2 MiB-aligned subranges with transparent
+        // hugepages as available.  MAP_HUGETLB is deliberately not used since
+        // it fails unless hugepages have been explicitly reserved by the
+        // administrator.
+        ::madvise(p, size, MADV_HUGEPAGE);
+      }
+      internal::MemoryBudget::Global().AdjustUsage(size);
+      return MemoryRegion(static_cast<char*>(p), size, FreeMmap);
+    }
+    // Fall back to the regular heap if the mapping fails.
+  }
+#endif
+  return AllocateHeapRegion(size);
+}
+
+MemoryRegion AcquirePooledHeapRegion(size_t size) {
+  // Blocks larger than the retention bound could never be returned to the
+  // pool, so allocate them directly.
+  if (size == 0 || size > FlatBlockPoolCapacity()) {
+    return AllocateLargeHeapRegion(size);
+  }
+  auto& pool = GetFlatBlockPool();
+  {
+    absl::MutexLock lock(&pool.mutex);
+    auto it = pool.free_blocks.find(size);
+    if (it != pool.free_blocks.end() && !it->second.empty()) {
+      char* data = it->second.back();
+      it->second.pop_back();
+      pool.retained_bytes -= size;
+      return MemoryRegion(data, size, ReleasePooledBlock);
+    }
+  }
+  MemoryRegion region = AllocateLargeHeapRegion(size);
+  {
+    absl::MutexLock lock(&pool.mutex);
+    pool.base_free_fns.emplace(region.data_, region.unmap_fn_);
+  }
+  region.unmap_fn_ = ReleasePooledBlock;
+  return region;
 }
 
 }  // namespace internal_os
@@ -73,6 +73,9 @@ class MemoryRegion {
   friend Result<MemoryRegion> MemmapFileReadOnly(void*, size_t, size_t);
   friend Result<MemoryRegion> MemmapFileReadOnly(int, size_t, size_t);
   friend MemoryRegion AllocateHeapRegion(size_t);
+  friend MemoryRegion AllocateAlignedRegion(size_t, size_t);
+  friend MemoryRegion AllocateLargeHeapRegion(size_t);
+  friend MemoryRegion AcquirePooledHeapRegion(size_t);
 
   char* data_;
   size_t size_;
@@ -82,6 +85,41 @@ class MemoryRegion {
 /// Try to allocate a region of memory backed the heap.
 MemoryRegion AllocateHeapRegion(size_t size);
 
+/// Try to allocate a heap-backed region of memory whose start address is a
+/// multiple of `alignment`, as required, for example, by direct I/O.
+/// `alignment` must be a power of 2.
+MemoryRegion AllocateAlignedRegion(size_t alignment, size_t size);
+
+/// Try to allocate a region of memory suitable for a large buffer, such as a
+/// decoded chunk or a coalesced read.
+///
+/// On Linux, if `size` is at least 2 MiB, the region is allocated as an
+/// anonymous mapping rather than from the heap allocator, so that releasing
+/// it returns the pages to the kernel immediately instead of leaving them
+/// resident in an allocator arena.  If hugepage use is additionally enabled,
+/// the mapping is advised with `MADV_HUGEPAGE`, allowing it to be backed by
+/// transparent hugepages and reducing TLB pressure when iterating over the
+/// buffer.  Otherwise, equivalent to `AllocateHeapRegion`.
+///
+/// Hugepage use is disabled by default; set the environment variable
+/// :envvar:`TENSORSTORE_HUGEPAGES=1` to enable it.
+MemoryRegion AllocateLargeHeapRegion(size_t size);
+
+/// Like `AllocateLargeHeapRegion`, but serves the allocation from a
+/// process-wide pool of flat blocks keyed by exact size.
+///
+/// When the returned region (or a cord built from it with `as_cord`) is
+/// destroyed, the block is returned to the pool rather than freed, up to a
+/// bounded number of retained bytes.  Chunk encode and decode paths build and
+/// release buffers of the same few sizes constantly, so pooling avoids
+/// round-tripping large allocations through the heap (and re-faulting their
+/// pages) on every chunk.
+///
+/// The retention bound defaults to 64 MiB; set the environment variable
+/// :envvar:`TENSORSTORE_FLAT_BLOCK_POOL_BYTES` to adjust it, or to 0 to
+/// disable pooling entirely.
+MemoryRegion AcquirePooledHeapRegion(size_t size);
+
 }  // namespace internal_os
 }  // namespace tensorstore
 
@@ -21,7 +21,9 @@
 #include <gtest/gtest.h>
 #include "absl/strings/cord.h"
 
+using ::tensorstore::internal_os::AcquirePooledHeapRegion;
 using ::tensorstore::internal_os::AllocateHeapRegion;
+using ::tensorstore::internal_os::AllocateLargeHeapRegion;
 
 namespace {
 
@@ -47,4 +49,39 @@ TEST(MemoryRegionTest, AllocateHeapRegion) {
   absl::Cord a = std::move(region).as_cord();
 }
 
+TEST(MemoryRegionTest, AllocateLargeHeapRegion) {
+  // Exercises both the below-threshold and hugepage-eligible paths; the
+  // latter uses a hugepage-backed mapping only when enabled via the
+  // TENSORSTORE_HUGEPAGES environment variable.
+  auto region = AllocateLargeHeapRegion(16);
+  EXPECT_EQ(region.as_string_view().size(), 16);
+
+  region = AllocateLargeHeapRegion(4 * 1024 * 1024);
+  EXPECT_EQ(region.as_string_view().size(), 4 * 1024 * 1024);
+  region.data()[0] = 1;
+  region.data()[4 * 1024 * 1024 - 1] = 1;
+
+  absl::Cord a = std::move(region).as_cord();
+}
+
+TEST(MemoryRegionTest, AcquirePooledHeapRegion) {
+  const char* data;
+  {
+    auto region = AcquirePooledHeapRegion(64 * 1024);
+    EXPECT_EQ(region.as_string_view().size(), 64 * 1024);
+    region.data()[0] = 1;
+    data = region.data();
+  }
+  // The released block is served again for an allocation of the same size.
+  auto region = AcquirePooledHeapRegion(64 * 1024);
+  EXPECT_EQ(data, region.data());
+
+  // Releasing through a cord also returns the block to the pool.
+  {
+    absl::Cord a = std::move(region).as_cord();
+  }
+  region = AcquirePooledHeapRegion(64 * 1024);
+  EXPECT_EQ(data, region.data());
+}
+
 }  // namespace
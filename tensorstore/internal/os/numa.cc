@@ -0,0 +1,133 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/numa.h"
+
+#ifdef __linux__
+
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+namespace tensorstore {
+namespace internal_os {
+namespace {
+
+// Parses a sysfs cpu/node list such as "0-7,16-23", invoking `callback(i)`
+// for each listed id.  Returns the largest id seen, or -1 on parse failure.
+template <typename Callback>
+int ParseSysfsList(std::string_view list, Callback callback) {
+  int max_id = -1;
+  for (std::string_view range :
+       absl::StrSplit(list, ',', absl::SkipEmpty())) {
+    std::pair<std::string_view, std::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int lo, hi;
+    if (!absl::SimpleAtoi(bounds.first, &lo)) return -1;
+    if (bounds.second.empty()) {
+      hi = lo;
+    } else if (!absl::SimpleAtoi(bounds.second, &hi)) {
+      return -1;
+    }
+    for (int i = lo; i <= hi; ++i) callback(i);
+    if (hi > max_id) max_id = hi;
+  }
+  return max_id;
+}
+
+// Reads the first line of a sysfs file; empty on failure.
+std::string ReadSysfsLine(const std::string& path) {
+  std::ifstream file(path);
+  std::string contents;
+  if (file.is_open()) std::getline(file, contents);
+  return contents;
+}
+
+int ComputeNumaNodeCount() {
+  int max_node = ParseSysfsList(
+      ReadSysfsLine("/sys/devices/system/node/possible"), [](int) {});
+  return max_node >= 0 ? max_node + 1 : 1;
+}
+
+// Returns the cpu set of `node`, or an empty set on failure.
+bool GetNumaNodeCpuSet(int node, ::cpu_set_t* cpus) {
+  CPU_ZERO(cpus);
+  int max_cpu = ParseSysfsList(
+      ReadSysfsLine(absl::StrCat("/sys/devices/system/node/node", node,
+                                 "/cpulist")),
+      [&](int cpu) {
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, cpus);
+      });
+  return max_cpu >= 0 && CPU_COUNT(cpus) > 0;
+}
+
+}  // namespace
+
+int GetNumaNodeCount() {
+  static const int count = ComputeNumaNodeCount();
+  return count;
+}
+
+int GetCurrentNumaNode() {
+  unsigned int cpu = 0, node = 0;
+  if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return 0;
+  return static_cast<int>(node);
+}
+
+bool BindCurrentThreadToNumaNode(int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) return false;
+  ::cpu_set_t cpus;
+  if (!GetNumaNodeCpuSet(node, &cpus)) return false;
+  return ::sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+}
+
+void ResetCurrentThreadNumaBinding() {
+  ::cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  const long num_cpus = ::sysconf(_SC_NPROCESSORS_CONF);
+  for (int cpu = 0; cpu < num_cpus && cpu < CPU_SETSIZE; ++cpu) {
+    CPU_SET(cpu, &cpus);
+  }
+  ::sched_setaffinity(0, sizeof(cpus), &cpus);
+}
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#else  // !defined(__linux__)
+
+namespace tensorstore {
+namespace internal_os {
+
+int GetNumaNodeCount() { return 1; }
+
+int GetCurrentNumaNode() { return 0; }
+
+bool BindCurrentThreadToNumaNode(int node) { return false; }
+
+void ResetCurrentThreadNumaBinding() {}
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // defined(__linux__)
@@ -0,0 +1,47 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_OS_NUMA_H_
+#define TENSORSTORE_INTERNAL_OS_NUMA_H_
+
+namespace tensorstore {
+namespace internal_os {
+
+/// NUMA topology queries and thread placement.
+///
+/// On platforms without NUMA support (or single-node machines), these
+/// degrade to a single node `0` and no-op binding, so callers need not
+/// special-case either situation.
+
+/// Returns the number of NUMA nodes on the machine.  Always at least 1.
+int GetNumaNodeCount();
+
+/// Returns the NUMA node on which the calling thread is currently running,
+/// or `0` if it cannot be determined.
+int GetCurrentNumaNode();
+
+/// Restricts the calling thread to the cpus of `node`.
+///
+/// Returns `false` if `node` is invalid or binding is unsupported on this
+/// platform; the thread's affinity is unchanged in that case.
+bool BindCurrentThreadToNumaNode(int node);
+
+/// Clears any cpu affinity previously set by `BindCurrentThreadToNumaNode`,
+/// allowing the calling thread to run on any cpu.
+void ResetCurrentThreadNumaBinding();
+
+}  // namespace internal_os
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_OS_NUMA_H_
@@ -0,0 +1,50 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/os/numa.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using ::tensorstore::internal_os::BindCurrentThreadToNumaNode;
+using ::tensorstore::internal_os::GetCurrentNumaNode;
+using ::tensorstore::internal_os::GetNumaNodeCount;
+using ::tensorstore::internal_os::ResetCurrentThreadNumaBinding;
+
+TEST(NumaTest, NodeCount) {
+  EXPECT_GE(GetNumaNodeCount(), 1);
+}
+
+TEST(NumaTest, CurrentNode) {
+  const int node = GetCurrentNumaNode();
+  EXPECT_GE(node, 0);
+  EXPECT_LT(node, GetNumaNodeCount());
+}
+
+TEST(NumaTest, BindInvalidNode) {
+  EXPECT_FALSE(BindCurrentThreadToNumaNode(-1));
+  EXPECT_FALSE(BindCurrentThreadToNumaNode(GetNumaNodeCount()));
+}
+
+TEST(NumaTest, BindAndReset) {
+  // Binding may be unsupported (non-Linux, or restricted environments); only
+  // the successful case implies anything about the current node.
+  if (BindCurrentThreadToNumaNode(0)) {
+    EXPECT_EQ(0, GetCurrentNumaNode());
+  }
+  ResetCurrentThreadNumaBinding();
+}
+
+}  // namespace
@@ -0,0 +1,80 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/rate_limiter/adaptive_admission_queue.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/rate_limiter/admission_queue.h"
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+// Weight of each new latency sample in the moving average.
+constexpr double kLatencyDecay = 0.2;
+
+AdaptiveAdmissionQueue::Options SanitizeOptions(
+    AdaptiveAdmissionQueue::Options options) {
+  options.min_limit = std::max<size_t>(1, options.min_limit);
+  options.max_limit = std::max(options.max_limit, options.min_limit);
+  options.initial_limit = std::clamp(options.initial_limit, options.min_limit,
+                                     options.max_limit);
+  options.latency_headroom = std::max(1.0, options.latency_headroom);
+  return options;
+}
+
+}  // namespace
+
+AdaptiveAdmissionQueue::AdaptiveAdmissionQueue(Options options)
+    : AdmissionQueue(SanitizeOptions(options).initial_limit),
+      options_(SanitizeOptions(options)) {
+  // Permit a decrease before the first full window completes.
+  completed_since_decrease_ = options_.initial_limit;
+}
+
+void AdaptiveAdmissionQueue::ReportSuccess(absl::Duration latency) {
+  absl::MutexLock lock(&mutex_);
+  double seconds = absl::ToDoubleSeconds(latency);
+  if (seconds > 0) {
+    smoothed_latency_ =
+        smoothed_latency_ == 0
+            ? seconds
+            : smoothed_latency_ + kLatencyDecay * (seconds - smoothed_latency_);
+    if (min_latency_ == 0 || seconds < min_latency_) min_latency_ = seconds;
+  }
+  ++completed_since_decrease_;
+  if (++successes_in_window_ < limit_) return;
+  successes_in_window_ = 0;
+  if (limit_ >= options_.max_limit) return;
+  if (smoothed_latency_ > options_.latency_headroom * min_latency_) return;
+  ++limit_;
+  AdmitQueuedNodes();
+}
+
+void AdaptiveAdmissionQueue::ReportThrottled() {
+  absl::MutexLock lock(&mutex_);
+  // At most one decrease per window of completed requests.
+  if (completed_since_decrease_ < limit_) return;
+  completed_since_decrease_ = 0;
+  successes_in_window_ = 0;
+  limit_ = std::max(options_.min_limit, limit_ / 2);
+}
+
+}  // namespace internal
+}  // namespace tensorstore
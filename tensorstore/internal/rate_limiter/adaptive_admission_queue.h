@@ -0,0 +1,82 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_RATE_LIMITER_ADAPTIVE_ADMISSION_QUEUE_H_
+#define TENSORSTORE_INTERNAL_RATE_LIMITER_ADAPTIVE_ADMISSION_QUEUE_H_
+
+#include <stddef.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/rate_limiter/admission_queue.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// AdaptiveAdmissionQueue implements an `AdmissionQueue` whose parallelism
+/// limit adjusts within `[min_limit, max_limit]` using an AIMD
+/// (additive-increase/multiplicative-decrease) policy driven by request
+/// feedback, in the manner of TCP congestion control:
+///
+/// * `ReportThrottled` indicates a throttling response (HTTP 429) or other
+///   retryable failure; it halves the limit, at most once per window of
+///   completed requests so that a burst of rejections from a single
+///   congestion event does not collapse the limit to the floor.
+///
+/// * `ReportSuccess` records the observed request latency.  After a full
+///   window of requests completes without throttling, the limit is
+///   incremented by one, provided the smoothed latency has not risen to more
+///   than `latency_headroom` times the minimum observed latency.  The
+///   latency guard avoids overdriving services that queue requests rather
+///   than rejecting them.
+class AdaptiveAdmissionQueue : public AdmissionQueue {
+ public:
+  struct Options {
+    /// Initial parallelism limit; clamped to `[min_limit, max_limit]`.
+    size_t initial_limit = 32;
+    size_t min_limit = 4;
+    size_t max_limit = 256;
+
+    /// Permitted ratio of smoothed latency to minimum observed latency for
+    /// additive increase.
+    double latency_headroom = 2.0;
+  };
+
+  explicit AdaptiveAdmissionQueue(Options options);
+
+  /// Reports the latency of a successfully completed operation.
+  void ReportSuccess(absl::Duration latency) override;
+
+  /// Reports that an operation failed with a retryable/throttling error.
+  void ReportThrottled() override;
+
+ private:
+  const Options options_;
+
+  /// Exponentially-weighted moving average of observed latency, and the
+  /// minimum latency observed, in seconds; 0 until the first sample.
+  double smoothed_latency_ ABSL_GUARDED_BY(mutex_) = 0;
+  double min_latency_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  /// Successes since the last limit adjustment.
+  size_t successes_in_window_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  /// Completions since the last multiplicative decrease.
+  size_t completed_since_decrease_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_RATE_LIMITER_ADAPTIVE_ADMISSION_QUEUE_H_
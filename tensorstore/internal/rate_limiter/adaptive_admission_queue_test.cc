@@ -0,0 +1,156 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/rate_limiter/adaptive_admission_queue.h"
+
+#include <stddef.h>
+
+#include <atomic>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include "absl/time/time.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/rate_limiter/rate_limiter.h"
+#include "tensorstore/util/executor.h"
+
+namespace {
+
+using ::tensorstore::ExecutorTask;
+using ::tensorstore::internal::AdaptiveAdmissionQueue;
+using ::tensorstore::internal::AtomicReferenceCount;
+using ::tensorstore::internal::IntrusivePtr;
+using ::tensorstore::internal::MakeIntrusivePtr;
+using ::tensorstore::internal::RateLimiter;
+using ::tensorstore::internal::RateLimiterNode;
+
+/// This class holds a reference count on itself while held by a RateLimiter,
+/// and upon start will call the `task_` function.
+struct Task : public RateLimiterNode, public AtomicReferenceCount<Task> {
+  RateLimiter* rate_limiter_;
+  ExecutorTask task_;
+
+  Task(RateLimiter* rate_limiter, ExecutorTask task)
+      : rate_limiter_(rate_limiter), task_(std::move(task)) {
+    // NOTE: Do not call Admit in the constructor as the task may complete
+    // and try to delete self before MakeIntrusivePtr completes.
+  }
+
+  ~Task() { rate_limiter_->Finish(this); }
+
+  void Admit() {
+    intrusive_ptr_increment(this);  // adopted by RateLimiterTask::Start.
+    rate_limiter_->Admit(this, &Task::Start);
+  }
+
+  static void Start(RateLimiterNode* task) {
+    IntrusivePtr<Task> self(static_cast<Task*>(task),
+                            tensorstore::internal::adopt_object_ref);
+    std::move(self->task_)();
+  }
+};
+
+TEST(AdaptiveAdmissionQueueTest, Basic) {
+  AdaptiveAdmissionQueue queue({/*initial_limit=*/1, /*min_limit=*/1,
+                                /*max_limit=*/4});
+  std::atomic<size_t> done{0};
+
+  EXPECT_EQ(1, queue.limit());
+  EXPECT_EQ(0, queue.in_flight());
+
+  {
+    for (int i = 0; i < 100; i++) {
+      auto task = MakeIntrusivePtr<Task>(&queue, [&done] { done++; });
+      task->Admit();
+    }
+  }
+
+  EXPECT_EQ(100, done);
+}
+
+TEST(AdaptiveAdmissionQueueTest, IncreasesAfterWindowOfSuccesses) {
+  AdaptiveAdmissionQueue queue({/*initial_limit=*/2, /*min_limit=*/1,
+                                /*max_limit=*/8});
+  EXPECT_EQ(2, queue.limit());
+
+  // Each full window of successes at steady latency increments the limit.
+  queue.ReportSuccess(absl::Milliseconds(10));
+  queue.ReportSuccess(absl::Milliseconds(10));
+  EXPECT_EQ(3, queue.limit());
+
+  queue.ReportSuccess(absl::Milliseconds(10));
+  queue.ReportSuccess(absl::Milliseconds(10));
+  EXPECT_EQ(3, queue.limit());
+  queue.ReportSuccess(absl::Milliseconds(10));
+  EXPECT_EQ(4, queue.limit());
+}
+
+TEST(AdaptiveAdmissionQueueTest, LatencyGuardBlocksIncrease) {
+  AdaptiveAdmissionQueue queue({/*initial_limit=*/1, /*min_limit=*/1,
+                                /*max_limit=*/8, /*latency_headroom=*/2.0});
+  EXPECT_EQ(1, queue.limit());
+  queue.ReportSuccess(absl::Milliseconds(10));
+  EXPECT_EQ(2, queue.limit());
+
+  // Latency has risen well past 2x the observed minimum; the limit holds.
+  for (int i = 0; i < 20; i++) {
+    queue.ReportSuccess(absl::Milliseconds(100));
+  }
+  EXPECT_EQ(2, queue.limit());
+}
+
+TEST(AdaptiveAdmissionQueueTest, ThrottleHalvesLimitOncePerWindow) {
+  AdaptiveAdmissionQueue queue({/*initial_limit=*/16, /*min_limit=*/2,
+                                /*max_limit=*/32});
+  EXPECT_EQ(16, queue.limit());
+
+  // A burst of throttle signals only applies a single decrease.
+  queue.ReportThrottled();
+  queue.ReportThrottled();
+  queue.ReportThrottled();
+  EXPECT_EQ(8, queue.limit());
+
+  // After another full window of completions, a throttle decreases again,
+  // bounded below by min_limit.  Elevated latency keeps the window from
+  // also triggering an additive increase.
+  queue.ReportSuccess(absl::Milliseconds(10));
+  for (int i = 0; i < 7; i++) {
+    queue.ReportSuccess(absl::Milliseconds(100));
+  }
+  EXPECT_EQ(8, queue.limit());
+  queue.ReportThrottled();
+  EXPECT_EQ(4, queue.limit());
+}
+
+TEST(AdaptiveAdmissionQueueTest, IncreaseAdmitsQueuedNode) {
+  AdaptiveAdmissionQueue queue({/*initial_limit=*/1, /*min_limit=*/1,
+                                /*max_limit=*/2});
+  std::atomic<size_t> started{0};
+
+  // Occupy the single slot, then queue a second node.
+  Task blocker(&queue, [] {});
+  intrusive_ptr_increment(&blocker);  // reference held by this scope.
+  blocker.Admit();
+
+  auto queued = MakeIntrusivePtr<Task>(&queue, [&started] { started++; });
+  queued->Admit();
+  EXPECT_EQ(0, started);
+
+  // An additive increase makes room for the queued node without a Finish.
+  queue.ReportSuccess(absl::Milliseconds(10));
+  EXPECT_EQ(1, started);
+  EXPECT_EQ(2, queue.limit());
+}
+
+}  // namespace
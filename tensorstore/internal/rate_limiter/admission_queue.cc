@@ -61,7 +61,10 @@ void AdmissionQueue::Finish(RateLimiterNode* node) {
 
   absl::MutexLock lock(&mutex_);
   in_flight_--;
+  AdmitQueuedNodes();
+}
 
+void AdmissionQueue::AdmitQueuedNodes() {
   // Typically this loop will admit only a single node at a time.
   RateLimiterNode* next_node = nullptr;
   while (true) {
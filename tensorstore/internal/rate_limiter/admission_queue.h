@@ -19,6 +19,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 
 namespace tensorstore {
@@ -40,7 +41,10 @@ class AdmissionQueue : public RateLimiter {
   AdmissionQueue(size_t limit);
   ~AdmissionQueue() override;
 
-  size_t limit() const { return limit_; }
+  size_t limit() const {
+    absl::MutexLock l(&mutex_);
+    return limit_;
+  }
   size_t in_flight() const {
     absl::MutexLock l(&mutex_);
     return in_flight_;
@@ -56,10 +60,20 @@ class AdmissionQueue : public RateLimiter {
   /// queued node will have it's start function invoked.
   void Finish(RateLimiterNode* node) override;
 
- private:
-  const size_t limit_;
+  /// Feedback hooks used by adaptive subclasses to adjust `limit_`; no-ops
+  /// here.  `ReportSuccess` reports the latency of a successfully completed
+  /// operation; `ReportThrottled` reports that an operation failed with a
+  /// retryable error such as HTTP 429.
+  virtual void ReportSuccess(absl::Duration latency) {}
+  virtual void ReportThrottled() {}
+
+ protected:
+  /// Starts queued nodes while `in_flight_ < limit_`.  May temporarily
+  /// release `mutex_` while invoking start functions.
+  void AdmitQueuedNodes() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
   mutable absl::Mutex mutex_;
+  size_t limit_ ABSL_GUARDED_BY(mutex_);
   RateLimiterNode head_ ABSL_GUARDED_BY(mutex_);
   size_t in_flight_ ABSL_GUARDED_BY(mutex_) = 0;
 };
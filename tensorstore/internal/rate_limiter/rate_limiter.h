@@ -15,6 +15,8 @@
 #ifndef TENSORSTORE_INTERNAL_RATE_LIMITER_RATE_LIMITER_H_
 #define TENSORSTORE_INTERNAL_RATE_LIMITER_RATE_LIMITER_H_
 
+#include <stdint.h>
+
 #include "tensorstore/internal/container/intrusive_linked_list.h"
 
 namespace tensorstore {
@@ -33,6 +35,10 @@ struct RateLimiterNode {
   RateLimiterNode* next_ = nullptr;
   RateLimiterNode* prev_ = nullptr;
   StartFn start_fn_ = nullptr;
+
+  /// Time at which the node was enqueued, in nanoseconds; used by rate
+  /// limiters that track queue wait time.
+  int64_t enqueue_time_ns_ = 0;
 };
 
 using RateLimiterNodeAccessor = internal::intrusive_linked_list::MemberAccessor<
@@ -15,6 +15,7 @@
 #include "tensorstore/internal/rate_limiter/scaling_rate_limiter.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -22,6 +23,7 @@
 #include <utility>
 
 #include "absl/log/absl_check.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/rate_limiter/token_bucket_rate_limiter.h"
 
@@ -108,5 +110,96 @@ absl::Duration ConstantRateLimiter::GetSchedulerDelay() const {
   return std::max(r_, absl::Milliseconds(10));
 }
 
+namespace {
+
+// Feedback-loop tuning constants. The interval bounds how quickly the rate
+// reacts; the multiplicative factors implement AIMD-style convergence where
+// decreases dominate increases so that oscillation around the backend limit
+// stays small.
+constexpr absl::Duration kAdjustmentInterval = absl::Seconds(1);
+constexpr double kIncreaseFactor = 1.05;
+constexpr double kDecreaseFactor = 0.7;
+// Fraction of requests allowed over the target latency; 0.01 holds p99.
+constexpr double kOverTargetFraction = 0.01;
+// Minimum completed requests per interval before increasing the rate, so a
+// nearly idle interval is not mistaken for backend headroom.
+constexpr int64_t kMinSamplesToIncrease = 10;
+
+}  // namespace
+
+LatencyTargetRateLimiter::LatencyTargetRateLimiter(
+    double initial_rate, double min_rate, double max_rate,
+    absl::Duration target_latency)
+    : TokenBucketRateLimiter(GetMaxAvailable(initial_rate)),
+      min_rate_(min_rate),
+      max_rate_(max_rate),
+      target_latency_(target_latency),
+      current_rate_(initial_rate),
+      last_adjust_(start_time_) {
+  ABSL_CHECK_GT(min_rate, std::numeric_limits<double>::min());
+  ABSL_CHECK_LE(min_rate, initial_rate);
+  ABSL_CHECK_LE(initial_rate, max_rate);
+  ABSL_CHECK_GT(target_latency, absl::ZeroDuration());
+}
+
+LatencyTargetRateLimiter::LatencyTargetRateLimiter(
+    double initial_rate, double min_rate, double max_rate,
+    absl::Duration target_latency, std::function<absl::Time()> clock)
+    : TokenBucketRateLimiter(GetMaxAvailable(initial_rate), std::move(clock)),
+      min_rate_(min_rate),
+      max_rate_(max_rate),
+      target_latency_(target_latency),
+      current_rate_(initial_rate),
+      last_adjust_(start_time_) {
+  ABSL_CHECK_GT(min_rate, std::numeric_limits<double>::min());
+  ABSL_CHECK_LE(min_rate, initial_rate);
+  ABSL_CHECK_LE(initial_rate, max_rate);
+  ABSL_CHECK_GT(target_latency, absl::ZeroDuration());
+}
+
+void LatencyTargetRateLimiter::ReportLatency(absl::Duration latency) {
+  absl::MutexLock lock(&feedback_mutex_);
+  total_++;
+  if (latency > target_latency_) {
+    over_target_++;
+  }
+  MaybeAdjustRate(clock_());
+}
+
+void LatencyTargetRateLimiter::ReportThrottled() {
+  absl::MutexLock lock(&feedback_mutex_);
+  total_++;
+  throttled_++;
+  MaybeAdjustRate(clock_());
+}
+
+void LatencyTargetRateLimiter::MaybeAdjustRate(absl::Time now) {
+  if (now - last_adjust_ < kAdjustmentInterval) return;
+  double rate = current_rate_.load(std::memory_order_relaxed);
+  if (throttled_ > 0 ||
+      static_cast<double>(over_target_) >
+          kOverTargetFraction * static_cast<double>(total_)) {
+    rate *= kDecreaseFactor;
+  } else if (total_ >= kMinSamplesToIncrease) {
+    rate *= kIncreaseFactor;
+  }
+  current_rate_.store(std::clamp(rate, min_rate_, max_rate_),
+                      std::memory_order_relaxed);
+  total_ = 0;
+  over_target_ = 0;
+  throttled_ = 0;
+  last_adjust_ = now;
+}
+
+double LatencyTargetRateLimiter::TokensToAdd(absl::Time current,
+                                             absl::Time previous) const {
+  return current_rate_.load(std::memory_order_relaxed) *
+         absl::ToDoubleSeconds(current - previous);
+}
+
+absl::Duration LatencyTargetRateLimiter::GetSchedulerDelay() const {
+  return absl::Milliseconds(10);
+}
+
 }  // namespace internal
 }  // namespace tensorstore
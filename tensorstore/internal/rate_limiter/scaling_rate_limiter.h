@@ -15,8 +15,13 @@
 #ifndef TENSORSTORE_INTERNAL_RATE_LIMITER_SCALING_RATE_LIMITER_H_
 #define TENSORSTORE_INTERNAL_RATE_LIMITER_SCALING_RATE_LIMITER_H_
 
+#include <stdint.h>
+
+#include <atomic>
 #include <functional>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/internal/rate_limiter/token_bucket_rate_limiter.h"
 
@@ -83,6 +88,74 @@ class ConstantRateLimiter : public TokenBucketRateLimiter {
   const absl::Duration r_;  // interval at which new tokens are added.
 };
 
+/// LatencyTargetRateLimiter adjusts its rate based on observed per-request
+/// outcomes instead of a fixed growth schedule. Callers report each request
+/// completion via `ReportLatency` (or `ReportThrottled` for 429-style
+/// responses); once per adjustment interval the rate is increased
+/// multiplicatively while the tail latency stays under `target_latency`, and
+/// decreased when the tail exceeds the target or any request was throttled.
+/// The rate therefore converges on the highest sustainable value for the
+/// backend, making a single configuration portable across deployments with
+/// different backend capacities.
+///
+/// The tail criterion is the fraction of requests in the interval exceeding
+/// `target_latency`; the rate is reduced when more than 1% exceed it (i.e. it
+/// holds p99 under the target).
+class LatencyTargetRateLimiter : public TokenBucketRateLimiter {
+ public:
+  /// Constructs a LatencyTargetRateLimiter. The rate starts at
+  /// `initial_rate` and is kept within [`min_rate`, `max_rate`].
+  LatencyTargetRateLimiter(double initial_rate, double min_rate,
+                           double max_rate, absl::Duration target_latency);
+
+  // Test constructor.
+  LatencyTargetRateLimiter(double initial_rate, double min_rate,
+                           double max_rate, absl::Duration target_latency,
+                           std::function<absl::Time()> clock);
+
+  ~LatencyTargetRateLimiter() override = default;
+
+  /// Accessors.
+  double min_rate() const { return min_rate_; }
+  double max_rate() const { return max_rate_; }
+  absl::Duration target_latency() const { return target_latency_; }
+
+  /// Current requests-per-second rate.
+  double current_rate() const {
+    return current_rate_.load(std::memory_order_relaxed);
+  }
+
+  /// Records the observed latency of a completed request.
+  void ReportLatency(absl::Duration latency);
+
+  /// Records a throttled (HTTP 429 / retry-requested) request outcome.
+  void ReportThrottled();
+
+  double TokensToAdd(absl::Time current, absl::Time previous) const override;
+
+  // Returns the delay for next work unit.
+  absl::Duration GetSchedulerDelay() const override;
+
+ private:
+  /// Applies one rate adjustment if the adjustment interval has elapsed.
+  void MaybeAdjustRate(absl::Time now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(feedback_mutex_);
+
+  const double min_rate_;
+  const double max_rate_;
+  const absl::Duration target_latency_;
+
+  /// Read by `TokensToAdd` under the base-class mutex; written under
+  /// `feedback_mutex_`, so accessed atomically.
+  std::atomic<double> current_rate_;
+
+  absl::Mutex feedback_mutex_;
+  int64_t total_ ABSL_GUARDED_BY(feedback_mutex_) = 0;
+  int64_t over_target_ ABSL_GUARDED_BY(feedback_mutex_) = 0;
+  int64_t throttled_ ABSL_GUARDED_BY(feedback_mutex_) = 0;
+  absl::Time last_adjust_ ABSL_GUARDED_BY(feedback_mutex_);
+};
+
 }  // namespace internal
 }  // namespace tensorstore
 
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -36,6 +37,7 @@ using ::tensorstore::internal::AtomicReferenceCount;
 using ::tensorstore::internal::ConstantRateLimiter;
 using ::tensorstore::internal::DoublingRateLimiter;
 using ::tensorstore::internal::IntrusivePtr;
+using ::tensorstore::internal::LatencyTargetRateLimiter;
 using ::tensorstore::internal::MakeIntrusivePtr;
 using ::tensorstore::internal::RateLimiter;
 using ::tensorstore::internal::RateLimiterNode;
@@ -94,6 +96,40 @@ TEST(ConstantRateLimiter, Basic) {
   EXPECT_EQ(100, done);
 }
 
+TEST(ConstantRateLimiter, PressureListener) {
+  absl::Time now = absl::Now();
+  ConstantRateLimiter queue(0.2, [&now]() { return now; });
+
+  std::vector<bool> transitions;
+  size_t id = queue.RegisterPressureListener([&transitions](
+      bool under_pressure) { transitions.push_back(under_pressure); });
+
+  EXPECT_FALSE(queue.under_pressure());
+
+  // No tokens are available yet, so admitting work creates a backlog.
+  std::atomic<size_t> done{0};
+  for (int i = 0; i < 2; i++) {
+    auto node = MakeIntrusivePtr<Node>(&queue, [&done] {  //
+      done++;
+    });
+
+    intrusive_ptr_increment(node.get());  // adopted by Node::Start.
+    queue.Admit(node.get(), &Node::Start);
+  }
+  EXPECT_EQ(0, done);
+  EXPECT_TRUE(queue.under_pressure());
+  EXPECT_THAT(transitions, ::testing::ElementsAre(true));
+
+  // Draining the backlog clears the pressure signal.
+  now += absl::Seconds(20);
+  queue.PeriodicCallForTesting();
+  EXPECT_EQ(2, done);
+  EXPECT_FALSE(queue.under_pressure());
+  EXPECT_THAT(transitions, ::testing::ElementsAre(true, false));
+
+  queue.UnregisterPressureListener(id);
+}
+
 TEST(DoublingRateLimiter, Basic) {
   absl::Time now = absl::Now();
 
@@ -141,4 +177,93 @@ TEST(DoublingRateLimiter, Basic) {
   EXPECT_EQ(100, done);
 }
 
+TEST(LatencyTargetRateLimiter, Basic) {
+  absl::Time now = absl::Now();
+  LatencyTargetRateLimiter queue(
+      /*initial_rate=*/10, /*min_rate=*/1, /*max_rate=*/1000,
+      /*target_latency=*/absl::Milliseconds(100), [&now]() { return now; });
+
+  EXPECT_EQ(1, queue.min_rate());
+  EXPECT_EQ(1000, queue.max_rate());
+  EXPECT_EQ(absl::Milliseconds(100), queue.target_latency());
+  EXPECT_EQ(10, queue.current_rate());
+
+  EXPECT_EQ(0, queue.TokensToAdd(now, now));
+  EXPECT_EQ(100, queue.TokensToAdd(now + absl::Seconds(10), now));
+}
+
+TEST(LatencyTargetRateLimiter, IncreasesRateWhenUnderTarget) {
+  absl::Time now = absl::Now();
+  LatencyTargetRateLimiter queue(
+      /*initial_rate=*/10, /*min_rate=*/1, /*max_rate=*/1000,
+      /*target_latency=*/absl::Milliseconds(100), [&now]() { return now; });
+
+  for (int interval = 0; interval < 5; ++interval) {
+    for (int i = 0; i < 100; i++) {
+      queue.ReportLatency(absl::Milliseconds(10));
+    }
+    now += absl::Seconds(2);
+    queue.ReportLatency(absl::Milliseconds(10));
+  }
+  EXPECT_GT(queue.current_rate(), 10);
+}
+
+TEST(LatencyTargetRateLimiter, DecreasesRateWhenOverTarget) {
+  absl::Time now = absl::Now();
+  LatencyTargetRateLimiter queue(
+      /*initial_rate=*/100, /*min_rate=*/1, /*max_rate=*/1000,
+      /*target_latency=*/absl::Milliseconds(100), [&now]() { return now; });
+
+  // More than 1% of requests over the latency target.
+  for (int i = 0; i < 95; i++) {
+    queue.ReportLatency(absl::Milliseconds(10));
+  }
+  for (int i = 0; i < 5; i++) {
+    queue.ReportLatency(absl::Milliseconds(500));
+  }
+  now += absl::Seconds(2);
+  queue.ReportLatency(absl::Milliseconds(10));
+  EXPECT_LT(queue.current_rate(), 100);
+}
+
+TEST(LatencyTargetRateLimiter, DecreasesRateWhenThrottled) {
+  absl::Time now = absl::Now();
+  LatencyTargetRateLimiter queue(
+      /*initial_rate=*/100, /*min_rate=*/1, /*max_rate=*/1000,
+      /*target_latency=*/absl::Milliseconds(100), [&now]() { return now; });
+
+  for (int i = 0; i < 100; i++) {
+    queue.ReportLatency(absl::Milliseconds(10));
+  }
+  queue.ReportThrottled();
+  now += absl::Seconds(2);
+  queue.ReportLatency(absl::Milliseconds(10));
+  EXPECT_LT(queue.current_rate(), 100);
+}
+
+TEST(LatencyTargetRateLimiter, RateStaysWithinBounds) {
+  absl::Time now = absl::Now();
+  LatencyTargetRateLimiter queue(
+      /*initial_rate=*/2, /*min_rate=*/2, /*max_rate=*/4,
+      /*target_latency=*/absl::Milliseconds(100), [&now]() { return now; });
+
+  // Throttle repeatedly; rate must not fall below min_rate.
+  for (int interval = 0; interval < 10; ++interval) {
+    queue.ReportThrottled();
+    now += absl::Seconds(2);
+    queue.ReportThrottled();
+  }
+  EXPECT_EQ(2, queue.current_rate());
+
+  // Sustained low latency; rate must not exceed max_rate.
+  for (int interval = 0; interval < 50; ++interval) {
+    for (int i = 0; i < 20; i++) {
+      queue.ReportLatency(absl::Milliseconds(1));
+    }
+    now += absl::Seconds(2);
+    queue.ReportLatency(absl::Milliseconds(1));
+  }
+  EXPECT_EQ(4, queue.current_rate());
+}
+
 }  // namespace
@@ -14,9 +14,12 @@
 
 #include "tensorstore/internal/rate_limiter/token_bucket_rate_limiter.h"
 
+#include <stddef.h>
+
 #include <cassert>
 #include <functional>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/thread_annotations.h"
@@ -94,6 +97,25 @@ absl::Duration TokenBucketRateLimiter::GetSchedulerDelay() const {
   return absl::Milliseconds(10);
 }
 
+size_t TokenBucketRateLimiter::RegisterPressureListener(
+    PressureListener listener) {
+  absl::MutexLock lock(&mutex_);
+  size_t id = next_pressure_listener_id_++;
+  pressure_listeners_.push_back({id, std::move(listener)});
+  return id;
+}
+
+void TokenBucketRateLimiter::UnregisterPressureListener(size_t id) {
+  absl::MutexLock lock(&mutex_);
+  for (auto it = pressure_listeners_.begin(); it != pressure_listeners_.end();
+       ++it) {
+    if (it->id == id) {
+      pressure_listeners_.erase(it);
+      return;
+    }
+  }
+}
+
 void TokenBucketRateLimiter::PeriodicCallForTesting() {
   absl::MutexLock lock(&mutex_);
   assert(!allow_schedule_at_);
@@ -153,11 +175,25 @@ void TokenBucketRateLimiter::PerformWorkLocked() {
     }
   }
 
-  if (count == 0) {
+  // Detect backlog transitions; the limiter is under pressure when
+  // operations remain queued after the available tokens were exhausted.
+  const bool now_under_pressure = !OnlyContainsNode(accessor, &head_);
+  std::vector<PressureListener> listeners_to_notify;
+  if (now_under_pressure != under_pressure_) {
+    under_pressure_ = now_under_pressure;
+    ABSL_LOG_IF(INFO, rate_limiter_logging)
+        << "Pressure " << (now_under_pressure ? "on" : "off");
+    listeners_to_notify.reserve(pressure_listeners_.size());
+    for (auto& entry : pressure_listeners_) {
+      listeners_to_notify.push_back(entry.listener);
+    }
+  }
+
+  if (count == 0 && listeners_to_notify.empty()) {
     return;
   }
 
-  // Run all nodes without locks.
+  // Run all nodes and notify pressure listeners without locks.
   mutex_.Unlock();
   ABSL_LOG_IF(INFO, rate_limiter_logging.Level(1)) << "Starting " << count;
   for (int i = 0; i < count; ++i) {
@@ -165,6 +201,9 @@ void TokenBucketRateLimiter::PerformWorkLocked() {
     internal::intrusive_linked_list::Remove(accessor, n);
     RunStartFunction(n);
   }
+  for (auto& listener : listeners_to_notify) {
+    listener(now_under_pressure);
+  }
   mutex_.Lock();
 }
 
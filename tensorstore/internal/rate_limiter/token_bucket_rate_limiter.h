@@ -15,7 +15,10 @@
 #ifndef TENSORSTORE_INTERNAL_RATE_LIMITER_TOKEN_BUCKET_RATE_LIMITER_H_
 #define TENSORSTORE_INTERNAL_RATE_LIMITER_TOKEN_BUCKET_RATE_LIMITER_H_
 
+#include <stddef.h>
+
 #include <functional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
@@ -60,6 +63,31 @@ class TokenBucketRateLimiter : public RateLimiter {
   // Returns the delay for next work unit.
   virtual absl::Duration GetSchedulerDelay() const;
 
+  // Invoked when the limiter transitions into (`under_pressure == true`) or
+  // out of (`under_pressure == false`) a backlogged state, i.e. when
+  // operations remain queued after the available tokens have been exhausted.
+  //
+  // This allows issuers of low-priority work (e.g. prefetch or statistics
+  // reads) to shed or defer that work while the backend is throttling,
+  // rather than having all operations slow down uniformly.  Listeners are
+  // invoked without the limiter mutex held, but may not re-entrantly
+  // register or unregister listeners.
+  using PressureListener = std::function<void(bool under_pressure)>;
+
+  // Registers `listener` and returns an id for unregistering it.
+  size_t RegisterPressureListener(PressureListener listener)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Unregisters the listener previously returned by
+  // `RegisterPressureListener`.
+  void UnregisterPressureListener(size_t id) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Returns whether the limiter is currently backlogged.
+  bool under_pressure() const {
+    absl::MutexLock l(&mutex_);
+    return under_pressure_;
+  }
+
   // Allows test-based manipulation of PerformWork.
   void PeriodicCallForTesting() ABSL_LOCKS_EXCLUDED(mutex_);
 
@@ -80,6 +108,16 @@ class TokenBucketRateLimiter : public RateLimiter {
   double available_ ABSL_GUARDED_BY(mutex_) = 0;
   bool scheduled_ ABSL_GUARDED_BY(mutex_) = false;
   bool allow_schedule_at_ ABSL_GUARDED_BY(mutex_) = true;
+
+  // Pressure signal state.
+  struct PressureListenerEntry {
+    size_t id;
+    PressureListener listener;
+  };
+  std::vector<PressureListenerEntry> pressure_listeners_
+      ABSL_GUARDED_BY(mutex_);
+  size_t next_pressure_listener_id_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool under_pressure_ ABSL_GUARDED_BY(mutex_) = false;
 };
 
 }  // namespace internal
@@ -0,0 +1,162 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/swap_endian_bulk.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cstring>
+
+#include "tensorstore/index.h"
+#include "tensorstore/util/endian.h"
+
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define TENSORSTORE_INTERNAL_SWAP_ENDIAN_AVX2 1
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define TENSORSTORE_INTERNAL_SWAP_ENDIAN_NEON 1
+#endif
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+template <size_t SubElementSize>
+void SwapEndianScalar(Index count, const char* source, char* dest) {
+  for (Index i = 0; i < count; ++i) {
+    SwapEndianUnaligned<SubElementSize>(source + i * SubElementSize,
+                                        dest + i * SubElementSize);
+  }
+}
+
+#ifdef TENSORSTORE_INTERNAL_SWAP_ENDIAN_AVX2
+
+bool HaveAvx2() {
+  static const bool have = __builtin_cpu_supports("avx2");
+  return have;
+}
+
+// Byte shuffle masks reversing each group of 2, 4, or 8 bytes within each
+// 128-bit lane (`vpshufb` shuffles within lanes; element sizes <= 8 never
+// straddle a lane boundary).
+alignas(32) constexpr unsigned char kSwapMask2[32] = {
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+alignas(32) constexpr unsigned char kSwapMask4[32] = {
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+alignas(32) constexpr unsigned char kSwapMask8[32] = {
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+// Note: Not a template because GCC does not support the `target` attribute on
+// function templates.
+__attribute__((target("avx2"))) void SwapEndianAvx2(size_t sub_element_size,
+                                                    Index count,
+                                                    const char* source,
+                                                    char* dest) {
+  const unsigned char* mask_bytes = sub_element_size == 2   ? kSwapMask2
+                                    : sub_element_size == 4 ? kSwapMask4
+                                                            : kSwapMask8;
+  const __m256i mask =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(mask_bytes));
+  const Index elements_per_vector =
+      static_cast<Index>(32 / sub_element_size);
+  Index i = 0;
+  const Index vector_count = count - count % elements_per_vector;
+  for (; i < vector_count; i += elements_per_vector) {
+    __m256i v = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(source + i * sub_element_size));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dest + i * sub_element_size),
+        _mm256_shuffle_epi8(v, mask));
+  }
+  const Index remaining = count - i;
+  source += i * sub_element_size;
+  dest += i * sub_element_size;
+  switch (sub_element_size) {
+    case 2:
+      SwapEndianScalar<2>(remaining, source, dest);
+      break;
+    case 4:
+      SwapEndianScalar<4>(remaining, source, dest);
+      break;
+    default:
+      SwapEndianScalar<8>(remaining, source, dest);
+      break;
+  }
+}
+
+#endif  // TENSORSTORE_INTERNAL_SWAP_ENDIAN_AVX2
+
+#ifdef TENSORSTORE_INTERNAL_SWAP_ENDIAN_NEON
+
+template <size_t SubElementSize>
+void SwapEndianNeon(Index count, const char* source, char* dest) {
+  Index i = 0;
+  const Index vector_count = count - count % (16 / SubElementSize);
+  for (; i < vector_count; i += 16 / SubElementSize) {
+    uint8x16_t v = vld1q_u8(
+        reinterpret_cast<const uint8_t*>(source + i * SubElementSize));
+    if constexpr (SubElementSize == 2) {
+      v = vrev16q_u8(v);
+    } else if constexpr (SubElementSize == 4) {
+      v = vrev32q_u8(v);
+    } else {
+      v = vrev64q_u8(v);
+    }
+    vst1q_u8(reinterpret_cast<uint8_t*>(dest + i * SubElementSize), v);
+  }
+  SwapEndianScalar<SubElementSize>(count - i, source + i * SubElementSize,
+                                   dest + i * SubElementSize);
+}
+
+#endif  // TENSORSTORE_INTERNAL_SWAP_ENDIAN_NEON
+
+}  // namespace
+
+template <size_t SubElementSize>
+void SwapEndianBulk(Index count, const void* source, void* dest) {
+  static_assert(SubElementSize == 1 || SubElementSize == 2 ||
+                SubElementSize == 4 || SubElementSize == 8);
+  const char* s = static_cast<const char*>(source);
+  char* d = static_cast<char*>(dest);
+  if constexpr (SubElementSize == 1) {
+    if (s != d) std::memmove(d, s, count);
+    return;
+  } else {
+#ifdef TENSORSTORE_INTERNAL_SWAP_ENDIAN_AVX2
+    if (HaveAvx2()) {
+      SwapEndianAvx2(SubElementSize, count, s, d);
+      return;
+    }
+#elif defined(TENSORSTORE_INTERNAL_SWAP_ENDIAN_NEON)
+    SwapEndianNeon<SubElementSize>(count, s, d);
+    return;
+#endif
+    SwapEndianScalar<SubElementSize>(count, s, d);
+  }
+}
+
+template void SwapEndianBulk<1>(Index, const void*, void*);
+template void SwapEndianBulk<2>(Index, const void*, void*);
+template void SwapEndianBulk<4>(Index, const void*, void*);
+template void SwapEndianBulk<8>(Index, const void*, void*);
+
+}  // namespace internal
+}  // namespace tensorstore
@@ -0,0 +1,56 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_SWAP_ENDIAN_BULK_H_
+#define TENSORSTORE_INTERNAL_SWAP_ENDIAN_BULK_H_
+
+/// \file
+/// Bulk byte-swapping of contiguous buffers.
+///
+/// `SwapEndianUnaligned` (util/endian.h) swaps a single value at a time; for
+/// whole chunks the per-element loop is limited by instruction throughput
+/// rather than memory bandwidth.  `SwapEndianBulk` processes a contiguous run
+/// of values using SIMD byte shuffles (AVX2 `vpshufb`, selected at runtime, on
+/// x86-64; `vrev` on NEON), falling back to the scalar swap otherwise.
+///
+/// `source` and `dest` must either refer to non-overlapping buffers or be
+/// equal (in-place swap); there are no alignment requirements.
+
+#include <stddef.h>
+
+#include "tensorstore/index.h"
+
+namespace tensorstore {
+namespace internal {
+
+/// Swaps the byte order of `count` contiguous values of `SubElementSize`
+/// bytes, reading from `source` and writing to `dest`.
+///
+/// For an array of elements composed of multiple sub-elements (e.g. complex
+/// numbers), pass the total number of sub-elements as `count`.
+///
+/// \tparam SubElementSize Size in bytes of each value; must be 1, 2, 4, or 8.
+///     A size of 1 copies without swapping.
+template <size_t SubElementSize>
+void SwapEndianBulk(Index count, const void* source, void* dest);
+
+extern template void SwapEndianBulk<1>(Index, const void*, void*);
+extern template void SwapEndianBulk<2>(Index, const void*, void*);
+extern template void SwapEndianBulk<4>(Index, const void*, void*);
+extern template void SwapEndianBulk<8>(Index, const void*, void*);
+
+}  // namespace internal
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_SWAP_ENDIAN_BULK_H_
@@ -0,0 +1,85 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/swap_endian_bulk.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "tensorstore/index.h"
+#include "tensorstore/util/endian.h"
+
+namespace {
+
+using ::tensorstore::Index;
+using ::tensorstore::internal::SwapEndianBulk;
+using ::tensorstore::internal::SwapEndianUnaligned;
+
+template <size_t SubElementSize>
+void TestSwapEndianBulk(Index count) {
+  std::vector<unsigned char> source(count * SubElementSize);
+  for (size_t i = 0; i < source.size(); ++i) {
+    source[i] = static_cast<unsigned char>(i * 37 + 11);
+  }
+  std::vector<unsigned char> expected(source.size());
+  for (Index i = 0; i < count; ++i) {
+    SwapEndianUnaligned<SubElementSize>(source.data() + i * SubElementSize,
+                                        expected.data() + i * SubElementSize);
+  }
+
+  // Out-of-place.
+  std::vector<unsigned char> dest(source.size());
+  SwapEndianBulk<SubElementSize>(count, source.data(), dest.data());
+  EXPECT_EQ(expected, dest);
+
+  // In-place.
+  std::vector<unsigned char> inplace = source;
+  SwapEndianBulk<SubElementSize>(count, inplace.data(), inplace.data());
+  EXPECT_EQ(expected, inplace);
+}
+
+TEST(SwapEndianBulkTest, Size1) {
+  // Size 1 is a plain copy.
+  std::vector<unsigned char> source{1, 2, 3, 4, 5};
+  std::vector<unsigned char> dest(source.size());
+  SwapEndianBulk<1>(source.size(), source.data(), dest.data());
+  EXPECT_EQ(source, dest);
+}
+
+TEST(SwapEndianBulkTest, Size2) {
+  // Exercise counts below, equal to, and above the vector width, including
+  // remainders.
+  for (Index count : {0, 1, 3, 15, 16, 17, 31, 32, 100, 1000}) {
+    SCOPED_TRACE(count);
+    TestSwapEndianBulk<2>(count);
+  }
+}
+
+TEST(SwapEndianBulkTest, Size4) {
+  for (Index count : {0, 1, 3, 7, 8, 9, 15, 16, 100, 1000}) {
+    SCOPED_TRACE(count);
+    TestSwapEndianBulk<4>(count);
+  }
+}
+
+TEST(SwapEndianBulkTest, Size8) {
+  for (Index count : {0, 1, 3, 4, 5, 7, 8, 100, 1000}) {
+    SCOPED_TRACE(count);
+    TestSwapEndianBulk<8>(count);
+  }
+}
+
+}  // namespace
@@ -14,6 +14,7 @@
 
 #include "tensorstore/internal/thread/schedule_at.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <algorithm>
@@ -77,12 +78,33 @@ struct DeadlineTaskStopCallback {
   void operator()() const;
 };
 
+/// Number of shards into which pending tasks are hashed.
+///
+/// Each shard has its own mutex and tree, so that concurrent `ScheduleAt`
+/// calls (e.g. tens of thousands of retry/staleness timers) contend only on
+/// 1/`kNumShards` of the inserts and each insert operates on a
+/// correspondingly smaller tree.
+constexpr size_t kNumShards = 16;
+
+/// Returns the shard for `deadline`.
+///
+/// Deadlines are bucketed at ~1ms granularity and then spread across shards
+/// by Fibonacci hashing, so that bursts of timers with nearby (but distinct)
+/// deadlines do not all map to the same shard.
+size_t ShardIndexForDeadline(absl::Time deadline) {
+  uint64_t tick = static_cast<uint64_t>(absl::ToUnixNanos(deadline)) >> 20;
+  static_assert((kNumShards & (kNumShards - 1)) == 0);
+  return static_cast<size_t>((tick * uint64_t{0x9e3779b97f4a7c15}) >>
+                             (64 - 4));
+}
+
 struct DeadlineTaskNode : public DeadlineTaskTree::NodeBase {
   DeadlineTaskNode(absl::Time deadline, ScheduleAtTask&& task,
                    const StopToken& token)
       : deadline(deadline),
         task(std::move(task)),
         trace_context(internal_tracing::TraceContext::kThread),
+        shard_index(ShardIndexForDeadline(deadline)),
         queue(TaggedQueuePointer{}),
         stop_callback(token, DeadlineTaskStopCallback{*this}) {}
 
@@ -94,6 +116,13 @@ struct DeadlineTaskNode : public DeadlineTaskTree::NodeBase {
   ScheduleAtTask task;
   ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS internal_tracing::TraceContext trace_context;
 
+  // Shard of the queue that owns this node while it is pending.
+  size_t shard_index;
+
+  // True while this node is linked into the shard's tree.  Guarded by the
+  // shard's mutex.
+  bool in_tree = false;
+
   // The raw `DeadlineTaskQueue` pointer is non-null once the task has been
   // added to the tree.  The tag bit is 1 if cancellation of the task has been
   // requested.
@@ -135,14 +164,25 @@ class DeadlineTaskQueue {
   // node if it is not already exiting.
   //
   // We can safely assume that `node` remains valid despite not initially
-  // holding a lock on `mutex_` because the `DeadlineTaskStopCallback`
-  // destructor blocks the destruction of the `DeadlineTaskNode` until any
-  // concurrently running stop callback completes.
+  // holding any lock because the `DeadlineTaskStopCallback` destructor blocks
+  // the destruction of the `DeadlineTaskNode` until any concurrently running
+  // stop callback completes.
   void TryRemove(DeadlineTaskNode& node);
 
+  // One shard of pending tasks; tasks are assigned to shards by
+  // `ShardIndexForDeadline` so that inserts and cancellations contend only on
+  // the shard lock, not on `mutex_`.
+  struct Shard {
+    absl::Mutex mutex;
+    DeadlineTaskTree tree ABSL_GUARDED_BY(mutex);
+  };
+
+  // Lock ordering: `mutex_` may be held while acquiring a shard mutex (the
+  // queue thread does so while collecting runnable tasks), but a shard mutex
+  // must not be held while acquiring `mutex_`.
   absl::Mutex mutex_;
   absl::CondVar cond_var_;
-  DeadlineTaskTree tree_ ABSL_GUARDED_BY(mutex_);
+  Shard shards_[kNumShards];
 
   // Additional circular linked list of tasks to run immediately.
   DeadlineTaskNode* run_immediately_queue_ ABSL_GUARDED_BY(mutex_);
@@ -163,45 +203,55 @@ void DeadlineTaskQueue::ScheduleAt(absl::Time target_time, ScheduleAtTask task,
   auto node = std::make_unique<DeadlineTaskNode>(target_time, std::move(task),
                                                  stop_token);
 
-  // Enqueue the task.
-  absl::MutexLock l(&mutex_);
-
-  auto tagged_queue_ptr = node->queue.exchange(TaggedQueuePointer(this));
-  if (tagged_queue_ptr.tag()) {
-    // Stop was requested already.
-    //
-    // Note: `return` destroys the task with the mutex *unlocked* because `node`
-    // is declared before `l`.
-    return;
-  }
-  if (target_time <= woken_up_) {
-    // Target time is in the past, schedule to run immediately.
-    RunImmediatelyQueueAccessor{}.SetNext(node.get(), nullptr);
-    if (run_immediately_queue_) {
-      RunImmediatelyQueueAccessor{}.SetNext(
-          RunImmediatelyQueueAccessor{}.GetPrev(run_immediately_queue_),
-          node.get());
-      RunImmediatelyQueueAccessor{}.SetPrev(run_immediately_queue_, node.get());
-    } else {
-      run_immediately_queue_ = node.get();
-      RunImmediatelyQueueAccessor{}.SetPrev(node.get(), node.get());
+  {
+    absl::MutexLock l(&mutex_);
+
+    auto tagged_queue_ptr = node->queue.exchange(TaggedQueuePointer(this));
+    if (tagged_queue_ptr.tag()) {
+      // Stop was requested already.
+      //
+      // Note: `return` destroys the task with the mutex *unlocked* because
+      // `node` is declared before `l`.
+      return;
     }
-    if (next_wakeup_ != absl::InfinitePast()) {
-      next_wakeup_ = absl::InfinitePast();
-      // Wake up thread immediately due to earlier deadline.
-      cond_var_.Signal();
+    if (target_time <= woken_up_) {
+      // Target time is in the past, schedule to run immediately.
+      RunImmediatelyQueueAccessor{}.SetNext(node.get(), nullptr);
+      if (run_immediately_queue_) {
+        RunImmediatelyQueueAccessor{}.SetNext(
+            RunImmediatelyQueueAccessor{}.GetPrev(run_immediately_queue_),
+            node.get());
+        RunImmediatelyQueueAccessor{}.SetPrev(run_immediately_queue_,
+                                              node.get());
+      } else {
+        run_immediately_queue_ = node.get();
+        RunImmediatelyQueueAccessor{}.SetPrev(node.get(), node.get());
+      }
+      if (next_wakeup_ != absl::InfinitePast()) {
+        next_wakeup_ = absl::InfinitePast();
+        // Wake up thread immediately due to earlier deadline.
+        cond_var_.Signal();
+      }
+      node.release();
+      return;
     }
-    node.release();
-    return;
   }
 
-  // Schedule to run normally.
-  tree_.FindOrInsert(
-      [&](DeadlineTaskNode& other) {
-        return target_time < other.deadline ? absl::weak_ordering::less
-                                            : absl::weak_ordering::greater;
-      },
-      [&] { return node.release(); });
+  // Schedule to run normally.  Only the shard lock is held during the insert.
+  {
+    Shard& shard = shards_[node->shard_index];
+    absl::MutexLock shard_lock(&shard.mutex);
+    node->in_tree = true;
+    shard.tree.FindOrInsert(
+        [&](DeadlineTaskNode& other) {
+          return target_time < other.deadline ? absl::weak_ordering::less
+                                              : absl::weak_ordering::greater;
+        },
+        [&] { return node.release(); });
+  }
+  // `node` may be concurrently cancelled and deleted from this point on.
+
+  absl::MutexLock l(&mutex_);
   if (target_time < next_wakeup_) {
     next_wakeup_ = target_time;
     // Wake up thread immediately due to earlier deadline.
@@ -211,33 +261,44 @@ void DeadlineTaskQueue::ScheduleAt(absl::Time target_time, ScheduleAtTask task,
 
 void DeadlineTaskQueue::Run() {
   while (true) {
-    DeadlineTaskTree runnable;
+    DeadlineTaskTree runnable[kNumShards];
     DeadlineTaskNode* run_immediately = nullptr;
+    bool have_runnable;
     {
       absl::MutexLock l(&mutex_);
       do {
         run_immediately = std::exchange(run_immediately_queue_, nullptr);
 
-        if (!run_immediately) {
-          next_wakeup_ =
-              tree_.empty() ? absl::InfiniteFuture() : tree_.begin()->deadline;
-
-          // Sleep until our next deadline.
-          schedule_at_next_event.Set(next_wakeup_);
-          cond_var_.WaitWithDeadline(&mutex_, next_wakeup_);
-        }
-
-        // Consume the queue.
+        // Consume the due tasks from each shard, and compute the next
+        // wakeup deadline from the tasks that remain.
         auto woken_up = woken_up_ = std::max(woken_up_, absl::Now());
+        auto next_deadline = absl::InfiniteFuture();
+        have_runnable = false;
+        for (size_t i = 0; i < kNumShards; ++i) {
+          Shard& shard = shards_[i];
+          absl::MutexLock shard_lock(&shard.mutex);
+          auto split_result = shard.tree.FindSplit([&](DeadlineTaskNode& node) {
+            return node.deadline <= woken_up ? absl::weak_ordering::greater
+                                             : absl::weak_ordering::less;
+          });
+          runnable[i] = std::move(split_result.trees[0]);
+          shard.tree = std::move(split_result.trees[1]);
+          for (DeadlineTaskNode& node : runnable[i]) {
+            node.in_tree = false;
+          }
+          have_runnable = have_runnable || !runnable[i].empty();
+          if (!shard.tree.empty()) {
+            next_deadline =
+                std::min(next_deadline, shard.tree.begin()->deadline);
+          }
+        }
+        if (have_runnable || run_immediately) break;
 
-        auto split_result = tree_.FindSplit([&](DeadlineTaskNode& node) {
-          return node.deadline <= woken_up ? absl::weak_ordering::greater
-                                           : absl::weak_ordering::less;
-        });
-
-        runnable = std::move(split_result.trees[0]);
-        tree_ = std::move(split_result.trees[1]);
-      } while (runnable.empty() && !run_immediately);
+        // Sleep until our next deadline.
+        next_wakeup_ = next_deadline;
+        schedule_at_next_event.Set(next_wakeup_);
+        cond_var_.WaitWithDeadline(&mutex_, next_wakeup_);
+      } while (true);
 
       next_wakeup_ = absl::InfinitePast();
     }  // MutexLock
@@ -254,12 +315,14 @@ void DeadlineTaskQueue::Run() {
       run_immediately = next;
     }
 
-    // Run any tasks in `runnable` tree.
-    for (DeadlineTaskTree::iterator it = runnable.begin(), next;
-         it != runnable.end(); it = next) {
-      next = std::next(it);
-      runnable.Remove(*it);
-      it->RunAndDelete();
+    // Run any tasks in the `runnable` trees.
+    for (size_t i = 0; i < kNumShards; ++i) {
+      for (DeadlineTaskTree::iterator it = runnable[i].begin(), next;
+           it != runnable[i].end(); it = next) {
+        next = std::next(it);
+        runnable[i].Remove(*it);
+        it->RunAndDelete();
+      }
     }
 
     internal_tracing::SwapCurrentTraceContext(&base);
@@ -290,16 +353,17 @@ void DeadlineTaskStopCallback::operator()() const {
 
 void DeadlineTaskQueue::TryRemove(DeadlineTaskNode& node) {
   {
-    absl::MutexLock lock(&mutex_);
-    // If deadline is met after the exchange operation above, the node will be
-    // removed from the queue but not destroyed.
-    if (node.deadline <= woken_up_) {
-      // Task is being executed now.  Too late to cancel.
+    Shard& shard = shards_[node.shard_index];
+    absl::MutexLock lock(&shard.mutex);
+    if (!node.in_tree) {
+      // Task was already collected for execution (or was scheduled to run
+      // immediately).  Too late to cancel; `RunAndDelete` will observe the
+      // tag bit, skip the task, and delete the node.
       return;
     }
-    tree_.Remove(node);
-    // No need to recompute `queue_ptr->next_wakeup_` here, since it can only
-    // get later.
+    shard.tree.Remove(node);
+    node.in_tree = false;
+    // No need to recompute `next_wakeup_` here, since it can only get later.
   }
   delete &node;
   schedule_at_queued_ops.Decrement();
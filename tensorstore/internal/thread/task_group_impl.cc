@@ -32,6 +32,7 @@
 #include "tensorstore/internal/metrics/gauge.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/os/fork_detection.h"
+#include "tensorstore/internal/os/numa.h"
 #include "tensorstore/internal/thread/pool_impl.h"
 #include "tensorstore/internal/thread/task.h"
 #include "tensorstore/internal/thread/task_provider.h"
@@ -132,9 +133,10 @@ struct TaskGroup::PerThreadData {
 };
 
 TaskGroup::TaskGroup(private_t, internal::IntrusivePtr<SharedThreadPool> pool,
-                     size_t thread_limit)
+                     size_t thread_limit, int numa_node)
     : pool_(std::move(pool)),
       thread_limit_(thread_limit),
+      numa_node_(numa_node),
       threads_blocked_(0),
       threads_in_use_(0),
       steal_index_(0) {}
@@ -142,6 +144,7 @@ TaskGroup::TaskGroup(private_t, internal::IntrusivePtr<SharedThreadPool> pool,
 TaskGroup::~TaskGroup() {
   assert(threads_in_use_.load(std::memory_order_relaxed) == 0);
   assert(queue_.empty());
+  assert(priority_queue_.empty());
 }
 
 int64_t TaskGroup::EstimateThreadsRequired() {
@@ -152,8 +155,8 @@ int64_t TaskGroup::EstimateThreadsRequired() {
 
   // Otherwise check the available tasks.
   absl::MutexLock lock(&mutex_);
-  if (!queue_.empty()) {
-    return std::min(n, queue_.size());
+  if (HasQueuedTasks()) {
+    return std::min(n, priority_queue_.size() + queue_.size());
   }
   for (auto* p : thread_queues_) {
     if (!p->queue.empty()) return std::min(n, p->queue.size());
@@ -178,6 +181,11 @@ void TaskGroup::DoWorkOnThread() {
     per_thread_data = data.get();
   }
 
+  // Bind to the group's NUMA node, if any, for the duration of this
+  // assignment.
+  const bool numa_bound =
+      numa_node_ >= 0 && internal_os::BindCurrentThreadToNumaNode(numa_node_);
+
   int64_t last_run_ns = absl::GetCurrentTimeNanos();
   ThreadMetrics metrics;
 
@@ -204,6 +212,11 @@ void TaskGroup::DoWorkOnThread() {
   // Update stats.
   metrics.Update();
 
+  // The thread returns to the shared pool; clear any NUMA binding.
+  if (numa_bound) {
+    internal_os::ResetCurrentThreadNumaBinding();
+  }
+
   {
     absl::MutexLock lock(&mutex_);
     threads_in_use_.fetch_sub(1, std::memory_order_relaxed);
@@ -235,7 +248,14 @@ std::unique_ptr<InFlightTask> TaskGroup::AcquireTask(PerThreadData* thread_data,
 
   absl::MutexLock lock(&mutex_);
   while (true) {
-    // Second, attempt to acquire a task from the global queue.
+    // Second, attempt to acquire a latency-sensitive task.
+    if (!priority_queue_.empty()) {
+      std::unique_ptr<InFlightTask> task = std::move(priority_queue_.front());
+      priority_queue_.pop_front();
+      return task;
+    }
+
+    // Third, attempt to acquire a task from the global queue.
     if (!queue_.empty()) {
       std::unique_ptr<InFlightTask> task = std::move(queue_.front());
       queue_.pop_front();
@@ -256,7 +276,7 @@ std::unique_ptr<InFlightTask> TaskGroup::AcquireTask(PerThreadData* thread_data,
 
     thread_data->default_assign = 1;
 
-    // Third, migrate tasks from per-thread queues.
+    // Fourth, migrate tasks from per-thread queues.
     for (size_t i = 0; i < thread_queues_.size(); ++i, ++steal_index_) {
       if (steal_index_ >= thread_queues_.size()) steal_index_ = 0;
       auto* other_data = thread_queues_[steal_index_];
@@ -275,12 +295,10 @@ std::unique_ptr<InFlightTask> TaskGroup::AcquireTask(PerThreadData* thread_data,
       return task;
     }
 
-    // No tasks acquired; wait until more work appears on the global queue.
+    // No tasks acquired; wait until more work appears on the global queues.
     ScopedIncDec blocked(threads_blocked_);
     if (!mutex_.AwaitWithTimeout(
-            absl::Condition(
-                +[](decltype(queue_)* q) { return !q->empty(); }, &queue_),
-            timeout)) {
+            absl::Condition(this, &TaskGroup::HasQueuedTasks), timeout)) {
       return nullptr;
     }
   }
@@ -331,6 +349,19 @@ void TaskGroup::AddTask(std::unique_ptr<InFlightTask> task) {
   }
 }
 
+void TaskGroup::AddPriorityTask(std::unique_ptr<InFlightTask> task) {
+  // Priority tasks always go through the shared priority queue, even from
+  // worker threads, so that any worker dispatches them first.
+  internal_os::AbortIfForkDetected();
+  {
+    absl::MutexLock lock(&mutex_);
+    priority_queue_.push_back(std::move(task));
+  }
+  if (threads_in_use_.load(std::memory_order_relaxed) < thread_limit_) {
+    pool_->NotifyWorkAvailable(internal::IntrusivePtr<TaskProvider>(this));
+  }
+}
+
 void TaskGroup::BulkAddTask(
     tensorstore::span<std::unique_ptr<InFlightTask>> tasks) {
   internal_os::AbortIfForkDetected();
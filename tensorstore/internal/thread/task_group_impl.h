@@ -45,20 +45,47 @@ using InFlightTaskQueue =
 /// TaskGroup is TaskProvider which allows adding additional tasks to a
 /// task provider, and allowing up to a specific number of threads to
 /// work on the tasks concurrently.
+///
+/// Task queuing uses two levels to limit contention between workers:
+///
+/// * Each worker thread assigned to the group owns a lock-free Chase-Lev
+///   deque (`SingleProducerQueue`).  Tasks added from a worker thread are
+///   pushed onto that thread's own deque and popped LIFO without locking;
+///   idle workers steal from other workers' deques FIFO.
+///
+/// * A mutex-protected global queue (`BlockQueue`) holds tasks added from
+///   non-worker threads, overflow from full per-thread deques, and batches
+///   migrated during steals; it also provides the wait/wake point for idle
+///   workers.
+///
+/// A separate high-priority queue holds latency-sensitive tasks added via
+/// `AddPriorityTask`; workers dispatch from it before the global queue, so
+/// such tasks jump ahead of queued bulk work without preempting tasks that
+/// a worker has already claimed.
+///
+/// The `SharedThreadPool` itself holds no task queue; it only assigns
+/// threads to task providers, so its mutex is not on the per-task path.
 class TaskGroup : public TaskProvider {
   struct private_t {};
 
  public:
   struct PerThreadData;
 
+  /// Constructs a TaskGroup.
+  ///
+  /// If `numa_node` is non-negative, each worker thread is bound to the cpus
+  /// of that NUMA node for the duration of its assignment to this group, so
+  /// that tasks run on the node that owns their data.  Threads remain part of
+  /// the shared pool; the binding is cleared when the assignment ends.
   static internal::IntrusivePtr<TaskGroup> Make(
-      internal::IntrusivePtr<SharedThreadPool> pool, size_t thread_limit) {
+      internal::IntrusivePtr<SharedThreadPool> pool, size_t thread_limit,
+      int numa_node = -1) {
     return internal::MakeIntrusivePtr<TaskGroup>(private_t{}, std::move(pool),
-                                                 thread_limit);
+                                                 thread_limit, numa_node);
   }
 
   TaskGroup(private_t, internal::IntrusivePtr<SharedThreadPool> pool,
-            size_t thread_limit);
+            size_t thread_limit, int numa_node);
 
   ~TaskGroup() override;
 
@@ -72,6 +99,12 @@ class TaskGroup : public TaskProvider {
   /// Thread safety: safe to call concurrently from multiple threads.
   void BulkAddTask(tensorstore::span<std::unique_ptr<InFlightTask>> tasks);
 
+  /// Enqueues a latency-sensitive task ahead of all normal-priority queued
+  /// tasks.
+  ///
+  /// Thread safety: safe to call concurrently from multiple threads.
+  void AddPriorityTask(std::unique_ptr<InFlightTask> task);
+
   /// Retrieve work units available.
   int64_t EstimateThreadsRequired() override;
 
@@ -79,12 +112,18 @@ class TaskGroup : public TaskProvider {
   void DoWorkOnThread() override;
 
  private:
-  /// Worker method: Acquire work from the global queue or another thread.
+  /// Worker method: Acquire work from the global queues or another thread.
   std::unique_ptr<InFlightTask> AcquireTask(PerThreadData* thread_data,
                                             absl::Duration timeout);
 
+  /// Returns whether either global queue is non-empty.
+  bool HasQueuedTasks() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    return !priority_queue_.empty() || !queue_.empty();
+  }
+
   const internal::IntrusivePtr<SharedThreadPool> pool_;
   const size_t thread_limit_;
+  const int numa_node_;
 
   // worker thread state counters; updated under lock, read without locks.
   ABSL_CACHELINE_ALIGNED std::atomic<int64_t> threads_blocked_;
@@ -93,6 +132,8 @@ class TaskGroup : public TaskProvider {
   absl::Mutex mutex_;
   internal_container::BlockQueue<std::unique_ptr<InFlightTask>> queue_
       ABSL_GUARDED_BY(mutex_);
+  internal_container::BlockQueue<std::unique_ptr<InFlightTask>> priority_queue_
+      ABSL_GUARDED_BY(mutex_);
   std::vector<PerThreadData*> thread_queues_ ABSL_GUARDED_BY(mutex_);
   size_t steal_index_ ABSL_GUARDED_BY(mutex_);
 };
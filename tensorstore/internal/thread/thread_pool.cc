@@ -37,10 +37,16 @@ namespace {
 
 struct DetachedPoolImpl {
   internal::IntrusivePtr<internal_thread_impl::TaskGroup> task_group;
+  bool high_priority = false;
 
   void operator()(ExecutorTask task, internal_tracing::TraceContext tc) const {
-    task_group->AddTask(std::make_unique<internal_thread_impl::InFlightTask>(
-        std::move(task), std::move(tc)));
+    auto in_flight = std::make_unique<internal_thread_impl::InFlightTask>(
+        std::move(task), std::move(tc));
+    if (high_priority) {
+      task_group->AddPriorityTask(std::move(in_flight));
+    } else {
+      task_group->AddTask(std::move(in_flight));
+    }
   }
   void operator()(ExecutorTask task) const {
     operator()(std::move(task), internal_tracing::TraceContext(
@@ -48,7 +54,8 @@ struct DetachedPoolImpl {
   }
 };
 
-Executor DefaultThreadPool(size_t num_threads) {
+internal::IntrusivePtr<internal_thread_impl::TaskGroup> MakeDetachedTaskGroup(
+    size_t num_threads, int numa_node) {
   static absl::NoDestructor<internal_thread_impl::SharedThreadPool> pool_;
   intrusive_ptr_increment(pool_.get());
   if (num_threads == 0 || num_threads == std::numeric_limits<size_t>::max()) {
@@ -60,16 +67,30 @@ Executor DefaultThreadPool(size_t num_threads) {
         << num_threads;
   }
 
-  return DetachedPoolImpl{internal_thread_impl::TaskGroup::Make(
+  return internal_thread_impl::TaskGroup::Make(
       internal::IntrusivePtr<internal_thread_impl::SharedThreadPool>(
           pool_.get()),
-      num_threads)};
+      num_threads, numa_node);
+}
+
+Executor DefaultThreadPool(size_t num_threads, int numa_node) {
+  return DetachedPoolImpl{MakeDetachedTaskGroup(num_threads, numa_node)};
 }
 
 }  // namespace
 
 Executor DetachedThreadPool(size_t num_threads) {
-  return DefaultThreadPool(num_threads);
+  return DefaultThreadPool(num_threads, /*numa_node=*/-1);
+}
+
+Executor DetachedNumaThreadPool(size_t num_threads, int numa_node) {
+  return DefaultThreadPool(num_threads, numa_node);
+}
+
+ThreadPoolLanes DetachedThreadPoolWithLanes(size_t num_threads) {
+  auto task_group = MakeDetachedTaskGroup(num_threads, /*numa_node=*/-1);
+  return ThreadPoolLanes{DetachedPoolImpl{task_group},
+                         DetachedPoolImpl{task_group, /*high_priority=*/true}};
 }
 
 }  // namespace internal
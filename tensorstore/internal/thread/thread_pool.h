@@ -30,6 +30,41 @@ namespace internal {
 /// \param num_threads Maximum number of threads to use.
 Executor DetachedThreadPool(size_t num_threads);
 
+/// Returns a detached thread pool executor whose worker threads are bound to
+/// the cpus of `numa_node` while assigned to this executor.
+///
+/// Threads are still drawn from (and returned to) the same shared dynamic
+/// pool as `DetachedThreadPool`; only the cpu affinity during an assignment
+/// differs.  Callers that partition work by NUMA node (e.g. decoding into
+/// node-local destination buffers) can create one executor per node and
+/// submit each task to the executor for the node that owns its data.
+///
+/// If `numa_node` is invalid or NUMA binding is unsupported on this platform,
+/// behaves identically to `DetachedThreadPool`.
+///
+/// \param num_threads Maximum number of threads to use.
+/// \param numa_node NUMA node to which worker threads are bound.
+Executor DetachedNumaThreadPool(size_t num_threads, int numa_node);
+
+/// Pair of executors backed by the same detached thread pool.
+struct ThreadPoolLanes {
+  /// Executor for bulk work (e.g. writeback, prefetch).
+  Executor normal;
+
+  /// Executor whose tasks are dispatched ahead of all queued `normal` tasks.
+  Executor high_priority;
+};
+
+/// Returns a normal/high-priority pair of executors sharing one thread pool.
+///
+/// Tasks submitted via `high_priority` jump ahead of queued `normal` tasks,
+/// so latency-sensitive work (e.g. interactive read completions) does not
+/// stall behind bulk writeback or prefetch submitted to the same pool.
+/// Running tasks are not preempted.
+///
+/// \param num_threads Maximum number of threads to use.
+ThreadPoolLanes DetachedThreadPoolWithLanes(size_t num_threads);
+
 }  // namespace internal
 }  // namespace tensorstore
 
@@ -15,12 +15,56 @@
 #include "tensorstore/internal/thread/thread_pool.h"  // IWYU pragma: keep
 
 #include <string>
+#include <vector>
 
 #include "absl/flags/commandlineflag.h"  // IWYU pragma: keep
 #include "absl/flags/reflection.h"       // IWYU pragma: keep
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
 
 void SetupThreadPoolTestEnv() {
   // No op
 }
 
 #include "tensorstore/internal/thread/thread_pool_test.inc"  // IWYU pragma: keep
+
+namespace {
+
+TEST(DetachedThreadPoolWithLanes, PriorityTasksDispatchFirst) {
+  auto lanes = tensorstore::internal::DetachedThreadPoolWithLanes(1);
+
+  // Block the single worker thread so that subsequently submitted tasks
+  // queue up.
+  absl::Notification blocker_running;
+  absl::Notification unblock;
+  lanes.normal([&] {
+    blocker_running.Notify();
+    unblock.WaitForNotification();
+  });
+  blocker_running.WaitForNotification();
+
+  absl::Mutex mutex;
+  std::vector<int> order;
+  absl::Notification done;
+  auto record = [&](int i) {
+    return [&, i] {
+      absl::MutexLock lock(&mutex);
+      order.push_back(i);
+    };
+  };
+  lanes.normal(record(1));
+  lanes.normal(record(2));
+  lanes.high_priority(record(3));
+  lanes.normal([&] {
+    record(4)();
+    done.Notify();
+  });
+
+  unblock.Notify();
+  done.WaitForNotification();
+
+  absl::MutexLock lock(&mutex);
+  EXPECT_EQ(order, (std::vector<int>{3, 1, 2, 4}));
+}
+
+}  // namespace
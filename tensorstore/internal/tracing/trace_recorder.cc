@@ -0,0 +1,137 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/tracing/trace_recorder.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string_view>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "absl/base/no_destructor.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/env.h"
+
+namespace tensorstore {
+namespace internal_tracing {
+namespace {
+
+// Number of slots in the ring buffer; must be a power of 2.
+constexpr size_t kTraceRingSize = 64 * 1024;
+
+// Each slot is guarded by a sequence number, odd while a write is in
+// progress.  Snapshots skip slots that change while being copied.  Two
+// writers that race on the same slot after the ring wraps may leave a torn
+// event; that is tolerated since events are best-effort debugging telemetry.
+struct Slot {
+  std::atomic<uint64_t> sequence{0};
+  TraceEvent event;
+};
+
+struct Ring {
+  std::atomic<uint64_t> next{0};
+  Slot slots[kTraceRingSize];
+};
+
+Ring& GetRing() {
+  static absl::NoDestructor<Ring> ring;
+  return *ring;
+}
+
+uint64_t ThisThreadId() {
+  thread_local const uint64_t tid = static_cast<uint64_t>(
+      std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  return tid;
+}
+
+}  // namespace
+
+std::atomic<bool> trace_recording_enabled{
+    internal::GetEnvValue<bool>("TENSORSTORE_ENABLE_TRACE_RECORDING")
+        .value_or(false)};
+
+void EnableTraceRecording(bool enabled) {
+  if (enabled) GetRing();  // Allocate the ring before recording begins.
+  trace_recording_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void RecordTraceEvent(std::string_view name, absl::Time start_time,
+                      absl::Duration duration) {
+  if (!TraceRecordingEnabled()) return;
+  auto& ring = GetRing();
+  const uint64_t ticket = ring.next.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = ring.slots[ticket & (kTraceRingSize - 1)];
+  slot.sequence.fetch_add(1, std::memory_order_acq_rel);  // odd: writing
+  auto& event = slot.event;
+  event.start_ns = absl::ToUnixNanos(start_time);
+  event.duration_ns = absl::ToInt64Nanoseconds(duration);
+  event.tid = ThisThreadId();
+  const size_t len = std::min(name.size(), TraceEvent::kMaxNameLength);
+  std::memcpy(event.name, name.data(), len);
+  event.name[len] = '\0';
+  slot.sequence.fetch_add(1, std::memory_order_release);  // even: complete
+}
+
+std::vector<TraceEvent> SnapshotTraceEvents() {
+  std::vector<TraceEvent> events;
+  auto& ring = GetRing();
+  const uint64_t next = ring.next.load(std::memory_order_acquire);
+  events.reserve(std::min<uint64_t>(next, kTraceRingSize));
+  // Iterate oldest-first starting at the slot `next` would overwrite.
+  for (uint64_t i = 0; i < kTraceRingSize; ++i) {
+    Slot& slot = ring.slots[(next + i) & (kTraceRingSize - 1)];
+    const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+    if (seq == 0 || (seq & 1)) continue;  // Empty or being written.
+    TraceEvent event = slot.event;
+    if (slot.sequence.load(std::memory_order_acquire) != seq) continue;
+    event.name[TraceEvent::kMaxNameLength] = '\0';
+    events.push_back(event);
+  }
+  return events;
+}
+
+void ClearTraceEvents() {
+  auto& ring = GetRing();
+  for (auto& slot : ring.slots) {
+    slot.sequence.store(0, std::memory_order_relaxed);
+  }
+  ring.next.store(0, std::memory_order_release);
+}
+
+void DumpChromeTrace(std::ostream& os) {
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& event : SnapshotTraceEvents()) {
+    if (!first) os << ",";
+    first = false;
+    // "X" (complete) events with timestamps and durations in microseconds.
+    os << absl::StreamFormat(
+        "\n{\"name\":\"%s\",\"cat\":\"tensorstore\",\"ph\":\"X\","
+        "\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d}",
+        event.name, event.start_ns / 1e3, event.duration_ns / 1e3,
+        event.tid & 0x7fffffff);
+  }
+  os << "\n]}\n";
+}
+
+}  // namespace internal_tracing
+}  // namespace tensorstore
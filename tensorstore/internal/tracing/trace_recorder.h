@@ -0,0 +1,83 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_INTERNAL_TRACING_TRACE_RECORDER_H_
+#define TENSORSTORE_INTERNAL_TRACING_TRACE_RECORDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "absl/time/time.h"
+
+namespace tensorstore {
+namespace internal_tracing {
+
+/// Fixed-size record of a completed trace span.
+struct TraceEvent {
+  static constexpr size_t kMaxNameLength = 47;
+
+  /// Start time, in nanoseconds since the Unix epoch.
+  int64_t start_ns;
+
+  /// Duration, in nanoseconds.
+  int64_t duration_ns;
+
+  /// Hashed id of the recording thread.
+  uint64_t tid;
+
+  /// NUL-terminated span name, truncated to `kMaxNameLength` characters.
+  char name[kMaxNameLength + 1];
+};
+
+extern std::atomic<bool> trace_recording_enabled;
+
+/// Returns whether the global trace recorder is enabled.  This is the only
+/// cost paid by trace spans while recording is disabled.
+inline bool TraceRecordingEnabled() {
+  return trace_recording_enabled.load(std::memory_order_relaxed);
+}
+
+/// Enables or disables the global trace recorder.
+///
+/// Recording is disabled by default and may also be enabled by setting the
+/// environment variable `TENSORSTORE_ENABLE_TRACE_RECORDING=1`.  The ring
+/// buffer (a few MB) is allocated when recording is first enabled.
+void EnableTraceRecording(bool enabled);
+
+/// Records a completed span into the global ring buffer.  The oldest events
+/// are overwritten once the buffer is full.  Safe to call from any thread;
+/// does nothing if recording is disabled.
+void RecordTraceEvent(std::string_view name, absl::Time start_time,
+                      absl::Duration duration);
+
+/// Returns a snapshot of the recorded events, oldest first.  Events that are
+/// concurrently overwritten during the snapshot are skipped.
+std::vector<TraceEvent> SnapshotTraceEvents();
+
+/// Discards all recorded events.
+void ClearTraceEvents();
+
+/// Writes the recorded events in the chrome://tracing "Trace Event Format"
+/// JSON, which can be loaded by chrome://tracing and by the Perfetto UI.
+void DumpChromeTrace(std::ostream& os);
+
+}  // namespace internal_tracing
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_INTERNAL_TRACING_TRACE_RECORDER_H_
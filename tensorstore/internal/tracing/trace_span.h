@@ -20,8 +20,11 @@
 #include <initializer_list>
 #include <string_view>
 
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/source_location.h"
 #include "tensorstore/internal/tracing/span_attribute.h"
+#include "tensorstore/internal/tracing/trace_recorder.h"
 #include "tensorstore/util/span.h"
 
 namespace tensorstore {
@@ -31,7 +34,9 @@ class TraceSpan {
  public:
   TraceSpan(std::string_view method,
             const SourceLocation& location = SourceLocation::current())
-      : method_(method) {}
+      : method_(method),
+        start_time_(TraceRecordingEnabled() ? absl::Now()
+                                            : absl::InfinitePast()) {}
 
   TraceSpan(std::string_view method,
             tensorstore::span<const SpanAttribute> attributes,
@@ -43,12 +48,17 @@ class TraceSpan {
             const SourceLocation& location = SourceLocation::current())
       : TraceSpan(method, location) {}
 
-  ~TraceSpan() = default;
+  ~TraceSpan() {
+    if (start_time_ != absl::InfinitePast()) {
+      RecordTraceEvent(method_, start_time_, absl::Now() - start_time_);
+    }
+  }
 
   std::string_view method() const { return method_; }
 
  private:
   std::string_view method_;
+  absl::Time start_time_;
 };
 
 }  // namespace internal_tracing
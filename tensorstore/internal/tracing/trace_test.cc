@@ -14,6 +14,7 @@
 
 #include <stdint.h>
 
+#include <sstream>
 #include <string_view>
 #include <utility>
 
@@ -25,11 +26,16 @@
 #include "tensorstore/internal/tracing/logged_trace_span.h"
 #include "tensorstore/internal/tracing/span_attribute.h"
 #include "tensorstore/internal/tracing/trace_context.h"
+#include "tensorstore/internal/tracing/trace_recorder.h"
 #include "tensorstore/internal/tracing/trace_span.h"
 
 namespace {
 
+using ::tensorstore::internal_tracing::ClearTraceEvents;
+using ::tensorstore::internal_tracing::DumpChromeTrace;
+using ::tensorstore::internal_tracing::EnableTraceRecording;
 using ::tensorstore::internal_tracing::LoggedTraceSpan;
+using ::tensorstore::internal_tracing::SnapshotTraceEvents;
 using ::tensorstore::internal_tracing::SpanAttribute;
 using ::tensorstore::internal_tracing::TraceSpan;
 using ::testing::_;
@@ -91,4 +97,27 @@ TEST(TraceTest, LoggedSpan) {
   }
 }
 
+TEST(TraceTest, Recorder) {
+  EnableTraceRecording(true);
+  ClearTraceEvents();
+
+  { TraceSpan span("RecordedSpan"); }
+
+  EnableTraceRecording(false);
+
+  auto events = SnapshotTraceEvents();
+  ASSERT_EQ(1, events.size());
+  EXPECT_EQ(std::string_view("RecordedSpan"), events[0].name);
+  EXPECT_GT(events[0].start_ns, 0);
+  EXPECT_GE(events[0].duration_ns, 0);
+
+  std::ostringstream os;
+  DumpChromeTrace(os);
+  EXPECT_THAT(os.str(), HasSubstr("\"traceEvents\""));
+  EXPECT_THAT(os.str(), HasSubstr("\"name\":\"RecordedSpan\""));
+
+  ClearTraceEvents();
+  EXPECT_TRUE(SnapshotTraceEvents().empty());
+}
+
 }  // namespace
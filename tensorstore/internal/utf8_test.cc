@@ -14,6 +14,9 @@
 
 #include "tensorstore/internal/utf8.h"
 
+#include <stddef.h>
+
+#include <string>
 #include <string_view>
 
 #include <gtest/gtest.h>
@@ -93,4 +96,30 @@ TEST(IsValidUtf8Test, OverlongNul) {
   EXPECT_FALSE(IsValidUtf8("\xfc\x80\x80\x80\x80\x80"));
 }
 
+// Strings of at least 16 bytes take the vectorized validation path on
+// supported CPUs; exercise sequences straddling the 16-byte block boundary
+// and errors in each block position.
+TEST(IsValidUtf8Test, LongStrings) {
+  const std::string ascii(64, 'a');
+  EXPECT_TRUE(IsValidUtf8(ascii));
+
+  for (size_t offset = 0; offset < 32; ++offset) {
+    const std::string prefix(offset, 'a');
+    const std::string suffix(32, 'b');
+    EXPECT_TRUE(IsValidUtf8(prefix + "\xc2\x80" + suffix));
+    EXPECT_TRUE(IsValidUtf8(prefix + "\xe0\xa0\x80" + suffix));
+    EXPECT_TRUE(IsValidUtf8(prefix + "\xf0\x90\x80\x80" + suffix));
+    // Truncated, overlong, surrogate, and out-of-range sequences.
+    EXPECT_FALSE(IsValidUtf8(prefix + "\xc2" + suffix));
+    EXPECT_FALSE(IsValidUtf8(prefix + "\xe0\xa0" + suffix));
+    EXPECT_FALSE(IsValidUtf8(prefix + "\xc0\x80" + suffix));
+    EXPECT_FALSE(IsValidUtf8(prefix + "\xed\xa0\x80" + suffix));
+    EXPECT_FALSE(IsValidUtf8(prefix + "\xf4\x90\x80\x80" + suffix));
+    EXPECT_FALSE(IsValidUtf8(prefix + "\x80" + suffix));
+    // Sequence truncated by the end of the string.
+    EXPECT_FALSE(IsValidUtf8(prefix + ascii + "\xe0\xa0"));
+    EXPECT_TRUE(IsValidUtf8(prefix + ascii + "\xe0\xa0\x80"));
+  }
+}
+
 }  // namespace
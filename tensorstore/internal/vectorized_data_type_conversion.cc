@@ -0,0 +1,515 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/vectorized_data_type_conversion.h"
+
+#include <stdint.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+#include "tensorstore/util/bfloat16.h"
+
+// Runtime-dispatched AVX2 kernels are only generated with GCC/Clang on x86,
+// which support per-function target attributes and `__builtin_cpu_supports`.
+// AVX-512 variants can be added behind the same dispatcher if warranted.
+#if defined(__x86_64__) && (defined(__clang__) || defined(__GNUC__))
+#include <immintrin.h>
+#define TENSORSTORE_INTERNAL_CONVERT_AVX2 1
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define TENSORSTORE_INTERNAL_CONVERT_NEON 1
+#endif
+
+namespace tensorstore {
+namespace internal {
+namespace {
+
+template <typename From, typename To>
+void ConvertScalar(Index count, const From* from, To* to) {
+  for (Index i = 0; i < count; ++i) {
+    to[i] = static_cast<To>(from[i]);
+  }
+}
+
+#ifdef TENSORSTORE_INTERNAL_CONVERT_AVX2
+
+bool HaveAvx2() {
+  static const bool have = __builtin_cpu_supports("avx2");
+  return have;
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const uint8_t* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const int8_t* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const uint16_t* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const int16_t* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const int32_t* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtepi32_ps(v));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const uint16_t* from,
+                                                 double* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_pd(to + i, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(v)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const int32_t* from,
+                                                 double* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+    _mm256_storeu_pd(to + i, _mm256_cvtepi32_pd(v));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const float* from,
+                                                 double* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    _mm256_storeu_pd(to + i, _mm256_cvtps_pd(_mm_loadu_ps(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const double* from,
+                                                 float* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(to + i, _mm256_cvtpd_ps(_mm256_loadu_pd(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+// bfloat16 -> float32 is an exact widening: zero-extend each 16-bit value
+// into the high half of a 32-bit word.  NaN payloads (including signaling
+// NaNs) are preserved, matching `internal::Bfloat16ToFloat`.
+__attribute__((target("avx2"))) void ConvertAvx2(
+    Index count, const dtypes::bfloat16_t* from, float* to) {
+  const uint16_t* bits = reinterpret_cast<const uint16_t*>(from);
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits + i));
+    __m256i w = _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16);
+    _mm256_storeu_ps(to + i, _mm256_castsi256_ps(w));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+// float32 -> bfloat16 using the same round-to-nearest-even bias trick as
+// `internal::Float32ToBfloat16RoundNearestEven`, with the identical NaN
+// quieting (`bits | 0x00200000`) so results are bit-for-bit equal to the
+// scalar conversion.
+__attribute__((target("avx2"))) void ConvertAvx2(Index count,
+                                                 const float* from,
+                                                 dtypes::bfloat16_t* to) {
+  uint16_t* out = reinterpret_cast<uint16_t*>(to);
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 v = _mm256_loadu_ps(from + i);
+    __m256i u = _mm256_castps_si256(v);
+    __m256i lsb =
+        _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+    __m256i rounded = _mm256_srli_epi32(
+        _mm256_add_epi32(u, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))),
+        16);
+    __m256i nan_bits = _mm256_srli_epi32(
+        _mm256_or_si256(u, _mm256_set1_epi32(0x00200000)), 16);
+    __m256i is_nan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+    __m256i r = _mm256_blendv_epi8(rounded, nan_bits, is_nan);
+    // All lanes are <= 0xFFFF, so the saturating pack is value-preserving;
+    // the pack interleaves 128-bit lanes, which the permute undoes.
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r),
+                                 _MM_SHUFFLE(0, 0, 2, 0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm256_castsi256_si128(r));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+// float16 <-> float32 via the F16C conversion instructions.  These use
+// round-to-nearest-even, matching the default rounding of the scalar
+// `half_float::half` conversion; the only difference is that the hardware
+// quiets signaling NaN payloads.
+__attribute__((target("avx,f16c"))) void ConvertF16c(
+    Index count, const dtypes::float16_t* from, float* to) {
+  const uint16_t* bits = reinterpret_cast<const uint16_t*>(from);
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    _mm256_storeu_ps(to + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                                 reinterpret_cast<const __m128i*>(bits + i))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+__attribute__((target("avx,f16c"))) void ConvertF16c(
+    Index count, const float* from, dtypes::float16_t* to) {
+  uint16_t* out = reinterpret_cast<uint16_t*>(to);
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(out + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(from + i),
+                        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+bool HaveF16c() {
+  static const bool have = __builtin_cpu_supports("f16c");
+  return have;
+}
+
+// `IsF16cKernel<From, To>` indicates that the pair is converted by a
+// `ConvertF16c` overload, which is dispatched on F16C support (F16C implies
+// AVX) rather than on AVX2 support.
+template <typename From, typename To, typename = void>
+constexpr inline bool IsF16cKernel = false;
+
+template <typename From, typename To>
+constexpr inline bool IsF16cKernel<
+    From, To,
+    std::void_t<decltype(ConvertF16c(Index(0), std::declval<const From*>(),
+                                     std::declval<To*>()))>> = true;
+
+#endif  // TENSORSTORE_INTERNAL_CONVERT_AVX2
+
+#ifdef TENSORSTORE_INTERNAL_CONVERT_NEON
+
+void ConvertNeon(Index count, const uint8_t* from, float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    uint16x8_t v = vmovl_u8(vld1_u8(from + i));
+    vst1q_f32(to + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+    vst1q_f32(to + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const int8_t* from, float* to) {
+  Index i = 0;
+  for (; i + 8 <= count; i += 8) {
+    int16x8_t v = vmovl_s8(vld1_s8(from + i));
+    vst1q_f32(to + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+    vst1q_f32(to + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const uint16_t* from, float* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(to + i, vcvtq_f32_u32(vmovl_u16(vld1_u16(from + i))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const int16_t* from, float* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(to + i, vcvtq_f32_s32(vmovl_s16(vld1_s16(from + i))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const int32_t* from, float* to) {
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(to + i, vcvtq_f32_s32(vld1q_s32(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+// bfloat16 -> float32: exact widening shift; preserves NaN payloads.
+void ConvertNeon(Index count, const dtypes::bfloat16_t* from, float* to) {
+  const uint16_t* bits = reinterpret_cast<const uint16_t*>(from);
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(to + i,
+              vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(bits + i), 16)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+// float32 -> bfloat16: same round-to-nearest-even bias trick and NaN
+// quieting as `internal::Float32ToBfloat16RoundNearestEven`.
+void ConvertNeon(Index count, const float* from, dtypes::bfloat16_t* to) {
+  uint16_t* out = reinterpret_cast<uint16_t*>(to);
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t v = vld1q_f32(from + i);
+    uint32x4_t u = vreinterpretq_u32_f32(v);
+    uint32x4_t lsb = vandq_u32(vshrq_n_u32(u, 16), vdupq_n_u32(1));
+    uint32x4_t rounded =
+        vshrq_n_u32(vaddq_u32(u, vaddq_u32(lsb, vdupq_n_u32(0x7fff))), 16);
+    uint32x4_t nan_bits = vshrq_n_u32(vorrq_u32(u, vdupq_n_u32(0x00200000)),
+                                      16);
+    uint32x4_t is_num = vceqq_f32(v, v);
+    vst1_u16(out + i, vmovn_u32(vbslq_u32(is_num, rounded, nan_bits)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+#ifdef __aarch64__
+
+// float16 <-> float32 via the scalar-profile FP16 conversion instructions,
+// which are baseline on AArch64 and round to nearest even under the default
+// FPCR rounding mode, matching the scalar `half_float::half` conversion.
+void ConvertNeon(Index count, const dtypes::float16_t* from, float* to) {
+  const __fp16* bits = reinterpret_cast<const __fp16*>(from);
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1q_f32(to + i, vcvt_f32_f16(vld1_f16(bits + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const float* from, dtypes::float16_t* to) {
+  __fp16* out = reinterpret_cast<__fp16*>(to);
+  Index i = 0;
+  for (; i + 4 <= count; i += 4) {
+    vst1_f16(out + i, vcvt_f16_f32(vld1q_f32(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const int32_t* from, double* to) {
+  Index i = 0;
+  for (; i + 2 <= count; i += 2) {
+    vst1q_f64(to + i, vcvtq_f64_s64(vmovl_s32(vld1_s32(from + i))));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const float* from, double* to) {
+  Index i = 0;
+  for (; i + 2 <= count; i += 2) {
+    vst1q_f64(to + i, vcvt_f64_f32(vld1_f32(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+void ConvertNeon(Index count, const double* from, float* to) {
+  Index i = 0;
+  for (; i + 2 <= count; i += 2) {
+    vst1_f32(to + i, vcvt_f32_f64(vld1q_f64(from + i)));
+  }
+  ConvertScalar(count - i, from + i, to + i);
+}
+
+#endif  // __aarch64__
+
+#endif  // TENSORSTORE_INTERNAL_CONVERT_NEON
+
+// `HasSimdKernel<From, To>` indicates that `ConvertVectorized(Index, const
+// From*, To*)` has a SIMD path on the current target; pairs without one use
+// the generic converter instead (see `GetVectorizedDataTypeConversion`).
+template <typename From, typename To>
+void ConvertVectorized(Index count, const From* from, To* to) {
+#ifdef TENSORSTORE_INTERNAL_CONVERT_AVX2
+  if constexpr (IsF16cKernel<From, To>) {
+    if (HaveF16c()) {
+      ConvertF16c(count, from, to);
+      return;
+    }
+  } else {
+    if (HaveAvx2()) {
+      ConvertAvx2(count, from, to);
+      return;
+    }
+  }
+#elif defined(TENSORSTORE_INTERNAL_CONVERT_NEON)
+  ConvertNeon(count, from, to);
+  return;
+#endif
+  ConvertScalar(count, from, to);
+}
+
+template <typename From, typename To, typename = void>
+constexpr inline bool HasSimdKernel = false;
+
+#ifdef TENSORSTORE_INTERNAL_CONVERT_AVX2
+template <typename From, typename To>
+constexpr inline bool HasSimdKernel<
+    From, To,
+    std::void_t<decltype(ConvertAvx2(Index(0), std::declval<const From*>(),
+                                     std::declval<To*>()))>> = true;
+template <typename From, typename To>
+constexpr inline bool HasSimdKernel<
+    From, To,
+    std::void_t<decltype(ConvertF16c(Index(0), std::declval<const From*>(),
+                                     std::declval<To*>()))>> = true;
+#elif defined(TENSORSTORE_INTERNAL_CONVERT_NEON)
+template <typename From, typename To>
+constexpr inline bool HasSimdKernel<
+    From, To,
+    std::void_t<decltype(ConvertNeon(Index(0), std::declval<const From*>(),
+                                     std::declval<To*>()))>> = true;
+#endif
+
+// Drop-in replacement for `ConvertDataType<From, To>`: same scalar behavior
+// for strided/indexed buffers, SIMD fast path for contiguous buffers.
+template <typename From, typename To>
+struct VectorizedConvert {
+  void operator()(const From* from, To* to, void*) const {
+    *to = static_cast<To>(*from);
+  }
+
+  static Index ApplyContiguous(Index count, const From* from, To* to, void*) {
+    ConvertVectorized(count, from, to);
+    return count;
+  }
+};
+
+template <typename From, typename To>
+const ElementwiseFunction<2, void*>* GetVectorizedConvertFunction() {
+  if constexpr (HasSimdKernel<From, To>) {
+    return SimpleElementwiseFunction<VectorizedConvert<From, To>(const From,
+                                                                 To),
+                                     void*>();
+  } else {
+    return nullptr;
+  }
+}
+
+}  // namespace
+
+const ElementwiseFunction<2, void*>* GetVectorizedDataTypeConversion(
+    DataTypeId from, DataTypeId to) {
+  switch (from) {
+    case DataTypeId::uint8_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<uint8_t, float>();
+      }
+      break;
+    case DataTypeId::int8_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<int8_t, float>();
+      }
+      break;
+    case DataTypeId::uint16_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<uint16_t, float>();
+      }
+      if (to == DataTypeId::float64_t) {
+        return GetVectorizedConvertFunction<uint16_t, double>();
+      }
+      break;
+    case DataTypeId::int16_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<int16_t, float>();
+      }
+      break;
+    case DataTypeId::int32_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<int32_t, float>();
+      }
+      if (to == DataTypeId::float64_t) {
+        return GetVectorizedConvertFunction<int32_t, double>();
+      }
+      break;
+    case DataTypeId::float16_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<dtypes::float16_t, float>();
+      }
+      break;
+    case DataTypeId::bfloat16_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<dtypes::bfloat16_t, float>();
+      }
+      break;
+    case DataTypeId::float32_t:
+      if (to == DataTypeId::float16_t) {
+        return GetVectorizedConvertFunction<float, dtypes::float16_t>();
+      }
+      if (to == DataTypeId::bfloat16_t) {
+        return GetVectorizedConvertFunction<float, dtypes::bfloat16_t>();
+      }
+      if (to == DataTypeId::float64_t) {
+        return GetVectorizedConvertFunction<float, double>();
+      }
+      break;
+    case DataTypeId::float64_t:
+      if (to == DataTypeId::float32_t) {
+        return GetVectorizedConvertFunction<double, float>();
+      }
+      break;
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+}  // namespace internal
+}  // namespace tensorstore
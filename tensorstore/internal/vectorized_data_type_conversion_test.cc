@@ -0,0 +1,223 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/internal/vectorized_data_type_conversion.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "tensorstore/data_type.h"
+#include "tensorstore/index.h"
+#include "tensorstore/internal/elementwise_function.h"
+
+namespace {
+
+using ::tensorstore::dtype_v;
+using ::tensorstore::Index;
+using ::tensorstore::internal::GetVectorizedDataTypeConversion;
+using ::tensorstore::internal::IterationBufferKind;
+using ::tensorstore::internal::IterationBufferPointer;
+
+// Verifies that the vectorized contiguous kernel for `From` -> `To` produces
+// exactly the same values as `static_cast`, including the non-multiple-of-
+// vector-width tail.
+template <typename From, typename To>
+void TestConversionMatchesStaticCast() {
+  const auto* function = GetVectorizedDataTypeConversion(
+      dtype_v<From>->id, dtype_v<To>->id);
+  ASSERT_NE(function, nullptr);
+  std::minstd_rand gen{42};
+  std::uniform_int_distribution<int64_t> dist(
+      std::numeric_limits<From>::lowest(), std::numeric_limits<From>::max());
+  for (const Index count : {0, 1, 3, 7, 8, 15, 64, 1000}) {
+    std::vector<From> source(count);
+    for (auto& x : source) x = static_cast<From>(dist(gen));
+    std::vector<To> dest(count);
+    ASSERT_TRUE((*function)[IterationBufferKind::kContiguous](
+        nullptr, {1, count},
+        IterationBufferPointer(source.data(), Index(0),
+                               Index(sizeof(From))),
+        IterationBufferPointer(dest.data(), Index(0), Index(sizeof(To))),
+        nullptr));
+    for (Index i = 0; i < count; ++i) {
+      EXPECT_EQ(static_cast<To>(source[i]), dest[i])
+          << "count=" << count << ", i=" << i;
+    }
+  }
+}
+
+// Returns the bit pattern of `v`, for comparisons that must treat NaN values
+// as equal if, and only if, their payloads match.
+template <typename T>
+auto Bits(T v) {
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4);
+  std::conditional_t<sizeof(T) == 2, uint16_t, uint32_t> bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return bits;
+}
+
+template <typename T>
+T FromBits(decltype(Bits(std::declval<T>())) bits) {
+  T v;
+  memcpy(&v, &bits, sizeof(bits));
+  return v;
+}
+
+// Invokes the vectorized contiguous kernel for `From` -> `To` on `source`.
+template <typename From, typename To>
+std::vector<To> RunVectorizedConversion(const std::vector<From>& source) {
+  const auto* function =
+      GetVectorizedDataTypeConversion(dtype_v<From>->id, dtype_v<To>->id);
+  EXPECT_NE(function, nullptr);
+  std::vector<To> dest(source.size());
+  EXPECT_TRUE((*function)[IterationBufferKind::kContiguous](
+      nullptr, {1, static_cast<Index>(source.size())},
+      IterationBufferPointer(const_cast<From*>(source.data()), Index(0),
+                             Index(sizeof(From))),
+      IterationBufferPointer(dest.data(), Index(0), Index(sizeof(To))),
+      nullptr));
+  return dest;
+}
+
+TEST(VectorizedDataTypeConversionTest, Uint8ToFloat32) {
+  TestConversionMatchesStaticCast<uint8_t, float>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Int8ToFloat32) {
+  TestConversionMatchesStaticCast<int8_t, float>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Uint16ToFloat32) {
+  TestConversionMatchesStaticCast<uint16_t, float>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Int16ToFloat32) {
+  TestConversionMatchesStaticCast<int16_t, float>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Int32ToFloat32) {
+  TestConversionMatchesStaticCast<int32_t, float>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Uint16ToFloat64) {
+  TestConversionMatchesStaticCast<uint16_t, double>();
+}
+
+TEST(VectorizedDataTypeConversionTest, Int32ToFloat64) {
+  TestConversionMatchesStaticCast<int32_t, double>();
+}
+
+// All 65536 bfloat16 bit patterns, including NaN, infinity, and subnormal
+// values, widen exactly; an odd count additionally exercises the scalar tail.
+TEST(VectorizedDataTypeConversionTest, Bfloat16ToFloat32) {
+  for (const Index count : {65536, 65533}) {
+    std::vector<::tensorstore::dtypes::bfloat16_t> source(count);
+    for (Index i = 0; i < count; ++i) {
+      source[i] = FromBits<::tensorstore::dtypes::bfloat16_t>(
+          static_cast<uint16_t>(i));
+    }
+    auto dest =
+        RunVectorizedConversion<::tensorstore::dtypes::bfloat16_t, float>(
+            source);
+    for (Index i = 0; i < count; ++i) {
+      ASSERT_EQ(Bits(static_cast<float>(source[i])), Bits(dest[i]))
+          << "count=" << count << ", i=" << i;
+    }
+  }
+}
+
+// Random float32 bit patterns, including NaN payloads, round to bfloat16
+// bit-for-bit identically to the scalar conversion.
+TEST(VectorizedDataTypeConversionTest, Float32ToBfloat16) {
+  std::minstd_rand gen{42};
+  std::uniform_int_distribution<uint32_t> dist;
+  for (const Index count : {0, 1, 3, 7, 8, 15, 64, 1000}) {
+    std::vector<float> source(count);
+    for (auto& x : source) x = FromBits<float>(dist(gen));
+    auto dest =
+        RunVectorizedConversion<float, ::tensorstore::dtypes::bfloat16_t>(
+            source);
+    for (Index i = 0; i < count; ++i) {
+      ASSERT_EQ(
+          Bits(static_cast<::tensorstore::dtypes::bfloat16_t>(source[i])),
+          Bits(dest[i]))
+          << "count=" << count << ", i=" << i;
+    }
+  }
+}
+
+// Signaling NaN payloads are excluded because the hardware float16
+// conversions quiet them; see `vectorized_data_type_conversion.h`.
+bool IsSignalingNanFloat16(uint16_t bits) {
+  return (bits & 0x7c00) == 0x7c00 && (bits & 0x03ff) != 0 &&
+         (bits & 0x0200) == 0;
+}
+
+TEST(VectorizedDataTypeConversionTest, Float16ToFloat32) {
+  for (const Index count : {65536, 65533}) {
+    std::vector<::tensorstore::dtypes::float16_t> source(count);
+    for (Index i = 0; i < count; ++i) {
+      uint16_t bits = static_cast<uint16_t>(i);
+      if (IsSignalingNanFloat16(bits)) bits |= 0x0200;
+      source[i] = FromBits<::tensorstore::dtypes::float16_t>(bits);
+    }
+    auto dest =
+        RunVectorizedConversion<::tensorstore::dtypes::float16_t, float>(
+            source);
+    for (Index i = 0; i < count; ++i) {
+      ASSERT_EQ(Bits(static_cast<float>(source[i])), Bits(dest[i]))
+          << "count=" << count << ", i=" << i;
+    }
+  }
+}
+
+TEST(VectorizedDataTypeConversionTest, Float32ToFloat16) {
+  std::minstd_rand gen{42};
+  std::uniform_int_distribution<uint32_t> dist;
+  for (const Index count : {0, 1, 3, 7, 8, 15, 64, 1000}) {
+    std::vector<float> source(count);
+    for (auto& x : source) {
+      do {
+        x = FromBits<float>(dist(gen));
+      } while (std::isnan(x));
+    }
+    auto dest =
+        RunVectorizedConversion<float, ::tensorstore::dtypes::float16_t>(
+            source);
+    for (Index i = 0; i < count; ++i) {
+      ASSERT_EQ(Bits(static_cast<::tensorstore::dtypes::float16_t>(source[i])),
+                Bits(dest[i]))
+          << "count=" << count << ", i=" << i;
+    }
+  }
+}
+
+TEST(VectorizedDataTypeConversionTest, UnsupportedPairsReturnNull) {
+  // Narrowing integer conversions and string conversions are not vectorized.
+  EXPECT_EQ(nullptr, GetVectorizedDataTypeConversion(
+                         dtype_v<uint16_t>->id, dtype_v<uint8_t>->id));
+  EXPECT_EQ(nullptr,
+            GetVectorizedDataTypeConversion(
+                dtype_v<::tensorstore::dtypes::string_t>->id,
+                dtype_v<::tensorstore::dtypes::json_t>->id));
+}
+
+}  // namespace
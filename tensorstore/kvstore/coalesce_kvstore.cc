@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "tensorstore/kvstore/ocdbt/io/coalesce_kvstore.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 
 #include <stddef.h>
 
@@ -57,10 +57,10 @@
 #include "tensorstore/util/result.h"
 
 namespace tensorstore {
-namespace internal_ocdbt {
+namespace internal_kvstore {
 namespace {
 
-ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+ABSL_CONST_INIT internal_log::VerboseFlag coalesce_logging("coalesce_kvstore");
 
 absl::Cord DeepCopyCord(const absl::Cord& cord) {
   // If the Cord is flat, skipping the CordBuilder improves performance.
@@ -447,7 +447,7 @@ kvstore::DriverPtr MakeCoalesceKvStoreDriver(kvstore::DriverPtr base,
                                              size_t merged_threshold,
                                              absl::Duration interval,
                                              Executor executor) {
-  ABSL_LOG_IF(INFO, ocdbt_logging)
+  ABSL_LOG_IF(INFO, coalesce_logging)
       << "Coalescing reads with threshold: " << threshold
       << ", merged_threshold: " << merged_threshold
       << ", interval: " << interval;
@@ -456,5 +456,5 @@ kvstore::DriverPtr MakeCoalesceKvStoreDriver(kvstore::DriverPtr base,
       std::move(executor));
 }
 
-}  // namespace internal_ocdbt
+}  // namespace internal_kvstore
 }  // namespace tensorstore
@@ -12,27 +12,27 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifndef TENSORSTORE_KVSTORE_OCDBT_IO_COALESCE_KVSTORE_H_
-#define TENSORSTORE_KVSTORE_OCDBT_IO_COALESCE_KVSTORE_H_
+#ifndef TENSORSTORE_KVSTORE_COALESCE_KVSTORE_H_
+#define TENSORSTORE_KVSTORE_COALESCE_KVSTORE_H_
 
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/util/executor.h"
 
 namespace tensorstore {
-namespace internal_ocdbt {
+namespace internal_kvstore {
 
 /// Adapts a base kvstore to coalesce read ranges.
 ///
 /// Concurrent reads for the same key may be merged if the ranges are
 /// separated by less than threshold bytes. 1MB may be a reasonable value
-/// for reducing GCS reads in the OCDBT driver.
+/// for reducing reads against network stores such as GCS or S3.
 kvstore::DriverPtr MakeCoalesceKvStoreDriver(kvstore::DriverPtr base,
                                              size_t threshold,
                                              size_t merged_threshold,
                                              absl::Duration interval,
                                              Executor executor);
 
-}  // namespace internal_ocdbt
+}  // namespace internal_kvstore
 }  // namespace tensorstore
 
-#endif  // TENSORSTORE_KVSTORE_OCDBT_INDIRECT_DATA_KVSTORE_DRIVER_H_
+#endif  // TENSORSTORE_KVSTORE_COALESCE_KVSTORE_H_
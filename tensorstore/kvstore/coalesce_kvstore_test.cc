@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "tensorstore/kvstore/ocdbt/io/coalesce_kvstore.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -31,7 +31,7 @@ namespace kvstore = ::tensorstore::kvstore;
 using ::tensorstore::Context;
 using ::tensorstore::OptionalByteRangeRequest;
 using ::tensorstore::internal::MockKeyValueStore;
-using ::tensorstore::internal_ocdbt::MakeCoalesceKvStoreDriver;
+using ::tensorstore::internal_kvstore::MakeCoalesceKvStoreDriver;
 using ::tensorstore::kvstore::ReadOptions;
 
 TEST(CoalesceKvstoreTest, SimpleRead) {
@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -46,6 +47,8 @@
 namespace tensorstore {
 namespace kvstore {
 
+class WriteStreamWriter;
+
 /// Abstract base class representing a key-value store specification, for
 /// creating a `Driver` from a JSON representation.
 ///
@@ -180,6 +183,18 @@ class Driver {
                                                      std::optional<Value> value,
                                                      WriteOptions options = {});
 
+  /// Opens a streaming writer for `key`, subject to the conditions specified
+  /// in `options`.
+  ///
+  /// The default implementation buffers the full value in memory and issues a
+  /// single `Write` when the writer is closed.  Drivers that support
+  /// streaming uploads natively should override it to stream chunks to
+  /// storage with bounded memory.
+  ///
+  /// This API is experimental and subject to change.
+  virtual Result<std::unique_ptr<WriteStreamWriter>> ExperimentalWriteStream(
+      Key key, WriteOptions options = {});
+
   /// Performs an optionally-conditional delete.
   ///
   /// Equivalent to calling `Write` with `value` equal to `std::nullopt`.
@@ -88,15 +88,20 @@
 #include <atomic>
 #include <cassert>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>  // IWYU pragma: keep for std::get<>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/base/optimization.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/function_ref.h"
 #include "absl/log/absl_check.h"  // IWYU pragma: keep
 #include "absl/log/absl_log.h"
@@ -105,6 +110,7 @@
 #include "absl/strings/cord.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "tensorstore/batch.h"
@@ -127,6 +133,7 @@
 #include "tensorstore/kvstore/file/util.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
@@ -143,9 +150,11 @@
 #include "tensorstore/util/status.h"
 
 // Include these last to reduce impact of macros.
+#include "tensorstore/internal/os/file_change_watcher.h"
 #include "tensorstore/internal/os/file_lister.h"
 #include "tensorstore/internal/os/file_lock.h"
 #include "tensorstore/internal/os/file_util.h"
+#include "tensorstore/internal/os/io_uring_read.h"
 
 /// This implementation does not currently support cancellation.  On Linux, most
 /// filesystem operations, like `open`, `read`, `write`, and `fsync` cannot be
@@ -180,6 +189,7 @@ namespace jb = tensorstore::internal_json_binding;
 struct FileMetrics : public internal_kvstore::CommonMetrics {
   internal_metrics::Counter<int64_t>& open_read;
   internal_metrics::Counter<int64_t>& lock_contention;
+  internal_metrics::Counter<int64_t>& mmap_read;
   // no additional members
 };
 
@@ -188,7 +198,10 @@ auto file_metrics = []() -> FileMetrics {
           TENSORSTORE_KVSTORE_COUNTER_IMPL(
               file, open_read, "Number of times a file is opened for reading"),
           TENSORSTORE_KVSTORE_COUNTER_IMPL(file, lock_contention,
-                                           " kvstore::Write lock contention")};
+                                           " kvstore::Write lock contention"),
+          TENSORSTORE_KVSTORE_COUNTER_IMPL(
+              file, mmap_read,
+              "Number of zero-copy reads served from a memory mapping")};
 }();
 
 ABSL_CONST_INIT internal_log::VerboseFlag verbose_logging("file");
@@ -201,15 +214,301 @@ bool IsFileKvstorePathValid(std::string_view path) {
   return IsKeyValid(path, kLockSuffix);
 }
 
+/// Small LRU cache of open parent directory descriptors.
+///
+/// Value files are opened relative to a cached parent directory descriptor
+/// via `::openat`, so that repeated reads within a directory avoid resolving
+/// the full path from the filesystem root each time; for deep trees with cold
+/// dentry caches (e.g. over NFS) the per-component resolution is measurable.
+///
+/// Descriptors are handed out with shared ownership so that an entry evicted
+/// or invalidated while another thread is using it remains open until the
+/// last user releases it.
+class DirectoryFdCache {
+ public:
+  using DirFd = std::shared_ptr<const UniqueFileDescriptor>;
+
+  /// Returns an open descriptor for the directory `path`, opening and caching
+  /// it if not already present.
+  Result<DirFd> GetOrOpen(std::string_view path) {
+    {
+      absl::MutexLock lock(&mutex_);
+      auto it = entries_.find(path);
+      if (it != entries_.end()) {
+        it->second.last_use = ++use_counter_;
+        return it->second.fd;
+      }
+    }
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto fd, internal_os::OpenDirectoryDescriptor(std::string(path)));
+    auto dir_fd = std::make_shared<const UniqueFileDescriptor>(std::move(fd));
+    absl::MutexLock lock(&mutex_);
+    if (entries_.size() >= kMaxEntries) {
+      // Evict the least recently used entry.
+      auto lru = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.last_use < lru->second.last_use) lru = it;
+      }
+      entries_.erase(lru);
+    }
+    // In the case of a concurrent open of the same directory, the existing
+    // entry is replaced; its descriptor remains open for existing users.
+    entries_.insert_or_assign(std::string(path),
+                              Entry{dir_fd, ++use_counter_});
+    return dir_fd;
+  }
+
+  /// Removes any cached descriptor for `path`, e.g. because the directory may
+  /// have been deleted and recreated.
+  void Invalidate(std::string_view path) {
+    absl::MutexLock lock(&mutex_);
+    entries_.erase(path);
+  }
+
+ private:
+  struct Entry {
+    DirFd fd;
+    uint64_t last_use;
+  };
+  constexpr static size_t kMaxEntries = 64;
+
+  absl::Mutex mutex_;
+  uint64_t use_counter_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+};
+
+/// Batches parent-directory fsyncs across concurrent writes, similar to
+/// database group commit.  A rename (or unlink) is durable once any fsync of
+/// the parent directory that started afterwards completes, so when many keys
+/// in the same directory are committed concurrently (e.g. by a transaction
+/// phase), a single fsync round satisfies all of the waiting writes instead
+/// of one fsync per key.
+class DirectoryFsyncBatcher {
+ public:
+  /// Makes completed renames/unlinks within the directory `dir_path`
+  /// durable.  `fd` must be an open descriptor for that directory; it is
+  /// used to perform the fsync if this caller becomes the leader of the next
+  /// round.
+  absl::Status Fsync(std::string_view dir_path, FileDescriptor fd) {
+    mutex_.Lock();
+    auto it = states_.find(dir_path);
+    if (it == states_.end()) {
+      it = states_.emplace(std::string(dir_path), std::make_shared<DirState>())
+               .first;
+    }
+    std::shared_ptr<DirState> state = it->second;
+    ++state->waiters;
+    // Any fsync round started from now on covers this caller; a round
+    // already in progress may have started too early.
+    const uint64_t target = state->rounds_started + 1;
+    while (state->rounds_completed < target) {
+      if (state->rounds_started == state->rounds_completed) {
+        // Become the leader of the next round.
+        ++state->rounds_started;
+        mutex_.Unlock();
+        auto status = internal_os::FsyncDirectory(fd);
+        mutex_.Lock();
+        state->last_status = std::move(status);
+        ++state->rounds_completed;
+      } else {
+        // Wait for the round in progress to complete; if it started before
+        // this caller arrived, the loop then leads (or waits for) another.
+        struct WaitArg {
+          DirState* state;
+          uint64_t target;
+        } arg{state.get(), target};
+        mutex_.Await(absl::Condition(
+            +[](WaitArg* arg) {
+              return arg->state->rounds_completed >= arg->target ||
+                     arg->state->rounds_started ==
+                         arg->state->rounds_completed;
+            },
+            &arg));
+      }
+    }
+    // Any fsync that completed after `target` was reached covers this
+    // caller, so the status of the most recently completed round applies.
+    absl::Status result = state->last_status;
+    if (--state->waiters == 0 &&
+        state->rounds_started == state->rounds_completed) {
+      // Erase idle entries so the map does not grow with the number of
+      // distinct directories written.
+      auto idle_it = states_.find(dir_path);
+      if (idle_it != states_.end() && idle_it->second == state) {
+        states_.erase(idle_it);
+      }
+    }
+    mutex_.Unlock();
+    return result;
+  }
+
+ private:
+  struct DirState {
+    uint64_t rounds_started = 0;
+    uint64_t rounds_completed = 0;
+    size_t waiters = 0;
+    absl::Status last_status;
+  };
+
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::shared_ptr<DirState>> states_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+/// Returns the parent directory portion of `path` (empty for a path with no
+/// directory component), used as the grouping key for batched fsyncs.
+std::string_view ParentDirectoryPath(std::string_view path) {
+  size_t end = path.size();
+  while (end > 0 && !internal_os::IsDirSeparator(path[end - 1])) --end;
+  // Trim the trailing separator, except for the root directory.
+  if (end > 1) --end;
+  return path.substr(0, end);
+}
+
+/// Caches the last-observed generation of value files so that conditional
+/// re-reads of unchanged files can be answered without a per-read ::stat.
+/// An entry is validated either by an OS change-notification watch on the
+/// parent directory (the `file_io_watch` resource) or, when no watch covers
+/// it, by a bounded-staleness TTL (the `file_io_stat_cache` resource).
+class GenerationCache {
+ public:
+  /// Creates the underlying watcher; called once at driver open when
+  /// `file_io_watch` is enabled.
+  void Enable() { watcher_ = internal_os::FileChangeWatcher::Create(); }
+
+  /// Sets the TTL used to validate entries not covered by a directory watch;
+  /// called once at driver open.  A zero TTL disables TTL validation.
+  void SetTtl(absl::Duration ttl) { ttl_ = ttl; }
+
+  bool ttl_enabled() const { return ttl_ > absl::ZeroDuration(); }
+
+  bool enabled() const { return watcher_ != nullptr || ttl_enabled(); }
+
+  /// Returns the generation recorded for `path` if it is guaranteed (watched
+  /// entries) or permitted under the TTL (unwatched entries) to still be
+  /// current.  The returned stamp carries the time as of which the
+  /// generation is known to have been observed: `now` for watch-validated
+  /// entries, the original observation time for TTL-validated ones.
+  std::optional<TimestampedStorageGeneration> GetIfUnchanged(
+      std::string_view path, absl::Time now) {
+    absl::MutexLock lock(&mutex_);
+    auto it = entries_.find(path);
+    if (it == entries_.end()) return std::nullopt;
+    auto& entry = it->second;
+    TimestampedStorageGeneration stamp;
+    if (entry.watched) {
+      if (!watcher_->Unchanged(entry.token)) {
+        entries_.erase(it);
+        return std::nullopt;
+      }
+      stamp.time = now;
+    } else {
+      if (now - entry.stat_time >= ttl_) {
+        entries_.erase(it);
+        return std::nullopt;
+      }
+      stamp.time = entry.stat_time;
+    }
+    stamp.generation = entry.generation;
+    entry.last_use = ++use_counter_;
+    return stamp;
+  }
+
+  /// Begins watching the parent directory of `path`, so that a generation
+  /// subsequently recorded for `path` can be validated.  Must be called
+  /// *before* the file is stat'd: a change racing with the stat then
+  /// invalidates the token rather than going unnoticed.  Returns `false` if
+  /// watching is disabled or the watch could not be established.
+  bool Arm(std::string_view path, internal_os::WatchToken& token) {
+    if (!watcher_) return false;
+    std::string_view dir_path = ParentDirectoryPath(path);
+    if (dir_path.empty()) return false;
+    auto result = watcher_->WatchDirectory(std::string(dir_path));
+    if (!result.ok()) return false;
+    token = *result;
+    return true;
+  }
+
+  /// Records the generation observed for `path` at `stat_time`.  When
+  /// `watched` is true, `token` must have been obtained from `Arm` before
+  /// the file was stat'd; otherwise the entry is validated by the TTL alone.
+  void Record(std::string_view path, const StorageGeneration& generation,
+              internal_os::WatchToken token, bool watched,
+              absl::Time stat_time) {
+    absl::MutexLock lock(&mutex_);
+    if (entries_.size() >= kMaxEntries) {
+      // Evict the least recently used entry.
+      auto lru = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.last_use < lru->second.last_use) lru = it;
+      }
+      entries_.erase(lru);
+    }
+    entries_.insert_or_assign(
+        std::string(path),
+        Entry{generation, token, stat_time, watched, ++use_counter_});
+  }
+
+  /// Records the generation produced by a local write or delete, observed
+  /// now, so that TTL-validated entries never serve the superseded
+  /// generation.  With the TTL enabled the new generation becomes
+  /// immediately servable; otherwise any existing entry is simply dropped
+  /// (watched entries are additionally invalidated by the watch itself).
+  void RecordLocalWrite(std::string_view path,
+                        const StorageGeneration& generation) {
+    if (!enabled() || StorageGeneration::IsUnknown(generation)) return;
+    if (!ttl_enabled()) {
+      Invalidate(path);
+      return;
+    }
+    Record(path, generation, internal_os::WatchToken{}, /*watched=*/false,
+           absl::Now());
+  }
+
+  /// Drops any entry for `path`.
+  void Invalidate(std::string_view path) {
+    absl::MutexLock lock(&mutex_);
+    entries_.erase(path);
+  }
+
+  /// Drops all entries; called after operations that affect an unbounded set
+  /// of keys, such as `DeleteRange`.
+  void Clear() {
+    absl::MutexLock lock(&mutex_);
+    entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    StorageGeneration generation;
+    internal_os::WatchToken token;
+    absl::Time stat_time;
+    bool watched;
+    uint64_t last_use;
+  };
+  constexpr static size_t kMaxEntries = 4096;
+
+  std::unique_ptr<internal_os::FileChangeWatcher> watcher_;
+  absl::Duration ttl_ = absl::ZeroDuration();
+  absl::Mutex mutex_;
+  uint64_t use_counter_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+};
+
 struct FileKeyValueStoreSpecData {
   Context::Resource<internal::FileIoConcurrencyResource> file_io_concurrency;
   Context::Resource<FileIoSyncResource> file_io_sync;
   Context::Resource<FileIoMemmapResource> file_io_memmap;
+  Context::Resource<FileIoUringResource> file_io_uring;
+  Context::Resource<FileIoDirectResource> file_io_direct;
+  Context::Resource<FileIoWatchResource> file_io_watch;
+  Context::Resource<FileIoStatCacheResource> file_io_stat_cache;
   Context::Resource<FileIoLockingResource> file_io_locking;
 
   constexpr static auto ApplyMembers = [](auto& x, auto f) {
     return f(x.file_io_concurrency, x.file_io_sync, x.file_io_memmap,
-             x.file_io_locking);
+             x.file_io_uring, x.file_io_direct, x.file_io_watch,
+             x.file_io_stat_cache, x.file_io_locking);
   };
 
   // TODO(jbms): Storing a UNIX path as a JSON string presents a challenge
@@ -235,6 +534,15 @@ struct FileKeyValueStoreSpecData {
                  jb::Projection<&FileKeyValueStoreSpecData::file_io_sync>()),
       jb::Member(FileIoMemmapResource::id,
                  jb::Projection<&FileKeyValueStoreSpecData::file_io_memmap>()),
+      jb::Member(FileIoUringResource::id,
+                 jb::Projection<&FileKeyValueStoreSpecData::file_io_uring>()),
+      jb::Member(FileIoDirectResource::id,
+                 jb::Projection<&FileKeyValueStoreSpecData::file_io_direct>()),
+      jb::Member(FileIoWatchResource::id,
+                 jb::Projection<&FileKeyValueStoreSpecData::file_io_watch>()),
+      jb::Member(
+          FileIoStatCacheResource::id,
+          jb::Projection<&FileKeyValueStoreSpecData::file_io_stat_cache>()),
       jb::Member(FileIoLockingResource::id,
                  jb::Projection<&FileKeyValueStoreSpecData::file_io_locking>())
       //
@@ -275,6 +583,10 @@ class FileKeyValueStore
 
   Future<const void> DeleteRange(KeyRange range) override;
 
+  Future<const void> ExperimentalCopyRangeFrom(
+      const internal::OpenTransactionPtr& transaction, const KvStore& source,
+      Key target_prefix, kvstore::CopyRangeOptions options) override;
+
   void ListImpl(ListOptions options, ListReceiver receiver) override;
 
   const Executor& executor() { return spec_.file_io_concurrency->executor; }
@@ -291,17 +603,31 @@ class FileKeyValueStore
   SupportedFeatures GetSupportedFeatures(
       const KeyRange& key_range) const final {
     return SupportedFeatures::kSingleKeyAtomicReadModifyWrite |
-           SupportedFeatures::kAtomicWriteWithoutOverwrite;
+           SupportedFeatures::kAtomicWriteWithoutOverwrite |
+           SupportedFeatures::kExperimentalCopyRangeFrom;
   }
 
   bool sync() const { return *spec_.file_io_sync; }
   bool memmap() const { return *spec_.file_io_memmap; }
+  bool use_io_uring() const {
+    return *spec_.file_io_uring && internal_os::IsIoUringSupported();
+  }
+  bool direct_io() const { return *spec_.file_io_direct; }
 
   FileIoLockingResource::Spec file_io_locking() const {
     return *spec_.file_io_locking;
   }
 
+  DirectoryFdCache& dir_fd_cache() { return dir_fd_cache_; }
+
+  DirectoryFsyncBatcher& fsync_batcher() { return fsync_batcher_; }
+
+  GenerationCache& generation_cache() { return generation_cache_; }
+
   FileKeyValueStoreSpecData spec_;
+  DirectoryFdCache dir_fd_cache_;
+  DirectoryFsyncBatcher fsync_batcher_;
+  GenerationCache generation_cache_;
 };
 
 absl::Status ValidateKey(std::string_view key) {
@@ -407,6 +733,52 @@ Result<UniqueFileDescriptor> OpenValueFile(const std::string& path,
   return fd;
 }
 
+/// Same as `OpenValueFile`, but opens `path` with `::openat` relative to a
+/// parent directory descriptor obtained from `dir_fd_cache`, avoiding a full
+/// path resolution from the filesystem root on every read.
+Result<UniqueFileDescriptor> OpenValueFileCached(
+    DirectoryFdCache& dir_fd_cache, const std::string& path,
+    StorageGeneration* generation, int64_t* size = nullptr) {
+#ifdef _WIN32
+  return OpenValueFile(path, generation, size);
+#else
+  const size_t sep = path.rfind('/');
+  if (sep == std::string::npos || sep == 0 || sep + 1 == path.size()) {
+    return OpenValueFile(path, generation, size);
+  }
+  const std::string_view dir_path(path.data(), sep);
+  auto dir_fd = dir_fd_cache.GetOrOpen(dir_path);
+  if (!dir_fd.ok()) {
+    // A missing parent directory implies a missing value.
+    if (absl::IsNotFound(dir_fd.status())) {
+      *generation = StorageGeneration::NoValue();
+      return UniqueFileDescriptor{};
+    }
+    return std::move(dir_fd).status();
+  }
+  auto fd = internal_os::OpenFileWrapperAt(
+      (*dir_fd)->get(), path.substr(sep + 1),
+      internal_os::OpenFlags::OpenReadOnly);
+  if (!fd.ok()) {
+    if (!absl::IsNotFound(fd.status())) return fd;
+    // The value may simply be missing, but the cached descriptor may also
+    // refer to a directory that has since been deleted and recreated.
+    // Invalidate the cache entry and retry with a full path resolution.
+    dir_fd_cache.Invalidate(dir_path);
+    return OpenValueFile(path, generation, size);
+  }
+  FileInfo info;
+  TENSORSTORE_RETURN_IF_ERROR(internal_os::GetFileInfo(fd->get(), &info));
+  if (!internal_os::IsRegularFile(info)) {
+    return absl::FailedPreconditionError(
+        absl::StrCat("Not a regular file: ", QuoteString(path)));
+  }
+  if (size) *size = internal_os::GetSize(info);
+  *generation = GetFileGeneration(info);
+  return fd;
+#endif
+}
+
 Result<absl::Cord> ReadFromFileDescriptor(FileDescriptor fd,
                                           ByteRange byte_range) {
   assert(fd != internal_os::FileDescriptorTraits::Invalid());
@@ -474,23 +846,62 @@ class BatchReadTask final
     return kvstore::ReadResult::Value(std::move(value), stamp_);
   }
 
+  // Returns `true` if every request's generation conditions fail against
+  // `generation`, i.e. the entire batch would resolve to
+  // `ReadResult::Unspecified` without reading any data.
+  bool AllRequestsAborted(const StorageGeneration& generation) {
+    for (const auto& request : request_batch.requests) {
+      if (std::get<kvstore::ReadGenerationConditions>(request).Matches(
+              generation)) {
+        return false;
+      }
+    }
+    return !request_batch.requests.empty();
+  }
+
   void ProcessBatch() {
     ABSL_LOG_IF(INFO, verbose_logging)
         << "BatchReadTask " << std::get<std::string>(batch_entry_key);
 
     stamp_.time = absl::Now();
-    file_metrics.open_read.Increment();
     auto& requests = request_batch.requests;
+    const std::string& path = std::get<std::string>(batch_entry_key);
+
+    auto& generation_cache = driver().generation_cache();
+    internal_os::WatchToken watch_token;
+    bool record_generation = false;
+    if (generation_cache.enabled()) {
+      if (auto cached = generation_cache.GetIfUnchanged(path, stamp_.time);
+          cached.has_value() && AllRequestsAborted(cached->generation)) {
+        // Every request is conditional on a generation that the directory
+        // watch or the stat-cache TTL guarantees is still current; resolve
+        // the batch without any filesystem access, exactly as
+        // `ValidateGenerationsAndByteRanges` would after a stat.
+        stamp_ = *std::move(cached);
+        internal_kvstore_batch::SetCommonResult(
+            requests, kvstore::ReadResult::Unspecified(stamp_));
+        return;
+      }
+      // Arm the watch before opening the file, so that a concurrent change
+      // invalidates the recorded generation rather than going unnoticed.
+      record_generation = generation_cache.Arm(path, watch_token);
+    }
+
+    file_metrics.open_read.Increment();
     TENSORSTORE_ASSIGN_OR_RETURN(
         fd_,
-        OpenValueFile(std::get<std::string>(batch_entry_key),
-                      &stamp_.generation, &size_),
+        OpenValueFileCached(driver().dir_fd_cache(), path, &stamp_.generation,
+                            &size_),
         internal_kvstore_batch::SetCommonResult(requests, std::move(_)));
     if (!fd_.valid()) {
       internal_kvstore_batch::SetCommonResult(
           requests, kvstore::ReadResult::Missing(stamp_.time));
       return;
     }
+    if (record_generation || generation_cache.ttl_enabled()) {
+      generation_cache.Record(path, stamp_.generation, watch_token,
+                              /*watched=*/record_generation, stamp_.time);
+    }
 
     internal_kvstore_batch::ValidateGenerationsAndByteRanges(requests, stamp_,
                                                              size_);
@@ -527,6 +938,12 @@ class BatchReadTask final
               requests, std::move(mapped_result).status());
           return;
         } else if (mapped_result.ok()) {
+          // The returned values are zero-copy: each cord references the
+          // mapping directly, which is unmapped only once the last
+          // referencing cord is destroyed, so repeat reads are served from
+          // the page cache without duplication in the process heap.
+          file_metrics.mmap_read.Increment();
+          file_metrics.bytes_read.IncrementBy(exclusive_max - inclusive_min);
           absl::Cord file_contents = std::move(mapped_result).value().as_cord();
           for (const auto& req : requests) {
             auto& byte_range_request =
@@ -554,10 +971,18 @@ class BatchReadTask final
       return;
     }
 
-    const auto& executor = driver().executor();
-
     internal_kvstore_batch::CoalescingOptions coalescing_options;
     coalescing_options.max_extra_read_bytes = 255;
+
+    if (driver().use_io_uring()) {
+      // Submit all coalesced reads as a single io_uring batch on the current
+      // thread, rather than dispatching a blocking ::pread per read to the
+      // executor.
+      ProcessBatchWithIoUring(coalescing_options);
+      return;
+    }
+
+    const auto& executor = driver().executor();
     internal_kvstore_batch::ForEachCoalescedRequest<Request>(
         requests, coalescing_options,
         [&](ByteRange coalesced_byte_range,
@@ -571,8 +996,57 @@ class BatchReadTask final
         });
   }
 
+  void ProcessBatchWithIoUring(
+      const internal_kvstore_batch::CoalescingOptions& coalescing_options) {
+    struct CoalescedRead {
+      ByteRange byte_range;
+      tensorstore::span<Request> requests;
+      internal::FlatCordBuilder buffer;
+    };
+    std::vector<CoalescedRead> reads;
+    internal_kvstore_batch::ForEachCoalescedRequest<Request>(
+        request_batch.requests, coalescing_options,
+        [&](ByteRange coalesced_byte_range,
+            tensorstore::span<Request> coalesced_requests) {
+          reads.push_back(
+              {coalesced_byte_range, coalesced_requests,
+               internal::FlatCordBuilder(coalesced_byte_range.size(), 0)});
+        });
+    file_metrics.batch_read.IncrementBy(reads.size());
+    absl::Time start_time = absl::Now();
+    std::vector<internal_os::IoUringReadRequest> io_requests(reads.size());
+    for (size_t i = 0; i < reads.size(); ++i) {
+      io_requests[i].fd = fd_.get();
+      io_requests[i].buffer = reads[i].buffer.data();
+      io_requests[i].size = reads[i].byte_range.size();
+      io_requests[i].offset = reads[i].byte_range.inclusive_min;
+    }
+    internal_os::IoUringBatchRead(tensorstore::span(io_requests));
+    file_metrics.read_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - start_time));
+    for (size_t i = 0; i < reads.size(); ++i) {
+      auto& read = reads[i];
+      if (!io_requests[i].status.ok()) {
+        internal_kvstore_batch::SetCommonResult(
+            read.requests,
+            tensorstore::MaybeAnnotateStatus(io_requests[i].status,
+                                             "Error reading from open file"));
+        continue;
+      }
+      file_metrics.bytes_read.IncrementBy(read.byte_range.size());
+      read.buffer.set_inuse(read.byte_range.size());
+      internal_kvstore_batch::ResolveCoalescedRequests(
+          read.byte_range, read.requests,
+          kvstore::ReadResult::Value(std::move(read.buffer).Build(), stamp_));
+    }
+  }
+
   void ProcessCoalescedRead(ByteRange coalesced_byte_range,
                             tensorstore::span<Request> coalesced_requests) {
+    if (coalesced_requests.size() > 1 &&
+        TryProcessVectoredRead(coalesced_byte_range, coalesced_requests)) {
+      return;
+    }
     TENSORSTORE_ASSIGN_OR_RETURN(auto read_result,
                                  DoByteRangeRead(coalesced_byte_range),
                                  internal_kvstore_batch::SetCommonResult(
@@ -580,6 +1054,80 @@ class BatchReadTask final
     internal_kvstore_batch::ResolveCoalescedRequests(
         coalesced_byte_range, coalesced_requests, std::move(read_result));
   }
+
+  // Attempts to satisfy `coalesced_requests` with a single vectored read that
+  // scatters each requested range directly into an exactly-sized buffer,
+  // directing coalescing gap bytes to a scratch buffer that is discarded.
+  // This avoids retaining the gap bytes, which taking subcords of a single
+  // flat buffer would pin in memory for as long as any request value remains
+  // alive.
+  //
+  // Returns `false` without side effects if the requests cannot be scattered
+  // because some byte ranges overlap, in which case the caller falls back to
+  // reading the full coalesced range into a single buffer.
+  bool TryProcessVectoredRead(ByteRange coalesced_byte_range,
+                              tensorstore::span<Request> coalesced_requests) {
+    // Requests are sorted by start byte by `ForEachCoalescedRequest`.
+    int64_t next_offset = coalesced_byte_range.inclusive_min;
+    int64_t max_gap = 0;
+    for (const auto& request : coalesced_requests) {
+      const auto byte_range =
+          std::get<internal_kvstore_batch::ByteRangeReadRequest>(request)
+              .byte_range.AsByteRange();
+      if (byte_range.inclusive_min < next_offset) return false;
+      max_gap = std::max(max_gap, byte_range.inclusive_min - next_offset);
+      next_offset = byte_range.exclusive_max;
+    }
+    file_metrics.batch_read.Increment();
+    absl::Time start_time = absl::Now();
+    std::vector<internal::FlatCordBuilder> buffers;
+    buffers.reserve(coalesced_requests.size());
+    std::vector<char> scratch(max_gap);
+    std::vector<internal_os::ReadVecBuffer> vec;
+    vec.reserve(2 * coalesced_requests.size());
+    next_offset = coalesced_byte_range.inclusive_min;
+    for (const auto& request : coalesced_requests) {
+      const auto byte_range =
+          std::get<internal_kvstore_batch::ByteRangeReadRequest>(request)
+              .byte_range.AsByteRange();
+      if (byte_range.inclusive_min > next_offset) {
+        vec.push_back(
+            {scratch.data(),
+             static_cast<size_t>(byte_range.inclusive_min - next_offset)});
+      }
+      buffers.emplace_back(byte_range.size(), 0);
+      vec.push_back(
+          {buffers.back().data(), static_cast<size_t>(byte_range.size())});
+      next_offset = byte_range.exclusive_max;
+    }
+    auto n = internal_os::ReadvFromFile(fd_.get(), vec,
+                                        coalesced_byte_range.inclusive_min);
+    if (!n.ok()) {
+      internal_kvstore_batch::SetCommonResult(
+          coalesced_requests,
+          tensorstore::MaybeAnnotateStatus(n.status(),
+                                           "Error reading from open file"));
+      return true;
+    }
+    if (*n != coalesced_byte_range.size()) {
+      internal_kvstore_batch::SetCommonResult(
+          coalesced_requests,
+          absl::UnavailableError("Length changed while reading"));
+      return true;
+    }
+    file_metrics.bytes_read.IncrementBy(coalesced_byte_range.size());
+    file_metrics.read_latency_ms.Observe(
+        absl::ToInt64Milliseconds(absl::Now() - start_time));
+    for (size_t i = 0; i < coalesced_requests.size(); ++i) {
+      auto& byte_range_request =
+          std::get<internal_kvstore_batch::ByteRangeReadRequest>(
+              coalesced_requests[i]);
+      buffers[i].set_inuse(byte_range_request.byte_range.size());
+      byte_range_request.promise.SetResult(kvstore::ReadResult::Value(
+          std::move(buffers[i]).Build(), stamp_));
+    }
+    return true;
+  }
 };
 
 Future<ReadResult> FileKeyValueStore::Read(Key key, ReadOptions options) {
@@ -595,10 +1143,28 @@ Future<ReadResult> FileKeyValueStore::Read(Key key, ReadOptions options) {
 
 /// ----------------------------------------------------------------------------
 
+/// Values at least this large are written with direct I/O when
+/// `file_io_direct` is enabled, bypassing the page cache so that bulk writes
+/// do not evict the read working set.  Smaller values gain nothing from
+/// bypassing the page cache and keep buffered writes.
+constexpr size_t kDirectIoWriteThreshold = 2 * 1024 * 1024;
+
 absl::Status WriteWithSync(FileDescriptor fd, const std::string& fd_path,
-                           absl::Cord value, bool sync) {
+                           absl::Cord value, bool sync, bool direct_io) {
   assert(fd != internal_os::FileDescriptorTraits::Invalid());
   auto start_write = absl::Now();
+  if (direct_io && value.size() >= kDirectIoWriteThreshold) {
+    auto n = internal_os::WriteCordToFileDirect(fd, value);
+    if (n.ok()) {
+      file_metrics.bytes_written.IncrementBy(*n);
+      value.Clear();
+    } else if (!absl::IsUnimplemented(n.status())) {
+      return MaybeAnnotateStatus(
+          n.status(), absl::StrCat("Failed writing: ", QuoteString(fd_path)));
+    }
+    // Unimplemented: direct I/O is unavailable on this platform or
+    // filesystem; fall back to buffered writes.
+  }
   while (!value.empty()) {
     TENSORSTORE_ASSIGN_OR_RETURN(
         auto n, internal_os::WriteCordToFile(fd, value),
@@ -616,12 +1182,37 @@ absl::Status WriteWithSync(FileDescriptor fd, const std::string& fd_path,
   return absl::OkStatus();
 }
 
+/// Acquires the write lock for `full_path` according to `file_io_locking`.
+Result<internal_os::FileLock> AcquireWriteLock(
+    const std::string& full_path,
+    const FileIoLockingResource::Spec& file_io_locking) {
+  switch (file_io_locking.mode) {
+    case FileIoLockingResource::LockingMode::none: {
+      // This will generate a unique "lock" file without waiting or
+      // attempting to cleanup.
+      absl::InsecureBitGen rng;
+      uint64_t x = absl::Uniform<uint64_t>(rng);
+      return AcquireExclusiveFile(
+          absl::StrCat(full_path, "_", absl::Hex(x), kLockSuffix),
+          absl::ZeroDuration());
+    }
+    case FileIoLockingResource::LockingMode::os:
+      return AcquireFileLock(absl::StrCat(full_path, kLockSuffix));
+    case FileIoLockingResource::LockingMode::lockfile:
+      return AcquireExclusiveFile(absl::StrCat(full_path, kLockSuffix),
+                                  file_io_locking.acquire_timeout);
+  }
+  ABSL_UNREACHABLE();
+}
+
 /// Implements `FileKeyValueStore::Write`.
 struct WriteTask {
+  internal::IntrusivePtr<FileKeyValueStore> driver;
   std::string full_path;
   absl::Cord value;
   kvstore::WriteOptions options;
   bool sync;
+  bool direct_io;
   FileIoLockingResource::Spec file_io_locking;
 
   Result<TimestampedStorageGeneration> operator()() const {
@@ -630,26 +1221,8 @@ struct WriteTask {
     r.time = absl::Now();
     TENSORSTORE_ASSIGN_OR_RETURN(auto dir_fd, OpenParentDirectory(full_path));
 
-    TENSORSTORE_ASSIGN_OR_RETURN(
-        auto lock_helper, [&]() -> Result<internal_os::FileLock> {
-          switch (file_io_locking.mode) {
-            case FileIoLockingResource::LockingMode::none: {
-              // This will generate a unique "lock" file without waiting or
-              // attempting to cleanup.
-              absl::InsecureBitGen rng;
-              uint64_t x = absl::Uniform<uint64_t>(rng);
-              return AcquireExclusiveFile(
-                  absl::StrCat(full_path, "_", absl::Hex(x), kLockSuffix),
-                  absl::ZeroDuration());
-            }
-            case FileIoLockingResource::LockingMode::os:
-              return AcquireFileLock(absl::StrCat(full_path, kLockSuffix));
-            case FileIoLockingResource::LockingMode::lockfile:
-              return AcquireExclusiveFile(absl::StrCat(full_path, kLockSuffix),
-                                          file_io_locking.acquire_timeout);
-          }
-          ABSL_UNREACHABLE();
-        }());
+    TENSORSTORE_ASSIGN_OR_RETURN(auto lock_helper,
+                                 AcquireWriteLock(full_path, file_io_locking));
 
     bool delete_lock_file = true;
 
@@ -666,7 +1239,7 @@ struct WriteTask {
         }
       }
       TENSORSTORE_RETURN_IF_ERROR(WriteWithSync(
-          lock_helper.fd(), lock_helper.lock_path(), value, sync));
+          lock_helper.fd(), lock_helper.lock_path(), value, sync, direct_io));
       // Stat and Rename
       FileInfo info;
       TENSORSTORE_RETURN_IF_ERROR(
@@ -678,8 +1251,10 @@ struct WriteTask {
       r.generation = GetFileGeneration(info);
       if (sync) {
         // fsync the parent directory to ensure the `rename` is durable.
+        // Concurrent writes to the same directory share fsync rounds.
         TENSORSTORE_RETURN_IF_ERROR(
-            internal_os::FsyncDirectory(dir_fd.get()),
+            driver->fsync_batcher().Fsync(ParentDirectoryPath(full_path),
+                                          dir_fd.get()),
             MaybeAnnotateStatus(
                 _, absl::StrCat("Error calling fsync on parent directory of: ",
                                 full_path)));
@@ -703,12 +1278,14 @@ struct WriteTask {
       // failed.
       return status;
     }
+    driver->generation_cache().RecordLocalWrite(full_path, r.generation);
     return r;
   }
 };
 
 /// Implements `FileKeyValueStore::Delete`.
 struct DeleteTask {
+  internal::IntrusivePtr<FileKeyValueStore> driver;
   std::string full_path;
   kvstore::WriteOptions options;
   bool sync;
@@ -760,7 +1337,8 @@ struct DeleteTask {
     // fsync the parent directory to ensure the `rename` is durable.
     if (fsync_directory) {
       TENSORSTORE_RETURN_IF_ERROR(
-          internal_os::FsyncDirectory(dir_fd.get()),
+          driver->fsync_batcher().Fsync(ParentDirectoryPath(full_path),
+                                        dir_fd.get()),
           MaybeAnnotateStatus(
               _, absl::StrCat("Error calling fsync on parent directory of: ",
                               QuoteString(full_path))));
@@ -769,6 +1347,7 @@ struct DeleteTask {
       return std::move(generation_result).status();
     }
     r.generation = *std::move(generation_result);
+    driver->generation_cache().RecordLocalWrite(full_path, r.generation);
     return r;
   }
 };
@@ -778,12 +1357,17 @@ Future<TimestampedStorageGeneration> FileKeyValueStore::Write(
   file_metrics.write.Increment();
   TENSORSTORE_RETURN_IF_ERROR(ValidateKey(key));
   if (value) {
-    return MapFuture(executor(),
-                     WriteTask{std::move(key), std::move(*value),
-                               std::move(options), sync(), file_io_locking()});
+    return MapFuture(
+        executor(),
+        WriteTask{internal::IntrusivePtr<FileKeyValueStore>(this),
+                  std::move(key), std::move(*value), std::move(options), sync(),
+                  direct_io(), file_io_locking()});
   } else {
-    return MapFuture(executor(), DeleteTask{std::move(key), std::move(options),
-                                            sync(), file_io_locking()});
+    return MapFuture(
+        executor(),
+        DeleteTask{internal::IntrusivePtr<FileKeyValueStore>(this),
+                   std::move(key), std::move(options), sync(),
+                   file_io_locking()});
   }
 }
 
@@ -791,6 +1375,7 @@ Future<TimestampedStorageGeneration> FileKeyValueStore::Write(
 
 /// Implements `FileKeyValueStore::DeleteRange`.
 struct DeleteRangeTask {
+  internal::IntrusivePtr<FileKeyValueStore> driver;
   KeyRange range;
 
   // TODO(jbms): Add fsync support
@@ -825,6 +1410,9 @@ struct DeleteRangeTask {
           // next file.
           return absl::OkStatus();
         });
+    // An unbounded set of keys may have been deleted; drop all cached
+    // generations rather than tracking which entries intersect `range`.
+    driver->generation_cache().Clear();
     if (!status.ok()) {
       promise.SetResult(MakeResult(std::move(status)));
     }
@@ -837,52 +1425,263 @@ Future<const void> FileKeyValueStore::DeleteRange(KeyRange range) {
   if (range.empty()) return absl::OkStatus();  // Converted to a ReadyFuture.
   TENSORSTORE_RETURN_IF_ERROR(ValidateKeyRange(range));
   return PromiseFuturePair<void>::Link(
-             WithExecutor(executor(), DeleteRangeTask{std::move(range)}))
+             WithExecutor(executor(),
+                          DeleteRangeTask{
+                              internal::IntrusivePtr<FileKeyValueStore>(this),
+                              std::move(range)}))
       .future;
 }
 
+/// ----------------------------------------------------------------------------
+
+/// Implements `FileKeyValueStore::ExperimentalCopyRangeFrom` for a source
+/// backed by the file driver.  Each matching source file is copied
+/// server-side via `internal_os::CopyFileContents` (an in-kernel
+/// ::copy_file_range, which reflinks on supporting filesystems) into a lock
+/// file that is then renamed over the target key, so values are never
+/// streamed through userspace.  The usual write protocol (lock, fsync,
+/// rename, batched parent-directory fsync) applies, so copied keys are as
+/// durable and atomic as written ones.
+struct CopyRangeTask {
+  internal::IntrusivePtr<FileKeyValueStore> driver;
+  KeyRange source_range;
+  size_t source_prefix_length;
+  std::string target_prefix;
+  bool sync;
+  FileIoLockingResource::Spec file_io_locking;
+
+  void operator()(Promise<void> promise) {
+    ABSL_LOG_IF(INFO, verbose_logging) << "CopyRangeTask " << source_range;
+    std::string prefix(LongestDirectoryPrefix(source_range));
+    auto status = internal_os::RecursiveFileList(
+        prefix,
+        [&](std::string_view path) {
+          return tensorstore::IntersectsPrefix(source_range, path);
+        },
+        [&](auto entry) -> absl::Status {
+          if (!promise.result_needed()) return absl::CancelledError("");
+          if (entry.IsDirectory()) return absl::OkStatus();
+          std::string_view source_path = entry.GetFullPath();
+          if (!tensorstore::Contains(source_range, source_path) ||
+              absl::EndsWith(source_path, kLockSuffix)) {
+            return absl::OkStatus();
+          }
+          return CopyOneFile(std::string(source_path),
+                             absl::StrCat(target_prefix, source_path.substr(
+                                                             source_prefix_length)));
+        });
+    promise.SetResult(MakeResult(std::move(status)));
+  }
+
+  absl::Status CopyOneFile(const std::string& source_path,
+                           const std::string& target_path) const {
+    TENSORSTORE_RETURN_IF_ERROR(ValidateKey(target_path));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto src_fd, internal_os::OpenExistingFileForReading(source_path));
+    FileInfo info;
+    TENSORSTORE_RETURN_IF_ERROR(internal_os::GetFileInfo(src_fd.get(), &info));
+    if (!internal_os::IsRegularFile(info)) return absl::OkStatus();
+    TENSORSTORE_ASSIGN_OR_RETURN(auto dir_fd,
+                                 OpenParentDirectory(target_path));
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        auto lock_helper, AcquireWriteLock(target_path, file_io_locking));
+    bool delete_lock_file = true;
+    absl::Status status = [&]() {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto n,
+          internal_os::CopyFileContents(src_fd.get(), lock_helper.fd(),
+                                        internal_os::GetSize(info)),
+          MaybeAnnotateStatus(
+              _, absl::StrCat("Error copying ", QuoteString(source_path),
+                              " to ", QuoteString(target_path))));
+      file_metrics.bytes_written.IncrementBy(n);
+      if (sync) {
+        TENSORSTORE_RETURN_IF_ERROR(internal_os::FsyncFile(lock_helper.fd()));
+      }
+      TENSORSTORE_RETURN_IF_ERROR(internal_os::RenameOpenFile(
+          lock_helper.fd(), lock_helper.lock_path(), target_path));
+      delete_lock_file = false;
+      if (sync) {
+        // fsync the parent directory to ensure the `rename` is durable.
+        // Concurrent writes to the same directory share fsync rounds.
+        TENSORSTORE_RETURN_IF_ERROR(
+            driver->fsync_batcher().Fsync(ParentDirectoryPath(target_path),
+                                          dir_fd.get()),
+            MaybeAnnotateStatus(
+                _, absl::StrCat("Error calling fsync on parent directory of: ",
+                                target_path)));
+      }
+      return absl::OkStatus();
+    }();
+    if (delete_lock_file) {
+      std::move(lock_helper).Delete().IgnoreError();
+    } else {
+      // The rename succeeded; any cached generation for the target is stale.
+      std::move(lock_helper).Close();
+      driver->generation_cache().Invalidate(target_path);
+    }
+    return status;
+  }
+};
+
+Future<const void> FileKeyValueStore::ExperimentalCopyRangeFrom(
+    const internal::OpenTransactionPtr& transaction, const KvStore& source,
+    Key target_prefix, kvstore::CopyRangeOptions options) {
+  if (typeid(*source.driver) == typeid(FileKeyValueStore)) {
+    if (transaction) {
+      return absl::UnimplementedError("Transactions not supported");
+    }
+    if (source.transaction != no_transaction) {
+      return absl::UnimplementedError("Source transactions not supported");
+    }
+    KeyRange source_range =
+        KeyRange::AddPrefix(source.path, options.source_range);
+    if (source_range.empty()) return absl::OkStatus();
+    TENSORSTORE_RETURN_IF_ERROR(ValidateKeyRange(source_range));
+    return PromiseFuturePair<void>::Link(
+               WithExecutor(
+                   executor(),
+                   CopyRangeTask{
+                       internal::IntrusivePtr<FileKeyValueStore>(this),
+                       std::move(source_range), source.path.size(),
+                       std::move(target_prefix), sync(), file_io_locking()}))
+        .future;
+  }
+  return kvstore::Driver::ExperimentalCopyRangeFrom(
+      transaction, source, std::move(target_prefix), std::move(options));
+}
+
 /// ----------------------------------------------------------------------------
 /// Implements `FileKeyValueStore:::List`.
-struct ListTask {
-  kvstore::ListOptions options;
-  ListReceiver receiver;
-
-  void operator()() {
-    ABSL_LOG_IF(INFO, verbose_logging) << "ListTask " << options.range;
-    std::atomic<bool> cancelled = false;
-    execution::set_starting(receiver, [&cancelled] {
-      cancelled.store(true, std::memory_order_relaxed);
+///
+/// The walk is parallelized across the `file_io_concurrency` executor: the
+/// initial task scans only the immediate entries of the root directory,
+/// dispatching each subdirectory that intersects the requested range as its
+/// own recursive walk.  Matching entries are streamed to the receiver in
+/// batches under a mutex, and the terminal signal is emitted when the last
+/// walk completes (i.e. when the last reference to the shared state is
+/// released).  Note that, as with any kvstore, listing order is unspecified;
+/// entries from concurrent walks interleave.
+class ParallelListTask
+    : public internal::AtomicReferenceCount<ParallelListTask> {
+ public:
+  ParallelListTask(kvstore::ListOptions options, ListReceiver receiver,
+                   Executor executor)
+      : options_(std::move(options)),
+        receiver_(std::move(receiver)),
+        executor_(std::move(executor)) {}
+
+  ~ParallelListTask() {
+    absl::Status status;
+    {
+      absl::MutexLock lock(&mutex_);
+      status = std::move(status_);
+    }
+    if (!status.ok()) {
+      execution::set_error(receiver_, std::move(status));
+    } else {
+      execution::set_done(receiver_);
+    }
+    execution::set_stopping(receiver_);
+  }
+
+  void Run() {
+    ABSL_LOG_IF(INFO, verbose_logging) << "ListTask " << options_.range;
+    execution::set_starting(receiver_, [cancelled = cancelled_] {
+      cancelled->store(true, std::memory_order_relaxed);
     });
     std::string prefix(
-        internal_file_util::LongestDirectoryPrefix(options.range));
+        internal_file_util::LongestDirectoryPrefix(options_.range));
+    const size_t prefix_size = prefix.size();
+    std::vector<ListEntry> batch;
     auto status = internal_os::RecursiveFileList(
         prefix,
+        // Scan only the immediate entries of the root directory.
+        [&](std::string_view path) { return path.size() <= prefix_size; },
+        [&](auto entry) -> absl::Status {
+          if (cancelled_->load(std::memory_order_relaxed)) {
+            return absl::CancelledError("");
+          }
+          if (entry.IsDirectory()) {
+            std::string_view path = entry.GetFullPath();
+            if (path.size() > prefix_size &&
+                tensorstore::IntersectsPrefix(options_.range, path)) {
+              // Walk the subdirectory as its own executor task.
+              executor_([self = internal::IntrusivePtr<ParallelListTask>(this),
+                         subdir = std::string(path)] {
+                self->WalkSubdir(subdir);
+              });
+            }
+            return absl::OkStatus();
+          }
+          return CollectFile(entry, batch);
+        });
+    Flush(batch);
+    MaybeSetError(std::move(status));
+  }
+
+ private:
+  // Number of entries buffered per walk before emitting to the receiver.
+  constexpr static size_t kEmitBatchSize = 256;
+
+  void WalkSubdir(const std::string& subdir) {
+    if (cancelled_->load(std::memory_order_relaxed)) return;
+    std::vector<ListEntry> batch;
+    auto status = internal_os::RecursiveFileList(
+        subdir,
         [&](std::string_view path) {
-          return tensorstore::IntersectsPrefix(options.range, path);
+          return tensorstore::IntersectsPrefix(options_.range, path);
         },
         [&](auto entry) -> absl::Status {
-          if (cancelled.load(std::memory_order_relaxed)) {
+          if (cancelled_->load(std::memory_order_relaxed)) {
             return absl::CancelledError("");
           }
           if (entry.IsDirectory()) return absl::OkStatus();
-          std::string_view path = entry.GetFullPath();
-          if (tensorstore::Contains(options.range, path) &&
-              !absl::EndsWith(path, kLockSuffix)) {
-            // TODO: If the file was stat'd, include length.
-            path.remove_prefix(options.strip_prefix_length);
-            execution::set_value(receiver,
-                                 ListEntry{std::string(path), entry.GetSize()});
-          }
-          return absl::OkStatus();
+          return CollectFile(entry, batch);
         });
-    if (!status.ok() && !cancelled.load(std::memory_order_relaxed)) {
-      execution::set_error(receiver, std::move(status));
-      execution::set_stopping(receiver);
-      return;
+    Flush(batch);
+    MaybeSetError(std::move(status));
+  }
+
+  absl::Status CollectFile(internal_os::ListerEntry entry,
+                           std::vector<ListEntry>& batch) {
+    std::string_view path = entry.GetFullPath();
+    if (tensorstore::Contains(options_.range, path) &&
+        !absl::EndsWith(path, kLockSuffix)) {
+      // TODO: If the file was stat'd, include length.
+      path.remove_prefix(options_.strip_prefix_length);
+      batch.push_back(ListEntry{std::string(path), entry.GetSize()});
+      if (batch.size() >= kEmitBatchSize) Flush(batch);
     }
-    execution::set_done(receiver);
-    execution::set_stopping(receiver);
+    return absl::OkStatus();
   }
+
+  void Flush(std::vector<ListEntry>& batch) {
+    if (batch.empty()) return;
+    absl::MutexLock lock(&mutex_);
+    for (auto& entry : batch) {
+      execution::set_value(receiver_, std::move(entry));
+    }
+    batch.clear();
+  }
+
+  // Records the first error and stops the remaining walks.  Cancellation is
+  // not an error: as before, a cancelled list completes with `set_done`.
+  void MaybeSetError(absl::Status status) {
+    if (status.ok() || absl::IsCancelled(status)) return;
+    absl::MutexLock lock(&mutex_);
+    if (!status_.ok()) return;
+    status_ = std::move(status);
+    cancelled_->store(true, std::memory_order_relaxed);
+  }
+
+  kvstore::ListOptions options_;
+  ListReceiver receiver_;
+  Executor executor_;
+  std::shared_ptr<std::atomic<bool>> cancelled_ =
+      std::make_shared<std::atomic<bool>>(false);
+  absl::Mutex mutex_;
+  absl::Status status_ ABSL_GUARDED_BY(mutex_);
 };
 
 void FileKeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
@@ -899,12 +1698,18 @@ void FileKeyValueStore::ListImpl(ListOptions options, ListReceiver receiver) {
     execution::set_stopping(receiver);
     return;
   }
-  executor()(ListTask{std::move(options), std::move(receiver)});
+  auto task = internal::MakeIntrusivePtr<ParallelListTask>(
+      std::move(options), std::move(receiver), executor());
+  executor()([task = std::move(task)] { task->Run(); });
 }
 
 Future<kvstore::DriverPtr> FileKeyValueStoreSpec::DoOpen() const {
   auto driver_ptr = internal::MakeIntrusivePtr<FileKeyValueStore>();
   driver_ptr->spec_ = data_;
+  if (*data_.file_io_watch) {
+    driver_ptr->generation_cache_.Enable();
+  }
+  driver_ptr->generation_cache_.SetTtl(data_.file_io_stat_cache->ttl);
   return driver_ptr;
 }
 
@@ -925,6 +1730,14 @@ Result<kvstore::Spec> ParseFileUrl(std::string_view url) {
       Context::Resource<FileIoSyncResource>::DefaultSpec();
   driver_spec->data_.file_io_memmap =
       Context::Resource<FileIoMemmapResource>::DefaultSpec();
+  driver_spec->data_.file_io_uring =
+      Context::Resource<FileIoUringResource>::DefaultSpec();
+  driver_spec->data_.file_io_direct =
+      Context::Resource<FileIoDirectResource>::DefaultSpec();
+  driver_spec->data_.file_io_watch =
+      Context::Resource<FileIoWatchResource>::DefaultSpec();
+  driver_spec->data_.file_io_stat_cache =
+      Context::Resource<FileIoStatCacheResource>::DefaultSpec();
   driver_spec->data_.file_io_locking =
       Context::Resource<FileIoLockingResource>::DefaultSpec();
 
@@ -69,6 +69,8 @@ using ::tensorstore::KeyRange;
 using ::tensorstore::KvStore;
 using ::tensorstore::MatchesStatus;
 using ::tensorstore::StorageGeneration;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultAborted;
 using ::tensorstore::internal::MatchesKvsReadResultNotFound;
 using ::tensorstore::internal::MatchesListEntry;
 using ::tensorstore::internal::MatchesTimestampedStorageGeneration;
@@ -136,6 +138,107 @@ TEST(FileKeyValueStoreTest, BasicMemmap) {
   tensorstore::internal::TestKeyValueReadWriteOps(store, 256 * 1024);
 }
 
+TEST(FileKeyValueStoreTest, BasicIoUring) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_uring", true},
+                             })
+                   .value();
+  tensorstore::internal::TestKeyValueReadWriteOps(store);
+}
+
+TEST(FileKeyValueStoreTest, BasicDirectIo) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_direct", true},
+                             })
+                   .value();
+  // Use values large enough to exceed the direct I/O write threshold.
+  tensorstore::internal::TestKeyValueReadWriteOps(store, 4 * 1024 * 1024);
+}
+
+TEST(FileKeyValueStoreTest, BasicWatch) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_watch", true},
+                             })
+                   .value();
+  tensorstore::internal::TestKeyValueReadWriteOps(store);
+}
+
+TEST(FileKeyValueStoreTest, WatchConditionalRead) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_watch", true},
+                             })
+                   .value();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stamp, kvstore::Write(store, "key", absl::Cord("abc")).result());
+
+  // Populate the cached generation for "key".
+  EXPECT_THAT(kvstore::Read(store, "key").result(),
+              MatchesKvsReadResult(absl::Cord("abc"), stamp.generation));
+
+  // A conditional re-read of the unchanged file aborts without data.
+  kvstore::ReadOptions options;
+  options.generation_conditions.if_not_equal = stamp.generation;
+  EXPECT_THAT(kvstore::Read(store, "key", options).result(),
+              MatchesKvsReadResultAborted());
+
+  // After the file changes, the same conditional read returns the new value.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "key", absl::Cord("def")));
+  EXPECT_THAT(kvstore::Read(store, "key", options).result(),
+              MatchesKvsReadResult(absl::Cord("def")));
+}
+
+TEST(FileKeyValueStoreTest, StatCacheConditionalRead) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_stat_cache", {{"ttl", "1h"}}},
+                             })
+                   .value();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stamp, kvstore::Write(store, "key", absl::Cord("abc")).result());
+
+  // Populate the cached generation for "key".
+  EXPECT_THAT(kvstore::Read(store, "key").result(),
+              MatchesKvsReadResult(absl::Cord("abc"), stamp.generation));
+
+  // A conditional re-read within the TTL aborts without a stat.
+  kvstore::ReadOptions options;
+  options.generation_conditions.if_not_equal = stamp.generation;
+  EXPECT_THAT(kvstore::Read(store, "key", options).result(),
+              MatchesKvsReadResultAborted());
+
+  // A write through the driver invalidates the cached generation, so the
+  // same conditional read returns the new value despite the long TTL.
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "key", absl::Cord("def")));
+  EXPECT_THAT(kvstore::Read(store, "key", options).result(),
+              MatchesKvsReadResult(absl::Cord("def")));
+
+  // Likewise for a delete through the driver.
+  TENSORSTORE_ASSERT_OK(kvstore::Delete(store, "key"));
+  EXPECT_THAT(kvstore::Read(store, "key", options).result(),
+              MatchesKvsReadResultNotFound());
+}
+
 TEST(FileKeyValueStoreTest, InvalidKey) {
   ScopedTemporaryDirectory tempdir;
   std::string root = tempdir.path() + "/root";
@@ -375,14 +478,12 @@ TEST(FileKeyValueStoreTest, DeleteRangeFromBeginning) {
   tensorstore::internal::TestKeyValueStoreDeleteRangeFromBeginning(store);
 }
 
-#if 0
 TEST(FileKeyValueStoreTest, CopyRange) {
   ScopedTemporaryDirectory tempdir;
   std::string root = tempdir.path() + "/root";
   auto store = GetStore(root);
   tensorstore::internal::TestKeyValueStoreCopyRange(store);
 }
-#endif
 
 TEST(FileKeyValueStoreTest, ListErrors) {
   ScopedTemporaryDirectory tempdir;
@@ -432,6 +533,10 @@ TEST(FileKeyValueStoreTest, SpecRoundtripSync) {
        {
            {"file_io_concurrency", ::nlohmann::json::object_t()},
            {"file_io_memmap", false},
+           {"file_io_uring", false},
+           {"file_io_direct", false},
+           {"file_io_watch", false},
+           {"file_io_stat_cache", ::nlohmann::json::object_t()},
            {"file_io_locking", {{"mode", "lockfile"}}},
        }},
   };
@@ -515,6 +620,25 @@ TEST(FileKeyValueStoreTest, BatchRead) {
   tensorstore::internal::TestBatchReadGenericCoalescing(store, options);
 }
 
+TEST(FileKeyValueStoreTest, BatchReadIoUring) {
+  ScopedTemporaryDirectory tempdir;
+  std::string root = tempdir.path() + "/root";
+  // On platforms and kernels without io_uring support, this exercises the
+  // fallback to the regular read path.
+  auto store = kvstore::Open({
+                                 {"driver", "file"},
+                                 {"path", root + "/"},
+                                 {"file_io_uring", true},
+                             })
+                   .value();
+
+  tensorstore::internal::BatchReadGenericCoalescingTestOptions options;
+  options.coalescing_options.max_extra_read_bytes = 255;
+  options.metric_prefix = "/tensorstore/kvstore/file/";
+  options.has_file_open_metric = true;
+  tensorstore::internal::TestBatchReadGenericCoalescing(store, options);
+}
+
 #if 0
 // TODO: Make this test reasonable for mmap cases.
 TEST(FileKeyValueStoreTest, BatchReadMemmap) {
@@ -28,6 +28,22 @@ const tensorstore::internal::ContextResourceRegistration<
     tensorstore::internal_file_kvstore::FileIoMemmapResource>
     file_io_memmap_registration;
 
+const tensorstore::internal::ContextResourceRegistration<
+    tensorstore::internal_file_kvstore::FileIoUringResource>
+    file_io_uring_registration;
+
+const tensorstore::internal::ContextResourceRegistration<
+    tensorstore::internal_file_kvstore::FileIoDirectResource>
+    file_io_direct_registration;
+
+const tensorstore::internal::ContextResourceRegistration<
+    tensorstore::internal_file_kvstore::FileIoWatchResource>
+    file_io_watch_registration;
+
+const tensorstore::internal::ContextResourceRegistration<
+    tensorstore::internal_file_kvstore::FileIoStatCacheResource>
+    file_io_stat_cache_registration;
+
 const tensorstore::internal::ContextResourceRegistration<
     tensorstore::internal_file_kvstore::FileIoLockingResource>
     file_io_registration;
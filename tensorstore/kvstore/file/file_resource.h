@@ -74,6 +74,115 @@ struct FileIoMemmapResource
   }
 };
 
+/// When set, the "file" kvstore submits batched reads through a Linux
+/// io_uring rather than performing a blocking ::pread per read on the
+/// `file_io_concurrency` thread pool.  Ignored on platforms and kernels
+/// without io_uring support.
+struct FileIoUringResource
+    : public internal::ContextResourceTraits<FileIoUringResource> {
+  constexpr static bool config_only = true;
+  static constexpr char id[] = "file_io_uring";
+
+  using Spec = bool;
+  using Resource = Spec;
+  static Spec Default() { return false; }
+  static constexpr auto JsonBinder() {
+    return internal_json_binding::DefaultBinder<>;
+  }
+  static Result<Resource> Create(
+      Spec v, internal::ContextResourceCreationContext context) {
+    return v;
+  }
+  static Spec GetSpec(Resource v, const internal::ContextSpecBuilder& builder) {
+    return v;
+  }
+};
+
+/// When set, the "file" kvstore writes large values with direct (unbuffered)
+/// I/O where supported, so that bulk writes do not evict the read working
+/// set from the page cache.
+struct FileIoDirectResource
+    : public internal::ContextResourceTraits<FileIoDirectResource> {
+  constexpr static bool config_only = true;
+  static constexpr char id[] = "file_io_direct";
+
+  using Spec = bool;
+  using Resource = Spec;
+  static Spec Default() { return false; }
+  static constexpr auto JsonBinder() {
+    return internal_json_binding::DefaultBinder<>;
+  }
+  static Result<Resource> Create(
+      Spec v, internal::ContextResourceCreationContext context) {
+    return v;
+  }
+  static Spec GetSpec(Resource v, const internal::ContextSpecBuilder& builder) {
+    return v;
+  }
+};
+
+/// When set, the "file" kvstore uses an OS change-notification facility
+/// (inotify on Linux) to validate cached file generations, so that
+/// conditional re-reads of unchanged files are answered without a per-read
+/// ::stat.  Ignored on platforms without such a facility.
+struct FileIoWatchResource
+    : public internal::ContextResourceTraits<FileIoWatchResource> {
+  constexpr static bool config_only = true;
+  static constexpr char id[] = "file_io_watch";
+
+  using Spec = bool;
+  using Resource = Spec;
+  static Spec Default() { return false; }
+  static constexpr auto JsonBinder() {
+    return internal_json_binding::DefaultBinder<>;
+  }
+  static Result<Resource> Create(
+      Spec v, internal::ContextResourceCreationContext context) {
+    return v;
+  }
+  static Spec GetSpec(Resource v, const internal::ContextSpecBuilder& builder) {
+    return v;
+  }
+};
+
+/// Bounds how long the "file" kvstore may reuse a previously observed file
+/// generation to answer conditional reads without re-checking the file's
+/// modification time with ::stat.  Entries validated by a `file_io_watch`
+/// directory watch are not subject to the TTL.  A zero TTL (the default)
+/// disables the cache.
+struct FileIoStatCacheResource
+    : public internal::ContextResourceTraits<FileIoStatCacheResource> {
+  constexpr static bool config_only = true;
+  static constexpr char id[] = "file_io_stat_cache";
+
+  struct Spec {
+    absl::Duration ttl = absl::ZeroDuration();
+
+    constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+      return f(x.ttl);
+    };
+  };
+
+  using Resource = Spec;
+  static Spec Default() { return Spec{}; }
+  static constexpr auto JsonBinder() {
+    namespace jb = internal_json_binding;
+    return jb::Object(jb::Member(
+        "ttl",
+        jb::Projection<&Spec::ttl>(jb::DefaultValue<jb::kNeverIncludeDefaults>(
+            [](auto* obj) { *obj = Default().ttl; }))));
+  }
+
+  static Result<Resource> Create(
+      Spec v, internal::ContextResourceCreationContext context) {
+    return v;
+  }
+
+  static Spec GetSpec(Resource v, const internal::ContextSpecBuilder& builder) {
+    return v;
+  }
+};
+
 /// When set, allows choosing how the "file" kvstore uses file locking, which
 /// ensures that only one process is writing to a kvstore key at a time.
 struct FileIoLockingResource
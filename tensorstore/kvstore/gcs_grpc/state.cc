@@ -172,8 +172,14 @@ absl::Status ReadState::HandleResponse(ReadState::Response& response) {
     }
   }
   if (response.has_checksummed_data()) {
-    chunks_.emplace_back(response.checksummed_data().content(),
-                         absl::crc32c_t(response.checksummed_data().crc32c()));
+    auto& checksummed_data = *response.mutable_checksummed_data();
+    const auto chunk_crc32c = absl::crc32c_t(checksummed_data.crc32c());
+    // Adopt the message content rather than copying it; with a cord-enabled
+    // `content` field the underlying gRPC slices are reference-counted into
+    // the chunk.
+    chunks_.emplace_back(
+        absl::Cord(std::move(*checksummed_data.mutable_content())),
+        chunk_crc32c);
   }
   return absl::OkStatus();
 }
@@ -54,6 +54,11 @@ ABSL_FLAG(std::optional<uint32_t>, tensorstore_gcs_grpc_channels, std::nullopt,
           "Default (and maximum) channels to use in gcs_grpc driver. "
           "Overrides TENSORSTORE_GCS_GRPC_CHANNELS.");
 
+ABSL_FLAG(std::optional<int32_t>, tensorstore_gcs_grpc_stream_lookahead_bytes,
+          std::nullopt,
+          "Per-stream HTTP/2 flow-control window for gcs_grpc channels. "
+          "Overrides TENSORSTORE_GCS_GRPC_STREAM_LOOKAHEAD_BYTES.");
+
 using ::tensorstore::internal::GetFlagOrEnvValue;
 
 namespace tensorstore {
@@ -117,6 +122,16 @@ std::shared_ptr<grpc::Channel> CreateChannel(
   // args.SetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
   // args.SetCompressionAlgorithm(GRPC_COMPRESS_NONE);
 
+  // A larger per-stream flow-control window lets the server keep more data
+  // in flight on high bandwidth-delay-product paths, at the cost of
+  // per-stream buffering.
+  if (auto lookahead =
+          GetFlagOrEnvValue(FLAGS_tensorstore_gcs_grpc_stream_lookahead_bytes,
+                            "TENSORSTORE_GCS_GRPC_STREAM_LOOKAHEAD_BYTES");
+      lookahead && *lookahead > 0) {
+    args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, *lookahead);
+  }
+
   return internal_grpc::CreateChannel(auth_strategy, address, args);
 }
 
@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -55,6 +56,7 @@
 #include "tensorstore/internal/oauth2/auth_provider.h"
 #include "tensorstore/internal/oauth2/google_auth_provider.h"
 #include "tensorstore/internal/path.h"
+#include "tensorstore/internal/rate_limiter/admission_queue.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/internal/retries_context_resource.h"
 #include "tensorstore/internal/source_location.h"
@@ -62,6 +64,7 @@
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 #include "tensorstore/kvstore/common_metrics.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/gcs/gcs_resource.h"
@@ -70,14 +73,17 @@
 #include "tensorstore/kvstore/gcs_http/object_metadata.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
+#include "tensorstore/kvstore/hedged_kvstore.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
 #include "tensorstore/kvstore/registry.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/split_read_util.h"
 #include "tensorstore/kvstore/supported_features.h"
 #include "tensorstore/kvstore/url_registry.h"
+#include "tensorstore/kvstore/write_stream.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/executor.h"
@@ -110,6 +116,7 @@ ABSL_FLAG(std::optional<std::string>, tensorstore_gcs_http_version,
           "Url to used for http access to google cloud storage. "
           "Overrides TENSORSTORE_GCS_HTTP_VERSION.");
 
+using ::tensorstore::internal::AdmissionQueue;
 using ::tensorstore::internal::DataCopyConcurrencyResource;
 using ::tensorstore::internal::GetFlagOrEnvValue;
 using ::tensorstore::internal::IntrusivePtr;
@@ -348,10 +355,17 @@ class GcsKeyValueStore
 
   Future<ReadResult> ReadImpl(Key&& key, ReadOptions&& options);
 
+  /// Issues a single ranged GET; used by `ReadImpl`, which may split a large
+  /// read into several concurrent calls.
+  Future<ReadResult> SingleReadImpl(Key&& key, ReadOptions&& options);
+
   Future<TimestampedStorageGeneration> Write(Key key,
                                              std::optional<Value> value,
                                              WriteOptions options) override;
 
+  Result<std::unique_ptr<kvstore::WriteStreamWriter>> ExperimentalWriteStream(
+      Key key, WriteOptions options) override;
+
   void ListImpl(ListOptions options, ListReceiver receiver) override;
 
   Future<const void> DeleteRange(KeyRange range) override;
@@ -394,7 +408,7 @@ class GcsKeyValueStore
     return no_rate_limiter_;
   }
 
-  RateLimiter& admission_queue() { return *spec_.request_concurrency->queue; }
+  AdmissionQueue& admission_queue() { return *spec_.request_concurrency->queue; }
 
   absl::Status GetBoundSpecData(SpecData& spec) const {
     spec = spec_;
@@ -420,6 +434,9 @@ class GcsKeyValueStore
       absl::Status status, int attempt, Task* task,
       SourceLocation loc = ::tensorstore::SourceLocation::current()) {
     assert(task != nullptr);
+    // Retryable failures (throttling, unavailability) feed the adaptive
+    // admission queue's congestion signal; a no-op for fixed-limit queues.
+    admission_queue().ReportThrottled();
     auto delay = spec_.retries->BackoffForAttempt(attempt);
     if (!delay) {
       return MaybeAnnotateStatus(std::move(status),
@@ -458,6 +475,15 @@ Future<kvstore::DriverPtr> GcsKeyValueStoreSpec::DoOpen() const {
   driver->upload_root_ = BucketUploadRoot(data_.bucket);
   driver->transport_ = internal_http::GetDefaultHttpTransport();
 
+  if (auto n = internal::GetEnvValue<size_t>(
+          "TENSORSTORE_GCS_PREWARM_CONNECTIONS");
+      n.value_or(0) > 0) {
+    // Resolve DNS and establish pooled connections to the GCS endpoint
+    // before the first read pays for the handshakes.
+    internal_http::PreWarmConnectionsOnce(*driver->transport_,
+                                          GetGcsBaseUrl(), *n);
+  }
+
   // NOTE: Remove temporary logging use of experimental feature.
   if (data_.rate_limiter.has_value()) {
     ABSL_LOG_IF(INFO, gcs_http_logging)
@@ -467,7 +493,25 @@ Future<kvstore::DriverPtr> GcsKeyValueStoreSpec::DoOpen() const {
     driver->encoded_user_project_ =
         internal::PercentEncodeUriComponent(*project_id);
   }
-  return driver;
+  kvstore::DriverPtr result = driver;
+  if (internal::GetEnvValue<bool>("TENSORSTORE_GCS_READ_HEDGING")
+          .value_or(false)) {
+    // Issue a duplicate read when a read exceeds the recent latency
+    // distribution, taking the first response.
+    result = internal_kvstore::MakeHedgedKvStoreDriver(
+        std::move(result), internal_kvstore::HedgedReadOptions{},
+        driver->executor());
+  }
+  if (internal::GetEnvValue<bool>("TENSORSTORE_GCS_READ_COALESCING")
+          .value_or(false)) {
+    // Merge concurrent reads of nearby byte ranges of the same object into
+    // a single request.
+    result = internal_kvstore::MakeCoalesceKvStoreDriver(
+        std::move(result), /*threshold=*/1024 * 1024,
+        /*merged_threshold=*/16 * 1024 * 1024,
+        /*interval=*/absl::ZeroDuration(), driver->executor());
+  }
+  return result;
 }
 
 // GCS does not follow HTTP spec as far as respecting `cache-control` request
@@ -537,6 +581,11 @@ struct ReadTask : public RateLimiterNode,
     if (!promise.result_needed()) {
       return;
     }
+    if (absl::Now() >= options.deadline) {
+      promise.SetResult(absl::DeadlineExceededError(
+          "Deadline expired before read request was issued"));
+      return;
+    }
     /// Reads contents of a GCS object.
     std::string media_url = absl::StrCat(
         resource, options.byte_range.size() == 0 ? "?alt=json" : "?alt=media");
@@ -572,8 +621,13 @@ struct ReadTask : public RateLimiterNode,
     start_time_ = absl::Now();
 
     ABSL_LOG_IF(INFO, gcs_http_logging) << "ReadTask: " << request;
-    auto future = owner->transport_->IssueRequest(
-        request, IssueRequestOptions().SetHttpVersion(GetHttpVersion()));
+    auto issue_options = IssueRequestOptions().SetHttpVersion(GetHttpVersion());
+    if (options.deadline != absl::InfiniteFuture()) {
+      issue_options = std::move(issue_options)
+                          .SetRequestTimeout(options.deadline - start_time_);
+    }
+    auto future =
+        owner->transport_->IssueRequest(request, std::move(issue_options));
     future.ExecuteWhenReady([self = IntrusivePtr<ReadTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
       self->OnResponse(response.result());
@@ -600,6 +654,9 @@ struct ReadTask : public RateLimiterNode,
       return GcsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
     if (!status.ok() && is_retryable) {
       status =
           owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
@@ -683,6 +740,24 @@ Future<kvstore::ReadResult> GcsKeyValueStore::Read(Key key,
 Future<kvstore::ReadResult> GcsKeyValueStore::ReadImpl(Key&& key,
                                                        ReadOptions&& options) {
   gcs_metrics.batch_read.Increment();
+  // Large explicit byte ranges are split into concurrent ranged GETs, since
+  // a single stream is capped well below NIC bandwidth.
+  return internal_kvstore::MaybeSplitRead(
+      [self = internal::IntrusivePtr<GcsKeyValueStore>(this)](
+          Key key, ReadOptions options) {
+        return self->SingleReadImpl(std::move(key), std::move(options));
+      },
+      std::move(key), std::move(options));
+}
+
+Future<kvstore::ReadResult> GcsKeyValueStore::SingleReadImpl(
+    Key&& key, ReadOptions&& options) {
+  // Fail fast rather than occupying a rate-limiter or admission-queue slot
+  // for an operation whose caller has already given up.
+  if (absl::Now() >= options.deadline) {
+    return absl::DeadlineExceededError(
+        "Deadline expired before read was admitted");
+  }
   auto encoded_object_name = internal::PercentEncodeUriComponent(key);
   std::string resource = tensorstore::internal::JoinPath(resource_root_, "/o/",
                                                          encoded_object_name);
@@ -808,6 +883,9 @@ struct WriteTask : public RateLimiterNode,
       return GcsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
     if (!status.ok() && is_retryable) {
       status =
           owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
@@ -858,6 +936,330 @@ struct WriteTask : public RateLimiterNode,
   }
 };
 
+/// Chunk quantum for resumable uploads.  GCS requires every non-final chunk
+/// to be a multiple of 256 KiB; 8 MiB balances per-request overhead against
+/// the memory buffered per stream.
+constexpr size_t kResumableChunkSize = 8 * 1024 * 1024;
+
+/// Issues a single HTTP request of a resumable upload session with the same
+/// admission, rate-limiting, and retry treatment as `WriteTask`.  Status
+/// codes 308 (resume incomplete) and 412 (failed precondition) are reported
+/// to the callback as successful responses for the caller to interpret.
+struct ResumableUploadOp
+    : public RateLimiterNode,
+      public internal::AtomicReferenceCount<ResumableUploadOp> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string method;
+  std::string url;
+  absl::Cord payload;
+  // Additional headers (e.g. content-range), added on every attempt.
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::function<void(Result<HttpResponse>)> callback;
+
+  int attempt_ = 0;
+  absl::Time start_time_;
+
+  ~ResumableUploadOp() { owner->admission_queue().Finish(this); }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<ResumableUploadOp*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &ResumableUploadOp::Admit);
+  }
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<ResumableUploadOp*>(task);
+    self->owner->executor()([state = IntrusivePtr<ResumableUploadOp>(
+                                 self, internal::adopt_object_ref)] {
+      state->Retry();
+    });
+  }
+
+  void Retry() {
+    auto maybe_auth_header = owner->GetAuthHeader();
+    if (!maybe_auth_header.ok()) {
+      callback(maybe_auth_header.status());
+      return;
+    }
+    HttpRequestBuilder request_builder(method, url);
+    if (maybe_auth_header.value().has_value()) {
+      request_builder.ParseAndAddHeader(*maybe_auth_header.value());
+    }
+    for (const auto& [name, value] : headers) {
+      request_builder.AddHeader(name, value);
+    }
+    auto request = request_builder.BuildRequest();
+    start_time_ = absl::Now();
+
+    ABSL_LOG_IF(INFO, gcs_http_logging)
+        << "ResumableUploadOp: " << request << " size=" << payload.size();
+
+    auto future = owner->transport_->IssueRequest(
+        request, IssueRequestOptions(payload).SetHttpVersion(GetHttpVersion()));
+    future.ExecuteWhenReady([self = IntrusivePtr<ResumableUploadOp>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnResponse(response.result());
+    });
+  }
+
+  void OnResponse(const Result<HttpResponse>& response) {
+    ABSL_LOG_IF(INFO, gcs_http_logging.Level(1) && response.ok())
+        << "ResumableUploadOp " << *response;
+
+    bool is_retryable = IsRetriable(response.status());
+    absl::Status status = [&]() -> absl::Status {
+      if (!response.ok()) return response.status();
+      switch (response.value().status_code) {
+        case 308:
+          [[fallthrough]];
+        case 412:
+          return absl::OkStatus();
+        default:
+          break;
+      }
+      return GcsHttpResponseToStatus(response.value(), is_retryable);
+    }();
+
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
+    if (!status.ok() && is_retryable) {
+      status =
+          owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
+      if (status.ok()) {
+        return;
+      }
+    }
+    if (!status.ok()) {
+      callback(std::move(status));
+    } else {
+      callback(response);
+    }
+  }
+};
+
+/// State of one streaming upload, shared between the returned
+/// `kvstore::WriteStreamWriter` and its in-flight operations.  Calls are
+/// sequential per the `WriteStreamWriter` contract--each step runs only after
+/// the future of the previous step resolved--so no locking is needed.
+struct ResumableUploadState
+    : public internal::AtomicReferenceCount<ResumableUploadState> {
+  IntrusivePtr<GcsKeyValueStore> owner;
+  std::string key;
+  kvstore::WriteOptions options;
+
+  // Upload session URI; empty until the session has been started.  The
+  // session is only started once a full chunk has been buffered; smaller
+  // values fall back to the single-request upload on `Finalize`.
+  std::string session_url;
+  // Bytes buffered but not yet uploaded.
+  absl::Cord buffered;
+  // Bytes already uploaded in completed chunks.
+  uint64_t committed = 0;
+  // Set when the server reported that the generation condition failed; the
+  // remainder of the stream is discarded and `Close` resolves to
+  // `StorageGeneration::Unknown()`.
+  bool precondition_failed = false;
+  absl::Time start_time_ = absl::InfinitePast();
+
+  void IssueOp(std::string method, std::string url, absl::Cord payload,
+               std::vector<std::pair<std::string, std::string>> headers,
+               std::function<void(Result<HttpResponse>)> callback) {
+    auto op = internal::MakeIntrusivePtr<ResumableUploadOp>();
+    op->owner = owner;
+    op->method = std::move(method);
+    op->url = std::move(url);
+    op->payload = std::move(payload);
+    op->headers = std::move(headers);
+    op->callback = std::move(callback);
+
+    // adopted by ResumableUploadOp::Start.
+    intrusive_ptr_increment(op.get());
+    owner->write_rate_limiter().Admit(op.get(), &ResumableUploadOp::Start);
+  }
+
+  /// Starts the upload session, then continues with `UploadFullChunks`.
+  void StartSession(Promise<void> promise) {
+    std::string url =
+        absl::StrCat(owner->upload_root(), "/o", "?uploadType=resumable",
+                     "&name=", internal::PercentEncodeUriComponent(key));
+    AddGenerationParam(&url, true, "ifGenerationMatch",
+                       options.generation_conditions.if_equal);
+    AddUserProjectParam(&url, true, owner->encoded_user_project());
+    start_time_ = absl::Now();
+
+    IssueOp(
+        "POST", std::move(url), absl::Cord(),
+        {{"x-upload-content-type", "application/octet-stream"}},
+        [self = IntrusivePtr<ResumableUploadState>(this),
+         promise = std::move(promise)](Result<HttpResponse> response) mutable {
+          if (!response.ok()) {
+            promise.SetResult(response.status());
+            return;
+          }
+          if (response->status_code == 412) {
+            self->precondition_failed = true;
+            self->buffered.Clear();
+            promise.SetResult(MakeResult());
+            return;
+          }
+          auto it = response->headers.find("location");
+          if (it == response->headers.end()) {
+            promise.SetResult(absl::InternalError(
+                "Resumable upload response missing location header"));
+            return;
+          }
+          self->session_url = it->second;
+          self->UploadFullChunks(std::move(promise));
+        });
+  }
+
+  /// Uploads chunks of exactly `kResumableChunkSize` bytes until less than
+  /// one full chunk remains buffered.
+  void UploadFullChunks(Promise<void> promise) {
+    if (precondition_failed) {
+      buffered.Clear();
+      promise.SetResult(MakeResult());
+      return;
+    }
+    if (buffered.size() < kResumableChunkSize) {
+      promise.SetResult(MakeResult());
+      return;
+    }
+    if (session_url.empty()) {
+      StartSession(std::move(promise));
+      return;
+    }
+    absl::Cord chunk = buffered.Subcord(0, kResumableChunkSize);
+    std::string content_range = absl::StrFormat(
+        "bytes %d-%d/*", committed, committed + kResumableChunkSize - 1);
+    IssueOp(
+        "PUT", session_url, std::move(chunk),
+        {{"content-range", std::move(content_range)}},
+        [self = IntrusivePtr<ResumableUploadState>(this),
+         promise = std::move(promise)](Result<HttpResponse> response) mutable {
+          if (!response.ok()) {
+            promise.SetResult(response.status());
+            return;
+          }
+          if (response->status_code != 308) {
+            promise.SetResult(absl::InternalError(absl::StrCat(
+                "Unexpected response to resumable upload chunk: HTTP ",
+                response->status_code)));
+            return;
+          }
+          gcs_metrics.bytes_written.IncrementBy(kResumableChunkSize);
+          self->committed += kResumableChunkSize;
+          self->buffered.RemovePrefix(kResumableChunkSize);
+          self->UploadFullChunks(std::move(promise));
+        });
+  }
+
+  /// Uploads the final partial chunk and finalizes the object.
+  void Finalize(Promise<TimestampedStorageGeneration> promise) {
+    if (precondition_failed) {
+      promise.SetResult(TimestampedStorageGeneration{
+          StorageGeneration::Unknown(), start_time_});
+      return;
+    }
+    if (session_url.empty()) {
+      // Never grew past one chunk: use the ordinary single-request upload.
+      LinkResult(
+          std::move(promise),
+          owner->Write(std::move(key), std::move(buffered), std::move(options)));
+      return;
+    }
+    if (buffered.size() >= kResumableChunkSize) {
+      // Possible if the caller wrote chunks without awaiting backpressure.
+      auto op = PromiseFuturePair<void>::Make(MakeResult());
+      op.future.ExecuteWhenReady(
+          [self = IntrusivePtr<ResumableUploadState>(this),
+           promise = std::move(promise)](ReadyFuture<const void> f) mutable {
+            if (!f.result().ok()) {
+              promise.SetResult(f.result().status());
+              return;
+            }
+            self->Finalize(std::move(promise));
+          });
+      UploadFullChunks(std::move(op.promise));
+      return;
+    }
+    const uint64_t total = committed + buffered.size();
+    const size_t final_size = buffered.size();
+    std::string content_range =
+        buffered.empty()
+            ? absl::StrFormat("bytes */%d", total)
+            : absl::StrFormat("bytes %d-%d/%d", committed, total - 1, total);
+    IssueOp(
+        "PUT", session_url, std::move(buffered),
+        {{"content-range", std::move(content_range)}},
+        [self = IntrusivePtr<ResumableUploadState>(this), final_size,
+         promise = std::move(promise)](Result<HttpResponse> response) mutable {
+          if (!response.ok()) {
+            promise.SetResult(response.status());
+            return;
+          }
+          if (response->status_code == 412) {
+            promise.SetResult(TimestampedStorageGeneration{
+                StorageGeneration::Unknown(), self->start_time_});
+            return;
+          }
+          gcs_metrics.bytes_written.IncrementBy(final_size);
+          auto latency = absl::Now() - self->start_time_;
+          gcs_metrics.write_latency_ms.Observe(
+              absl::ToInt64Milliseconds(latency));
+
+          auto payload = response->payload;
+          auto parsed_object_metadata = ParseObjectMetadata(payload.Flatten());
+          if (!parsed_object_metadata.ok()) {
+            promise.SetResult(parsed_object_metadata.status());
+            return;
+          }
+          TimestampedStorageGeneration r;
+          r.time = self->start_time_;
+          r.generation =
+              StorageGeneration::FromUint64(parsed_object_metadata->generation);
+          promise.SetResult(std::move(r));
+        });
+  }
+};
+
+class GcsWriteStreamWriter : public kvstore::WriteStreamWriter {
+ public:
+  explicit GcsWriteStreamWriter(IntrusivePtr<ResumableUploadState> state)
+      : state_(std::move(state)) {}
+
+  Future<const void> Write(absl::Cord chunk) override {
+    if (closed_) {
+      return absl::FailedPreconditionError(
+          "Write called on closed WriteStreamWriter");
+    }
+    auto& state = *state_;
+    state.buffered.Append(std::move(chunk));
+    if (state.buffered.size() < kResumableChunkSize) {
+      return absl::OkStatus();
+    }
+    auto op = PromiseFuturePair<void>::Make(MakeResult());
+    state.UploadFullChunks(std::move(op.promise));
+    return std::move(op.future);
+  }
+
+  Future<TimestampedStorageGeneration> Close() override {
+    if (closed_) {
+      return absl::FailedPreconditionError(
+          "Close called on closed WriteStreamWriter");
+    }
+    closed_ = true;
+    auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+    state_->Finalize(std::move(op.promise));
+    return std::move(op.future);
+  }
+
+ private:
+  IntrusivePtr<ResumableUploadState> state_;
+  bool closed_ = false;
+};
+
+
 /// A DeleteTask is a function object used to satisfy a
 /// GcsKeyValueStore::Delete request.
 struct DeleteTask : public RateLimiterNode,
@@ -955,6 +1357,9 @@ struct DeleteTask : public RateLimiterNode,
       return GcsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
     if (!status.ok() && is_retryable) {
       status =
           owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
@@ -1023,6 +1428,21 @@ Future<TimestampedStorageGeneration> GcsKeyValueStore::Write(
   return std::move(op.future);
 }
 
+Result<std::unique_ptr<kvstore::WriteStreamWriter>>
+GcsKeyValueStore::ExperimentalWriteStream(Key key, WriteOptions options) {
+  if (!IsValidObjectName(key)) {
+    return absl::InvalidArgumentError("Invalid GCS object name");
+  }
+  if (!IsValidStorageGeneration(options.generation_conditions.if_equal)) {
+    return absl::InvalidArgumentError("Malformed StorageGeneration");
+  }
+  auto state = internal::MakeIntrusivePtr<ResumableUploadState>();
+  state->owner = IntrusivePtr<GcsKeyValueStore>(this);
+  state->key = std::move(key);
+  state->options = std::move(options);
+  return std::make_unique<GcsWriteStreamWriter>(std::move(state));
+}
+
 // List responds with a Json payload that includes these fields.
 struct GcsListResponsePayload {
   std::string next_page_token;        // used to page through list results.
@@ -57,6 +57,7 @@
 #include "tensorstore/kvstore/spec.h"
 #include "tensorstore/kvstore/test_matchers.h"
 #include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/kvstore/write_stream.h"
 #include "tensorstore/util/execution/execution.h"
 #include "tensorstore/util/execution/sender_testutil.h"
 #include "tensorstore/util/future.h"
@@ -248,6 +249,68 @@ TEST(GcsKeyValueStoreTest, Basic) {
   tensorstore::internal::TestKeyValueReadWriteOps(store);
 }
 
+TEST(GcsKeyValueStoreTest, WriteStream) {
+  auto mock_transport = std::make_shared<MyMockTransport>();
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  GCSMockStorageBucket bucket("my-bucket");
+  mock_transport->buckets_.push_back(&bucket);
+
+  auto context = DefaultTestContext();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      kvstore::Open({{"driver", kDriver}, {"bucket", "my-bucket"}}, context)
+          .result());
+
+  // A small value never starts a resumable session; it falls back to the
+  // single-request upload on `Close`.
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto writer, kvstore::ExperimentalWriteStream(store, "small"));
+    TENSORSTORE_EXPECT_OK(writer->Write(absl::Cord("hello ")).result());
+    TENSORSTORE_EXPECT_OK(writer->Write(absl::Cord("world")).result());
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto stamp, writer->Close().result());
+    EXPECT_FALSE(StorageGeneration::IsUnknown(stamp.generation));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto read,
+                                     kvstore::Read(store, "small").result());
+    EXPECT_EQ(read.value, "hello world");
+  }
+
+  // A large value streams through a resumable upload session in chunks.
+  {
+    absl::Cord part(std::string(1024 * 1024, 'x'));
+    absl::Cord expected;
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto writer, kvstore::ExperimentalWriteStream(store, "large"));
+    for (int i = 0; i < 20; ++i) {
+      TENSORSTORE_EXPECT_OK(writer->Write(part).result());
+      expected.Append(part);
+    }
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto stamp, writer->Close().result());
+    EXPECT_FALSE(StorageGeneration::IsUnknown(stamp.generation));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto read,
+                                     kvstore::Read(store, "large").result());
+    EXPECT_EQ(read.value, expected);
+  }
+
+  // A failed generation condition resolves to
+  // `StorageGeneration::Unknown()`, even when detected mid-stream.
+  {
+    kvstore::WriteOptions options;
+    options.generation_conditions.if_equal = StorageGeneration::NoValue();
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto writer,
+        kvstore::ExperimentalWriteStream(store, "small", std::move(options)));
+    TENSORSTORE_EXPECT_OK(
+        writer->Write(absl::Cord(std::string(9 * 1024 * 1024, 'y'))).result());
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto stamp, writer->Close().result());
+    EXPECT_TRUE(StorageGeneration::IsUnknown(stamp.generation));
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto read,
+                                     kvstore::Read(store, "small").result());
+    EXPECT_EQ(read.value, "hello world");
+  }
+}
+
 TEST(GcsKeyValueStoreTest, Retry) {
   for (int max_retries : {2, 3, 4}) {
     for (bool fail : {false, true}) {
@@ -190,6 +190,10 @@ GCSMockStorageBucket::Match(const HttpRequest& request, absl::Cord payload) {
               R"({ "error": { "code": 400, "message": "Uploads must be sent to the upload URL." } })")};
     }
     return HandleInsertRequest(path, params, payload);
+  } else if (path == "/o" && request.method == "PUT" && is_upload &&
+             params.count("upload_id")) {
+    // Chunk or finalization of a resumable upload session.
+    return HandleResumableUploadRequest(request, params, payload);
   } else if (absl::StartsWith(path, "/o/") && request.method == "GET") {
     // GET request on an object.
     return HandleGetRequest(request, path, params);
@@ -277,7 +281,10 @@ GCSMockStorageBucket::HandleInsertRequest(std::string_view path,
   do {
     /// TODO: What does GCS return if these values are bad?
     auto uploadType = params.find("uploadType");
-    if (uploadType == params.end() || uploadType->second != "media") break;
+    if (uploadType == params.end() ||
+        (uploadType->second != "media" && uploadType->second != "resumable")) {
+      break;
+    }
 
     auto name_it = params.find("name");
     if (name_it == params.end() || name_it->second.empty()) break;
@@ -306,6 +313,21 @@ GCSMockStorageBucket::HandleInsertRequest(std::string_view path,
       }
     }
 
+    if (uploadType->second == "resumable") {
+      // https://cloud.google.com/storage/docs/performing-resumable-uploads
+      // The generation preconditions were evaluated above; the mock does not
+      // re-check them when the session is finalized.
+      std::string upload_id = tensorstore::StrCat(next_upload_id_++);
+      resumable_uploads_[upload_id].name = std::move(name);
+
+      HttpResponse response{200, absl::Cord()};
+      response.headers.SetHeader(
+          "location",
+          tensorstore::StrCat("https://", upload_prefix_,
+                              "/o?uploadType=resumable&upload_id=", upload_id));
+      return response;
+    }
+
     auto& obj = data_[name];
     if (obj.name.empty()) {
       obj.name = std::move(name);
@@ -321,6 +343,66 @@ GCSMockStorageBucket::HandleInsertRequest(std::string_view path,
   return HttpResponse{404, absl::Cord()};
 }
 
+std::variant<std::monostate, HttpResponse, absl::Status>
+GCSMockStorageBucket::HandleResumableUploadRequest(
+    const internal_http::HttpRequest& request, const ParamMap& params,
+    absl::Cord payload) {
+  // https://cloud.google.com/storage/docs/performing-resumable-uploads
+  auto upload_it = resumable_uploads_.find(params.find("upload_id")->second);
+  if (upload_it == resumable_uploads_.end()) {
+    return HttpResponse{404, absl::Cord()};
+  }
+  auto& upload = upload_it->second;
+
+  auto range_it = request.headers.find("content-range");
+  if (range_it == request.headers.end()) {
+    return HttpResponse{400, absl::Cord()};
+  }
+  static LazyRE2 kContentRange = {R"(bytes (?:(\d+)-(\d+)|\*)/(\d+|\*))"};
+  std::optional<int64_t> range_start, range_end;
+  std::string_view total;
+  if (!RE2::FullMatch(range_it->second, *kContentRange, &range_start,
+                      &range_end, &total)) {
+    return HttpResponse{400, absl::Cord()};
+  }
+  if (range_start.has_value()) {
+    if (*range_start != static_cast<int64_t>(upload.data.size()) ||
+        *range_end - *range_start + 1 != static_cast<int64_t>(payload.size())) {
+      return HttpResponse{400, absl::Cord()};
+    }
+    upload.data.Append(payload);
+  }
+
+  if (total == "*") {
+    // Chunk accepted; upload still incomplete.
+    HttpResponse response{308, absl::Cord()};
+    if (!upload.data.empty()) {
+      response.headers.SetHeader(
+          "range", tensorstore::StrCat("bytes=0-", upload.data.size() - 1));
+    }
+    return response;
+  }
+
+  int64_t total_size = 0;
+  if (!absl::SimpleAtoi(total, &total_size) ||
+      total_size != static_cast<int64_t>(upload.data.size())) {
+    return HttpResponse{400, absl::Cord()};
+  }
+
+  auto& obj = data_[upload.name];
+  if (obj.name.empty()) {
+    obj.name = upload.name;
+  }
+  obj.generation = ++next_generation_;
+  obj.data = std::move(upload.data);
+  resumable_uploads_.erase(upload_it);
+
+  ABSL_LOG(INFO) << "Uploaded (resumable): " << obj.name << " "
+                 << obj.generation;
+
+  return ObjectMetadataResponse(obj);
+}
+
 std::optional<OptionalByteRangeRequest> ParseRangeFieldValue(
     std::string_view header) {
   static LazyRE2 kRange = {R"((?i)bytes=(\d+)?-(\d+)?)"};
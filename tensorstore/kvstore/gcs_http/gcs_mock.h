@@ -82,6 +82,11 @@ class GCSMockStorageBucket {
   HandleInsertRequest(std::string_view path, const ParamMap& params,
                       absl::Cord payload);
 
+  // Upload a chunk of a resumable upload session, or finalize it.
+  std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
+  HandleResumableUploadRequest(const internal_http::HttpRequest& request,
+                               const ParamMap& params, absl::Cord payload);
+
   // Get an object, which might be the data or the metadata.
   std::variant<std::monostate, internal_http::HttpResponse, absl::Status>
   HandleGetRequest(const internal_http::HttpRequest& request,
@@ -129,6 +134,14 @@ class GCSMockStorageBucket {
 
   using Map = std::map<std::string, Object, std::less<>>;
   Map data_;
+
+  // An in-progress resumable upload session.
+  struct ResumableUpload {
+    std::string name;
+    absl::Cord data;
+  };
+  int64_t next_upload_id_ = 1;
+  std::map<std::string, ResumableUpload, std::less<>> resumable_uploads_;
 };
 
 }  // namespace tensorstore
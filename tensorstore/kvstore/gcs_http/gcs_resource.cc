@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -29,6 +30,7 @@
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/env.h"
 #include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/rate_limiter/adaptive_admission_queue.h"
 #include "tensorstore/internal/rate_limiter/admission_queue.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/internal/rate_limiter/scaling_rate_limiter.h"
@@ -43,6 +45,7 @@
 #include "tensorstore/internal/json_binding/std_array.h"
 #include "tensorstore/internal/json_binding/std_optional.h"
 
+using ::tensorstore::internal::AdaptiveAdmissionQueue;
 using ::tensorstore::internal::AdmissionQueue;
 using ::tensorstore::internal::AnyContextResourceJsonBinder;
 using ::tensorstore::internal::ConstantRateLimiter;
@@ -77,6 +80,27 @@ std::optional<size_t> GetEnvGcsRequestConcurrency() {
   return std::nullopt;
 }
 
+bool GetEnvGcsAdaptiveConcurrency() {
+  // Called before flag parsing during resource registration.
+  return internal::GetEnvValue<bool>("TENSORSTORE_GCS_ADAPTIVE_CONCURRENCY")
+      .value_or(false);
+}
+
+// Constructs the admission queue for a concurrency limit.  When adaptive
+// concurrency is enabled, `limit` seeds an AIMD controller which adjusts the
+// in-flight limit from observed latency and throttling; otherwise the limit
+// is fixed.
+std::shared_ptr<AdmissionQueue> MakeAdmissionQueue(size_t limit) {
+  if (GetEnvGcsAdaptiveConcurrency()) {
+    AdaptiveAdmissionQueue::Options options;
+    options.initial_limit = limit;
+    options.min_limit = std::max<size_t>(1, limit / 8);
+    options.max_limit = limit * 4;
+    return std::make_shared<AdaptiveAdmissionQueue>(options);
+  }
+  return std::make_shared<AdmissionQueue>(limit);
+}
+
 std::optional<absl::Duration> GetEnvGcsRateLimiterDoublingTime() {
   // Called before flag parsing during resource registration.
   auto env = internal::GetEnv("TENSORSTORE_GCS_RATE_LIMITER_DOUBLING_TIME");
@@ -105,14 +129,14 @@ Result<GcsConcurrencyResource::Resource> GcsConcurrencyResource::Create(
   if (spec.limit) {
     Resource value;
     value.spec = spec;
-    value.queue = std::make_shared<AdmissionQueue>(*spec.limit);
+    value.queue = MakeAdmissionQueue(*spec.limit);
     return value;
   }
 
   absl::call_once(shared_once_, [&] {
     ABSL_LOG_IF(INFO, gcs_logging)
         << "Using default AdmissionQueue with limit " << shared_limit_;
-    shared_resource_.queue = std::make_shared<AdmissionQueue>(shared_limit_);
+    shared_resource_.queue = MakeAdmissionQueue(shared_limit_);
   });
   return shared_resource_;
 }
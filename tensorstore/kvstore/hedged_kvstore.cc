@@ -0,0 +1,263 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/hedged_kvstore.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/batch.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/internal/thread/schedule_at.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/garbage_collection.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_kvstore {
+namespace {
+
+auto& hedged_reads = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/hedged_reads",
+    internal_metrics::MetricMetadata("Count of duplicate reads issued by the "
+                                     "hedging kvstore adapter"));
+
+auto& hedged_read_wins = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/hedged_read_wins",
+    internal_metrics::MetricMetadata(
+        "Count of hedged reads that completed before the original read"));
+
+// Number of recent read latency samples retained for computing the hedging
+// delay.
+constexpr size_t kLatencyWindow = 128;
+
+class HedgedKvStoreDriver final : public kvstore::Driver {
+ public:
+  explicit HedgedKvStoreDriver(kvstore::DriverPtr base,
+                               HedgedReadOptions options, Executor executor)
+      : base_(std::move(base)),
+        options_(options),
+        executor_(std::move(executor)) {}
+
+  ~HedgedKvStoreDriver() override = default;
+
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    return base_->Write(std::move(key), std::move(value), std::move(options));
+  }
+
+  absl::Status ReadModifyWrite(internal::OpenTransactionPtr& transaction,
+                               size_t& phase, Key key,
+                               ReadModifyWriteSource& source) override {
+    return base_->ReadModifyWrite(transaction, phase, std::move(key), source);
+  }
+
+  absl::Status TransactionalDeleteRange(
+      const internal::OpenTransactionPtr& transaction,
+      KeyRange range) override {
+    return base_->TransactionalDeleteRange(transaction, std::move(range));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    return base_->DeleteRange(std::move(range));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    return base_->ListImpl(std::move(options), std::move(receiver));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_->DescribeKey(key);
+  }
+
+  Result<kvstore::DriverSpecPtr> GetBoundSpec() const override {
+    return base_->GetBoundSpec();
+  }
+
+  kvstore::SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_->GetSupportedFeatures(key_range);
+  }
+
+  void GarbageCollectionVisit(
+      garbage_collection::GarbageCollectionVisitor& visitor) const override {
+    return base_->GarbageCollectionVisit(visitor);
+  }
+
+  // Returns the delay after which an incomplete read should be hedged, or
+  // `std::nullopt` if there are not yet enough latency samples.
+  std::optional<absl::Duration> GetHedgeDelay() {
+    if (options_.fixed_delay) return *options_.fixed_delay;
+    absl::MutexLock lock(&mutex_);
+    if (latencies_.size() < options_.min_samples) return std::nullopt;
+    std::vector<absl::Duration> samples(latencies_);
+    const size_t index = std::min(
+        samples.size() - 1,
+        static_cast<size_t>(options_.latency_quantile * samples.size()));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+  }
+
+  void RecordLatency(absl::Duration latency) {
+    absl::MutexLock lock(&mutex_);
+    if (latencies_.size() < kLatencyWindow) {
+      latencies_.push_back(latency);
+    } else {
+      latencies_[next_sample_ % kLatencyWindow] = latency;
+    }
+    ++next_sample_;
+  }
+
+  // Consumes one unit of hedging budget, returning `false` if the budget is
+  // exhausted.  At least one hedged read is always permitted.
+  bool TryAcquireHedgeBudget() {
+    absl::MutexLock lock(&mutex_);
+    const int64_t allowed =
+        static_cast<int64_t>(options_.budget_fraction * total_reads_) + 1;
+    if (hedged_reads_ >= allowed) return false;
+    ++hedged_reads_;
+    return true;
+  }
+
+  kvstore::DriverPtr base_;
+  HedgedReadOptions options_;
+  Executor executor_;
+
+  absl::Mutex mutex_;
+  std::vector<absl::Duration> latencies_ ABSL_GUARDED_BY(mutex_);
+  size_t next_sample_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t total_reads_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t hedged_reads_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+struct HedgedReadState
+    : public internal::AtomicReferenceCount<HedgedReadState> {
+  internal::IntrusivePtr<HedgedKvStoreDriver> owner;
+  kvstore::Key key;
+  kvstore::ReadOptions options;
+  Promise<kvstore::ReadResult> promise;
+  absl::Time start_time;
+  std::atomic<bool> primary_done{false};
+
+  void OnPrimary(ReadyFuture<kvstore::ReadResult> ready) {
+    primary_done.store(true, std::memory_order_relaxed);
+    owner->RecordLatency(absl::Now() - start_time);
+    promise.SetResult(std::move(ready.result()));
+  }
+
+  // Errors from the hedged read are ignored; the original read resolves the
+  // promise in that case, so hedging never makes a read less reliable.
+  void OnHedge(ReadyFuture<kvstore::ReadResult> ready) {
+    if (!ready.result().ok()) return;
+    if (promise.SetResult(std::move(ready.result()))) {
+      hedged_read_wins.Increment();
+    }
+  }
+
+  void MaybeHedge() {
+    if (primary_done.load(std::memory_order_relaxed) ||
+        !promise.result_needed()) {
+      return;
+    }
+    if (!owner->TryAcquireHedgeBudget()) return;
+    hedged_reads.Increment();
+    owner->base_->Read(key, options)
+        .ExecuteWhenReady([self = internal::IntrusivePtr<HedgedReadState>(
+                               this)](ReadyFuture<kvstore::ReadResult> ready) {
+          self->OnHedge(std::move(ready));
+        });
+  }
+};
+
+Future<kvstore::ReadResult> HedgedKvStoreDriver::Read(Key key,
+                                                      ReadOptions options) {
+  {
+    absl::MutexLock lock(&mutex_);
+    ++total_reads_;
+  }
+  auto delay = GetHedgeDelay();
+  if (!delay) {
+    // Not enough samples yet; issue a plain read but record its latency.
+    auto start_time = absl::Now();
+    auto future = base_->Read(std::move(key), std::move(options));
+    future.ExecuteWhenReady(
+        [self = internal::IntrusivePtr<HedgedKvStoreDriver>(this),
+         start_time](ReadyFuture<ReadResult>) {
+          self->RecordLatency(absl::Now() - start_time);
+        });
+    return future;
+  }
+
+  auto op = PromiseFuturePair<ReadResult>::Make();
+  auto state = internal::MakeIntrusivePtr<HedgedReadState>();
+  state->owner = internal::IntrusivePtr<HedgedKvStoreDriver>(this);
+  state->key = std::move(key);
+  state->options = options;
+  // The hedged read must not join the caller's batch: holding a batch
+  // reference would delay the batch's submission past the hedging deadline.
+  state->options.batch = Batch::no_batch;
+  state->promise = std::move(op.promise);
+  state->start_time = absl::Now();
+
+  base_->Read(state->key, std::move(options))
+      .ExecuteWhenReady(
+          [state](ReadyFuture<ReadResult> ready) {
+            state->OnPrimary(std::move(ready));
+          });
+  internal::ScheduleAt(
+      state->start_time + *delay,
+      WithExecutor(executor_, [state] { state->MaybeHedge(); }));
+  return std::move(op.future);
+}
+
+}  // namespace
+
+kvstore::DriverPtr MakeHedgedKvStoreDriver(kvstore::DriverPtr base,
+                                           HedgedReadOptions options,
+                                           Executor executor) {
+  return internal::MakeIntrusivePtr<HedgedKvStoreDriver>(
+      std::move(base), options, std::move(executor));
+}
+
+}  // namespace internal_kvstore
+}  // namespace tensorstore
@@ -0,0 +1,65 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_HEDGED_KVSTORE_H_
+#define TENSORSTORE_KVSTORE_HEDGED_KVSTORE_H_
+
+#include <stddef.h>
+
+#include <optional>
+
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/util/executor.h"
+
+namespace tensorstore {
+namespace internal_kvstore {
+
+/// Options for `MakeHedgedKvStoreDriver`.
+struct HedgedReadOptions {
+  /// Quantile of recently-observed read latencies used as the hedging delay:
+  /// if a read has not completed after that long, a duplicate read is issued
+  /// and the first response wins.
+  double latency_quantile = 0.95;
+
+  /// Number of latency samples required before hedging begins.
+  size_t min_samples = 16;
+
+  /// Upper bound on hedged reads as a fraction of total reads; hedging
+  /// stops when the budget is exhausted.  One hedged read is always
+  /// permitted so that the budget does not prevent hedging entirely.
+  double budget_fraction = 0.1;
+
+  /// If set, used as the hedging delay instead of the latency quantile.
+  std::optional<absl::Duration> fixed_delay;
+};
+
+/// Adapts a base kvstore to hedge slow reads.
+///
+/// Each read is issued to the base kvstore immediately; if it has not
+/// completed after a delay derived from the recent read latency
+/// distribution, a duplicate read is issued and the first response to
+/// arrive resolves the caller's future.  This trades a bounded amount of
+/// extra load (`budget_fraction`) for a much shorter read latency tail.
+///
+/// Only unconditional-compatible reads benefit; writes, lists and
+/// deletes are forwarded to the base kvstore unchanged.
+kvstore::DriverPtr MakeHedgedKvStoreDriver(kvstore::DriverPtr base,
+                                           HedgedReadOptions options,
+                                           Executor executor);
+
+}  // namespace internal_kvstore
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_HEDGED_KVSTORE_H_
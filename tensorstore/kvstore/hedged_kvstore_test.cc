@@ -0,0 +1,139 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/hedged_kvstore.h"
+
+#include <string_view>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/thread/thread_pool.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/mock_kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::StorageGeneration;
+using ::tensorstore::TimestampedStorageGeneration;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MockKeyValueStore;
+using ::tensorstore::internal_kvstore::HedgedReadOptions;
+using ::tensorstore::internal_kvstore::MakeHedgedKvStoreDriver;
+
+kvstore::ReadResult MakeValue(std::string_view value, std::string_view gen) {
+  return kvstore::ReadResult::Value(
+      absl::Cord(value), TimestampedStorageGeneration{
+                             StorageGeneration::FromString(gen), absl::Now()});
+}
+
+TEST(HedgedKvStoreTest, NoHedgeBeforeDelay) {
+  auto mock = MockKeyValueStore::Make();
+  HedgedReadOptions options;
+  options.fixed_delay = absl::Hours(1);
+  auto driver = MakeHedgedKvStoreDriver(
+      mock, options, tensorstore::internal::DetachedThreadPool(1));
+
+  auto read_future = kvstore::Read(driver, "a");
+  {
+    auto req = mock->read_requests.pop();
+    EXPECT_EQ("a", req.key);
+    req.promise.SetResult(MakeValue("value", "g1"));
+  }
+  EXPECT_THAT(read_future.result(),
+              MatchesKvsReadResult(absl::Cord("value"),
+                                   StorageGeneration::FromString("g1")));
+  EXPECT_TRUE(mock->read_requests.empty());
+}
+
+TEST(HedgedKvStoreTest, HedgeWins) {
+  auto mock = MockKeyValueStore::Make();
+  HedgedReadOptions options;
+  options.fixed_delay = absl::ZeroDuration();
+  auto driver = MakeHedgedKvStoreDriver(
+      mock, options, tensorstore::internal::DetachedThreadPool(1));
+
+  auto read_future = kvstore::Read(driver, "a");
+  auto primary = mock->read_requests.pop();
+  auto hedge = mock->read_requests.pop();
+  EXPECT_EQ("a", hedge.key);
+
+  hedge.promise.SetResult(MakeValue("hedge", "g2"));
+  EXPECT_THAT(read_future.result(),
+              MatchesKvsReadResult(absl::Cord("hedge"),
+                                   StorageGeneration::FromString("g2")));
+
+  // The original read completing later is a no-op.
+  primary.promise.SetResult(MakeValue("primary", "g1"));
+  EXPECT_THAT(read_future.result(),
+              MatchesKvsReadResult(absl::Cord("hedge"),
+                                   StorageGeneration::FromString("g2")));
+}
+
+TEST(HedgedKvStoreTest, HedgeErrorIgnored) {
+  auto mock = MockKeyValueStore::Make();
+  HedgedReadOptions options;
+  options.fixed_delay = absl::ZeroDuration();
+  auto driver = MakeHedgedKvStoreDriver(
+      mock, options, tensorstore::internal::DetachedThreadPool(1));
+
+  auto read_future = kvstore::Read(driver, "a");
+  auto primary = mock->read_requests.pop();
+  auto hedge = mock->read_requests.pop();
+
+  hedge.promise.SetResult(absl::UnavailableError("hedge failed"));
+  primary.promise.SetResult(MakeValue("primary", "g1"));
+  EXPECT_THAT(read_future.result(),
+              MatchesKvsReadResult(absl::Cord("primary"),
+                                   StorageGeneration::FromString("g1")));
+}
+
+TEST(HedgedKvStoreTest, BudgetLimitsHedging) {
+  auto mock = MockKeyValueStore::Make();
+  HedgedReadOptions options;
+  options.fixed_delay = absl::ZeroDuration();
+  options.budget_fraction = 0;  // Only the always-permitted hedge is allowed.
+  auto driver = MakeHedgedKvStoreDriver(
+      mock, options, tensorstore::internal::DetachedThreadPool(1));
+
+  auto read_future1 = kvstore::Read(driver, "a");
+  auto primary1 = mock->read_requests.pop();
+  auto hedge1 = mock->read_requests.pop();
+  primary1.promise.SetResult(MakeValue("value", "g1"));
+  hedge1.promise.SetResult(MakeValue("value", "g1"));
+  TENSORSTORE_EXPECT_OK(read_future1.result());
+
+  // The budget is now exhausted, so the second read is not hedged.
+  auto read_future2 = kvstore::Read(driver, "b");
+  auto primary2 = mock->read_requests.pop();
+  EXPECT_EQ("b", primary2.key);
+  absl::SleepFor(absl::Milliseconds(10));
+  EXPECT_TRUE(mock->read_requests.empty());
+  primary2.promise.SetResult(MakeValue("value2", "g2"));
+  EXPECT_THAT(read_future2.result(),
+              MatchesKvsReadResult(absl::Cord("value2"),
+                                   StorageGeneration::FromString("g2")));
+}
+
+}  // namespace
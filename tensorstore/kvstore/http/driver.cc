@@ -34,6 +34,7 @@
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/concurrency_resource.h"
 #include "tensorstore/internal/concurrency_resource_provider.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/http/curl_transport.h"
 #include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
@@ -50,8 +51,10 @@
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
+#include "tensorstore/kvstore/hedged_kvstore.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
 #include "tensorstore/kvstore/operations.h"
 #include "tensorstore/kvstore/read_result.h"
@@ -257,7 +260,25 @@ Future<kvstore::DriverPtr> HttpKeyValueStoreSpec::DoOpen() const {
   auto driver = internal::MakeIntrusivePtr<HttpKeyValueStore>();
   driver->spec_ = data_;
   driver->transport_ = internal_http::GetDefaultHttpTransport();
-  return driver;
+  kvstore::DriverPtr result = driver;
+  if (internal::GetEnvValue<bool>("TENSORSTORE_HTTP_READ_HEDGING")
+          .value_or(false)) {
+    // Issue a duplicate read when a read exceeds the recent latency
+    // distribution, taking the first response.
+    result = internal_kvstore::MakeHedgedKvStoreDriver(
+        std::move(result), internal_kvstore::HedgedReadOptions{},
+        driver->executor());
+  }
+  if (internal::GetEnvValue<bool>("TENSORSTORE_HTTP_READ_COALESCING")
+          .value_or(false)) {
+    // Merge concurrent reads of nearby byte ranges of the same resource into
+    // a single request.
+    result = internal_kvstore::MakeCoalesceKvStoreDriver(
+        std::move(result), /*threshold=*/1024 * 1024,
+        /*merged_threshold=*/16 * 1024 * 1024,
+        /*interval=*/absl::ZeroDuration(), driver->executor());
+  }
+  return result;
 }
 
 /// A ReadTask is a function object used to satisfy a
@@ -16,7 +16,6 @@
 #include <stdint.h>
 
 #include <algorithm>
-#include <atomic>
 #include <cassert>
 #include <optional>
 #include <set>
@@ -257,7 +256,7 @@ class KvStack
       const KeyRange& key_range) const final {
     uint64_t merged = ~uint64_t{0};
     bool found = false;
-    layers_.VisitRange(key_range, [&](KeyRange intersect, auto& mapped) {
+    VisitLayers(key_range, [&](KeyRange intersect, auto& mapped) {
       merged &= static_cast<uint64_t>(
           mapped.kvstore.driver->GetSupportedFeatures(intersect));
       found = true;
@@ -267,12 +266,13 @@ class KvStack
   }
 
   std::string DescribeKey(std::string_view key) override {
-    auto it = layers_.range_containing(key);
-    if (it == layers_.end()) {
+    auto* layer = FindLayer(key);
+    if (!layer) {
       return tensorstore::StrCat("kvstack[unmapped] ", QuoteString(key));
     }
 
-    return it->value.kvstore.driver->DescribeKey(it->value.GetMappedKey(key));
+    return layer->value.kvstore.driver->DescribeKey(
+        layer->value.GetMappedKey(key));
   }
 
   absl::Status ReadModifyWrite(internal::OpenTransactionPtr& transaction,
@@ -288,12 +288,18 @@ class KvStack
 
   void InitializeLayers(std::vector<Future<kvstore::KvStore>>& layer_futures) {
     size_t batch_nesting_depth = 0;
+    internal_kvstack::KeyRangeMap<MappedValue> map;
     for (size_t i = 0; i < layer_futures.size(); i++) {
       auto& f = layer_futures[i];
       batch_nesting_depth =
           std::max(batch_nesting_depth, f.value().driver->BatchNestingDepth());
-      layers_.Set(spec_.layers[i].key_range,
-                  MappedValue{f.value(), spec_.layers[i].strip_prefix_length});
+      map.Set(spec_.layers[i].key_range,
+              MappedValue{f.value(), spec_.layers[i].strip_prefix_length});
+    }
+    // Flatten the resolved (non-overlapping) ranges into the immutable
+    // dispatch table.
+    for (auto& v : map) {
+      layers_.push_back(LayerEntry{v.range, v.value});
     }
     SetBatchNestingDepth(batch_nesting_depth + 1);
   }
@@ -313,7 +319,50 @@ class KvStack
     }
   };
 
-  internal_kvstack::KeyRangeMap<MappedValue> layers_;
+  struct LayerEntry {
+    KeyRange range;
+    MappedValue value;
+  };
+
+  /// Returns the layer containing `key`, or `nullptr` if `key` is unmapped.
+  const LayerEntry* FindLayer(std::string_view key) const {
+    auto it = std::upper_bound(
+        layers_.begin(), layers_.end(), key,
+        [](std::string_view k, const LayerEntry& e) {
+          return k < e.range.inclusive_min;
+        });
+    if (it == layers_.begin()) return nullptr;
+    --it;
+    return Contains(it->range, key) ? &*it : nullptr;
+  }
+
+  /// Invokes `fn(intersect, mapped)` for each layer intersecting `range`.
+  template <typename Fn>
+  void VisitLayers(const KeyRange& range, Fn&& fn) const {
+    if (range.empty()) return;
+    auto it = std::upper_bound(
+        layers_.begin(), layers_.end(), std::string_view(range.inclusive_min),
+        [](std::string_view k, const LayerEntry& e) {
+          return k < e.range.inclusive_min;
+        });
+    if (it != layers_.begin()) --it;
+    for (; it != layers_.end(); ++it) {
+      if (!range.exclusive_max.empty() &&
+          it->range.inclusive_min >= range.exclusive_max) {
+        break;
+      }
+      KeyRange intersect = Intersect(range, it->range);
+      if (!intersect.empty()) {
+        fn(intersect, it->value);
+      }
+    }
+  }
+
+  /// Immutable dispatch table, sorted by `range.inclusive_min` with
+  /// non-overlapping ranges.  Built once by `InitializeLayers` and then only
+  /// read, so lookups are simple binary searches without any tree traversal
+  /// or locking.
+  std::vector<LayerEntry> layers_;
 };
 
 Future<kvstore::DriverPtr> KvStackSpec::DoOpen() const {
@@ -341,30 +390,31 @@ Future<kvstore::DriverPtr> KvStackSpec::DoOpen() const {
 }
 
 Future<ReadResult> KvStack::Read(Key key, ReadOptions options) {
-  auto it = layers_.range_containing(key);
-  if (it == layers_.end()) {
+  auto* layer = FindLayer(key);
+  if (!layer) {
     return ReadResult::Missing(absl::InfiniteFuture());
   }
-  key = key.substr(it->value.strip_prefix_length);
-  return kvstore::Read(it->value.kvstore, std::move(key), std::move(options));
+  key = key.substr(layer->value.strip_prefix_length);
+  return kvstore::Read(layer->value.kvstore, std::move(key),
+                       std::move(options));
 }
 
 Future<TimestampedStorageGeneration> KvStack::Write(Key key,
                                                     std::optional<Value> value,
                                                     WriteOptions options) {
-  auto it = layers_.range_containing(key);
-  if (it == layers_.end()) {
+  auto* layer = FindLayer(key);
+  if (!layer) {
     return absl::InvalidArgumentError(
         tensorstore::StrCat("Key not found in any layers: ", QuoteString(key)));
   }
-  key = key.substr(it->value.strip_prefix_length);
-  return kvstore::Write(it->value.kvstore, std::move(key), std::move(value),
+  key = key.substr(layer->value.strip_prefix_length);
+  return kvstore::Write(layer->value.kvstore, std::move(key), std::move(value),
                         std::move(options));
 }
 
 Future<const void> KvStack::DeleteRange(KeyRange range) {
   std::vector<AnyFuture> delete_futures;
-  layers_.VisitRange(range, [&](KeyRange intersect, auto& mapped) {
+  VisitLayers(range, [&](KeyRange intersect, auto& mapped) {
     intersect =
         KeyRange::RemovePrefixLength(mapped.strip_prefix_length, intersect);
     delete_futures.push_back(kvstore::DeleteRange(mapped.kvstore, intersect));
@@ -375,19 +425,19 @@ Future<const void> KvStack::DeleteRange(KeyRange range) {
 absl::Status KvStack::ReadModifyWrite(internal::OpenTransactionPtr& transaction,
                                       size_t& phase, Key key,
                                       ReadModifyWriteSource& source) {
-  auto it = layers_.range_containing(key);
-  if (it == layers_.end()) {
+  auto* layer = FindLayer(key);
+  if (!layer) {
     return absl::InvalidArgumentError(
         tensorstore::StrCat("Key not found in any layers: ", QuoteString(key)));
   }
-  return it->value.kvstore.driver->ReadModifyWrite(
-      transaction, phase, it->value.GetMappedKey(key), source);
+  return layer->value.kvstore.driver->ReadModifyWrite(
+      transaction, phase, layer->value.GetMappedKey(key), source);
 }
 
 absl::Status KvStack::TransactionalDeleteRange(
     const internal::OpenTransactionPtr& transaction, KeyRange range) {
   absl::Status status;
-  layers_.VisitRange(range, [&](KeyRange intersect, auto& mapped) {
+  VisitLayers(range, [&](KeyRange intersect, auto& mapped) {
     auto delete_status = mapped.kvstore.driver->TransactionalDeleteRange(
         transaction, mapped.GetMappedRange(intersect));
     status.Update(delete_status);
@@ -400,7 +450,7 @@ Future<const void> KvStack::ExperimentalCopyRangeFrom(
     Key target_prefix, kvstore::CopyRangeOptions options) {
   auto range = KeyRange::AddPrefix(target_prefix, options.source_range);
   std::vector<AnyFuture> copy_futures;
-  layers_.VisitRange(range, [&](KeyRange intersect, auto& mapped) {
+  VisitLayers(range, [&](KeyRange intersect, auto& mapped) {
     auto my_options = options;
     options.source_range = KeyRange::RemovePrefix(target_prefix, intersect);
     copy_futures.push_back(mapped.kvstore.driver->ExperimentalCopyRangeFrom(
@@ -409,7 +459,11 @@ Future<const void> KvStack::ExperimentalCopyRangeFrom(
   return WaitAllFuture(tensorstore::span(copy_futures));
 }
 
-// ListReceiver which issues kvstore::List requests in order.
+// ListReceiver which issues the per-layer kvstore::List requests concurrently
+// and forwards entries to the composed receiver as they arrive.  Since
+// kvstore::List does not guarantee any particular order, entries from
+// different layers may be freely interleaved; issuing the requests
+// concurrently avoids a serial round trip per intersecting layer.
 struct KvStackListState final
     : public internal::AtomicReferenceCount<KvStackListState> {
   using Self = internal::IntrusivePtr<KvStackListState>;
@@ -423,99 +477,132 @@ struct KvStackListState final
   ListOptions options_;
   ListReceiver receiver_;
   std::vector<V> ranges_;
-  std::atomic<size_t> pos_{0};
+
+  // Serializes entries and the final done/error signal sent to `receiver_`.
+  absl::Mutex value_mutex_;
 
   absl::Mutex mutex_;
-  std::optional<AnyCancelReceiver> cancel_ ABSL_GUARDED_BY(mutex_);
+  std::vector<AnyCancelReceiver> cancels_ ABSL_GUARDED_BY(mutex_);
+  bool cancelled_ ABSL_GUARDED_BY(mutex_) = false;
+  size_t remaining_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::Status error_ ABSL_GUARDED_BY(mutex_);
 
   KvStackListState(KvStack& driver, ListOptions options, ListReceiver receiver)
       : options_(std::move(options)), receiver_(std::move(receiver)) {
-    // Note that List doesn't guarantee any particular order so it would be
-    // fine to list all intersecting layers.
-    driver.layers_.VisitRange(
-        options_.range, [this](KeyRange intersect, auto& mapped) {
-          std::string prefix_to_add =
-              intersect.inclusive_min.substr(0, mapped.strip_prefix_length);
-          auto range = KeyRange::RemovePrefixLength(mapped.strip_prefix_length,
-                                                    intersect);
-          ranges_.push_back(
-              V{std::move(range), mapped.kvstore, std::move(prefix_to_add)});
-        });
+    driver.VisitLayers(options_.range,
+                       [this](KeyRange intersect, auto& mapped) {
+                         std::string prefix_to_add = intersect.inclusive_min
+                                 .substr(0, mapped.strip_prefix_length);
+                         auto range = KeyRange::RemovePrefixLength(
+                             mapped.strip_prefix_length, intersect);
+                         ranges_.push_back(V{std::move(range), mapped.kvstore,
+                                             std::move(prefix_to_add)});
+                       });
 
     execution::set_starting(receiver_, [this] { DoCancel(); });
   }
 
   ~KvStackListState() { execution::set_stopping(receiver_); }
 
-  void SetCancel(AnyCancelReceiver cancel) {
-    absl::MutexLock lock(&mutex_);
-    cancel_ = std::move(cancel);
+  void AddCancel(AnyCancelReceiver cancel) {
+    {
+      absl::MutexLock lock(&mutex_);
+      if (!cancelled_) {
+        cancels_.push_back(std::move(cancel));
+        return;
+      }
+    }
+    cancel();
   }
 
   void DoCancel() {
-    absl::MutexLock lock(&mutex_);
-    if (cancel_) (*cancel_)();
-    cancel_ = std::nullopt;
-    pos_ = ranges_.size();
+    std::vector<AnyCancelReceiver> cancels;
+    {
+      absl::MutexLock lock(&mutex_);
+      cancelled_ = true;
+      cancels = std::move(cancels_);
+    }
+    for (auto& cancel : cancels) cancel();
+  }
+
+  // Called when a per-layer list completes (successfully or not); the final
+  // signal is sent once all layers have completed.
+  void LayerStopped() {
+    absl::Status error;
+    {
+      absl::MutexLock lock(&mutex_);
+      if (--remaining_ != 0) return;
+      error = error_;
+    }
+    absl::MutexLock lock(&value_mutex_);
+    if (!error.ok()) {
+      execution::set_error(receiver_, std::move(error));
+    } else {
+      execution::set_done(receiver_);
+    }
   }
 
   /// AnyFlowReceiver implementation.
   struct Receiver {
-    IntrusivePtr<KvStackListState> state;
+    Self state;
     V* v;
 
     /// AnyFlowReceiver methods.
     [[maybe_unused]] friend void set_starting(Receiver& self,
                                               AnyCancelReceiver cancel) {
-      self.state->SetCancel(std::move(cancel));
+      self.state->AddCancel(std::move(cancel));
     }
 
     [[maybe_unused]] friend void set_value(Receiver& self, ListEntry entry) {
       if (!self.v->prefix_to_add.empty()) {
         entry.key = tensorstore::StrCat(self.v->prefix_to_add, entry.key);
       }
-      execution::set_value(self.state->receiver_, std::move(entry));
+      auto* state = self.state.get();
+      absl::MutexLock lock(&state->value_mutex_);
+      execution::set_value(state->receiver_, std::move(entry));
     }
 
     [[maybe_unused]] friend void set_done(Receiver& self) {
-      // set_done is not propagated; StartNextRange handles it on the
-      // last range instead of starting a new range.
+      // set_done is not propagated; LayerStopped sends the final signal once
+      // all layers have completed.
     }
 
     [[maybe_unused]] friend void set_error(Receiver& self, absl::Status s) {
-      execution::set_error(self.state->receiver_, std::move(s));
-      self.v = nullptr;
+      auto* state = self.state.get();
+      {
+        absl::MutexLock lock(&state->mutex_);
+        if (state->error_.ok()) state->error_ = std::move(s);
+      }
+      // The composite operation has failed; cancel the remaining layers.
+      state->DoCancel();
     }
 
     [[maybe_unused]] friend void set_stopping(Receiver& self) {
-      auto* state = self.state.get();
-      if (self.v) state->StartNextRange(std::move(self.state));
+      self.state->LayerStopped();
     }
   };
 
-  static void StartNextRange(internal::IntrusivePtr<KvStackListState> state) {
-    size_t idx;
+  static void Start(Self state) {
+    const size_t num_ranges = state->ranges_.size();
+    if (num_ranges == 0) {
+      execution::set_done(state->receiver_);
+      return;
+    }
     {
       absl::MutexLock lock(&state->mutex_);
-      state->cancel_ = std::nullopt;
-      idx = state->pos_.fetch_add(1);
+      state->remaining_ = num_ranges;
     }
-    if (idx < state->ranges_.size()) {
-      auto& v = state->ranges_[idx];
+    for (size_t i = 0; i < num_ranges; ++i) {
+      auto& v = state->ranges_[i];
       ListOptions options = state->options_;
       options.range = v.range;
-      kvstore::List(v.kvstore, std::move(options),
-                    Receiver{std::move(state), &v});
-    } else if (idx == state->ranges_.size()) {
-      execution::set_done(state->receiver_);
+      kvstore::List(v.kvstore, std::move(options), Receiver{state, &v});
     }
   }
 };
 
 void KvStack::ListImpl(ListOptions options, ListReceiver receiver) {
-  // Ownership of the pointer is transferred to the kvstore::List calls via
-  // the sequence of StartNextRange() calls.
-  KvStackListState::StartNextRange(internal::MakeIntrusivePtr<KvStackListState>(
+  KvStackListState::Start(internal::MakeIntrusivePtr<KvStackListState>(
       *this, std::move(options), std::move(receiver)));
 }
 
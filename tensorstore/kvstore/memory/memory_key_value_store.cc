@@ -28,6 +28,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/btree_map.h"
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
@@ -39,7 +40,6 @@
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/json_binding/bindable.h"
 #include "tensorstore/internal/json_binding/json_binding.h"
-#include "tensorstore/internal/mutex.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/driver.h"
@@ -94,26 +94,77 @@ struct StoredKeyValuePairs
   };
 
   using Map = absl::btree_map<std::string, ValueWithGenerationNumber>;
-  std::pair<Map::iterator, Map::iterator> Find(const std::string& inclusive_min,
-                                               const std::string& exclusive_max)
-      ABSL_SHARED_LOCKS_REQUIRED(mutex) {
-    return {values.lower_bound(inclusive_min),
-            exclusive_max.empty() ? values.end()
-                                  : values.lower_bound(exclusive_max)};
-  }
 
-  std::pair<Map::iterator, Map::iterator> Find(const KeyRange& range)
-      ABSL_SHARED_LOCKS_REQUIRED(mutex) {
-    return Find(range.inclusive_min, range.exclusive_max);
+  /// The stored values are partitioned by key hash into independently-locked
+  /// shards, so that concurrent single-key operations (the common case when
+  /// the memory driver backs multi-threaded tests and benchmarks) do not
+  /// contend on a single store-wide mutex.  Operations that require a
+  /// consistent view of (or an atomic modification to) the entire store lock
+  /// all shards, which is equivalent to the previous store-wide lock.
+  constexpr static size_t kNumShards = 16;
+
+  struct Shard {
+    std::pair<Map::iterator, Map::iterator> Find(
+        const std::string& inclusive_min, const std::string& exclusive_max)
+        ABSL_SHARED_LOCKS_REQUIRED(mutex) {
+      return {values.lower_bound(inclusive_min),
+              exclusive_max.empty() ? values.end()
+                                    : values.lower_bound(exclusive_max)};
+    }
+
+    std::pair<Map::iterator, Map::iterator> Find(const KeyRange& range)
+        ABSL_SHARED_LOCKS_REQUIRED(mutex) {
+      return Find(range.inclusive_min, range.exclusive_max);
+    }
+
+    absl::Mutex mutex;
+    Map values ABSL_GUARDED_BY(mutex);
+  };
+
+  Shard& shard_for(std::string_view key) {
+    return shards[absl::HashOf(key) % kNumShards];
   }
 
-  absl::Mutex mutex;
   /// Next generation number to use when updating the value associated with a
   /// key.  Using a single per-store counter rather than a per-key counter
   /// ensures that creating a key, deleting it, then creating it again does
   /// not result in the same generation number being reused for a given key.
-  uint64_t next_generation_number ABSL_GUARDED_BY(mutex) = 0;
-  Map values ABSL_GUARDED_BY(mutex);
+  std::atomic<uint64_t> next_generation_number{0};
+  Shard shards[kNumShards];
+};
+
+/// Locks every shard (in a fixed order, to avoid deadlock) for operations
+/// that span shards.
+class AllShardsWriterLock {
+ public:
+  explicit AllShardsWriterLock(StoredKeyValuePairs& data)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS : data_(&data) {
+    for (auto& shard : data.shards) shard.mutex.WriterLock();
+  }
+  ~AllShardsWriterLock() { unlock(); }
+
+  void unlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    if (!data_) return;
+    for (auto& shard : data_->shards) shard.mutex.WriterUnlock();
+    data_ = nullptr;
+  }
+
+ private:
+  StoredKeyValuePairs* data_;
+};
+
+class AllShardsReaderLock {
+ public:
+  explicit AllShardsReaderLock(StoredKeyValuePairs& data)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS : data_(&data) {
+    for (auto& shard : data.shards) shard.mutex.ReaderLock();
+  }
+  ~AllShardsReaderLock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    for (auto& shard : data_->shards) shard.mutex.ReaderUnlock();
+  }
+
+ private:
+  StoredKeyValuePairs* data_;
 };
 
 /// Defines the context resource (see `tensorstore/context.h`) that actually
@@ -263,7 +314,7 @@ class MemoryDriver::TransactionNode
     if (!single_phase_mutation.remaining_entries_.HasError()) {
       auto& data = static_cast<MemoryDriver&>(*this->driver()).data();
       TimestampedStorageGeneration generation;
-      UniqueWriterLock lock(data.mutex);
+      AllShardsWriterLock lock(data);
       absl::Time commit_time = absl::Now();
       if (!ValidateEntryConditions(data, single_phase_mutation, commit_time)) {
         lock.unlock();
@@ -284,7 +335,7 @@ class MemoryDriver::TransactionNode
   static bool ValidateEntryConditions(
       StoredKeyValuePairs& data,
       internal_kvstore::SinglePhaseMutation& single_phase_mutation,
-      const absl::Time& commit_time) ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+      const absl::Time& commit_time) ABSL_NO_THREAD_SAFETY_ANALYSIS {
     bool validated = true;
     for (auto& entry : single_phase_mutation.entries_) {
       if (!ValidateEntryConditions(data, entry, commit_time)) {
@@ -297,7 +348,7 @@ class MemoryDriver::TransactionNode
   static bool ValidateEntryConditions(StoredKeyValuePairs& data,
                                       internal_kvstore::MutationEntry& entry,
                                       const absl::Time& commit_time)
-      ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
     if (entry.entry_type() == kReadModifyWrite) {
       return ValidateEntryConditions(
           data, static_cast<BufferedReadModifyWriteEntry&>(entry), commit_time);
@@ -319,15 +370,16 @@ class MemoryDriver::TransactionNode
   static bool ValidateEntryConditions(StoredKeyValuePairs& data,
                                       BufferedReadModifyWriteEntry& entry,
                                       const absl::Time& commit_time)
-      ABSL_SHARED_LOCKS_REQUIRED(data.mutex) {
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
     auto& stamp = entry.stamp();
     auto if_equal = StorageGeneration::Clean(stamp.generation);
     if (StorageGeneration::IsUnknown(if_equal)) {
       assert(stamp.time == absl::InfiniteFuture());
       return true;
     }
-    auto it = data.values.find(entry.key_);
-    if (it == data.values.end()) {
+    auto& values = data.shard_for(entry.key_).values;
+    auto it = values.find(entry.key_);
+    if (it == values.end()) {
       if (StorageGeneration::IsNoValue(if_equal)) {
         stamp.time = commit_time;
         return true;
@@ -346,29 +398,33 @@ class MemoryDriver::TransactionNode
   static void ApplyMutation(
       StoredKeyValuePairs& data,
       internal_kvstore::SinglePhaseMutation& single_phase_mutation,
-      const absl::Time& commit_time) ABSL_EXCLUSIVE_LOCKS_REQUIRED(data.mutex) {
+      const absl::Time& commit_time) ABSL_NO_THREAD_SAFETY_ANALYSIS {
     for (auto& entry : single_phase_mutation.entries_) {
       if (entry.entry_type() == kReadModifyWrite) {
         auto& rmw_entry = static_cast<BufferedReadModifyWriteEntry&>(entry);
         auto& stamp = rmw_entry.stamp();
         stamp.time = commit_time;
         auto value_state = rmw_entry.value_state_;
+        auto& values = data.shard_for(rmw_entry.key_).values;
         if (!StorageGeneration::IsDirty(stamp.generation)) {
           // Do nothing
         } else if (value_state == ReadResult::kMissing) {
-          data.values.erase(rmw_entry.key_);
+          values.erase(rmw_entry.key_);
           stamp.generation = StorageGeneration::NoValue();
         } else {
           assert(value_state == ReadResult::kValue);
-          auto& v = data.values[rmw_entry.key_];
-          v.generation_number = data.next_generation_number++;
+          auto& v = values[rmw_entry.key_];
+          v.generation_number = data.next_generation_number.fetch_add(
+              1, std::memory_order_relaxed);
           v.value = std::move(rmw_entry.value_);
           stamp.generation = v.generation();
         }
       } else {
         auto& dr_entry = static_cast<DeleteRangeEntry&>(entry);
-        auto it_range = data.Find(dr_entry.key_, dr_entry.exclusive_max_);
-        data.values.erase(it_range.first, it_range.second);
+        for (auto& shard : data.shards) {
+          auto it_range = shard.Find(dr_entry.key_, dr_entry.exclusive_max_);
+          shard.values.erase(it_range.first, it_range.second);
+        }
       }
     }
   }
@@ -376,8 +432,9 @@ class MemoryDriver::TransactionNode
 
 Future<ReadResult> MemoryDriver::Read(Key key, ReadOptions options) {
   auto& data = this->data();
-  absl::ReaderMutexLock lock(&data.mutex);
-  auto& values = data.values;
+  auto& shard = data.shard_for(key);
+  absl::ReaderMutexLock lock(&shard.mutex);
+  auto& values = shard.values;
   auto it = values.find(key);
   if (it == values.end()) {
     // Key not found.
@@ -399,8 +456,9 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
   using ValueWithGenerationNumber =
       StoredKeyValuePairs::ValueWithGenerationNumber;
   auto& data = this->data();
-  absl::WriterMutexLock lock(&data.mutex);
-  auto& values = data.values;
+  auto& shard = data.shard_for(key);
+  absl::WriterMutexLock lock(&shard.mutex);
+  auto& values = shard.values;
   auto it = values.find(key);
   if (it == values.end()) {
     // Key does not already exist.
@@ -417,8 +475,10 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
     // generation number.
     it = values
              .emplace(std::move(key),
-                      ValueWithGenerationNumber{*std::move(value),
-                                                data.next_generation_number++})
+                      ValueWithGenerationNumber{
+                          *std::move(value),
+                          data.next_generation_number.fetch_add(
+                              1, std::memory_order_relaxed)})
              .first;
     return GenerationNow(it->second.generation());
   }
@@ -434,44 +494,54 @@ Future<TimestampedStorageGeneration> MemoryDriver::Write(
     return GenerationNow(StorageGeneration::NoValue());
   }
   // Set the generation number to the next unused generation number.
-  it->second.generation_number = data.next_generation_number++;
+  it->second.generation_number =
+      data.next_generation_number.fetch_add(1, std::memory_order_relaxed);
   // Update the value.
   it->second.value = *std::move(value);
   return GenerationNow(it->second.generation());
 }
 
-Future<const void> MemoryDriver::DeleteRange(KeyRange range) {
+Future<const void> MemoryDriver::DeleteRange(KeyRange range)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
   auto& data = this->data();
-  absl::WriterMutexLock lock(&data.mutex);
   if (!range.empty()) {
-    auto it_range = data.Find(range);
-    data.values.erase(it_range.first, it_range.second);
+    AllShardsWriterLock lock(data);
+    for (auto& shard : data.shards) {
+      auto it_range = shard.Find(range);
+      shard.values.erase(it_range.first, it_range.second);
+    }
   }
   return absl::OkStatus();  // Converted to a ReadyFuture.
 }
 
-void MemoryDriver::ListImpl(ListOptions options, ListReceiver receiver) {
+void MemoryDriver::ListImpl(ListOptions options, ListReceiver receiver)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
   auto& data = this->data();
   std::atomic<bool> cancelled{false};
   execution::set_starting(receiver, [&cancelled] {
     cancelled.store(true, std::memory_order_relaxed);
   });
 
-  // Collect the keys.
+  // Collect the keys.  Each shard holds a hash-based subset of the keys, so
+  // the per-shard (sorted) ranges must be merged to produce ordered results.
   std::vector<ListEntry> entries;
   {
-    absl::ReaderMutexLock lock(&data.mutex);
-    auto it_range = data.Find(options.range);
-    for (auto it = it_range.first; it != it_range.second; ++it) {
-      if (cancelled.load(std::memory_order_relaxed)) break;
-      std::string_view key = it->first;
-      entries.push_back(ListEntry{
-          std::string(
-              key.substr(std::min(options.strip_prefix_length, key.size()))),
-          ListEntry::checked_size(it->second.value.size()),
-      });
+    AllShardsReaderLock lock(data);
+    for (auto& shard : data.shards) {
+      auto it_range = shard.Find(options.range);
+      for (auto it = it_range.first; it != it_range.second; ++it) {
+        if (cancelled.load(std::memory_order_relaxed)) break;
+        std::string_view key = it->first;
+        entries.push_back(ListEntry{
+            std::string(
+                key.substr(std::min(options.strip_prefix_length, key.size()))),
+            ListEntry::checked_size(it->second.value.size()),
+        });
+      }
     }
   }
+  std::sort(entries.begin(), entries.end(),
+            [](const ListEntry& a, const ListEntry& b) { return a.key < b.key; });
 
   // Send the keys.
   for (auto& entry : entries) {
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "absl/base/internal/endian.h"
+#include "absl/base/optimization.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
@@ -92,6 +93,151 @@ using ::tensorstore::kvstore::ListEntry;
 using ::tensorstore::kvstore::ListReceiver;
 using ::tensorstore::kvstore::SupportedFeatures;
 
+using ShardIndex = uint64_t;
+using MinishardIndex = uint64_t;
+
+/// Read-only KvStore adapter that maps read requests for a shard key to byte
+/// range reads of the shard index at the start of the corresponding shard.
+///
+/// This is an implementation detail of `ShardIndexCache`, which relies on
+/// `KvsBackedCache`.
+class ShardIndexKeyValueStore : public kvstore::Driver {
+ public:
+  explicit ShardIndexKeyValueStore(kvstore::DriverPtr base,
+                                   int64_t index_size_in_bytes)
+      : base_(std::move(base)), index_size_in_bytes_(index_size_in_bytes) {}
+
+  Future<ReadResult> Read(Key key, ReadOptions options) override {
+    assert(options.byte_range == OptionalByteRangeRequest{});
+    options.byte_range =
+        OptionalByteRangeRequest::Range(0, index_size_in_bytes_);
+    return MapFutureError(
+        InlineExecutor{},
+        [](const absl::Status& status) {
+          return ConvertInvalidArgumentToFailedPrecondition(status);
+        },
+        base_->Read(std::move(key), std::move(options)));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return tensorstore::StrCat("shard index in ", base_->DescribeKey(key));
+  }
+
+  void GarbageCollectionVisit(
+      garbage_collection::GarbageCollectionVisitor& visitor) const final {
+    // No-op
+  }
+
+  kvstore::Driver* base() { return base_.get(); }
+
+ private:
+  kvstore::DriverPtr base_;
+  int64_t index_size_in_bytes_;
+};
+
+/// Caches decoded shard indices.
+///
+/// Each cache entry corresponds to a particular shard.  The entry key directly
+/// encodes the uint64 shard number (in big endian order).
+///
+/// The decoded shard index is shared by all minishards within the shard, so
+/// resolving a minishard index location in a shard whose index is cached and
+/// current requires no additional round trip to the base kvstore.  When a read
+/// specifies a newer staleness bound than the cached index, `KvsBackedCache`
+/// revalidates conditionally (`if_not_equal` with the cached generation), so
+/// an unchanged shard index is not re-transferred or re-parsed.
+///
+/// This cache is only used for reading.
+class ShardIndexCache
+    : public internal::KvsBackedCache<ShardIndexCache, internal::AsyncCache> {
+  using Base = internal::KvsBackedCache<ShardIndexCache, internal::AsyncCache>;
+
+ public:
+  using ReadData = std::vector<ShardIndexEntry>;
+
+  static std::string ShardToKey(ShardIndex shard) {
+    std::string key;
+    key.resize(sizeof(ShardIndex));
+    absl::big_endian::Store64(key.data(), shard);
+    return key;
+  }
+
+  static ShardIndex KeyToShard(std::string_view key) {
+    assert(key.size() == sizeof(ShardIndex));
+    return absl::big_endian::Load64(key.data());
+  }
+
+  class Entry : public Base::Entry {
+   public:
+    using OwningCache = ShardIndexCache;
+
+    ShardIndex shard() { return KeyToShard(key()); }
+
+    std::string GetKeyValueStoreKey() override {
+      auto& cache = GetOwningCache(*this);
+      return GetShardKey(cache.sharding_spec(), cache.key_prefix(),
+                         this->shard());
+    }
+
+    size_t ComputeReadDataSizeInBytes(const void* read_data) override {
+      return internal::EstimateHeapUsage(
+          *static_cast<const ReadData*>(read_data));
+    }
+
+    void DoDecode(std::optional<absl::Cord> value,
+                  DecodeReceiver receiver) override {
+      GetOwningCache(*this).executor()(
+          [this, value = std::move(value),
+           receiver = std::move(receiver)]() mutable {
+            std::shared_ptr<ReadData> read_data;
+            if (value) {
+              if (auto result = DecodeShardIndexAndAdjustByteRanges(
+                      *value, GetOwningCache(*this).sharding_spec());
+                  result.ok()) {
+                read_data = std::make_shared<ReadData>(*std::move(result));
+              } else {
+                execution::set_error(receiver,
+                                     ConvertInvalidArgumentToFailedPrecondition(
+                                         std::move(result).status()));
+                return;
+              }
+            }
+            execution::set_value(receiver, std::move(read_data));
+          });
+    }
+  };
+
+  Entry* DoAllocateEntry() final { return new Entry; }
+  size_t DoGetSizeofEntry() final { return sizeof(Entry); }
+  TransactionNode* DoAllocateTransactionNode(AsyncCache::Entry& entry) final {
+    ABSL_UNREACHABLE();  // COV_NF_LINE
+  }
+
+  explicit ShardIndexCache(kvstore::DriverPtr base_kvstore, Executor executor,
+                           std::string key_prefix,
+                           const ShardingSpec& sharding_spec)
+      : Base(kvstore::DriverPtr(new ShardIndexKeyValueStore(
+            std::move(base_kvstore), ShardIndexSize(sharding_spec)))),
+        executor_(std::move(executor)),
+        key_prefix_(std::move(key_prefix)),
+        sharding_spec_(sharding_spec) {}
+
+  ShardIndexKeyValueStore* shard_index_kvstore_driver() {
+    return static_cast<ShardIndexKeyValueStore*>(this->Base::kvstore_driver());
+  }
+
+  kvstore::Driver* base_kvstore_driver() {
+    return shard_index_kvstore_driver()->base();
+  }
+  const ShardingSpec& sharding_spec() const { return sharding_spec_; }
+  const std::string& key_prefix() const { return key_prefix_; }
+  const Executor& executor() const { return executor_; }
+
+  Executor executor_;
+  std::string key_prefix_;
+  ShardingSpec sharding_spec_;
+};
+
 /// Read-only KeyValueStore for retrieving a minishard index
 ///
 /// The key is a `ChunkCombinedShardInfo` (in native memory layout).  The value
@@ -103,14 +249,9 @@ using ::tensorstore::kvstore::SupportedFeatures;
 /// advantage of `KvsBackedCache` to define `MinishardIndexCache`.
 class MinishardIndexKeyValueStore : public kvstore::Driver {
  public:
-  explicit MinishardIndexKeyValueStore(kvstore::DriverPtr base,
-                                       Executor executor,
-                                       std::string key_prefix,
-                                       const ShardingSpec& sharding_spec)
-      : base_(std::move(base)),
-        executor_(std::move(executor)),
-        key_prefix_(key_prefix),
-        sharding_spec_(sharding_spec) {}
+  explicit MinishardIndexKeyValueStore(
+      internal::CachePtr<ShardIndexCache> shard_index_cache)
+      : shard_index_cache_(std::move(shard_index_cache)) {}
 
   Future<ReadResult> Read(Key key, ReadOptions options) override;
 
@@ -120,11 +261,12 @@ class MinishardIndexKeyValueStore : public kvstore::Driver {
       return tensorstore::StrCat("invalid key ", tensorstore::QuoteString(key));
     }
     std::memcpy(&combined_info, key.data(), sizeof(combined_info));
-    auto split_info = GetSplitShardInfo(sharding_spec_, combined_info);
+    const auto& sharding_spec = this->sharding_spec();
+    auto split_info = GetSplitShardInfo(sharding_spec, combined_info);
     return tensorstore::StrCat(
         "minishard ", split_info.minishard, " in ",
-        base_->DescribeKey(
-            GetShardKey(sharding_spec_, key_prefix_, split_info.shard)));
+        base()->DescribeKey(
+            GetShardKey(sharding_spec, key_prefix(), split_info.shard)));
   }
 
   void GarbageCollectionVisit(
@@ -132,32 +274,37 @@ class MinishardIndexKeyValueStore : public kvstore::Driver {
     // No-op
   }
 
-  kvstore::Driver* base() { return base_.get(); }
-  const ShardingSpec& sharding_spec() { return sharding_spec_; }
-  const std::string& key_prefix() const { return key_prefix_; }
-  const Executor& executor() const { return executor_; }
+  kvstore::Driver* base() { return shard_index_cache_->base_kvstore_driver(); }
+  const ShardingSpec& sharding_spec() {
+    return shard_index_cache_->sharding_spec();
+  }
+  const std::string& key_prefix() const {
+    return shard_index_cache_->key_prefix();
+  }
+  const Executor& executor() const { return shard_index_cache_->executor(); }
+  const internal::CachePtr<ShardIndexCache>& shard_index_cache() const {
+    return shard_index_cache_;
+  }
 
-  kvstore::DriverPtr base_;
-  Executor executor_;
-  std::string key_prefix_;
-  ShardingSpec sharding_spec_;
+  internal::CachePtr<ShardIndexCache> shard_index_cache_;
 };
 
 namespace {
 
-using ShardIndex = uint64_t;
-using MinishardIndex = uint64_t;
-
 // Reading a minishard index proceeds as follows:
 //
-// 1. Request the shard index.
+// 1. Request the shard index via `ShardIndexCache`.  The cached shard index
+//    is shared by all minishards in the shard, and is revalidated
+//    conditionally (`if_not_equal` with its cached generation) when a newer
+//    staleness bound is required.
 //
 //    a. If not found, the minishard is empty.  Done.
 //
 //    b. If the minishard index was cached and the generation has not
 //       changed, the cached data is up to date.  Done.
 //
-//    c. Otherwise, decode the byte range of the minishard index.
+//    c. Otherwise, obtain the byte range of the minishard index from the
+//       shard index.
 //
 // 2. Request the minishard index from the byte range specified in the
 //    shard index.
@@ -206,11 +353,22 @@ class MinishardIndexReadOperationState
         this, internal::adopt_object_ref);
     retry_batch_ = Batch::New();
 
-    auto minishard_fetch_batch = Batch::New();
-
-    for (auto& request : request_batch.requests) {
-      ProcessMinishard(batch, request, minishard_fetch_batch);
-    }
+    auto shard_index_cache_entry = GetCacheEntry(
+        driver().shard_index_cache(),
+        ShardIndexCache::ShardToKey(std::get<ShardIndex>(batch_entry_key)));
+    auto shard_index_read_future = shard_index_cache_entry->Read(
+        {this->request_batch.staleness_bound, batch});
+    std::move(shard_index_read_future)
+        .ExecuteWhenReady([self = std::move(self),
+                           entry = std::move(shard_index_cache_entry)](
+                              ReadyFuture<const void> future) mutable {
+          const auto& executor = self->driver().executor();
+          executor([self = std::move(self), entry = std::move(entry),
+                    status = future.status()]() mutable {
+            OnShardIndexReady(std::move(self), std::move(entry),
+                              std::move(status));
+          });
+        });
   }
 
   std::string ShardKey() {
@@ -219,82 +377,76 @@ class MinishardIndexReadOperationState
                        std::get<ShardIndex>(batch_entry_key));
   }
 
-  void ProcessMinishard(Batch::View batch, Request& request,
-                        Batch minishard_fetch_batch) {
-    kvstore::ReadOptions kvstore_read_options;
-    kvstore_read_options.generation_conditions =
-        std::get<kvstore::ReadGenerationConditions>(this->batch_entry_key);
-    kvstore_read_options.staleness_bound = this->request_batch.staleness_bound;
-    auto key = std::get<MinishardIndex>(request);
-    kvstore_read_options.byte_range = OptionalByteRangeRequest{
-        static_cast<int64_t>(key * 16), static_cast<int64_t>((key + 1) * 16)};
-    kvstore_read_options.batch = batch;
-    auto shard_index_read_future = this->driver().base()->Read(
-        this->ShardKey(), std::move(kvstore_read_options));
-    shard_index_read_future.Force();
-    shard_index_read_future.ExecuteWhenReady(
-        [self = internal::IntrusivePtr<MinishardIndexReadOperationState>(this),
-         minishard_fetch_batch = std::move(minishard_fetch_batch),
-         &request](ReadyFuture<kvstore::ReadResult> future) mutable {
-          const auto& executor = self->driver().executor();
-          executor([self = std::move(self), &request,
-                    minishard_fetch_batch = std::move(minishard_fetch_batch),
-                    future = std::move(future)] {
-            OnShardIndexReady(std::move(self), request,
-                              std::move(minishard_fetch_batch),
-                              std::move(future.result()));
-          });
-        });
-  }
-
   static void OnShardIndexReady(
       internal::IntrusivePtr<MinishardIndexReadOperationState> self,
-      Request& request, Batch minishard_fetch_batch,
-      Result<kvstore::ReadResult>&& result) {
-    auto& byte_range_request =
-        std::get<internal_kvstore_batch::ByteRangeReadRequest>(request);
-    const auto set_error = [&](absl::Status status) {
-      byte_range_request.promise.SetResult(MaybeAnnotateStatus(
-          ConvertInvalidArgumentToFailedPrecondition(std::move(status)),
-          "Error retrieving shard index entry"));
-    };
-    TENSORSTORE_ASSIGN_OR_RETURN(auto&& read_result, result,
-                                 set_error(std::move(_)));
-    if (  // Shard is empty (case 1a above)
-        read_result.aborted() ||
-        // Existing data is up to date (case 1b above).
-        read_result.not_found()) {
-      byte_range_request.promise.SetResult(std::move(read_result));
+      internal::PinnedCacheEntry<ShardIndexCache> shard_index_cache_entry,
+      absl::Status status) {
+    if (!status.ok()) {
+      internal_kvstore_batch::SetCommonResult<Request>(
+          self->request_batch.requests, std::move(status));
+      return;
+    }
+    std::shared_ptr<const ShardIndexCache::ReadData> shard_index;
+    TimestampedStorageGeneration stamp;
+    {
+      auto lock = internal::AsyncCache::ReadLock<ShardIndexCache::ReadData>(
+          *shard_index_cache_entry);
+      stamp = lock.stamp();
+      shard_index = lock.shared_data();
+    }
+    assert(!StorageGeneration::IsUnknown(stamp.generation));
+
+    if (!std::get<kvstore::ReadGenerationConditions>(self->batch_entry_key)
+             .Matches(stamp.generation)) {
+      // Existing data is up to date (case 1b above).
+      internal_kvstore_batch::SetCommonResult(
+          self->request_batch.requests,
+          kvstore::ReadResult::Unspecified(std::move(stamp)));
+      return;
+    }
+
+    if (!shard_index) {
+      // Shard is empty (case 1a above).
+      internal_kvstore_batch::SetCommonResult(
+          self->request_batch.requests,
+          kvstore::ReadResult::Missing(std::move(stamp)));
       return;
     }
+
     // Read was successful (case 1c above).
-    TENSORSTORE_ASSIGN_OR_RETURN(
-        auto byte_range, DecodeShardIndexEntry(read_result.value.Flatten()),
-        set_error(std::move(_)));
-    TENSORSTORE_ASSIGN_OR_RETURN(
-        byte_range,
-        GetAbsoluteShardByteRange(byte_range, self->driver().sharding_spec()),
-        set_error(std::move(_)));
+    auto minishard_fetch_batch = Batch::New();
+    for (auto& request : self->request_batch.requests) {
+      self->ProcessMinishard(request, *shard_index, stamp,
+                             minishard_fetch_batch);
+    }
+  }
+
+  void ProcessMinishard(Request& request,
+                        const ShardIndexCache::ReadData& shard_index,
+                        const TimestampedStorageGeneration& stamp,
+                        const Batch& minishard_fetch_batch) {
+    auto& byte_range_request =
+        std::get<internal_kvstore_batch::ByteRangeReadRequest>(request);
+    assert(std::get<MinishardIndex>(request) < shard_index.size());
+    const ByteRange byte_range =
+        shard_index[std::get<MinishardIndex>(request)];
     if (byte_range.size() == 0) {
       // Minishard index is 0 bytes, which means the minishard is empty.
-      read_result.value.Clear();
-      read_result.state = kvstore::ReadResult::kMissing;
-      byte_range_request.promise.SetResult(std::move(read_result));
+      byte_range_request.promise.SetResult(kvstore::ReadResult::Missing(stamp));
       return;
     }
     kvstore::ReadOptions kvstore_read_options;
     // The `if_equal` condition ensure that an "aborted" `ReadResult` is
     // returned in the case of a concurrent modification (case 2a above).
-    kvstore_read_options.generation_conditions.if_equal =
-        std::move(read_result.stamp.generation);
-    kvstore_read_options.staleness_bound = self->request_batch.staleness_bound;
+    kvstore_read_options.generation_conditions.if_equal = stamp.generation;
+    kvstore_read_options.staleness_bound = this->request_batch.staleness_bound;
     kvstore_read_options.byte_range = byte_range;
-    kvstore_read_options.batch = std::move(minishard_fetch_batch);
-    auto read_future = self->driver().base()->Read(
-        self->ShardKey(), std::move(kvstore_read_options));
+    kvstore_read_options.batch = minishard_fetch_batch;
+    auto read_future =
+        driver().base()->Read(ShardKey(), std::move(kvstore_read_options));
     read_future.Force();
     read_future.ExecuteWhenReady(
-        [self = std::move(self),
+        [self = internal::IntrusivePtr<MinishardIndexReadOperationState>(this),
          &request](ReadyFuture<kvstore::ReadResult> future) mutable {
           const auto& executor = self->driver().executor();
           executor([self = std::move(self), &request,
@@ -343,7 +495,7 @@ Future<kvstore::ReadResult> MinishardIndexKeyValueStore::Read(
     return absl::InvalidArgumentError("Key does not specify a minishard");
   }
   std::memcpy(&combined_info, key.data(), sizeof(combined_info));
-  auto split_info = GetSplitShardInfo(sharding_spec_, combined_info);
+  auto split_info = GetSplitShardInfo(sharding_spec(), combined_info);
   if (options.byte_range != OptionalByteRangeRequest()) {
     // Byte range requests are not useful for minishard indices.
     return absl::InvalidArgumentError("Byte ranges not supported");
@@ -420,12 +572,10 @@ class MinishardIndexCache
     return new TransactionNode(static_cast<Entry&>(entry));
   }
 
-  explicit MinishardIndexCache(kvstore::DriverPtr base_kvstore,
-                               Executor executor, std::string key_prefix,
-                               const ShardingSpec& sharding_spec)
-      : Base(kvstore::DriverPtr(new MinishardIndexKeyValueStore(
-            std::move(base_kvstore), executor, std::move(key_prefix),
-            sharding_spec))) {}
+  explicit MinishardIndexCache(
+      internal::CachePtr<ShardIndexCache> shard_index_cache)
+      : Base(kvstore::DriverPtr(
+            new MinishardIndexKeyValueStore(std::move(shard_index_cache)))) {}
 
   MinishardIndexKeyValueStore* kvstore_driver() {
     return static_cast<MinishardIndexKeyValueStore*>(
@@ -439,6 +589,9 @@ class MinishardIndexCache
   kvstore::Driver* base_kvstore_driver() { return kvstore_driver()->base(); }
   const Executor& executor() { return kvstore_driver()->executor(); }
   const std::string& key_prefix() { return kvstore_driver()->key_prefix(); }
+  const internal::CachePtr<ShardIndexCache>& shard_index_cache() {
+    return kvstore_driver()->shard_index_cache();
+  }
 };
 
 MinishardAndChunkId GetMinishardAndChunkId(std::string_view key) {
@@ -998,8 +1151,13 @@ class ShardedKeyValueStore
                       cache_pool.get(), "",
                       [&] {
                         return std::make_unique<MinishardIndexCache>(
-                            std::move(base_kvstore), std::move(executor),
-                            std::move(key_prefix), sharding_spec);
+                            internal::GetCache<ShardIndexCache>(
+                                cache_pool.get(), "", [&] {
+                                  return std::make_unique<ShardIndexCache>(
+                                      std::move(base_kvstore),
+                                      std::move(executor),
+                                      std::move(key_prefix), sharding_spec);
+                                }));
                       }),
                   std::move(get_max_chunks_per_shard));
             })),
@@ -489,7 +489,7 @@ TEST_F(RawEncodingTest, ShardIndexTooShort) {
       MatchesStatus(
           absl::StatusCode::kFailedPrecondition,
           "Error reading minishard 0 in \"prefix/0\\.shard\": "
-          "Error retrieving shard index entry: "
+          "Error reading shard index in \"prefix/0\\.shard\": "
           "Requested byte range \\[0, 16\\) is not valid for value of size 3"));
   EXPECT_THAT(
       store->Write(GetChunkKey(10), absl::Cord("abc")).result(),
@@ -507,7 +507,8 @@ TEST_F(RawEncodingTest, ShardIndexInvalidByteRange) {
       store->Read(GetChunkKey(10)).result(),
       MatchesStatus(absl::StatusCode::kFailedPrecondition,
                     "Error reading minishard 0 in \"prefix/0\\.shard\": "
-                    "Error retrieving shard index entry: "
+                    "Error reading shard index in \"prefix/0\\.shard\": "
+                    "Error decoding shard index entry for minishard 0: "
                     "Shard index specified invalid byte range: \\[10, 2\\)"));
   EXPECT_THAT(store->Write(GetChunkKey(10), absl::Cord("abc")).result(),
               MatchesStatus(
@@ -529,7 +530,8 @@ TEST_F(RawEncodingTest, ShardIndexByteRangeOverflow) {
       store->Read(GetChunkKey(10)).result(),
       MatchesStatus(absl::StatusCode::kFailedPrecondition,
                     "Error reading minishard 0 in \"prefix/0\\.shard\": "
-                    "Error retrieving shard index entry: "
+                    "Error reading shard index in \"prefix/0\\.shard\": "
+                    "Error decoding shard index entry for minishard 0: "
                     "Byte range .* relative to the end of "
                     "the shard index \\(16\\) is not valid"));
   EXPECT_THAT(store->Write(GetChunkKey(10), absl::Cord("abc")).result(),
@@ -739,12 +741,14 @@ TEST_F(UnderlyingKeyValueStoreTest, Read) {
                 req.options.generation_conditions.if_not_equal);
       EXPECT_EQ(StorageGeneration::Unknown(),
                 req.options.generation_conditions.if_equal);
-      EXPECT_EQ(OptionalByteRangeRequest(0, 16), req.options.byte_range);
+      EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
       EXPECT_THAT(req.options.staleness_bound, ::testing::Gt(init_time));
       req.promise.SetResult(ReadResult::Value(
           Bytes({
               5, 0, 0, 0, 0, 0, 0, 0,   //
               31, 0, 0, 0, 0, 0, 0, 0,  //
+              31, 0, 0, 0, 0, 0, 0, 0,  //
+              31, 0, 0, 0, 0, 0, 0, 0,  //
           }),
           {StorageGeneration::FromString("g0"), absl::Now()}));
     }
@@ -813,7 +817,7 @@ TEST_F(UnderlyingKeyValueStoreTest, Read) {
                 req.options.generation_conditions.if_not_equal);
       EXPECT_EQ(StorageGeneration::Unknown(),
                 req.options.generation_conditions.if_equal);
-      EXPECT_EQ(OptionalByteRangeRequest(0, 16), req.options.byte_range);
+      EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
       EXPECT_THAT(req.options.staleness_bound, ::testing::Gt(req_time));
       minishard_index_time = absl::Now();
       req.promise.SetResult(ReadResult::Unspecified(
@@ -884,12 +888,14 @@ TEST_F(UnderlyingKeyValueStoreTest, Read) {
                 req.options.generation_conditions.if_not_equal);
       EXPECT_EQ(StorageGeneration::Unknown(),
                 req.options.generation_conditions.if_equal);
-      EXPECT_EQ(OptionalByteRangeRequest(0, 16), req.options.byte_range);
+      EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
       EXPECT_THAT(req.options.staleness_bound, ::testing::Ge(abort_time));
       req.promise.SetResult(ReadResult::Value(
           Bytes({
               6, 0, 0, 0, 0, 0, 0, 0,   //
               32, 0, 0, 0, 0, 0, 0, 0,  //
+              32, 0, 0, 0, 0, 0, 0, 0,  //
+              32, 0, 0, 0, 0, 0, 0, 0,  //
           }),
           {StorageGeneration::FromString("g1"), absl::Now()}));
     }
@@ -975,9 +981,11 @@ TEST_F(UnderlyingKeyValueStoreTest,
     EXPECT_EQ(StorageGeneration::Unknown(),
               req.options.generation_conditions.if_equal);
     EXPECT_EQ(init_time, req.options.staleness_bound);
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               6, 0, 0, 0, 0, 0, 0, 0,   //
                               32, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1002,14 +1010,16 @@ TEST_F(UnderlyingKeyValueStoreTest,
     auto req = mock_store->read_requests.pop_nonblock().value();
     ASSERT_EQ(0, mock_store->read_requests.size());
     EXPECT_EQ("prefix/0.shard", req.key);
-    EXPECT_EQ(StorageGeneration::Unknown(),
+    EXPECT_EQ(StorageGeneration::FromString("g2"),
               req.options.generation_conditions.if_not_equal);
     EXPECT_EQ(StorageGeneration::Unknown(),
               req.options.generation_conditions.if_equal);
     EXPECT_THAT(req.options.staleness_bound, ::testing::Ge(abort_time));
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               7, 0, 0, 0, 0, 0, 0, 0,   //
                               33, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1072,9 +1082,11 @@ TEST_F(UnderlyingKeyValueStoreTest,
     EXPECT_EQ(StorageGeneration::Unknown(),
               req.options.generation_conditions.if_equal);
     EXPECT_THAT(req.options.staleness_bound, ::testing::Gt(req_time));
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               6, 0, 0, 0, 0, 0, 0, 0,   //
                               32, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1115,9 +1127,11 @@ TEST_F(UnderlyingKeyValueStoreTest,
     EXPECT_EQ(StorageGeneration::Unknown(),
               req.options.generation_conditions.if_equal);
     EXPECT_THAT(req.options.staleness_bound, ::testing::Gt(req_time));
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               6, 0, 0, 0, 0, 0, 0, 0,   //
                               32, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1166,7 +1180,7 @@ TEST_F(UnderlyingKeyValueStoreTest, ReadErrorReadingShardIndex) {
     auto req = mock_store->read_requests.pop_nonblock().value();
     ASSERT_EQ(0, mock_store->read_requests.size());
     EXPECT_EQ("prefix/0.shard", req.key);
-    EXPECT_EQ(OptionalByteRangeRequest(0, 16), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(absl::UnknownError("Read error"));
   }
   ASSERT_TRUE(future.ready());
@@ -1174,7 +1188,7 @@ TEST_F(UnderlyingKeyValueStoreTest, ReadErrorReadingShardIndex) {
       future.result(),
       MatchesStatus(absl::StatusCode::kUnknown,
                     "Error reading minishard 0 in \"prefix/0\\.shard\": "
-                    "Error retrieving shard index entry: "
+                    "Error reading shard index in \"prefix/0\\.shard\": "
                     "Read error"));
 }
 
@@ -1185,9 +1199,11 @@ TEST_F(UnderlyingKeyValueStoreTest, ReadErrorReadingMinishardShardIndex) {
     auto req = mock_store->read_requests.pop_nonblock().value();
     ASSERT_EQ(0, mock_store->read_requests.size());
     EXPECT_EQ("prefix/0.shard", req.key);
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               6, 0, 0, 0, 0, 0, 0, 0,   //
                               32, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1216,9 +1232,11 @@ TEST_F(UnderlyingKeyValueStoreTest, ReadErrorReadingData) {
     auto req = mock_store->read_requests.pop_nonblock().value();
     ASSERT_EQ(0, mock_store->read_requests.size());
     EXPECT_EQ("prefix/0.shard", req.key);
-    EXPECT_EQ(OptionalByteRangeRequest(16, 32), req.options.byte_range);
+    EXPECT_EQ(OptionalByteRangeRequest(0, 32), req.options.byte_range);
     req.promise.SetResult(
         ReadResult::Value(Bytes({
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
+                              0, 0, 0, 0, 0, 0, 0, 0,   //
                               6, 0, 0, 0, 0, 0, 0, 0,   //
                               32, 0, 0, 0, 0, 0, 0, 0,  //
                           }),
@@ -1598,6 +1616,27 @@ TEST_F(UnderlyingKeyValueStoreTest, BatchRead) {
     EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(3));
   }
 
+  {
+    SCOPED_TRACE(
+        "Read 2/6 chunks from different minishards of the same shard in a "
+        "single batch");
+    std::vector<Future<kvstore::ReadResult>> futures;
+    {
+      kvstore::ReadOptions options;
+      options.batch = Batch::New();
+      futures = {
+          store->Read(key0, options),
+          store->Read(key3, options),
+      };
+    }
+    EXPECT_THAT(futures[0].result(), MatchesKvsReadResult(absl::Cord("abc")));
+    EXPECT_THAT(futures[1].result(), MatchesKvsReadResult(absl::Cord("key3-")));
+    // Expected to result in a single request for the shard index, followed by a
+    // batch request for the two minishard indices, followed by a batch request
+    // for the two entries.
+    EXPECT_THAT(mock_store->request_log.pop_all(), ::testing::SizeIs(3));
+  }
+
   {
     SCOPED_TRACE("Read 6/6 entries from the same shard in a single batch");
     std::vector<Future<kvstore::ReadResult>> futures;
@@ -117,6 +117,35 @@ Result<ByteRange> DecodeShardIndexEntry(std::string_view input) {
   return r;
 }
 
+Result<std::vector<ShardIndexEntry>> DecodeShardIndexAndAdjustByteRanges(
+    const absl::Cord& input, const ShardingSpec& sharding_spec) {
+  const uint64_t num_minishards = sharding_spec.num_minishards();
+  if (input.size() != num_minishards * 16) {
+    return absl::FailedPreconditionError(
+        tensorstore::StrCat("Invalid shard index length: ", input.size(),
+                            ", expected: ", num_minishards * 16));
+  }
+  std::vector<char> shard_index(input.size());
+  internal::CopyCordToSpan(input, shard_index);
+  std::vector<ShardIndexEntry> entries(num_minishards);
+  for (uint64_t minishard = 0; minishard < num_minishards; ++minishard) {
+    const auto GetEntry = [&]() -> Result<ByteRange> {
+      TENSORSTORE_ASSIGN_OR_RETURN(
+          auto byte_range,
+          DecodeShardIndexEntry(
+              std::string_view(shard_index.data() + 16 * minishard, 16)));
+      return GetAbsoluteShardByteRange(byte_range, sharding_spec);
+    };
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        entries[minishard], GetEntry(),
+        tensorstore::MaybeAnnotateStatus(
+            _, tensorstore::StrCat(
+                   "Error decoding shard index entry for minishard ",
+                   minishard)));
+  }
+  return entries;
+}
+
 Result<std::vector<MinishardIndexEntry>>
 DecodeMinishardIndexAndAdjustByteRanges(const absl::Cord& encoded,
                                         const ShardingSpec& sharding_spec) {
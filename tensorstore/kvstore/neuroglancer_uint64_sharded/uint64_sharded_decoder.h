@@ -65,6 +65,16 @@ Result<absl::Cord> DecodeData(const absl::Cord& input,
 /// \returns The byte range of the minishard index.
 Result<ByteRange> DecodeShardIndexEntry(std::string_view input);
 
+/// Decodes a complete shard index and adjusts the byte ranges to account for
+/// the implicit offset of the end of the shard index.
+///
+/// \param input Encoded shard index, of length
+///     `ShardIndexSize(sharding_spec)`.
+/// \returns The minishard index byte ranges, indexed by minishard number.
+/// \error `absl::StatusCode::kFailedPrecondition` if `input` is corrupt.
+Result<std::vector<ShardIndexEntry>> DecodeShardIndexAndAdjustByteRanges(
+    const absl::Cord& input, const ShardingSpec& sharding_spec);
+
 /// Decodes a minishard and adjusts the byte ranges to account for the implicit
 /// offset of the end of the shard index.
 ///
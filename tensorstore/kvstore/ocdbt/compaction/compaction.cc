@@ -0,0 +1,930 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/compaction/compaction.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/rate_limiter/rate_limiter.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/config.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
+#include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/manifest.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/create_new_manifest.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/write_nodes.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+using ::tensorstore::kvstore::ListEntry;
+
+// Entries replacing a single interior node entry after rewriting, with full
+// (unprefixed) keys.
+using RewrittenEntries = std::vector<InteriorNodeEntryData<std::string>>;
+
+// Result of rewriting a subtree: `std::nullopt` if the subtree references no
+// data file selected for rewriting and is left unchanged.
+using RewriteResult = std::optional<RewrittenEntries>;
+
+// Asynchronous operation state used to implement `CompactDatabase`.
+//
+// The compaction is implemented as follows:
+//
+// 1. List the data files under `CompactionOptions::data_file_prefixes`,
+//    recording their sizes.  Files created after this point are never
+//    considered for deletion.
+//
+// 2. Read the manifest and walk the B+tree of the latest version, summing per
+//    data file the bytes referenced by nodes and out-of-line values.
+//
+// 3. Select as rewrite victims the data files whose referenced fraction is
+//    below `CompactionOptions::live_fraction_threshold`, and rewrite the tree
+//    bottom-up: leaf values and nodes stored in victim files are re-written
+//    via `IoHandle::WriteData`, along with the interior nodes on the path to
+//    them; unchanged subtrees are referenced as-is.
+//
+// 4. Atomically commit a new version referencing the rewritten root, exactly
+//    as a normal commit would.  If the database was concurrently modified,
+//    fail with `kAborted` without modifying the database.
+//
+// 5. Optionally walk every retained version and delete the listed data files
+//    that are no longer referenced.
+//
+// Each read, write and delete is admitted through
+// `CompactionOptions::rate_limiter`.  The full tree is re-read between steps
+// 2 and 3 rather than retained in memory; the node cache absorbs most of the
+// duplicate reads.
+//
+// TODO(jbms): Currently memory usage is not bounded.  That needs to be
+// addressed, e.g. by limiting the number of in-flight nodes.
+struct CompactionOperation
+    : public internal::AtomicReferenceCount<CompactionOperation> {
+  using Ptr = internal::IntrusivePtr<CompactionOperation>;
+
+  IoHandle::Ptr io_handle;
+  KvStore base;
+  CompactionOptions options;
+  internal::NoRateLimiter no_rate_limiter;
+
+  std::shared_ptr<const Manifest> existing_manifest;
+  std::shared_ptr<const Manifest> new_manifest;
+  FlushPromise flush_promise;
+  CompactionStats stats;
+
+  // Sizes of the data files present when the compaction started, keyed by
+  // path relative to `base`.  Not modified after the listing completes.
+  absl::flat_hash_map<std::string, int64_t> data_file_sizes;
+
+  // Data files selected for rewriting.  Not modified after selection.
+  absl::flat_hash_set<std::string> victims;
+
+  absl::Mutex mutex;
+
+  // Bytes referenced by the latest version, per data file.
+  absl::flat_hash_map<std::string, uint64_t> live_bytes
+      ABSL_GUARDED_BY(mutex);
+
+  // Node locations already visited by the reference traversal, used to avoid
+  // re-traversing subtrees shared between versions.
+  absl::flat_hash_set<std::string> visited ABSL_GUARDED_BY(mutex);
+
+  // Data files referenced by any retained version.
+  absl::flat_hash_set<std::string> referenced ABSL_GUARDED_BY(mutex);
+
+  internal::RateLimiter& rate_limiter() {
+    return options.rate_limiter ? *options.rate_limiter : no_rate_limiter;
+  }
+
+  const Config& config() {
+    auto* config = io_handle->config_state->GetExistingConfig();
+    assert(config);
+    return *config;
+  }
+};
+
+// Task admitted through the rate limiter; invokes `fn` (which issues a single
+// storage operation) once admitted.
+template <typename Fn>
+struct ThrottledTask : public internal::RateLimiterNode {
+  CompactionOperation::Ptr op;
+  Fn fn;
+
+  static void Start(internal::RateLimiterNode* node) {
+    auto* self = static_cast<ThrottledTask*>(node);
+    self->op->rate_limiter().Finish(self);
+    Fn fn = std::move(self->fn);
+    delete self;
+    std::move(fn)();
+  }
+};
+
+template <typename Fn>
+void Throttled(CompactionOperation::Ptr op, Fn fn) {
+  auto& rate_limiter = op->rate_limiter();
+  auto* task = new ThrottledTask<Fn>{{}, std::move(op), std::move(fn)};
+  rate_limiter.Admit(task, &ThrottledTask<Fn>::Start);
+}
+
+void ReadManifestPhase(CompactionOperation::Ptr op,
+                       Promise<CompactionStats> promise);
+void ComputeLiveBytesPhase(CompactionOperation::Ptr op,
+                           Promise<CompactionStats> promise);
+void SelectVictimsAndRewrite(CompactionOperation::Ptr op,
+                             Promise<CompactionStats> promise);
+Future<RewriteResult> RewriteSubtree(CompactionOperation::Ptr op,
+                                     BtreeNodeReference node_ref,
+                                     bool may_be_root,
+                                     std::string inclusive_min_key,
+                                     KeyLength subtree_common_prefix_length);
+void CommitPhase(CompactionOperation::Ptr op,
+                 BtreeGenerationReference new_generation,
+                 Promise<CompactionStats> promise);
+void WriteManifestPhase(CompactionOperation::Ptr op,
+                        Promise<CompactionStats> promise);
+void GarbageCollectPhase(CompactionOperation::Ptr op,
+                         Promise<CompactionStats> promise);
+void DeleteUnreferencedFiles(CompactionOperation::Ptr op,
+                             Promise<CompactionStats> promise);
+
+// Lists the data files and their sizes.
+void ListDataFilesPhase(CompactionOperation::Ptr op,
+                        Promise<CompactionStats> promise) {
+  std::vector<std::string> prefixes{op->options.data_file_prefixes.value,
+                                    op->options.data_file_prefixes.btree_node,
+                                    op->options.data_file_prefixes
+                                        .version_tree_node};
+  std::sort(prefixes.begin(), prefixes.end());
+  prefixes.erase(std::unique(prefixes.begin(), prefixes.end()),
+                 prefixes.end());
+
+  struct ListState : public internal::AtomicReferenceCount<ListState> {
+    CompactionOperation::Ptr op;
+    std::vector<Future<std::vector<ListEntry>>> list_futures;
+  };
+  auto state = internal::MakeIntrusivePtr<ListState>();
+  state->op = op;
+  for (const auto& prefix : prefixes) {
+    kvstore::ListOptions list_options;
+    list_options.range = KeyRange::Prefix(prefix);
+    state->list_futures.push_back(
+        kvstore::ListFuture(op->base, std::move(list_options)));
+  }
+  std::vector<AnyFuture> futures(state->list_futures.begin(),
+                                 state->list_futures.end());
+  LinkValue(
+      [state = std::move(state)](Promise<CompactionStats> promise,
+                                 ReadyFuture<void>) {
+        auto& op = *state->op;
+        for (auto& list_future : state->list_futures) {
+          for (auto& entry : list_future.value()) {
+            // Guard against prefixes that also match the manifest, which must
+            // never be treated as an unreferenced data file.
+            if (std::string_view(entry.key).substr(0, 9) == "manifest.") {
+              continue;
+            }
+            op.data_file_sizes.emplace(std::move(entry.key), entry.size);
+          }
+        }
+        op.stats.num_data_files = op.data_file_sizes.size();
+        ABSL_LOG_IF(INFO, ocdbt_logging)
+            << "Compaction: num_data_files=" << op.stats.num_data_files;
+        ReadManifestPhase(std::move(state->op), std::move(promise));
+      },
+      std::move(promise), WaitAllFuture(span<const AnyFuture>(futures)));
+}
+
+void ReadManifestPhase(CompactionOperation::Ptr op,
+                       Promise<CompactionStats> promise) {
+  auto manifest_future = op->io_handle->GetManifest(absl::Now());
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<const ManifestWithTime> future) {
+        auto manifest = future.value().manifest;
+        if (!manifest) {
+          // Empty database.
+          promise.SetResult(op->stats);
+          return;
+        }
+        op->existing_manifest = std::move(manifest);
+        ComputeLiveBytesPhase(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(manifest_future));
+}
+
+// Accumulates the bytes of `ref` against its data file.
+void AddLiveBytes(CompactionOperation& op, const IndirectDataReference& ref) {
+  absl::MutexLock lock(&op.mutex);
+  op.live_bytes[ref.file_id.FullPath()] += ref.length;
+}
+
+void VisitForLiveBytes(CompactionOperation::Ptr op, Promise<void> promise,
+                       IndirectDataReference ref) {
+  AddLiveBytes(*op, ref);
+  Throttled(op, [op, promise = std::move(promise), ref]() mutable {
+    auto read_future = op->io_handle->GetBtreeNode(ref);
+    auto executor = op->io_handle->executor;
+    Link(WithExecutor(
+             std::move(executor),
+             [op = std::move(op)](
+                 Promise<void> promise,
+                 ReadyFuture<const std::shared_ptr<const BtreeNode>> future) {
+               TENSORSTORE_ASSIGN_OR_RETURN(
+                   auto node, future.result(),
+                   static_cast<void>(promise.SetResult(_)));
+               if (node->height > 0) {
+                 for (const auto& entry :
+                      std::get<BtreeNode::InteriorNodeEntries>(
+                          node->entries)) {
+                   VisitForLiveBytes(op, promise, entry.node.location);
+                 }
+               } else {
+                 for (const auto& entry :
+                      std::get<BtreeNode::LeafNodeEntries>(node->entries)) {
+                   if (auto* value_ref = std::get_if<IndirectDataReference>(
+                           &entry.value_reference)) {
+                     AddLiveBytes(*op, *value_ref);
+                   }
+                 }
+               }
+             }),
+         std::move(promise), std::move(read_future));
+  });
+}
+
+void ComputeLiveBytesPhase(CompactionOperation::Ptr op,
+                           Promise<CompactionStats> promise) {
+  auto [traversal_promise, traversal_future] =
+      PromiseFuturePair<void>::Make(absl::OkStatus());
+  const auto& latest = op->existing_manifest->latest_version();
+  if (op->options.live_fraction_threshold > 0 &&
+      !latest.root.location.IsMissing()) {
+    VisitForLiveBytes(op, traversal_promise, latest.root.location);
+  }
+  traversal_promise = Promise<void>();
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<const void>) {
+        SelectVictimsAndRewrite(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(traversal_future));
+}
+
+void SelectVictimsAndRewrite(CompactionOperation::Ptr op,
+                             Promise<CompactionStats> promise) {
+  {
+    absl::MutexLock lock(&op->mutex);
+    for (const auto& [path, size] : op->data_file_sizes) {
+      // Files with an unknown size cannot be assessed and are never
+      // rewritten.
+      if (size <= 0) continue;
+      auto it = op->live_bytes.find(path);
+      if (it == op->live_bytes.end()) continue;
+      const uint64_t live = it->second;
+      if (live > 0 && live < op->options.live_fraction_threshold *
+                                 static_cast<double>(size)) {
+        ABSL_LOG_IF(INFO, ocdbt_logging)
+            << "Compaction victim: " << tensorstore::QuoteString(path)
+            << ", live_bytes=" << live << ", size=" << size;
+        op->victims.insert(path);
+      }
+    }
+  }
+  op->stats.num_data_files_rewritten = op->victims.size();
+
+  const auto& latest = op->existing_manifest->latest_version();
+  if (!op->victims.empty()) {
+    auto rewrite_future = RewriteSubtree(op, latest.root, /*may_be_root=*/true,
+                                         /*inclusive_min_key=*/{},
+                                         /*subtree_common_prefix_length=*/0);
+    LinkValue(
+        [op = std::move(op)](Promise<CompactionStats> promise,
+                             ReadyFuture<RewriteResult> future) {
+          auto& rewritten = future.value();
+          const auto& latest = op->existing_manifest->latest_version();
+          BtreeGenerationReference new_generation;
+          if (!rewritten) {
+            new_generation.root = latest.root;
+            new_generation.root_height = latest.root_height;
+          } else {
+            TENSORSTORE_ASSIGN_OR_RETURN(
+                new_generation,
+                WriteRootNode(*op->io_handle, op->flush_promise,
+                              latest.root_height, std::move(*rewritten)),
+                static_cast<void>(promise.SetResult(_)));
+          }
+          CommitPhase(std::move(op), new_generation, std::move(promise));
+        },
+        std::move(promise), std::move(rewrite_future));
+    return;
+  }
+
+  if (op->options.prune_version_history ||
+      (op->options.retained_version_count &&
+       VersionRetentionWouldModify(*op->existing_manifest,
+                                   *op->options.retained_version_count))) {
+    // Nothing to rewrite, but committing a new version is still required to
+    // truncate the version history.
+    BtreeGenerationReference new_generation;
+    new_generation.root = latest.root;
+    new_generation.root_height = latest.root_height;
+    CommitPhase(std::move(op), new_generation, std::move(promise));
+    return;
+  }
+
+  GarbageCollectPhase(std::move(op), std::move(promise));
+}
+
+// State for rewriting a single leaf node, kept alive until the values moved
+// out of victim files have been re-written and the node re-encoded.
+struct LeafRewriteState
+    : public internal::AtomicReferenceCount<LeafRewriteState> {
+  CompactionOperation::Ptr op;
+  std::shared_ptr<const BtreeNode> node;
+  bool may_be_root;
+  // Full keys of the node's entries.
+  std::vector<std::string> full_keys;
+  // Value references for the re-encoded node; entries whose values are moved
+  // are replaced with the new location as each write is issued.
+  std::vector<LeafNodeValueReference> value_references;
+};
+
+void RewriteLeafNode(CompactionOperation::Ptr op,
+                     std::shared_ptr<const BtreeNode> node, bool self_victim,
+                     bool may_be_root, std::string subtree_key_prefix,
+                     Promise<RewriteResult> promise) {
+  const auto& entries = std::get<BtreeNode::LeafNodeEntries>(node->entries);
+  std::vector<size_t> moved_values;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (auto* value_ref = std::get_if<IndirectDataReference>(
+            &entries[i].value_reference);
+        value_ref &&
+        op->victims.contains(value_ref->file_id.FullPath())) {
+      moved_values.push_back(i);
+    }
+  }
+  if (!self_victim && moved_values.empty()) {
+    promise.SetResult(RewriteResult(std::nullopt));
+    return;
+  }
+
+  auto state = internal::MakeIntrusivePtr<LeafRewriteState>();
+  state->op = op;
+  state->node = std::move(node);
+  state->may_be_root = may_be_root;
+  state->full_keys.reserve(entries.size());
+  state->value_references.reserve(entries.size());
+  for (const auto& entry : entries) {
+    state->full_keys.push_back(
+        tensorstore::StrCat(subtree_key_prefix, entry.key));
+    state->value_references.push_back(entry.value_reference);
+  }
+
+  auto [values_promise, values_future] =
+      PromiseFuturePair<void>::Make(absl::OkStatus());
+  for (size_t i : moved_values) {
+    const auto& value_ref =
+        std::get<IndirectDataReference>(entries[i].value_reference);
+    Throttled(op, [state, values_promise, i, value_ref]() mutable {
+      auto read_future =
+          state->op->io_handle->ReadIndirectData(value_ref, {});
+      Link(
+          [state = std::move(state), i](
+              Promise<void> promise,
+              ReadyFuture<kvstore::ReadResult> future) {
+            TENSORSTORE_ASSIGN_OR_RETURN(
+                auto read_result, future.result(),
+                static_cast<void>(promise.SetResult(_)));
+            if (!read_result.has_value()) {
+              promise.SetResult(absl::DataLossError(
+                  "Indirect value referenced by B+tree node is missing"));
+              return;
+            }
+            auto& new_ref =
+                state->value_references[i].emplace<IndirectDataReference>();
+            state->op->flush_promise.Link(state->op->io_handle->WriteData(
+                IndirectDataKind::kValue, std::move(read_result.value),
+                new_ref));
+          },
+          std::move(values_promise), std::move(read_future));
+    });
+  }
+
+  LinkValue(
+      [state = std::move(state)](Promise<RewriteResult> promise,
+                                 ReadyFuture<const void>) {
+        BtreeLeafNodeEncoder encoder(state->op->config(), /*height=*/0,
+                                     /*existing_prefix=*/{});
+        const auto& entries =
+            std::get<BtreeNode::LeafNodeEntries>(state->node->entries);
+        for (size_t i = 0; i < entries.size(); ++i) {
+          LeafNodeEntry entry;
+          entry.key = state->full_keys[i];
+          entry.value_reference = state->value_references[i];
+          encoder.AddEntry(/*existing=*/false, std::move(entry));
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto encoded_nodes, encoder.Finalize(state->may_be_root),
+            static_cast<void>(promise.SetResult(_)));
+        promise.SetResult(RewriteResult(
+            WriteNodes(*state->op->io_handle, state->op->flush_promise,
+                       std::move(encoded_nodes))));
+      },
+      std::move(promise), std::move(values_future));
+}
+
+// State for rewriting a single interior node, kept alive until all child
+// subtrees have been processed and the node re-encoded if necessary.
+struct InteriorRewriteState
+    : public internal::AtomicReferenceCount<InteriorRewriteState> {
+  CompactionOperation::Ptr op;
+  std::shared_ptr<const BtreeNode> node;
+  bool self_victim;
+  bool may_be_root;
+  std::string subtree_key_prefix;
+  // Full keys of the node's entries.
+  std::vector<std::string> full_keys;
+  std::vector<Future<RewriteResult>> child_futures;
+};
+
+void RewriteInteriorNode(CompactionOperation::Ptr op,
+                         std::shared_ptr<const BtreeNode> node,
+                         bool self_victim, bool may_be_root,
+                         std::string subtree_key_prefix,
+                         Promise<RewriteResult> promise) {
+  const auto& entries =
+      std::get<BtreeNode::InteriorNodeEntries>(node->entries);
+  auto state = internal::MakeIntrusivePtr<InteriorRewriteState>();
+  state->op = op;
+  state->node = std::move(node);
+  state->self_victim = self_victim;
+  state->may_be_root = may_be_root;
+  state->subtree_key_prefix = std::move(subtree_key_prefix);
+  state->full_keys.reserve(entries.size());
+  state->child_futures.reserve(entries.size());
+  for (const auto& entry : entries) {
+    auto full_key =
+        tensorstore::StrCat(state->subtree_key_prefix, entry.key);
+    state->child_futures.push_back(RewriteSubtree(
+        op, entry.node, /*may_be_root=*/false, full_key,
+        static_cast<KeyLength>(state->subtree_key_prefix.size() +
+                               entry.subtree_common_prefix_length)));
+    state->full_keys.push_back(std::move(full_key));
+  }
+  std::vector<AnyFuture> futures(state->child_futures.begin(),
+                                 state->child_futures.end());
+  Link(
+      [state = std::move(state)](Promise<RewriteResult> promise,
+                                 ReadyFuture<void>) {
+        const auto& entries =
+            std::get<BtreeNode::InteriorNodeEntries>(state->node->entries);
+        bool changed = state->self_victim;
+        for (const auto& child_future : state->child_futures) {
+          auto& result = child_future.result();
+          if (!result.ok()) {
+            promise.SetResult(result.status());
+            return;
+          }
+          if (result->has_value()) changed = true;
+        }
+        if (!changed) {
+          promise.SetResult(RewriteResult(std::nullopt));
+          return;
+        }
+        RewrittenEntries combined;
+        for (size_t i = 0; i < entries.size(); ++i) {
+          const auto& child_result = *state->child_futures[i].result();
+          if (!child_result) {
+            auto& new_entry = combined.emplace_back();
+            new_entry.key = state->full_keys[i];
+            new_entry.subtree_common_prefix_length = static_cast<KeyLength>(
+                state->subtree_key_prefix.size() +
+                entries[i].subtree_common_prefix_length);
+            new_entry.node = entries[i].node;
+          } else {
+            combined.insert(combined.end(), child_result->begin(),
+                            child_result->end());
+          }
+        }
+        BtreeInteriorNodeEncoder encoder(state->op->config(),
+                                         state->node->height,
+                                         /*existing_prefix=*/{});
+        for (const auto& entry : combined) {
+          internal_ocdbt::AddNewInteriorEntry(encoder, entry);
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(
+            auto encoded_nodes, encoder.Finalize(state->may_be_root),
+            static_cast<void>(promise.SetResult(_)));
+        promise.SetResult(RewriteResult(
+            WriteNodes(*state->op->io_handle, state->op->flush_promise,
+                       std::move(encoded_nodes))));
+      },
+      std::move(promise),
+      WaitAllFuture(span<const AnyFuture>(futures)));
+}
+
+Future<RewriteResult> RewriteSubtree(CompactionOperation::Ptr op,
+                                     BtreeNodeReference node_ref,
+                                     bool may_be_root,
+                                     std::string inclusive_min_key,
+                                     KeyLength subtree_common_prefix_length) {
+  auto [promise, future] = PromiseFuturePair<RewriteResult>::Make();
+  Throttled(
+      op, [op, node_ref, may_be_root,
+           inclusive_min_key = std::move(inclusive_min_key),
+           subtree_common_prefix_length,
+           promise = std::move(promise)]() mutable {
+        auto read_future = op->io_handle->GetBtreeNode(node_ref.location);
+        auto executor = op->io_handle->executor;
+        Link(WithExecutor(
+                 std::move(executor),
+                 [op = std::move(op), node_ref, may_be_root,
+                  inclusive_min_key = std::move(inclusive_min_key),
+                  subtree_common_prefix_length](
+                     Promise<RewriteResult> promise,
+                     ReadyFuture<const std::shared_ptr<const BtreeNode>>
+                         future) mutable {
+                   TENSORSTORE_ASSIGN_OR_RETURN(
+                       auto node, future.result(),
+                       static_cast<void>(promise.SetResult(_)));
+                   auto& subtree_key_prefix = inclusive_min_key;
+                   subtree_key_prefix.resize(subtree_common_prefix_length);
+                   subtree_key_prefix += node->key_prefix;
+                   const bool self_victim = op->victims.contains(
+                       node_ref.location.file_id.FullPath());
+                   if (node->height == 0) {
+                     RewriteLeafNode(std::move(op), std::move(node),
+                                     self_victim, may_be_root,
+                                     std::move(subtree_key_prefix),
+                                     std::move(promise));
+                   } else {
+                     RewriteInteriorNode(std::move(op), std::move(node),
+                                         self_victim, may_be_root,
+                                         std::move(subtree_key_prefix),
+                                         std::move(promise));
+                   }
+                 }),
+             std::move(promise), std::move(read_future));
+      });
+  return std::move(future);
+}
+
+// Returns a manifest containing only `new_generation`, assigned the next
+// generation number.  This is valid because version tree leaf node entries
+// are merely required to lie within the leaf node generation range of the
+// latest generation; subsequent commits extend the history normally.
+Result<std::shared_ptr<Manifest>> CreatePrunedManifest(
+    const Manifest& existing, BtreeGenerationReference new_generation) {
+  auto commit_time = absl::Now();
+  // Ensure that `commit_time` is monotonically increasing.
+  commit_time = std::max(
+      commit_time,
+      static_cast<absl::Time>(existing.latest_version().commit_time) +
+          absl::Nanoseconds(1));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      new_generation.commit_time, CommitTime::FromAbslTime(commit_time),
+      internal::ConvertInvalidArgumentToFailedPrecondition(_));
+  const GenerationNumber existing_generation = existing.latest_generation();
+  if (existing_generation >=
+      std::numeric_limits<GenerationNumber>::max() - 1) {
+    // Should not occur.
+    return absl::FailedPreconditionError(
+        absl::StrFormat("Existing generation number is already at maximum: %d",
+                        existing_generation));
+  }
+  new_generation.generation_number = existing_generation + 1;
+  auto new_manifest = std::make_shared<Manifest>();
+  new_manifest->config = existing.config;
+  new_manifest->versions.push_back(new_generation);
+  return new_manifest;
+}
+
+// Drops versions older than the `retained_version_count` most recent from
+// `manifest`.
+//
+// The structure of the version tree is determined entirely by the latest
+// generation number and `version_tree_arity_log2`, and skipped generations do
+// not affect it (see `create_new_manifest.cc`); subtrees of dropped versions
+// may therefore simply be omitted from the manifest.  To avoid rewriting
+// version tree nodes, versions are dropped at node granularity: a referenced
+// subtree is retained until every generation within it is older than the
+// retained range.
+void ApplyVersionRetention(Manifest& manifest,
+                           uint64_t retained_version_count) {
+  const GenerationNumber latest_generation = manifest.latest_generation();
+  if (latest_generation <= retained_version_count) return;
+  const GenerationNumber min_retained =
+      latest_generation - retained_version_count + 1;
+  auto& nodes = manifest.version_tree_nodes;
+  // `version_tree_nodes` is ordered oldest first, and
+  // `VersionNodeReference::generation_number` is the last generation within
+  // the subtree.
+  nodes.erase(nodes.begin(),
+              std::find_if(nodes.begin(), nodes.end(),
+                           [&](const VersionNodeReference& node_ref) {
+                             return node_ref.generation_number >= min_retained;
+                           }));
+  auto& versions = manifest.versions;
+  versions.erase(
+      versions.begin(),
+      std::find_if(versions.begin(), versions.end(),
+                   [&](const BtreeGenerationReference& version) {
+                     return version.generation_number >= min_retained;
+                   }));
+  assert(!versions.empty());
+}
+
+// Returns `true` if committing a new generation with
+// `ApplyVersionRetention` applied would drop any version from `existing`.
+bool VersionRetentionWouldModify(const Manifest& existing,
+                                 uint64_t retained_version_count) {
+  const GenerationNumber new_generation = existing.latest_generation() + 1;
+  if (new_generation <= retained_version_count) return false;
+  const GenerationNumber min_retained =
+      new_generation - retained_version_count + 1;
+  if (!existing.version_tree_nodes.empty() &&
+      existing.version_tree_nodes.front().generation_number < min_retained) {
+    return true;
+  }
+  return existing.versions.front().generation_number < min_retained;
+}
+
+void FlushAndWriteManifest(CompactionOperation::Ptr op,
+                           Promise<CompactionStats> promise) {
+  auto flush_future = std::move(op->flush_promise).future();
+  if (flush_future.null()) {
+    WriteManifestPhase(std::move(op), std::move(promise));
+    return;
+  }
+  flush_future.Force();
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<const void>) {
+        WriteManifestPhase(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(flush_future));
+}
+
+void CommitPhase(CompactionOperation::Ptr op,
+                 BtreeGenerationReference new_generation,
+                 Promise<CompactionStats> promise) {
+  if (op->options.prune_version_history) {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        op->new_manifest,
+        CreatePrunedManifest(*op->existing_manifest, new_generation),
+        static_cast<void>(promise.SetResult(_)));
+    FlushAndWriteManifest(std::move(op), std::move(promise));
+    return;
+  }
+  auto create_future = internal_ocdbt::CreateNewManifest(
+      op->io_handle, op->existing_manifest, new_generation);
+  LinkValue(
+      [op = std::move(op)](
+          Promise<CompactionStats> promise,
+          ReadyFuture<std::pair<std::shared_ptr<Manifest>,
+                                Future<const void>>>
+              future) {
+        auto& create_result = future.value();
+        op->new_manifest = std::move(create_result.first);
+        op->flush_promise.Link(std::move(create_result.second));
+        if (op->options.retained_version_count) {
+          ApplyVersionRetention(*op->new_manifest,
+                                *op->options.retained_version_count);
+        }
+        FlushAndWriteManifest(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(create_future));
+}
+
+void WriteManifestPhase(CompactionOperation::Ptr op,
+                        Promise<CompactionStats> promise) {
+  auto update_future = op->io_handle->TryUpdateManifest(
+      op->existing_manifest, op->new_manifest, absl::Now());
+  update_future.Force();
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<TryUpdateManifestResult> future) {
+        if (!future.value().success) {
+          // The rewritten tree is derived from the starting manifest; merging
+          // with a concurrent commit is not possible.  The database is
+          // unmodified and the compaction may simply be retried.
+          promise.SetResult(absl::AbortedError(
+              "Database was concurrently modified during compaction"));
+          return;
+        }
+        op->stats.committed_new_version = true;
+        GarbageCollectPhase(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(update_future));
+}
+
+// Marks the data file containing `ref` as referenced, and returns `false` if
+// the node at `ref` has already been visited.
+bool MarkReferencedNode(CompactionOperation& op,
+                        const IndirectDataReference& ref) {
+  absl::MutexLock lock(&op.mutex);
+  op.referenced.insert(ref.file_id.FullPath());
+  return op.visited.insert(ref.EncodeCacheKey()).second;
+}
+
+void VisitBtreeForReferences(CompactionOperation::Ptr op,
+                             Promise<void> promise,
+                             IndirectDataReference ref) {
+  if (!MarkReferencedNode(*op, ref)) return;
+  Throttled(op, [op, promise = std::move(promise), ref]() mutable {
+    auto read_future = op->io_handle->GetBtreeNode(ref);
+    auto executor = op->io_handle->executor;
+    Link(WithExecutor(
+             std::move(executor),
+             [op = std::move(op)](
+                 Promise<void> promise,
+                 ReadyFuture<const std::shared_ptr<const BtreeNode>> future) {
+               TENSORSTORE_ASSIGN_OR_RETURN(
+                   auto node, future.result(),
+                   static_cast<void>(promise.SetResult(_)));
+               if (node->height > 0) {
+                 for (const auto& entry :
+                      std::get<BtreeNode::InteriorNodeEntries>(
+                          node->entries)) {
+                   VisitBtreeForReferences(op, promise, entry.node.location);
+                 }
+               } else {
+                 absl::MutexLock lock(&op->mutex);
+                 for (const auto& entry :
+                      std::get<BtreeNode::LeafNodeEntries>(node->entries)) {
+                   if (auto* value_ref = std::get_if<IndirectDataReference>(
+                           &entry.value_reference)) {
+                     op->referenced.insert(value_ref->file_id.FullPath());
+                   }
+                 }
+               }
+             }),
+         std::move(promise), std::move(read_future));
+  });
+}
+
+void VisitVersionTreeForReferences(CompactionOperation::Ptr op,
+                                   Promise<void> promise,
+                                   IndirectDataReference ref) {
+  if (!MarkReferencedNode(*op, ref)) return;
+  Throttled(op, [op, promise = std::move(promise), ref]() mutable {
+    auto read_future = op->io_handle->GetVersionTreeNode(ref);
+    auto executor = op->io_handle->executor;
+    Link(WithExecutor(
+             std::move(executor),
+             [op = std::move(op)](
+                 Promise<void> promise,
+                 ReadyFuture<const std::shared_ptr<const VersionTreeNode>>
+                     future) {
+               TENSORSTORE_ASSIGN_OR_RETURN(
+                   auto node, future.result(),
+                   static_cast<void>(promise.SetResult(_)));
+               if (auto* children =
+                       std::get_if<VersionTreeNode::InteriorNodeEntries>(
+                           &node->entries)) {
+                 for (const auto& child : *children) {
+                   VisitVersionTreeForReferences(op, promise, child.location);
+                 }
+               } else {
+                 for (const auto& version :
+                      std::get<VersionTreeNode::LeafNodeEntries>(
+                          node->entries)) {
+                   if (version.root.location.IsMissing()) continue;
+                   VisitBtreeForReferences(op, promise,
+                                           version.root.location);
+                 }
+               }
+             }),
+         std::move(promise), std::move(read_future));
+  });
+}
+
+void GarbageCollectPhase(CompactionOperation::Ptr op,
+                         Promise<CompactionStats> promise) {
+  if (!op->options.delete_unreferenced_files) {
+    promise.SetResult(op->stats);
+    return;
+  }
+  const auto& manifest =
+      op->new_manifest ? *op->new_manifest : *op->existing_manifest;
+  auto [traversal_promise, traversal_future] =
+      PromiseFuturePair<void>::Make(absl::OkStatus());
+  for (const auto& version : manifest.versions) {
+    if (version.root.location.IsMissing()) continue;
+    VisitBtreeForReferences(op, traversal_promise, version.root.location);
+  }
+  for (const auto& node_ref : manifest.version_tree_nodes) {
+    VisitVersionTreeForReferences(op, traversal_promise, node_ref.location);
+  }
+  traversal_promise = Promise<void>();
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<const void>) {
+        DeleteUnreferencedFiles(std::move(op), std::move(promise));
+      },
+      std::move(promise), std::move(traversal_future));
+}
+
+void DeleteUnreferencedFiles(CompactionOperation::Ptr op,
+                             Promise<CompactionStats> promise) {
+  auto [delete_promise, delete_future] =
+      PromiseFuturePair<void>::Make(absl::OkStatus());
+  absl::MutexLock lock(&op->mutex);
+  for (const auto& [path, size] : op->data_file_sizes) {
+    if (op->referenced.contains(path)) continue;
+    ++op->stats.num_data_files_deleted;
+    if (size > 0) op->stats.num_bytes_deleted += size;
+    ABSL_LOG_IF(INFO, ocdbt_logging)
+        << "Compaction: deleting unreferenced data file "
+        << tensorstore::QuoteString(path);
+    Throttled(op, [op, delete_promise, path = path]() mutable {
+      LinkError(std::move(delete_promise), kvstore::Delete(op->base, path));
+    });
+  }
+  delete_promise = Promise<void>();
+  LinkValue(
+      [op = std::move(op)](Promise<CompactionStats> promise,
+                           ReadyFuture<const void>) {
+        promise.SetResult(op->stats);
+      },
+      std::move(promise), std::move(delete_future));
+}
+
+}  // namespace
+
+Future<CompactionStats> CompactDatabase(IoHandle::Ptr io_handle, KvStore base,
+                                        CompactionOptions options) {
+  if (options.live_fraction_threshold < 0 ||
+      options.live_fraction_threshold > 1) {
+    return absl::InvalidArgumentError(
+        tensorstore::StrCat("Invalid live_fraction_threshold: ",
+                            options.live_fraction_threshold));
+  }
+  if (options.retained_version_count &&
+      *options.retained_version_count == 0) {
+    return absl::InvalidArgumentError(
+        "retained_version_count must be positive");
+  }
+  auto op = internal::MakeIntrusivePtr<CompactionOperation>();
+  op->io_handle = std::move(io_handle);
+  op->base = std::move(base);
+  op->options = std::move(options);
+  auto [promise, future] = PromiseFuturePair<CompactionStats>::Make();
+  ListDataFilesPhase(std::move(op), std::move(promise));
+  return std::move(future);
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
@@ -0,0 +1,137 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_COMPACTION_COMPACTION_H_
+#define TENSORSTORE_KVSTORE_OCDBT_COMPACTION_COMPACTION_H_
+
+#include <stdint.h>
+
+#include <optional>
+
+#include "tensorstore/internal/rate_limiter/rate_limiter.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/io/io_handle_impl.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Options for `CompactDatabase`.
+struct CompactionOptions {
+  /// Prefixes under which data files are stored, relative to the base kvstore.
+  ///
+  /// Must match the prefixes with which the database was written.
+  DataFilePrefixes data_file_prefixes;
+
+  /// Data files for which the fraction of bytes referenced by the latest
+  /// B+tree version is positive but below this threshold are rewritten: the
+  /// live B+tree nodes and out-of-line values they contain are re-written to
+  /// new data files and a new version referencing the copies is committed.
+  ///
+  /// A value of `0` disables rewriting, leaving only the deletion of
+  /// unreferenced data files.
+  double live_fraction_threshold = 0.5;
+
+  /// Retains only the version committed by the compaction, rather than the
+  /// full version history.  Rewritten data files are referenced by older
+  /// versions and can only be deleted once no retained version references
+  /// them, so reclaiming their space requires discarding the older versions.
+  ///
+  /// Reads of discarded versions subsequently fail.
+  bool prune_version_history = false;
+
+  /// Retains only the most recent `retained_version_count` versions in the
+  /// committed manifest, bounding both the size of the manifest readers must
+  /// fetch and the depth of the version tree that version resolution must
+  /// walk.  Must be positive if specified.  Ignored if
+  /// `prune_version_history` is specified, which retains only a single
+  /// version.
+  ///
+  /// Versions are dropped at version tree node granularity: a referenced
+  /// subtree is retained until every version within it falls outside the
+  /// retained range, so somewhat more than the requested number of versions
+  /// may remain.  Reads of dropped versions subsequently fail, and data
+  /// files referenced only by dropped versions become eligible for
+  /// `delete_unreferenced_files`.
+  std::optional<uint64_t> retained_version_count;
+
+  /// Deletes data files that are not referenced by any retained version after
+  /// the compacted version has been committed.
+  ///
+  /// Note: Data files are written before the manifest that references them.
+  /// Only files observed before the compaction started are considered for
+  /// deletion, but a commit that was already in progress at that point may
+  /// reference such a file; deletion must therefore not be enabled while
+  /// other writers are active.
+  bool delete_unreferenced_files = false;
+
+  /// Optional rate limiter through which every read, write and delete
+  /// operation issued by the compaction is admitted, so that a large
+  /// compaction can run against a live database without monopolizing storage
+  /// IO.  If `nullptr`, operations are issued without throttling.
+  ///
+  /// The limiter must remain valid until the future returned by
+  /// `CompactDatabase` becomes ready.
+  internal::RateLimiter* rate_limiter = nullptr;
+};
+
+/// Statistics returned by a successful `CompactDatabase` call.
+struct CompactionStats {
+  /// Number of data files observed under `data_file_prefixes`.
+  uint64_t num_data_files = 0;
+
+  /// Number of data files whose live references were rewritten.
+  uint64_t num_data_files_rewritten = 0;
+
+  /// Number of unreferenced data files deleted.
+  uint64_t num_data_files_deleted = 0;
+
+  /// Total size of the deleted data files.
+  uint64_t num_bytes_deleted = 0;
+
+  /// Indicates whether a new version was committed.  `false` if no data file
+  /// was sufficiently sparse to require rewriting.
+  bool committed_new_version = false;
+};
+
+/// Compacts the database and deletes orphaned data files.
+///
+/// Deleted or superseded values leave dead bytes in existing data files, since
+/// data files are immutable; over time a database can grow to many times its
+/// live size.  This walks the latest B+tree version, rewrites the live
+/// contents of sparsely-referenced data files, and commits a new version that
+/// references the copies.  The commit is atomic: concurrent writers are not
+/// disturbed, and if the database is modified concurrently the compaction
+/// fails with `kAborted` without modifying the database (callers may simply
+/// retry).  Optionally, data files referenced by no retained version are then
+/// deleted, subject to the caveat on
+/// `CompactionOptions::delete_unreferenced_files`.
+///
+/// Bloom filters embedded in interior nodes (as written by the bulk load
+/// path) are not regenerated for rewritten nodes.
+///
+/// Args:
+///   io_handle: `IoHandle` for the database.
+///   base: Base kvstore of the database (the root under which
+///     `options.data_file_prefixes` and the manifest reside), used to list and
+///     delete data files.
+///   options: Compaction options.
+Future<CompactionStats> CompactDatabase(IoHandle::Ptr io_handle, KvStore base,
+                                        CompactionOptions options);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_COMPACTION_COMPACTION_H_
@@ -0,0 +1,244 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/compaction/compaction.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/driver.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/list_versions.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/read_version.h"
+#include "tensorstore/kvstore/ocdbt/test_util.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::Context;
+using ::tensorstore::KeyRange;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+using ::tensorstore::internal_ocdbt::CompactDatabase;
+using ::tensorstore::internal_ocdbt::CompactionOptions;
+using ::tensorstore::internal_ocdbt::GenerationNumber;
+using ::tensorstore::internal_ocdbt::GetOcdbtIoHandle;
+using ::tensorstore::internal_ocdbt::ListVersionsFuture;
+using ::tensorstore::internal_ocdbt::OcdbtDriver;
+using ::tensorstore::internal_ocdbt::ReadVersion;
+
+// Opens an OCDBT database over a memory kvstore shared with `context`, with
+// all values stored out-of-line.
+tensorstore::Result<kvstore::KvStore> OpenStore(const Context& context) {
+  return kvstore::Open({{"driver", "ocdbt"},
+                        {"base", "memory://"},
+                        {"config", {{"max_inline_value_bytes", 0}}}},
+                       context)
+      .result();
+}
+
+CompactionOptions GetOptions(const kvstore::KvStore& store) {
+  CompactionOptions options;
+  options.data_file_prefixes =
+      static_cast<OcdbtDriver&>(*store.driver).data_file_prefixes_;
+  return options;
+}
+
+// Returns the total size of the data files of `store`.
+int64_t GetTotalDataFileBytes(const kvstore::KvStore& store) {
+  auto& base = static_cast<OcdbtDriver&>(*store.driver).base_;
+  kvstore::ListOptions list_options;
+  list_options.range = KeyRange::Prefix("d/");
+  TENSORSTORE_CHECK_OK_AND_ASSIGN(
+      auto entries, kvstore::ListFuture(base, std::move(list_options)).result());
+  int64_t total = 0;
+  for (const auto& entry : entries) total += entry.size;
+  return total;
+}
+
+TEST(CompactionTest, RewritesSparseDataFilesAndDeletesUnreferenced) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore(context));
+
+  // Write a batch of values in a single commit, so that they are packed into
+  // a common data file.
+  auto transaction = tensorstore::Transaction(tensorstore::atomic_isolated);
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto transactional_store,
+                                     store | transaction);
+    for (int i = 0; i < 20; ++i) {
+      TENSORSTORE_ASSERT_OK(
+          kvstore::Write(transactional_store, absl::StrFormat("key%02d", i),
+                         absl::Cord(absl::StrFormat("initial%02d", i))));
+    }
+    TENSORSTORE_ASSERT_OK(transaction.CommitAsync());
+  }
+
+  // Overwrite most of the values, leaving the shared data file mostly dead.
+  for (int i = 0; i < 15; ++i) {
+    TENSORSTORE_ASSERT_OK(
+        kvstore::Write(store, absl::StrFormat("key%02d", i),
+                       absl::Cord(absl::StrFormat("updated%02d", i))));
+  }
+
+  const int64_t size_before = GetTotalDataFileBytes(store);
+
+  auto options = GetOptions(store);
+  options.prune_version_history = true;
+  options.delete_unreferenced_files = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats,
+      CompactDatabase(GetOcdbtIoHandle(*store.driver),
+                      static_cast<OcdbtDriver&>(*store.driver).base_, options)
+          .result());
+  EXPECT_TRUE(stats.committed_new_version);
+  EXPECT_GE(stats.num_data_files_rewritten, 1);
+  EXPECT_GT(stats.num_data_files_deleted, 0);
+  EXPECT_GT(stats.num_bytes_deleted, 0);
+
+  // All current values remain readable.
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_THAT(
+        kvstore::Read(store, absl::StrFormat("key%02d", i)).result(),
+        MatchesKvsReadResult(absl::Cord(
+            absl::StrFormat(i < 15 ? "updated%02d" : "initial%02d", i))));
+  }
+
+  // The database shrank.
+  EXPECT_LT(GetTotalDataFileBytes(store), size_before);
+}
+
+TEST(CompactionTest, DeletesOrphanedDataFiles) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore(context));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "a", absl::Cord("value_a")));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(store, "b", absl::Cord("value_b")));
+
+  // Simulate a data file left behind by a failed commit.
+  auto& base = static_cast<OcdbtDriver&>(*store.driver).base_;
+  const std::string orphan_key = "d/0123456789abcdef0123456789abcdef";
+  TENSORSTORE_ASSERT_OK(
+      kvstore::Write(base, orphan_key, absl::Cord("orphaned data")));
+
+  auto options = GetOptions(store);
+  options.live_fraction_threshold = 0;
+  options.delete_unreferenced_files = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats,
+      CompactDatabase(GetOcdbtIoHandle(*store.driver), base, options)
+          .result());
+  EXPECT_FALSE(stats.committed_new_version);
+  EXPECT_EQ(0, stats.num_data_files_rewritten);
+  EXPECT_EQ(1, stats.num_data_files_deleted);
+
+  EXPECT_THAT(kvstore::Read(base, orphan_key).result(),
+              MatchesKvsReadResultNotFound());
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value_a")));
+  EXPECT_THAT(kvstore::Read(store, "b").result(),
+              MatchesKvsReadResult(absl::Cord("value_b")));
+}
+
+TEST(CompactionTest, EmptyDatabase) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore(context));
+  auto options = GetOptions(store);
+  options.delete_unreferenced_files = true;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats,
+      CompactDatabase(GetOcdbtIoHandle(*store.driver),
+                      static_cast<OcdbtDriver&>(*store.driver).base_, options)
+          .result());
+  EXPECT_EQ(0, stats.num_data_files);
+  EXPECT_FALSE(stats.committed_new_version);
+}
+
+TEST(CompactionTest, VersionRetention) {
+  auto context = Context::Default();
+  // Use the minimum version tree arity so that a modest number of commits
+  // produces version tree nodes.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store, kvstore::Open({{"driver", "ocdbt"},
+                                 {"base", "memory://"},
+                                 {"config", {{"version_tree_arity_log2", 1}}}},
+                                context)
+                      .result());
+  for (int i = 0; i < 30; ++i) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, absl::StrFormat("key%02d", i),
+                                         absl::Cord("value")));
+  }
+
+  auto io_handle = GetOcdbtIoHandle(*store.driver);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto versions_before,
+                                   ListVersionsFuture(io_handle).result());
+  ASSERT_EQ(30, versions_before.size());
+
+  auto options = GetOptions(store);
+  options.retained_version_count = 4;
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto stats,
+      CompactDatabase(io_handle,
+                      static_cast<OcdbtDriver&>(*store.driver).base_, options)
+          .result());
+  EXPECT_TRUE(stats.committed_new_version);
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto versions_after,
+                                   ListVersionsFuture(io_handle).result());
+  // Versions are dropped at version tree node granularity, so slightly more
+  // than the requested number may remain.
+  EXPECT_GE(versions_after.size(), 4);
+  EXPECT_LE(versions_after.size(), 8);
+  EXPECT_EQ(31, versions_after.back().generation_number);
+
+  // Dropped versions can no longer be resolved.
+  EXPECT_THAT(ReadVersion(io_handle, GenerationNumber(1)).result(),
+              MatchesStatus(absl::StatusCode::kNotFound));
+
+  // Current values remain readable.
+  EXPECT_THAT(kvstore::Read(store, "key00").result(),
+              MatchesKvsReadResult(absl::Cord("value")));
+}
+
+TEST(CompactionTest, InvalidLiveFractionThreshold) {
+  auto context = Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore(context));
+  auto options = GetOptions(store);
+  options.live_fraction_threshold = 1.5;
+  EXPECT_THAT(
+      CompactDatabase(GetOcdbtIoHandle(*store.driver),
+                      static_cast<OcdbtDriver&>(*store.driver).base_, options)
+          .result(),
+      MatchesStatus(absl::StatusCode::kInvalidArgument,
+                    "Invalid live_fraction_threshold: .*"));
+}
+
+}  // namespace
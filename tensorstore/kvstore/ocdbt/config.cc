@@ -62,6 +62,7 @@ constexpr auto ManifestKindJsonBinder = [](auto is_loading, const auto& options,
   return jb::Enum<ManifestKind, std::string_view>({
       {ManifestKind::kSingle, "single"},
       {ManifestKind::kNumbered, "numbered"},
+      {ManifestKind::kNumberedDelta, "numbered_delta"},
   })(is_loading, options, obj, j);
 };
 
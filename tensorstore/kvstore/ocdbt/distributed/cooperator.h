@@ -16,6 +16,7 @@
 #define TENSORSTORE_KVSTORE_OCDBT_DISTRIBUTED_COOPERATOR_H_
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +26,8 @@
 #include "tensorstore/kvstore/ocdbt/distributed/btree_node_identifier.h"
 #include "tensorstore/kvstore/ocdbt/distributed/btree_node_write_mutation.h"
 #include "tensorstore/kvstore/ocdbt/distributed/rpc_security.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
 #include "tensorstore/kvstore/ocdbt/format/manifest.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
 #include "tensorstore/kvstore/ocdbt/io_handle.h"
@@ -101,6 +104,18 @@ Future<MutationBatchResponse> SubmitMutationBatch(
     Cooperator& coop, internal_ocdbt::BtreeNodeIdentifier&& identifier,
     MutationBatchRequest&& batch_request);
 
+// Reads the B+tree node at `ref`, requesting the cached encoded
+// representation from the cooperator known (from the local lease cache) to
+// own a lease on `identifier`, if any.
+//
+// No lease is acquired: if no lease for `identifier` has been queried, or the
+// peer request fails, the node is read from the base kvstore instead.  This
+// is safe because nodes are immutable and identified by their location.
+Future<const std::shared_ptr<const internal_ocdbt::BtreeNode>>
+GetBtreeNodeFromPeer(Cooperator& coop,
+                     const internal_ocdbt::IndirectDataReference& ref,
+                     internal_ocdbt::BtreeNodeIdentifier&& identifier);
+
 }  // namespace internal_ocdbt_cooperator
 }  // namespace tensorstore
 
@@ -305,8 +305,12 @@ void NodeCommitOperation::VisitNodeReference(
   commit_op->node_generation = internal_ocdbt::ComputeStorageGeneration(
       node_ref.location, commit_op->key_prefix);
 
-  auto read_future =
-      commit_op->server->io_handle_->GetBtreeNode(node_ref.location);
+  // If another cooperator is known to own a lease on this node, request the
+  // node bytes from its cache rather than from the base kvstore.
+  auto read_future = GetBtreeNodeFromPeer(
+      *commit_op->server, node_ref.location,
+      BtreeNodeIdentifier{static_cast<BtreeNodeHeight>(commit_op->height),
+                          commit_op->key_range});
   auto executor = commit_op->server->io_handle_->executor;
   std::move(read_future)
       .ExecuteWhenReady(WithExecutor(
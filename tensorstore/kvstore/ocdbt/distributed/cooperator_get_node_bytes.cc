@@ -0,0 +1,188 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/distributed/cooperator.h"
+// Part of the Cooperator interface
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/log/absl_log.h"
+#include "absl/strings/cord.h"
+#include "grpcpp/client_context.h"  // third_party
+#include "grpcpp/support/server_callback.h"  // third_party
+#include "grpcpp/support/status.h"  // third_party
+#include "tensorstore/internal/grpc/utils.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/ocdbt/distributed/btree_node_identifier.h"
+#include "tensorstore/kvstore/ocdbt/distributed/cooperator_impl.h"
+#include "tensorstore/kvstore/ocdbt/distributed/lease_cache_for_cooperator.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt_cooperator {
+
+using internal_ocdbt::BtreeNode;
+using internal_ocdbt::IndirectDataReference;
+
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+// Requests the encoded node bytes from the cooperator that owns `lease`,
+// falling back to reading from the base kvstore if the request fails.
+//
+// Because nodes are immutable and identified by their location, a failed or
+// unavailable peer never affects correctness, only the number of base
+// kvstore reads.
+void GetNodeBytesFromPeer(
+    Promise<std::shared_ptr<const BtreeNode>> promise,
+    internal::IntrusivePtr<Cooperator> server,
+    LeaseCacheForCooperator::LeaseNode::Ptr lease,
+    const IndirectDataReference& ref) {
+  struct RequestState : public internal::AtomicReferenceCount<RequestState> {
+    std::shared_ptr<grpc::ClientContext> client_context;
+    internal::IntrusivePtr<Cooperator> server;
+    LeaseCacheForCooperator::LeaseNode::Ptr lease;
+    IndirectDataReference ref;
+    grpc_gen::GetBtreeNodeBytesRequest request;
+    grpc_gen::GetBtreeNodeBytesResponse response;
+  };
+
+  auto state = internal::MakeIntrusivePtr<RequestState>();
+  state->client_context = std::make_shared<grpc::ClientContext>();
+  state->server = std::move(server);
+  state->lease = std::move(lease);
+  state->ref = ref;
+  state->request.set_location(ref.EncodeCacheKey());
+
+  auto state_ptr = state.get();
+  LinkValue(
+      [state = std::move(state)](
+          Promise<std::shared_ptr<const BtreeNode>> promise,
+          ReadyFuture<std::shared_ptr<grpc::ClientContext>> context_result) {
+        auto state_ptr = state.get();
+        state_ptr->lease->peer_stub->async()->GetBtreeNodeBytes(
+            state_ptr->client_context.get(), &state_ptr->request,
+            &state_ptr->response,
+            WithExecutor(
+                state_ptr->server->io_handle_->executor,
+                [state = std::move(state),
+                 promise = std::move(promise)](::grpc::Status s) {
+                  auto status = internal::GrpcStatusToAbslStatus(s);
+                  if (status.ok()) {
+                    auto node = internal_ocdbt::DecodeBtreeNode(
+                        absl::Cord(state->response.data()),
+                        state->ref.file_id.base_path);
+                    if (node.ok()) {
+                      promise.SetResult(
+                          std::make_shared<BtreeNode>(*std::move(node)));
+                      return;
+                    }
+                    status = std::move(node).status();
+                  }
+                  ABSL_LOG_IF(INFO, ocdbt_logging)
+                      << "GetBtreeNodeBytes from peer failed: " << status
+                      << "; falling back to direct read";
+                  LinkResult(std::move(promise),
+                             state->server->io_handle_->GetBtreeNode(
+                                 state->ref));
+                }));
+      },
+      std::move(promise),
+      state_ptr->server->security_->GetClientAuthenticationStrategy()
+          ->ConfigureContext(state_ptr->client_context));
+}
+
+}  // namespace
+
+Future<const std::shared_ptr<const BtreeNode>> GetBtreeNodeFromPeer(
+    Cooperator& coop, const IndirectDataReference& ref,
+    internal_ocdbt::BtreeNodeIdentifier&& identifier) {
+  auto* lease_cache = coop.lease_cache();
+  if (!lease_cache) {
+    return coop.io_handle_->GetBtreeNode(ref);
+  }
+  // Only an already-queried lease is consulted; acquiring a lease just for a
+  // read would add a coordinator round trip for every node.
+  auto lease_future =
+      lease_cache->FindLease(identifier.GetKey(coop.storage_identifier_));
+  if (lease_future.null()) {
+    return coop.io_handle_->GetBtreeNode(ref);
+  }
+  auto [promise, future] =
+      PromiseFuturePair<std::shared_ptr<const BtreeNode>>::Make();
+  lease_future.ExecuteWhenReady(
+      [server = CooperatorPtr(&coop), ref, promise = std::move(promise)](
+          ReadyFuture<const LeaseCacheForCooperator::LeaseNode::Ptr>
+              future) mutable {
+        auto& r = future.result();
+        if (!r.ok() || !(*r)->peer_stub) {
+          // Either the lease query failed or this cooperator owns the lease;
+          // in both cases read from the base kvstore.
+          LinkResult(std::move(promise),
+                     server->io_handle_->GetBtreeNode(ref));
+          return;
+        }
+        GetNodeBytesFromPeer(std::move(promise), std::move(server), *r, ref);
+      });
+  return std::move(future);
+}
+
+grpc::ServerUnaryReactor* Cooperator::GetBtreeNodeBytes(
+    grpc::CallbackServerContext* context,
+    const grpc_gen::GetBtreeNodeBytesRequest* request,
+    grpc_gen::GetBtreeNodeBytesResponse* response) {
+  auto* reactor = context->DefaultReactor();
+
+  if (!internal::IncrementReferenceCountIfNonZero(*this)) {
+    // Shutting down
+    reactor->Finish(
+        grpc::Status(grpc::StatusCode::CANCELLED, "Cooperator shutting down"));
+    return reactor;
+  }
+  internal::IntrusivePtr<Cooperator> self(this, internal::adopt_object_ref);
+
+  IndirectDataReference ref;
+  if (!ref.DecodeCacheKey(request->location())) {
+    reactor->Finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                 "Invalid node location"));
+    return reactor;
+  }
+
+  // No lease check: nodes are immutable and identified by their location, so
+  // the response is correct regardless of lease ownership.
+  auto read_future = io_handle_->GetBtreeNodeEncoded(ref);
+  std::move(read_future)
+      .ExecuteWhenReady([self = std::move(self), reactor,
+                         response](ReadyFuture<const absl::Cord> future) {
+        auto& r = future.result();
+        if (!r.ok()) {
+          reactor->Finish(internal::AbslStatusToGrpcStatus(r.status()));
+          return;
+        }
+        response->set_data(std::string(*r));
+        reactor->Finish(grpc::Status::OK);
+      });
+  return reactor;
+}
+
+}  // namespace internal_ocdbt_cooperator
+}  // namespace tensorstore
@@ -96,6 +96,11 @@ struct Cooperator : public grpc_gen::Cooperator::CallbackService,
                                   const grpc_gen::WriteRequest* request,
                                   grpc_gen::WriteResponse* response) override;
 
+  grpc::ServerUnaryReactor* GetBtreeNodeBytes(
+      grpc::CallbackServerContext* context,
+      const grpc_gen::GetBtreeNodeBytesRequest* request,
+      grpc_gen::GetBtreeNodeBytesResponse* response) override;
+
   internal::IntrusivePtr<NodeMutationRequests> GetNodeMutationRequests(
       const LeaseCacheForCooperator::LeaseNode& lease_node,
       internal_ocdbt::BtreeNodeHeight node_height);
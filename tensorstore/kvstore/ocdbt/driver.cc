@@ -166,6 +166,13 @@ TENSORSTORE_DEFINE_JSON_DEFAULT_BINDER(
         jb::Member(
             "target_data_file_size",
             jb::Projection<&OcdbtDriverSpecData::target_data_file_size>()),
+        jb::Member(
+            "data_file_write_alignment",
+            jb::Projection<&OcdbtDriverSpecData::data_file_write_alignment>(
+                jb::Optional(jb::Integer<size_t>(1)))),
+        jb::Member(
+            "data_file_flush_interval",
+            jb::Projection<&OcdbtDriverSpecData::data_file_flush_interval>()),
         jb::Member("coordinator",
                    jb::Projection<&OcdbtDriverSpecData::coordinator>()),
         jb::Member(internal::CachePoolResource::id,
@@ -206,6 +213,10 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
         driver->experimental_read_coalescing_interval_ =
             spec->data_.experimental_read_coalescing_interval;
         driver->target_data_file_size_ = spec->data_.target_data_file_size;
+        driver->data_file_write_alignment_ =
+            spec->data_.data_file_write_alignment;
+        driver->data_file_flush_interval_ =
+            spec->data_.data_file_flush_interval;
 
         std::optional<ReadCoalesceOptions> read_coalesce_options;
         if (driver->experimental_read_coalescing_threshold_bytes_ ||
@@ -237,6 +248,9 @@ Future<kvstore::DriverPtr> OcdbtDriverSpec::DoOpen() const {
                                              : driver->base_,
             std::move(config_state), driver->data_file_prefixes_,
             driver->target_data_file_size_.value_or(kDefaultTargetBufferSize),
+            driver->data_file_write_alignment_.value_or(1),
+            driver->data_file_flush_interval_.value_or(
+                absl::InfiniteDuration()),
             std::move(read_coalesce_options));
         driver->btree_writer_ =
             MakeNonDistributedBtreeWriter(driver->io_handle_);
@@ -300,6 +314,8 @@ absl::Status OcdbtDriver::GetBoundSpecData(OcdbtDriverSpecData& spec) const {
   spec.experimental_read_coalescing_interval =
       experimental_read_coalescing_interval_;
   spec.target_data_file_size = target_data_file_size_;
+  spec.data_file_write_alignment = data_file_write_alignment_;
+  spec.data_file_flush_interval = data_file_flush_interval_;
   spec.coordinator = coordinator_;
   return absl::Status();
 }
@@ -88,6 +88,8 @@ struct OcdbtDriverSpecData {
   std::optional<size_t> experimental_read_coalescing_merged_bytes;
   std::optional<absl::Duration> experimental_read_coalescing_interval;
   std::optional<size_t> target_data_file_size;
+  std::optional<size_t> data_file_write_alignment;
+  std::optional<absl::Duration> data_file_flush_interval;
   bool assume_config = false;
   Context::Resource<OcdbtCoordinatorResource> coordinator;
 
@@ -102,6 +104,7 @@ struct OcdbtDriverSpecData {
              x.experimental_read_coalescing_threshold_bytes,
              x.experimental_read_coalescing_merged_bytes,
              x.experimental_read_coalescing_interval, x.target_data_file_size,
+             x.data_file_write_alignment, x.data_file_flush_interval,
              x.coordinator);
   };
 };
@@ -167,6 +170,8 @@ class OcdbtDriver
   std::optional<size_t> experimental_read_coalescing_merged_bytes_;
   std::optional<absl::Duration> experimental_read_coalescing_interval_;
   std::optional<size_t> target_data_file_size_;
+  std::optional<size_t> data_file_write_alignment_;
+  std::optional<absl::Duration> data_file_flush_interval_;
   Context::Resource<OcdbtCoordinatorResource> coordinator_;
 };
 
@@ -359,6 +359,8 @@ TEST(OcdbtTest, WithExperimentalSpec) {
       {"experimental_read_coalescing_merged_bytes", 2048},
       {"experimental_read_coalescing_interval", "10ms"},
       {"target_data_file_size", 1024},
+      {"data_file_write_alignment", 512},
+      {"data_file_flush_interval", "10ms"},
   };
   TENSORSTORE_ASSERT_OK_AND_ASSIGN(
       auto store, tensorstore::kvstore::Open(json_spec).result());
@@ -563,6 +565,12 @@ TENSORSTORE_GLOBAL_INITIALIZER {
     config.manifest_kind = ManifestKind::kNumbered;
     register_test_suite(config);
   }
+
+  {
+    ConfigConstraints config;
+    config.manifest_kind = ManifestKind::kNumberedDelta;
+    register_test_suite(config);
+  }
 }
 
 // Tests that if a batch of writes leaves a node unmodified, it is not
@@ -696,6 +704,56 @@ TEST(OcdbtTest, NumberedManifest) {
                   MatchesListEntry(::testing::StartsWith("d/")))));
 }
 
+TEST(OcdbtTest, NumberedDeltaManifest) {
+  auto context = Context::Default();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto ocdbt_store,
+      kvstore::Open({{"driver", "ocdbt"},
+                     {"config", {{"manifest_kind", "numbered_delta"}}},
+                     {"base", "memory://"}},
+                    context)
+          .result());
+  TENSORSTORE_ASSERT_OK(kvstore::Write(ocdbt_store, "a", absl::Cord("b")));
+  TENSORSTORE_ASSERT_OK(kvstore::Write(ocdbt_store, "c", absl::Cord("d")));
+
+  // Re-read using a separate cache pool to force decoding of the
+  // delta-encoded manifest and the snapshot it references.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto ocdbt_store2,
+      kvstore::Open({{"driver", "ocdbt"},
+                     {"cache_pool", {{"total_bytes_limit", 0}}},
+                     {"config", {{"manifest_kind", "numbered_delta"}}},
+                     {"base", "memory://"}},
+                    context)
+          .result());
+  EXPECT_THAT(kvstore::Read(ocdbt_store2, "a").result(),
+              MatchesKvsReadResult(absl::Cord("b")));
+  EXPECT_THAT(kvstore::Read(ocdbt_store2, "c").result(),
+              MatchesKvsReadResult(absl::Cord("d")));
+}
+
+TEST(OcdbtTest, ConcurrentWritesNumberedDelta) {
+  auto context = Context::Default();
+  tensorstore::internal::TestConcurrentWritesOptions options;
+  options.get_store = [&] {
+    TENSORSTORE_CHECK_OK_AND_ASSIGN(
+        auto store,
+        kvstore::Open(
+            {{"driver", "ocdbt"},
+             {"base", "memory://"},
+             // Use separate cache to ensure independent driver objects.
+             {"cache_pool", {{"total_bytes_limit", 0}}},
+             {"config", {{"manifest_kind", "numbered_delta"}}}},
+            context)
+            .result());
+    return store;
+  };
+  options.num_threads = 16;
+  options.num_iterations = 100;
+  tensorstore::internal::TestConcurrentWrites(options);
+}
+
 TEST(OcdbtTest, NumberedManifestNumNumberedManifestsToKeep) {
   using ::tensorstore::internal_ocdbt::kNumNumberedManifestsToKeep;
   auto context = Context::Default();
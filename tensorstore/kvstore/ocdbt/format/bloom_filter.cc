@@ -0,0 +1,202 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include "absl/base/internal/endian.h"
+#include "tensorstore/util/division.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+/// Number of hash functions, equal to `kBloomFilterBitsPerKey * ln(2)` rounded
+/// down.  Stored in the filter itself so that the value may change without a
+/// format change.
+constexpr uint8_t kBloomFilterNumHashes = 6;
+
+inline uint64_t RotL64(uint64_t x, int8_t r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t FMix64(uint64_t k) {
+  k ^= k >> 33;
+  k *= uint64_t{0xff51afd7ed558ccd};
+  k ^= k >> 33;
+  k *= uint64_t{0xc4ceb9fe1a85ec53};
+  k ^= k >> 33;
+  return k;
+}
+
+/// MurmurHash3_x64_128 with a seed of 0.
+///
+/// Derived from the original public-domain implementation at
+/// https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+void MurmurHash3_x64_128(const char* data, size_t len, uint64_t out[2]) {
+  constexpr uint64_t c1 = 0x87c37b91114253d5;
+  constexpr uint64_t c2 = 0x4cf5ad432745937f;
+
+  uint64_t h1 = 0;
+  uint64_t h2 = 0;
+
+  const size_t nblocks = len / 16;
+  for (size_t i = 0; i < nblocks; ++i) {
+    uint64_t k1 = absl::little_endian::Load64(data + 16 * i);
+    uint64_t k2 = absl::little_endian::Load64(data + 16 * i + 8);
+
+    k1 *= c1;
+    k1 = RotL64(k1, 31);
+    k1 *= c2;
+    h1 ^= k1;
+    h1 = RotL64(h1, 27);
+    h1 += h2;
+    h1 = h1 * 5 + 0x52dce729;
+
+    k2 *= c2;
+    k2 = RotL64(k2, 33);
+    k2 *= c1;
+    h2 ^= k2;
+    h2 = RotL64(h2, 31);
+    h2 += h1;
+    h2 = h2 * 5 + 0x38495ab5;
+  }
+
+  const uint8_t* tail =
+      reinterpret_cast<const uint8_t*>(data) + nblocks * 16;
+  uint64_t k1 = 0;
+  uint64_t k2 = 0;
+  switch (len & 15) {
+    case 15:
+      k2 ^= uint64_t{tail[14]} << 48;
+      [[fallthrough]];
+    case 14:
+      k2 ^= uint64_t{tail[13]} << 40;
+      [[fallthrough]];
+    case 13:
+      k2 ^= uint64_t{tail[12]} << 32;
+      [[fallthrough]];
+    case 12:
+      k2 ^= uint64_t{tail[11]} << 24;
+      [[fallthrough]];
+    case 11:
+      k2 ^= uint64_t{tail[10]} << 16;
+      [[fallthrough]];
+    case 10:
+      k2 ^= uint64_t{tail[9]} << 8;
+      [[fallthrough]];
+    case 9:
+      k2 ^= uint64_t{tail[8]};
+      k2 *= c2;
+      k2 = RotL64(k2, 33);
+      k2 *= c1;
+      h2 ^= k2;
+      [[fallthrough]];
+    case 8:
+      k1 ^= uint64_t{tail[7]} << 56;
+      [[fallthrough]];
+    case 7:
+      k1 ^= uint64_t{tail[6]} << 48;
+      [[fallthrough]];
+    case 6:
+      k1 ^= uint64_t{tail[5]} << 40;
+      [[fallthrough]];
+    case 5:
+      k1 ^= uint64_t{tail[4]} << 32;
+      [[fallthrough]];
+    case 4:
+      k1 ^= uint64_t{tail[3]} << 24;
+      [[fallthrough]];
+    case 3:
+      k1 ^= uint64_t{tail[2]} << 16;
+      [[fallthrough]];
+    case 2:
+      k1 ^= uint64_t{tail[1]} << 8;
+      [[fallthrough]];
+    case 1:
+      k1 ^= uint64_t{tail[0]};
+      k1 *= c1;
+      k1 = RotL64(k1, 31);
+      k1 *= c2;
+      h1 ^= k1;
+  }
+
+  h1 ^= static_cast<uint64_t>(len);
+  h2 ^= static_cast<uint64_t>(len);
+  h1 += h2;
+  h2 += h1;
+  h1 = FMix64(h1);
+  h2 = FMix64(h2);
+  h1 += h2;
+  h2 += h1;
+  out[0] = h1;
+  out[1] = h2;
+}
+
+}  // namespace
+
+BloomFilterKeyHash GetBloomFilterKeyHash(std::string_view key) {
+  uint64_t h[2];
+  MurmurHash3_x64_128(key.data(), key.size(), h);
+  return {h[0], h[1]};
+}
+
+std::string MakeBloomFilter(size_t num_keys) {
+  const size_t num_bytes =
+      std::max(size_t{8}, tensorstore::CeilOfRatio(
+                              num_keys * kBloomFilterBitsPerKey, size_t{8}));
+  std::string filter(1 + num_bytes, '\0');
+  filter[0] = static_cast<char>(kBloomFilterNumHashes);
+  return filter;
+}
+
+void AddKeyHashToBloomFilter(const BloomFilterKeyHash& hash,
+                             std::string& filter) {
+  assert(filter.size() > 1);
+  const uint64_t num_bits = (filter.size() - 1) * 8;
+  const uint8_t num_hashes = static_cast<uint8_t>(filter[0]);
+  uint64_t h = hash.h1;
+  for (uint8_t i = 0; i < num_hashes; ++i) {
+    const uint64_t bit = h % num_bits;
+    filter[1 + bit / 8] |= static_cast<char>(uint8_t{1} << (bit % 8));
+    h += hash.h2;
+  }
+}
+
+bool BloomFilterMayContainKey(std::string_view key, std::string_view filter) {
+  if (filter.size() <= 1) return true;
+  const uint64_t num_bits = (filter.size() - 1) * 8;
+  const uint8_t num_hashes = static_cast<uint8_t>(filter[0]);
+  const auto hash = GetBloomFilterKeyHash(key);
+  uint64_t h = hash.h1;
+  for (uint8_t i = 0; i < num_hashes; ++i) {
+    const uint64_t bit = h % num_bits;
+    if (!(static_cast<uint8_t>(filter[1 + bit / 8]) &
+          (uint8_t{1} << (bit % 8)))) {
+      return false;
+    }
+    h += hash.h2;
+  }
+  return true;
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
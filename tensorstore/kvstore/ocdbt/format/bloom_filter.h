@@ -0,0 +1,72 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_FORMAT_BLOOM_FILTER_H_
+#define TENSORSTORE_KVSTORE_OCDBT_FORMAT_BLOOM_FILTER_H_
+
+/// \file
+/// Bloom filter representation optionally embedded in b+tree nodes.
+///
+/// The encoded filter consists of a single byte specifying the number of hash
+/// functions, followed by the bit array.  Bit positions are derived from a
+/// 128-bit stable hash of the full key using double hashing, so that filters
+/// of different sizes may be built from the same per-key hashes.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Number of filter bits per key, yielding a false-positive rate of ~1%.
+constexpr size_t kBloomFilterBitsPerKey = 10;
+
+/// 128-bit stable hash of a key, used to derive bloom filter bit positions.
+struct BloomFilterKeyHash {
+  uint64_t h1;
+  uint64_t h2;
+
+  friend bool operator==(const BloomFilterKeyHash& a,
+                         const BloomFilterKeyHash& b) {
+    return a.h1 == b.h1 && a.h2 == b.h2;
+  }
+  friend bool operator!=(const BloomFilterKeyHash& a,
+                         const BloomFilterKeyHash& b) {
+    return !(a == b);
+  }
+};
+
+/// Computes the stable hash of `key`.
+BloomFilterKeyHash GetBloomFilterKeyHash(std::string_view key);
+
+/// Returns an empty filter sized for `num_keys` keys.
+std::string MakeBloomFilter(size_t num_keys);
+
+/// Adds a key hash to `filter`, which must have been created by
+/// `MakeBloomFilter`.
+void AddKeyHashToBloomFilter(const BloomFilterKeyHash& hash,
+                             std::string& filter);
+
+/// Checks whether `key` may have been added to `filter`.
+///
+/// Returns `true` (indicating possible membership) if `filter` is empty.
+bool BloomFilterMayContainKey(std::string_view key, std::string_view filter);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_FORMAT_BLOOM_FILTER_H_
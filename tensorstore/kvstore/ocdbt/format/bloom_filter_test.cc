@@ -0,0 +1,83 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include "absl/strings/str_format.h"
+
+namespace {
+
+using ::tensorstore::internal_ocdbt::AddKeyHashToBloomFilter;
+using ::tensorstore::internal_ocdbt::BloomFilterKeyHash;
+using ::tensorstore::internal_ocdbt::BloomFilterMayContainKey;
+using ::tensorstore::internal_ocdbt::GetBloomFilterKeyHash;
+using ::tensorstore::internal_ocdbt::MakeBloomFilter;
+
+TEST(BloomFilterTest, KeyHashIsStable) {
+  // The key hash is part of the storage format and must never change.  These
+  // are the MurmurHash3_x64_128 test vectors for a seed of 0.
+  EXPECT_EQ((BloomFilterKeyHash{0, 0}), GetBloomFilterKeyHash(""));
+  EXPECT_EQ((BloomFilterKeyHash{uint64_t{0xe34bbc7bbc071b6c},
+                                uint64_t{0x7a433ca9c49a9347}}),
+            GetBloomFilterKeyHash("The quick brown fox jumps over the lazy "
+                                  "dog"));
+}
+
+TEST(BloomFilterTest, EmptyFilterMayContainAnyKey) {
+  EXPECT_TRUE(BloomFilterMayContainKey("a", {}));
+  EXPECT_TRUE(BloomFilterMayContainKey("", {}));
+}
+
+TEST(BloomFilterTest, NoFalseNegatives) {
+  auto filter = MakeBloomFilter(1000);
+  for (int i = 0; i < 1000; ++i) {
+    AddKeyHashToBloomFilter(GetBloomFilterKeyHash(absl::StrFormat("key%d", i)),
+                            filter);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(
+        BloomFilterMayContainKey(absl::StrFormat("key%d", i), filter));
+  }
+}
+
+TEST(BloomFilterTest, FalsePositiveRate) {
+  auto filter = MakeBloomFilter(1000);
+  for (int i = 0; i < 1000; ++i) {
+    AddKeyHashToBloomFilter(GetBloomFilterKeyHash(absl::StrFormat("key%d", i)),
+                            filter);
+  }
+  size_t num_false_positives = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (BloomFilterMayContainKey(absl::StrFormat("other%d", i), filter)) {
+      ++num_false_positives;
+    }
+  }
+  // The expected false positive rate at `kBloomFilterBitsPerKey` is ~1%.
+  EXPECT_LT(num_false_positives, 50);
+}
+
+TEST(BloomFilterTest, SmallFilter) {
+  auto filter = MakeBloomFilter(1);
+  AddKeyHashToBloomFilter(GetBloomFilterKeyHash("a"), filter);
+  EXPECT_TRUE(BloomFilterMayContainKey("a", filter));
+  EXPECT_FALSE(BloomFilterMayContainKey("b", filter));
+}
+
+}  // namespace
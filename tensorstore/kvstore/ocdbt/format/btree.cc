@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <limits>
 #include <memory>
@@ -47,26 +48,69 @@ namespace internal_ocdbt {
 
 namespace {
 
+// Reads a column of `KeyLength` varints.
+//
+// The key length columns account for a significant fraction of the decode
+// time of large nodes.  Rather than decoding one varint at a time through
+// the generic `KeyLengthCodec`, which incurs a virtual buffer check per
+// value, this decodes in a batch directly from the reader's buffer, falling
+// back to `KeyLengthCodec` near buffer boundaries and for encodings longer
+// than 3 bytes.
+bool ReadKeyLengthColumn(riegeli::Reader& reader, span<KeyLength> lengths) {
+  size_t i = 0;
+  const size_t n = lengths.size();
+  while (i < n) {
+    // Fast path: decode directly from the buffer while at least 3 bytes (the
+    // maximum canonical encoded length of a `KeyLength`) are available.
+    const char* const start = reader.cursor();
+    const char* cursor = start;
+    const char* const limit = reader.limit();
+    while (i < n && limit - cursor >= 3) {
+      const uint8_t b0 = static_cast<uint8_t>(cursor[0]);
+      if (b0 < 0x80) {
+        lengths[i++] = b0;
+        cursor += 1;
+        continue;
+      }
+      const uint8_t b1 = static_cast<uint8_t>(cursor[1]);
+      if (b1 < 0x80) {
+        lengths[i++] = static_cast<KeyLength>((b0 & 0x7f) | (b1 << 7));
+        cursor += 2;
+        continue;
+      }
+      const uint8_t b2 = static_cast<uint8_t>(cursor[2]);
+      const uint32_t value = (b0 & 0x7f) |
+                             (static_cast<uint32_t>(b1 & 0x7f) << 7) |
+                             (static_cast<uint32_t>(b2) << 14);
+      if (b2 >= 0x80 || value > std::numeric_limits<KeyLength>::max()) {
+        // Longer or out-of-range encoding; defer to the generic codec, which
+        // handles padded encodings and produces the error for invalid ones.
+        break;
+      }
+      lengths[i++] = static_cast<KeyLength>(value);
+      cursor += 3;
+    }
+    reader.move_cursor(static_cast<size_t>(cursor - start));
+    if (i == n) break;
+    // Slow path: refills the buffer as needed.
+    if (!KeyLengthCodec{}(reader, lengths[i])) return false;
+    ++i;
+  }
+  return true;
+}
+
 bool ReadKeyPrefixLengths(riegeli::Reader& reader,
                           span<KeyLength> prefix_lengths,
                           KeyLength& common_prefix_length) {
+  if (!ReadKeyLengthColumn(reader, prefix_lengths)) return false;
   KeyLength min_prefix_length = kMaxKeyLength;
-  for (auto& prefix_length : prefix_lengths) {
-    if (!KeyLengthCodec{}(reader, prefix_length)) return false;
+  for (KeyLength prefix_length : prefix_lengths) {
     min_prefix_length = std::min(min_prefix_length, prefix_length);
   }
   common_prefix_length = min_prefix_length;
   return true;
 }
 
-bool ReadKeySuffixLengths(riegeli::Reader& reader,
-                          span<KeyLength> suffix_lengths) {
-  for (auto& length : suffix_lengths) {
-    if (!KeyLengthCodec{}(reader, length)) return false;
-  }
-  return true;
-}
-
 // Read the key-related field columns for `ocdbt-btree-leaf-node-entry-array`
 // and `ocdbt-btree-interior-node-entry-array`.
 //
@@ -87,15 +131,18 @@ bool ReadKeys(riegeli::Reader& reader, std::string_view& common_prefix,
     return false;
   }
   // Read `key_suffix_length` column.
-  if (!ReadKeySuffixLengths(reader, suffix_lengths)) return false;
+  if (!ReadKeyLengthColumn(reader, suffix_lengths)) return false;
   if constexpr (std::is_same_v<Entry, InteriorNodeEntry>) {
     // Read `subtree_common_prefix_length` column.
-    for (auto& entry : entries) {
-      if (!KeyLengthCodec{}(reader, entry.subtree_common_prefix_length)) {
-        return false;
-      }
-      common_prefix_length =
-          std::min(common_prefix_length, entry.subtree_common_prefix_length);
+    std::vector<KeyLength> subtree_common_prefix_lengths(num_entries);
+    if (!ReadKeyLengthColumn(reader, subtree_common_prefix_lengths)) {
+      return false;
+    }
+    for (size_t i = 0; i < num_entries; ++i) {
+      entries[i].subtree_common_prefix_length =
+          subtree_common_prefix_lengths[i];
+      common_prefix_length = std::min(
+          common_prefix_length, entries[i].subtree_common_prefix_length);
     }
   }
   common_prefix_length = std::min(suffix_lengths[0], common_prefix_length);
@@ -206,7 +253,7 @@ Result<BtreeNode> DecodeBtreeNode(const absl::Cord& encoded,
                                   const BasePath& base_path) {
   BtreeNode node;
   auto status = DecodeWithOptionalCompression(
-      encoded, kBtreeNodeMagic, kBtreeNodeFormatVersion,
+      encoded, kBtreeNodeMagic, kBtreeNodeFormatVersionWithBloomFilter,
       [&](riegeli::Reader& reader, uint32_t version) -> bool {
         if (!reader.ReadByte(node.height)) return false;
         DataFileTable data_file_table;
@@ -226,12 +273,28 @@ Result<BtreeNode> DecodeBtreeNode(const absl::Cord& encoded,
           return false;
         }
         if (node.height == 0) {
-          return ReadBtreeNodeEntries<LeafNodeEntry>(reader, data_file_table,
-                                                     num_entries, node);
+          if (!ReadBtreeNodeEntries<LeafNodeEntry>(reader, data_file_table,
+                                                   num_entries, node)) {
+            return false;
+          }
         } else {
-          return ReadBtreeNodeEntries<InteriorNodeEntry>(
-              reader, data_file_table, num_entries, node);
+          if (!ReadBtreeNodeEntries<InteriorNodeEntry>(reader, data_file_table,
+                                                       num_entries, node)) {
+            return false;
+          }
+        }
+        if (version >= kBtreeNodeFormatVersionWithBloomFilter) {
+          uint32_t bloom_filter_size;
+          if (!ReadVarintChecked(reader, bloom_filter_size)) return false;
+          if (bloom_filter_size > kMaxBloomFilterSize) {
+            reader.Fail(absl::DataLossError(absl::StrFormat(
+                "Bloom filter size %d exceeds limit of %d", bloom_filter_size,
+                kMaxBloomFilterSize)));
+            return false;
+          }
+          if (!reader.Read(bloom_filter_size, node.bloom_filter)) return false;
         }
+        return true;
       });
   if (!status.ok()) {
     return tensorstore::MaybeAnnotateStatus(status,
@@ -225,8 +225,17 @@ struct BtreeNode {
   /// Concatenated key data, referenced by `key_prefix` and `entries`.
   KeyBuffer key_buffer;
 
+  /// Optional bloom filter over the full keys contained within the subtree
+  /// rooted at this node, in the representation defined by `bloom_filter.h`,
+  /// or empty if no filter is present.
+  ///
+  /// Filters are currently only written for interior nodes by the bottom-up
+  /// bulk load path; nodes re-written by the normal commit path do not
+  /// include a filter.
+  std::string bloom_filter;
+
   constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-    return f(x.height, x.key_prefix, x.entries, x.key_buffer);
+    return f(x.height, x.key_prefix, x.entries, x.key_buffer, x.bloom_filter);
   };
 };
 
@@ -0,0 +1,123 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks decoding of b+tree nodes:
+//
+// BM_DecodeLeafNode/<num_entries>
+// BM_DecodeInteriorNode/<num_entries>
+//
+// Decoding is dominated by the per-entry key length columns and
+// prefix-compressed key suffixes; these benchmarks exercise that path on
+// nodes of increasing arity.  Compression is disabled so that only the node
+// format itself is measured.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "absl/log/absl_check.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
+#include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/util/result.h"
+
+namespace {
+
+using ::tensorstore::internal_ocdbt::BtreeNode;
+using ::tensorstore::internal_ocdbt::BtreeNodeEncoder;
+using ::tensorstore::internal_ocdbt::Config;
+using ::tensorstore::internal_ocdbt::DecodeBtreeNode;
+using ::tensorstore::internal_ocdbt::InteriorNodeEntry;
+using ::tensorstore::internal_ocdbt::LeafNodeEntry;
+
+Config MakeConfig() {
+  Config config;
+  config.compression = Config::NoCompression{};
+  // Ensure the encoder produces a single node regardless of arity.
+  config.max_decoded_node_bytes = 0xffffffff;
+  return config;
+}
+
+std::vector<std::string> MakeKeys(size_t num_entries) {
+  std::vector<std::string> keys(num_entries);
+  for (size_t i = 0; i < num_entries; ++i) {
+    keys[i] = absl::StrFormat("shared_prefix/key%07d", i);
+  }
+  return keys;
+}
+
+absl::Cord EncodeLeafNode(size_t num_entries) {
+  auto keys = MakeKeys(num_entries);
+  BtreeNodeEncoder<LeafNodeEntry> encoder(MakeConfig(), /*height=*/0,
+                                          /*existing_prefix=*/{});
+  for (size_t i = 0; i < num_entries; ++i) {
+    LeafNodeEntry entry;
+    entry.key = keys[i];
+    entry.value_reference = absl::Cord("value");
+    encoder.AddEntry(/*existing=*/false, std::move(entry));
+  }
+  auto encoded_nodes = encoder.Finalize(/*may_be_root=*/true).value();
+  ABSL_CHECK_EQ(1u, encoded_nodes.size());
+  return encoded_nodes[0].encoded_node;
+}
+
+absl::Cord EncodeInteriorNode(size_t num_entries) {
+  auto keys = MakeKeys(num_entries);
+  BtreeNodeEncoder<InteriorNodeEntry> encoder(MakeConfig(), /*height=*/1,
+                                              /*existing_prefix=*/{});
+  for (size_t i = 0; i < num_entries; ++i) {
+    InteriorNodeEntry entry;
+    entry.key = keys[i];
+    entry.subtree_common_prefix_length = 14;  // "shared_prefix/"
+    entry.node.location.file_id.base_path = "base";
+    entry.node.location.file_id.relative_path = "data";
+    entry.node.location.offset = i * 1000;
+    entry.node.location.length = 1000;
+    entry.node.statistics.num_indirect_value_bytes = 100;
+    entry.node.statistics.num_tree_bytes = 1000;
+    entry.node.statistics.num_keys = 100;
+    encoder.AddEntry(/*existing=*/false, std::move(entry));
+  }
+  auto encoded_nodes = encoder.Finalize(/*may_be_root=*/true).value();
+  ABSL_CHECK_EQ(1u, encoded_nodes.size());
+  return encoded_nodes[0].encoded_node;
+}
+
+void BM_DecodeLeafNode(benchmark::State& state) {
+  auto encoded = EncodeLeafNode(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(DecodeBtreeNode(encoded, /*base_path=*/{}));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded.size());
+}
+
+void BM_DecodeInteriorNode(benchmark::State& state) {
+  auto encoded = EncodeInteriorNode(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(DecodeBtreeNode(encoded, /*base_path=*/{}));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded.size());
+}
+
+BENCHMARK(BM_DecodeLeafNode)->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_DecodeInteriorNode)->Arg(100)->Arg(1000)->Arg(10000)->Arg(100000);
+
+}  // namespace
@@ -44,8 +44,17 @@ namespace internal_ocdbt {
 
 constexpr uint32_t kBtreeNodeMagic = 0x0cdb20de;
 constexpr uint8_t kBtreeNodeFormatVersion = 0;
+
+/// Version at which an optional bloom filter trailer was added to the encoded
+/// node representation.
+constexpr uint8_t kBtreeNodeFormatVersionWithBloomFilter = 1;
+
 constexpr size_t kMaxNodeArity = 1024 * 1024;
 
+/// Maximum size in bytes of an encoded bloom filter accepted when decoding a
+/// node.
+constexpr size_t kMaxBloomFilterSize = 16 * 1024 * 1024;
+
 using NumIndirectValueBytesCodec = VarintCodec<uint64_t>;
 using NumTreeBytesCodec = VarintCodec<uint64_t>;
 using NumKeysCodec = VarintCodec<uint64_t>;
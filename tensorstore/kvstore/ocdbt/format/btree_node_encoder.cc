@@ -15,6 +15,7 @@
 #include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
 #include <cassert>
@@ -35,6 +36,7 @@
 #include "tensorstore/internal/integer_overflow.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/kvstore/ocdbt/debug_defines.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/btree_codec.h"
 #include "tensorstore/kvstore/ocdbt/format/codec_util.h"
@@ -190,6 +192,14 @@ void BtreeNodeEncoder<Entry>::AddEntry(bool existing, Entry&& entry) {
       buffered_entries_.back().cumulative_size + additional_size});
 }
 
+template <typename Entry>
+void BtreeNodeEncoder<Entry>::AddEntry(
+    bool existing, Entry&& entry,
+    std::vector<BloomFilterKeyHash>&& subtree_key_hashes) {
+  AddEntry(existing, std::move(entry));
+  buffered_entries_.back().subtree_key_hashes = std::move(subtree_key_hashes);
+}
+
 namespace {
 template <typename Entry>
 bool EncodeEntriesInner(
@@ -300,20 +310,84 @@ bool EncodeEntriesInner(
 }
 }  // namespace
 
+// Collects the hashes of all keys within the subtree rooted at the node being
+// encoded into `info.subtree_key_hashes`, and returns the encoded bloom
+// filter to embed in the node, if any.
+//
+// For leaf nodes, the hashes are computed directly from the entry keys, and
+// no filter is embedded (the entries themselves are an exact membership
+// test).  For interior nodes, the hashes specified when the entries were
+// added are concatenated, and a filter is built over them; if any entry lacks
+// hashes, or the total exceeds `kMaxBloomFilterKeysPerNode`, neither a filter
+// nor hashes are produced.
+template <typename Entry>
+std::string CollectKeyHashesAndBuildBloomFilter(
+    std::string_view existing_prefix,
+    span<typename BtreeNodeEncoder<Entry>::BufferedEntry> entries,
+    EncodedNodeInfo& info) {
+  std::string bloom_filter;
+  auto& key_hashes = info.subtree_key_hashes;
+  if constexpr (std::is_same_v<Entry, LeafNodeEntry>) {
+    key_hashes.reserve(entries.size());
+    for (auto& entry : entries) {
+      if (entry.existing) {
+        key_hashes.push_back(GetBloomFilterKeyHash(
+            tensorstore::StrCat(existing_prefix, entry.entry.key)));
+      } else {
+        key_hashes.push_back(GetBloomFilterKeyHash(entry.entry.key));
+      }
+    }
+  } else {
+    size_t total_keys = 0;
+    for (auto& entry : entries) {
+      if (entry.subtree_key_hashes.empty()) return bloom_filter;
+      total_keys += entry.subtree_key_hashes.size();
+    }
+    if (total_keys > kMaxBloomFilterKeysPerNode) return bloom_filter;
+    key_hashes.reserve(total_keys);
+    for (auto& entry : entries) {
+      key_hashes.insert(key_hashes.end(), entry.subtree_key_hashes.begin(),
+                        entry.subtree_key_hashes.end());
+    }
+    bloom_filter = MakeBloomFilter(key_hashes.size());
+    for (const auto& hash : key_hashes) {
+      AddKeyHashToBloomFilter(hash, bloom_filter);
+    }
+  }
+  return bloom_filter;
+}
+
 template <typename Entry>
 Result<EncodedNode> EncodeEntries(
     const Config& config, BtreeNodeHeight height,
     std::string_view existing_prefix,
-    span<typename BtreeNodeEncoder<Entry>::BufferedEntry> entries,
-    bool is_root) {
+    span<typename BtreeNodeEncoder<Entry>::BufferedEntry> entries, bool is_root,
+    bool collect_subtree_key_hashes) {
   EncodedNode encoded;
+  std::string bloom_filter;
+  if (collect_subtree_key_hashes) {
+    bloom_filter = CollectKeyHashesAndBuildBloomFilter<Entry>(
+        existing_prefix, entries, encoded.info);
+  }
+  const uint8_t version = bloom_filter.empty()
+                              ? kBtreeNodeFormatVersion
+                              : kBtreeNodeFormatVersionWithBloomFilter;
   auto result = EncodeWithOptionalCompression(
-      config, kBtreeNodeMagic, kBtreeNodeFormatVersion,
+      config, kBtreeNodeMagic, version,
       [&](riegeli::Writer& writer) -> bool {
         // height
         if (!writer.WriteByte(height)) return false;
-        return EncodeEntriesInner<Entry>(writer, height, existing_prefix,
-                                         entries, is_root, encoded.info);
+        if (!EncodeEntriesInner<Entry>(writer, height, existing_prefix,
+                                       entries, is_root, encoded.info)) {
+          return false;
+        }
+        if (version >= kBtreeNodeFormatVersionWithBloomFilter) {
+          if (!riegeli::WriteVarint32(bloom_filter.size(), writer) ||
+              !writer.Write(bloom_filter)) {
+            return false;
+          }
+        }
+        return true;
       });
   TENSORSTORE_ASSIGN_OR_RETURN(
       encoded.encoded_node, std::move(result),
@@ -384,7 +458,8 @@ Result<std::vector<EncodedNode>> BtreeNodeEncoder<Entry>::Finalize(
         EncodeEntries<Entry>(
             config_, height_, existing_prefix_,
             span(buffered_entries_.data() + start_i, end_i - start_i),
-            may_be_root && start_i == 0 && end_i == buffered_entries_.size()));
+            may_be_root && start_i == 0 && end_i == buffered_entries_.size(),
+            collect_subtree_key_hashes_));
     encoded_nodes.push_back(std::move(encoded_node));
     start_i = end_i;
     prev_size_estimate = buffered_entries_[end_i - 1].cumulative_size;
@@ -401,6 +476,17 @@ void AddNewInteriorEntry(BtreeNodeEncoder<InteriorNodeEntry>& encoder,
   encoder.AddEntry(/*existing=*/false, std::move(new_entry));
 }
 
+void AddNewInteriorEntry(BtreeNodeEncoder<InteriorNodeEntry>& encoder,
+                         const InteriorNodeEntryData<std::string>& entry,
+                         std::vector<BloomFilterKeyHash>&& subtree_key_hashes) {
+  InteriorNodeEntry new_entry;
+  new_entry.key = entry.key;
+  new_entry.subtree_common_prefix_length = entry.subtree_common_prefix_length;
+  new_entry.node = entry.node;
+  encoder.AddEntry(/*existing=*/false, std::move(new_entry),
+                   std::move(subtree_key_hashes));
+}
+
 template class BtreeNodeEncoder<LeafNodeEntry>;
 template class BtreeNodeEncoder<InteriorNodeEntry>;
 
@@ -15,11 +15,14 @@
 #ifndef TENSORSTORE_KVSTORE_OCDBT_FORMAT_BTREE_NODE_ENCODER_H_
 #define TENSORSTORE_KVSTORE_OCDBT_FORMAT_BTREE_NODE_ENCODER_H_
 
+#include <stddef.h>
+
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "absl/strings/cord.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/config.h"
 #include "tensorstore/util/result.h"
@@ -27,6 +30,12 @@
 namespace tensorstore {
 namespace internal_ocdbt {
 
+/// Maximum number of keys for which a bloom filter is embedded in a single
+/// node.  Limits both the size of the embedded filter (~1.25 MiB at
+/// `kBloomFilterBitsPerKey`) and the memory required to collect key hashes
+/// while building the tree bottom-up.
+constexpr size_t kMaxBloomFilterKeysPerNode = 1024 * 1024;
+
 struct EncodedNodeInfo {
   /// Full key of encoded node.
   std::string inclusive_min_key;
@@ -37,6 +46,11 @@ struct EncodedNodeInfo {
 
   /// Statistics for the encoded node.
   BtreeNodeStatistics statistics;
+
+  /// Hashes of all keys contained within the subtree rooted at the encoded
+  /// node, if key hash collection is enabled and the number of keys does not
+  /// exceed `kMaxBloomFilterKeysPerNode`; otherwise, empty.
+  std::vector<BloomFilterKeyHash> subtree_key_hashes;
 };
 
 /// Encoded b+tree node, generated by `BtreeNodeEncoder`.
@@ -74,6 +88,22 @@ class BtreeNodeEncoder {
   /// until after `Finalize` is called.
   void AddEntry(bool existing, Entry&& entry);
 
+  /// Same as above, but additionally specifies the hashes of all keys
+  /// contained within the subtree rooted at the entry, for use in building
+  /// bloom filters.  Only meaningful for interior nodes.
+  void AddEntry(bool existing, Entry&& entry,
+                std::vector<BloomFilterKeyHash>&& subtree_key_hashes);
+
+  /// Enables collection of subtree key hashes.
+  ///
+  /// For leaf nodes, the hash of each entry's full key (with
+  /// `existing_prefix` prepended for existing entries) is included in
+  /// `EncodedNodeInfo::subtree_key_hashes`; entry keys must therefore be full
+  /// keys.  For interior nodes, a bloom filter is additionally embedded in
+  /// each encoded node whose entries were all added with non-empty
+  /// `subtree_key_hashes` totaling at most `kMaxBloomFilterKeysPerNode` keys.
+  void CollectSubtreeKeyHashes() { collect_subtree_key_hashes_ = true; }
+
   /// Generates the encoded representation.
   ///
   /// \param may_be_root Indicates whether this may be the root node.  If `true`
@@ -90,6 +120,9 @@ class BtreeNodeEncoder {
     bool existing;
     Entry entry;
     size_t cumulative_size;
+    // Hashes of all keys within the subtree rooted at the entry, if specified
+    // (interior entries only).
+    std::vector<BloomFilterKeyHash> subtree_key_hashes;
   };
 
  private:
@@ -99,6 +132,7 @@ class BtreeNodeEncoder {
 
   std::vector<BufferedEntry> buffered_entries_;
   size_t common_prefix_length_ = 0;
+  bool collect_subtree_key_hashes_ = false;
 };
 
 using BtreeLeafNodeEncoder = BtreeNodeEncoder<LeafNodeEntry>;
@@ -111,6 +145,12 @@ using BtreeInteriorNodeEncoder = BtreeNodeEncoder<InteriorNodeEntry>;
 void AddNewInteriorEntry(BtreeNodeEncoder<InteriorNodeEntry>& encoder,
                          const InteriorNodeEntryData<std::string>& entry);
 
+/// Same as above, but additionally specifies the hashes of all keys contained
+/// within the subtree rooted at the entry.
+void AddNewInteriorEntry(BtreeNodeEncoder<InteriorNodeEntry>& encoder,
+                         const InteriorNodeEntryData<std::string>& entry,
+                         std::vector<BloomFilterKeyHash>&& subtree_key_hashes);
+
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
 
@@ -29,6 +29,7 @@
 #include "absl/strings/cord.h"
 #include "absl/strings/str_format.h"
 #include "riegeli/bytes/writer.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree_codec.h"
 #include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
 #include "tensorstore/kvstore/ocdbt/format/codec_util.h"
@@ -41,8 +42,11 @@ namespace {
 
 using ::tensorstore::MatchesStatus;
 using ::tensorstore::Result;
+using ::tensorstore::internal_ocdbt::BloomFilterKeyHash;
+using ::tensorstore::internal_ocdbt::BloomFilterMayContainKey;
 using ::tensorstore::internal_ocdbt::BtreeNode;
 using ::tensorstore::internal_ocdbt::BtreeNodeEncoder;
+using ::tensorstore::internal_ocdbt::GetBloomFilterKeyHash;
 using ::tensorstore::internal_ocdbt::Config;
 using ::tensorstore::internal_ocdbt::DecodeBtreeNode;
 using ::tensorstore::internal_ocdbt::EncodedNode;
@@ -91,6 +95,9 @@ void TestBtreeNodeRoundTrip(const Config& config, const BtreeNode& node) {
                       decoded_node.key_prefix));
         EXPECT_THAT(decoded_node.entries,
                     ::testing::VariantWith<std::vector<Entry>>(entries));
+        // Nodes written without key hash collection use format version 0 and
+        // have no bloom filter.
+        EXPECT_TRUE(decoded_node.bloom_filter.empty());
       },
       node.entries);
 }
@@ -143,6 +150,68 @@ TEST(BtreeNodeTest, InteriorNodeRoundTrip) {
   TestBtreeNodeRoundTrip(config, node);
 }
 
+TEST(BtreeNodeTest, InteriorNodeBloomFilterRoundTrip) {
+  Config config;
+  config.compression = Config::NoCompression{};
+  std::vector<BloomFilterKeyHash> subtree_key_hashes[2];
+  for (int i = 0; i < 100; ++i) {
+    subtree_key_hashes[i % 2].push_back(
+        GetBloomFilterKeyHash(absl::StrFormat("key%d", i)));
+  }
+  BtreeNodeEncoder<InteriorNodeEntry> encoder(config, /*height=*/1,
+                                              /*existing_prefix=*/{});
+  encoder.CollectSubtreeKeyHashes();
+  {
+    InteriorNodeEntry entry;
+    entry.key = "abc";
+    entry.subtree_common_prefix_length = 1;
+    entry.node.location.file_id.base_path = "abc";
+    entry.node.location.file_id.relative_path = "def";
+    entry.node.location.offset = 5;
+    entry.node.location.length = 6;
+    entry.node.statistics.num_indirect_value_bytes = 100;
+    entry.node.statistics.num_tree_bytes = 200;
+    entry.node.statistics.num_keys = 50;
+    encoder.AddEntry(/*existing=*/false, std::move(entry),
+                     std::move(subtree_key_hashes[0]));
+  }
+  {
+    InteriorNodeEntry entry;
+    entry.key = "def";
+    entry.subtree_common_prefix_length = 1;
+    entry.node.location.file_id.base_path = "abc1";
+    entry.node.location.file_id.relative_path = "def1";
+    entry.node.location.offset = 42;
+    entry.node.location.length = 9;
+    entry.node.statistics.num_indirect_value_bytes = 101;
+    entry.node.statistics.num_tree_bytes = 220;
+    entry.node.statistics.num_keys = 50;
+    encoder.AddEntry(/*existing=*/false, std::move(entry),
+                     std::move(subtree_key_hashes[1]));
+  }
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded_nodes,
+                                   encoder.Finalize(/*may_be_root=*/true));
+  ASSERT_EQ(1, encoded_nodes.size());
+  EXPECT_EQ(100, encoded_nodes[0].info.subtree_key_hashes.size());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto decoded_node,
+      DecodeBtreeNode(encoded_nodes[0].encoded_node, /*base_path=*/{}));
+  ASSERT_FALSE(decoded_node.bloom_filter.empty());
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(BloomFilterMayContainKey(absl::StrFormat("key%d", i),
+                                         decoded_node.bloom_filter));
+  }
+  size_t num_rejected = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (!BloomFilterMayContainKey(absl::StrFormat("missing%d", i),
+                                  decoded_node.bloom_filter)) {
+      ++num_rejected;
+    }
+  }
+  // The expected false positive rate is ~1%.
+  EXPECT_GE(num_rejected, 90);
+}
+
 TEST(BtreeNodeTest, InteriorNodeBasePath) {
   Config config;
   BtreeNode node;
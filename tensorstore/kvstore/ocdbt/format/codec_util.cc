@@ -35,7 +35,6 @@
 #include "riegeli/bytes/reader.h"
 #include "riegeli/bytes/writer.h"
 #include "riegeli/digests/crc32c_digester.h"
-#include "riegeli/digests/digesting_reader.h"
 #include "riegeli/digests/digesting_writer.h"
 #include "riegeli/endian/endian_reading.h"
 #include "riegeli/endian/endian_writing.h"
@@ -101,32 +100,34 @@ absl::Status DecodeWithOptionalCompression(
 
   riegeli::CordReader reader(&encoded);
 
-  // Reserve the final 4 bytes for the crc32
-  riegeli::DigestingReader digesting_reader(
-      riegeli::LimitingReader(
-          &reader, riegeli::LimitingReaderBase::Options().set_exact_length(
-                       encoded.size() - 4)),
-      riegeli::Crc32cDigester());
+  // Reserve the final 4 bytes for the crc32.  The digest is not accumulated
+  // as bytes are pulled through the reader chain; it is instead computed
+  // below directly over the cord's flat fragments, which uses the
+  // hardware-accelerated CRC-32C implementation and keeps the checksum work
+  // off the decompression hot path.
+  riegeli::LimitingReader limiting_reader(
+      &reader, riegeli::LimitingReaderBase::Options().set_exact_length(
+                   encoded.size() - 4));
 
   bool success = [&] {
     {
       uint32_t magic;
-      if (!riegeli::ReadBigEndian<uint32_t>(digesting_reader, magic)) {
+      if (!riegeli::ReadBigEndian<uint32_t>(limiting_reader, magic)) {
         return false;
       }
       if (magic != expected_magic) {
-        digesting_reader.Fail(absl::DataLossError(absl::StrFormat(
+        limiting_reader.Fail(absl::DataLossError(absl::StrFormat(
             "Expected to start with hex bytes %08x but received: 0x%08x",
             expected_magic, magic)));
         return false;
       }
 
       uint64_t length;
-      if (!riegeli::ReadLittleEndian<uint64_t>(digesting_reader, length)) {
+      if (!riegeli::ReadLittleEndian<uint64_t>(limiting_reader, length)) {
         return false;
       }
       if (length != encoded.size()) {
-        digesting_reader.Fail(absl::DataLossError(absl::StrFormat(
+        limiting_reader.Fail(absl::DataLossError(absl::StrFormat(
             "Length in header (%d) does not match actual length (%d)", length,
             encoded.size())));
         return false;
@@ -134,34 +135,34 @@ absl::Status DecodeWithOptionalCompression(
     }
 
     uint32_t version;
-    if (!ReadVarintChecked(digesting_reader, version)) return false;
+    if (!ReadVarintChecked(limiting_reader, version)) return false;
     if (version > max_version_number) {
-      digesting_reader.Fail(absl::DataLossError(
+      limiting_reader.Fail(absl::DataLossError(
           absl::StrFormat("Maximum supported version is %d but received: %d",
                           max_version_number, version)));
       return false;
     }
 
     uint32_t compression_format;
-    if (!ReadVarintChecked(digesting_reader, compression_format)) return false;
+    if (!ReadVarintChecked(limiting_reader, compression_format)) return false;
 
     bool success;
     switch (compression_format) {
       case 0:
         // Uncompressed
-        success = decode_decompressed(digesting_reader, version);
+        success = decode_decompressed(limiting_reader, version);
         break;
       case 1: {
-        riegeli::ZstdReader zstd_reader(&digesting_reader);
+        riegeli::ZstdReader zstd_reader(&limiting_reader);
         success = decode_decompressed(zstd_reader, version) &&
                   zstd_reader.VerifyEndAndClose();
         if (!success && !zstd_reader.ok()) {
-          digesting_reader.Fail(zstd_reader.status());
+          limiting_reader.Fail(zstd_reader.status());
         }
         break;
       }
       default:
-        digesting_reader.Fail(absl::DataLossError(absl::StrFormat(
+        limiting_reader.Fail(absl::DataLossError(absl::StrFormat(
             "Unsupported compression format: %d", compression_format)));
         return false;
     }
@@ -169,16 +170,26 @@ absl::Status DecodeWithOptionalCompression(
     return success;
   }();
   TENSORSTORE_RETURN_IF_ERROR(
-      internal_ocdbt::FinalizeReader(digesting_reader, success));
+      internal_ocdbt::FinalizeReader(limiting_reader, success));
 
   uint32_t expected_digest;
   // Length was already checked previously.
   ABSL_CHECK(riegeli::ReadLittleEndian<uint32_t>(reader, expected_digest));
 
-  if (digesting_reader.Digest() != expected_digest) {
+  // Computes the digest fragment by fragment, without copying the data into
+  // a contiguous buffer.
+  absl::crc32c_t actual_digest{0};
+  size_t remaining = encoded.size() - 4;
+  for (std::string_view chunk : encoded.Chunks()) {
+    if (chunk.size() > remaining) chunk = chunk.substr(0, remaining);
+    actual_digest = absl::ExtendCrc32c(actual_digest, chunk);
+    remaining -= chunk.size();
+    if (remaining == 0) break;
+  }
+  if (static_cast<uint32_t>(actual_digest) != expected_digest) {
     return absl::DataLossError(absl::StrFormat(
         "CRC-32C checksum verification failed: expected=%d, actual=%d",
-        expected_digest, digesting_reader.Digest()));
+        expected_digest, static_cast<uint32_t>(actual_digest)));
   }
   return absl::OkStatus();
 }
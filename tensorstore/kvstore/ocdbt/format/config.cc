@@ -47,6 +47,9 @@ std::ostream& operator<<(std::ostream& os, ManifestKind x) {
     case ManifestKind::kNumbered:
       os << "numbered";
       break;
+    case ManifestKind::kNumberedDelta:
+      os << "numbered_delta";
+      break;
   }
   return os;
 }
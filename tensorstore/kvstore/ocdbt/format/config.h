@@ -52,9 +52,10 @@ struct Config {
   enum class ManifestKind {
     kSingle = 0,
     kNumbered = 1,
+    kNumberedDelta = 2,
   };
 
-  constexpr static ManifestKind kMaxManifestKind = ManifestKind::kNumbered;
+  constexpr static ManifestKind kMaxManifestKind = ManifestKind::kNumberedDelta;
 
   friend std::ostream& operator<<(std::ostream& os, ManifestKind);
 
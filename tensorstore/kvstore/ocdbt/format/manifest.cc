@@ -18,6 +18,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <variant>
 #include <vector>
 
 #include "absl/functional/function_ref.h"
@@ -44,6 +45,11 @@ namespace internal_ocdbt {
 constexpr uint32_t kManifestMagic = 0x0cdb3a2a;
 constexpr uint8_t kManifestFormatVersion = 0;
 
+// Manifest format version that supports delta encoding
+// (`ManifestKind::kNumberedDelta`).  The config is followed by a varint base
+// generation number; a value of 0 indicates a full snapshot.
+constexpr uint8_t kManifestFormatVersionWithDelta = 1;
+
 void ForEachManifestVersionTreeNodeRef(
     GenerationNumber generation_number, uint8_t version_tree_arity_log2,
     absl::FunctionRef<void(GenerationNumber min_generation_number,
@@ -197,29 +203,153 @@ Result<absl::Cord> EncodeManifest(const Manifest& manifest,
       });
 }
 
+Result<absl::Cord> EncodeManifestDelta(const Manifest& manifest,
+                                       GenerationNumber base_generation) {
+  assert(manifest.config.manifest_kind == ManifestKind::kNumberedDelta);
+  assert(base_generation == 0 ||
+         base_generation < manifest.latest_generation());
+#ifndef NDEBUG
+  CheckManifestInvariants(manifest, /*assume_single=*/true);
+#endif
+  return EncodeWithOptionalCompression(
+      manifest.config, kManifestMagic, kManifestFormatVersionWithDelta,
+      [&](riegeli::Writer& writer) -> bool {
+        if (!ConfigCodec{}(writer, manifest.config)) return false;
+        if (!WriteVarint<GenerationNumber>(writer, base_generation)) {
+          return false;
+        }
+        auto first = manifest.versions.begin();
+        while (first != manifest.versions.end() &&
+               first->generation_number <= base_generation) {
+          ++first;
+        }
+        const VersionTreeNode::LeafNodeEntries delta_versions(
+            first, manifest.versions.end());
+        DataFileTableBuilder data_file_table;
+        internal_ocdbt::AddDataFiles(data_file_table, delta_versions);
+        if (base_generation == 0) {
+          internal_ocdbt::AddDataFiles(data_file_table,
+                                       manifest.version_tree_nodes);
+        }
+        if (!data_file_table.Finalize(writer)) return false;
+        if (!WriteVersionTreeNodeEntries(manifest.config, writer,
+                                         data_file_table, delta_versions)) {
+          return false;
+        }
+        if (base_generation == 0) {
+          if (!VersionTreeInteriorNodeEntryArrayCodec<DataFileTableBuilder>{
+                  data_file_table,
+                  /*max_num_entries=*/
+                  GetMaxVersionTreeHeight(
+                      manifest.config.version_tree_arity_log2),
+                  /*include_height=*/true}(writer,
+                                           manifest.version_tree_nodes)) {
+            return false;
+          }
+        }
+        return true;
+      });
+}
+
+namespace {
+
+// Reads the contents of a version-0 manifest (following the compression
+// header), including the config.
+[[nodiscard]] bool ReadManifestContents(riegeli::Reader& reader,
+                                        Manifest& manifest) {
+  if (!ConfigCodec{}(reader, manifest.config)) return false;
+  if (manifest.config.manifest_kind != ManifestKind::kSingle) {
+    // This is a config-only manifest.
+    return true;
+  }
+  DataFileTable data_file_table;
+  if (!ReadDataFileTable(reader, /*base_path=*/{}, data_file_table)) {
+    return false;
+  }
+  if (!ReadVersionTreeLeafNode(manifest.config.version_tree_arity_log2, reader,
+                               data_file_table, manifest.versions)) {
+    return false;
+  }
+  if (!ReadManifestVersionTreeNodes(
+          reader, manifest.config.version_tree_arity_log2, data_file_table,
+          manifest.version_tree_nodes,
+          manifest.versions.back().generation_number)) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 Result<Manifest> DecodeManifest(const absl::Cord& encoded) {
   Manifest manifest;
   auto status = DecodeWithOptionalCompression(
       encoded, kManifestMagic, kManifestFormatVersion,
       [&](riegeli::Reader& reader, uint32_t version) -> bool {
-        if (!ConfigCodec{}(reader, manifest.config)) return false;
-        if (manifest.config.manifest_kind != ManifestKind::kSingle) {
-          // This is a config-only manifest.
-          return true;
+        return ReadManifestContents(reader, manifest);
+      });
+  if (!status.ok()) {
+    return tensorstore::MaybeAnnotateStatus(status, "Error decoding manifest");
+  }
+#ifndef NDEBUG
+  CheckManifestInvariants(manifest);
+#endif
+  return manifest;
+}
+
+Result<std::variant<Manifest, ManifestDelta>> DecodeManifestOrDelta(
+    const absl::Cord& encoded) {
+  std::variant<Manifest, ManifestDelta> result;
+  auto status = DecodeWithOptionalCompression(
+      encoded, kManifestMagic, kManifestFormatVersionWithDelta,
+      [&](riegeli::Reader& reader, uint32_t version) -> bool {
+        if (version < kManifestFormatVersionWithDelta) {
+          return ReadManifestContents(reader, result.emplace<Manifest>());
         }
+        Config config;
+        if (!ConfigCodec{}(reader, config)) return false;
+        if (config.manifest_kind != ManifestKind::kNumberedDelta) {
+          reader.Fail(absl::DataLossError(tensorstore::StrCat(
+              "Expected manifest_kind of ", ManifestKind::kNumberedDelta,
+              " for delta-capable manifest, but received: ",
+              config.manifest_kind)));
+          return false;
+        }
+        GenerationNumber base_generation;
+        if (!ReadVarintChecked(reader, base_generation)) return false;
         DataFileTable data_file_table;
         if (!ReadDataFileTable(reader, /*base_path=*/{}, data_file_table)) {
           return false;
         }
-        if (!ReadVersionTreeLeafNode(manifest.config.version_tree_arity_log2,
+        if (base_generation == 0) {
+          // Full snapshot.
+          auto& manifest = result.emplace<Manifest>();
+          manifest.config = std::move(config);
+          if (!ReadVersionTreeLeafNode(
+                  manifest.config.version_tree_arity_log2, reader,
+                  data_file_table, manifest.versions)) {
+            return false;
+          }
+          if (!ReadManifestVersionTreeNodes(
+                  reader, manifest.config.version_tree_arity_log2,
+                  data_file_table, manifest.version_tree_nodes,
+                  manifest.versions.back().generation_number)) {
+            return false;
+          }
+          return true;
+        }
+        auto& delta = result.emplace<ManifestDelta>();
+        delta.config = std::move(config);
+        delta.base_generation = base_generation;
+        if (!ReadVersionTreeLeafNode(delta.config.version_tree_arity_log2,
                                      reader, data_file_table,
-                                     manifest.versions)) {
+                                     delta.versions)) {
           return false;
         }
-        if (!ReadManifestVersionTreeNodes(
-                reader, manifest.config.version_tree_arity_log2,
-                data_file_table, manifest.version_tree_nodes,
-                manifest.versions.back().generation_number)) {
+        if (delta.versions.front().generation_number <= base_generation) {
+          reader.Fail(absl::DataLossError(absl::StrFormat(
+              "generation_number[0]=%d <= base generation %d",
+              delta.versions.front().generation_number, base_generation)));
           return false;
         }
         return true;
@@ -228,8 +358,39 @@ Result<Manifest> DecodeManifest(const absl::Cord& encoded) {
     return tensorstore::MaybeAnnotateStatus(status, "Error decoding manifest");
   }
 #ifndef NDEBUG
-  CheckManifestInvariants(manifest);
+  if (auto* manifest = std::get_if<Manifest>(&result)) {
+    CheckManifestInvariants(*manifest,
+                            /*assume_single=*/!manifest->versions.empty());
+  }
 #endif
+  return result;
+}
+
+Result<Manifest> ApplyManifestDelta(const Manifest& base,
+                                    const ManifestDelta& delta) {
+  if (delta.config != base.config) {
+    return absl::DataLossError(
+        "Delta manifest config does not match base manifest config");
+  }
+  if (base.versions.empty() ||
+      base.latest_generation() != delta.base_generation) {
+    return absl::DataLossError(absl::StrFormat(
+        "Base manifest generation %d does not match delta base generation %d",
+        base.versions.empty() ? 0 : base.latest_generation(),
+        delta.base_generation));
+  }
+  Manifest manifest;
+  manifest.config = delta.config;
+  manifest.versions = base.versions;
+  manifest.versions.insert(manifest.versions.end(), delta.versions.begin(),
+                           delta.versions.end());
+  manifest.version_tree_nodes = base.version_tree_nodes;
+  TENSORSTORE_RETURN_IF_ERROR(ValidateVersionTreeLeafNodeEntries(
+      manifest.config.version_tree_arity_log2, manifest.versions));
+  TENSORSTORE_RETURN_IF_ERROR(ValidateManifestVersionTreeNodes(
+      manifest.config.version_tree_arity_log2,
+      manifest.versions.back().generation_number,
+      manifest.version_tree_nodes));
   return manifest;
 }
 
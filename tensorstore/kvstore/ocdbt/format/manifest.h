@@ -29,6 +29,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <variant>
 
 #include "absl/functional/function_ref.h"
 #include "absl/strings/cord.h"
@@ -56,6 +57,16 @@ std::string GetNumberedManifestPath(std::string_view base_path,
 // TODO(jbms): Add time-based criteria in addition to this.
 constexpr GenerationNumber kNumNumberedManifestsToKeep = 128;
 
+// Maximum number of generations by which a delta-encoded numbered manifest
+// may be ahead of the full snapshot it references
+// (`ManifestKind::kNumberedDelta` only).  Once this limit is reached, a new
+// full snapshot is written instead of a delta.
+//
+// Must be less than `kNumNumberedManifestsToKeep` to ensure that the
+// referenced snapshot has not yet been deleted when the newest manifest is
+// read.
+constexpr GenerationNumber kManifestDeltaSnapshotInterval = 64;
+
 /// In-memory representation of a manifest.
 struct Manifest {
   /// Database configuration.
@@ -103,13 +114,60 @@ struct ManifestWithTime {
   absl::Time time;
 };
 
+/// Delta-encoded manifest, as stored in a numbered manifest file when
+/// `ManifestKind::kNumberedDelta` is in use.
+///
+/// Contains only the inline versions added after the full snapshot manifest
+/// with latest generation number `base_generation`; the remaining state is
+/// inherited from the snapshot via `ApplyManifestDelta`.
+struct ManifestDelta {
+  /// Database configuration.
+  Config config;
+
+  /// Latest generation number of the referenced snapshot manifest.
+  GenerationNumber base_generation;
+
+  /// Versions added after `base_generation`, with consecutive increasing
+  /// version numbers.  Always non-empty.
+  VersionTreeNode::LeafNodeEntries versions;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.config, x.base_generation, x.versions);
+  };
+};
+
 /// Decodes the manifest.
 Result<Manifest> DecodeManifest(const absl::Cord& encoded);
 
+/// Decodes a numbered manifest that may be either a full snapshot or a delta.
+///
+/// Version 0 manifests and version 1 manifests with a base generation of 0
+/// decode to a `Manifest`; other version 1 manifests decode to a
+/// `ManifestDelta`.
+Result<std::variant<Manifest, ManifestDelta>> DecodeManifestOrDelta(
+    const absl::Cord& encoded);
+
 /// Encodes the manifest.
 Result<absl::Cord> EncodeManifest(const Manifest& manifest,
                                   bool encode_as_single = false);
 
+/// Encodes `manifest` as a delta containing only the versions newer than
+/// `base_generation`, or as a full snapshot if `base_generation == 0`.
+///
+/// The caller is responsible for ensuring that the snapshot manifest with
+/// latest generation number `base_generation` contains exactly the same
+/// config, version tree nodes, and versions up to `base_generation`.
+///
+/// Requires `manifest.config.manifest_kind == ManifestKind::kNumberedDelta`
+/// and, if non-zero, `base_generation < manifest.latest_generation()`.
+Result<absl::Cord> EncodeManifestDelta(const Manifest& manifest,
+                                       GenerationNumber base_generation);
+
+/// Reconstructs the full manifest from a snapshot manifest `base` and a
+/// `delta` that references it.
+Result<Manifest> ApplyManifestDelta(const Manifest& base,
+                                    const ManifestDelta& delta);
+
 /// Iterates over the version tree nodes that may be referenced from the
 /// manifest with the given latest `generation_number`.
 ///
@@ -14,6 +14,8 @@
 
 #include "tensorstore/kvstore/ocdbt/format/manifest.h"
 
+#include <variant>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/strings/str_format.h"
@@ -28,9 +30,15 @@ namespace {
 
 using ::tensorstore::MatchesStatus;
 using ::tensorstore::Result;
+using ::tensorstore::internal_ocdbt::ApplyManifestDelta;
 using ::tensorstore::internal_ocdbt::CommitTime;
 using ::tensorstore::internal_ocdbt::DecodeManifest;
+using ::tensorstore::internal_ocdbt::DecodeManifestOrDelta;
+using ::tensorstore::internal_ocdbt::EncodeManifestDelta;
+using ::tensorstore::internal_ocdbt::GenerationNumber;
 using ::tensorstore::internal_ocdbt::Manifest;
+using ::tensorstore::internal_ocdbt::ManifestDelta;
+using ::tensorstore::internal_ocdbt::ManifestKind;
 
 Result<absl::Time> RoundTripCommitTime(absl::Time time) {
   TENSORSTORE_ASSIGN_OR_RETURN(auto commit_time,
@@ -202,6 +210,71 @@ TEST(ManifestTest, RoundTripMultipleVersions) {
   TestManifestRoundTrip(manifest);
 }
 
+Manifest GetDeltaKindManifest(GenerationNumber num_generations) {
+  Manifest manifest;
+  manifest.config.manifest_kind = ManifestKind::kNumberedDelta;
+  for (GenerationNumber i = 1; i <= num_generations; ++i) {
+    auto& x = manifest.versions.emplace_back();
+    x.root.location.file_id.base_path = "abc";
+    x.root.location.file_id.relative_path = "defgh";
+    x.root.location.offset = 10 + i;
+    x.root.location.length = 42;
+    x.generation_number = i;
+    x.root_height = 0;
+    x.commit_time = CommitTime{i};
+  }
+  return manifest;
+}
+
+TEST(ManifestDeltaTest, SnapshotRoundTrip) {
+  auto manifest = GetDeltaKindManifest(3);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto encoded, EncodeManifestDelta(manifest, /*base_generation=*/0));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto decoded,
+                                   DecodeManifestOrDelta(encoded));
+  ASSERT_TRUE(std::holds_alternative<Manifest>(decoded));
+  EXPECT_EQ(manifest, std::get<Manifest>(decoded));
+}
+
+TEST(ManifestDeltaTest, DeltaRoundTripAndApply) {
+  auto base = GetDeltaKindManifest(2);
+  auto manifest = GetDeltaKindManifest(5);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto encoded, EncodeManifestDelta(manifest, /*base_generation=*/2));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto decoded,
+                                   DecodeManifestOrDelta(encoded));
+  ASSERT_TRUE(std::holds_alternative<ManifestDelta>(decoded));
+  auto& delta = std::get<ManifestDelta>(decoded);
+  EXPECT_EQ(2, delta.base_generation);
+  ASSERT_EQ(3, delta.versions.size());
+  EXPECT_EQ(3, delta.versions.front().generation_number);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto applied,
+                                   ApplyManifestDelta(base, delta));
+  EXPECT_EQ(manifest, applied);
+}
+
+TEST(ManifestDeltaTest, DecodeVersion0Manifest) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto encoded,
+                                   EncodeManifest(GetSimpleManifest()));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto decoded,
+                                   DecodeManifestOrDelta(encoded));
+  ASSERT_TRUE(std::holds_alternative<Manifest>(decoded));
+  EXPECT_EQ(GetSimpleManifest(), std::get<Manifest>(decoded));
+}
+
+TEST(ManifestDeltaTest, ApplyBaseGenerationMismatch) {
+  auto manifest = GetDeltaKindManifest(5);
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto encoded, EncodeManifestDelta(manifest, /*base_generation=*/2));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto decoded,
+                                   DecodeManifestOrDelta(encoded));
+  auto& delta = std::get<ManifestDelta>(decoded);
+  EXPECT_THAT(ApplyManifestDelta(GetDeltaKindManifest(3), delta),
+              MatchesStatus(absl::StatusCode::kDataLoss,
+                            "Base manifest generation 3 does not match delta "
+                            "base generation 2"));
+}
+
 namespace for_each_manifest_version_tree_node_ref {
 using ::tensorstore::internal_ocdbt::ForEachManifestVersionTreeNodeRef;
 using ::tensorstore::internal_ocdbt::GenerationNumber;
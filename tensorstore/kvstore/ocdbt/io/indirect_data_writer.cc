@@ -25,11 +25,14 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/metrics/histogram.h"
 #include "tensorstore/internal/metrics/metadata.h"
 #include "tensorstore/internal/mutex.h"
+#include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/ocdbt/format/data_file_id.h"
@@ -56,15 +59,22 @@ class IndirectDataWriter
     : public internal::AtomicReferenceCount<IndirectDataWriter> {
  public:
   explicit IndirectDataWriter(kvstore::KvStore kvstore, std::string prefix,
-                              size_t target_size)
+                              size_t target_size, size_t alignment,
+                              absl::Duration max_flush_delay)
       : kvstore_(std::move(kvstore)),
         prefix_(std::move(prefix)),
-        target_size_(target_size) {}
+        target_size_(target_size),
+        alignment_(alignment),
+        max_flush_delay_(max_flush_delay) {
+    assert(alignment_ > 0);
+  }
 
   // Treat as private:
   kvstore::KvStore kvstore_;
   std::string prefix_;
   size_t target_size_;
+  size_t alignment_;
+  absl::Duration max_flush_delay_;
   absl::Mutex mutex_;
 
   // Count of in-flight flush operations.
@@ -182,6 +192,26 @@ Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
           self->flush_requested_ = true;
           MaybeFlush(*self, std::move(lock));
         });
+    if (self.max_flush_delay_ != absl::InfiniteDuration()) {
+      // Bound the time writes remain buffered, so that data files are written
+      // promptly even if the buffer never reaches the target size.
+      internal::ScheduleAt(
+          absl::Now() + self.max_flush_delay_,
+          [self = internal::IntrusivePtr<IndirectDataWriter>(&self),
+           promise = self.promise_]() mutable {
+            ABSL_LOG_IF(INFO, ocdbt_logging) << "Flush delay elapsed";
+            UniqueWriterLock lock{self->mutex_};
+            if (!HaveSameSharedState(promise, self->promise_)) return;
+            self->flush_requested_ = true;
+            MaybeFlush(*self, std::move(lock));
+          });
+    }
+  }
+  if (self.alignment_ > 1) {
+    if (const size_t remainder = self.buffer_.size() % self.alignment_;
+        remainder != 0) {
+      self.buffer_.Append(std::string(self.alignment_ - remainder, '\0'));
+    }
   }
   ref.file_id = self.data_file_id_;
   ref.offset = self.buffer_.size();
@@ -196,9 +226,12 @@ Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
 
 IndirectDataWriterPtr MakeIndirectDataWriter(kvstore::KvStore kvstore,
                                              std::string prefix,
-                                             size_t target_size) {
+                                             size_t target_size,
+                                             size_t alignment,
+                                             absl::Duration max_flush_delay) {
   return internal::MakeIntrusivePtr<IndirectDataWriter>(
-      std::move(kvstore), std::move(prefix), target_size);
+      std::move(kvstore), std::move(prefix), target_size, alignment,
+      max_flush_delay);
 }
 
 }  // namespace internal_ocdbt
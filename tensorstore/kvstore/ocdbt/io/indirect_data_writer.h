@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include "absl/strings/cord.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
@@ -50,9 +51,22 @@ using IndirectDataWriterPtr = internal::IntrusivePtr<IndirectDataWriter>;
 void intrusive_ptr_increment(IndirectDataWriter* p);
 void intrusive_ptr_decrement(IndirectDataWriter* p);
 
-IndirectDataWriterPtr MakeIndirectDataWriter(kvstore::KvStore kvstore,
-                                             std::string prefix,
-                                             size_t target_size);
+/// Creates an `IndirectDataWriter`.
+///
+/// \param target_size Target size of each data file.  Once the buffer reaches
+///     this size, a flush is started even if no returned future has been
+///     forced.  If `0`, flushes are started only when a future is forced.
+/// \param alignment Alignment of each value within the data file, typically a
+///     power of 2 matching the request granularity of the underlying kvstore.
+///     Padding bytes are inserted before values as needed.  Must be non-zero.
+/// \param max_flush_delay Maximum time writes remain buffered before a flush
+///     is started, even if the buffer has not reached `target_size` and no
+///     returned future has been forced.  If `absl::InfiniteDuration()`, writes
+///     remain buffered indefinitely.
+IndirectDataWriterPtr MakeIndirectDataWriter(
+    kvstore::KvStore kvstore, std::string prefix, size_t target_size,
+    size_t alignment = 1,
+    absl::Duration max_flush_delay = absl::InfiniteDuration());
 
 Future<const void> Write(IndirectDataWriter& self, absl::Cord data,
                          IndirectDataReference& ref);
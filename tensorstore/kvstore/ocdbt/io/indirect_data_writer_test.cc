@@ -23,6 +23,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "absl/strings/cord.h"
+#include "absl/time/time.h"
 #include "tensorstore/internal/flat_cord_builder.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/memory/memory_key_value_store.h"
@@ -152,4 +153,55 @@ TEST(IndirectDataWriter, LimitedSize) {
   EXPECT_THAT(files, ::testing::ElementsAreArray(refs));
 }
 
+TEST(IndirectDataWriter, Alignment) {
+  constexpr size_t kAlignment = 512;
+
+  auto data = GetCord(260);
+
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  auto mock_key_value_store = MockKeyValueStore::Make();
+  auto writer = MakeIndirectDataWriter(
+      tensorstore::kvstore::KvStore(mock_key_value_store), "d/",
+      /*target_size=*/0, kAlignment);
+
+  std::vector<Future<const void>> futures;
+  for (int i = 0; i < 10; ++i) {
+    IndirectDataReference ref;
+    auto f = Write(*writer, data, ref);
+    EXPECT_EQ(0, ref.offset % kAlignment);
+    EXPECT_EQ(data.size(), ref.length);
+    futures.push_back(std::move(f));
+  }
+  futures.front().Force();
+  while (!mock_key_value_store->write_requests.empty()) {
+    auto r = mock_key_value_store->write_requests.pop();
+    // Padding bytes between values are included in the written data file.
+    EXPECT_EQ(9 * kAlignment + 260, r.value->size());
+    r(memory_store);
+  }
+  for (auto& f : futures) {
+    f.Force();
+    TENSORSTORE_ASSERT_OK(f.status());
+  }
+}
+
+TEST(IndirectDataWriter, FlushDelay) {
+  auto data = GetCord(260);
+
+  auto memory_store = tensorstore::GetMemoryKeyValueStore();
+  auto mock_key_value_store = MockKeyValueStore::Make();
+  auto writer = MakeIndirectDataWriter(
+      tensorstore::kvstore::KvStore(mock_key_value_store), "d/",
+      /*target_size=*/0, /*alignment=*/1,
+      /*max_flush_delay=*/absl::Milliseconds(10));
+
+  IndirectDataReference ref;
+  auto f = Write(*writer, data, ref);
+
+  // Without forcing `f`, the flush is started once the flush delay elapses.
+  auto r = mock_key_value_store->write_requests.pop();
+  r(memory_store);
+  TENSORSTORE_ASSERT_OK(f.status());
+}
+
 }  // namespace
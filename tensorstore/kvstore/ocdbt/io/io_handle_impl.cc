@@ -41,6 +41,7 @@
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/kvstore/driver.h"
 #include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 #include "tensorstore/kvstore/kvstore.h"
 #include "tensorstore/kvstore/ocdbt/config.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
@@ -48,7 +49,6 @@
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
 #include "tensorstore/kvstore/ocdbt/format/manifest.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
-#include "tensorstore/kvstore/ocdbt/io/coalesce_kvstore.h"
 #include "tensorstore/kvstore/ocdbt/io/indirect_data_kvstore_driver.h"
 #include "tensorstore/kvstore/ocdbt/io/indirect_data_writer.h"
 #include "tensorstore/kvstore/ocdbt/io/manifest_cache.h"
@@ -92,6 +92,24 @@ class IoHandleImpl : public IoHandle {
     return btree_node_cache_->ReadEntry(ref);
   }
 
+  Future<const absl::Cord> GetBtreeNodeEncoded(
+      const IndirectDataReference& ref) const final {
+    // Serves from the node cache, so that repeated requests for the same node
+    // (e.g. from cooperating peers) only read from the base kvstore once.
+    auto entry = btree_node_cache_->GetEntry(ref);
+    auto* entry_ptr = entry.get();
+    return PromiseFuturePair<absl::Cord>::LinkValue(
+               [entry = std::move(entry)](Promise<absl::Cord> promise,
+                                          ReadyFuture<const void> future) {
+                 auto data = internal::AsyncCache::ReadLock<
+                                 BtreeNodeCache::ReadData>(*entry)
+                                 .shared_data();
+                 promise.SetResult(data->encoded);
+               },
+               entry_ptr->Read({absl::InfinitePast()}))
+        .future;
+  }
+
   Future<const std::shared_ptr<const VersionTreeNode>> GetVersionTreeNode(
       const IndirectDataReference& ref) const final {
     return version_tree_node_cache_->ReadEntry(ref);
@@ -421,11 +439,12 @@ IoHandle::Ptr MakeIoHandle(
     internal::CachePool* cache_pool, const KvStore& base_kvstore,
     const KvStore& manifest_kvstore, ConfigStatePtr config_state,
     const DataFilePrefixes& data_file_prefixes, size_t write_target_size,
+    size_t write_alignment, absl::Duration write_max_flush_delay,
     std::optional<ReadCoalesceOptions> read_coalesce_options) {
   // Maybe wrap the base driver in CoalesceKvStoreDriver.
   kvstore::DriverPtr driver_with_optional_coalescing =
       read_coalesce_options.has_value()
-          ? MakeCoalesceKvStoreDriver(
+          ? internal_kvstore::MakeCoalesceKvStoreDriver(
                 base_kvstore.driver,
                 read_coalesce_options->max_overhead_bytes_per_request,
                 read_coalesce_options->max_merged_bytes_per_request,
@@ -452,7 +471,8 @@ IoHandle::Ptr MakeIoHandle(
                        &data_prefix_array[0];
       if (match_i == i) {
         impl->indirect_data_writer_[i] = internal_ocdbt::MakeIndirectDataWriter(
-            data_kvstore, std::string(data_prefix_array[i]), write_target_size);
+            data_kvstore, std::string(data_prefix_array[i]), write_target_size,
+            write_alignment, write_max_flush_delay);
       } else {
         impl->indirect_data_writer_[i] = impl->indirect_data_writer_[match_i];
       }
@@ -55,6 +55,8 @@ IoHandle::Ptr MakeIoHandle(
     internal::CachePool* cache_pool, const KvStore& base_kvstore,
     const KvStore& manifest_kvstore, ConfigStatePtr config_state,
     const DataFilePrefixes& data_file_prefixes, size_t write_target_size = 0,
+    size_t write_alignment = 1,
+    absl::Duration write_max_flush_delay = absl::InfiniteDuration(),
     std::optional<ReadCoalesceOptions> read_coalesce_options = std::nullopt);
 
 }  // namespace internal_ocdbt
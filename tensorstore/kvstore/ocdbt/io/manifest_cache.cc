@@ -25,6 +25,7 @@
 #include <string_view>
 #include <system_error>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/base/attributes.h"
@@ -445,9 +446,76 @@ void ListNumberedManifests(NumberedManifestCache::Entry* entry,
       }));
 }
 
+// Reads the full snapshot manifest referenced by `delta` and applies the
+// delta to it.
+//
+// The snapshot must itself decode to a full snapshot; chains of deltas are
+// never written and are rejected.
+template <typename Receiver>
+void ReadBaseSnapshotManifest(NumberedManifestCache::Entry* entry,
+                              ManifestDelta delta, absl::Time time,
+                              Receiver receiver) {
+  auto& cache = GetOwningCache(*entry);
+  ABSL_LOG_IF(INFO, ocdbt_logging)
+      << "Reading base snapshot manifest: " << delta.base_generation;
+  auto read_future = cache.kvstore_driver_->Read(
+      GetNumberedManifestPath(entry->key(), delta.base_generation));
+  read_future.Force();
+  read_future.ExecuteWhenReady(WithExecutor(
+      cache.executor(),
+      [entry, delta = std::move(delta), time, receiver = std::move(receiver)](
+          ReadyFuture<kvstore::ReadResult> future) mutable {
+        auto& r = future.result();
+
+        auto set_error = [&](const absl::Status& status,
+                             std::string_view action) {
+          auto& cache = GetOwningCache(*entry);
+          execution::set_error(
+              receiver,
+              cache.kvstore_driver_->AnnotateError(
+                  GetNumberedManifestPath(entry->key(), delta.base_generation),
+                  action, status));
+        };
+
+        if (!r.ok()) {
+          set_error(r.status(), "reading");
+          return;
+        }
+        auto& read_result = *r;
+        if (read_result.not_found()) {
+          set_error(absl::DataLossError(
+                        "Base snapshot referenced by delta-encoded manifest "
+                        "is missing"),
+                    "reading");
+          return;
+        }
+
+        TENSORSTORE_ASSIGN_OR_RETURN(auto decoded,
+                                     DecodeManifestOrDelta(read_result.value),
+                                     set_error(_, "decoding"));
+        auto* base = std::get_if<Manifest>(&decoded);
+        if (!base ||
+            base->config.manifest_kind != ManifestKind::kNumberedDelta) {
+          set_error(absl::DataLossError(
+                        "Expected full snapshot manifest of numbered_delta "
+                        "manifest kind"),
+                    "decoding");
+          return;
+        }
+        TENSORSTORE_ASSIGN_OR_RETURN(auto manifest,
+                                     ApplyManifestDelta(*base, delta),
+                                     set_error(_, "decoding"));
+        execution::set_value(receiver,
+                             std::make_shared<Manifest>(std::move(manifest)),
+                             std::make_shared<Manifest>(std::move(*base)),
+                             time);
+      }));
+}
+
 template <typename Receiver>
 void ReadNumberedManifest(NumberedManifestCache::Entry* entry,
                           GenerationNumber generation_number,
+                          std::shared_ptr<const Manifest> base_snapshot,
                           absl::Time staleness_bound, Receiver receiver) {
   auto& cache = GetOwningCache(*entry);
   ABSL_LOG_IF(INFO, ocdbt_logging)
@@ -457,7 +525,8 @@ void ReadNumberedManifest(NumberedManifestCache::Entry* entry,
   read_future.Force();
   read_future.ExecuteWhenReady(WithExecutor(
       cache.executor(),
-      [entry, generation_number, receiver = std::move(receiver)](
+      [entry, generation_number, base_snapshot = std::move(base_snapshot),
+       receiver = std::move(receiver)](
           ReadyFuture<kvstore::ReadResult> future) mutable {
         auto& r = future.result();
 
@@ -477,55 +546,108 @@ void ReadNumberedManifest(NumberedManifestCache::Entry* entry,
         }
         auto& read_result = *r;
         if (read_result.not_found()) {
-          execution::set_value(receiver, nullptr, read_result.stamp.time);
+          execution::set_value(receiver, nullptr, nullptr,
+                               read_result.stamp.time);
           return;
         }
 
-        TENSORSTORE_ASSIGN_OR_RETURN(auto manifest,
-                                     DecodeManifest(read_result.value),
+        TENSORSTORE_ASSIGN_OR_RETURN(auto decoded,
+                                     DecodeManifestOrDelta(read_result.value),
                                      set_error(_, "decoding"));
-        if (manifest.config.manifest_kind != ManifestKind::kSingle) {
-          set_error(absl::DataLossError(tensorstore::StrCat(
-                        "Expected single-file manifest kind, but received: ",
-                        manifest.config.manifest_kind)),
-                    "decoding");
+        if (auto* manifest_ptr = std::get_if<Manifest>(&decoded)) {
+          auto& manifest = *manifest_ptr;
+          if (manifest.versions.empty()) {
+            set_error(absl::DataLossError(
+                          "Expected versions in numbered manifest"),
+                      "decoding");
+            return;
+          }
+          if (manifest.config.manifest_kind == ManifestKind::kSingle) {
+            manifest.config.manifest_kind = ManifestKind::kNumbered;
+          } else if (manifest.config.manifest_kind !=
+                     ManifestKind::kNumberedDelta) {
+            set_error(
+                absl::DataLossError(tensorstore::StrCat(
+                    "Expected single-file or numbered_delta manifest kind, "
+                    "but received: ",
+                    manifest.config.manifest_kind)),
+                "decoding");
+            return;
+          }
+
+          if (manifest.latest_generation() != generation_number) {
+            set_error(absl::DataLossError(absl::StrFormat(
+                          "Expected generation number %d, but "
+                          "received: %d",
+                          generation_number, manifest.latest_generation())),
+                      "decoding");
+            return;
+          }
+          auto shared_manifest =
+              std::make_shared<Manifest>(std::move(manifest));
+          // A full snapshot serves as its own base for subsequent deltas.
+          auto new_base_snapshot =
+              shared_manifest->config.manifest_kind ==
+                      ManifestKind::kNumberedDelta
+                  ? shared_manifest
+                  : nullptr;
+          execution::set_value(receiver, std::move(shared_manifest),
+                               std::move(new_base_snapshot),
+                               read_result.stamp.time);
           return;
         }
 
-        manifest.config.manifest_kind = ManifestKind::kNumbered;
-
-        if (manifest.latest_generation() != generation_number) {
+        auto& delta = std::get<ManifestDelta>(decoded);
+        if (delta.versions.back().generation_number != generation_number) {
           set_error(absl::DataLossError(absl::StrFormat(
                         "Expected generation number %d, but "
                         "received: %d",
-                        generation_number, manifest.latest_generation())),
+                        generation_number,
+                        delta.versions.back().generation_number)),
                     "decoding");
           return;
         }
-        execution::set_value(receiver,
-                             std::make_shared<Manifest>(std::move(manifest)),
-                             read_result.stamp.time);
+
+        if (base_snapshot &&
+            base_snapshot->latest_generation() == delta.base_generation) {
+          // Base snapshot is already cached; no additional read is needed.
+          TENSORSTORE_ASSIGN_OR_RETURN(
+              auto manifest, ApplyManifestDelta(*base_snapshot, delta),
+              set_error(_, "decoding"));
+          execution::set_value(
+              receiver, std::make_shared<Manifest>(std::move(manifest)),
+              std::move(base_snapshot), read_result.stamp.time);
+          return;
+        }
+
+        ReadBaseSnapshotManifest(entry, std::move(delta),
+                                 read_result.stamp.time, std::move(receiver));
       }));
 }
 
 template <typename Receiver>
 void ListAndReadNumberedManifests(
     NumberedManifestCache::Entry* entry,
-    std::shared_ptr<const Manifest> cached_manifest, absl::Time time,
+    std::shared_ptr<const Manifest> cached_manifest,
+    std::shared_ptr<const Manifest> cached_base_snapshot, absl::Time time,
     Receiver receiver) {
   struct ManifestReadReceiver {
     NumberedManifestCache::Entry* entry;
     std::shared_ptr<NumberedManifest> numbered_manifest;
     Receiver receiver;
 
-    void set_value(std::shared_ptr<const Manifest> manifest, absl::Time time) {
+    void set_value(std::shared_ptr<const Manifest> manifest,
+                   std::shared_ptr<const Manifest> base_snapshot,
+                   absl::Time time) {
       if (!manifest) {
         // Manifest was deleted, retry list.
-        ListAndReadNumberedManifests(entry, /*cached_manifest=*/{}, time,
+        ListAndReadNumberedManifests(entry, /*cached_manifest=*/{},
+                                     /*cached_base_snapshot=*/{}, time,
                                      std::move(receiver));
         return;
       }
       numbered_manifest->manifest = std::move(manifest);
+      numbered_manifest->base_snapshot = std::move(base_snapshot);
       execution::set_value(receiver, std::move(numbered_manifest), time);
     }
     void set_error(absl::Status error) {
@@ -536,6 +658,7 @@ void ListAndReadNumberedManifests(
   struct ManifestListReceiver {
     NumberedManifestCache::Entry* entry;
     std::shared_ptr<const Manifest> cached_manifest;
+    std::shared_ptr<const Manifest> cached_base_snapshot;
     Receiver receiver;
 
     void set_value(std::vector<GenerationNumber> versions_present,
@@ -556,12 +679,13 @@ void ListAndReadNumberedManifests(
         ABSL_LOG_IF(INFO, ocdbt_logging)
             << "Using cached numbered manifest: " << generation_number;
         numbered_manifest->manifest = std::move(cached_manifest);
+        numbered_manifest->base_snapshot = std::move(cached_base_snapshot);
         execution::set_value(receiver, std::move(numbered_manifest), time);
         return;
       }
 
       ReadNumberedManifest(
-          entry, generation_number, time,
+          entry, generation_number, std::move(cached_base_snapshot), time,
           ManifestReadReceiver{entry, std::move(numbered_manifest),
                                std::move(receiver)});
     }
@@ -570,9 +694,11 @@ void ListAndReadNumberedManifests(
       execution::set_error(receiver, std::move(error));
     }
   };
-  ListNumberedManifests(entry, time,
-                        ManifestListReceiver{entry, std::move(cached_manifest),
-                                             std::move(receiver)});
+  ListNumberedManifests(
+      entry, time,
+      ManifestListReceiver{entry, std::move(cached_manifest),
+                           std::move(cached_base_snapshot),
+                           std::move(receiver)});
 }
 
 ReadState GetReadState(
@@ -605,14 +731,17 @@ void DoNumberedReadImpl(EntryOrNode* entry_or_node,
   auto& entry = GetOwningEntry(*entry_or_node);
 
   std::shared_ptr<const Manifest> cached_manifest;
+  std::shared_ptr<const Manifest> cached_base_snapshot;
   {
     internal::AsyncCache::ReadLock<NumberedManifest> lock(entry);
     const auto* existing_numbered_manifest = lock.data();
     if (existing_numbered_manifest && existing_numbered_manifest->manifest) {
       cached_manifest = existing_numbered_manifest->manifest;
+      cached_base_snapshot = existing_numbered_manifest->base_snapshot;
     }
   }
   ListAndReadNumberedManifests(&entry, std::move(cached_manifest),
+                               std::move(cached_base_snapshot),
                                request.staleness_bound,
                                Receiver{entry_or_node});
 }
@@ -744,10 +873,43 @@ void NumberedManifestCache::TransactionNode::Commit() {
 
   auto& cache = GetOwningCache(entry);
 
-  TENSORSTORE_ASSIGN_OR_RETURN(
-      auto encoded_manifest,
-      EncodeManifest(*new_manifest, /*encode_as_single=*/true),
-      SetWritebackError(this, new_generation_number, "encoding", _));
+  absl::Cord encoded_manifest;
+  if (new_manifest->config.manifest_kind == ManifestKind::kNumberedDelta) {
+    // Write a delta against the most recent full snapshot if it is still
+    // recent enough and its state is a prefix of the new manifest; otherwise
+    // write a new full snapshot.
+    std::shared_ptr<const Manifest> base_snapshot;
+    if (existing_numbered_manifest) {
+      base_snapshot = existing_numbered_manifest->base_snapshot;
+    }
+    GenerationNumber base_generation = 0;
+    if (base_snapshot &&
+        new_generation_number - base_snapshot->latest_generation() <
+            kManifestDeltaSnapshotInterval &&
+        new_manifest->config == base_snapshot->config &&
+        new_manifest->version_tree_nodes ==
+            base_snapshot->version_tree_nodes &&
+        new_manifest->versions.size() > base_snapshot->versions.size() &&
+        std::equal(base_snapshot->versions.begin(),
+                   base_snapshot->versions.end(),
+                   new_manifest->versions.begin())) {
+      base_generation = base_snapshot->latest_generation();
+    }
+    ABSL_LOG_IF(INFO, ocdbt_logging)
+        << "Writing numbered manifest " << new_generation_number
+        << " with delta base generation " << base_generation
+        << " (0 indicates a full snapshot)";
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        encoded_manifest, EncodeManifestDelta(*new_manifest, base_generation),
+        SetWritebackError(this, new_generation_number, "encoding", _));
+    this->new_base_snapshot =
+        base_generation != 0 ? std::move(base_snapshot) : new_manifest;
+  } else {
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        encoded_manifest,
+        EncodeManifest(*new_manifest, /*encode_as_single=*/true),
+        SetWritebackError(this, new_generation_number, "encoding", _));
+  }
 
   kvstore::WriteOptions write_options;
   write_options.generation_conditions.if_equal = StorageGeneration::NoValue();
@@ -824,7 +986,8 @@ void NumberedManifestCache::TransactionNode::Commit() {
         };
 
         ListAndReadNumberedManifests(&GetOwningEntry(*this), this->new_manifest,
-                                     absl::Now(), Receiver{this});
+                                     this->new_base_snapshot, absl::Now(),
+                                     Receiver{this});
       });
 }
 
@@ -106,11 +106,15 @@ class NumberedManifestCache : public internal::AsyncCache {
   struct NumberedManifest {
     // Most recent manifest observed.
     std::shared_ptr<const Manifest> manifest;
+    // Full snapshot manifest from which `manifest` was delta-encoded, equal to
+    // `manifest` if the newest manifest file is itself a snapshot.  Only set
+    // for `ManifestKind::kNumberedDelta`.
+    std::shared_ptr<const Manifest> base_snapshot;
     // List of versions present, needed to delete the previous version.
     std::vector<GenerationNumber> versions_present;
 
     constexpr static auto ApplyMembers = [](auto&& x, auto f) {
-      return f(x.manifest, x.versions_present);
+      return f(x.manifest, x.base_snapshot, x.versions_present);
     };
   };
 
@@ -154,6 +158,9 @@ class NumberedManifestCache : public internal::AsyncCache {
     void Commit() final;
 
     std::shared_ptr<const Manifest> new_manifest;
+    // Snapshot manifest serving as the base of `new_manifest` once written
+    // (`ManifestKind::kNumberedDelta` only).
+    std::shared_ptr<const Manifest> new_base_snapshot;
     Promise<TryUpdateManifestResult> promise;
   };
 
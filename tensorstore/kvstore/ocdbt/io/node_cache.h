@@ -22,9 +22,11 @@
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/absl_check.h"
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "tensorstore/context.h"
 #include "tensorstore/internal/cache/async_cache.h"
@@ -34,8 +36,6 @@
 #include "tensorstore/internal/concurrency_resource.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/estimate_heap_usage/estimate_heap_usage.h"
-#include "tensorstore/internal/estimate_heap_usage/std_variant.h"
-#include "tensorstore/internal/estimate_heap_usage/std_vector.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/data_file_id.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
@@ -45,10 +45,35 @@
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
 #include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
 
 namespace tensorstore {
 namespace internal_ocdbt {
 
+/// Two-state cache representation of a lazily-decoded data structure.
+///
+/// Only the encoded representation, which for b+tree nodes is typically
+/// several times smaller than the decoded form, is retained by the cache, so
+/// that cache memory accounting and eviction operate on the encoded size.
+/// The decoded representation is produced on first access and shared by all
+/// concurrent users, but is only weakly referenced here: once no in-flight
+/// operation references it, it is freed and re-created from the encoded
+/// representation on the next access, while the encoded representation
+/// remains cached.
+template <typename T>
+struct LazilyDecodedData {
+  /// Encoded representation.
+  absl::Cord encoded;
+
+  /// Base path used when decoding `encoded`.
+  BasePath base_path;
+
+  mutable absl::Mutex mutex;
+
+  /// Most recently decoded representation, if still referenced by a caller.
+  mutable std::weak_ptr<const T> decoded ABSL_GUARDED_BY(mutex);
+};
+
 template <typename Derived, typename T>
 class DecodedIndirectDataCache
     : public internal::KvsBackedCache<DecodedIndirectDataCache<Derived, T>,
@@ -61,7 +86,19 @@ class DecodedIndirectDataCache
                                     Executor executor)
       : Base(std::move(kvstore_driver)), executor_(std::move(executor)) {}
 
-  using ReadData = T;
+  using ReadData = LazilyDecodedData<T>;
+
+  /// Returns the decoded representation of `data`, decoding the retained
+  /// encoded representation if no decoded copy is currently referenced.
+  static Result<std::shared_ptr<const T>> GetDecoded(const ReadData& data) {
+    absl::MutexLock lock(&data.mutex);
+    if (auto decoded = data.decoded.lock()) return decoded;
+    auto decoded = std::make_shared<T>();
+    TENSORSTORE_ASSIGN_OR_RETURN(
+        *decoded, Derived::Decode(data.encoded, data.base_path));
+    data.decoded = decoded;
+    return decoded;
+  }
 
   class Entry : public Base::Entry {
    public:
@@ -69,8 +106,9 @@ class DecodedIndirectDataCache
     using typename Base::Entry::DecodeReceiver;
 
     size_t ComputeReadDataSizeInBytes(const void* read_data) override {
-      return internal::EstimateHeapUsage(
-          *static_cast<const ReadData*>(read_data));
+      auto& data = *static_cast<const ReadData*>(read_data);
+      return sizeof(ReadData) + internal::EstimateHeapUsage(data.encoded) +
+             data.base_path.size();
     }
 
     void DoDecode(std::optional<absl::Cord> value,
@@ -82,15 +120,12 @@ class DecodedIndirectDataCache
       IndirectDataReference ref;
       ABSL_CHECK(ref.DecodeCacheKey(this->key()));
 
-      GetOwningCache(*this).executor()(
-          [value = *std::move(value), base_path = ref.file_id.base_path,
-           receiver = std::move(receiver)]() mutable {
-            auto read_data = std::make_shared<T>();
-            TENSORSTORE_ASSIGN_OR_RETURN(
-                *read_data, Derived::Decode(value, base_path),
-                static_cast<void>(execution::set_error(receiver, _)));
-            execution::set_value(receiver, std::move(read_data));
-          });
+      // Decoding is deferred until first access via `GetDecoded`; only the
+      // encoded representation is stored in the cache.
+      auto read_data = std::make_shared<ReadData>();
+      read_data->encoded = *std::move(value);
+      read_data->base_path = ref.file_id.base_path;
+      execution::set_value(receiver, std::move(read_data));
     }
   };
 
@@ -117,8 +152,9 @@ class DecodedIndirectDataCache
                [entry = std::move(entry)](
                    Promise<std::shared_ptr<const T>> promise,
                    ReadyFuture<const void> future) {
-                 promise.SetResult(
-                     internal::AsyncCache::ReadLock<T>(*entry).shared_data());
+                 auto data = internal::AsyncCache::ReadLock<ReadData>(*entry)
+                                 .shared_data();
+                 promise.SetResult(Derived::GetDecoded(*data));
                },
                entry_ptr->Read({staleness_bound}))
         .future;
@@ -17,14 +17,32 @@
 #include <utility>
 
 #include "absl/status/status.h"
+#include "absl/strings/cord.h"
 #include "absl/synchronization/mutex.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/executor.h"
 #include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 namespace internal_ocdbt {
 
 ReadonlyIoHandle::~ReadonlyIoHandle() = default;
 
+Future<const absl::Cord> ReadonlyIoHandle::GetBtreeNodeEncoded(
+    const IndirectDataReference& ref) const {
+  return MapFutureValue(
+      InlineExecutor{},
+      [](kvstore::ReadResult& read_result) -> Result<absl::Cord> {
+        if (!read_result.has_value()) {
+          return absl::NotFoundError("");
+        }
+        return std::move(read_result.value);
+      },
+      ReadIndirectData(ref, {}));
+}
+
 FlushPromise::FlushPromise(FlushPromise&& other) noexcept
     : prev_linked_future_(std::move(other.prev_linked_future_)),
       promise_(std::move(other.promise_)),
@@ -48,6 +48,15 @@ class ReadonlyIoHandle
   virtual Future<const std::shared_ptr<const BtreeNode>> GetBtreeNode(
       const IndirectDataReference& ref) const = 0;
 
+  /// Reads the encoded representation of the B+tree node at the specified
+  /// location.
+  ///
+  /// The default implementation reads via `ReadIndirectData`.
+  /// Implementations backed by a node cache should instead serve (and
+  /// retain) the cached encoded representation.
+  virtual Future<const absl::Cord> GetBtreeNodeEncoded(
+      const IndirectDataReference& ref) const;
+
   /// Reads the version tree node at the specified location.
   virtual Future<const std::shared_ptr<const VersionTreeNode>>
   GetVersionTreeNode(const IndirectDataReference& ref) const = 0;
@@ -0,0 +1,197 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/bulk_load.h"
+
+#include <stddef.h>
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/ocdbt/config.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
+#include "tensorstore/kvstore/ocdbt/format/config.h"
+#include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
+#include "tensorstore/kvstore/ocdbt/format/manifest.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/create_new_manifest.h"
+#include "tensorstore/kvstore/ocdbt/non_distributed/write_nodes.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+// Number of leaf nodes worth of entries to buffer before encoding and
+// writing them.  A larger factor amortizes per-`Finalize` overhead and
+// reduces the number of under-filled nodes at flush boundaries.
+constexpr size_t kLeafFlushFactor = 4;
+
+}  // namespace
+
+BulkLoader::BulkLoader(IoHandle::Ptr io_handle)
+    : io_handle_(std::move(io_handle)) {}
+
+Future<const void> BulkLoader::Initialize() {
+  return PromiseFuturePair<void>::LinkValue(
+             [this](Promise<void> promise,
+                    ReadyFuture<const absl::Time> future) {
+               LinkValue(
+                   [this](Promise<void> promise,
+                          ReadyFuture<const ManifestWithTime> future) {
+                     existing_manifest_ = future.value().manifest;
+                     promise.SetResult(absl::OkStatus());
+                   },
+                   std::move(promise),
+                   io_handle_->GetManifest(future.value()));
+             },
+             EnsureExistingManifest(io_handle_))
+      .future;
+}
+
+absl::Status BulkLoader::AddEntry(std::string key, absl::Cord value) {
+  // `Initialize` must have completed successfully.
+  assert(existing_manifest_);
+  auto* config = io_handle_->config_state->GetExistingConfig();
+  assert(config);
+  if (has_entries_ && key <= last_key_) {
+    return absl::InvalidArgumentError(tensorstore::StrCat(
+        "Key ", tensorstore::QuoteString(key),
+        " is not greater than previously added key ",
+        tensorstore::QuoteString(last_key_)));
+  }
+  last_key_ = key;
+  has_entries_ = true;
+
+  auto& pending = pending_.emplace_back();
+  pending.key = std::move(key);
+  if (value.size() > config->max_inline_value_bytes) {
+    // Store the value out-of-line, as the normal commit path would.
+    flush_promise_.Link(io_handle_->WriteData(
+        IndirectDataKind::kValue, std::move(value),
+        pending.value_reference.emplace<IndirectDataReference>()));
+  } else {
+    pending_bytes_ += value.size();
+    pending.value_reference = std::move(value);
+  }
+  pending_bytes_ += pending.key.size();
+
+  if (pending_bytes_ >=
+      kLeafFlushFactor * static_cast<size_t>(config->max_decoded_node_bytes)) {
+    return FlushLeaves();
+  }
+  return absl::OkStatus();
+}
+
+absl::Status BulkLoader::FlushLeaves() {
+  if (pending_.empty()) return absl::OkStatus();
+  auto* config = io_handle_->config_state->GetExistingConfig();
+  assert(config);
+  // The root node must not have an excluded key prefix; `may_be_root` must
+  // therefore be `true` whenever the first (and possibly only) leaf node may
+  // end up as the root.
+  const bool may_be_root = leaf_entries_.empty();
+  BtreeLeafNodeEncoder encoder(*config, /*height=*/0, /*existing_prefix=*/{});
+  if (bloom_filters_enabled_) encoder.CollectSubtreeKeyHashes();
+  for (auto& pending : pending_) {
+    LeafNodeEntry entry;
+    entry.key = pending.key;
+    entry.value_reference = std::move(pending.value_reference);
+    encoder.AddEntry(/*existing=*/false, std::move(entry));
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto encoded_nodes,
+                               encoder.Finalize(may_be_root));
+  auto new_entries = internal_ocdbt::WriteNodes(
+      *io_handle_, flush_promise_, std::move(encoded_nodes),
+      bloom_filters_enabled_ ? &leaf_entry_key_hashes_ : nullptr);
+  leaf_entries_.insert(leaf_entries_.end(),
+                       std::make_move_iterator(new_entries.begin()),
+                       std::make_move_iterator(new_entries.end()));
+  pending_.clear();
+  pending_bytes_ = 0;
+  return absl::OkStatus();
+}
+
+Future<const void> BulkLoader::Finish() {
+  assert(existing_manifest_);
+  if (!existing_manifest_->latest_version().root.location.IsMissing()) {
+    return absl::FailedPreconditionError(
+        "Bulk load requires an empty database");
+  }
+  TENSORSTORE_RETURN_IF_ERROR(FlushLeaves());
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto new_generation,
+      WriteRootNode(*io_handle_, flush_promise_, /*height=*/0,
+                    std::move(leaf_entries_),
+                    std::move(leaf_entry_key_hashes_)));
+  auto [promise, future] = PromiseFuturePair<void>::Make();
+  LinkValue(
+      [this](Promise<void> promise,
+             ReadyFuture<std::pair<std::shared_ptr<Manifest>,
+                                   Future<const void>>>
+                 future) {
+        auto& create_result = future.value();
+        flush_promise_.Link(std::move(create_result.second));
+        new_manifest_ = std::move(create_result.first);
+        auto flush_future = std::move(flush_promise_).future();
+        if (flush_future.null()) {
+          WriteManifest(std::move(promise));
+          return;
+        }
+        flush_future.Force();
+        LinkValue(
+            [this](Promise<void> promise, ReadyFuture<const void>) {
+              WriteManifest(std::move(promise));
+            },
+            std::move(promise), std::move(flush_future));
+      },
+      std::move(promise),
+      internal_ocdbt::CreateNewManifest(io_handle_, existing_manifest_,
+                                        new_generation));
+  return std::move(future);
+}
+
+void BulkLoader::WriteManifest(Promise<void> promise) {
+  auto update_future = io_handle_->TryUpdateManifest(
+      existing_manifest_, new_manifest_, absl::Now());
+  update_future.Force();
+  LinkValue(
+      [](Promise<void> promise, ReadyFuture<TryUpdateManifestResult> future) {
+        if (!future.value().success) {
+          // Unlike the normal commit path, there is nothing sensible to merge
+          // with: the tree was built assuming an empty database.
+          promise.SetResult(absl::AbortedError(
+              "Database was concurrently modified during bulk load"));
+          return;
+        }
+        promise.SetResult(absl::OkStatus());
+      },
+      std::move(promise), std::move(update_future));
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
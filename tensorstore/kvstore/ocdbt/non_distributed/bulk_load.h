@@ -0,0 +1,111 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
+#define TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/manifest.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Builds a B+tree bottom-up from entries supplied in ascending key order.
+///
+/// The normal `BtreeWriter` commit path performs a read-modify-write traversal
+/// of interior nodes for every commit, which is wasteful when ingesting a
+/// large dataset into an empty database.  `BulkLoader` instead streams sorted
+/// entries directly into leaf nodes, then writes the interior levels bottom-up
+/// and commits a single new manifest.
+///
+/// Usage:
+///
+/// 1. Call `Initialize` and wait for the returned future to become ready.
+/// 2. Call `AddEntry` for each entry, in strictly ascending key order.  Leaf
+///    nodes and out-of-line values are written incrementally, so memory usage
+///    is proportional to the number of leaf nodes, not the number of entries.
+/// 3. Call `Finish`, which writes the interior levels and atomically commits
+///    the new manifest.  The commit fails without modifying the database if
+///    the database is non-empty or was modified concurrently.
+///
+/// The `BulkLoader` must remain valid until the future returned by `Finish`
+/// becomes ready, and is not thread-safe.
+class BulkLoader {
+ public:
+  explicit BulkLoader(IoHandle::Ptr io_handle);
+
+  BulkLoader(const BulkLoader&) = delete;
+  BulkLoader& operator=(const BulkLoader&) = delete;
+
+  /// Ensures the manifest (and database configuration) exists.  Must complete
+  /// successfully before `AddEntry` is called.
+  Future<const void> Initialize();
+
+  /// Enables embedding bloom filters in the interior nodes of the written
+  /// tree, which allows subsequent point lookups of absent keys to usually
+  /// terminate at an already-cached interior node.  Must be called before
+  /// `AddEntry`.
+  ///
+  /// Requires approximately `sizeof(BloomFilterKeyHash)` bytes of additional
+  /// memory per added entry for the duration of the load.
+  void EnableBloomFilters() { bloom_filters_enabled_ = true; }
+
+  /// Adds the next entry.  Keys must be strictly ascending.
+  absl::Status AddEntry(std::string key, absl::Cord value);
+
+  /// Writes the interior levels and commits a single new manifest.
+  Future<const void> Finish();
+
+ private:
+  struct PendingEntry {
+    std::string key;
+    LeafNodeValueReference value_reference;
+  };
+
+  // Encodes and writes the buffered `pending_` entries as leaf nodes,
+  // appending the resulting child references to `leaf_entries_`.
+  absl::Status FlushLeaves();
+
+  void WriteManifest(Promise<void> promise);
+
+  IoHandle::Ptr io_handle_;
+  std::shared_ptr<const Manifest> existing_manifest_;
+  std::shared_ptr<const Manifest> new_manifest_;
+  FlushPromise flush_promise_;
+
+  std::vector<PendingEntry> pending_;
+  size_t pending_bytes_ = 0;
+  std::vector<InteriorNodeEntryData<std::string>> leaf_entries_;
+  // Parallel to `leaf_entries_` if `bloom_filters_enabled_`.
+  std::vector<std::vector<BloomFilterKeyHash>> leaf_entry_key_hashes_;
+  std::string last_key_;
+  bool has_entries_ = false;
+  bool bloom_filters_enabled_ = false;
+};
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_BULK_LOAD_H_
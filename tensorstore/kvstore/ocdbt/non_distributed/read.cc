@@ -33,6 +33,7 @@
 #include "tensorstore/internal/type_traits.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
 #include "tensorstore/kvstore/ocdbt/format/manifest.h"
@@ -200,6 +201,12 @@ struct ReadOperation : public internal::AtomicReferenceCount<ReadOperation> {
   static void VisitInteriorNode(ReadOperation::Ptr op, const BtreeNode& node,
                                 Promise<kvstore::ReadResult> promise,
                                 std::string_view unmatched_key_suffix) {
+    if (!BloomFilterMayContainKey(op->key, node.bloom_filter)) {
+      // The bloom filter embedded in the node establishes that the key is not
+      // present anywhere in the subtree, without descending further.
+      op->KeyNotPresent(promise);
+      return;
+    }
     auto* entry =
         FindBtreeEntry(std::get<BtreeNode::InteriorNodeEntries>(node.entries),
                        unmatched_key_suffix);
@@ -0,0 +1,294 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/scan.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "absl/base/attributes.h"
+#include "absl/log/absl_log.h"
+#include "absl/status/status.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/format/manifest.h"
+#include "tensorstore/kvstore/ocdbt/format/version_tree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/execution/execution.h"
+#include "tensorstore/util/execution/flow_sender_operation_state.h"
+#include "tensorstore/util/executor.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/quote_string.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/span.h"
+#include "tensorstore/util/status.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+namespace {
+
+ABSL_CONST_INIT internal_log::VerboseFlag ocdbt_logging("ocdbt");
+
+using ::tensorstore::kvstore::ListEntry;
+using ::tensorstore::kvstore::ListReceiver;
+
+// Asynchronous operation state used to implement `NonDistributedScan`.
+//
+// The scan is implemented as follows:
+//
+// 1. Resolve the root b+tree node by reading the manifest.
+//
+// 2. Maintain a cursor over the tree as a deque of node references in key
+//    order: the front of the deque is the next node to visit, and expanding
+//    an interior node replaces it with its matching children.  The deque
+//    therefore holds the unvisited right siblings along the current descent
+//    path.
+//
+// 3. Issue reads for up to `prefetch_limit` nodes at the front of the deque,
+//    but process only the front node once its read completes: leaf node
+//    entries are emitted to the receiver, in key order, while the prefetched
+//    sibling reads proceed in the background.
+struct ScanOperation
+    : public internal::FlowSenderOperationState<std::string_view,
+                                                span<const LeafNodeEntry>> {
+  using Ptr = internal::IntrusivePtr<ScanOperation>;
+  using Base = internal::FlowSenderOperationState<std::string_view,
+                                                  span<const LeafNodeEntry>>;
+
+  using Base::Base;
+
+  ReadonlyIoHandle::Ptr io_handle;
+  KeyRange range;
+  size_t prefetch_limit;
+
+  // Unvisited node in cursor order.
+  struct PendingNode {
+    BtreeNodeReference node_ref;
+    BtreeNodeHeight node_height;
+
+    // Full inclusive min key for the node.
+    std::string inclusive_min_key;
+
+    // Specifies the length of the implicit prefix that is excluded from the
+    // encoded representation of the node.  The prefix is equal to
+    // `inclusive_min_key.substr(0, subtree_common_prefix_length)`.
+    KeyLength subtree_common_prefix_length;
+
+    // Read future, null until the node comes within the prefetch window.
+    Future<const std::shared_ptr<const BtreeNode>> read_future;
+  };
+
+  // Cursor state.  Accessed only by the single in-flight callback chain, and
+  // therefore requires no synchronization.
+  std::deque<PendingNode> cursor;
+
+  static Ptr Initialize(ReadonlyIoHandle::Ptr&& io_handle, ScanOptions&& options,
+                        BaseReceiver&& receiver) {
+    auto op = internal::MakeIntrusivePtr<ScanOperation>(std::move(receiver));
+    op->io_handle = std::move(io_handle);
+    op->range = std::move(options.range);
+    op->prefetch_limit = std::max(size_t(1), options.prefetch_limit);
+    return op;
+  }
+
+  // Called when the manifest lookup has completed.
+  struct ManifestReadyCallback {
+    ScanOperation::Ptr op;
+    void operator()(Promise<void> promise,
+                    ReadyFuture<const ManifestWithTime> read_future) {
+      TENSORSTORE_ASSIGN_OR_RETURN(auto manifest_with_time,
+                                   read_future.result(), op->SetError(_));
+      const auto* manifest = manifest_with_time.manifest.get();
+      if (!manifest || manifest->latest_version().root.location.IsMissing()) {
+        // Manifest not present or btree is empty.
+        return;
+      }
+      auto& latest_version = manifest->versions.back();
+      auto& pending = op->cursor.emplace_back();
+      pending.node_ref = latest_version.root;
+      pending.node_height = latest_version.root_height;
+      pending.subtree_common_prefix_length = 0;
+      IssuePrefetches(*op);
+      ProcessFront(std::move(op));
+    }
+  };
+
+  // Starts reads for the nodes within the prefetch window.
+  static void IssuePrefetches(ScanOperation& op) {
+    const size_t limit = std::min(op.prefetch_limit, op.cursor.size());
+    for (size_t i = 0; i < limit; ++i) {
+      auto& pending = op.cursor[i];
+      if (!pending.read_future.null()) continue;
+      pending.read_future = op.io_handle->GetBtreeNode(pending.node_ref.location);
+      pending.read_future.Force();
+    }
+  }
+
+  // Resumes the scan once the read of the front node completes.
+  static void ProcessFront(ScanOperation::Ptr op) {
+    if (op->cursor.empty() || op->cancelled()) return;
+    auto* op_ptr = op.get();
+    Link(WithExecutor(op_ptr->io_handle->executor,
+                      FrontNodeReadyCallback{std::move(op)}),
+         op_ptr->promise, op_ptr->cursor.front().read_future);
+  }
+
+  // Called when the read of the front node completes.
+  struct FrontNodeReadyCallback {
+    ScanOperation::Ptr op;
+
+    void operator()(
+        Promise<void> promise,
+        ReadyFuture<const std::shared_ptr<const BtreeNode>> read_future) {
+      TENSORSTORE_ASSIGN_OR_RETURN(auto node, read_future.result(),
+                                   op->SetError(_));
+      if (op->cancelled()) return;
+      auto pending = std::move(op->cursor.front());
+      op->cursor.pop_front();
+      TENSORSTORE_RETURN_IF_ERROR(
+          ValidateBtreeNodeReference(
+              *node, pending.node_height,
+              std::string_view(pending.inclusive_min_key)
+                  .substr(pending.subtree_common_prefix_length)),
+          op->SetError(_));
+      auto& subtree_key_prefix = pending.inclusive_min_key;
+      subtree_key_prefix.resize(pending.subtree_common_prefix_length);
+      subtree_key_prefix += node->key_prefix;
+      auto key_range = KeyRange::RemovePrefix(subtree_key_prefix, op->range);
+
+      if (node->height > 0) {
+        ExpandInteriorNode(*op, *node, subtree_key_prefix, key_range);
+      } else {
+        EmitLeafNode(*op, *node, subtree_key_prefix, key_range);
+      }
+      IssuePrefetches(*op);
+      ProcessFront(std::move(op));
+    }
+  };
+
+  // Replaces the front of the cursor with the matching children of an
+  // interior node, preserving key order.
+  static void ExpandInteriorNode(ScanOperation& op, const BtreeNode& node,
+                                 std::string_view subtree_key_prefix,
+                                 const KeyRange& key_range) {
+    auto& all_entries = std::get<BtreeNode::InteriorNodeEntries>(node.entries);
+    auto entries = FindBtreeEntryRange(all_entries, key_range.inclusive_min,
+                                       key_range.exclusive_max);
+    ABSL_LOG_IF(INFO, ocdbt_logging)
+        << "Scan: ExpandInteriorNode: subtree_key_prefix="
+        << tensorstore::QuoteString(subtree_key_prefix)
+        << ", key_range=" << key_range << ", num matches=" << entries.size();
+    size_t i = 0;
+    for (const auto& entry : entries) {
+      auto& pending = *op.cursor.emplace(op.cursor.begin() + (i++));
+      pending.node_ref = entry.node;
+      pending.node_height = node.height - 1;
+      pending.inclusive_min_key =
+          tensorstore::StrCat(subtree_key_prefix, entry.key);
+      pending.subtree_common_prefix_length = static_cast<KeyLength>(
+          subtree_key_prefix.size() + entry.subtree_common_prefix_length);
+    }
+  }
+
+  // Emits the matching entries of a leaf node.
+  static void EmitLeafNode(ScanOperation& op, const BtreeNode& node,
+                           std::string_view subtree_key_prefix,
+                           const KeyRange& key_range) {
+    auto& all_entries = std::get<BtreeNode::LeafNodeEntries>(node.entries);
+    auto entries = FindBtreeEntryRange(all_entries, key_range.inclusive_min,
+                                       key_range.exclusive_max);
+    ABSL_LOG_IF(INFO, ocdbt_logging)
+        << "Scan: EmitLeafNode: subtree_key_prefix="
+        << tensorstore::QuoteString(subtree_key_prefix)
+        << ", key_range=" << key_range << ", num matches=" << entries.size();
+    if (entries.empty()) return;
+    execution::set_value(op.shared_receiver->receiver, subtree_key_prefix,
+                         entries);
+  }
+};
+
+// Adapts a kvstore List receiver into the receiver type expected by
+// `ScanOperation`.
+struct ScanKeyReceiverAdapter {
+  ListReceiver receiver;
+  size_t strip_prefix_length = 0;
+
+  void set_done() { execution::set_done(receiver); }
+
+  void set_error(absl::Status&& error) {
+    execution::set_error(receiver, std::move(error));
+  }
+
+  void set_value(std::string_view key_prefix,
+                 span<const LeafNodeEntry> entries) {
+    for (const auto& entry : entries) {
+      auto key = tensorstore::StrCat(
+          std::string_view(key_prefix)
+              .substr(std::min(key_prefix.size(), strip_prefix_length)),
+          std::string_view(entry.key).substr(
+              std::min(entry.key.size(),
+                       strip_prefix_length -
+                           std::min(strip_prefix_length, key_prefix.size()))));
+      execution::set_value(receiver,
+                           ListEntry{
+                               std::move(key),
+                               ListEntry::checked_size(entry.value_size()),
+                           });
+    }
+  }
+
+  template <typename Cancel>
+  void set_starting(Cancel&& cancel) {
+    execution::set_starting(receiver, std::forward<Cancel>(cancel));
+  }
+
+  void set_stopping() { execution::set_stopping(receiver); }
+};
+
+}  // namespace
+
+void NonDistributedScan(
+    ReadonlyIoHandle::Ptr io_handle, ScanOptions&& options,
+    AnyFlowReceiver<absl::Status, std::string_view, span<const LeafNodeEntry>>&&
+        receiver) {
+  const auto staleness_bound = options.staleness_bound;
+  auto op = ScanOperation::Initialize(std::move(io_handle), std::move(options),
+                                      std::move(receiver));
+  auto* op_ptr = op.get();
+  Link(WithExecutor(op_ptr->io_handle->executor,
+                    ScanOperation::ManifestReadyCallback{std::move(op)}),
+       op_ptr->promise, op_ptr->io_handle->GetManifest(staleness_bound));
+}
+
+void NonDistributedScan(ReadonlyIoHandle::Ptr io_handle, ScanOptions&& options,
+                        ListReceiver&& receiver) {
+  const size_t strip_prefix_length = options.strip_prefix_length;
+  NonDistributedScan(
+      std::move(io_handle), std::move(options),
+      ScanKeyReceiverAdapter{std::move(receiver), strip_prefix_length});
+}
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
@@ -0,0 +1,75 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_SCAN_H_
+#define TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_SCAN_H_
+
+#include <stddef.h>
+
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/ocdbt/format/btree.h"
+#include "tensorstore/kvstore/ocdbt/io_handle.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/execution/any_receiver.h"
+#include "tensorstore/util/span.h"
+
+namespace tensorstore {
+namespace internal_ocdbt {
+
+/// Options for `NonDistributedScan`.
+struct ScanOptions {
+  /// Key range constraint.
+  KeyRange range;
+
+  /// Number of bytes to strip from the beginning of emitted keys.
+  size_t strip_prefix_length = 0;
+
+  /// Staleness bound on the manifest.
+  absl::Time staleness_bound = absl::InfiniteFuture();
+
+  /// Maximum number of B+tree node reads issued ahead of the batch currently
+  /// being emitted.
+  size_t prefetch_limit = 8;
+};
+
+/// Streams the leaf node entries intersecting `options.range`, in key order.
+///
+/// Unlike `NonDistributedList`, which descends the B+tree in parallel and
+/// emits batches in arbitrary order, the scan maintains its descent stack
+/// between batches and visits leaf nodes strictly in key order, issuing up to
+/// `options.prefetch_limit` node reads ahead of the consumer so that a
+/// full-tree scan is not bound by serial leaf fetches.  Memory usage is
+/// bounded by the prefetch limit.
+///
+/// Each batch consists of the key prefix that applies to the batch and the
+/// entries of a single leaf node; inline values and indirect value references
+/// are included.
+void NonDistributedScan(
+    ReadonlyIoHandle::Ptr io_handle, ScanOptions&& options,
+    AnyFlowReceiver<absl::Status, std::string_view, span<const LeafNodeEntry>>&&
+        receiver);
+
+/// Same as above, but emits `kvstore::ListEntry` values in key order, for use
+/// with the normal kvstore list flow.
+void NonDistributedScan(ReadonlyIoHandle::Ptr io_handle, ScanOptions&& options,
+                        kvstore::ListReceiver&& receiver);
+
+}  // namespace internal_ocdbt
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_OCDBT_NON_DISTRIBUTED_SCAN_H_
@@ -0,0 +1,118 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/ocdbt/non_distributed/scan.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/notification.h"
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/ocdbt/test_util.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+using ::tensorstore::Context;
+using ::tensorstore::KeyRange;
+using ::tensorstore::internal_ocdbt::GetOcdbtIoHandle;
+using ::tensorstore::internal_ocdbt::NonDistributedScan;
+using ::tensorstore::internal_ocdbt::ScanOptions;
+
+// Collects the keys emitted by a scan.
+struct CollectingListReceiver {
+  std::vector<std::string>* keys;
+  absl::Status* status;
+  absl::Notification* done;
+
+  template <typename Cancel>
+  void set_starting(Cancel&& cancel) {}
+  void set_value(kvstore::ListEntry entry) {
+    keys->push_back(std::move(entry.key));
+  }
+  void set_error(absl::Status&& error) { *status = std::move(error); }
+  void set_done() {}
+  void set_stopping() { done->Notify(); }
+};
+
+// Opens an OCDBT database over a memory kvstore, with a small node size so
+// that scans traverse a multi-level tree.
+tensorstore::Result<kvstore::KvStore> OpenStore() {
+  return kvstore::Open({{"driver", "ocdbt"},
+                        {"base", "memory://"},
+                        {"config", {{"max_decoded_node_bytes", 500}}}})
+      .result();
+}
+
+std::vector<std::string> Scan(const kvstore::KvStore& store,
+                              ScanOptions&& options) {
+  std::vector<std::string> keys;
+  absl::Status status;
+  absl::Notification done;
+  NonDistributedScan(
+      GetOcdbtIoHandle(*store.driver), std::move(options),
+      kvstore::ListReceiver{CollectingListReceiver{&keys, &status, &done}});
+  done.WaitForNotification();
+  TENSORSTORE_EXPECT_OK(status);
+  return keys;
+}
+
+TEST(ScanTest, ScanEntireTreeInOrder) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; ++i) {
+    auto key = absl::StrFormat("key%03d", i);
+    TENSORSTORE_ASSERT_OK(
+        kvstore::Write(store, key, absl::Cord(absl::StrFormat("value%03d", i))));
+    expected.push_back(key);
+  }
+  ScanOptions options;
+  options.prefetch_limit = 2;
+  EXPECT_THAT(Scan(store, std::move(options)),
+              ::testing::ElementsAreArray(expected));
+}
+
+TEST(ScanTest, ScanRangeWithStripPrefix) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; ++i) {
+    TENSORSTORE_ASSERT_OK(kvstore::Write(store, absl::StrFormat("key%03d", i),
+                                         absl::Cord("value")));
+    if (i >= 20 && i < 40) expected.push_back(absl::StrFormat("%03d", i));
+  }
+  ScanOptions options;
+  options.range = KeyRange("key020", "key040");
+  options.strip_prefix_length = 3;
+  EXPECT_THAT(Scan(store, std::move(options)),
+              ::testing::ElementsAreArray(expected));
+}
+
+TEST(ScanTest, EmptyDatabase) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  EXPECT_THAT(Scan(store, ScanOptions{}), ::testing::IsEmpty());
+}
+
+}  // namespace
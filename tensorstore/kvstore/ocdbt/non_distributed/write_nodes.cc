@@ -22,6 +22,7 @@
 
 #include "absl/status/status.h"
 #include "tensorstore/kvstore/ocdbt/config.h"
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
 #include "tensorstore/kvstore/ocdbt/format/indirect_data_reference.h"
@@ -34,7 +35,8 @@ namespace internal_ocdbt {
 
 std::vector<InteriorNodeEntryData<std::string>> WriteNodes(
     const IoHandle& io_handle, FlushPromise& flush_promise,
-    std::vector<EncodedNode> encoded_nodes) {
+    std::vector<EncodedNode> encoded_nodes,
+    std::vector<std::vector<BloomFilterKeyHash>>* subtree_key_hashes) {
   std::vector<InteriorNodeEntryData<std::string>> new_entries(
       encoded_nodes.size());
   for (size_t i = 0; i < encoded_nodes.size(); ++i) {
@@ -47,6 +49,10 @@ std::vector<InteriorNodeEntryData<std::string>> WriteNodes(
     new_entry.node.statistics = encoded_node.info.statistics;
     new_entry.subtree_common_prefix_length =
         encoded_node.info.excluded_prefix_length;
+    if (subtree_key_hashes) {
+      subtree_key_hashes->push_back(
+          std::move(encoded_node.info.subtree_key_hashes));
+    }
   }
 
   return new_entries;
@@ -55,7 +61,8 @@ std::vector<InteriorNodeEntryData<std::string>> WriteNodes(
 Result<BtreeGenerationReference> WriteRootNode(
     const IoHandle& io_handle, FlushPromise& flush_promise,
     BtreeNodeHeight height,
-    std::vector<InteriorNodeEntryData<std::string>> new_entries) {
+    std::vector<InteriorNodeEntryData<std::string>> new_entries,
+    std::vector<std::vector<BloomFilterKeyHash>> subtree_key_hashes) {
   while (true) {
     if (new_entries.size() <= 1) {
       BtreeGenerationReference new_generation;
@@ -79,13 +86,23 @@ Result<BtreeGenerationReference> WriteRootNode(
     assert(config);
     BtreeInteriorNodeEncoder node_encoder(*config, height,
                                           /*existing_prefix=*/{});
-    for (auto& entry : new_entries) {
-      internal_ocdbt::AddNewInteriorEntry(node_encoder, entry);
+    const bool build_bloom_filters =
+        subtree_key_hashes.size() == new_entries.size();
+    if (build_bloom_filters) node_encoder.CollectSubtreeKeyHashes();
+    for (size_t i = 0; i < new_entries.size(); ++i) {
+      if (build_bloom_filters) {
+        internal_ocdbt::AddNewInteriorEntry(node_encoder, new_entries[i],
+                                            std::move(subtree_key_hashes[i]));
+      } else {
+        internal_ocdbt::AddNewInteriorEntry(node_encoder, new_entries[i]);
+      }
     }
     TENSORSTORE_ASSIGN_OR_RETURN(auto encoded_nodes,
                                  node_encoder.Finalize(/*may_be_root=*/true));
-    new_entries = internal_ocdbt::WriteNodes(io_handle, flush_promise,
-                                             std::move(encoded_nodes));
+    subtree_key_hashes.clear();
+    new_entries = internal_ocdbt::WriteNodes(
+        io_handle, flush_promise, std::move(encoded_nodes),
+        build_bloom_filters ? &subtree_key_hashes : nullptr);
   }
 }
 
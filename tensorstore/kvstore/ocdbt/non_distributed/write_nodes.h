@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 
+#include "tensorstore/kvstore/ocdbt/format/bloom_filter.h"
 #include "tensorstore/kvstore/ocdbt/format/btree.h"
 #include "tensorstore/kvstore/ocdbt/format/btree_node_encoder.h"
 #include "tensorstore/kvstore/ocdbt/format/version_tree.h"
@@ -27,14 +28,27 @@
 namespace tensorstore {
 namespace internal_ocdbt {
 
+/// Writes the specified encoded nodes, and returns corresponding interior
+/// node entries referencing them.
+///
+/// If `subtree_key_hashes` is non-null, the collected key hashes of each
+/// written node are appended to it, parallel to the returned entries.
 std::vector<InteriorNodeEntryData<std::string>> WriteNodes(
     const IoHandle& io_handle, FlushPromise& flush_promise,
-    std::vector<EncodedNode> encoded_nodes);
-
+    std::vector<EncodedNode> encoded_nodes,
+    std::vector<std::vector<BloomFilterKeyHash>>* subtree_key_hashes = nullptr);
+
+/// Writes interior node levels on top of `new_entries` until a single root
+/// node remains, and returns a generation referencing it.
+///
+/// If `subtree_key_hashes` is non-empty, it must parallel `new_entries`, and
+/// bloom filters are embedded in the written interior nodes (subject to
+/// `kMaxBloomFilterKeysPerNode`).
 Result<BtreeGenerationReference> WriteRootNode(
     const IoHandle& io_handle, FlushPromise& flush_promise,
     BtreeNodeHeight height,
-    std::vector<InteriorNodeEntryData<std::string>> new_entries);
+    std::vector<InteriorNodeEntryData<std::string>> new_entries,
+    std::vector<std::vector<BloomFilterKeyHash>> subtree_key_hashes = {});
 
 }  // namespace internal_ocdbt
 }  // namespace tensorstore
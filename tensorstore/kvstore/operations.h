@@ -119,6 +119,15 @@ struct ReadOptions {
 
   /// Optional batch to use.
   Batch batch{no_batch};
+
+  /// Deadline for the read.  A value of `absl::InfiniteFuture()` (the default)
+  /// indicates no deadline.  If the deadline expires before the operation is
+  /// admitted by the driver (e.g. while queued behind a rate limiter), the
+  /// operation fails with `absl::StatusCode::kDeadlineExceeded` without
+  /// consuming a concurrency slot; drivers that issue HTTP requests also bound
+  /// the request time by the remaining deadline.  Not all drivers support
+  /// deadlines; unsupported drivers ignore this field.
+  absl::Time deadline{absl::InfiniteFuture()};
 };
 
 /// Conditions on the existing generation for transactional read operations.
@@ -0,0 +1,418 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/base/internal/endian.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/context.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/internal/json_binding/bindable.h"
+#include "tensorstore/internal/json_binding/json_binding.h"
+#include "tensorstore/internal/metrics/counter.h"
+#include "tensorstore/internal/metrics/metadata.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/registry.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/supported_features.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/garbage_collection/fwd.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+// specializations
+#include "tensorstore/internal/cache_key/cache_key.h"
+#include "tensorstore/util/apply_members/apply_members.h"
+
+namespace tensorstore {
+namespace {
+
+namespace jb = tensorstore::internal_json_binding;
+
+using ::tensorstore::internal::IntrusivePtr;
+using ::tensorstore::internal_metrics::MetricMetadata;
+using ::tensorstore::kvstore::Key;
+using ::tensorstore::kvstore::ListEntry;
+using ::tensorstore::kvstore::ListOptions;
+using ::tensorstore::kvstore::ListReceiver;
+using ::tensorstore::kvstore::ReadResult;
+using ::tensorstore::kvstore::SupportedFeatures;
+
+auto& read_cache_hit_count = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/read_cache/hit_count",
+    MetricMetadata("Number of reads served from the cache kvstore."));
+auto& read_cache_miss_count = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/read_cache/miss_count",
+    MetricMetadata("Number of reads satisfied by the base kvstore."));
+auto& read_cache_evict_count = internal_metrics::Counter<int64_t>::New(
+    "/tensorstore/kvstore/read_cache/evict_count",
+    MetricMetadata("Number of cache entries evicted to stay under "
+                   "total_bytes_limit."));
+
+// Cache entries are stored as: 2-byte little-endian length of the base
+// generation, the generation value, then the data.  The generation allows a
+// cached entry to be revalidated against the base kvstore with a conditional
+// read, so a stale entry is never served.
+absl::Cord EncodeCacheEntry(const StorageGeneration& generation,
+                            const absl::Cord& data) {
+  char header[2];
+  absl::little_endian::Store16(header,
+                               static_cast<uint16_t>(generation.value.size()));
+  absl::Cord entry(std::string(header, 2));
+  entry.Append(generation.value);
+  entry.Append(data);
+  return entry;
+}
+
+// Decodes a cache entry; returns `false` (treated as a cache miss) if the
+// entry is malformed.
+bool DecodeCacheEntry(absl::Cord entry, StorageGeneration& generation,
+                      absl::Cord& data) {
+  if (entry.size() < 2) return false;
+  const std::string header(entry.Subcord(0, 2));
+  const size_t generation_size = absl::little_endian::Load16(header.data());
+  if (entry.size() < 2 + generation_size) return false;
+  generation.value = std::string(entry.Subcord(2, generation_size));
+  entry.RemovePrefix(2 + generation_size);
+  data = std::move(entry);
+  return true;
+}
+
+struct ReadCacheSpecData {
+  kvstore::Spec base;
+  kvstore::Spec cache;
+  uint64_t total_bytes_limit = 0;
+
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.base, x.cache, x.total_bytes_limit);
+  };
+
+  constexpr static auto default_json_binder = jb::Object(
+      jb::Member("base", jb::Projection<&ReadCacheSpecData::base>()),
+      jb::Member("cache", jb::Projection<&ReadCacheSpecData::cache>()),
+      jb::Member("total_bytes_limit",
+                 jb::Projection<&ReadCacheSpecData::total_bytes_limit>(
+                     jb::DefaultValue([](auto* v) { *v = 0; }))));
+};
+
+class ReadCacheSpec
+    : public internal_kvstore::RegisteredDriverSpec<ReadCacheSpec,
+                                                    ReadCacheSpecData> {
+ public:
+  static constexpr char id[] = "read_cache";
+
+  Future<kvstore::DriverPtr> DoOpen() const override;
+};
+
+/// Read-through cache adapter.
+///
+/// Unconditional full reads are first looked up in the cache kvstore; a hit
+/// is revalidated against the base kvstore with an `if_not_equal` read on the
+/// cached generation, so the full value is only transferred from the base
+/// when it actually changed.  Conditional and ranged reads, writes, deletes,
+/// and lists are forwarded to the base kvstore.
+class ReadCacheDriver
+    : public internal_kvstore::RegisteredDriver<ReadCacheDriver,
+                                                ReadCacheSpec> {
+ public:
+  ReadCacheDriver(kvstore::KvStore base, kvstore::KvStore cache,
+                  uint64_t total_bytes_limit)
+      : base_(std::move(base)),
+        cache_(std::move(cache)),
+        total_bytes_limit_(total_bytes_limit) {
+    SetBatchNestingDepth(base_.driver->BatchNestingDepth() + 1);
+  }
+
+  Future<ReadResult> Read(Key key, ReadOptions options) override;
+
+  Future<TimestampedStorageGeneration> Write(Key key,
+                                             std::optional<Value> value,
+                                             WriteOptions options) override {
+    EraseEntry(key);
+    return kvstore::Write(base_, key, std::move(value), std::move(options));
+  }
+
+  Future<const void> DeleteRange(KeyRange range) override {
+    EraseRange(range);
+    return kvstore::DeleteRange(base_, std::move(range));
+  }
+
+  void ListImpl(ListOptions options, ListReceiver receiver) override {
+    kvstore::List(base_, std::move(options), std::move(receiver));
+  }
+
+  absl::Status GetBoundSpecData(ReadCacheSpecData& spec) const {
+    TENSORSTORE_ASSIGN_OR_RETURN(spec.base,
+                                 base_.spec(ContextBindingMode::retain));
+    TENSORSTORE_ASSIGN_OR_RETURN(spec.cache,
+                                 cache_.spec(ContextBindingMode::retain));
+    spec.total_bytes_limit = total_bytes_limit_;
+    return absl::OkStatus();
+  }
+
+  SupportedFeatures GetSupportedFeatures(
+      const KeyRange& key_range) const final {
+    return base_.driver->GetSupportedFeatures(
+        KeyRange::AddPrefix(base_.path, key_range));
+  }
+
+  std::string DescribeKey(std::string_view key) override {
+    return base_.driver->DescribeKey(tensorstore::StrCat(base_.path, key));
+  }
+
+  /// Seeds the eviction index from pre-existing cache contents, so the size
+  /// cap accounts for entries written by previous processes.  The listed
+  /// order is arbitrary; existing entries are simply treated as older than
+  /// anything touched by this process.
+  void SeedIndex(std::vector<ListEntry> entries) {
+    absl::MutexLock lock(&mutex_);
+    for (auto& entry : entries) {
+      if (index_.count(entry.key)) continue;
+      const uint64_t size = entry.has_size() ? entry.size : 0;
+      lru_.push_back(entry.key);
+      index_.emplace(std::move(entry.key),
+                     IndexEntry{size, std::prev(lru_.end())});
+      total_bytes_ += size;
+    }
+  }
+
+  /// Marks `key` as most-recently-used.
+  void TouchEntry(std::string_view key) {
+    absl::MutexLock lock(&mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) return;
+    lru_.splice(lru_.end(), lru_, it->second.lru_it);
+  }
+
+  /// Writes a cache entry for `key` and evicts least-recently-used entries
+  /// until the total size is under `total_bytes_limit_`.  Cache writes are
+  /// fire-and-forget; a failed write only costs a future miss.
+  void StoreEntry(const std::string& key, const StorageGeneration& generation,
+                  const absl::Cord& data) {
+    if (StorageGeneration::IsUnknown(generation) ||
+        generation.value.size() > 0xffff) {
+      return;
+    }
+    auto entry = EncodeCacheEntry(generation, data);
+    const uint64_t entry_size = entry.size();
+    if (total_bytes_limit_ != 0 && entry_size > total_bytes_limit_) return;
+    std::vector<std::string> victims;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto [it, inserted] = index_.try_emplace(key);
+      if (inserted) {
+        lru_.push_back(key);
+      } else {
+        total_bytes_ -= it->second.size;
+        lru_.splice(lru_.end(), lru_, it->second.lru_it);
+      }
+      it->second = IndexEntry{entry_size, std::prev(lru_.end())};
+      total_bytes_ += entry_size;
+      while (total_bytes_limit_ != 0 && total_bytes_ > total_bytes_limit_ &&
+             lru_.size() > 1) {
+        auto victim_it = index_.find(lru_.front());
+        total_bytes_ -= victim_it->second.size;
+        victims.push_back(std::move(lru_.front()));
+        lru_.pop_front();
+        index_.erase(victim_it);
+      }
+    }
+    kvstore::Write(cache_, key, std::move(entry));
+    for (auto& victim : victims) {
+      read_cache_evict_count.Increment();
+      kvstore::Write(cache_, victim, std::nullopt);
+    }
+  }
+
+  /// Drops the cache entry for `key`, if present.  Not required for
+  /// correctness--every hit is revalidated--but frees the space promptly.
+  void EraseEntry(std::string_view key) {
+    {
+      absl::MutexLock lock(&mutex_);
+      auto it = index_.find(key);
+      if (it == index_.end()) return;
+      total_bytes_ -= it->second.size;
+      lru_.erase(it->second.lru_it);
+      index_.erase(it);
+    }
+    kvstore::Write(cache_, key, std::nullopt);
+  }
+
+  void EraseRange(const KeyRange& range) {
+    {
+      absl::MutexLock lock(&mutex_);
+      auto it = index_.lower_bound(range.inclusive_min);
+      while (it != index_.end() && Contains(range, it->first)) {
+        total_bytes_ -= it->second.size;
+        lru_.erase(it->second.lru_it);
+        it = index_.erase(it);
+      }
+    }
+    kvstore::DeleteRange(cache_, range);
+  }
+
+  kvstore::KvStore base_;
+  kvstore::KvStore cache_;
+  uint64_t total_bytes_limit_;
+
+  struct IndexEntry {
+    uint64_t size;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  absl::Mutex mutex_;
+  /// Least-recently-used order; the front is the next eviction candidate.
+  std::list<std::string> lru_ ABSL_GUARDED_BY(mutex_);
+  std::map<std::string, IndexEntry, std::less<>> index_
+      ABSL_GUARDED_BY(mutex_);
+  uint64_t total_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+/// Tracks a single read: cache lookup, then a base read conditioned on the
+/// cached generation.
+struct ReadState : public internal::AtomicReferenceCount<ReadState> {
+  IntrusivePtr<ReadCacheDriver> driver;
+  std::string key;
+  kvstore::ReadOptions options;
+  Promise<ReadResult> promise;
+
+  // Cached entry contents, valid when `hit` is true.
+  bool hit = false;
+  StorageGeneration cached_generation;
+  absl::Cord cached_data;
+
+  void Start() {
+    auto future = kvstore::Read(driver->cache_, key);
+    future.ExecuteWhenReady(
+        [self = IntrusivePtr<ReadState>(this)](ReadyFuture<ReadResult> f) {
+          self->OnCacheRead(f.result());
+        });
+  }
+
+  void OnCacheRead(Result<ReadResult> result) {
+    if (result.ok() && result->has_value() &&
+        DecodeCacheEntry(std::move(result->value), cached_generation,
+                         cached_data)) {
+      hit = true;
+    }
+    auto base_options = options;
+    if (hit) {
+      base_options.generation_conditions.if_not_equal = cached_generation;
+    }
+    auto future = kvstore::Read(driver->base_, key, std::move(base_options));
+    future.ExecuteWhenReady(
+        [self = IntrusivePtr<ReadState>(this)](ReadyFuture<ReadResult> f) {
+          self->OnBaseRead(f.result());
+        });
+  }
+
+  void OnBaseRead(Result<ReadResult> result) {
+    if (!result.ok()) {
+      promise.SetResult(std::move(result).status());
+      return;
+    }
+    auto& read_result = *result;
+    if (hit && read_result.aborted()) {
+      // The base generation still matches the cached entry.
+      read_cache_hit_count.Increment();
+      driver->TouchEntry(key);
+      promise.SetResult(ReadResult::Value(
+          std::move(cached_data),
+          TimestampedStorageGeneration{std::move(cached_generation),
+                                       read_result.stamp.time}));
+      return;
+    }
+    read_cache_miss_count.Increment();
+    if (read_result.has_value()) {
+      driver->StoreEntry(key, read_result.stamp.generation, read_result.value);
+    } else if (hit && read_result.not_found()) {
+      driver->EraseEntry(key);
+    }
+    promise.SetResult(std::move(read_result));
+  }
+};
+
+Future<ReadResult> ReadCacheDriver::Read(Key key, ReadOptions options) {
+  if (options.generation_conditions || !options.byte_range.IsFull()) {
+    // Conditional and ranged reads bypass the cache; chunk payloads are
+    // normally read unconditionally and in full.
+    return kvstore::Read(base_, std::move(key), std::move(options));
+  }
+  auto op = PromiseFuturePair<ReadResult>::Make();
+  auto state = internal::MakeIntrusivePtr<ReadState>();
+  state->driver = IntrusivePtr<ReadCacheDriver>(this);
+  state->key = std::move(key);
+  state->options = std::move(options);
+  state->promise = std::move(op.promise);
+  state->Start();
+  return std::move(op.future);
+}
+
+Future<kvstore::DriverPtr> ReadCacheSpec::DoOpen() const {
+  auto op = PromiseFuturePair<kvstore::DriverPtr>::Make();
+  LinkValue(
+      [spec = internal::IntrusivePtr<const ReadCacheSpec>(this)](
+          Promise<kvstore::DriverPtr> promise,
+          ReadyFuture<kvstore::KvStore> base,
+          ReadyFuture<kvstore::KvStore> cache) {
+        auto driver = internal::MakeIntrusivePtr<ReadCacheDriver>(
+            std::move(base.value()), std::move(cache.value()),
+            spec->data_.total_bytes_limit);
+        // Seed the eviction index from any existing cache contents before
+        // exposing the driver, so the size cap accounts for them.
+        auto list_future = kvstore::ListFuture(driver->cache_);
+        LinkValue(
+            [driver = std::move(driver)](
+                Promise<kvstore::DriverPtr> promise,
+                ReadyFuture<std::vector<ListEntry>> entries) mutable {
+              driver->SeedIndex(std::move(entries.value()));
+              promise.SetResult(std::move(driver));
+            },
+            std::move(promise), std::move(list_future));
+      },
+      std::move(op.promise), kvstore::Open(data_.base),
+      kvstore::Open(data_.cache));
+  return std::move(op.future);
+}
+
+}  // namespace
+}  // namespace tensorstore
+
+TENSORSTORE_DECLARE_GARBAGE_COLLECTION_NOT_REQUIRED(
+    tensorstore::ReadCacheDriver)
+
+// Registers the driver.
+namespace {
+const tensorstore::internal_kvstore::DriverRegistration<
+    tensorstore::ReadCacheSpec>
+    registration;
+
+}  // namespace
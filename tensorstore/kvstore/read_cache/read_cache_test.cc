@@ -0,0 +1,158 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/strings/cord.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/kvstore/key_range.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/kvstore/test_util.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::Context;
+using ::tensorstore::KeyRange;
+using ::tensorstore::Result;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal::MatchesKvsReadResultNotFound;
+using ::tensorstore::kvstore::KvStore;
+
+class ReadCacheTest : public ::testing::Test {
+ public:
+  ReadCacheTest() : context_(Context::Default()) {}
+
+  Result<KvStore> OpenStore(uint64_t total_bytes_limit = 0) const {
+    ::nlohmann::json spec{
+        {"driver", "read_cache"},
+        {"base", {{"driver", "memory"}, {"path", "base/"}}},
+        {"cache", {{"driver", "memory"}, {"path", "cache/"}}}};
+    if (total_bytes_limit != 0) {
+      spec["total_bytes_limit"] = total_bytes_limit;
+    }
+    return kvstore::Open(spec, context_).result();
+  }
+
+  // Direct views of the underlying stores, sharing `context_`.
+  Result<KvStore> OpenBase() const {
+    return kvstore::Open({{"driver", "memory"}, {"path", "base/"}}, context_)
+        .result();
+  }
+  Result<KvStore> OpenCache() const {
+    return kvstore::Open({{"driver", "memory"}, {"path", "cache/"}}, context_)
+        .result();
+  }
+
+  Context context_;
+};
+
+TEST_F(ReadCacheTest, Basic) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  tensorstore::internal::TestKeyValueReadWriteOps(store);
+}
+
+TEST_F(ReadCacheTest, DeletePrefix) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  tensorstore::internal::TestKeyValueStoreDeletePrefix(store);
+}
+
+TEST_F(ReadCacheTest, DeleteRange) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  tensorstore::internal::TestKeyValueStoreDeleteRange(store);
+}
+
+TEST_F(ReadCacheTest, ReadPopulatesCache) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto cache, OpenCache());
+
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "a", absl::Cord("value")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value")));
+
+  // The cached entry holds the generation header plus the data.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto cached,
+                                   kvstore::Read(cache, "a").result());
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_GT(cached.value.size(), 5);
+
+  // A repeated read is served from the cache (still revalidated).
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("value")));
+}
+
+TEST_F(ReadCacheTest, StaleEntryRevalidated) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto base, OpenBase());
+
+  TENSORSTORE_EXPECT_OK(kvstore::Write(store, "a", absl::Cord("old")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("old")));
+
+  // Modify the base behind the adapter's back; the cached entry no longer
+  // matches the base generation and must not be served.
+  TENSORSTORE_EXPECT_OK(kvstore::Write(base, "a", absl::Cord("new")));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord("new")));
+
+  // Similarly for deletion.
+  TENSORSTORE_EXPECT_OK(kvstore::Delete(base, "a"));
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResultNotFound());
+}
+
+TEST_F(ReadCacheTest, TotalBytesLimitEvicts) {
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, OpenStore(/*total_bytes_limit=*/150));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto cache, OpenCache());
+
+  const std::string value(50, 'x');
+  for (char c : {'a', 'b', 'c', 'd', 'e'}) {
+    std::string key(1, c);
+    TENSORSTORE_EXPECT_OK(kvstore::Write(store, key, absl::Cord(value)));
+    EXPECT_THAT(kvstore::Read(store, key).result(),
+                MatchesKvsReadResult(absl::Cord(value)));
+  }
+
+  // Each cached entry exceeds 50 bytes, so at most 2 of the 5 entries fit
+  // under the limit; older entries must have been evicted.
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto entries,
+                                   kvstore::ListFuture(cache).result());
+  EXPECT_LE(entries.size(), 2);
+  EXPECT_GE(entries.size(), 1);
+
+  // Evicted values are still served correctly from the base.
+  EXPECT_THAT(kvstore::Read(store, "a").result(),
+              MatchesKvsReadResult(absl::Cord(value)));
+}
+
+TEST_F(ReadCacheTest, SpecRoundtrip) {
+  tensorstore::internal::KeyValueStoreSpecRoundtripOptions options;
+  options.full_spec = {
+      {"driver", "read_cache"},
+      {"base", {{"driver", "memory"}, {"path", "base/"}}},
+      {"cache", {{"driver", "memory"}, {"path", "cache/"}}},
+      {"total_bytes_limit", 1000000},
+  };
+  tensorstore::internal::TestKeyValueStoreSpecRoundtrip(options);
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <memory>
@@ -23,8 +24,11 @@
 #include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/flags/flag.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
@@ -39,6 +43,7 @@
 #include "tensorstore/context.h"
 #include "tensorstore/internal/data_copy_concurrency_resource.h"
 #include "tensorstore/internal/digest/sha256.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/http/curl_transport.h"
 #include "tensorstore/internal/http/http_request.h"
 #include "tensorstore/internal/http/http_response.h"
@@ -48,15 +53,18 @@
 #include "tensorstore/internal/log/verbose_flag.h"
 #include "tensorstore/internal/metrics/counter.h"
 #include "tensorstore/internal/metrics/histogram.h"
+#include "tensorstore/internal/rate_limiter/admission_queue.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/internal/source_location.h"
 #include "tensorstore/internal/thread/schedule_at.h"
 #include "tensorstore/internal/uri_utils.h"
 #include "tensorstore/kvstore/batch_util.h"
 #include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/coalesce_kvstore.h"
 #include "tensorstore/kvstore/common_metrics.h"
 #include "tensorstore/kvstore/generation.h"
 #include "tensorstore/kvstore/generic_coalescing_batch_util.h"
+#include "tensorstore/kvstore/hedged_kvstore.h"
 #include "tensorstore/kvstore/http/byte_range_util.h"
 #include "tensorstore/kvstore/key_range.h"
 #include "tensorstore/kvstore/operations.h"
@@ -73,6 +81,7 @@
 #include "tensorstore/kvstore/s3/use_conditional_write.h"
 #include "tensorstore/kvstore/s3/validate.h"
 #include "tensorstore/kvstore/spec.h"
+#include "tensorstore/kvstore/split_read_util.h"
 #include "tensorstore/kvstore/url_registry.h"
 #include "tensorstore/util/execution/any_receiver.h"
 #include "tensorstore/util/execution/execution.h"
@@ -93,7 +102,14 @@
 #include "tensorstore/serialization/std_optional.h"  // IWYU pragma: keep
 #include "tensorstore/util/garbage_collection/std_optional.h"  // IWYU pragma: keep
 
+ABSL_FLAG(std::optional<size_t>, tensorstore_s3_multipart_part_size,
+          std::nullopt,
+          "S3 multipart upload part size in bytes. "
+          "Overrides TENSORSTORE_S3_MULTIPART_PART_SIZE");
+
+using ::tensorstore::internal::AdmissionQueue;
 using ::tensorstore::internal::DataCopyConcurrencyResource;
+using ::tensorstore::internal::GetFlagOrEnvValue;
 using ::tensorstore::internal::IntrusivePtr;
 using ::tensorstore::internal::RateLimiter;
 using ::tensorstore::internal::RateLimiterNode;
@@ -154,6 +170,24 @@ static constexpr char kEmptySha256[] =
 
 static constexpr size_t kMaxS3PutSize = size_t{5} * 1024 * 1024 * 1024;  // 5GB
 
+/// Multipart upload limits.
+/// https://docs.aws.amazon.com/AmazonS3/latest/userguide/qfacts.html
+static constexpr size_t kMinS3MultipartPartSize = size_t{5} * 1024 * 1024;
+static constexpr size_t kMaxS3MultipartPartSize =
+    size_t{5} * 1024 * 1024 * 1024;
+static constexpr size_t kMaxS3MultipartParts = 10000;
+static constexpr size_t kDefaultMultipartPartSize = size_t{64} * 1024 * 1024;
+
+/// Part size used for multipart uploads.  Unconditional writes larger than
+/// twice this size are issued as parallel multipart uploads rather than a
+/// single PUT.
+size_t GetS3MultipartPartSize() {
+  return std::clamp(GetFlagOrEnvValue(FLAGS_tensorstore_s3_multipart_part_size,
+                                      "TENSORSTORE_S3_MULTIPART_PART_SIZE")
+                        .value_or(kDefaultMultipartPartSize),
+                    kMinS3MultipartPartSize, kMaxS3MultipartPartSize);
+}
+
 /// Adds the generation header to the provided builder.
 bool AddGenerationHeader(S3RequestBuilder* builder, std::string_view header,
                          const StorageGeneration& gen) {
@@ -296,10 +330,18 @@ class S3KeyValueStore
 
   Future<ReadResult> ReadImpl(Key&& key, ReadOptions&& options);
 
+  // Issues a single ranged GET; used by `ReadImpl`, which may split a large
+  // read into several concurrent calls.
+  Future<ReadResult> SingleReadImpl(Key&& key, ReadOptions&& options);
+
   Future<TimestampedStorageGeneration> Write(Key key,
                                              std::optional<Value> value,
                                              WriteOptions options) override;
 
+  // Writes `value` as a parallel multipart upload.  Used by `Write` for
+  // unconditional writes of large values.
+  Future<TimestampedStorageGeneration> WriteMultipart(Key key, Value value);
+
   void ListImpl(ListOptions options, ListReceiver receiver) override;
 
   Future<const void> DeleteRange(KeyRange range) override;
@@ -326,7 +368,7 @@ class S3KeyValueStore
     return no_rate_limiter_;
   }
 
-  RateLimiter& admission_queue() { return *spec_.request_concurrency->queue; }
+  AdmissionQueue& admission_queue() { return *spec_.request_concurrency->queue; }
 
   Future<AwsCredentials> GetCredentials() {
     return GetAwsCredentials(provider_.get());
@@ -344,6 +386,9 @@ class S3KeyValueStore
       absl::Status status, int attempt, Task* task,
       SourceLocation loc = ::tensorstore::SourceLocation::current()) {
     assert(task != nullptr);
+    // Retryable failures (throttling, unavailability) feed the adaptive
+    // admission queue's congestion signal; a no-op for fixed-limit queues.
+    admission_queue().ReportThrottled();
     auto delay = spec_.retries->BackoffForAttempt(attempt);
     if (!delay) {
       return MaybeAnnotateStatus(std::move(status),
@@ -418,6 +463,11 @@ struct ReadTask : public RateLimiterNode,
     if (!promise.result_needed()) {
       return;
     }
+    if (absl::Now() >= options.deadline) {
+      promise.SetResult(absl::DeadlineExceededError(
+          "Deadline expired before read request was issued"));
+      return;
+    }
     auto request_builder = S3RequestBuilder(
         options.byte_range.size() == 0 ? "HEAD" : "GET", read_url_);
 
@@ -439,7 +489,13 @@ struct ReadTask : public RateLimiterNode,
                                      ehr.aws_region, kEmptySha256, start_time_);
 
     ABSL_LOG_IF(INFO, s3_logging) << "ReadTask: " << request;
-    auto future = owner->transport_->IssueRequest(request, {});
+    internal_http::IssueRequestOptions issue_options;
+    if (options.deadline != absl::InfiniteFuture()) {
+      issue_options = std::move(issue_options)
+                          .SetRequestTimeout(options.deadline - start_time_);
+    }
+    auto future =
+        owner->transport_->IssueRequest(request, std::move(issue_options));
     future.ExecuteWhenReady([self = IntrusivePtr<ReadTask>(this)](
                                 ReadyFuture<HttpResponse> response) {
       self->OnResponse(response.result());
@@ -469,6 +525,9 @@ struct ReadTask : public RateLimiterNode,
       return AwsHttpResponseToStatus(response.value(), is_retryable);
     }();
 
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
     if (!status.ok() && is_retryable) {
       status =
           owner->BackoffForAttemptAsync(std::move(status), attempt_++, this);
@@ -552,6 +611,24 @@ Future<kvstore::ReadResult> S3KeyValueStore::Read(Key key,
 Future<kvstore::ReadResult> S3KeyValueStore::ReadImpl(Key&& key,
                                                       ReadOptions&& options) {
   s3_metrics.batch_read.Increment();
+  // Large explicit byte ranges are split into concurrent ranged GETs, since
+  // a single stream is capped well below NIC bandwidth.
+  return internal_kvstore::MaybeSplitRead(
+      [self = IntrusivePtr<S3KeyValueStore>(this)](Key key,
+                                                   ReadOptions options) {
+        return self->SingleReadImpl(std::move(key), std::move(options));
+      },
+      std::move(key), std::move(options));
+}
+
+Future<kvstore::ReadResult> S3KeyValueStore::SingleReadImpl(
+    Key&& key, ReadOptions&& options) {
+  // Fail fast rather than occupying a rate-limiter or admission-queue slot
+  // for an operation whose caller has already given up.
+  if (absl::Now() >= options.deadline) {
+    return absl::DeadlineExceededError(
+        "Deadline expired before read was admitted");
+  }
   auto op = PromiseFuturePair<ReadResult>::Make();
 
   LinkValue(
@@ -751,6 +828,9 @@ struct WriteTask : public RateLimiterNode,
     auto latency = absl::Now() - start_time_;
     bool is_retryable = false;
     auto status = AwsHttpResponseToStatus(response.value(), is_retryable);
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(latency);
+    }
     if (response.value().status_code == 409) {
       // Conflict implies that there was a conflict in the concurrent operation.
       if (owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
@@ -785,6 +865,450 @@ struct WriteTask : public RateLimiterNode,
   }
 };
 
+// MultipartUploadTask writes a large value as a parallel multipart upload.
+// https://docs.aws.amazon.com/AmazonS3/latest/API/API_CreateMultipartUpload.html
+//
+// The task issues CreateMultipartUpload, uploads each part as a separate
+// PartTask subject to the write rate limiter and admission queue, and then
+// issues CompleteMultipartUpload.  On failure the upload is aborted so that
+// the bucket does not accumulate incomplete multipart uploads.  Only
+// unconditional writes take this path; conditional writes of values
+// exceeding the PUT limit are rejected by S3KeyValueStore::Write.
+struct MultipartUploadTask
+    : public RateLimiterNode,
+      public internal::AtomicReferenceCount<MultipartUploadTask> {
+  IntrusivePtr<S3KeyValueStore> owner;
+  ReadyFuture<const S3EndpointRegion> endpoint_region_;
+  std::string object_url_;
+  absl::Cord value_;
+  AwsCredentials credentials_;
+  Promise<TimestampedStorageGeneration> promise;
+
+  enum class Phase { kCreate, kComplete };
+
+  size_t part_size_;
+  size_t num_parts_;
+  std::string upload_id_;
+  std::vector<std::string> part_etags_;
+  std::atomic<size_t> parts_remaining_{0};
+  Phase phase_ = Phase::kCreate;
+  int attempt_ = 0;  // CreateMultipartUpload / CompleteMultipartUpload.
+  absl::Time start_time_;
+  bool admitted_ = false;
+
+  absl::Mutex mutex_;  // Guards error_.
+  absl::Status error_ ABSL_GUARDED_BY(mutex_);
+
+  MultipartUploadTask(IntrusivePtr<S3KeyValueStore> o,
+                      ReadyFuture<const S3EndpointRegion> endpoint_region,
+                      std::string object_url, absl::Cord value,
+                      AwsCredentials credentials,
+                      Promise<TimestampedStorageGeneration> promise)
+      : owner(std::move(o)),
+        endpoint_region_(std::move(endpoint_region)),
+        object_url_(std::move(object_url)),
+        value_(std::move(value)),
+        credentials_(std::move(credentials)),
+        promise(std::move(promise)) {
+    part_size_ = std::max(GetS3MultipartPartSize(),
+                          (value_.size() + kMaxS3MultipartParts - 1) /
+                              kMaxS3MultipartParts);
+    num_parts_ = (value_.size() + part_size_ - 1) / part_size_;
+  }
+
+  ~MultipartUploadTask() {
+    if (admitted_) owner->admission_queue().Finish(this);
+  }
+
+  static void Start(RateLimiterNode* task) {
+    auto* self = static_cast<MultipartUploadTask*>(task);
+    self->owner->write_rate_limiter().Finish(self);
+    self->owner->admission_queue().Admit(self, &MultipartUploadTask::Admit);
+  }
+
+  static void Admit(RateLimiterNode* task) {
+    auto* self = static_cast<MultipartUploadTask*>(task);
+    self->admitted_ = true;
+    self->owner->executor()(
+        [state = IntrusivePtr<MultipartUploadTask>(
+             self, internal::adopt_object_ref)] { state->Retry(); });
+  }
+
+  bool IsCancelled() { return !promise.result_needed(); }
+
+  void Fail(absl::Status status) {
+    ABSL_LOG_IF(INFO, s3_logging.Level(2))
+        << "MultipartUploadTask Fail " << status;
+    promise.SetResult(std::move(status));
+  }
+
+  void Success(StorageGeneration g) {
+    ABSL_LOG_IF(INFO, s3_logging.Level(1))
+        << "MultipartUploadTask Success " << g;
+    promise.SetResult(std::in_place, std::move(g), start_time_);
+  }
+
+  void Retry() {
+    switch (phase_) {
+      case Phase::kCreate:
+        IssueCreate();
+        break;
+      case Phase::kComplete:
+        IssueComplete();
+        break;
+    }
+  }
+
+  void IssueCreate() {
+    if (IsCancelled()) {
+      return;
+    }
+    start_time_ = absl::Now();
+    const auto& ehr = endpoint_region_.value();
+    auto request =
+        S3RequestBuilder("POST", object_url_)
+            .AddQueryParameter("uploads", "")
+            .AddHeader("content-type", "application/octet-stream")
+            .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+            .BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
+                          kEmptySha256, start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging) << "CreateMultipartUpload: " << request;
+
+    auto future = owner->transport_->IssueRequest(request, {});
+    future.ExecuteWhenReady([self = IntrusivePtr<MultipartUploadTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnCreateResponse(response.result());
+    });
+  }
+
+  void OnCreateResponse(const Result<HttpResponse>& response) {
+    if (IsCancelled()) {
+      return;
+    }
+    if (!response.ok() && DefaultIsRetryableCode(response.status().code())) {
+      if (owner->BackoffForAttemptAsync(response.status(), attempt_++, this)
+              .ok()) {
+        return;
+      }
+    }
+    if (!response.ok()) {
+      Fail(response.status());
+      return;
+    }
+
+    bool is_retryable = false;
+    auto status = AwsHttpResponseToStatus(response.value(), is_retryable);
+    if (!status.ok()) {
+      if (is_retryable &&
+          owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      Fail(std::move(status));
+      return;
+    }
+    owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+
+    auto cord = response.value().payload;
+    auto payload = cord.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      Fail(absl::InvalidArgumentError(absl::StrCat(
+          "Malformed CreateMultipartUpload response: ", xmlcode)));
+      return;
+    }
+    auto* root =
+        xmlDocument.FirstChildElement("InitiateMultipartUploadResult");
+    upload_id_ =
+        root ? GetNodeText(root->FirstChildElement("UploadId")) : std::string();
+    if (upload_id_.empty()) {
+      Fail(absl::InvalidArgumentError(
+          "Malformed CreateMultipartUpload response: missing <UploadId>"));
+      return;
+    }
+
+    ABSL_LOG_IF(INFO, s3_logging.Level(1))
+        << "MultipartUploadTask " << upload_id_ << " parts=" << num_parts_
+        << " part_size=" << part_size_;
+    StartParts();
+  }
+
+  // PartTask uploads a single part.
+  // https://docs.aws.amazon.com/AmazonS3/latest/API/API_UploadPart.html
+  struct PartTask : public RateLimiterNode,
+                    public internal::AtomicReferenceCount<PartTask> {
+    IntrusivePtr<MultipartUploadTask> parent;
+    size_t part_number_;  // 1-based.
+    absl::Cord part_data_;
+
+    int attempt_ = 0;
+    absl::Time start_time_;
+
+    PartTask(IntrusivePtr<MultipartUploadTask> parent, size_t part_number,
+             absl::Cord part_data)
+        : parent(std::move(parent)),
+          part_number_(part_number),
+          part_data_(std::move(part_data)) {}
+
+    ~PartTask() { parent->owner->admission_queue().Finish(this); }
+
+    static void Start(RateLimiterNode* task) {
+      auto* self = static_cast<PartTask*>(task);
+      self->parent->owner->write_rate_limiter().Finish(self);
+      self->parent->owner->admission_queue().Admit(self, &PartTask::Admit);
+    }
+
+    static void Admit(RateLimiterNode* task) {
+      auto* self = static_cast<PartTask*>(task);
+      self->parent->owner->executor()(
+          [state = IntrusivePtr<PartTask>(self, internal::adopt_object_ref)] {
+            state->Retry();
+          });
+    }
+
+    void Retry() {
+      if (parent->IsCancelled()) {
+        parent->OnPartDone(absl::CancelledError());
+        return;
+      }
+      start_time_ = absl::Now();
+      auto content_sha256_hex = PayloadSha256Hex(part_data_);
+
+      const auto& ehr = parent->endpoint_region_.value();
+      auto request =
+          S3RequestBuilder("PUT", parent->object_url_)
+              .AddQueryParameter("partNumber", absl::StrCat(part_number_))
+              .AddQueryParameter("uploadId", parent->upload_id_)
+              .AddHeader("content-length", absl::StrCat(part_data_.size()))
+              .MaybeAddRequesterPayer(parent->owner->spec_.requester_pays)
+              .BuildRequest(parent->owner->host_header_, parent->credentials_,
+                            ehr.aws_region, content_sha256_hex, start_time_);
+
+      ABSL_LOG_IF(INFO, s3_logging)
+          << "UploadPart " << part_number_ << ": " << request
+          << " size=" << part_data_.size();
+
+      auto future = parent->owner->transport_->IssueRequest(
+          request, internal_http::IssueRequestOptions(part_data_));
+      future.ExecuteWhenReady([self = IntrusivePtr<PartTask>(this)](
+                                  ReadyFuture<HttpResponse> response) {
+        self->OnResponse(response.result());
+      });
+    }
+
+    void OnResponse(const Result<HttpResponse>& response) {
+      if (parent->IsCancelled()) {
+        parent->OnPartDone(absl::CancelledError());
+        return;
+      }
+      if (!response.ok() && DefaultIsRetryableCode(response.status().code())) {
+        if (parent->owner
+                ->BackoffForAttemptAsync(response.status(), attempt_++, this)
+                .ok()) {
+          return;
+        }
+      }
+      if (!response.ok()) {
+        parent->OnPartDone(response.status());
+        return;
+      }
+
+      bool is_retryable = false;
+      auto status = AwsHttpResponseToStatus(response.value(), is_retryable);
+      if (!status.ok()) {
+        if (is_retryable &&
+            parent->owner->BackoffForAttemptAsync(status, attempt_++, this)
+                .ok()) {
+          return;
+        }
+        parent->OnPartDone(std::move(status));
+        return;
+      }
+      parent->owner->admission_queue().ReportSuccess(absl::Now() -
+                                                     start_time_);
+
+      auto it = response.value().headers.find("etag");
+      if (it == response.value().headers.end()) {
+        parent->OnPartDone(absl::InvalidArgumentError(
+            "UploadPart response missing etag header"));
+        return;
+      }
+      parent->part_etags_[part_number_ - 1] = it->second;
+      parent->OnPartDone(absl::OkStatus());
+    }
+  };
+
+  void StartParts() {
+    // Release the admission slot held for CreateMultipartUpload while parts
+    // are in flight, so that part uploads proceed even when the admission
+    // limit is 1.
+    owner->admission_queue().Finish(this);
+    admitted_ = false;
+
+    part_etags_.resize(num_parts_);
+    parts_remaining_.store(num_parts_, std::memory_order_relaxed);
+    for (size_t i = 0; i < num_parts_; ++i) {
+      size_t offset = i * part_size_;
+      auto part = internal::MakeIntrusivePtr<PartTask>(
+          IntrusivePtr<MultipartUploadTask>(this), i + 1,
+          value_.Subcord(offset,
+                         std::min(part_size_, value_.size() - offset)));
+      intrusive_ptr_increment(part.get());  // adopted by PartTask::Admit.
+      owner->write_rate_limiter().Admit(part.get(), &PartTask::Start);
+    }
+  }
+
+  void OnPartDone(absl::Status status) {
+    if (!status.ok()) {
+      absl::MutexLock lock(&mutex_);
+      if (error_.ok()) error_ = std::move(status);
+    }
+    if (parts_remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+
+    // All parts have completed.
+    absl::Status error;
+    {
+      absl::MutexLock lock(&mutex_);
+      error = error_;
+    }
+    if (!error.ok()) {
+      AbortUpload(std::move(error));
+      return;
+    }
+
+    // Re-acquire an admission slot for CompleteMultipartUpload.
+    phase_ = Phase::kComplete;
+    attempt_ = 0;
+    intrusive_ptr_increment(this);  // adopted by MultipartUploadTask::Admit.
+    owner->write_rate_limiter().Admit(this, &MultipartUploadTask::Start);
+  }
+
+  void IssueComplete() {
+    if (IsCancelled()) {
+      AbortUpload(absl::CancelledError());
+      return;
+    }
+    start_time_ = absl::Now();
+
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+    std::string body = "<CompleteMultipartUpload>";
+    for (size_t i = 0; i < part_etags_.size(); ++i) {
+      absl::StrAppend(&body, "<Part><PartNumber>", i + 1,
+                      "</PartNumber><ETag>", part_etags_[i],
+                      "</ETag></Part>");
+    }
+    absl::StrAppend(&body, "</CompleteMultipartUpload>");
+    absl::Cord payload(std::move(body));
+    auto content_sha256_hex = PayloadSha256Hex(payload);
+
+    const auto& ehr = endpoint_region_.value();
+    auto request =
+        S3RequestBuilder("POST", object_url_)
+            .AddQueryParameter("uploadId", upload_id_)
+            .AddHeader("content-length", absl::StrCat(payload.size()))
+            .AddHeader("content-type", "application/xml")
+            .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+            .BuildRequest(owner->host_header_, credentials_, ehr.aws_region,
+                          content_sha256_hex, start_time_);
+
+    ABSL_LOG_IF(INFO, s3_logging)
+        << "CompleteMultipartUpload: " << request << " parts=" << num_parts_;
+
+    auto future = owner->transport_->IssueRequest(
+        request, internal_http::IssueRequestOptions(std::move(payload)));
+    future.ExecuteWhenReady([self = IntrusivePtr<MultipartUploadTask>(this)](
+                                ReadyFuture<HttpResponse> response) {
+      self->OnCompleteResponse(response.result());
+    });
+  }
+
+  void OnCompleteResponse(const Result<HttpResponse>& response) {
+    if (IsCancelled()) {
+      return;
+    }
+    if (!response.ok() && DefaultIsRetryableCode(response.status().code())) {
+      if (owner->BackoffForAttemptAsync(response.status(), attempt_++, this)
+              .ok()) {
+        return;
+      }
+    }
+    if (!response.ok()) {
+      AbortUpload(response.status());
+      return;
+    }
+
+    bool is_retryable = false;
+    auto status = AwsHttpResponseToStatus(response.value(), is_retryable);
+    if (!status.ok()) {
+      if (is_retryable &&
+          owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      AbortUpload(std::move(status));
+      return;
+    }
+    auto latency = absl::Now() - start_time_;
+
+    // CompleteMultipartUpload may return 200 OK with an <Error> body, which
+    // must be treated as a retryable failure.
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/API_CompleteMultipartUpload.html
+    auto cord = response.value().payload;
+    auto payload = cord.Flatten();
+    tinyxml2::XMLDocument xmlDocument;
+    if (int xmlcode = xmlDocument.Parse(payload.data(), payload.size());
+        xmlcode != tinyxml2::XML_SUCCESS) {
+      AbortUpload(absl::InvalidArgumentError(absl::StrCat(
+          "Malformed CompleteMultipartUpload response: ", xmlcode)));
+      return;
+    }
+    auto* root = xmlDocument.FirstChildElement("CompleteMultipartUploadResult");
+    if (root == nullptr) {
+      auto* error_node = xmlDocument.FirstChildElement("Error");
+      status = absl::UnavailableError(absl::StrCat(
+          "CompleteMultipartUpload error: ",
+          error_node ? GetNodeText(error_node->FirstChildElement("Code"))
+                     : "unknown"));
+      if (owner->BackoffForAttemptAsync(status, attempt_++, this).ok()) {
+        return;
+      }
+      AbortUpload(std::move(status));
+      return;
+    }
+    std::string etag = GetNodeText(root->FirstChildElement("ETag"));
+    if (etag.empty()) {
+      AbortUpload(absl::InvalidArgumentError(
+          "Malformed CompleteMultipartUpload response: missing <ETag>"));
+      return;
+    }
+    owner->admission_queue().ReportSuccess(latency);
+
+    Success(StorageGeneration::FromString(etag));
+    s3_metrics.bytes_written.IncrementBy(value_.size());
+    s3_metrics.write_latency_ms.Observe(absl::ToInt64Milliseconds(latency));
+  }
+
+  // Issues a best-effort AbortMultipartUpload so that the bucket does not
+  // accumulate incomplete uploads, then fails the write with `status`.
+  // https://docs.aws.amazon.com/AmazonS3/latest/API/API_AbortMultipartUpload.html
+  void AbortUpload(absl::Status status) {
+    auto now = absl::Now();
+    const auto& ehr = endpoint_region_.value();
+    auto request = S3RequestBuilder("DELETE", object_url_)
+                       .AddQueryParameter("uploadId", upload_id_)
+                       .MaybeAddRequesterPayer(owner->spec_.requester_pays)
+                       .BuildRequest(owner->host_header_, credentials_,
+                                     ehr.aws_region, kEmptySha256, now);
+
+    ABSL_LOG_IF(INFO, s3_logging) << "AbortMultipartUpload: " << request;
+
+    owner->transport_->IssueRequest(request, {}).IgnoreFuture();
+    Fail(std::move(status));
+  }
+};
+
 // DeleteTask is a function object used to satisfy S3KeyValueStore::Delete.
 // https://docs.aws.amazon.com/AmazonS3/latest/API/API_DeleteObject.html
 //
@@ -954,6 +1478,9 @@ struct DeleteTask : public RateLimiterNode,
 
     bool is_retryable = false;
     auto status = AwsHttpResponseToStatus(response.value(), is_retryable);
+    if (status.ok()) {
+      owner->admission_queue().ReportSuccess(absl::Now() - start_time_);
+    }
 
     if (response.value().status_code == 412) {
       // Failed precondition implies the generation did not match.
@@ -987,10 +1514,16 @@ Future<TimestampedStorageGeneration> S3KeyValueStore::Write(
   if (!IsValidStorageGeneration(options.generation_conditions.if_equal)) {
     return absl::InvalidArgumentError("Malformed StorageGeneration");
   }
+  if (value &&
+      StorageGeneration::IsUnknown(options.generation_conditions.if_equal) &&
+      (value->size() > 2 * GetS3MultipartPartSize() ||
+       value->size() > kMaxS3PutSize)) {
+    // Large unconditional writes are issued as parallel multipart uploads.
+    return WriteMultipart(std::move(key), *std::move(value));
+  }
   if (value && value->size() > kMaxS3PutSize) {
-    // TODO: Support multi-part uploads of files larger than 5GB.
-    // Generally, aws-cli splits uploads which exceed ~8MB into multiple
-    // parts.
+    // Conditional writes cannot use multipart upload, as S3 evaluates
+    // preconditions against the object that exists when the upload completes.
     return absl::InvalidArgumentError(absl::StrCat(
         "Object size ", value->size(), " exceeds S3 limit of ", kMaxS3PutSize));
   }
@@ -1033,6 +1566,33 @@ Future<TimestampedStorageGeneration> S3KeyValueStore::Write(
   return std::move(op.future);
 }
 
+Future<TimestampedStorageGeneration> S3KeyValueStore::WriteMultipart(
+    Key key, Value value) {
+  auto op = PromiseFuturePair<TimestampedStorageGeneration>::Make();
+
+  LinkValue(
+      [self = IntrusivePtr<S3KeyValueStore>(this), key = std::move(key),
+       value = std::move(value)](auto promise,
+                                 ReadyFuture<const S3EndpointRegion> ready,
+                                 ReadyFuture<AwsCredentials> credentials) {
+        std::string object_url =
+            tensorstore::StrCat(ready.value().endpoint, "/", key);
+
+        auto state = internal::MakeIntrusivePtr<MultipartUploadTask>(
+            std::move(self), std::move(ready), std::move(object_url),
+            std::move(value), std::move(credentials.value()),
+            std::move(promise));
+
+        intrusive_ptr_increment(
+            state.get());  // adopted by MultipartUploadTask::Admit.
+        state->owner->write_rate_limiter().Admit(
+            state.get(), &MultipartUploadTask::Start);
+      },
+      std::move(op.promise), MaybeResolveRegion(), GetCredentials());
+
+  return std::move(op.future);
+}
+
 /// ListTask implements the ListImpl execution flow.
 struct ListTask : public RateLimiterNode,
                   public internal::AtomicReferenceCount<ListTask> {
@@ -1356,10 +1916,36 @@ Future<kvstore::DriverPtr> S3KeyValueStoreSpec::DoOpen() const {
   if (auto* ehr = std::get_if<S3EndpointRegion>(&result); ehr != nullptr) {
     ABSL_LOG_IF(INFO, s3_logging)
         << "S3 driver using endpoint [" << *ehr << "]";
+    if (auto n = internal::GetEnvValue<size_t>(
+            "TENSORSTORE_S3_PREWARM_CONNECTIONS");
+        n.value_or(0) > 0) {
+      // Resolve DNS and establish pooled connections to the endpoint before
+      // the first read pays for the handshakes.
+      internal_http::PreWarmConnectionsOnce(*driver->transport_,
+                                            ehr->endpoint, *n);
+    }
     driver->resolve_ehr_ = MakeReadyFuture<S3EndpointRegion>(std::move(*ehr));
   }
 
-  return driver;
+  kvstore::DriverPtr result = driver;
+  if (internal::GetEnvValue<bool>("TENSORSTORE_S3_READ_HEDGING")
+          .value_or(false)) {
+    // Issue a duplicate read when a read exceeds the recent latency
+    // distribution, taking the first response.
+    result = internal_kvstore::MakeHedgedKvStoreDriver(
+        std::move(result), internal_kvstore::HedgedReadOptions{},
+        driver->executor());
+  }
+  if (internal::GetEnvValue<bool>("TENSORSTORE_S3_READ_COALESCING")
+          .value_or(false)) {
+    // Merge concurrent reads of nearby byte ranges of the same object into
+    // a single request.
+    result = internal_kvstore::MakeCoalesceKvStoreDriver(
+        std::move(result), /*threshold=*/1024 * 1024,
+        /*merged_threshold=*/16 * 1024 * 1024,
+        /*interval=*/absl::ZeroDuration(), driver->executor());
+  }
+  return result;
 }
 
 Result<kvstore::Spec> ParseS3Url(std::string_view url) {
@@ -21,6 +21,7 @@
 #include "absl/strings/cord.h"
 #include "absl/strings/match.h"
 #include "tensorstore/context.h"
+#include "tensorstore/internal/env.h"
 #include "tensorstore/internal/http/curl_transport.h"
 #include "tensorstore/internal/http/http_header.h"
 #include "tensorstore/internal/http/http_request.h"
@@ -333,6 +334,85 @@ TEST(S3KeyValueStoreTest, MockWrite_Conflict) {
   EXPECT_THAT(host_header_validated, testing::Ge(2));
 }
 
+TEST(S3KeyValueStoreTest, MockWrite_Multipart) {
+  // Use the minimum part size so the test value stays small; values larger
+  // than twice the part size are uploaded as multipart uploads.
+  tensorstore::internal::SetEnv("TENSORSTORE_S3_MULTIPART_PART_SIZE",
+                                "5242880");
+
+  const std::string kInitiateResult =
+      "<InitiateMultipartUploadResult>"
+      "<Bucket>my.bucket</Bucket>"
+      "<Key>key_multipart</Key>"
+      "<UploadId>upload-1</UploadId>"
+      "</InitiateMultipartUploadResult>";
+
+  const std::string kCompleteResult =
+      "<CompleteMultipartUploadResult>"
+      "<ETag>&quot;multipart-etag&quot;</ETag>"
+      "</CompleteMultipartUploadResult>";
+
+  auto mock_transport = std::make_shared<DefaultMockHttpTransport>(
+      DefaultMockHttpTransport::Responses{
+          {"POST "
+           "https://s3.us-east-1.amazonaws.com/my.bucket/"
+           "key_multipart?uploads",
+           HttpResponse{200, absl::Cord(kInitiateResult), {}}},
+
+          {"PUT "
+           "https://s3.us-east-1.amazonaws.com/my.bucket/"
+           "key_multipart?partNumber=1&uploadId=upload-1",
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"etag-1\""}}}},
+
+          {"PUT "
+           "https://s3.us-east-1.amazonaws.com/my.bucket/"
+           "key_multipart?partNumber=2&uploadId=upload-1",
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"etag-2\""}}}},
+
+          {"PUT "
+           "https://s3.us-east-1.amazonaws.com/my.bucket/"
+           "key_multipart?partNumber=3&uploadId=upload-1",
+           HttpResponse{200, absl::Cord(), HeaderMap{{"etag", "\"etag-3\""}}}},
+
+          {"POST "
+           "https://s3.us-east-1.amazonaws.com/my.bucket/"
+           "key_multipart?uploadId=upload-1",
+           HttpResponse{200, absl::Cord(kCompleteResult), {}}},
+      });
+  DefaultHttpTransportSetter mock_transport_setter{mock_transport};
+
+  auto context = DefaultTestContext();
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store,
+                                   kvstore::Open({{"driver", "s3"},
+                                                  {"bucket", "my.bucket"},
+                                                  {"aws_region", "us-east-1"}},
+                                                 context)
+                                       .result());
+
+  // 12 MB => 3 parts of 5 MB, 5 MB and 2 MB.
+  absl::Cord value(std::string(12 * 1024 * 1024, 'x'));
+  EXPECT_THAT(kvstore::Write(store, "key_multipart", value).result(),
+              MatchesTimestampedStorageGeneration(
+                  StorageGeneration::FromString("\"multipart-etag\"")));
+
+  int parts_uploaded = 0;
+  for (const auto& request : mock_transport->requests()) {
+    if (request.method == "PUT" &&
+        absl::StrContains(request.url, "partNumber")) {
+      parts_uploaded++;
+      EXPECT_THAT(request.headers,
+                  Contains(Pair("content-length",
+                                absl::StrContains(request.url, "partNumber=3")
+                                    ? "2097152"
+                                    : "5242880")));
+    }
+  }
+  EXPECT_EQ(parts_uploaded, 3);
+
+  tensorstore::internal::UnsetEnv("TENSORSTORE_S3_MULTIPART_PART_SIZE");
+}
+
 // TODO: Add tests for various responses
 TEST(S3KeyValueStoreTest, SimpleMock_Endpoint) {
   // Mocks for s3
@@ -20,8 +20,10 @@
 #include "tensorstore/kvstore/s3/s3_request_builder.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <string>
 #include <string_view>
@@ -29,6 +31,8 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/no_destructor.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/absl_check.h"
 #include "absl/log/absl_log.h"
 #include "absl/strings/ascii.h"
@@ -36,6 +40,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include <openssl/evp.h>  // IWYU pragma: keep
 #include <openssl/hmac.h>
@@ -117,16 +122,40 @@ std::string SigningString(std::string_view canonical_request,
 void GetSigningKey(std::string_view aws_secret_access_key,
                    std::string_view aws_region, const absl::Time& time,
                    unsigned char (&signing_key)[kHmacSize]) {
+  // The derivation chain requires 4 HMAC operations and its inputs change
+  // only when the secret, region, or UTC date change, so derived keys are
+  // cached across requests.
+  static absl::NoDestructor<absl::Mutex> mutex;
+  static absl::NoDestructor<
+      absl::flat_hash_map<std::string, std::array<unsigned char, kHmacSize>>>
+      cache;
+
   absl::TimeZone utc = absl::UTCTimeZone();
+  std::string date = absl::FormatTime("%Y%m%d", time, utc);
+  std::string cache_key =
+      absl::StrCat(date, "/", aws_region, "/", aws_secret_access_key);
+  {
+    absl::MutexLock lock(&*mutex);
+    if (auto it = cache->find(cache_key); it != cache->end()) {
+      memcpy(signing_key, it->second.data(), kHmacSize);
+      return;
+    }
+  }
+
   unsigned char date_key[kHmacSize];
   unsigned char date_region_key[kHmacSize];
   unsigned char date_region_service_key[kHmacSize];
 
-  ComputeHmac(absl::StrCat("AWS4", aws_secret_access_key),
-              absl::FormatTime("%Y%m%d", time, utc), date_key);
+  ComputeHmac(absl::StrCat("AWS4", aws_secret_access_key), date, date_key);
   ComputeHmac(date_key, aws_region, date_region_key);
   ComputeHmac(date_region_key, "s3", date_region_service_key);
   ComputeHmac(date_region_service_key, "aws4_request", signing_key);
+
+  absl::MutexLock lock(&*mutex);
+  // Entries become stale as the date, region, or credentials change; the
+  // live set is tiny, so just discard everything when it grows.
+  if (cache->size() >= 64) cache->clear();
+  memcpy((*cache)[std::move(cache_key)].data(), signing_key, kHmacSize);
 }
 
 std::string AuthorizationHeader(
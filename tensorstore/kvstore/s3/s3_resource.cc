@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 
@@ -28,6 +29,7 @@
 #include "tensorstore/context_resource_provider.h"
 #include "tensorstore/internal/env.h"
 #include "tensorstore/internal/log/verbose_flag.h"
+#include "tensorstore/internal/rate_limiter/adaptive_admission_queue.h"
 #include "tensorstore/internal/rate_limiter/admission_queue.h"
 #include "tensorstore/internal/rate_limiter/rate_limiter.h"
 #include "tensorstore/internal/rate_limiter/scaling_rate_limiter.h"
@@ -52,6 +54,7 @@ ABSL_FLAG(std::optional<absl::Duration>,
           "S3 Rate Limiter Doubling Time. "
           "Overrides TENSORSTORE_S3_RATE_LIMITER_DOUBLING_TIME");
 
+using ::tensorstore::internal::AdaptiveAdmissionQueue;
 using ::tensorstore::internal::AdmissionQueue;
 using ::tensorstore::internal::AnyContextResourceJsonBinder;
 using ::tensorstore::internal::ConstantRateLimiter;
@@ -89,6 +92,26 @@ absl::Duration GetEnvS3RateLimiterDoublingTime() {
       .value_or(absl::ZeroDuration());
 }
 
+bool GetEnvS3AdaptiveConcurrency() {
+  return internal::GetEnvValue<bool>("TENSORSTORE_S3_ADAPTIVE_CONCURRENCY")
+      .value_or(false);
+}
+
+// Constructs the admission queue for a concurrency limit.  When adaptive
+// concurrency is enabled, `limit` seeds an AIMD controller which adjusts the
+// in-flight limit from observed latency and throttling; otherwise the limit
+// is fixed.
+std::shared_ptr<AdmissionQueue> MakeAdmissionQueue(size_t limit) {
+  if (GetEnvS3AdaptiveConcurrency()) {
+    AdaptiveAdmissionQueue::Options options;
+    options.initial_limit = limit;
+    options.min_limit = std::max<size_t>(1, limit / 8);
+    options.max_limit = limit * 4;
+    return std::make_shared<AdaptiveAdmissionQueue>(options);
+  }
+  return std::make_shared<AdmissionQueue>(limit);
+}
+
 }  // namespace
 
 S3ConcurrencyResource::S3ConcurrencyResource(size_t shared_limit)
@@ -102,14 +125,14 @@ Result<S3ConcurrencyResource::Resource> S3ConcurrencyResource::Create(
   if (spec.limit) {
     Resource value;
     value.spec = spec;
-    value.queue = std::make_shared<AdmissionQueue>(*spec.limit);
+    value.queue = MakeAdmissionQueue(*spec.limit);
     return value;
   }
 
   absl::call_once(shared_once_, [&] {
     ABSL_LOG_IF(INFO, s3_logging)
         << "Using default AdmissionQueue with limit " << shared_limit_;
-    shared_resource_.queue = std::make_shared<AdmissionQueue>(shared_limit_);
+    shared_resource_.queue = MakeAdmissionQueue(shared_limit_);
   });
   return shared_resource_;
 }
@@ -0,0 +1,194 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/split_read_util.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_kvstore {
+namespace {
+
+// Number of times the split read is restarted after observing a concurrent
+// modification before giving up.
+constexpr int kMaxSplitReadRestarts = 3;
+
+struct SplitReadState
+    : public internal::AtomicReferenceCount<SplitReadState> {
+  SplitReadFunction read;
+  kvstore::Key key;
+  kvstore::ReadOptions options;
+  int64_t part_size;
+  Promise<kvstore::ReadResult> promise;
+
+  int restarts_ = 0;
+  std::vector<kvstore::ReadResult> parts_;
+  std::atomic<size_t> parts_remaining_{0};
+
+  absl::Mutex mutex_;
+  absl::Status error_ ABSL_GUARDED_BY(mutex_);
+  bool restart_ ABSL_GUARDED_BY(mutex_) = false;
+
+  // Issues the first part with the caller's generation conditions; the
+  // generation it observes then conditions the remaining parts.
+  void StartAttempt() {
+    auto part_options = options;
+    part_options.byte_range = OptionalByteRangeRequest::Range(
+        options.byte_range.inclusive_min,
+        std::min(options.byte_range.inclusive_min + part_size,
+                 options.byte_range.exclusive_max));
+    read(key, std::move(part_options))
+        .ExecuteWhenReady([self = internal::IntrusivePtr<SplitReadState>(this)](
+                              ReadyFuture<kvstore::ReadResult> ready) {
+          self->OnFirstPart(std::move(ready.result()));
+        });
+  }
+
+  void OnFirstPart(Result<kvstore::ReadResult>&& result) {
+    if (!result.ok()) {
+      promise.SetResult(std::move(result).status());
+      return;
+    }
+    if (!result->has_value()) {
+      // Missing value, or the caller's conditions were not satisfied; there
+      // is nothing further to read.
+      promise.SetResult(*std::move(result));
+      return;
+    }
+
+    const int64_t remaining_min =
+        options.byte_range.inclusive_min + part_size;
+    if (remaining_min >= options.byte_range.exclusive_max) {
+      // The first part covered the entire range.
+      promise.SetResult(*std::move(result));
+      return;
+    }
+    const size_t num_parts =
+        1 + (options.byte_range.exclusive_max - remaining_min + part_size -
+             1) /
+                part_size;
+    parts_.resize(num_parts);
+    parts_[0] = *std::move(result);
+    parts_remaining_.store(num_parts - 1, std::memory_order_relaxed);
+
+    for (size_t i = 1; i < num_parts; ++i) {
+      const int64_t inclusive_min = remaining_min + (i - 1) * part_size;
+      kvstore::ReadOptions part_options;
+      part_options.generation_conditions.if_equal =
+          parts_[0].stamp.generation;
+      part_options.staleness_bound = options.staleness_bound;
+      part_options.byte_range = OptionalByteRangeRequest::Range(
+          inclusive_min, std::min(inclusive_min + part_size,
+                                  options.byte_range.exclusive_max));
+      read(key, std::move(part_options))
+          .ExecuteWhenReady(
+              [self = internal::IntrusivePtr<SplitReadState>(this),
+               i](ReadyFuture<kvstore::ReadResult> ready) {
+                self->OnPart(i, std::move(ready.result()));
+              });
+    }
+  }
+
+  void OnPart(size_t i, Result<kvstore::ReadResult>&& result) {
+    if (!result.ok()) {
+      absl::MutexLock lock(&mutex_);
+      if (error_.ok()) error_ = std::move(result).status();
+    } else if (!result->has_value()) {
+      // The generation no longer matches the first part (or the value was
+      // deleted); the assembled value would be inconsistent.
+      absl::MutexLock lock(&mutex_);
+      restart_ = true;
+    } else {
+      parts_[i] = *std::move(result);
+    }
+    if (parts_remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    FinishAttempt();
+  }
+
+  void FinishAttempt() {
+    absl::Status error;
+    bool restart;
+    {
+      absl::MutexLock lock(&mutex_);
+      error = std::move(error_);
+      error_ = absl::OkStatus();
+      restart = std::exchange(restart_, false);
+    }
+    if (!error.ok()) {
+      promise.SetResult(std::move(error));
+      return;
+    }
+    if (restart) {
+      if (++restarts_ > kMaxSplitReadRestarts) {
+        promise.SetResult(absl::AbortedError(
+            "Concurrent modification during split read"));
+        return;
+      }
+      parts_.clear();
+      StartAttempt();
+      return;
+    }
+
+    auto result = std::move(parts_[0]);
+    for (size_t i = 1; i < parts_.size(); ++i) {
+      result.value.Append(std::move(parts_[i].value));
+    }
+    promise.SetResult(std::move(result));
+  }
+};
+
+}  // namespace
+
+Future<kvstore::ReadResult> MaybeSplitRead(SplitReadFunction read,
+                                           kvstore::Key key,
+                                           kvstore::ReadOptions options,
+                                           SplitReadOptions split_options) {
+  const auto& byte_range = options.byte_range;
+  if (!byte_range.IsRange() || byte_range.inclusive_min < 0 ||
+      byte_range.exclusive_max - byte_range.inclusive_min <=
+          split_options.threshold) {
+    return read(std::move(key), std::move(options));
+  }
+
+  auto op = PromiseFuturePair<kvstore::ReadResult>::Make();
+  auto state = internal::MakeIntrusivePtr<SplitReadState>();
+  state->read = std::move(read);
+  state->key = std::move(key);
+  state->options = std::move(options);
+  state->part_size = std::max<int64_t>(int64_t{1}, split_options.part_size);
+  state->promise = std::move(op.promise);
+  state->StartAttempt();
+  return std::move(op.future);
+}
+
+}  // namespace internal_kvstore
+}  // namespace tensorstore
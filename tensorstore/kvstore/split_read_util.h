@@ -0,0 +1,65 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_SPLIT_READ_UTIL_H_
+#define TENSORSTORE_KVSTORE_SPLIT_READ_UTIL_H_
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/util/future.h"
+
+namespace tensorstore {
+namespace internal_kvstore {
+
+/// Options for `MaybeSplitRead`.
+struct SplitReadOptions {
+  /// Explicit byte ranges larger than this are split into concurrent part
+  /// reads.
+  int64_t threshold = 64 * 1024 * 1024;
+
+  /// Size of each concurrent part read.
+  int64_t part_size = 32 * 1024 * 1024;
+};
+
+/// Function used by `MaybeSplitRead` to issue a single read request.
+using SplitReadFunction = std::function<Future<kvstore::ReadResult>(
+    kvstore::Key key, kvstore::ReadOptions options)>;
+
+/// Issues a read via `read`, splitting explicit byte ranges larger than
+/// `split_options.threshold` into concurrent ranged part reads of
+/// `split_options.part_size` bytes, reassembled into a single cord without
+/// copying.
+///
+/// The first part is issued with the caller's generation conditions; its
+/// generation then conditions the remaining parts, so the assembled value is
+/// a consistent snapshot.  If the value changes while parts are in flight,
+/// the read is restarted, and fails with `absl::StatusCode::kAborted` after
+/// repeated concurrent modification.
+///
+/// Reads without an explicit byte range (including suffix ranges) are
+/// forwarded to `read` unchanged, since the number of parts cannot be
+/// determined without knowing the value size.
+Future<kvstore::ReadResult> MaybeSplitRead(SplitReadFunction read,
+                                           kvstore::Key key,
+                                           kvstore::ReadOptions options,
+                                           SplitReadOptions split_options = {});
+
+}  // namespace internal_kvstore
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_SPLIT_READ_UTIL_H_
@@ -0,0 +1,240 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/split_read_util.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/time/clock.h"
+#include "tensorstore/kvstore/byte_range.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/kvstore/read_result.h"
+#include "tensorstore/kvstore/test_matchers.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+namespace kvstore = ::tensorstore::kvstore;
+
+using ::tensorstore::Future;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::OptionalByteRangeRequest;
+using ::tensorstore::StorageGeneration;
+using ::tensorstore::TimestampedStorageGeneration;
+using ::tensorstore::internal::MatchesKvsReadResult;
+using ::tensorstore::internal_kvstore::MaybeSplitRead;
+using ::tensorstore::internal_kvstore::SplitReadOptions;
+
+// Serves ranged reads of `value` with generation `generation`, recording
+// the options of each request.
+struct MockRangedRead {
+  std::string value = "0123456789abcdefghijklmnopqrstuvwxyz";
+  StorageGeneration generation = StorageGeneration::FromString("g1");
+  std::vector<kvstore::ReadOptions> requests;
+
+  Future<kvstore::ReadResult> operator()(kvstore::Key key,
+                                         kvstore::ReadOptions options) {
+    requests.push_back(options);
+    TimestampedStorageGeneration stamp{generation, absl::Now()};
+    if (!StorageGeneration::IsUnknown(
+            options.generation_conditions.if_equal) &&
+        options.generation_conditions.if_equal != generation) {
+      return kvstore::ReadResult::Unspecified(std::move(stamp));
+    }
+    if (options.generation_conditions.if_not_equal == generation) {
+      return kvstore::ReadResult::Unspecified(std::move(stamp));
+    }
+    auto byte_range = options.byte_range.Validate(value.size()).value();
+    return kvstore::ReadResult::Value(
+        absl::Cord(std::string_view(value).substr(byte_range.inclusive_min,
+                                                  byte_range.size())),
+        std::move(stamp));
+  }
+};
+
+TEST(MaybeSplitReadTest, SmallRangePassesThrough) {
+  MockRangedRead mock;
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Range(0, 8),
+                               },
+                               SplitReadOptions{16, 4})
+                    .result();
+  EXPECT_THAT(result, MatchesKvsReadResult(absl::Cord("01234567"),
+                                           mock.generation));
+  EXPECT_EQ(mock.requests.size(), 1);
+}
+
+TEST(MaybeSplitReadTest, FullReadPassesThrough) {
+  MockRangedRead mock;
+  auto result =
+      MaybeSplitRead(std::ref(mock), "key", kvstore::ReadOptions{},
+                     SplitReadOptions{16, 4})
+          .result();
+  EXPECT_THAT(result,
+              MatchesKvsReadResult(absl::Cord(mock.value), mock.generation));
+  EXPECT_EQ(mock.requests.size(), 1);
+}
+
+TEST(MaybeSplitReadTest, SuffixPassesThrough) {
+  MockRangedRead mock;
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Suffix(30),
+                               },
+                               SplitReadOptions{4, 4})
+                    .result();
+  EXPECT_THAT(result,
+              MatchesKvsReadResult(absl::Cord("uvwxyz"), mock.generation));
+  EXPECT_EQ(mock.requests.size(), 1);
+}
+
+TEST(MaybeSplitReadTest, LargeRangeIsSplit) {
+  MockRangedRead mock;
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Range(2, 32),
+                               },
+                               SplitReadOptions{16, 8})
+                    .result();
+  EXPECT_THAT(result, MatchesKvsReadResult(absl::Cord("23456789abcdefghijklmn"
+                                                      "opqrstuv"),
+                                           mock.generation));
+
+  ASSERT_EQ(mock.requests.size(), 4);
+  EXPECT_EQ(mock.requests[0].byte_range,
+            OptionalByteRangeRequest::Range(2, 10));
+  EXPECT_EQ(mock.requests[1].byte_range,
+            OptionalByteRangeRequest::Range(10, 18));
+  EXPECT_EQ(mock.requests[2].byte_range,
+            OptionalByteRangeRequest::Range(18, 26));
+  EXPECT_EQ(mock.requests[3].byte_range,
+            OptionalByteRangeRequest::Range(26, 32));
+
+  // Parts after the first are conditioned on the first part's generation.
+  EXPECT_TRUE(StorageGeneration::IsUnknown(
+      mock.requests[0].generation_conditions.if_equal));
+  for (size_t i = 1; i < mock.requests.size(); ++i) {
+    EXPECT_EQ(mock.requests[i].generation_conditions.if_equal,
+              mock.generation);
+  }
+}
+
+TEST(MaybeSplitReadTest, CallerConditionNotSatisfied) {
+  MockRangedRead mock;
+  kvstore::ReadOptions options;
+  options.generation_conditions.if_not_equal = mock.generation;
+  options.byte_range = OptionalByteRangeRequest::Range(0, 32);
+  auto result =
+      MaybeSplitRead(std::ref(mock), "key", std::move(options),
+                     SplitReadOptions{16, 8})
+          .result();
+  TENSORSTORE_ASSERT_OK(result);
+  EXPECT_TRUE(result->aborted());
+  EXPECT_EQ(mock.requests.size(), 1);
+}
+
+TEST(MaybeSplitReadTest, RestartsOnConcurrentModification) {
+  // The generation changes after the first two requests, so the first
+  // attempt observes a mismatch on its later parts and the read restarts.
+  struct : MockRangedRead {
+    Future<kvstore::ReadResult> operator()(kvstore::Key key,
+                                           kvstore::ReadOptions options) {
+      if (requests.size() == 2) {
+        generation = StorageGeneration::FromString("g2");
+      }
+      return MockRangedRead::operator()(std::move(key), std::move(options));
+    }
+  } mock;
+
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Range(0, 32),
+                               },
+                               SplitReadOptions{16, 8})
+                    .result();
+  EXPECT_THAT(result,
+              MatchesKvsReadResult(absl::Cord("0123456789abcdefghijklmnopqrs"
+                                              "tuv"),
+                                   StorageGeneration::FromString("g2")));
+  // First attempt: 4 requests; second attempt: 4 requests.
+  EXPECT_EQ(mock.requests.size(), 8);
+}
+
+TEST(MaybeSplitReadTest, FailsAfterRepeatedConcurrentModification) {
+  // Every conditional part read observes a mismatch.
+  struct : MockRangedRead {
+    Future<kvstore::ReadResult> operator()(kvstore::Key key,
+                                           kvstore::ReadOptions options) {
+      generation = StorageGeneration::FromString(
+          std::string(1, static_cast<char>('a' + requests.size())));
+      return MockRangedRead::operator()(std::move(key), std::move(options));
+    }
+  } mock;
+
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Range(0, 32),
+                               },
+                               SplitReadOptions{16, 8})
+                    .result();
+  EXPECT_THAT(result, MatchesStatus(absl::StatusCode::kAborted));
+}
+
+TEST(MaybeSplitReadTest, ReadErrorPropagates) {
+  struct : MockRangedRead {
+    Future<kvstore::ReadResult> operator()(kvstore::Key key,
+                                           kvstore::ReadOptions options) {
+      if (options.byte_range.inclusive_min != 0) {
+        return absl::UnavailableError("part failed");
+      }
+      return MockRangedRead::operator()(std::move(key), std::move(options));
+    }
+  } mock;
+
+  auto result = MaybeSplitRead(std::ref(mock), "key",
+                               kvstore::ReadOptions{
+                                   {},
+                                   absl::InfiniteFuture(),
+                                   OptionalByteRangeRequest::Range(0, 32),
+                               },
+                               SplitReadOptions{16, 8})
+                    .result();
+  EXPECT_THAT(result, MatchesStatus(absl::StatusCode::kUnavailable));
+}
+
+}  // namespace
@@ -32,6 +32,11 @@ enum class SupportedFeatures : uint64_t {
   /// i.e. `WriteOptions::if_equal` is handled race-free.  This implies
   /// `kSingleKeyAtomicReadModifyWrite`.
   kSingleKeyAtomicReadModifyWrite = 8,
+
+  /// Indicates if `Driver::ExperimentalCopyRangeFrom` is supported for a
+  /// source kvstore backed by the same driver, without streaming values
+  /// through this process (e.g. a server-side or in-kernel copy).
+  kExperimentalCopyRangeFrom = 16,
 };
 
 constexpr inline SupportedFeatures operator&(SupportedFeatures a,
@@ -33,6 +33,7 @@
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "absl/types/compare.h"
+#include "tensorstore/batch.h"
 #include "tensorstore/internal/compare.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/internal/metrics/counter.h"
@@ -131,7 +132,8 @@ void PerformWriteback(Driver* driver, Controller controller,
 }
 
 void StartWriteback(ReadModifyWriteEntry& entry,
-                    absl::Time staleness_bound = absl::InfinitePast());
+                    absl::Time staleness_bound = absl::InfinitePast(),
+                    Batch::View writeback_batch = {});
 
 void DeletedEntryDone(DeleteRangeEntry& dr_entry, bool error, size_t count = 1);
 
@@ -415,7 +417,8 @@ void ReceiveWritebackCommon(ReadModifyWriteEntry& entry,
   entry.flags_ = flags;
 }
 
-void StartWriteback(ReadModifyWriteEntry& entry, absl::Time staleness_bound) {
+void StartWriteback(ReadModifyWriteEntry& entry, absl::Time staleness_bound,
+                    Batch::View writeback_batch) {
   TENSORSTORE_KVSTORE_DEBUG_LOG(
       entry, "StartWriteback: staleness_bound=", staleness_bound);
   // First mark all previous entries as not having yet provided a writeback
@@ -429,6 +432,10 @@ void StartWriteback(ReadModifyWriteEntry& entry, absl::Time staleness_bound) {
 
   ReadModifyWriteSource::WritebackOptions writeback_options;
   writeback_options.staleness_bound = staleness_bound;
+  // Any reads issued by the entry's source in order to compute the writeback
+  // value may be deferred and coalesced with reads for other entries in the
+  // same phase.
+  writeback_options.batch = writeback_batch;
   writeback_options.writeback_mode =
       (entry.flags_ & ReadModifyWriteEntry::kDeleted)
           ? ReadModifyWriteSource::kValidateOnly
@@ -620,6 +627,12 @@ void StartWriteback(ReadModifyWriteEntry& entry, absl::Time staleness_bound) {
           state_->entry = prev;
           TENSORSTORE_KVSTORE_DEBUG_LOG(*prev,
                                         "Continuing writeback validate only");
+          // Note: The batch specified to `StartWriteback`, if any, is not
+          // used for these additional requests: they are issued only after a
+          // prior writeback request completes, which may be after the batch
+          // has already been submitted.  Retaining a batch reference here
+          // could prevent the batch from ever being submitted, since the
+          // prior request may itself depend on a read deferred to the batch.
           ReadModifyWriteSource::WritebackOptions writeback_options;
           writeback_options.staleness_bound = state_->staleness_bound;
           writeback_options.writeback_mode =
@@ -732,6 +745,7 @@ void ReadModifyWriteEntry::KvsRead(
     writeback_options.generation_conditions.if_not_equal =
         std::move(options.generation_conditions.if_not_equal);
     writeback_options.staleness_bound = options.staleness_bound;
+    writeback_options.batch = std::move(options.batch);
     writeback_options.writeback_mode =
         ReadModifyWriteSource::kSpecifyUnchangedWriteback;
     this->prev_->source_->KvsWriteback(
@@ -903,6 +917,14 @@ void WritebackPhase(
     SinglePhaseMutation& single_phase_mutation, absl::Time staleness_bound,
     absl::FunctionRef<bool(ReadModifyWriteEntry& entry)> predicate) {
   assert(single_phase_mutation.remaining_entries_.IsDone());
+  // Shared batch for any reads issued by the writeback requests below.  The
+  // batch is submitted once writeback has been requested for all entries in
+  // the phase.  This allows drivers with batch support, such as the sharded
+  // kvstore adapters, to coalesce commit-time reads for entries stored in the
+  // same underlying object into a single I/O operation.  Note that the
+  // entries are visited in key order, which keeps reads for adjacent keys
+  // adjacent in the batch.
+  Batch writeback_batch = Batch::New();
   size_t entry_count = 0;
   for (auto& entry : single_phase_mutation.entries_) {
     if (entry.entry_type() == kReadModifyWrite) {
@@ -917,7 +939,7 @@ void WritebackPhase(
       }
       if (predicate(rmw_entry)) {
         ++entry_count;
-        StartWriteback(rmw_entry, staleness_bound);
+        StartWriteback(rmw_entry, staleness_bound, writeback_batch);
       }
     } else {
       auto& dr_entry = static_cast<DeleteRangeEntry&>(entry);
@@ -930,7 +952,7 @@ void WritebackPhase(
         if (predicate(rmw_entry)) {
           ++deleted_entry_count;
           StartWriteback(static_cast<ReadModifyWriteEntry&>(deleted_entry),
-                         staleness_bound);
+                         staleness_bound, writeback_batch);
         }
       }
       DeletedEntryDone(dr_entry, /*error=*/false, -deleted_entry_count);
@@ -1237,11 +1259,28 @@ std::string MultiPhaseMutation::DescribeFirstEntry() {
   return DescribeEntry(*phases_.prev_->entries_.begin());
 }
 
+void* MutationEntryArena::Allocate(size_t size, size_t alignment) {
+  assert(alignment <= alignof(std::max_align_t));
+  assert(size <= kBlockSize);
+  void* ptr = next_;
+  size_t space = remaining_;
+  if (!ptr || !std::align(alignment, size, ptr, space)) {
+    // Note: `new unsigned char[n]` is suitably aligned for any object of size
+    // at most `n`.
+    blocks_.emplace_back(new unsigned char[kBlockSize]);
+    ptr = blocks_.back().get();
+    space = kBlockSize;
+  }
+  next_ = static_cast<unsigned char*>(ptr) + size;
+  remaining_ = space - size;
+  return ptr;
+}
+
 ReadModifyWriteEntry* MultiPhaseMutation::AllocateReadModifyWriteEntry() {
-  return new ReadModifyWriteEntry;
+  return entry_arena_.New<ReadModifyWriteEntry>();
 }
 void MultiPhaseMutation::FreeReadModifyWriteEntry(ReadModifyWriteEntry* entry) {
-  delete entry;
+  entry->~ReadModifyWriteEntry();
 }
 void ReadDirectly(Driver* driver, ReadModifyWriteEntry& entry,
                   ReadModifyWriteTarget::TransactionalReadOptions&& options,
@@ -1291,11 +1330,12 @@ void AtomicMultiPhaseMutationBase::RetryAtomicWriteback(
 }
 
 ReadModifyWriteEntry* AtomicMultiPhaseMutation::AllocateReadModifyWriteEntry() {
-  return new BufferedReadModifyWriteEntry;
+  return entry_arena_.New<BufferedReadModifyWriteEntry>();
 }
 void AtomicMultiPhaseMutation::FreeReadModifyWriteEntry(
     ReadModifyWriteEntry* entry) {
-  delete static_cast<BufferedReadModifyWriteEntry*>(entry);
+  static_cast<BufferedReadModifyWriteEntry*>(entry)
+      ->~BufferedReadModifyWriteEntry();
 }
 
 void AtomicMultiPhaseMutationBase::AtomicWritebackReady(
@@ -1563,6 +1603,7 @@ class WriteViaExistingTransactionNode : public internal::TransactionState::Node,
     read_options.generation_conditions.if_not_equal =
         StorageGeneration::Clean(read_result_.stamp.generation);
     read_options.staleness_bound = options.staleness_bound;
+    read_options.batch = std::move(options.batch);
     struct ReadReceiverImpl {
       WriteViaExistingTransactionNode& source_;
       ReadModifyWriteSource::WritebackReceiver receiver_;
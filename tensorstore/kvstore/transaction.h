@@ -88,10 +88,13 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <memory>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "absl/log/absl_log.h"
 #include "absl/status/status.h"
@@ -418,6 +421,38 @@ void WritebackSuccess(ReadModifyWriteEntry& entry,
                       TimestampedStorageGeneration new_stamp);
 void InvalidateReadState(SinglePhaseMutation& single_phase_mutation);
 
+/// Monotonic arena from which `ReadModifyWriteEntry` objects are allocated.
+///
+/// Transactions with a large number of mutations would otherwise spend
+/// significant time allocating and freeing each entry individually.  Instead,
+/// entries are carved out of fixed-size blocks owned by the arena; freeing an
+/// entry merely runs its destructor, and the blocks are freed wholesale when
+/// the owning `MultiPhaseMutation` is destroyed after commit or abort
+/// completes.
+class MutationEntryArena {
+ public:
+  /// Allocates and default-constructs an entry of type `T`.
+  ///
+  /// The storage remains valid until the arena is destroyed.  Like other
+  /// modifications to the mutation data structures, this must be called with
+  /// the `MultiPhaseMutation` mutex held.
+  template <typename T>
+  T* New() {
+    return new (Allocate(sizeof(T), alignof(T))) T;
+  }
+
+ private:
+  void* Allocate(size_t size, size_t alignment);
+
+  // Chosen to amortize block allocation over a large number of entries while
+  // keeping transactions with few mutations cheap.
+  constexpr static size_t kBlockSize = 4096;
+
+  std::vector<std::unique_ptr<unsigned char[]>> blocks_;
+  unsigned char* next_ = nullptr;
+  size_t remaining_ = 0;
+};
+
 class MultiPhaseMutation {
  public:
   MultiPhaseMutation();
@@ -520,6 +555,10 @@ class MultiPhaseMutation {
 
  protected:
   ~MultiPhaseMutation() = default;
+
+  /// Arena used by `AllocateReadModifyWriteEntry` (including overrides in
+  /// derived classes that use a derived entry type).
+  MutationEntryArena entry_arena_;
 };
 
 inline MultiPhaseMutation& MutationEntry::multi_phase() const {
@@ -21,6 +21,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/cord.h"
 #include "absl/time/clock.h"
+#include "tensorstore/batch.h"
 #include "tensorstore/internal/intrusive_ptr.h"
 #include "tensorstore/kvstore/byte_range.h"
 #include "tensorstore/kvstore/generation.h"
@@ -36,6 +37,7 @@ namespace {
 
 namespace kvstore = tensorstore::kvstore;
 
+using ::tensorstore::Batch;
 using ::tensorstore::MatchesStatus;
 using ::tensorstore::OptionalByteRangeRequest;
 using ::tensorstore::StorageGeneration;
@@ -215,6 +217,51 @@ TEST(KvStoreTest, ReadMismatch) {
                             "Error writing \"a\": Generation mismatch"));
 }
 
+TEST(KvStoreTest, CommitTimeReadsShareBatch) {
+  auto mock_driver = MockKeyValueStore::Make();
+
+  Transaction txn(tensorstore::isolated);
+
+  KvStore store(mock_driver, "", txn);
+
+  // Conditional writes require a read at commit time to verify the condition.
+  for (const auto* key : {"a", "b"}) {
+    kvstore::WriteOptions options;
+    options.generation_conditions.if_equal = StorageGeneration::FromString("g");
+    TENSORSTORE_ASSERT_OK(
+        kvstore::Write(store, key, absl::Cord("value"), std::move(options)));
+  }
+
+  auto future = txn.CommitAsync();
+
+  // The reads issued at commit time for both entries specify the same batch,
+  // which allows drivers with batch support to coalesce them.
+  auto req_a = mock_driver->read_requests.pop();
+  auto req_b = mock_driver->read_requests.pop();
+  EXPECT_THAT(req_a.key, "a");
+  EXPECT_THAT(req_b.key, "b");
+  EXPECT_TRUE(req_a.options.batch);
+  EXPECT_EQ(Batch::View(req_a.options.batch).impl_,
+            Batch::View(req_b.options.batch).impl_);
+  for (auto* req : {&req_a, &req_b}) {
+    EXPECT_THAT(req->options.generation_conditions.if_not_equal,
+                StorageGeneration::FromString("g"));
+    req->promise.SetResult(ReadResult::Unspecified(TimestampedStorageGeneration(
+        StorageGeneration::FromString("g"), absl::Now())));
+  }
+
+  for (const auto* key : {"a", "b"}) {
+    auto req = mock_driver->write_requests.pop();
+    EXPECT_THAT(req.key, key);
+    EXPECT_THAT(req.options.generation_conditions.if_equal,
+                StorageGeneration::FromString("g"));
+    req.promise.SetResult(TimestampedStorageGeneration(
+        StorageGeneration::FromString("h"), absl::Now()));
+  }
+
+  TENSORSTORE_ASSERT_OK(future);
+}
+
 TEST(KvStoreTest, ListInvalid) {
   auto mock_driver = MockKeyValueStore::Make();
 
@@ -0,0 +1,93 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/kvstore/write_stream.h"
+
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "tensorstore/kvstore/driver.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/transaction.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/str_cat.h"
+
+namespace tensorstore {
+namespace kvstore {
+namespace {
+
+/// Fallback for drivers without native streaming support: buffers the full
+/// value in memory and issues a single `Write` on `Close`.
+class BufferedWriteStreamWriter : public WriteStreamWriter {
+ public:
+  BufferedWriteStreamWriter(DriverPtr driver, Key key, WriteOptions options)
+      : driver_(std::move(driver)),
+        key_(std::move(key)),
+        options_(std::move(options)) {}
+
+  Future<const void> Write(absl::Cord chunk) override {
+    if (closed_) {
+      return absl::FailedPreconditionError(
+          "Write called on closed WriteStreamWriter");
+    }
+    value_.Append(std::move(chunk));
+    return absl::OkStatus();
+  }
+
+  Future<TimestampedStorageGeneration> Close() override {
+    if (closed_) {
+      return absl::FailedPreconditionError(
+          "Close called on closed WriteStreamWriter");
+    }
+    closed_ = true;
+    return driver_->Write(std::move(key_), std::move(value_),
+                          std::move(options_));
+  }
+
+ private:
+  DriverPtr driver_;
+  Key key_;
+  WriteOptions options_;
+  absl::Cord value_;
+  bool closed_ = false;
+};
+
+}  // namespace
+
+WriteStreamWriter::~WriteStreamWriter() = default;
+
+Result<std::unique_ptr<WriteStreamWriter>> Driver::ExperimentalWriteStream(
+    Key key, WriteOptions options) {
+  return std::make_unique<BufferedWriteStreamWriter>(
+      DriverPtr(this), std::move(key), std::move(options));
+}
+
+Result<std::unique_ptr<WriteStreamWriter>> ExperimentalWriteStream(
+    const KvStore& store, std::string_view key, WriteOptions options) {
+  if (store.transaction != no_transaction) {
+    return absl::UnimplementedError(
+        "streaming writes not supported for transactional stores");
+  }
+  return store.driver->ExperimentalWriteStream(
+      tensorstore::StrCat(store.path, key), std::move(options));
+}
+
+}  // namespace kvstore
+}  // namespace tensorstore
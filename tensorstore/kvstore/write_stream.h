@@ -0,0 +1,73 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_KVSTORE_WRITE_STREAM_H_
+#define TENSORSTORE_KVSTORE_WRITE_STREAM_H_
+
+#include <memory>
+#include <string_view>
+
+#include "absl/strings/cord.h"
+#include "tensorstore/kvstore/generation.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/operations.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace kvstore {
+
+/// Streams a value to a key incrementally, with bounded memory.
+///
+/// Obtained from `ExperimentalWriteStream`.  Chunks are appended in order with
+/// `Write`; the value becomes visible only once `Close` resolves, with the
+/// same atomicity and conditional-write semantics as `Driver::Write`.
+///
+/// This API is experimental and subject to change.
+class WriteStreamWriter {
+ public:
+  virtual ~WriteStreamWriter();
+
+  /// Appends `chunk` to the value.
+  ///
+  /// Chunks must be written sequentially: `Write` and `Close` must not be
+  /// called until the future returned by the previous `Write` call has become
+  /// ready.  The returned future provides backpressure; writing the next chunk
+  /// only after it resolves bounds the memory buffered by the writer.
+  virtual Future<const void> Write(absl::Cord chunk) = 0;
+
+  /// Finalizes the value.  No further calls are permitted.
+  ///
+  /// Resolves to the generation of the newly written value, or to
+  /// `StorageGeneration::Unknown()` if a condition specified in the write
+  /// options was not satisfied.
+  virtual Future<TimestampedStorageGeneration> Close() = 0;
+};
+
+/// Opens a streaming writer for `store.path + key`.
+///
+/// Drivers without native streaming support buffer the full value in memory
+/// and issue a single `Write` on `Close`; drivers with native support (e.g.
+/// `gcs`) stream chunks to storage as they are written.
+///
+/// Transactional stores are not supported.
+///
+/// This API is experimental and subject to change.
+Result<std::unique_ptr<WriteStreamWriter>> ExperimentalWriteStream(
+    const KvStore& store, std::string_view key, WriteOptions options = {});
+
+}  // namespace kvstore
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_KVSTORE_WRITE_STREAM_H_
@@ -151,6 +151,13 @@ class ShardIndexKeyValueStore : public kvstore::Driver {
 // Read-only shard index cache.
 //
 // This is used by ShardedKeYValueStore for read and list requests.
+//
+// The decoded shard index is shared across all concurrent and subsequent
+// sub-chunk reads of the shard, so a read that hits a current cached index
+// requires just one round trip for the sub-chunk data itself.  When a read
+// specifies a newer staleness bound than the cached index, `KvsBackedCache`
+// revalidates conditionally (`if_not_equal` with the cached generation), so
+// an unchanged index is not re-transferred or re-parsed.
 class ShardIndexCache
     : public internal::KvsBackedCache<ShardIndexCache, internal::AsyncCache> {
   using Base = internal::KvsBackedCache<ShardIndexCache, internal::AsyncCache>;
@@ -240,6 +247,14 @@ class ShardIndexCache
 /// update existing non-empty shards, it does read the full contents of the
 /// existing shard and store it within the cache entry.  This data is discarded
 /// once writeback completes.
+///
+/// Writeback always re-writes the complete shard, even if only a small subset
+/// of the entries were modified: the base `kvstore::Driver` interface supports
+/// only whole-value writes, so an append-based partial update (writing just
+/// the new sub-chunk data and re-writing the shard index) cannot be expressed,
+/// regardless of `ShardIndexLocation`.  Unmodified entries are carried over as
+/// zero-copy cord slices of the existing shard, so the cost is in I/O rather
+/// than memory copies.
 class ShardedKeyValueStoreWriteCache
     : public internal::KvsBackedCache<ShardedKeyValueStoreWriteCache,
                                       internal::AsyncCache> {
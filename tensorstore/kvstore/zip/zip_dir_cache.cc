@@ -236,11 +236,12 @@ struct ReadDirectoryOp
       last_header_offset = it->local_header_offset;
     }
 
-    // Sort directory by filename.
+    // Sort directory by filename, so that lookups and range listings can use
+    // binary search.
     std::sort(dir.entries.begin(), dir.entries.end(),
               [](const auto& a, const auto& b) {
                 return std::tie(a.filename, a.local_header_offset) <
-                       std::tie(b.filename, a.local_header_offset);
+                       std::tie(b.filename, b.local_header_offset);
               });
 
     ABSL_LOG_IF(INFO, zip_logging) << dir;
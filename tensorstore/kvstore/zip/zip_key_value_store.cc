@@ -367,6 +367,9 @@ struct ListState : public internal::AtomicReferenceCount<ListState> {
         dir->entries.begin(), dir->entries.end(), options_.range.inclusive_min,
         [](const auto& e, const std::string& k) { return e.filename < k; });
     for (; it != dir->entries.end(); ++it) {
+      // Stop early if the receiver cancelled the list operation; large
+      // archives may contain hundreds of thousands of entries.
+      if (!promise_.result_needed()) break;
       if (KeyRange::CompareKeyAndExclusiveMax(
               it->filename, options_.range.exclusive_max) >= 0) {
         break;
@@ -17,8 +17,12 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "absl/status/status.h"
 #include <nlohmann/json.hpp>
+#include "tensorstore/batch.h"
+#include "tensorstore/context.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/index.h"
 #include "tensorstore/open_mode.h"
@@ -123,7 +127,8 @@ std::enable_if_t<
      std::is_same_v<J, ::nlohmann::json>),
     Future<TensorStore<Element, Rank, Mode>>>
 Open(J json_spec, Option&&... option) {
-  TENSORSTORE_ASSIGN_OR_RETURN(auto spec, Spec::FromJson(json_spec));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto spec, internal::ParseSpecCached(std::move(json_spec)));
   return tensorstore::Open<Element, Rank, Mode>(
       std::move(spec), std::forward<Option>(option)...);
 }
@@ -133,11 +138,71 @@ template <typename Element = void, DimensionIndex Rank = dynamic_rank,
 std::enable_if_t<std::is_same_v<J, ::nlohmann::json>,
                  Future<TensorStore<Element, Rank, Mode>>>
 Open(J json_spec, TransactionalOpenOptions&& options) {
-  TENSORSTORE_ASSIGN_OR_RETURN(auto spec, Spec::FromJson(json_spec));
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto spec, internal::ParseSpecCached(std::move(json_spec)));
   return tensorstore::Open<Element, Rank, Mode>(std::move(spec),
                                                 std::move(options));
 }
 
+/// Opens multiple TensorStores, sharing resources between the opens.
+///
+/// This is a more efficient alternative to calling `Open` separately for each
+/// spec when opening many TensorStores at once, e.g. all of the arrays in a
+/// group: unless overridden by an option, all of the opens share a single
+/// `Batch`, which coalesces the metadata reads issued by the individual
+/// drivers into a minimal number of kvstore requests, and a single `Context`,
+/// which deduplicates shared resources such as cache pools, concurrency
+/// limits, and the underlying kvstore drivers.  With separate `Open` calls,
+/// each open that does not specify a context binds its own
+/// `Context::Default()` and issues its metadata reads unbatched.
+///
+/// The same options are applied to every spec.  The returned futures
+/// correspond to `specs`, in order; an error opening one spec does not affect
+/// the others.
+///
+/// \param specs The specs to open.
+/// \param options Options compatible with `TransactionalOpenOptions`, applied
+///     to every spec.
+/// \relates TensorStore
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          ReadWriteMode Mode = ReadWriteMode::dynamic>
+std::vector<Future<TensorStore<Element, Rank, Mode>>> OpenAll(
+    std::vector<Spec> specs, TransactionalOpenOptions&& options) {
+  // Bind all of the specs to the same context; otherwise each open would bind
+  // its resources against a separate `Context::Default()`.
+  if (!options.context) options.context = Context::Default();
+  if (!options.batch) options.batch = Batch::New();
+  std::vector<Future<TensorStore<Element, Rank, Mode>>> futures;
+  futures.reserve(specs.size());
+  for (auto& spec : specs) {
+    TransactionalOpenOptions spec_options = options;
+    futures.push_back(tensorstore::Open<Element, Rank, Mode>(
+        std::move(spec), std::move(spec_options)));
+  }
+  // Release the batch reference held by `options`.  Once any references
+  // retained by the caller are also released, the reads issued by the opens
+  // are submitted together.
+  options.batch.Release();
+  return futures;
+}
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          ReadWriteMode Mode = ReadWriteMode::dynamic, typename... Option>
+std::enable_if_t<
+    IsCompatibleOptionSequence<TransactionalOpenOptions, Option...>,
+    std::vector<Future<TensorStore<Element, Rank, Mode>>>>
+OpenAll(std::vector<Spec> specs, Option&&... option) {
+  TransactionalOpenOptions options;
+  if (absl::Status status =
+          internal::SetAll(options, std::forward<Option>(option)...);
+      !status.ok()) {
+    std::vector<Future<TensorStore<Element, Rank, Mode>>> futures(
+        specs.size(), Future<TensorStore<Element, Rank, Mode>>(status));
+    return futures;
+  }
+  return tensorstore::OpenAll<Element, Rank, Mode>(std::move(specs),
+                                                   std::move(options));
+}
+
 }  // namespace tensorstore
 
 #endif  // TENSORSTORE_OPEN_H_
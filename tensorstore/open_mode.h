@@ -62,7 +62,11 @@ enum class OpenMode {
   /// necessary metadata based on constraints in the spec, using the same
   /// defaults for any unspecified metadata as when creating a new TensorStore.
   /// The stored metadata may still be accessed by subsequent operations that
-  /// need to re-validate or modify the metadata.
+  /// need to re-validate or modify the metadata.  If the spec additionally
+  /// requests metadata rechecking (e.g. `recheck_cached_metadata`), the stored
+  /// metadata is fetched in the background, concurrently with the open and any
+  /// operations issued by the caller, and is validated by subsequent
+  /// operations that consult the metadata.
   ///
   /// This option must be specified in conjunction with `open` and must not be
   /// specified in conjunction with `delete_existing`.
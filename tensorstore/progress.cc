@@ -14,7 +14,15 @@
 
 #include "tensorstore/progress.h"
 
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
 #include <ostream>
+#include <utility>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 
 namespace tensorstore {
 
@@ -44,6 +52,42 @@ std::ostream& operator<<(std::ostream& os, const WriteProgress& a) {
             << ", committed_elements=" << a.committed_elements << " }";
 }
 
+bool operator==(const ReadOperationStats& a, const ReadOperationStats& b) {
+  return a.copied_elements == b.copied_elements &&
+         a.copied_bytes == b.copied_bytes && a.chunk_count == b.chunk_count &&
+         a.total_time == b.total_time &&
+         a.first_chunk_time == b.first_chunk_time && a.copy_time == b.copy_time;
+}
+bool operator!=(const ReadOperationStats& a, const ReadOperationStats& b) {
+  return !(a == b);
+}
+std::ostream& operator<<(std::ostream& os, const ReadOperationStats& a) {
+  return os << "{ copied_elements=" << a.copied_elements
+            << ", copied_bytes=" << a.copied_bytes
+            << ", chunk_count=" << a.chunk_count
+            << ", total_time=" << a.total_time
+            << ", first_chunk_time=" << a.first_chunk_time
+            << ", copy_time=" << a.copy_time << " }";
+}
+
+bool operator==(const WriteOperationStats& a, const WriteOperationStats& b) {
+  return a.copied_elements == b.copied_elements &&
+         a.copied_bytes == b.copied_bytes && a.chunk_count == b.chunk_count &&
+         a.total_time == b.total_time && a.copy_time == b.copy_time &&
+         a.commit_time == b.commit_time;
+}
+bool operator!=(const WriteOperationStats& a, const WriteOperationStats& b) {
+  return !(a == b);
+}
+std::ostream& operator<<(std::ostream& os, const WriteOperationStats& a) {
+  return os << "{ copied_elements=" << a.copied_elements
+            << ", copied_bytes=" << a.copied_bytes
+            << ", chunk_count=" << a.chunk_count
+            << ", total_time=" << a.total_time
+            << ", copy_time=" << a.copy_time
+            << ", commit_time=" << a.commit_time << " }";
+}
+
 bool operator==(const CopyProgress& a, const CopyProgress& b) {
   return a.total_elements == b.total_elements &&
          a.read_elements == b.read_elements &&
@@ -60,4 +104,67 @@ std::ostream& operator<<(std::ostream& os, const CopyProgress& a) {
             << ", committed_elements=" << a.committed_elements << " }";
 }
 
+namespace {
+
+/// Common implementation of `RateLimitProgress`.
+///
+/// `is_complete` identifies updates that must always be forwarded.
+template <typename ProgressFunction, typename Progress, typename IsComplete>
+ProgressFunction RateLimitProgressImpl(ProgressFunction function,
+                                       absl::Duration min_interval,
+                                       IsComplete is_complete) {
+  if (!function.value || min_interval <= absl::ZeroDuration()) {
+    return function;
+  }
+  struct State {
+    typename ProgressFunction::Function function;
+    int64_t min_interval_ns;
+    std::atomic<int64_t> last_ns{0};
+  };
+  auto state = std::make_shared<State>();
+  state->function = std::move(function.value);
+  state->min_interval_ns = absl::ToInt64Nanoseconds(min_interval);
+  return ProgressFunction{
+      [state = std::move(state), is_complete](Progress progress) {
+        if (!is_complete(progress)) {
+          const int64_t now_ns = absl::GetCurrentTimeNanos();
+          int64_t last_ns = state->last_ns.load(std::memory_order_relaxed);
+          if (now_ns - last_ns < state->min_interval_ns ||
+              !state->last_ns.compare_exchange_strong(
+                  last_ns, now_ns, std::memory_order_relaxed)) {
+            return;
+          }
+        }
+        state->function(std::move(progress));
+      }};
+}
+
+}  // namespace
+
+ReadProgressFunction RateLimitProgress(ReadProgressFunction function,
+                                       absl::Duration min_interval) {
+  return RateLimitProgressImpl<ReadProgressFunction, ReadProgress>(
+      std::move(function), min_interval, [](const ReadProgress& progress) {
+        return progress.copied_elements >= progress.total_elements;
+      });
+}
+
+WriteProgressFunction RateLimitProgress(WriteProgressFunction function,
+                                        absl::Duration min_interval) {
+  return RateLimitProgressImpl<WriteProgressFunction, WriteProgress>(
+      std::move(function), min_interval, [](const WriteProgress& progress) {
+        return progress.committed_elements >= progress.total_elements ||
+               progress.copied_elements >= progress.total_elements;
+      });
+}
+
+CopyProgressFunction RateLimitProgress(CopyProgressFunction function,
+                                       absl::Duration min_interval) {
+  return RateLimitProgressImpl<CopyProgressFunction, CopyProgress>(
+      std::move(function), min_interval, [](const CopyProgress& progress) {
+        return progress.committed_elements >= progress.total_elements ||
+               progress.copied_elements >= progress.total_elements;
+      });
+}
+
 }  // namespace tensorstore
@@ -15,10 +15,13 @@
 #ifndef TENSORSTORE_PROGRESS_H_
 #define TENSORSTORE_PROGRESS_H_
 
+#include <atomic>
 #include <iosfwd>
+#include <memory>
 #include <utility>
 
 #include "absl/status/status.h"
+#include "absl/time/time.h"
 #include "tensorstore/index.h"
 #include "tensorstore/internal/poly/poly.h"
 #include "tensorstore/util/future.h"
@@ -88,6 +91,157 @@ struct CopyProgress {
   friend std::ostream& operator<<(std::ostream& os, const CopyProgress& a);
 };
 
+/// Shared progress counters for `Read` operations, updated on the hot path
+/// with relaxed atomic operations.
+///
+/// Unlike `ReadProgressFunction`, which invokes a callback for every chunk
+/// completion, counters are polled at whatever rate a progress display
+/// requires, so the per-chunk cost is a single atomic add.  The same block
+/// may be shared by multiple concurrent operations, in which case the
+/// counters accumulate across all of them.
+///
+/// \relates ReadProgress
+struct AtomicReadProgress {
+  /// Total number of elements to be read.
+  std::atomic<Index> total_elements{0};
+
+  /// Number of elements that have been copied.
+  std::atomic<Index> copied_elements{0};
+
+  /// Returns a snapshot of the counters for display purposes.  The counters
+  /// are read individually and may not be mutually consistent.
+  ReadProgress snapshot() const {
+    return {total_elements.load(std::memory_order_relaxed),
+            copied_elements.load(std::memory_order_relaxed)};
+  }
+};
+
+/// Shared progress counters for `Write` operations.
+///
+/// \relates WriteProgress
+struct AtomicWriteProgress {
+  /// Total number of elements to be written.
+  std::atomic<Index> total_elements{0};
+
+  /// Number of elements that have been copied.
+  std::atomic<Index> copied_elements{0};
+
+  /// Number of elements that have been committed.
+  std::atomic<Index> committed_elements{0};
+
+  /// Returns a snapshot of the counters for display purposes.  The counters
+  /// are read individually and may not be mutually consistent.
+  WriteProgress snapshot() const {
+    return {total_elements.load(std::memory_order_relaxed),
+            copied_elements.load(std::memory_order_relaxed),
+            committed_elements.load(std::memory_order_relaxed)};
+  }
+};
+
+/// Shared progress counters for `Copy` operations.
+///
+/// \relates CopyProgress
+struct AtomicCopyProgress {
+  /// Total number of elements to be copied.
+  std::atomic<Index> total_elements{0};
+
+  /// Number of elements that are ready for reading.
+  std::atomic<Index> read_elements{0};
+
+  /// Number of elements that have been completed.
+  std::atomic<Index> copied_elements{0};
+
+  /// Number of elements that have been committed.
+  std::atomic<Index> committed_elements{0};
+
+  /// Returns a snapshot of the counters for display purposes.  The counters
+  /// are read individually and may not be mutually consistent.
+  CopyProgress snapshot() const {
+    return {total_elements.load(std::memory_order_relaxed),
+            read_elements.load(std::memory_order_relaxed),
+            copied_elements.load(std::memory_order_relaxed),
+            committed_elements.load(std::memory_order_relaxed)};
+  }
+};
+
+/// Statistics collected for a single `Read` operation.
+///
+/// Collection is enabled by specifying a `ReadStatsFunction` in `ReadOptions`;
+/// otherwise no statistics-related work is performed.
+///
+/// \relates Read[TensorStore, Array]
+struct ReadOperationStats {
+  /// Number of elements copied to the target array.
+  Index copied_elements = 0;
+
+  /// Number of bytes copied to the target array.
+  Index copied_bytes = 0;
+
+  /// Number of chunks from which data was copied.
+  Index chunk_count = 0;
+
+  /// Elapsed time from the start of the operation until completion.
+  absl::Duration total_time;
+
+  /// Elapsed time from the start of the operation until the first chunk was
+  /// available for copying.  This approximates the combined storage read and
+  /// decode latency.
+  absl::Duration first_chunk_time;
+
+  /// Cumulative time spent copying chunk data to the target array.  May exceed
+  /// `total_time` if chunks are copied concurrently.
+  absl::Duration copy_time;
+
+  /// Compares two statistics objects for equality.
+  friend bool operator==(const ReadOperationStats& a,
+                         const ReadOperationStats& b);
+  friend bool operator!=(const ReadOperationStats& a,
+                         const ReadOperationStats& b);
+
+  /// Prints a debugging string representation to an `std::ostream`.
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const ReadOperationStats& a);
+};
+
+/// Statistics collected for a single `Write` operation.
+///
+/// Collection is enabled by specifying a `WriteStatsFunction` in
+/// `WriteOptions`; otherwise no statistics-related work is performed.
+///
+/// \relates Write[Array, TensorStore]
+struct WriteOperationStats {
+  /// Number of elements copied from the source array.
+  Index copied_elements = 0;
+
+  /// Number of bytes copied from the source array.
+  Index copied_bytes = 0;
+
+  /// Number of chunks to which data was copied.
+  Index chunk_count = 0;
+
+  /// Elapsed time from the start of the operation until the write was
+  /// committed (or, for transactional writes, until copying completed).
+  absl::Duration total_time;
+
+  /// Cumulative time spent copying source data to chunks.  May exceed
+  /// `total_time` if chunks are copied concurrently.
+  absl::Duration copy_time;
+
+  /// Elapsed time from the completion of the last chunk copy until commit.
+  /// This approximates the combined encode and storage write latency.
+  absl::Duration commit_time;
+
+  /// Compares two statistics objects for equality.
+  friend bool operator==(const WriteOperationStats& a,
+                         const WriteOperationStats& b);
+  friend bool operator!=(const WriteOperationStats& a,
+                         const WriteOperationStats& b);
+
+  /// Prints a debugging string representation to an `std::ostream`.
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const WriteOperationStats& a);
+};
+
 /// Handle for consuming the result of an asynchronous write operation.
 ///
 /// This holds two futures:
@@ -204,6 +358,74 @@ struct CopyProgressFunction {
   Function value;
 };
 
+/// Specifies shared progress counters for use with `tensorstore::Read`.
+///
+/// When specified, each chunk completion performs a single relaxed atomic add
+/// on the counter block instead of invoking a callback.
+///
+/// \relates AtomicReadProgress
+struct ReadProgressCounters {
+  std::shared_ptr<AtomicReadProgress> value;
+};
+
+/// Specifies shared progress counters for use with `tensorstore::Write`.
+///
+/// \relates AtomicWriteProgress
+struct WriteProgressCounters {
+  std::shared_ptr<AtomicWriteProgress> value;
+};
+
+/// Specifies shared progress counters for use with `tensorstore::Copy`.
+///
+/// \relates AtomicCopyProgress
+struct CopyProgressCounters {
+  std::shared_ptr<AtomicCopyProgress> value;
+};
+
+/// Specifies a statistics function for use with `tensorstore::Read`.
+///
+/// The function is invoked exactly once, when the operation completes.
+///
+/// \relates ReadOperationStats
+struct ReadStatsFunction {
+  /// Type-erased movable function with signature
+  /// `void (ReadOperationStats)`.
+  using Function = poly::Poly<sizeof(void*) * 2, /*Copyable=*/false,
+                              void(ReadOperationStats)>;
+
+  Function value;
+};
+
+/// Specifies a statistics function for use with `tensorstore::Write`.
+///
+/// The function is invoked exactly once, when the operation completes.
+///
+/// \relates WriteOperationStats
+struct WriteStatsFunction {
+  /// Type-erased movable function with signature
+  /// `void (WriteOperationStats)`.
+  using Function = poly::Poly<sizeof(void*) * 2, /*Copyable=*/false,
+                              void(WriteOperationStats)>;
+
+  Function value;
+};
+
+/// Returns a progress function that forwards to `function` at most once per
+/// `min_interval`.
+///
+/// Updates indicating completion (all elements copied, or for writes and
+/// copies, committed) are always forwarded.  The wrapper may be invoked
+/// concurrently; sampling uses a relaxed atomic timestamp and intermediate
+/// updates are dropped rather than deferred.
+///
+/// \relates ReadProgressFunction
+ReadProgressFunction RateLimitProgress(ReadProgressFunction function,
+                                       absl::Duration min_interval);
+WriteProgressFunction RateLimitProgress(WriteProgressFunction function,
+                                        absl::Duration min_interval);
+CopyProgressFunction RateLimitProgress(CopyProgressFunction function,
+                                       absl::Duration min_interval);
+
 }  // namespace tensorstore
 
 #endif  // TENSORSTORE_PROGRESS_H_
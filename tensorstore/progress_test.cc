@@ -14,14 +14,20 @@
 
 #include "tensorstore/progress.h"
 
+#include <atomic>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "absl/time/time.h"
 #include "tensorstore/util/str_cat.h"
 
 namespace {
 
 using ::tensorstore::CopyProgress;
+using ::tensorstore::ReadOperationStats;
 using ::tensorstore::ReadProgress;
+using ::tensorstore::WriteOperationStats;
 using ::tensorstore::WriteProgress;
 
 TEST(ReadProgressTest, Comparison) {
@@ -87,4 +93,94 @@ TEST(CopyProgressTest, Ostream) {
       tensorstore::StrCat(CopyProgress{4, 3, 2, 1}));
 }
 
+TEST(ReadOperationStatsTest, Comparison) {
+  ReadOperationStats a{100, 400, 2, absl::Seconds(2), absl::Seconds(1),
+                       absl::Milliseconds(500)};
+  ReadOperationStats b = a;
+  EXPECT_EQ(a, b);
+  b.chunk_count = 3;
+  EXPECT_NE(a, b);
+}
+
+TEST(ReadOperationStatsTest, Ostream) {
+  EXPECT_EQ(
+      "{ copied_elements=100, copied_bytes=400, chunk_count=2, total_time=2s, "
+      "first_chunk_time=1s, copy_time=500ms }",
+      tensorstore::StrCat(ReadOperationStats{100, 400, 2, absl::Seconds(2),
+                                             absl::Seconds(1),
+                                             absl::Milliseconds(500)}));
+}
+
+TEST(WriteOperationStatsTest, Comparison) {
+  WriteOperationStats a{100, 400, 2, absl::Seconds(2), absl::Milliseconds(500),
+                        absl::Seconds(1)};
+  WriteOperationStats b = a;
+  EXPECT_EQ(a, b);
+  b.commit_time = absl::Seconds(3);
+  EXPECT_NE(a, b);
+}
+
+TEST(WriteOperationStatsTest, Ostream) {
+  EXPECT_EQ(
+      "{ copied_elements=100, copied_bytes=400, chunk_count=2, total_time=2s, "
+      "copy_time=500ms, commit_time=1s }",
+      tensorstore::StrCat(WriteOperationStats{100, 400, 2, absl::Seconds(2),
+                                              absl::Milliseconds(500),
+                                              absl::Seconds(1)}));
+}
+
+TEST(AtomicProgressTest, Snapshot) {
+  tensorstore::AtomicReadProgress read_progress;
+  read_progress.total_elements.fetch_add(10, std::memory_order_relaxed);
+  read_progress.copied_elements.fetch_add(3, std::memory_order_relaxed);
+  EXPECT_EQ((ReadProgress{10, 3}), read_progress.snapshot());
+
+  tensorstore::AtomicWriteProgress write_progress;
+  write_progress.total_elements.fetch_add(10, std::memory_order_relaxed);
+  write_progress.copied_elements.fetch_add(4, std::memory_order_relaxed);
+  write_progress.committed_elements.fetch_add(2, std::memory_order_relaxed);
+  EXPECT_EQ((WriteProgress{10, 4, 2}), write_progress.snapshot());
+
+  tensorstore::AtomicCopyProgress copy_progress;
+  copy_progress.total_elements.fetch_add(10, std::memory_order_relaxed);
+  copy_progress.read_elements.fetch_add(5, std::memory_order_relaxed);
+  EXPECT_EQ((CopyProgress{10, 5, 0, 0}), copy_progress.snapshot());
+}
+
+TEST(RateLimitProgressTest, ZeroIntervalForwardsAllUpdates) {
+  std::vector<ReadProgress> updates;
+  auto function = tensorstore::RateLimitProgress(
+      tensorstore::ReadProgressFunction{
+          [&updates](ReadProgress progress) { updates.push_back(progress); }},
+      absl::ZeroDuration());
+  function.value(ReadProgress{4, 1});
+  function.value(ReadProgress{4, 2});
+  function.value(ReadProgress{4, 4});
+  EXPECT_THAT(updates,
+              ::testing::ElementsAre(ReadProgress{4, 1}, ReadProgress{4, 2},
+                                     ReadProgress{4, 4}));
+}
+
+TEST(RateLimitProgressTest, LongIntervalForwardsFinalUpdate) {
+  std::vector<ReadProgress> updates;
+  auto function = tensorstore::RateLimitProgress(
+      tensorstore::ReadProgressFunction{
+          [&updates](ReadProgress progress) { updates.push_back(progress); }},
+      absl::Hours(1));
+  // The first update is forwarded; subsequent intermediate updates within the
+  // interval are dropped, but the final update is always forwarded.
+  function.value(ReadProgress{4, 1});
+  function.value(ReadProgress{4, 2});
+  function.value(ReadProgress{4, 3});
+  function.value(ReadProgress{4, 4});
+  EXPECT_THAT(updates,
+              ::testing::ElementsAre(ReadProgress{4, 1}, ReadProgress{4, 4}));
+}
+
+TEST(RateLimitProgressTest, NullFunctionRemainsNull) {
+  auto function = tensorstore::RateLimitProgress(
+      tensorstore::WriteProgressFunction{}, absl::Hours(1));
+  EXPECT_FALSE(function.value);
+}
+
 }  // namespace
@@ -15,16 +15,65 @@
 #ifndef TENSORSTORE_READ_WRITE_OPTIONS_H_
 #define TENSORSTORE_READ_WRITE_OPTIONS_H_
 
+#include <stddef.h>
+
 #include <utility>
 
 #include "absl/status/status.h"
+#include "tensorstore/array.h"
 #include "tensorstore/batch.h"
+#include "tensorstore/box.h"
 #include "tensorstore/contiguous_layout.h"
+#include "tensorstore/data_type.h"
 #include "tensorstore/index_space/alignment.h"
+#include "tensorstore/internal/poly/poly.h"
 #include "tensorstore/progress.h"
+#include "tensorstore/util/result.h"
 
 namespace tensorstore {
 
+/// Specifies a function for allocating the destination array of a
+/// `tensorstore::Read` into a new array.
+///
+/// This permits reads to allocate directly into externally-managed buffers,
+/// e.g. Apache Arrow or DLPack allocators, eliminating the final copy when
+/// handing results off to another framework.  (In the other direction, no
+/// special support is needed: ownership of a read result can be exported
+/// without a copy, since the element pointer of a `SharedOffsetArray` is a
+/// `std::shared_ptr`.)
+///
+/// The function is invoked with the resolved domain, the destination data
+/// type, and the requested layout order, and must return an array with
+/// exactly that domain and data type.
+///
+/// \relates Read[TensorStore]
+struct ReadAllocateFunction {
+  /// Type-erased movable function.
+  using Function =
+      poly::Poly<sizeof(void*) * 2, /*Copyable=*/false,
+                 Result<SharedOffsetArray<void>>(
+                     BoxView<> domain, DataType dtype,
+                     ContiguousLayoutOrder layout_order)>;
+
+  Function value;
+};
+
+/// Specifies that a read into a new array may expand its domain outward to
+/// read-chunk boundaries, so that requests straddling chunk boundaries
+/// perform chunk-aligned I/O.
+///
+/// The returned array still has exactly the requested domain: it is a
+/// zero-copy crop of the chunk-aligned allocation, which is at most one
+/// chunk larger per dimension.  The expansion is skipped when the read
+/// domain cannot be safely enlarged (e.g. index array transforms, or
+/// implicit bounds) or when the chunk grid is unknown.
+///
+/// \relates Read[TensorStore]
+struct AlignReadToChunks {
+  /// Indicates whether chunk-aligned expansion is enabled.
+  bool value = false;
+};
+
 /// Options for `tensorstore::Read` into an existing target array.
 ///
 /// \relates Read[TensorStore, Array]
@@ -42,6 +91,16 @@ struct ReadOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(ReadStatsFunction value) {
+    this->stats_function = std::move(value);
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(ReadProgressCounters value) {
+    this->progress_counters = std::move(value);
+    return absl::OkStatus();
+  }
+
   absl::Status Set(Batch value) {
     this->batch = std::move(value);
     return absl::OkStatus();
@@ -53,6 +112,12 @@ struct ReadOptions {
   /// Optional progress callback.
   ReadProgressFunction progress_function;
 
+  /// Optional statistics callback, invoked once when the operation completes.
+  ReadStatsFunction stats_function;
+
+  /// Optional shared progress counters, updated with relaxed atomic adds.
+  ReadProgressCounters progress_counters;
+
   /// Optional batch.
   Batch batch{no_batch};
 };
@@ -63,6 +128,12 @@ constexpr inline bool ReadOptions::IsOption<DomainAlignmentOptions> = true;
 template <>
 constexpr inline bool ReadOptions::IsOption<ReadProgressFunction> = true;
 
+template <>
+constexpr inline bool ReadOptions::IsOption<ReadStatsFunction> = true;
+
+template <>
+constexpr inline bool ReadOptions::IsOption<ReadProgressCounters> = true;
+
 template <>
 constexpr inline bool ReadOptions::IsOption<Batch> = true;
 
@@ -91,6 +162,21 @@ struct ReadIntoNewArrayOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(ReadAllocateFunction value) {
+    this->allocate_function = std::move(value);
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(ReadProgressCounters value) {
+    this->progress_counters = std::move(value);
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(AlignReadToChunks value) {
+    this->align_read_to_chunks = value;
+    return absl::OkStatus();
+  }
+
   /// Specifies the layout order of the newly-allocated array.  Defaults to
   /// `c_order`.
   ContiguousLayoutOrder layout_order = c_order;
@@ -100,6 +186,16 @@ struct ReadIntoNewArrayOptions {
 
   /// Optional batch.
   Batch batch{no_batch};
+
+  /// Optional allocation callback.  If not specified, the array is allocated
+  /// normally.
+  ReadAllocateFunction allocate_function;
+
+  /// Optional shared progress counters, updated with relaxed atomic adds.
+  ReadProgressCounters progress_counters;
+
+  /// Optional chunk-aligned expansion of the read domain.
+  AlignReadToChunks align_read_to_chunks;
 };
 
 template <>
@@ -110,12 +206,46 @@ template <>
 constexpr inline bool ReadIntoNewArrayOptions::IsOption<ReadProgressFunction> =
     true;
 
+template <>
+constexpr inline bool ReadIntoNewArrayOptions::IsOption<ReadAllocateFunction> =
+    true;
+
+template <>
+constexpr inline bool ReadIntoNewArrayOptions::IsOption<ReadProgressCounters> =
+    true;
+
 template <>
 constexpr inline bool ReadIntoNewArrayOptions::IsOption<Batch> = true;
 
 template <>
 constexpr inline bool ReadIntoNewArrayOptions::IsOption<Batch::View> = true;
 
+template <>
+constexpr inline bool ReadIntoNewArrayOptions::IsOption<AlignReadToChunks> =
+    true;
+
+/// Options for `tensorstore::Prefetch`.
+///
+/// \relates Prefetch
+struct PrefetchOptions {
+  template <typename T>
+  constexpr static inline bool IsOption = false;
+
+  absl::Status Set(Batch value) {
+    this->batch = std::move(value);
+    return absl::OkStatus();
+  }
+
+  /// Optional batch.
+  Batch batch{no_batch};
+};
+
+template <>
+constexpr inline bool PrefetchOptions::IsOption<Batch> = true;
+
+template <>
+constexpr inline bool PrefetchOptions::IsOption<Batch::View> = true;
+
 /// Specifies restrictions on how references to the source array/source
 /// TensorStore may be used by write operations.
 ///
@@ -157,6 +287,16 @@ struct WriteOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(WriteStatsFunction value) {
+    this->stats_function = std::move(value);
+    return absl::OkStatus();
+  }
+
+  absl::Status Set(WriteProgressCounters value) {
+    this->progress_counters = std::move(value);
+    return absl::OkStatus();
+  }
+
   absl::Status Set(SourceDataReferenceRestriction value) {
     this->source_data_reference_restriction = value;
     return absl::OkStatus();
@@ -168,6 +308,12 @@ struct WriteOptions {
   /// Optional progress callback.
   WriteProgressFunction progress_function;
 
+  /// Optional statistics callback, invoked once when the operation completes.
+  WriteStatsFunction stats_function;
+
+  /// Optional shared progress counters, updated with relaxed atomic adds.
+  WriteProgressCounters progress_counters;
+
   /// Specifies restrictions on how the source data may be referenced (as
   /// opposed to copied).
   SourceDataReferenceRestriction source_data_reference_restriction =
@@ -180,10 +326,41 @@ constexpr inline bool WriteOptions::IsOption<DomainAlignmentOptions> = true;
 template <>
 constexpr inline bool WriteOptions::IsOption<WriteProgressFunction> = true;
 
+template <>
+constexpr inline bool WriteOptions::IsOption<WriteStatsFunction> = true;
+
+template <>
+constexpr inline bool WriteOptions::IsOption<WriteProgressCounters> = true;
+
 template <>
 constexpr inline bool WriteOptions::IsOption<SourceDataReferenceRestriction> =
     true;
 
+/// Limits the chunk copy operations that may be in flight concurrently during
+/// a `tensorstore::Copy` operation.
+///
+/// Each chunk copy operation corresponds to the intersection of a source read
+/// chunk with a target write chunk.  By default, all operations are issued as
+/// soon as the corresponding chunks become available, which maximizes
+/// pipelining but may buffer a large amount of chunk data in memory when
+/// copying a large volume between stores.  Specifying a budget bounds the
+/// in-flight operations (and therefore the buffered chunk data) while still
+/// overlapping reads and writes up to the budget.
+///
+/// To ensure progress, one chunk copy operation is always permitted to be in
+/// flight, even if it alone exceeds `max_bytes`.
+///
+/// \relates Copy[TensorStore, TensorStore]
+struct CopyChunkBudget {
+  /// Maximum number of chunk copy operations in flight.  `0` (the default)
+  /// indicates no limit.
+  size_t max_chunks = 0;
+
+  /// Maximum aggregate size, in bytes, of the target regions of in-flight
+  /// chunk copy operations.  `0` (the default) indicates no limit.
+  size_t max_bytes = 0;
+};
+
 /// Options for `tensorstore::Copy`.
 ///
 /// \relates Copy[TensorStore, TensorStore]
@@ -201,6 +378,11 @@ struct CopyOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(CopyProgressCounters value) {
+    this->progress_counters = std::move(value);
+    return absl::OkStatus();
+  }
+
   absl::Status Set(SourceDataReferenceRestriction value) {
     this->source_data_reference_restriction = value;
     return absl::OkStatus();
@@ -211,6 +393,11 @@ struct CopyOptions {
     return absl::OkStatus();
   }
 
+  absl::Status Set(CopyChunkBudget value) {
+    this->chunk_budget = value;
+    return absl::OkStatus();
+  }
+
   /// Constrains how the source TensorStore may be aligned to the target
   /// TensorStore.
   DomainAlignmentOptions alignment_options = DomainAlignmentOptions::all;
@@ -218,6 +405,9 @@ struct CopyOptions {
   /// Optional progress callback.
   CopyProgressFunction progress_function;
 
+  /// Optional shared progress counters, updated with relaxed atomic adds.
+  CopyProgressCounters progress_counters;
+
   /// Specifies restrictions on how the source data may be referenced (as
   /// opposed to copied).
   SourceDataReferenceRestriction source_data_reference_restriction =
@@ -225,6 +415,9 @@ struct CopyOptions {
 
   /// Optional batch for reading.
   Batch batch{no_batch};
+
+  /// Optional limit on in-flight chunk copy operations.
+  CopyChunkBudget chunk_budget;
 };
 
 template <>
@@ -233,6 +426,9 @@ constexpr inline bool CopyOptions::IsOption<DomainAlignmentOptions> = true;
 template <>
 constexpr inline bool CopyOptions::IsOption<CopyProgressFunction> = true;
 
+template <>
+constexpr inline bool CopyOptions::IsOption<CopyProgressCounters> = true;
+
 template <>
 constexpr inline bool CopyOptions::IsOption<SourceDataReferenceRestriction> =
     true;
@@ -243,6 +439,9 @@ constexpr inline bool CopyOptions::IsOption<Batch> = true;
 template <>
 constexpr inline bool CopyOptions::IsOption<Batch::View> = true;
 
+template <>
+constexpr inline bool CopyOptions::IsOption<CopyChunkBudget> = true;
+
 }  // namespace tensorstore
 
 #endif  // TENSORSTORE_READ_WRITE_OPTIONS_H_
@@ -0,0 +1,184 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/scan.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/box.h"
+#include "tensorstore/chunk_layout.h"
+#include "tensorstore/index.h"
+#include "tensorstore/index_interval.h"
+#include "tensorstore/index_space/dim_expression.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/rank.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/division.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+
+struct ChunkScanCursor::Impl : public internal::AtomicReferenceCount<Impl> {
+  TensorStore<> store;
+  size_t prefetch_limit;
+
+  // Block shape and grid-aligned origin of the first block, per dimension.
+  std::vector<Index> block_shape;
+  std::vector<Index> start;
+
+  // Dimension iteration order, from outermost to innermost.
+  std::vector<DimensionIndex> order;
+
+  // Origin of the next block for which a read has not yet been issued.  Only
+  // meaningful if `exhausted == false`.
+  std::vector<Index> position;
+  bool exhausted = false;
+
+  // Reads in flight, in block order.  Bounded by `prefetch_limit`.
+  std::deque<Future<SharedOffsetArray<void>>> pending;
+
+  // Issues the read for the block at `position` and advances `position`.
+  void IssueNext() {
+    const DimensionIndex rank = position.size();
+    BoxView<> domain = store.domain().box();
+    Box<> block(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) {
+      const Index origin = std::max(position[i], domain[i].inclusive_min());
+      const Index size =
+          std::min(position[i] + block_shape[i], domain[i].exclusive_max()) -
+          origin;
+      block[i] = IndexInterval::UncheckedSized(origin, size);
+    }
+    auto sliced = store | tensorstore::AllDims().BoxSlice(block);
+    if (!sliced.ok()) {
+      pending.push_back(std::move(sliced).status());
+    } else {
+      auto future = tensorstore::Read(*std::move(sliced));
+      future.Force();
+      pending.push_back(std::move(future));
+    }
+    Advance();
+  }
+
+  // Advances `position` to the next block in storage layout order, setting
+  // `exhausted` at the end of the grid.
+  void Advance() {
+    BoxView<> domain = store.domain().box();
+    for (DimensionIndex j = order.size(); j-- > 0;) {
+      const DimensionIndex dim = order[j];
+      position[dim] += block_shape[dim];
+      if (position[dim] < domain[dim].exclusive_max()) return;
+      position[dim] = start[dim];
+    }
+    exhausted = true;
+  }
+
+  // Tops up the prefetch window.
+  void Fill() {
+    while (!exhausted && pending.size() < prefetch_limit) IssueNext();
+  }
+};
+
+ChunkScanCursor::ChunkScanCursor() = default;
+ChunkScanCursor::ChunkScanCursor(ChunkScanCursor&&) noexcept = default;
+ChunkScanCursor& ChunkScanCursor::operator=(ChunkScanCursor&&) noexcept =
+    default;
+ChunkScanCursor::~ChunkScanCursor() = default;
+
+ChunkScanCursor::ChunkScanCursor(internal::IntrusivePtr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+bool ChunkScanCursor::done() const {
+  assert(impl_);
+  return impl_->exhausted && impl_->pending.empty();
+}
+
+Future<SharedOffsetArray<void>> ChunkScanCursor::Next() {
+  assert(impl_ && !done());
+  auto future = std::move(impl_->pending.front());
+  impl_->pending.pop_front();
+  impl_->Fill();
+  return future;
+}
+
+Result<ChunkScanCursor> ScanChunks(TensorStore<> store,
+                                   ChunkScanOptions options) {
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::ValidateSupportsRead(store.read_write_mode()));
+  BoxView<> domain = store.domain().box();
+  if (!IsFinite(domain)) {
+    return absl::InvalidArgumentError(
+        "Cannot scan TensorStore with unbounded domain");
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto chunk_layout, store.chunk_layout());
+
+  const DimensionIndex rank = store.rank();
+  auto impl = internal::MakeIntrusivePtr<ChunkScanCursor::Impl>();
+  impl->store = std::move(store);
+  impl->prefetch_limit = std::max(size_t{1}, options.prefetch_limit);
+  impl->block_shape.resize(rank);
+  impl->start.resize(rank);
+
+  auto read_chunk_shape = chunk_layout.read_chunk_shape();
+  auto grid_origin = chunk_layout.grid_origin();
+  for (DimensionIndex i = 0; i < rank; ++i) {
+    const Index chunk_size =
+        read_chunk_shape.valid() ? read_chunk_shape[i] : Index(0);
+    if (chunk_size <= 0) {
+      // No chunk shape constraint for this dimension: don't subdivide it.
+      impl->block_shape[i] = std::max(Index(1), domain[i].size());
+      impl->start[i] = domain[i].inclusive_min();
+    } else {
+      const Index origin =
+          (grid_origin.valid() && grid_origin[i] != kImplicit)
+              ? grid_origin[i]
+              : domain[i].inclusive_min();
+      // Origin of the grid cell containing the lower bound of the domain.
+      impl->block_shape[i] = chunk_size;
+      impl->start[i] =
+          origin +
+          FloorOfRatio(domain[i].inclusive_min() - origin, chunk_size) *
+              chunk_size;
+    }
+  }
+
+  auto inner_order = chunk_layout.inner_order();
+  if (inner_order.valid()) {
+    impl->order.assign(inner_order.begin(), inner_order.end());
+  } else {
+    impl->order.resize(rank);
+    for (DimensionIndex i = 0; i < rank; ++i) impl->order[i] = i;
+  }
+
+  impl->position = impl->start;
+  if (domain.num_elements() == 0) {
+    impl->exhausted = true;
+  } else {
+    impl->Fill();
+  }
+  return ChunkScanCursor(std::move(impl));
+}
+
+}  // namespace tensorstore
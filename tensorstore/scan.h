@@ -0,0 +1,110 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_SCAN_H_
+#define TENSORSTORE_SCAN_H_
+
+/// \file
+/// Sequential chunk-order scan of a `TensorStore` with bounded readahead.
+
+#include <stddef.h>
+
+#include "tensorstore/array.h"
+#include "tensorstore/internal/intrusive_ptr.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+
+/// Options for `ScanChunks`.
+///
+/// \relates ScanChunks
+struct ChunkScanOptions {
+  /// Maximum number of block reads kept in flight ahead of the consumer.
+  ///
+  /// The cursor issues reads for up to `prefetch_limit` blocks before the
+  /// corresponding `ChunkScanCursor::Next` calls, which bounds the memory
+  /// used by the scan to approximately `prefetch_limit` blocks regardless of
+  /// the total size of the array.  Values less than 1 are treated as 1.
+  size_t prefetch_limit = 4;
+};
+
+/// Cursor over the chunk-aligned blocks of a `TensorStore`, in storage layout
+/// order.
+///
+/// Obtained from `ScanChunks`.  Each call to `Next` returns a future for the
+/// next materialized block; reads for subsequent blocks are issued eagerly up
+/// to `ChunkScanOptions::prefetch_limit` so that storage reads overlap with
+/// the consumer's processing of earlier blocks.
+///
+/// A cursor is not thread-safe: `Next` and `done` must not be called
+/// concurrently.  The returned futures may be awaited from any thread.
+///
+/// \relates ScanChunks
+class ChunkScanCursor {
+ public:
+  /// Constructs an invalid cursor.
+  ChunkScanCursor();
+
+  ChunkScanCursor(ChunkScanCursor&&) noexcept;
+  ChunkScanCursor& operator=(ChunkScanCursor&&) noexcept;
+  ~ChunkScanCursor();
+
+  /// Returns `true` if this cursor was obtained from `ScanChunks`, as opposed
+  /// to default-constructed or moved from.
+  bool valid() const { return static_cast<bool>(impl_); }
+
+  /// Returns `true` if all blocks have been returned by `Next`.
+  bool done() const;
+
+  /// Returns a future for the next block, and issues reads for subsequent
+  /// blocks up to the prefetch limit.
+  ///
+  /// The domain of the returned array indicates the position of the block
+  /// within the `TensorStore`.  Blocks at the upper bounds of the domain may
+  /// be smaller than the chunk shape.
+  ///
+  /// \dchecks `valid() && !done()`
+  Future<SharedOffsetArray<void>> Next();
+
+ private:
+  friend Result<ChunkScanCursor> ScanChunks(TensorStore<> store,
+                                            ChunkScanOptions options);
+  struct Impl;
+  explicit ChunkScanCursor(internal::IntrusivePtr<Impl> impl);
+  internal::IntrusivePtr<Impl> impl_;
+};
+
+/// Returns a cursor over the chunk-aligned blocks of `store`.
+///
+/// The blocks partition `store.domain()` according to the read chunk grid of
+/// `store.chunk_layout()`, and are returned in the storage layout order given
+/// by the chunk layout's `inner_order` (C order if unspecified).  Dimensions
+/// without a chunk shape constraint are not subdivided.  Reads are issued
+/// through the normal read path and therefore benefit from the chunk cache.
+///
+/// \param store TensorStore to scan, must support reading and have a bounded
+///     domain.
+/// \param options Specifies the prefetch window.
+/// \returns The cursor, positioned at the first block.
+/// \error `absl::StatusCode::kInvalidArgument` if `store` does not support
+///     reading or its domain is unbounded.
+/// \ingroup array operations
+Result<ChunkScanCursor> ScanChunks(TensorStore<> store,
+                                   ChunkScanOptions options = {});
+
+}  // namespace tensorstore
+
+#endif  // TENSORSTORE_SCAN_H_
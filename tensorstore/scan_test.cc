@@ -0,0 +1,110 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/scan.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "absl/status/status.h"
+#include "tensorstore/array.h"
+#include "tensorstore/context.h"
+#include "tensorstore/driver/array/array.h"
+#include "tensorstore/index.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/static_cast.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::ChunkScanOptions;
+using ::tensorstore::Index;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::ScanChunks;
+
+TEST(ScanChunksTest, ArrayDriverSingleBlock) {
+  auto array = tensorstore::MakeArray<int32_t>({{1, 2, 3}, {4, 5, 6}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, tensorstore::FromArray(array));
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto cursor, ScanChunks(store));
+  ASSERT_TRUE(cursor.valid());
+  ASSERT_FALSE(cursor.done());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto block, cursor.Next().result());
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto typed, tensorstore::StaticDataTypeCast<int32_t>(block));
+  EXPECT_EQ(typed, array);
+  EXPECT_TRUE(cursor.done());
+}
+
+TEST(ScanChunksTest, ZarrBlocksInStorageOrder) {
+  ::nlohmann::json spec{
+      {"driver", "zarr"},
+      {"kvstore", {{"driver", "memory"}}},
+      {"metadata", {{"dtype", "<i4"}, {"shape", {6, 6}}, {"chunks", {4, 4}}}},
+  };
+  auto context = tensorstore::Context::Default();
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto store,
+      tensorstore::Open(spec, context, tensorstore::OpenMode::create,
+                        tensorstore::ReadWriteMode::read_write)
+          .result());
+  auto source = tensorstore::AllocateArray<int32_t>({6, 6});
+  for (Index i = 0; i < 6; ++i) {
+    for (Index j = 0; j < 6; ++j) {
+      source(i, j) = static_cast<int32_t>(i * 100 + j);
+    }
+  }
+  TENSORSTORE_ASSERT_OK(tensorstore::Write(source, store).result());
+
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto cursor, ScanChunks(store, ChunkScanOptions{/*prefetch_limit=*/2}));
+  std::vector<std::vector<Index>> origins;
+  while (!cursor.done()) {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto block, cursor.Next().result());
+    origins.push_back({block.origin()[0], block.origin()[1]});
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+        auto typed, tensorstore::StaticDataTypeCast<int32_t>(block));
+    for (Index i = typed.origin()[0]; i < typed.origin()[0] + typed.shape()[0];
+         ++i) {
+      for (Index j = typed.origin()[1];
+           j < typed.origin()[1] + typed.shape()[1]; ++j) {
+        EXPECT_EQ(i * 100 + j, typed(i, j));
+      }
+    }
+  }
+  // Blocks partition the 6x6 domain on the 4x4 read chunk grid, in C order.
+  EXPECT_THAT(origins, ::testing::ElementsAre(
+                           ::testing::ElementsAre(0, 0),
+                           ::testing::ElementsAre(0, 4),
+                           ::testing::ElementsAre(4, 0),
+                           ::testing::ElementsAre(4, 4)));
+}
+
+TEST(ScanChunksTest, WriteOnlyError) {
+  auto array = tensorstore::MakeArray<int32_t>({{1, 2}, {3, 4}});
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto store, tensorstore::FromArray(array));
+  TENSORSTORE_ASSERT_OK_AND_ASSIGN(
+      auto write_only,
+      tensorstore::ModeCast(store, tensorstore::ReadWriteMode::write));
+  EXPECT_THAT(ScanChunks(write_only),
+              MatchesStatus(absl::StatusCode::kInvalidArgument));
+}
+
+}  // namespace
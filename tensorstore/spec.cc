@@ -14,7 +14,18 @@
 
 #include "tensorstore/spec.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
+#include "absl/synchronization/mutex.h"
 #include "tensorstore/context.h"
 #include "tensorstore/driver/driver.h"
 #include "tensorstore/index_space/json.h"
@@ -144,6 +155,56 @@ void Spec::StripContext() {
 }
 
 namespace internal {
+
+namespace {
+/// Process-level cache of parsed specs, used by `ParseSpecCached` to avoid
+/// repeatedly parsing and validating identical JSON specs.  The cached `Spec`
+/// objects hold only unbound, logically-immutable state, so returning copies
+/// that share the underlying `DriverSpec` is safe.
+struct SpecParseCache {
+  /// Bounds the memory retained by the cache.  The cache exists to serve
+  /// workloads that open many identical (or few distinct) specs; if the
+  /// number of distinct specs exceeds this bound, the cache is simply
+  /// discarded and rebuilt rather than tracking usage for eviction.
+  constexpr static size_t kMaxEntries = 1000;
+
+  absl::Mutex mutex;
+  absl::flat_hash_map<std::string, Spec> map ABSL_GUARDED_BY(mutex);
+};
+
+SpecParseCache& GetSpecParseCache() {
+  static absl::NoDestructor<SpecParseCache> cache_;
+  return *cache_;
+}
+}  // namespace
+
+Result<Spec> ParseSpecCached(::nlohmann::json json_spec) {
+  if (!json_spec.is_object()) {
+    // Invalid specs are not worth caching.
+    return Spec::FromJson(std::move(json_spec));
+  }
+  // Use the CBOR encoding as the cache key: `::nlohmann::json` objects are
+  // stored with sorted keys, so the encoding is canonical, and unlike `dump()`
+  // it is exact even for strings that are not valid UTF-8 (which may occur in
+  // kvstore paths).
+  auto encoded = ::nlohmann::json::to_cbor(json_spec);
+  std::string cache_key(reinterpret_cast<const char*>(encoded.data()),
+                        encoded.size());
+  auto& cache = GetSpecParseCache();
+  {
+    absl::MutexLock lock(&cache.mutex);
+    auto it = cache.map.find(cache_key);
+    if (it != cache.map.end()) return it->second;
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(auto spec, Spec::FromJson(std::move(json_spec)));
+  {
+    absl::MutexLock lock(&cache.mutex);
+    if (cache.map.size() >= SpecParseCache::kMaxEntries) cache.map.clear();
+    cache.map.emplace(std::move(cache_key), spec);
+  }
+  return spec;
+}
+
 Result<Spec> GetSpec(const DriverHandle& handle, SpecRequestOptions&& options) {
   Spec spec;
   TENSORSTORE_ASSIGN_OR_RETURN(
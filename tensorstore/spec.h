@@ -230,6 +230,15 @@ namespace internal {
 /// Refer to that method documentation for details.
 Result<Spec> GetSpec(const DriverHandle& handle, SpecRequestOptions&& options);
 
+/// Parses `json_spec` in the same way as `Spec::FromJson` (with default
+/// options), memoizing the result in a bounded process-level cache.
+///
+/// This is used by `tensorstore::Open` to avoid repeatedly parsing and
+/// validating identical JSON specs.  Sharing the parsed representation is safe
+/// because `DriverSpec` objects are logically immutable; all modification
+/// paths (`ApplyOptions`, context binding/unbinding) copy on write.
+Result<Spec> ParseSpecCached(::nlohmann::json json_spec);
+
 struct SpecNonNullSerializer {
   [[nodiscard]] static bool Encode(serialization::EncodeSink& sink,
                                    const Spec& value);
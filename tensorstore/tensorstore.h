@@ -714,6 +714,9 @@ Read(SourceTensorstore&& source, TargetArray&& target, Option&&... option) {
 ///
 /// - `ReadProgressFunction`
 ///
+/// - `ReadAllocateFunction`, specifying a custom allocator for the returned
+///   array, e.g. to read directly into an externally-managed buffer.
+///
 /// Example::
 ///
 ///     TensorReader<int32_t, 3> store = ...;
@@ -772,6 +775,65 @@ Read(SourceTensorstore&& source, Option&&... option) {
                                        std::move(options));
 }
 
+/// Fetches the data that would be read from `source`, without materializing
+/// it as an array.
+///
+/// For drivers backed by a chunk cache, this populates the cache, so that a
+/// subsequent `Read` of the same region completes without additional I/O
+/// (subject to the configured staleness bounds and cache pool limits).  This
+/// may be used to hide storage latency, e.g. by prefetching the next region
+/// of a volume that is processed in index order while the current region is
+/// being consumed.
+///
+/// Options compatible with `PrefetchOptions` are specified in any order after
+/// `source`.  The meaning of each option is determined by its type.
+///
+/// Supported option types are:
+///
+/// - `Batch`
+///
+/// Example::
+///
+///     TensorReader<int32_t, 3> store = ...;
+///     auto future = Prefetch(
+///         store | AllDims().SizedInterval({100, 200}, {25, 30}));
+///
+/// \param source Source `TensorStore` object that supports reading.  May be
+///     `Result`-wrapped.
+/// \param options Any option compatible with `PrefetchOptions`.
+/// \returns A future that becomes ready when all of the data has been fetched
+///     or an error occurs.
+/// \relates TensorStore
+/// \membergroup I/O
+template <typename SourceTensorstore>
+std::enable_if_t<
+    internal::IsTensorStoreThatSupportsMode<UnwrapResultType<SourceTensorstore>,
+                                            ReadWriteMode::read>,
+    Future<void>>
+Prefetch(SourceTensorstore&& source, PrefetchOptions options) {
+  return MapResult(
+      [&](UnwrapQualifiedResultType<SourceTensorstore&&> unwrapped_source) {
+        return internal::DriverPrefetch(
+            internal::TensorStoreAccess::handle(
+                std::forward<decltype(unwrapped_source)>(unwrapped_source)),
+            std::move(options));
+      },
+      std::forward<SourceTensorstore>(source));
+}
+template <typename SourceTensorstore, typename... Option>
+std::enable_if_t<
+    (IsCompatibleOptionSequence<PrefetchOptions, Option...> &&
+     internal::IsTensorStoreThatSupportsMode<
+         UnwrapResultType<SourceTensorstore>, ReadWriteMode::read>),
+    Future<void>>
+Prefetch(SourceTensorstore&& source, Option&&... option) {
+  PrefetchOptions options;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::SetAll(options, std::forward<Option>(option)...));
+  return tensorstore::Prefetch(std::forward<SourceTensorstore>(source),
+                               std::move(options));
+}
+
 /// Evaluates whether the constraints required for `tensorstore::Write` are
 /// satisfied.
 ///
@@ -887,6 +949,8 @@ constexpr inline bool CanCopyTensorStoreToTensorStore =
 ///
 /// - `Batch`
 ///
+/// - `CopyChunkBudget`
+///
 /// Example::
 ///
 ///     TensorReader<int32_t, 3> source = ...;
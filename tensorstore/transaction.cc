@@ -114,6 +114,7 @@ TransactionState::OpenPtr TransactionState::AcquireImplicitOpenPtr() {
 TransactionState::TransactionState(TransactionMode mode,
                                    bool implicit_transaction)
     : mode_(mode),
+      max_concurrent_prepare_count_(1),
       commit_reference_count_{kFutureReferenceIncrement +
                               kCommitReferenceIncrement},
       open_reference_count_{implicit_transaction ? 1u : 0u},
@@ -271,29 +272,65 @@ void TransactionState::ExecuteCommitPhase() {
   // with the earliest not-yet-committed phase.  (Nodes from already-committed
   // phases are destroyed once commit completes.)
   auto* node = nodes_.ExtremeNode(Tree::kLeft);
-  ContinuePrepareForCommit(node, node->phase());
+  UniqueWriterLock lock(mutex_);
+  phase_prepare_state_ = PhasePrepareState{};
+  phase_prepare_state_.next_node = node;
+  phase_prepare_state_.phase = node->phase();
+  DispatchPrepareForCommit(std::move(lock));
 }
 
-void TransactionState::ContinuePrepareForCommit(Node* node,
-                                                size_t current_phase) {
+void TransactionState::DispatchPrepareForCommit(
+    UniqueWriterLock<absl::Mutex> lock) {
+  auto& state = phase_prepare_state_;
+  if (state.dispatch_running || state.done) return;
+  state.dispatch_running = true;
   while (true) {
-    if (!node || node->phase() != current_phase) {
-      // End of phase.
+    Node* node = state.next_node;
+    if (!node || node->phase() != state.phase) {
+      // `PrepareForCommit` has been invoked on all nodes in the phase.
+      state.next_node = nullptr;
+      if (state.pending_count != 0) break;
+      // All nodes in the phase have also called `PrepareDone`.  The commit
+      // process will continue once all nodes in the phase have called
+      // `ReadyForCommit`.
+      state.done = true;
+      state.dispatch_running = false;
+      lock.unlock();
       DecrementNodesPendingReadyForCommit();
+      return;
+    }
+    if (max_concurrent_prepare_count_ != 0 &&
+        state.pending_count >= max_concurrent_prepare_count_) {
+      break;
+    }
+    if (node->associated_data() == state.last_associated_data &&
+        state.pending_same_data_count != 0) {
+      // A prior node with the same `associated_data()` pointer has not yet
+      // called `PrepareDone`.  Nodes with the same `associated_data()` pointer
+      // must be prepared sequentially.
       break;
     }
-    waiting_for_prepare_done_.store(true, std::memory_order_relaxed);
+    state.next_node = Tree::Traverse(*node, Tree::kRight);
+    ++state.pending_count;
+    if (node->associated_data() == state.last_associated_data) {
+      ++state.pending_same_data_count;
+    } else {
+      state.last_associated_data = node->associated_data();
+      state.pending_same_data_count = 1;
+    }
     nodes_pending_commit_.fetch_add(1, std::memory_order_relaxed);
     assert(node->node_commit_state_.fetch_or(Node::kPrepareForCommit) ==
            Node::kRegister);
+    lock.unlock();
     node->PrepareForCommit();
-    if (waiting_for_prepare_done_.exchange(false, std::memory_order_acq_rel)) {
-      // `node->PrepareDone` has not yet been called.  `PrepareDone` will
-      // continue the commit process when called.
-      return;
-    }
-    node = Tree::Traverse(*node, Tree::kRight);
+    // If `node->PrepareDone` was invoked (synchronously or from another
+    // thread) while the lock was released, it updated `phase_prepare_state_`
+    // without recursing into `DispatchPrepareForCommit`, since
+    // `dispatch_running` is still `true`; the updated state is observed when
+    // the loop re-checks below.
+    lock = UniqueWriterLock<absl::Mutex>(mutex_);
   }
+  state.dispatch_running = false;
 }
 
 void TransactionState::DecrementNodesPendingReadyForCommit() {
@@ -389,6 +426,12 @@ size_t TransactionState::phase() {
   return phase_;
 }
 
+void TransactionState::SetMaxConcurrentPrepareCount(size_t count) {
+  absl::MutexLock lock(&mutex_);
+  assert(commit_state_ != kCommitStarted);
+  max_concurrent_prepare_count_ = count;
+}
+
 absl::Status TransactionState::Node::MarkAsTerminal() {
   auto* transaction = transaction_.get();
   if (!transaction->atomic()) {
@@ -511,13 +554,15 @@ void TransactionState::Node::PrepareDone() {
   assert((node_commit_state_.fetch_or(kPrepareDone) & ~kReadyForCommit) ==
          (Node::kRegister | kPrepareForCommit));
   auto& transaction = *this->transaction();
-  if (transaction.waiting_for_prepare_done_.exchange(
-          false, std::memory_order_acq_rel)) {
-    // Caller of `PrepareForCommit` will continue the commit.
-    return;
-  }
-  transaction.ContinuePrepareForCommit(Tree::Traverse(*this, Tree::kRight),
-                                       this->phase());
+  UniqueWriterLock lock(transaction.mutex_);
+  auto& state = transaction.phase_prepare_state_;
+  assert(state.pending_count != 0);
+  --state.pending_count;
+  if (associated_data_ == state.last_associated_data) {
+    assert(state.pending_same_data_count != 0);
+    --state.pending_same_data_count;
+  }
+  transaction.DispatchPrepareForCommit(std::move(lock));
 }
 
 void TransactionState::Node::ReadyForCommit() {
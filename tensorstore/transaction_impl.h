@@ -388,19 +388,22 @@ class TransactionState {
 
    private:
     /// When a particular phase of the transaction is committed, this is called
-    /// sequentially on each node in the phase in order of the
-    /// `associated_data()` pointer.
+    /// on each node in the phase in order of the `associated_data()` pointer.
     ///
     /// The derived class implementation must call `PrepareDone` once any
     /// necessary locks have been acquired, and must call `ReadyForCommit` once
     /// the node is ready to be committed.
     ///
-    /// Until `PrepareDone` is called, `PrepareForCommit` won't be called on the
-    /// next node in the phase.
+    /// By default, until `PrepareDone` is called, `PrepareForCommit` won't be
+    /// called on the next node in the phase.  The sequential invocation of
+    /// `PrepareForCommit` in order of `associated_data()` pointer allows locks
+    /// to be acquired in a consistent order to avoid deadlock.
     ///
-    /// The sequential invocation of `PrepareForCommit` in order of
-    /// `associated_data()` pointer allows locks to be acquired in a consistent
-    /// order to avoid deadlock.
+    /// If a higher limit has been set via `SetMaxConcurrentPrepareCount`, up to
+    /// that many nodes may have `PrepareForCommit` outstanding concurrently,
+    /// except that `PrepareForCommit` is never invoked on a node while a prior
+    /// node with the same `associated_data()` pointer has not yet called
+    /// `PrepareDone`.
     virtual void PrepareForCommit() = 0;
 
     /// After `PrepareForCommit` has been called on all nodes in a phase, and
@@ -620,6 +623,25 @@ class TransactionState {
   /// If `atomic()`, this always returns 0.
   size_t phase();
 
+  /// Sets the maximum number of nodes within a phase on which
+  /// `Node::PrepareForCommit` may have been invoked without `Node::PrepareDone`
+  /// having yet been called.  A count of 0 indicates no limit.
+  ///
+  /// With the default count of 1, `PrepareForCommit` is invoked strictly
+  /// sequentially on the nodes of each phase, which guarantees that locks are
+  /// acquired in a consistent order across concurrently committing
+  /// transactions.  A higher count allows nodes with distinct
+  /// `associated_data()` pointers to prepare concurrently, which reduces commit
+  /// latency when individual nodes prepare slowly (e.g. while waiting for an
+  /// in-flight read or for another transaction's writeback), but forfeits the
+  /// deadlock-avoidance guarantee if concurrently committing transactions can
+  /// contend for locks on two or more of the same objects.  Nodes with the same
+  /// `associated_data()` pointer are always prepared sequentially, regardless
+  /// of the count.
+  ///
+  /// Must not be called after commit starts.
+  void SetMaxConcurrentPrepareCount(size_t count);
+
   /// Returns `true` if the transaction has been aborted.
   bool aborted() {
     absl::MutexLock lock(&mutex_);
@@ -688,22 +710,27 @@ class TransactionState {
   /// This is called initially by `ExecuteCommit` and is then called again after
   /// each phase commits successfully if there are still remaining phases.
   ///
-  /// This invokes `PrepareForCommit` on each node in the phase, sequentially.
+  /// This invokes `PrepareForCommit` on each node in the phase, in order, with
+  /// up to `max_concurrent_prepare_count_` invocations outstanding at a time.
   void ExecuteCommitPhase();
 
-  /// Asynchronously continues the sequential invocation of `PrepareForCommit`
-  /// on each node in the phase started by `ExecuteCommitPhase`.
+  /// Continues the in-order invocation of `PrepareForCommit` on the nodes in
+  /// the phase started by `ExecuteCommitPhase`, subject to the constraints
+  /// described by `SetMaxConcurrentPrepareCount`.
   ///
-  /// If `node` is `nullptr` or `node->phase() != current_phase`, then all nodes
-  /// in the phase have already been handled, and the commit process will
-  /// continue only once all nodes in the phase have called `ReadyForCommit`.
+  /// Called by `ExecuteCommitPhase` and `Node::PrepareDone` with `lock` holding
+  /// `mutex_`; the lock is released while invoking `PrepareForCommit`.  If
+  /// another thread is already executing `DispatchPrepareForCommit`, this
+  /// returns immediately; the already-executing call is guaranteed to observe
+  /// the updated `phase_prepare_state_`.
   ///
-  /// \param node The next node for which `PrepareForCommit` has not yet been
-  ///     called.
-  /// \param current_phase The current phase being committed.
-  void ContinuePrepareForCommit(Node* node, size_t current_phase);
+  /// Once `PrepareForCommit` has been invoked on all nodes in the phase and all
+  /// of those nodes have called `PrepareDone`, this calls
+  /// `DecrementNodesPendingReadyForCommit` to account for the initial
+  /// `nodes_pending_commit_` count of 1 set by `ExecuteCommitPhase`.
+  void DispatchPrepareForCommit(UniqueWriterLock<absl::Mutex> lock);
 
-  /// Called when `ContinuePrepareForCommit` reaches the end of the phase, and
+  /// Called when `DispatchPrepareForCommit` reaches the end of the phase, and
   /// also by `Node::ReadyForCommit`.  Decrements the `nodes_pending_commit_`
   /// counter.
   ///
@@ -754,6 +781,39 @@ class TransactionState {
   /// this aborts the transaction.
   void NoMoreCommitReferences();
 
+  /// See the `phase_prepare_state_` member below.
+  struct PhasePrepareState {
+    /// Next node on which `PrepareForCommit` has not yet been invoked, or
+    /// `nullptr` if `PrepareForCommit` has been invoked on all nodes in the
+    /// phase.
+    Node* next_node;
+
+    /// The phase being committed.
+    size_t phase;
+
+    /// Number of nodes on which `PrepareForCommit` has been invoked but which
+    /// have not yet called `PrepareDone`.
+    size_t pending_count;
+
+    /// `associated_data()` pointer of the most recent node on which
+    /// `PrepareForCommit` was invoked.
+    void* last_associated_data;
+
+    /// Number of nodes counted by `pending_count` whose `associated_data()`
+    /// pointer equals `last_associated_data`.
+    size_t pending_same_data_count;
+
+    /// Indicates that a thread is currently executing
+    /// `DispatchPrepareForCommit`.  This prevents unbounded recursion in the
+    /// case that `Node::PrepareForCommit` synchronously invokes
+    /// `Node::PrepareDone`.
+    bool dispatch_running;
+
+    /// Indicates that `PrepareForCommit` has been invoked on all nodes in the
+    /// phase and all of those nodes have called `PrepareDone`.
+    bool done;
+  };
+
   static absl::weak_ordering NodeTreeCompare(size_t phase_a, void* data_a,
                                              size_t phase_b, void* data_b) {
     if (phase_a < phase_b) return absl::weak_ordering::less;
@@ -766,6 +826,11 @@ class TransactionState {
   absl::Mutex mutex_;
   TransactionMode mode_;
 
+  /// Maximum number of nodes within a phase on which `Node::PrepareForCommit`
+  /// may be outstanding concurrently.  0 indicates no limit.  Modified only
+  /// before commit starts (with `mutex_` held).
+  size_t max_concurrent_prepare_count_;
+
   /// Red-black tree of nodes in the transaction.
   ///
   /// Nodes are ordered by `phase` and then `associated_data_`.  This provides a
@@ -792,20 +857,10 @@ class TransactionState {
     /// `(mode() & atomic_isolated) == atomic_isolated`.
     Node* existing_terminal_node_;
 
-    /// Used when calling `Node::PrepareForCommit` to prevent unbounded
-    /// recursion in the case that `Node::PrepareForCommit` synchronously
-    /// invokes `Node::PrepareDone`.  Only valid when
-    /// `commit_started() == true`.
-    ///
-    /// Set to `true` before invoking `Node::PrepareForCommit`, and set to
-    /// `false` by the caller of `Node::PrepareForCommit` if
-    /// `Node::PrepareForCommit` returns without `Node::PrepareDone` having been
-    /// called; in this case, `PrepareDone` is itself responsible for continuing
-    /// the commit process.  Otherwise, `PrepareDone` sets this to `false` and
-    /// does nothing, and the caller of `PrepareForCommit` observes that this
-    /// has already been set to `false`, which indicates that it is responsible
-    /// for continuing the commit process.
-    std::atomic<bool> waiting_for_prepare_done_;
+    /// State used by `DispatchPrepareForCommit` to invoke
+    /// `Node::PrepareForCommit` on the nodes of the phase being committed.
+    /// Only valid when `commit_started() == true`.  Protected by `mutex_`.
+    PhasePrepareState phase_prepare_state_;
 
     /// Number of nodes still being aborted.  Once this reaches 0, `promise_` is
     /// reset.  Only valid when `commit_state_ == kAborted`.
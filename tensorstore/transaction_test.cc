@@ -275,6 +275,87 @@ TEST(TransactionTest, TwoTerminalNodesIsolatedCommit) {
   TENSORSTORE_EXPECT_OK(future);
 }
 
+TEST(TransactionTest, ConcurrentPrepare) {
+  NodeLog log;
+  auto txn = Transaction(tensorstore::isolated);
+  auto future = txn.future();
+  WeakTransactionNodePtr<TestNode> node1(new TestNode(&log, 1));
+  WeakTransactionNodePtr<TestNode> node2(new TestNode(&log, 2));
+  WeakTransactionNodePtr<TestNode> node3(new TestNode(&log, 3));
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto open_ptr,
+                                     AcquireOpenTransactionPtrOrError(txn));
+    node1->SetTransaction(*open_ptr);
+    node2->SetTransaction(*open_ptr);
+    node3->SetTransaction(*open_ptr);
+    TENSORSTORE_EXPECT_OK(node1->Register());
+    TENSORSTORE_EXPECT_OK(node2->Register());
+    TENSORSTORE_EXPECT_OK(node3->Register());
+  }
+  TransactionState::get(txn)->SetMaxConcurrentPrepareCount(2);
+  txn.CommitAsync().IgnoreFuture();
+  // Up to 2 nodes may be preparing concurrently.
+  EXPECT_THAT(log, ::testing::ElementsAre("prepare:1", "prepare:2"));
+  node1->PrepareDone();
+  EXPECT_THAT(log,
+              ::testing::ElementsAre("prepare:1", "prepare:2", "prepare:3"));
+  node3->PrepareDone();
+  node2->PrepareDone();
+  EXPECT_THAT(log,
+              ::testing::ElementsAre("prepare:1", "prepare:2", "prepare:3"));
+  node2->ReadyForCommit();
+  node1->ReadyForCommit();
+  node3->ReadyForCommit();
+  EXPECT_THAT(log,
+              ::testing::ElementsAre("prepare:1", "prepare:2", "prepare:3",
+                                     "commit:1", "commit:2", "commit:3"));
+  node1->CommitDone();
+  node2->CommitDone();
+  node3->CommitDone();
+  ASSERT_TRUE(future.ready());
+  TENSORSTORE_EXPECT_OK(future);
+}
+
+TEST(TransactionTest, ConcurrentPrepareSameAssociatedData) {
+  NodeLog log;
+  auto txn = Transaction(tensorstore::isolated);
+  auto future = txn.future();
+  WeakTransactionNodePtr<TestNode> node1a(new TestNode(&log, 1));
+  WeakTransactionNodePtr<TestNode> node1b(new TestNode(&log, 1));
+  WeakTransactionNodePtr<TestNode> node2(new TestNode(&log, 2));
+  {
+    TENSORSTORE_ASSERT_OK_AND_ASSIGN(auto open_ptr,
+                                     AcquireOpenTransactionPtrOrError(txn));
+    node1a->SetTransaction(*open_ptr);
+    node1b->SetTransaction(*open_ptr);
+    node2->SetTransaction(*open_ptr);
+    TENSORSTORE_EXPECT_OK(node1a->Register());
+    TENSORSTORE_EXPECT_OK(node1b->Register());
+    TENSORSTORE_EXPECT_OK(node2->Register());
+  }
+  TransactionState::get(txn)->SetMaxConcurrentPrepareCount(0);
+  txn.CommitAsync().IgnoreFuture();
+  // Even with no limit, nodes with the same associated data are prepared
+  // sequentially, and later nodes are not prepared out of order.
+  EXPECT_THAT(log, ::testing::ElementsAre("prepare:1"));
+  node1a->PrepareDone();
+  EXPECT_THAT(log,
+              ::testing::ElementsAre("prepare:1", "prepare:1", "prepare:2"));
+  node1b->PrepareDone();
+  node2->PrepareDone();
+  node1a->ReadyForCommit();
+  node1b->ReadyForCommit();
+  node2->ReadyForCommit();
+  EXPECT_THAT(log,
+              ::testing::ElementsAre("prepare:1", "prepare:1", "prepare:2",
+                                     "commit:1", "commit:1", "commit:2"));
+  node1a->CommitDone();
+  node1b->CommitDone();
+  node2->CommitDone();
+  ASSERT_TRUE(future.ready());
+  TENSORSTORE_EXPECT_OK(future);
+}
+
 TEST(TransactionTest, TwoTerminalNodesAtomicError) {
   NodeLog log;
   auto txn = Transaction(tensorstore::atomic_isolated);
@@ -17,16 +17,24 @@
 
 #include "absl/status/status.h"
 #include "tensorstore/context.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/spec.h"
 #include "tensorstore/tscli/args.h"
 
 namespace tensorstore {
 namespace cli {
 
+// Copies all keys from `source` to `target`.
+absl::Status KvstoreCopy(KvStore source, KvStore target);
+absl::Status KvstoreCopy(Context context, kvstore::Spec source_spec,
+                         kvstore::Spec target_spec);
+
 // Kvstore commands
 absl::Status RunKvstoreCopy(Context::Spec context_spec, CommandFlags flags);
 absl::Status RunKvstoreList(Context::Spec context_spec, CommandFlags flags);
 
 // Tensorstore commands
+absl::Status RunTsCopy(Context::Spec context_spec, CommandFlags flags);
 absl::Status RunTsSearch(Context::Spec context_spec, CommandFlags flags);
 absl::Status RunTsPrintSpec(Context::Spec context_spec, CommandFlags flags);
 absl::Status RunTsPrintStorageStatistics(Context::Spec context_spec,
@@ -40,16 +40,9 @@
 namespace tensorstore {
 namespace cli {
 
-absl::Status KvstoreCopy(Context context,
-                         tensorstore::kvstore::Spec source_spec,
-                         tensorstore::kvstore::Spec target_spec) {
+absl::Status KvstoreCopy(KvStore source, KvStore target) {
   static absl::Mutex log_mutex;
 
-  TENSORSTORE_ASSIGN_OR_RETURN(auto source,
-                               kvstore::Open(source_spec, context).result());
-  TENSORSTORE_ASSIGN_OR_RETURN(auto target,
-                               kvstore::Open(target_spec, context).result());
-
   TENSORSTORE_ASSIGN_OR_RETURN(auto list_entries,
                                kvstore::ListFuture(source).result());
 
@@ -103,6 +96,16 @@ absl::Status KvstoreCopy(Context context,
   return status;
 }
 
+absl::Status KvstoreCopy(Context context,
+                         tensorstore::kvstore::Spec source_spec,
+                         tensorstore::kvstore::Spec target_spec) {
+  TENSORSTORE_ASSIGN_OR_RETURN(auto source,
+                               kvstore::Open(source_spec, context).result());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto target,
+                               kvstore::Open(target_spec, context).result());
+  return KvstoreCopy(std::move(source), std::move(target));
+}
+
 absl::Status RunKvstoreCopy(Context::Spec context_spec, CommandFlags flags) {
   tensorstore::JsonAbslFlag<std::optional<tensorstore::kvstore::Spec>> source;
   tensorstore::JsonAbslFlag<std::optional<tensorstore::kvstore::Spec>> target;
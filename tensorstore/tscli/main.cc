@@ -56,6 +56,14 @@ const char kUsage[] =
     "      Copies keys from one kvstore to another.\n"
     "  copy --source <source-kvstore-spec> --target <target-kvstore-spec>\n"
     "\n"
+    "  copy_ts [--raw][--reencode]\n"
+    "      Copies the contents of one tensorstore to another, creating the\n"
+    "      target if necessary.  When the codec chains and chunk grids\n"
+    "      match, encoded chunks are copied verbatim; --reencode forces\n"
+    "      decoding and re-encoding.  With --raw, copies the underlying\n"
+    "      kvstore keys verbatim without opening the tensorstores.\n"
+    "  copy_ts --source <source-ts-spec> --target <target-ts-spec>\n"
+    "\n"
     "  list [-h/--human][-b/--brief]\n"
     "      List keys in a kvstore.\n"
     "  list --source <source-kvstore-spec> [glob...]\n"
@@ -133,6 +141,9 @@ int main(int argc, char** argv) {
   if (command == "copy") {
     status = ::tensorstore::cli::RunKvstoreCopy(
         absl::GetFlag(FLAGS_context_spec).value, std::move(flags));
+  } else if (command == "copy_ts") {
+    status = ::tensorstore::cli::RunTsCopy(
+        absl::GetFlag(FLAGS_context_spec).value, std::move(flags));
   } else if (command == "ls" || command == "list") {
     status = ::tensorstore::cli::RunKvstoreList(
         absl::GetFlag(FLAGS_context_spec).value, std::move(flags));
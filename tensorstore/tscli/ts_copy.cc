@@ -0,0 +1,206 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include <nlohmann/json.hpp>
+#include "tensorstore/context.h"
+#include "tensorstore/index.h"
+#include "tensorstore/kvstore/kvstore.h"
+#include "tensorstore/kvstore/spec.h"
+#include "tensorstore/open.h"
+#include "tensorstore/open_mode.h"
+#include "tensorstore/progress.h"
+#include "tensorstore/spec.h"
+#include "tensorstore/tensorstore.h"
+#include "tensorstore/tscli/args.h"
+#include "tensorstore/tscli/cli.h"
+#include "tensorstore/util/json_absl_flag.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status.h"
+
+namespace tensorstore {
+namespace cli {
+namespace {
+
+// Progress state shared by the copy progress callback.
+struct ProgressState {
+  absl::Mutex mutex;
+  absl::Time start_time = absl::Now();
+  Index element_size = 1;
+  Index last_committed = -1;
+};
+
+void LogCopyProgress(ProgressState& state, const CopyProgress& progress) {
+  absl::MutexLock lock(&state.mutex);
+  if (progress.committed_elements == state.last_committed) return;
+  state.last_committed = progress.committed_elements;
+
+  const double seconds =
+      absl::ToDoubleSeconds(absl::Now() - state.start_time);
+  std::cout << "Committed " << progress.committed_elements << " of "
+            << progress.total_elements << " elements";
+  if (progress.total_elements > 0) {
+    std::cout << absl::StrFormat(
+        " (%.1f%%)",
+        100.0 * progress.committed_elements / progress.total_elements);
+  }
+  if (seconds > 0 && progress.committed_elements > 0) {
+    const double bytes_per_second =
+        static_cast<double>(progress.committed_elements) * state.element_size /
+        seconds;
+    std::cout << absl::StrFormat(", %.1f MB/s", bytes_per_second / 1e6);
+    if (progress.committed_elements < progress.total_elements) {
+      std::cout << absl::StrFormat(
+          ", ETA %.0fs",
+          seconds *
+              (progress.total_elements - progress.committed_elements) /
+              progress.committed_elements);
+    }
+  }
+  std::cout << std::endl;
+}
+
+// Returns `true` if the encoded chunks of `source` may be copied to `target`
+// verbatim, i.e. the two stores have identical driver configurations (codec
+// chain, chunk grid, dtype, domain) and differ only in the underlying
+// kvstore.
+Result<bool> CanCopyEncoded(const TensorStore<>& source,
+                            const TensorStore<>& target) {
+  if (!source.kvstore().valid() || !target.kvstore().valid()) return false;
+  TENSORSTORE_ASSIGN_OR_RETURN(auto source_spec, source.spec());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto target_spec, target.spec());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto source_json, source_spec.ToJson());
+  TENSORSTORE_ASSIGN_OR_RETURN(auto target_json, target_spec.ToJson());
+  source_json.erase("kvstore");
+  target_json.erase("kvstore");
+  return source_json == target_json;
+}
+
+absl::Status TsCopy(Context context, tensorstore::Spec source_spec,
+                    tensorstore::Spec target_spec, bool reencode) {
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto source, tensorstore::Open(source_spec, context,
+                                     tensorstore::OpenMode::open,
+                                     tensorstore::ReadWriteMode::read)
+                       .result());
+
+  // Create the target, if necessary, with the source dtype and domain; the
+  // target spec controls the codec and chunk layout, so the copy re-encodes
+  // the data.
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto target, tensorstore::Open(target_spec, context, source.dtype(),
+                                     source.domain(),
+                                     tensorstore::OpenMode::open |
+                                         tensorstore::OpenMode::create,
+                                     tensorstore::ReadWriteMode::write)
+                       .result());
+
+  if (!reencode) {
+    TENSORSTORE_ASSIGN_OR_RETURN(bool copy_encoded,
+                                 CanCopyEncoded(source, target));
+    if (copy_encoded) {
+      std::cout << "Codec chains match; copying encoded chunks directly."
+                << std::endl;
+      return KvstoreCopy(source.kvstore(), target.kvstore());
+    }
+  }
+
+  ProgressState state;
+  state.element_size = source.dtype().size();
+
+  auto write_futures = tensorstore::Copy(
+      source, target, CopyProgressFunction{[&state](CopyProgress progress) {
+        LogCopyProgress(state, progress);
+      }});
+
+  absl::Status status = write_futures.copy_future.result().status();
+  status.Update(write_futures.commit_future.result().status());
+  return status;
+}
+
+}  // namespace
+
+absl::Status RunTsCopy(Context::Spec context_spec, CommandFlags flags) {
+  tensorstore::JsonAbslFlag<std::optional<tensorstore::Spec>> source;
+  tensorstore::JsonAbslFlag<std::optional<tensorstore::Spec>> target;
+  bool raw = false;
+  bool reencode = false;
+
+  std::vector<LongOption> long_options({
+      LongOption{"--source",
+                 [&](std::string_view value) {
+                   std::string error;
+                   if (!AbslParseFlag(value, &source, &error)) {
+                     return absl::InvalidArgumentError(error);
+                   }
+                   return absl::OkStatus();
+                 }},
+      LongOption{"--target",
+                 [&](std::string_view value) {
+                   std::string error;
+                   if (!AbslParseFlag(value, &target, &error)) {
+                     return absl::InvalidArgumentError(error);
+                   }
+                   return absl::OkStatus();
+                 }},
+  });
+  std::vector<BoolOption> bool_options({
+      BoolOption{"--raw", [&]() { raw = true; }},
+      BoolOption{"--reencode", [&]() { reencode = true; }},
+  });
+
+  TENSORSTORE_RETURN_IF_ERROR(
+      TryParseOptions(flags, long_options, bool_options));
+
+  if (!source.value) {
+    return absl::InvalidArgumentError("Must specify --source");
+  }
+  if (!target.value) {
+    return absl::InvalidArgumentError("Must specify --target");
+  }
+
+  tensorstore::Context context(context_spec);
+
+  if (raw) {
+    // Bypass the codec and copy the underlying key-value store contents
+    // verbatim.
+    auto source_kvstore = source.value->kvstore();
+    if (!source_kvstore.valid()) {
+      return absl::InvalidArgumentError(
+          "--raw requires a kvstore-backed --source spec");
+    }
+    auto target_kvstore = target.value->kvstore();
+    if (!target_kvstore.valid()) {
+      return absl::InvalidArgumentError(
+          "--raw requires a kvstore-backed --target spec");
+    }
+    return KvstoreCopy(context, std::move(source_kvstore),
+                       std::move(target_kvstore));
+  }
+
+  return TsCopy(context, *source.value, *target.value, reencode);
+}
+
+}  // namespace cli
+}  // namespace tensorstore
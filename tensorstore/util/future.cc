@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <new>
 #include <thread>  // NOLINT
 #include <utility>
 
@@ -524,6 +525,156 @@ ReadyFuture<const void> MakeReadyFuture() {
   return *future;
 }
 
+namespace {
+
+class WhenAllBlock;
+
+/// Ready callback registered on each constituent future of the span-based
+/// `WaitAllFuture` overload.  All callbacks for a given join are stored
+/// within the single `WhenAllBlock` allocation.
+class WhenAllCallback final : public internal_future::ReadyCallbackBase {
+ public:
+  explicit WhenAllCallback(WhenAllBlock* block,
+                           internal_future::FutureStateBase* state)
+      : ReadyCallbackBase(state), block_(block) {}
+
+  void OnReady() noexcept override;
+  void OnUnregistered() noexcept override;
+  void DestroyCallback() noexcept override;
+
+ private:
+  WhenAllBlock* block_;
+};
+
+/// Joint state for the span-based `WaitAllFuture` overload: a single
+/// allocation holding the per-future ready callbacks, copies of the futures
+/// (so that forcing the joined future forces its constituents), and an atomic
+/// countdown of the futures that are not yet ready.
+///
+/// This replaces chaining `LinkError` calls in groups of 8, which allocates a
+/// separate link block per group.
+class WhenAllBlock {
+ public:
+  static Future<void> Make(tensorstore::span<const AnyFuture> futures);
+
+ private:
+  friend class WhenAllCallback;
+
+  WhenAllBlock(size_t num_futures, Promise<void> promise)
+      : remaining_(num_futures),
+        // One reference per callback, plus one for the force callback.
+        refs_(num_futures + 1),
+        num_futures_(num_futures),
+        promise_(std::move(promise)) {}
+
+  ~WhenAllBlock() {
+    for (size_t i = 0; i < num_futures_; ++i) {
+      futures_[i].~AnyFuture();
+    }
+  }
+
+  // Records that one constituent future is no longer being waited on; the
+  // last call marks the joined future ready.
+  void DecrementRemaining() {
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      promise_.SetReady();
+    }
+  }
+
+  // Releases one of the `refs_` references; the last release frees the block.
+  void ReleaseRef() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      this->~WhenAllBlock();
+      ::operator delete(static_cast<void*>(this));
+    }
+  }
+
+  // Move-only handle to one of the `refs_` references, captured by the force
+  // callback.
+  struct Ref {
+    explicit Ref(WhenAllBlock* block) : block(block) {}
+    Ref(Ref&& other) : block(std::exchange(other.block, nullptr)) {}
+    ~Ref() {
+      if (block) block->ReleaseRef();
+    }
+    WhenAllBlock* block;
+  };
+
+  std::atomic<size_t> remaining_;
+  std::atomic<size_t> refs_;
+  size_t num_futures_;
+  Promise<void> promise_;
+  // Arrays of length `num_futures_` within the same allocation.
+  WhenAllCallback* callbacks_;
+  AnyFuture* futures_;
+};
+
+void WhenAllCallback::OnReady() noexcept {
+  WhenAllBlock* block = block_;
+  auto state = TakeStatePointer();
+  if (!state->has_value()) {
+    // The first error encountered propagates immediately.
+    block->promise_.SetResult(state->status());
+  }
+  block->DecrementRemaining();
+}
+
+void WhenAllCallback::OnUnregistered() noexcept {
+  // Only reachable via explicit unregistration, which is not exposed; treat
+  // the future as ready so that the join still completes.
+  TakeStatePointer();
+  block_->DecrementRemaining();
+}
+
+void WhenAllCallback::DestroyCallback() noexcept {
+  WhenAllBlock* block = block_;
+  this->~WhenAllCallback();
+  block->ReleaseRef();
+}
+
+Future<void> WhenAllBlock::Make(tensorstore::span<const AnyFuture> futures) {
+  const size_t n = futures.size();
+  auto [promise, future] = PromiseFuturePair<void>::Make(std::in_place);
+
+  constexpr auto round_up = [](size_t offset, size_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+  };
+  const size_t callbacks_offset =
+      round_up(sizeof(WhenAllBlock), alignof(WhenAllCallback));
+  const size_t futures_offset = round_up(
+      callbacks_offset + n * sizeof(WhenAllCallback), alignof(AnyFuture));
+  char* buffer =
+      static_cast<char*>(::operator new(futures_offset + n * sizeof(AnyFuture)));
+  auto* block = new (buffer) WhenAllBlock(n, std::move(promise));
+  block->callbacks_ =
+      reinterpret_cast<WhenAllCallback*>(buffer + callbacks_offset);
+  block->futures_ = reinterpret_cast<AnyFuture*>(buffer + futures_offset);
+  for (size_t i = 0; i < n; ++i) {
+    new (&block->futures_[i]) AnyFuture(futures[i]);
+  }
+
+  // Forcing the joined future forces all of the constituent futures.
+  block->promise_.ExecuteWhenForced([ref = Ref(block)](Promise<void>) {
+    WhenAllBlock* block = ref.block;
+    for (size_t i = 0; i < block->num_futures_; ++i) {
+      block->futures_[i].Force();
+    }
+  });
+
+  for (size_t i = 0; i < n; ++i) {
+    AnyFuture f = block->futures_[i];
+    // Transfers one future reference to the registered callback.
+    auto* state = internal_future::FutureAccess::rep_pointer(f).release();
+    auto* callback = new (&block->callbacks_[i]) WhenAllCallback(block, state);
+    // The returned `CallbackPointer` is discarded; the callback remains
+    // registered until the future becomes ready.
+    state->RegisterReadyCallback(callback);
+  }
+  return std::move(future);
+}
+
+}  // namespace
+
 Future<void> WaitAllFuture(tensorstore::span<const AnyFuture> futures) {
   auto& f = futures;
   switch (f.size()) {
@@ -558,45 +709,9 @@ Future<void> WaitAllFuture(tensorstore::span<const AnyFuture> futures) {
       break;
   }
 
-  // 8 or more...
-  auto [promise, result] = PromiseFuturePair<void>::LinkError(
-      absl::OkStatus(), f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7]);
-  f = f.subspan(8);
-  while (f.size() > 8) {
-    LinkError(promise, f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7]);
-    f = f.subspan(8);
-  }
-
-  switch (f.size()) {
-    case 0:
-      return std::move(result);
-    case 1:
-      LinkError(std::move(promise), f[0]);
-      return std::move(result);
-    case 2:
-      LinkError(std::move(promise), f[0], f[1]);
-      return std::move(result);
-    case 3:
-      LinkError(std::move(promise), f[0], f[1], f[2]);
-      return std::move(result);
-    case 4:
-      LinkError(std::move(promise), f[0], f[1], f[2], f[3]);
-      return std::move(result);
-    case 5:
-      LinkError(std::move(promise), f[0], f[1], f[2], f[3], f[4]);
-      return std::move(result);
-    case 6:
-      LinkError(std::move(promise), f[0], f[1], f[2], f[3], f[4], f[5]);
-      return std::move(result);
-    case 7:
-      LinkError(std::move(promise), f[0], f[1], f[2], f[3], f[4], f[5], f[6]);
-      return std::move(result);
-    case 8:
-      LinkError(std::move(promise), f[0], f[1], f[2], f[3], f[4], f[5], f[6],
-                f[7]);
-      return std::move(result);
-  }
-  ABSL_UNREACHABLE();  // COV_NF_LINE
+  // 8 or more: use a single jointly-allocated state block with an atomic
+  // countdown rather than chaining per-group link blocks.
+  return WhenAllBlock::Make(futures);
 }
 
 }  // namespace tensorstore
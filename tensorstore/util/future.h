@@ -475,12 +475,11 @@ class AnyFuture {
   FutureCallbackRegistration UntypedExecuteWhenReady(Callback&& callback) {
     static_assert(std::is_invocable_v<Callback, AnyFuture>);
     if (!rep_->ready()) {
-      using Impl =
-          internal_future::ReadyCallback<AnyFuture,
-                                         absl::remove_cvref_t<Callback>>;
       return internal_future::FutureAccess::Construct<
           FutureCallbackRegistration>(rep_->RegisterReadyCallback(
-          new Impl(rep_.release(), std::forward<Callback>(callback))));
+          internal_future::AllocateReadyCallback<
+              AnyFuture, absl::remove_cvref_t<Callback>>(
+              rep_.release(), std::forward<Callback>(callback))));
     }
     std::forward<Callback>(callback)(std::move(*this));
     return FutureCallbackRegistration();
@@ -790,12 +789,11 @@ class Future : public AnyFuture {
   FutureCallbackRegistration ExecuteWhenReady(Callback&& callback) && {
     static_assert(std::is_invocable_v<Callback, ReadyFuture<T>>);
     if (!rep_->ready()) {
-      using Impl =
-          internal_future::ReadyCallback<ReadyFuture<T>,
-                                         absl::remove_cvref_t<Callback>>;
       return internal_future::FutureAccess::Construct<
           FutureCallbackRegistration>(rep_->RegisterReadyCallback(
-          new Impl(rep_.release(), std::forward<Callback>(callback))));
+          internal_future::AllocateReadyCallback<
+              ReadyFuture<T>, absl::remove_cvref_t<Callback>>(
+              rep_.release(), std::forward<Callback>(callback))));
     }
     std::forward<Callback>(callback)(ReadyFuture<T>(std::move(*this)));
     return FutureCallbackRegistration();
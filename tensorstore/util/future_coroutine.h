@@ -0,0 +1,141 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TENSORSTORE_UTIL_FUTURE_COROUTINE_H_
+#define TENSORSTORE_UTIL_FUTURE_COROUTINE_H_
+
+/// \file
+/// C++20 coroutine integration for `Future`.
+///
+/// When compiled with coroutine support (C++20 or later), this header makes
+/// `Future<T>` awaitable and usable as a coroutine return type:
+///
+///     Future<int> GetTotal(Context context) {
+///       TENSORSTORE_ASSIGN_OR_RETURN(auto array,
+///                                    co_await tensorstore::Read(store));
+///       co_return ComputeTotal(array);
+///     }
+///
+/// `co_await future` forces the future and suspends the coroutine until the
+/// future is ready, evaluating to the `Result<T>`.  If the future is already
+/// ready, the coroutine does not suspend and no allocation is performed; the
+/// suspending path registers its continuation via `ExecuteWhenReady`, which
+/// uses the inline callback storage of the future's shared state.  The
+/// coroutine is resumed on whatever thread marks the future ready, just like
+/// any other `ExecuteWhenReady` callback.
+///
+/// A coroutine with return type `Future<T>` may `co_return` anything accepted
+/// by `Promise<T>::SetResult`, e.g. a value, a `Result<T>`, or an error
+/// `absl::Status`.
+///
+/// Flow senders (`tensorstore/util/execution`) have no single-value
+/// completion to await; adapt them with
+/// `tensorstore::CollectFlowSenderIntoFuture` and await the resulting future.
+///
+/// TensorStore itself is built without coroutines; this header expands to
+/// nothing under C++17 and carries no extra dependencies for such builds.
+
+#include "tensorstore/util/future.h"  // IWYU pragma: export
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && \
+    __has_include(<coroutine>)
+#define TENSORSTORE_FUTURE_COROUTINE_SUPPORT 1
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "tensorstore/util/result.h"
+
+namespace tensorstore {
+namespace internal_future {
+
+/// Awaiter returned by `operator co_await` for `Future<T>`.
+template <typename T>
+class FutureAwaiter {
+ public:
+  explicit FutureAwaiter(Future<T> future) : future_(std::move(future)) {}
+
+  bool await_ready() const noexcept { return future_.ready(); }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    future_.Force();
+    future_.ExecuteWhenReady(
+        [handle](ReadyFuture<T>) mutable { handle.resume(); });
+  }
+
+  Result<T> await_resume() { return future_.result(); }
+
+ private:
+  Future<T> future_;
+};
+
+/// Coroutine promise type for coroutines returning `Future<T>`.
+///
+/// The returned future is forced for the entire duration of the coroutine,
+/// since the coroutine body has no way to observe a `Force` call on it.
+template <typename T>
+class FutureCoroutinePromise {
+ public:
+  FutureCoroutinePromise() : pair_(PromiseFuturePair<T>::Make()) {}
+
+  Future<T> get_return_object() {
+    auto future = std::move(pair_.future);
+    future.Force();
+    return future;
+  }
+
+  std::suspend_never initial_suspend() noexcept { return {}; }
+  std::suspend_never final_suspend() noexcept { return {}; }
+
+  template <typename V>
+  void return_value(V&& v) {
+    pair_.promise.SetResult(std::forward<V>(v));
+  }
+
+  void unhandled_exception() {
+    try {
+      throw;
+    } catch (const std::exception& e) {
+      pair_.promise.SetResult(absl::UnknownError(e.what()));
+    } catch (...) {
+      pair_.promise.SetResult(
+          absl::UnknownError("Unknown exception in coroutine"));
+    }
+  }
+
+ private:
+  PromiseFuturePair<T> pair_;
+};
+
+}  // namespace internal_future
+
+template <typename T>
+internal_future::FutureAwaiter<T> operator co_await(Future<T> future) {
+  return internal_future::FutureAwaiter<T>(std::move(future));
+}
+
+}  // namespace tensorstore
+
+namespace std {
+template <typename T, typename... Args>
+struct coroutine_traits<tensorstore::Future<T>, Args...> {
+  using promise_type = tensorstore::internal_future::FutureCoroutinePromise<T>;
+};
+}  // namespace std
+
+#endif  // defined(__cpp_impl_coroutine)
+
+#endif  // TENSORSTORE_UTIL_FUTURE_COROUTINE_H_
@@ -0,0 +1,83 @@
+// Copyright 2026 The TensorStore Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tensorstore/util/future_coroutine.h"
+
+#ifdef TENSORSTORE_FUTURE_COROUTINE_SUPPORT
+
+#include <gtest/gtest.h>
+#include "absl/status/status.h"
+#include "tensorstore/util/future.h"
+#include "tensorstore/util/result.h"
+#include "tensorstore/util/status_testutil.h"
+
+namespace {
+
+using ::tensorstore::Future;
+using ::tensorstore::MakeReadyFuture;
+using ::tensorstore::MatchesStatus;
+using ::tensorstore::PromiseFuturePair;
+using ::tensorstore::Result;
+
+Future<int> AddOne(Future<int> future) {
+  Result<int> result = co_await future;
+  if (!result.ok()) co_return result.status();
+  co_return *result + 1;
+}
+
+TEST(FutureCoroutineTest, AwaitReadyFuture) {
+  auto future = AddOne(MakeReadyFuture<int>(2));
+  // The awaited future was already ready; the coroutine never suspended.
+  ASSERT_TRUE(future.ready());
+  EXPECT_THAT(future.result(), ::testing::Optional(3));
+}
+
+TEST(FutureCoroutineTest, AwaitPendingFuture) {
+  auto pair = PromiseFuturePair<int>::Make();
+  auto future = AddOne(pair.future);
+  EXPECT_FALSE(future.ready());
+  pair.promise.SetResult(5);
+  ASSERT_TRUE(future.ready());
+  EXPECT_THAT(future.result(), ::testing::Optional(6));
+}
+
+TEST(FutureCoroutineTest, AwaitForcesFuture) {
+  bool forced = false;
+  auto pair = PromiseFuturePair<int>::Make();
+  pair.promise.ExecuteWhenForced(
+      [&](tensorstore::Promise<int> promise) { forced = true; });
+  auto future = AddOne(pair.future);
+  EXPECT_TRUE(forced);
+  pair.promise.SetResult(0);
+}
+
+TEST(FutureCoroutineTest, PropagatesError) {
+  auto pair = PromiseFuturePair<int>::Make();
+  auto future = AddOne(pair.future);
+  pair.promise.SetResult(absl::InvalidArgumentError("bad"));
+  EXPECT_THAT(future.result(),
+              MatchesStatus(absl::StatusCode::kInvalidArgument, "bad"));
+}
+
+TEST(FutureCoroutineTest, CoReturnError) {
+  auto coroutine = []() -> Future<int> {
+    co_return absl::FailedPreconditionError("nope");
+  };
+  EXPECT_THAT(coroutine().result(),
+              MatchesStatus(absl::StatusCode::kFailedPrecondition, "nope"));
+}
+
+}  // namespace
+
+#endif  // TENSORSTORE_FUTURE_COROUTINE_SUPPORT
@@ -23,6 +23,8 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <new>
 #include <thread>  // NOLINT
 #include <type_traits>
 #include <utility>
@@ -433,6 +435,54 @@ class FutureStateBase {
 
   // Future-only reference count.
   std::atomic<uint32_t> future_reference_count_;
+
+  /// Size in bytes of the inline callback storage.
+  ///
+  /// Large enough for an `InlineReadyCallback` whose function object captures
+  /// a few pointer-sized values, which covers the typical continuation
+  /// attached by chained operations.
+  constexpr static size_t kInlineCallbackCapacity = 96;
+
+  /// Attempts to allocate `size` bytes for a callback within
+  /// `inline_callback_storage_`, avoiding a heap allocation for the common
+  /// case of a single small continuation per future.
+  ///
+  /// On success, acquires a combined reference that keeps this object (and
+  /// therefore the storage) alive until `FreeInlineCallback` is called; a
+  /// `FutureCallbackRegistration` may retain a reference to the callback
+  /// object after all `Future` and `Promise` references have been released.
+  ///
+  /// \returns A pointer to the storage, or `nullptr` if the storage is
+  ///     unavailable or too small.
+  /// \threadsafety Thread safe.
+  void* TryAllocateInlineCallback(size_t size, size_t alignment) noexcept {
+    if (size > kInlineCallbackCapacity ||
+        alignment > alignof(std::max_align_t) ||
+        inline_callback_busy_.exchange(true, std::memory_order_acq_rel)) {
+      return nullptr;
+    }
+    combined_reference_count_.fetch_add(1, std::memory_order_relaxed);
+    return +inline_callback_storage_;
+  }
+
+  /// Releases the inline callback storage and the combined reference acquired
+  /// by `TryAllocateInlineCallback`.
+  ///
+  /// The callback object must have already been destroyed.  `this` may not be
+  /// valid after calling this method.
+  ///
+  /// \threadsafety Thread safe.
+  void FreeInlineCallback() noexcept {
+    inline_callback_busy_.store(false, std::memory_order_release);
+    ReleaseCombinedReference();
+  }
+
+  /// `true` while `inline_callback_storage_` is in use.
+  std::atomic<bool> inline_callback_busy_{false};
+
+  /// Storage for a single small ready callback.
+  alignas(std::max_align_t) char inline_callback_storage_[
+      kInlineCallbackCapacity];
 };
 
 struct FuturePointerTraits {
@@ -706,6 +756,69 @@ class ReadyCallback final : public ReadyCallbackBase {
   };
 };
 
+/// Variant of `ReadyCallback` stored in the shared state's inline callback
+/// storage rather than on the heap.
+///
+/// The storage is kept alive by the combined reference acquired in
+/// `FutureStateBase::TryAllocateInlineCallback`, which `DestroyCallback`
+/// releases after destroying this object.
+template <typename ReadyType, typename Callback>
+class InlineReadyCallback final : public ReadyCallbackBase {
+ public:
+  static_assert(std::is_base_of_v<AnyFuture, ReadyType>);
+
+  template <typename U>
+  explicit InlineReadyCallback(FutureStateBase* state, U&& u)
+      : ReadyCallbackBase(state), callback_(std::forward<U>(u)) {}
+
+  void OnReady() noexcept override {
+    internal_tracing::SwapCurrentTraceContext(&trace_context_);
+    std::move(callback_)(
+        FutureAccess::Construct<ReadyType>(TakeStatePointer()));
+    callback_.~Callback();
+    internal_tracing::SwapCurrentTraceContext(&trace_context_);
+  }
+
+  void OnUnregistered() noexcept override {
+    TakeStatePointer();
+    callback_.~Callback();
+  }
+
+  void DestroyCallback() noexcept override {
+    // `shared_state_` remains valid (though possibly with all future and
+    // promise references released) because of the combined reference
+    // associated with the storage.
+    FutureStateBase* state = this->shared_state();
+    this->~InlineReadyCallback();
+    state->FreeInlineCallback();
+  }
+
+  ~InlineReadyCallback() override {}
+
+ private:
+  // We store the Callback in a union in order to disable the automatic
+  // invocation of the constructor and destructor.
+  union {
+    Callback callback_;
+  };
+};
+
+/// Allocates a ready callback for `state` with the function object
+/// constructed from `u`, using the shared state's inline callback storage
+/// when available and falling back to the heap.
+///
+/// The caller implicitly transfers 1 `future_reference_count_` of `state` to
+/// the returned callback.
+template <typename ReadyType, typename Callback, typename U>
+ReadyCallbackBase* AllocateReadyCallback(FutureStateBase* state, U&& u) {
+  using InlineImpl = InlineReadyCallback<ReadyType, Callback>;
+  if (void* storage = state->TryAllocateInlineCallback(sizeof(InlineImpl),
+                                                       alignof(InlineImpl))) {
+    return new (storage) InlineImpl(state, std::forward<U>(u));
+  }
+  return new ReadyCallback<ReadyType, Callback>(state, std::forward<U>(u));
+}
+
 /// Implements a promise callback for use with ExecuteWhenForced.
 /// \tparam T The value type of the promise.
 /// \tparam Callback Type of unary function object called with a `Promise<T>`
@@ -25,6 +25,7 @@
 #include <thread>  // NOLINT
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <gmock/gmock.h>
@@ -1643,6 +1644,65 @@ TEST(WaitAllFuture, ReadyFutureSpan) {
   }
 }
 
+// Tests the jointly-allocated state block used for spans of 8 or more
+// futures.
+TEST(WaitAllFuture, LargeSpanNotReady) {
+  std::vector<PromiseFuturePair<int>> pairs;
+  std::vector<AnyFuture> futures;
+  for (int i = 0; i < 12; i++) {
+    pairs.push_back(PromiseFuturePair<int>::Make());
+    futures.emplace_back(pairs.back().future);
+  }
+  auto future = WaitAllFuture(futures);
+  for (int i = 0; i < 12; i++) {
+    ASSERT_FALSE(future.ready());
+    pairs[i].promise.SetResult(i);
+  }
+  ASSERT_TRUE(future.ready());
+  EXPECT_TRUE(future.result().ok());
+}
+
+TEST(WaitAllFuture, LargeSpanError) {
+  std::vector<PromiseFuturePair<int>> pairs;
+  std::vector<AnyFuture> futures;
+  for (int i = 0; i < 9; i++) {
+    pairs.push_back(PromiseFuturePair<int>::Make());
+    futures.emplace_back(pairs.back().future);
+  }
+  auto future = WaitAllFuture(futures);
+  ASSERT_FALSE(future.ready());
+
+  // The first error propagates without waiting for the remaining futures.
+  pairs[3].promise.SetResult(absl::InternalError(""));
+  ASSERT_TRUE(future.ready());
+  EXPECT_FALSE(future.result().ok());
+
+  for (int i = 0; i < 9; i++) {
+    pairs[i].promise.SetResult(i);
+  }
+}
+
+TEST(WaitAllFuture, LargeSpanForce) {
+  std::vector<PromiseFuturePair<int>> pairs;
+  std::vector<AnyFuture> futures;
+  std::atomic<int> forced{0};
+  for (int i = 0; i < 10; i++) {
+    auto pair = PromiseFuturePair<int>::Make();
+    pair.promise.ExecuteWhenForced([&forced](Promise<int>) { forced++; });
+    pairs.push_back(pair);
+    futures.emplace_back(pair.future);
+  }
+  auto future = WaitAllFuture(futures);
+  EXPECT_EQ(0, forced);
+  future.Force();
+  EXPECT_EQ(10, forced);
+  for (auto& pair : pairs) {
+    pair.promise.SetResult(1);
+  }
+  ASSERT_TRUE(future.ready());
+  EXPECT_TRUE(future.result().ok());
+}
+
 TEST(WaitAllFuture, NonVoidFuture) {
   auto a = PromiseFuturePair<int>::Make();
   auto b = PromiseFuturePair<int>::Make();
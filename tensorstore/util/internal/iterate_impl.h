@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <array>
+#include <cassert>
 #include <type_traits>
 #include <utility>
 
@@ -245,6 +246,27 @@ class IterateHelper {
                     pointers...);
   }
 
+  /// Same as `Start`, but for a layout of rank `Rank` known at compile time.
+  ///
+  /// Generates a fixed-depth loop nest without the per-level rank checks of
+  /// `Start`, allowing the compiler to fully unroll the recursion for the
+  /// small ranks that predominate after layout simplification.
+  ///
+  /// \pre `layouts.size() == Rank`
+  template <DimensionIndex Rank>
+  static Result StartStatic(Func func,
+                            span<const DimensionSizeAndStrides<arity>> layouts,
+                            Pointer... pointers) {
+    assert(layouts.size() == Rank);
+    if constexpr (Rank == 0) {
+      return func(pointers...);
+    } else {
+      return StaticLoopImpl<Rank>(func, layouts.data(),
+                                  std::index_sequence_for<Pointer...>(),
+                                  pointers...);
+    }
+  }
+
  private:
   /// Loops over the next dimension, and either recurses or calls `func`.
   ///
@@ -275,6 +297,32 @@ class IterateHelper {
     }
     return result;
   }
+
+  /// Loops over the next dimension of a layout with `Rank` dimensions
+  /// remaining, and either recurses or calls `func`.
+  template <DimensionIndex Rank, size_t... Is>
+  static Result StaticLoopImpl(Func func,
+                               const DimensionSizeAndStrides<arity>* layouts,
+                               std::index_sequence<Is...> index_sequence,
+                               Pointer... pointers) {
+    static_assert(Rank >= 1);
+    const DimensionSizeAndStrides<arity> size_and_strides = layouts[0];
+    auto increment_pointers = [&]() ABSL_ATTRIBUTE_ALWAYS_INLINE {
+      ((pointers += size_and_strides.strides[Is]), ...);
+    };
+    Result result = internal::DefaultIterationResult<Result>::value();
+    for (Index i = 0; i < size_and_strides.size; ++i) {
+      if constexpr (Rank == 1) {
+        result = func(pointers...);
+      } else {
+        result = StaticLoopImpl<Rank - 1>(func, layouts + 1, index_sequence,
+                                          pointers...);
+      }
+      if (!result) break;
+      increment_pointers();
+    }
+    return result;
+  }
 };
 
 #define TENSORSTORE_INTERNAL_FOR_EACH_ARITY(X, ...) \
@@ -154,11 +154,27 @@ struct StridedLayoutFunctionApplyer<Arity>::WrappedFunction {
   static bool OuterCallHelper(
       const StridedLayoutFunctionApplyer& data, std::index_sequence<Is...>,
       std::array<ByteStridedPointer<void>, Arity> pointers, void* arg) {
-    return internal_iterate::IterateHelper<
+    using Helper = internal_iterate::IterateHelper<
         WrappedFunction,
-        std::enable_if_t<true || Is, ByteStridedPointer<void>>...>::
-        Start(WrappedFunction{data, arg}, data.iteration_layout_,
-              pointers[Is]...);
+        std::enable_if_t<true || Is, ByteStridedPointer<void>>...>;
+    const WrappedFunction func{data, arg};
+    // Dispatch on the outer rank to fixed-depth loop nests for the small
+    // ranks that predominate after layout simplification.  Combined with the
+    // 2 inner dimensions handled by the elementwise function, outer ranks
+    // 0-2 cover original layouts of rank up to 4.
+    switch (data.iteration_layout_.size()) {
+      case 0:
+        return Helper::template StartStatic<0>(func, data.iteration_layout_,
+                                               pointers[Is]...);
+      case 1:
+        return Helper::template StartStatic<1>(func, data.iteration_layout_,
+                                               pointers[Is]...);
+      case 2:
+        return Helper::template StartStatic<2>(func, data.iteration_layout_,
+                                               pointers[Is]...);
+      default:
+        return Helper::Start(func, data.iteration_layout_, pointers[Is]...);
+    }
   }
 
   template <size_t... Is, typename... Pointer>
@@ -524,6 +524,60 @@ TEST(IterateOverStridedLayoutsTest, InnerRank0NonContiguousFortranStop) {
   EXPECT_EQ(expected_result, result);
 }
 
+template <DimensionIndex Rank, typename Func, typename... Pointer>
+std::invoke_result_t<Func&, Pointer...> IterateOverStridedLayoutsStatic(
+    span<const Index> shape,
+    std::array<const Index*, sizeof...(Pointer)> strides, Func&& func,
+    tensorstore::IterationConstraints constraints, Pointer... pointer) {
+  auto iteration_layout =
+      SimplifyStridedIterationLayout(constraints, shape, strides);
+  return tensorstore::internal_iterate::IterateHelper<Func&, Pointer...>::
+      template StartStatic<Rank>(func, iteration_layout, pointer...);
+}
+
+TEST(IterateOverStridedLayoutsTest, StaticRankMatchesDynamic) {
+  const Index shape[] = {2, 3, 2};
+  const Index strides0[] = {6, 2, 1};
+  const Index strides1[] = {2, 8, 1};
+
+  using R = std::tuple<int, int>;
+  std::vector<R> dynamic_result;
+  auto dynamic_func = [&](int a, int b) {
+    dynamic_result.emplace_back(a, b);
+    return true;
+  };
+  IterateOverStridedLayouts(shape, {{strides0, strides1}}, dynamic_func,
+                            ContiguousLayoutOrder::c, 0, 0);
+
+  std::vector<R> static_result;
+  auto static_func = [&](int a, int b) {
+    static_result.emplace_back(a, b);
+    return true;
+  };
+  IterateOverStridedLayoutsStatic<3>(shape, {{strides0, strides1}},
+                                     static_func, ContiguousLayoutOrder::c, 0,
+                                     0);
+  EXPECT_EQ(dynamic_result, static_result);
+}
+
+TEST(IterateOverStridedLayoutsTest, StaticRankStop) {
+  const Index shape[] = {2, 3};
+  const Index strides0[] = {3, 1};
+  const Index strides1[] = {3 * 4, 1 * 4};
+
+  using R = std::tuple<int, int>;
+  std::vector<R> result;
+  auto func = [&](int a, int b) {
+    result.emplace_back(a, b);
+    return a != 2;
+  };
+  EXPECT_EQ(false, IterateOverStridedLayoutsStatic<1>(
+                       shape, {{strides0, strides1}}, func,
+                       ContiguousLayoutOrder::c, 0, 0));
+  std::vector<R> expected_result{R{0, 0}, R{1, 4}, R{2, 8}};
+  EXPECT_EQ(expected_result, result);
+}
+
 template <ContiguousLayoutOrder Order>
 std::vector<std::vector<int>> GetIndexVectors(std::vector<int> shape) {
   std::vector<std::vector<int>> result;
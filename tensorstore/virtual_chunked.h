@@ -84,6 +84,32 @@
 ///   unique generation identifier and the time at which it is known to be
 ///   current should be returned.
 ///
+/// Batched read function
+/// ---------------------
+///
+/// Alternatively, a TensorStore may be created with
+/// `VirtualChunkedBatched<Element, Rank>(batch_read_function, option...)` from
+/// a `batch_read_function` compatible with the signature:
+///
+///     (span<const Array<Element, Rank, offset_origin>> outputs,
+///      tensorstore::virtual_chunked::ReadParameters read_params)
+///     -> Future<TimestampedStorageGeneration>
+///
+/// Chunks read using the same `tensorstore::Batch` are passed to
+/// `batch_read_function` in a single call, which amortizes per-call overhead
+/// when the function is expensive to invoke (e.g. dispatches to Python).
+/// Chunks read without a batch are passed in calls with a single element.
+///
+/// - Each array in `outputs` specifies one chunk to fill, with the chunk
+///   position indicated by the `origin` and `shape` of the array, exactly as
+///   for the non-batched `read_function`.  The `outputs` span itself is only
+///   valid for the duration of the call, but the array data remains valid
+///   until the returned `Future` becomes ready.
+///
+/// - The returned generation and timestamp apply to every chunk in the batch.
+///   Because of that, `read_params.if_not_equal()` is always unspecified for
+///   batched reads; cached chunks are instead revalidated by recomputing them.
+///
 /// Write function
 /// --------------
 ///
@@ -245,6 +271,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/meta/type_traits.h"
@@ -259,6 +286,7 @@
 #include "tensorstore/transaction.h"
 #include "tensorstore/util/executor.h"
 #include "tensorstore/util/option.h"
+#include "tensorstore/util/span.h"
 
 namespace tensorstore {
 namespace virtual_chunked {
@@ -299,6 +327,20 @@ constexpr inline bool IsReadFunction =
         Future<TimestampedStorageGeneration>, Func,
         Array<Element, Rank, offset_origin>, ReadParameters>;
 
+/// Type-erased function called to read a batch of chunks.
+using BatchReadFunction =
+    serialization::SerializableFunction<Future<TimestampedStorageGeneration>(
+        span<const Array<void, dynamic_rank, offset_origin>> outputs,
+        ReadParameters read_params)>;
+
+/// Metafunction that evaluates to `true` if `Func` may be used as a "batch
+/// read function" for the specified compile-time `Element` type and `Rank`.
+template <typename Func, typename Element, DimensionIndex Rank>
+constexpr inline bool IsBatchReadFunction =
+    serialization::IsSerializableFunctionLike<
+        Future<TimestampedStorageGeneration>, Func,
+        span<const Array<Element, Rank, offset_origin>>, ReadParameters>;
+
 /// Parameters available to the write function for storing the content of a
 /// chunk.
 class WriteParameters {
@@ -406,6 +448,10 @@ Result<internal::Driver::Handle> MakeDriver(
     virtual_chunked::ReadFunction read_function,
     virtual_chunked::WriteFunction write_function, OpenOptions&& options);
 
+Result<internal::Driver::Handle> MakeBatchDriver(
+    virtual_chunked::BatchReadFunction batch_read_function,
+    OpenOptions&& options);
+
 /// Converts a ReadFunction or WriteFunction for a known `Element` type and
 /// `Rank` into a type-erased `ReadFunction` or `WriteFunction`.
 template <typename ErasedElement, typename Element, DimensionIndex Rank,
@@ -424,6 +470,29 @@ struct FunctionAdapter {
   };
 };
 
+/// Converts a batch read function for a known `Element` type and `Rank` into a
+/// type-erased `BatchReadFunction`.
+template <typename Element, DimensionIndex Rank, typename Func>
+struct BatchFunctionAdapter {
+  Future<TimestampedStorageGeneration> operator()(
+      span<const Array<void, dynamic_rank, offset_origin>> arrays,
+      ReadParameters params) const {
+    std::vector<Array<Element, Rank, offset_origin>> typed_arrays;
+    typed_arrays.reserve(arrays.size());
+    for (const auto& array : arrays) {
+      typed_arrays.push_back(
+          StaticCast<Array<Element, Rank, offset_origin>, unchecked>(array));
+    }
+    return func_(
+        span<const Array<Element, Rank, offset_origin>>(typed_arrays),
+        std::move(params));
+  }
+  ABSL_ATTRIBUTE_NO_UNIQUE_ADDRESS Func func_;
+  constexpr static auto ApplyMembers = [](auto&& x, auto f) {
+    return f(x.func_);
+  };
+};
+
 }  // namespace internal_virtual_chunked
 
 /// Creates a read-only TensorStore where the content is read chunk-wise by the
@@ -583,6 +652,60 @@ VirtualChunkedWriteOnly(WriteFunc write_function, OpenOptions&& options) {
       TensorStore<Element, Rank, ReadWriteMode::write>>(std::move(handle));
 }
 
+/// Creates a read-only TensorStore where the content of batches of chunks is
+/// computed by a single call to the specified user-defined function.
+///
+/// Chunks read using the same `tensorstore::Batch` are passed to
+/// `batch_read_function` together, amortizing per-call overhead across the
+/// chunks in the batch.
+///
+/// \param batch_read_function Function called to compute batches of chunks.
+///     Must be callable with
+///     `(span<const Array<Element, Rank, offset_origin>>, ReadParameters)` and
+///     have a return value convertible to
+///     `Future<TimestampedStorageGeneration>`.  By default must be
+///     serializable.  To specify a non-serializable function, wrap it in
+///     `NonSerializable`.
+/// \param options Open options.  The domain must always be specified (either
+///     via an `IndexDomain` or `tensorstore::Schema::Shape`).  If `Element` is
+///     `void`, the data type must also be specified.
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          typename BatchReadFunc>
+std::enable_if_t<IsBatchReadFunction<BatchReadFunc, Element, Rank>,
+                 Result<TensorStore<Element, Rank, ReadWriteMode::read>>>
+VirtualChunkedBatched(BatchReadFunc batch_read_function,
+                      OpenOptions&& options) {
+  static_assert(std::is_same_v<Element, absl::remove_cvref_t<Element>>,
+                "Element type must be unqualified");
+  static_assert(Rank >= dynamic_rank,
+                "Rank must equal dynamic_rank (-1) or be non-negative.");
+  if constexpr (Rank != dynamic_rank) {
+    TENSORSTORE_RETURN_IF_ERROR(options.Set(RankConstraint{Rank}));
+  }
+  if constexpr (!std::is_void_v<Element>) {
+    TENSORSTORE_RETURN_IF_ERROR(options.Set(dtype_v<Element>));
+  }
+  BatchReadFunction serializable_batch_read_function;
+  if constexpr (std::is_void_v<Element> && Rank == dynamic_rank) {
+    serializable_batch_read_function = std::move(batch_read_function);
+  } else {
+    serializable_batch_read_function =
+        internal_virtual_chunked::BatchFunctionAdapter<Element, Rank,
+                                                       BatchReadFunc>{
+            std::move(batch_read_function)};
+    if (!serializable_batch_read_function) {
+      return absl::InvalidArgumentError(
+          "Invalid batch_read_function specified");
+    }
+  }
+  TENSORSTORE_ASSIGN_OR_RETURN(
+      auto handle,
+      internal_virtual_chunked::MakeBatchDriver(
+          std::move(serializable_batch_read_function), std::move(options)));
+  return internal::TensorStoreAccess::Construct<
+      TensorStore<Element, Rank, ReadWriteMode::read>>(std::move(handle));
+}
+
 /// Creates a read-only TensorStore where the content is read chunk-wise by the
 /// specified user-defined function.
 ///
@@ -643,6 +766,33 @@ VirtualChunked(ReadFunc read_function, WriteFunc write_function,
       std::move(read_function), std::move(write_function), std::move(options));
 }
 
+/// Creates a read-only TensorStore where the content of batches of chunks is
+/// computed by a single call to the specified user-defined function.
+///
+/// \param batch_read_function Function called to compute batches of chunks.
+///     Must be callable with
+///     `(span<const Array<Element, Rank, offset_origin>>, ReadParameters)` and
+///     have a return value convertible to
+///     `Future<TimestampedStorageGeneration>`.  By default must be
+///     serializable.  To specify a non-serializable function, wrap it in
+///     `NonSerializable`.
+/// \param option Option compatible with `OpenOptions`, which may be specified
+///     in any order.  If `Rank == dynamic_rank`, the rank must always be
+///     specified.  If `Element` is `void`, the data type must also be
+///     specified.
+template <typename Element = void, DimensionIndex Rank = dynamic_rank,
+          typename BatchReadFunc, typename... Option>
+std::enable_if_t<(IsBatchReadFunction<BatchReadFunc, Element, Rank> &&
+                  IsCompatibleOptionSequence<OpenOptions, Option...>),
+                 Result<TensorStore<Element, Rank, ReadWriteMode::read>>>
+VirtualChunkedBatched(BatchReadFunc batch_read_function, Option&&... option) {
+  OpenOptions options;
+  TENSORSTORE_RETURN_IF_ERROR(
+      internal::SetAll(options, std::forward<Option>(option)...));
+  return VirtualChunkedBatched<Element, Rank>(std::move(batch_read_function),
+                                              std::move(options));
+}
+
 /// Creates a write-only TensorStore where the content is written chunk-wise by
 /// specified user-defined functions.
 ///
@@ -672,6 +822,7 @@ VirtualChunkedWriteOnly(WriteFunc write_function, Option&&... option) {
 }  // namespace virtual_chunked
 
 using virtual_chunked::VirtualChunked;           // NOLINT
+using virtual_chunked::VirtualChunkedBatched;    // NOLINT
 using virtual_chunked::VirtualChunkedWriteOnly;  // NOLINT
 
 }  // namespace tensorstore